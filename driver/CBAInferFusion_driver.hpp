@@ -275,11 +275,11 @@ int CBAInferFusionDriver<Tgpu, Tref>::ParseCmdLineArgs(int argc, char* argv[])
         miopen::FusionMDGraph mdg;
         if(op == "ConvForward")
         {
-            miopen::FusionMDGraph::InitConv(mdg);
+            miopen::FusionMDGraph::Init(mdg, miopen::miopenFusionOpConvForward);
         }
         else if(op == "BatchNormInference")
         {
-            miopen::FusionMDGraph::InitBN(mdg);
+            miopen::FusionMDGraph::Init(mdg, miopen::miopenFusionOpBatchNormInference);
         }
         else
         {
@@ -421,7 +421,7 @@ int CBAInferFusionDriver<Tgpu, Tref>::AddCmdLineArgs()
     inflags.AddInputFlag("dilation_h", 'l', "1", "Dilation of Filter Height (Default=1)", "int");
     inflags.AddInputFlag("dilation_w", 'j', "1", "Dilation of Filter Width (Default=1)", "int");
 
-    /*inflags.AddInputFlag("search", 's', "0", "Search Kernel Config (Default=0)", "int");*/
+    inflags.AddInputFlag("search", 's', "0", "Search Kernel Config (Default=0)", "int");
 
     inflags.AddInputFlag(
         "pad_mode", 'z', "conv", "Padding Mode (same, valid, default) (Default=default)", "str");
@@ -841,6 +841,8 @@ void CBAInferFusionDriver<Tgpu, Tref>::runGPUConvBatchNormActivInference()
                                           runningMean_dev->GetMem(),
                                           runningVariance_dev->GetMem(),
                                           epsilon);
+    if(inflags.GetValueInt("search") == 1)
+        miopenFusionPlanConvolutionSetExhaustiveSearch(fusePlanDesc, true);
     miopenError = miopenCompileFusionPlan(GetHandle(), fusePlanDesc);
     if(miopenError != miopenStatusSuccess)
     {
@@ -895,6 +897,8 @@ void CBAInferFusionDriver<Tgpu, Tref>::runGPUConvActivInference()
         miopenSetOpArgsBiasForward(fusionArgs, biasOp, &alpha, &beta, b_dev->GetMem());
     }
 
+    if(inflags.GetValueInt("search") == 1)
+        miopenFusionPlanConvolutionSetExhaustiveSearch(fusePlanDesc, true);
     miopenError = miopenCompileFusionPlan(GetHandle(), fusePlanDesc);
     if(miopenError != miopenStatusSuccess)
     {
@@ -1011,6 +1015,8 @@ void CBAInferFusionDriver<Tgpu, Tref>::runGPUFusedConvBiasInference()
     miopenCreateOpBiasForward(fusePlanDesc, &biasOp, biasTensor);
     miopenSetOpArgsConvForward(fusionArgs, convoOp, &alpha, &beta, wei_dev->GetMem());
     miopenSetOpArgsBiasForward(fusionArgs, biasOp, &alpha, &beta, b_dev->GetMem());
+    if(inflags.GetValueInt("search") == 1)
+        miopenFusionPlanConvolutionSetExhaustiveSearch(fusePlanDesc, true);
     miopenError = miopenCompileFusionPlan(GetHandle(), fusePlanDesc);
     if(miopenError != miopenStatusSuccess)
     {
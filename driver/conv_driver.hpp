@@ -51,6 +51,7 @@
 #include <miopen/miopen_internal.h>
 #include <miopen/tensor.hpp>
 #include <miopen/env.hpp>
+#include <miopen/float_convert.hpp>
 #include <miopen/algorithm.hpp>
 #include <miopen/conv_algo_name.hpp>
 #include <miopen/logger.hpp>
@@ -2067,10 +2068,7 @@ int ConvDriver<Tgpu, Tref>::RunForwardGPUReference()
         auto out_tmp = tensor<Tgpu>(miopen::deref(outputTensor).GetLengths(),
                                     miopen::deref(outputTensor).GetStrides());
         out_dev->FromGPU(GetStream(), out_tmp.data.data());
-        for(int i = 0; i < out_tmp.data.size(); i++)
-        {
-            outhost.data[i] = static_cast<Tref>(out_tmp.data[i]);
-        }
+        miopen::convert_n(out_tmp.data.data(), out_tmp.data.size(), outhost.data.data());
     }
 
     if(inflags.GetValueInt("dump_output"))
@@ -2984,10 +2982,7 @@ int ConvDriver<Tgpu, Tref>::RunBackwardWeightsGPUReference()
         auto dwei_tmp = tensor<Tgpu>(miopen::deref(weightTensor).GetLengths(),
                                      miopen::deref(weightTensor).GetStrides());
         dwei_dev->FromGPU(GetStream(), dwei_tmp.data.data());
-        for(int i = 0; i < dwei_tmp.data.size(); i++)
-        {
-            dwei_host.data[i] = static_cast<Tref>(dwei_tmp.data[i]);
-        }
+        miopen::convert_n(dwei_tmp.data.data(), dwei_tmp.data.size(), dwei_host.data.data());
     }
 
     if(inflags.GetValueInt("dump_output"))
@@ -3033,10 +3028,7 @@ int ConvDriver<Tgpu, Tref>::RunBackwardDataGPUReference()
         auto din_tmp = tensor<Tgpu>(miopen::deref(inputTensor).GetLengths(),
                                     miopen::deref(inputTensor).GetStrides());
         din_dev->FromGPU(GetStream(), din_tmp.data.data());
-        for(int i = 0; i < din_tmp.data.size(); i++)
-        {
-            din_host.data[i] = static_cast<Tref>(din_tmp.data[i]);
-        }
+        miopen::convert_n(din_tmp.data.data(), din_tmp.data.size(), din_host.data.data());
     }
 
     if(inflags.GetValueInt("dump_output"))
@@ -38,296 +38,7 @@
 #include <vector>
 #include <array>
 #include "ctc_gpu_emulator.hpp"
-
-#define NEGATIVE_CUTOFF_VAL (-1e20)
-
-template <typename T>
-T logaddexp(T x, T y)
-{
-    T a = std::max(x, y);
-    T b = std::min(x, y);
-    T c = b - a;
-
-    return c <= T(NEGATIVE_CUTOFF_VAL)
-               ? std::max(a, T(NEGATIVE_CUTOFF_VAL))
-               : std::max(T(a + log(T(1) + exp(b - a))), T(NEGATIVE_CUTOFF_VAL));
-}
-
-template <typename T>
-T logsumexp(std::vector<T>& in_vec)
-{
-    auto sum = in_vec[0];
-    for(int i = 1; i < in_vec.size(); i++)
-        sum = logaddexp(*(in_vec.begin() + i), sum);
-
-    return sum;
-}
-
-template <typename Tgpu, typename Tref = Tgpu>
-void subvec_logsoftmax(std::vector<Tgpu>& in,
-                       std::vector<Tref>& out,
-                       size_t in_offset,
-                       size_t out_offset,
-                       size_t length)
-{
-    auto itr_in  = in.begin() + in_offset;
-    auto itr_out = out.begin() + out_offset;
-
-    std::vector<Tgpu> sub_in(itr_in, itr_in + length);
-    Tgpu max_val = *std::max_element(sub_in.begin(), sub_in.end());
-    for(int i = 0; i < length; i++)
-        sub_in[i] -= max_val;
-
-    Tgpu sum = logsumexp(sub_in);
-    for(int i = 0; i < length; i++)
-        *(itr_out + i) = std::max(Tref(sub_in[i] - sum), Tref(NEGATIVE_CUTOFF_VAL));
-}
-
-template <typename T>
-std::vector<T> ctc_forward_log(std::vector<T>& probs_logits,
-                               std::vector<int>& label,
-                               const int input_length,
-                               const int batch_size,
-                               const int class_sz,
-                               const int pstr0,
-                               const int pstr1,
-                               const int pstr2,
-                               const int batch_id,
-                               int blank_lb = 0)
-{
-    (void)batch_size;
-    int probs_stride[]  = {pstr0, pstr1, pstr2};
-    int label_prime_len = 2 * label.size() + 1;
-    blank_lb            = blank_lb < 0 ? 0 : (blank_lb >= class_sz ? class_sz - 1 : blank_lb);
-    std::vector<int> label_prime(label_prime_len, blank_lb);
-    for(int i = 0; i < label.size(); i++)
-        label_prime[2 * i + 1] = label[i];
-
-    std::vector<T> alpha(input_length * label_prime_len, T(NEGATIVE_CUTOFF_VAL));
-
-    for(int j = 0; j < input_length; j++)
-        for(int i = 0; i < label_prime_len; i++)
-        {
-            size_t pidx    = j * probs_stride[0] + batch_id * probs_stride[1] + label_prime[i];
-            size_t aidx_ts = j * label_prime_len + i;
-            if(j == 0 && i > 1)
-                break;
-            else if(j == 0)
-            {
-                alpha[aidx_ts] = probs_logits[pidx];
-                continue;
-            }
-            size_t aidx_t1s = (j - 1) * label_prime_len + i;
-            alpha[aidx_ts]  = alpha[aidx_t1s];
-            if(i >= 1)
-                alpha[aidx_ts] = logaddexp(alpha[aidx_ts], alpha[aidx_t1s - 1]);
-            if(i >= 2)
-                if(label_prime[i] != blank_lb && label_prime[i] != label_prime[i - 2])
-                    alpha[aidx_ts] = logaddexp(alpha[aidx_ts], alpha[aidx_t1s - 2]);
-
-            alpha[aidx_ts] += probs_logits[pidx];
-            alpha[aidx_ts] = std::max(alpha[aidx_ts], T(NEGATIVE_CUTOFF_VAL));
-        }
-
-    return alpha;
-}
-
-template <typename T>
-std::vector<T> ctc_backward_log(std::vector<T>& probs_logits,
-                                std::vector<int>& label,
-                                const int input_length,
-                                const int batch_size,
-                                const int class_sz,
-                                const int pstr0,
-                                const int pstr1,
-                                const int pstr2,
-                                const int batch_id,
-                                int blank_lb = 0)
-{
-    (void)batch_size;
-    int probs_stride[]  = {pstr0, pstr1, pstr2};
-    int label_prime_len = 2 * label.size() + 1;
-    blank_lb            = blank_lb < 0 ? 0 : (blank_lb >= class_sz ? class_sz - 1 : blank_lb);
-    std::vector<int> label_prime(label_prime_len, blank_lb);
-    for(int i = 0; i < label.size(); i++)
-        label_prime[2 * i + 1] = label[i];
-
-    std::vector<T> beta(input_length * label_prime_len, T(NEGATIVE_CUTOFF_VAL));
-
-    for(int j = 0; j < input_length; j++)
-        for(int i = 0; i < label_prime_len; i++)
-        {
-            int j1         = input_length - 1 - j;
-            int i1         = label_prime_len - 1 - i;
-            size_t pidx    = j1 * probs_stride[0] + batch_id * probs_stride[1] + label_prime[i1];
-            size_t bidx_ts = j1 * label_prime_len + i1;
-            if(j == 0 && i > 1)
-                break;
-            else if(j == 0)
-            {
-                beta[bidx_ts] = probs_logits[pidx];
-                continue;
-            }
-            size_t bidx_t1s = (j1 + 1) * label_prime_len + i1;
-
-            beta[bidx_ts] = beta[bidx_t1s];
-            if(i1 <= label_prime_len - 2)
-                beta[bidx_ts] = logaddexp(beta[bidx_ts], beta[bidx_t1s + 1]);
-            if(i1 <= label_prime_len - 3)
-                if(label_prime[i1] != blank_lb && label_prime[i1] != label_prime[i1 + 2])
-                    beta[bidx_ts] = logaddexp(beta[bidx_ts], beta[bidx_t1s + 2]);
-
-            beta[bidx_ts] += probs_logits[pidx];
-            beta[bidx_ts] = std::max(beta[bidx_ts], T(NEGATIVE_CUTOFF_VAL));
-        }
-
-    return beta;
-}
-
-template <typename T>
-void ctc_gradient_log(std::vector<int>& label,
-                      const int input_length,
-                      const int max_time_step,
-                      const int batch_size,
-                      const int class_sz,
-                      const int pstr0,
-                      const int pstr1,
-                      const int pstr2,
-                      const int gstr0,
-                      const int gstr1,
-                      const int gstr2,
-                      const int batch_id,
-                      std::vector<T>& probs_logits,
-                      std::vector<T>& gradients_logits,
-                      int blank_lb = 0)
-{
-    int probs_stride[]  = {pstr0, pstr1, pstr2};
-    int grads_stride[]  = {gstr0, gstr1, gstr2};
-    int label_prime_len = 2 * label.size() + 1;
-    blank_lb            = blank_lb < 0 ? 0 : (blank_lb >= class_sz ? class_sz - 1 : blank_lb);
-    std::vector<int> label_prime(label_prime_len, blank_lb);
-    for(int i = 0; i < label.size(); i++)
-        label_prime[2 * i + 1] = label[i];
-
-    std::vector<T> alpha_log = ctc_forward_log(probs_logits,
-                                               label,
-                                               input_length,
-                                               batch_size,
-                                               class_sz,
-                                               pstr0,
-                                               pstr1,
-                                               pstr2,
-                                               batch_id,
-                                               blank_lb);
-    std::vector<T> beta_log  = ctc_backward_log(probs_logits,
-                                               label,
-                                               input_length,
-                                               batch_size,
-                                               class_sz,
-                                               pstr0,
-                                               pstr1,
-                                               pstr2,
-                                               batch_id,
-                                               blank_lb);
-
-    float prob_lx_log = logaddexp(alpha_log[alpha_log.size() - 1], alpha_log[alpha_log.size() - 2]);
-
-    for(int j = 0; j < input_length; j++)
-        for(int i = 0; i < class_sz; i++)
-        {
-            size_t pidx            = j * probs_stride[0] + batch_id * probs_stride[1] + i;
-            size_t gidx            = j * grads_stride[0] + batch_id * grads_stride[1] + i;
-            gradients_logits[gidx] = T(NEGATIVE_CUTOFF_VAL);
-
-            for(int k = 0; k < label_prime_len; k++)
-                if(label_prime[k] == i)
-                {
-                    size_t kidx = j * label_prime_len + k;
-                    gradients_logits[gidx] =
-                        logaddexp(gradients_logits[gidx], alpha_log[kidx] + beta_log[kidx]);
-                }
-            gradients_logits[gidx] -= (2 * probs_logits[pidx]);
-            gradients_logits[gidx] -= prob_lx_log;
-            gradients_logits[gidx] = std::max(gradients_logits[gidx], T(NEGATIVE_CUTOFF_VAL));
-            gradients_logits[gidx] = -exp(gradients_logits[gidx]);
-        }
-
-    for(int j = input_length; j < max_time_step; j++)
-        for(int i = 0; i < class_sz; i++)
-        {
-            size_t gidx            = j * grads_stride[0] + batch_id * grads_stride[1] + i;
-            gradients_logits[gidx] = 0;
-        }
-}
-
-template <typename T>
-void ctc_softmaxlayer_gradient_log(std::vector<int>& label,
-                                   const int input_length,
-                                   const int batch_size,
-                                   const int class_sz,
-                                   const int pstr0,
-                                   const int pstr1,
-                                   const int pstr2,
-                                   const int gstr0,
-                                   const int gstr1,
-                                   const int gstr2,
-                                   const int batch_id,
-                                   std::vector<T>& probs_logits,
-                                   std::vector<T>& gradients_logits,
-                                   int blank_lb = 0)
-{
-    int probs_stride[]  = {pstr0, pstr1, pstr2};
-    int grads_stride[]  = {gstr0, gstr1, gstr2};
-    int label_prime_len = 2 * label.size() + 1;
-    blank_lb            = blank_lb < 0 ? 0 : (blank_lb >= class_sz ? class_sz - 1 : blank_lb);
-    std::vector<int> label_prime(label_prime_len, blank_lb);
-    for(int i = 0; i < label.size(); i++)
-        label_prime[2 * i + 1] = label[i];
-
-    std::vector<T> alpha_log = ctc_forward_log(probs_logits,
-                                               label,
-                                               input_length,
-                                               batch_size,
-                                               class_sz,
-                                               pstr0,
-                                               pstr1,
-                                               pstr2,
-                                               batch_id,
-                                               blank_lb);
-    std::vector<T> beta_log  = ctc_backward_log(probs_logits,
-                                               label,
-                                               input_length,
-                                               batch_size,
-                                               class_sz,
-                                               pstr0,
-                                               pstr1,
-                                               pstr2,
-                                               batch_id,
-                                               blank_lb);
-
-    float prob_lx_log = logaddexp(alpha_log[alpha_log.size() - 1], alpha_log[alpha_log.size() - 2]);
-
-    for(int j = 0; j < input_length; j++)
-        for(int i = 0; i < class_sz; i++)
-        {
-            size_t pidx            = j * probs_stride[0] + batch_id * probs_stride[1] + i;
-            size_t gidx            = j * grads_stride[0] + batch_id * grads_stride[1] + i;
-            gradients_logits[gidx] = T(NEGATIVE_CUTOFF_VAL);
-
-            for(int k = 0; k < label_prime_len; k++)
-                if(label_prime[k] == i)
-                {
-                    size_t kidx = j * label_prime_len + k;
-                    gradients_logits[gidx] =
-                        logaddexp(gradients_logits[gidx], alpha_log[kidx] + beta_log[kidx]);
-                }
-            gradients_logits[gidx] -= probs_logits[pidx];
-            gradients_logits[gidx] -= prob_lx_log;
-            gradients_logits[gidx] = std::max(gradients_logits[gidx], T(NEGATIVE_CUTOFF_VAL));
-
-            gradients_logits[gidx] = exp(probs_logits[pidx]) - exp(gradients_logits[gidx]);
-        }
-}
+#include <../test/cpu_ctc.hpp>
 
 template <typename Tgpu, typename Tref = Tgpu>
 void RunCTCLossCPUVerify(const int num_class,
@@ -374,9 +85,9 @@ void RunCTCLossCPUVerify(const int num_class,
         return;
     }
 
-    std::vector<Tref> beta_loss(batch_size, 0);
     if(verify_path == 1)
     {
+        std::vector<Tref> beta_loss(batch_size, 0);
         std::vector<int> probsDesc     = {max_time_step,
                                       batch_size,
                                       class_sz,
@@ -405,89 +116,21 @@ void RunCTCLossCPUVerify(const int num_class,
     }
     else
     {
-        std::vector<Tref> probs_logits(probs.size(), Tref(NEGATIVE_CUTOFF_VAL));
-        std::vector<Tref> gradients_logits(probs.size(), Tref(NEGATIVE_CUTOFF_VAL));
-        std::vector<Tref> softmaxlayer_gradients_logit(probs.size(), 0);
-
-        for(int j = 0; j < max_time_step * batch_size; j++)
-            subvec_logsoftmax(probs, probs_logits, j * class_sz, j * class_sz, class_sz);
-
-        auto probs_logits_use = is_softmax_applied ? probs_logits : probs;
-
-        std::vector<int> label_offsets(batch_size, 0);
-        for(int j = 1; j < batch_size; j++)
-            label_offsets[j] = label_offsets[j - 1] + labelLengths[j - 1];
-
-        for(int j = 0; j < batch_size; j++)
-        {
-            auto lab_begin = labels.begin() + label_offsets[j];
-            std::vector<int> indiv_lab(lab_begin, lab_begin + labelLengths[j]);
-
-            std::vector<Tref> alpha_log = ctc_forward_log(probs_logits_use,
-                                                          indiv_lab,
-                                                          inputLengths[j],
-                                                          batch_size,
-                                                          class_sz,
-                                                          int(probsStride[0]),
-                                                          int(probsStride[1]),
-                                                          int(probsStride[2]),
-                                                          j,
-                                                          blank_lb);
-
-            float losses_log =
-                -logaddexp(alpha_log[alpha_log.size() - 1], alpha_log[alpha_log.size() - 2]);
-            losses_host[j] = losses_log;
-
-            std::vector<Tref> beta_log = ctc_backward_log(probs_logits_use,
-                                                          indiv_lab,
-                                                          inputLengths[j],
-                                                          batch_size,
-                                                          class_sz,
-                                                          int(probsStride[0]),
-                                                          int(probsStride[1]),
-                                                          int(probsStride[2]),
-                                                          j,
-                                                          blank_lb);
-
-            beta_loss[j] = logaddexp(beta_log[0], beta_log[1]);
-
-            if(is_softmax_applied)
-                ctc_softmaxlayer_gradient_log(indiv_lab,
-                                              inputLengths[j],
-                                              batch_size,
-                                              class_sz,
-                                              int(probsStride[0]),
-                                              int(probsStride[1]),
-                                              int(probsStride[2]),
-                                              int(gradientsStride[0]),
-                                              int(gradientsStride[1]),
-                                              int(gradientsStride[2]),
-                                              j,
-                                              probs_logits_use,
-                                              softmaxlayer_gradients_logit,
-                                              blank_lb);
-            else
-                ctc_gradient_log(indiv_lab,
-                                 inputLengths[j],
-                                 max_time_step,
-                                 batch_size,
-                                 class_sz,
-                                 int(probsStride[0]),
-                                 int(probsStride[1]),
-                                 int(probsStride[2]),
-                                 int(gradientsStride[0]),
-                                 int(gradientsStride[1]),
-                                 int(gradientsStride[2]),
-                                 j,
-                                 probs_logits_use,
-                                 gradients_logits,
-                                 blank_lb);
-        }
-
-        gradients_host = is_softmax_applied ? softmaxlayer_gradients_logit : gradients_logits;
+        ctc_cpu_problem problem;
+        problem.max_time_step = max_time_step;
+        problem.batch_size    = batch_size;
+        problem.class_sz      = class_sz;
+        problem.probs_strides = {probsStride[0], probsStride[1], probsStride[2]};
+        problem.grads_strides = {gradientsStride[0], gradientsStride[1], gradientsStride[2]};
+        problem.labels        = labels.data();
+        problem.label_lengths = labelLengths.data();
+        problem.input_lengths = inputLengths.data();
+        problem.blank_lb      = blank_lb;
+        problem.apply_softmax = is_softmax_applied;
+
+        ctc_cpu_workspace workspace;
+        ctc_cpu_loss(problem, probs.data(), losses_host.data(), gradients_host.data(), workspace);
 
-        (void)probsStride;
-        (void)gradientsStride;
         (void)workspace_host;
     }
 }
@@ -147,11 +147,11 @@ void InitKernelStateEmulator(std::vector<prngStates>& states,
     }
 }
 
-template <typename T>
-inline void ExpandTensorDim(std::vector<T> x_len,
-                            std::vector<T> x_str,
-                            std::vector<T> y_len,
-                            std::vector<T> y_str,
+template <typename TDims, typename T>
+inline void ExpandTensorDim(const TDims& x_len,
+                            const TDims& x_str,
+                            const TDims& y_len,
+                            const TDims& y_str,
                             std::vector<T>& in_len,
                             std::vector<T>& in_str,
                             std::vector<T>& out_len,
@@ -350,4 +350,88 @@ void RunDropoutBackwardEmulator(const miopenDropoutDescriptor_t dropoutDesc,
                     }
 }
 
+/// Dropout between stacked layers for the RNN host references (see test/cpu_rnn.hpp). The
+/// handle is only needed by forward().
+struct RNNDropoutEmulator
+{
+    miopenHandle_t handle;
+    miopenDropoutDescriptor_t dropoutDesc;
+    std::vector<prngStates> states{};
+
+    template <typename T>
+    void forward(int rows,
+                 int cols,
+                 std::vector<T>& x,
+                 size_t x_offset,
+                 int x_stride,
+                 std::vector<T>& y,
+                 size_t y_offset,
+                 int y_stride,
+                 std::vector<unsigned char>& mask,
+                 size_t mask_offset)
+    {
+        if(states.empty())
+        {
+            size_t statesSizeInBytes = 0;
+            miopenDropoutGetStatesSize(handle, &statesSizeInBytes);
+            states = std::vector<prngStates>(statesSizeInBytes / sizeof(prngStates));
+            InitKernelStateEmulator(states, dropoutDesc);
+        }
+
+        std::array<int, 2> lens      = {{rows, cols}};
+        std::array<int, 2> x_strides = {{x_stride, 1}};
+        std::array<int, 2> y_strides = {{y_stride, 1}};
+        miopenTensorDescriptor_t xDesc{}, yDesc{};
+        miopenCreateTensorDescriptor(&xDesc);
+        miopenCreateTensorDescriptor(&yDesc);
+        miopenSetTensorDescriptor(xDesc, miopenFloat, 2, lens.data(), x_strides.data());
+        miopenSetTensorDescriptor(yDesc, miopenFloat, 2, lens.data(), y_strides.data());
+
+        auto layer_states = states;
+        RunDropoutForwardEmulator<T>(handle,
+                                     dropoutDesc,
+                                     xDesc,
+                                     xDesc,
+                                     x,
+                                     yDesc,
+                                     y,
+                                     mask,
+                                     layer_states,
+                                     x_offset,
+                                     y_offset,
+                                     mask_offset);
+
+        miopenDestroyTensorDescriptor(xDesc);
+        miopenDestroyTensorDescriptor(yDesc);
+    }
+
+    template <typename T>
+    void backward(int rows,
+                  int cols,
+                  std::vector<T>& dy,
+                  size_t dy_offset,
+                  int dy_stride,
+                  std::vector<T>& dx,
+                  size_t dx_offset,
+                  int dx_stride,
+                  std::vector<unsigned char>& mask,
+                  size_t mask_offset)
+    {
+        std::array<int, 2> lens       = {{rows, cols}};
+        std::array<int, 2> dy_strides = {{dy_stride, 1}};
+        std::array<int, 2> dx_strides = {{dx_stride, 1}};
+        miopenTensorDescriptor_t dyDesc{}, dxDesc{};
+        miopenCreateTensorDescriptor(&dyDesc);
+        miopenCreateTensorDescriptor(&dxDesc);
+        miopenSetTensorDescriptor(dyDesc, miopenFloat, 2, lens.data(), dy_strides.data());
+        miopenSetTensorDescriptor(dxDesc, miopenFloat, 2, lens.data(), dx_strides.data());
+
+        RunDropoutBackwardEmulator<T>(
+            dropoutDesc, dyDesc, dy, dxDesc, dx, mask, dx_offset, dy_offset, mask_offset);
+
+        miopenDestroyTensorDescriptor(dyDesc);
+        miopenDestroyTensorDescriptor(dxDesc);
+    }
+};
+
 #endif // GUARD_MIOPEN_DROPOUT_GPU_EMULATOR_HPP
@@ -377,4 +377,156 @@ class miopenReductionHost
     }; // end of RunImpl_no_indices()
 };
 
+// Host reference of miopenReduceTensorMulti: all reductions are computed together in one pass
+// over the input, as the fused kernels do. The accumulation is done in float (double for double
+// references) for every reduction, independent of the compute type of its descriptor.
+template <typename Tgpu, typename Tref>
+class miopenMultiReductionHost
+{
+    public:
+    miopenMultiReductionHost(const std::vector<miopenReduceTensorDescriptor_t>& reduceDescs,
+                             miopenTensorDescriptor_t inDesc,
+                             miopenTensorDescriptor_t outDesc,
+                             const std::vector<int>& invariantDims_,
+                             const std::vector<int>& toReduceDims_)
+    {
+        for(const auto& reduceDesc : reduceDescs)
+        {
+            miopenReduceTensorOp_t reduceOp;
+            miopenDataType_t compType;
+            miopenNanPropagation_t nanOpt;
+            miopenReduceTensorIndices_t indicesOpt;
+            miopenIndicesType_t indicesType;
+
+            miopenGetReduceTensorDescriptor(
+                reduceDesc, &reduceOp, &compType, &nanOpt, &indicesOpt, &indicesType);
+
+            this->reduceOps.push_back(reduceOp);
+            this->nanOpts.push_back(nanOpt);
+        }
+
+        this->inStrides  = GetTensorStrides(inDesc);
+        this->outStrides = GetTensorStrides(outDesc);
+
+        this->invariantDims = invariantDims_;
+        this->toReduceDims  = toReduceDims_;
+
+        const auto inLengths = GetTensorLengths(inDesc);
+
+        assert(!this->toReduceDims.empty());
+
+        for(const auto dim : this->invariantDims)
+            this->invariantLengths.push_back(inLengths[dim]);
+
+        for(const auto dim : this->toReduceDims)
+            this->toReduceLengths.push_back(inLengths[dim]);
+    };
+
+    void Run(float alpha, const Tgpu* in_data, float beta, const std::vector<Tref*>& out_data)
+    {
+        using compType =
+            typename std::conditional<std::is_same<Tref, double>::value, double, float>::type;
+
+        using reduce::binop_with_nan_check;
+        using reduce::convert_type;
+        using reduce::float_equal_one;
+        using reduce::float_equal_zero;
+        using reduce::PosUnaryOpFn;
+        using reduce::PreUnaryOpFn;
+        using reduce::ReduceOpFn;
+        using reduce::ReduceOpZeroVal;
+
+        assert(out_data.size() == reduceOps.size());
+
+        const auto numOps = reduceOps.size();
+
+        int divider = 1;
+        for(int i = 0; i < toReduceLengths.size(); i++)
+            divider *= toReduceLengths[i];
+
+        std::vector<std::function<void(compType&, compType)>> opReduce;
+        std::vector<std::function<void(compType&)>> PreUnaryOp;
+        std::vector<std::function<void(compType&)>> PosUnaryOp;
+        for(const auto reduceOp : reduceOps)
+        {
+            opReduce.push_back(ReduceOpFn<compType>(reduceOp));
+            PreUnaryOp.push_back(PreUnaryOpFn<compType>(reduceOp, divider));
+            PosUnaryOp.push_back(PosUnaryOpFn<compType>(reduceOp, divider));
+        }
+
+        std::vector<std::vector<int>> indexes_1, indexes_2;
+
+        // with all dimensions reduced there is a single invariant index
+        if(invariantDims.empty())
+            indexes_1.emplace_back();
+        else
+            get_all_indexes(invariantLengths, 0, indexes_1);
+        get_all_indexes(toReduceLengths, 0, indexes_2);
+
+        std::vector<int> src_index(inStrides.size(), 0);
+        std::vector<int> dst_index(inStrides.size(), 0);
+        std::vector<compType> accuVals(numOps);
+
+        for(const auto& index_1 : indexes_1)
+        {
+            for(int k = 0; k < invariantDims.size(); k++)
+            {
+                src_index[invariantDims[k]] = index_1[k];
+                dst_index[invariantDims[k]] = index_1[k];
+            }
+
+            const int dst_offset = get_offset_from_index(outStrides, dst_index);
+
+            for(std::size_t op = 0; op < numOps; op++)
+                accuVals[op] = ReduceOpZeroVal<compType>(reduceOps[op]);
+
+            // every input value is read once and folded into all of the reductions
+            for(const auto& index_2 : indexes_2)
+            {
+                for(int k = 0; k < toReduceDims.size(); k++)
+                    src_index[toReduceDims[k]] = index_2[k];
+
+                const auto src_offset = get_offset_from_index(inStrides, src_index);
+                const auto inVal      = convert_type<compType>(in_data[src_offset]);
+
+                for(std::size_t op = 0; op < numOps; op++)
+                {
+                    auto currVal = inVal;
+                    PreUnaryOp[op](currVal);
+                    binop_with_nan_check(nanOpts[op], opReduce[op], accuVals[op], currVal);
+                }
+            };
+
+            for(std::size_t op = 0; op < numOps; op++)
+            {
+                auto accuVal = accuVals[op];
+
+                PosUnaryOp[op](accuVal);
+
+                if(!float_equal_one(alpha))
+                    accuVal *= convert_type<compType>(alpha);
+
+                if(!float_equal_zero(beta))
+                    accuVal += convert_type<compType>(out_data[op][dst_offset]) *
+                               convert_type<compType>(beta);
+
+                out_data[op][dst_offset] = convert_type<Tref>(accuVal);
+            }
+        };
+    };
+
+    private:
+    std::vector<miopenReduceTensorOp_t> reduceOps;
+    std::vector<miopenNanPropagation_t> nanOpts;
+
+    std::vector<int> inStrides;
+    std::vector<int> outStrides;
+
+    std::vector<int> invariantLengths;
+    std::vector<int> toReduceLengths;
+
+    std::vector<int> invariantDims;
+    std::vector<int> toReduceDims;
+};
+
 #endif
@@ -30,6 +30,8 @@
 #include <cmath>
 #include <iomanip>
 
+#include <../test/cpu_lrn.hpp>
+
 ////////////////////////////////////////////////////////////
 //
 ///////////////////////////////////////////////////////////
@@ -39,6 +41,29 @@
 #define MLO_LRN_ACROSS_CHANNELS 1
 #endif
 
+// The "pad" of the driver is the number of elements after the centre of the window; the
+// remaining local_area - 1 - pad elements precede it.
+inline lrn_cpu_problem mloLRNHostProblem(int norm_region,
+                                         int pad,
+                                         int local_area,
+                                         double K,
+                                         double beta,
+                                         int n_batchs,
+                                         int n_inputs,
+                                         int height,
+                                         int width)
+{
+    lrn_cpu_problem problem;
+    problem.mode  = norm_region == MLO_LRN_ACROSS_CHANNELS ? miopenLRNCrossChannel
+                                                           : miopenLRNWithinChannel;
+    problem.lens  = {{size_t(n_batchs), size_t(n_inputs), size_t(height), size_t(width)}};
+    problem.lower = local_area - 1 - pad;
+    problem.upper = pad;
+    problem.k     = K;
+    problem.beta  = beta;
+    return problem;
+}
+
 template <typename _Tgpu /* the data type used in GPU computations (usually half) */,
           typename _Tcheck /* the data type used in CPU checkings (usually double) */>
 int mloLRNForwardRunHost(bool do_scale,
@@ -50,7 +75,7 @@ int mloLRNForwardRunHost(bool do_scale,
                          _Tcheck beta,
                          _Tcheck K,
                          int n_batchs,
-                         int n_outputs,
+                         int /*n_outputs*/,
                          int n_inputs,
                          int bot_height,
                          int bot_width,
@@ -69,198 +94,55 @@ int mloLRNForwardRunHost(bool do_scale,
                          _Tcheck* scale_v_ptr,
                          _Tcheck* top_v_ptr)
 {
-
-    int ret = 0;
     if(local_area < 1 + pad)
     {
         std::cout << "ERROR: Lrn kernel size is insufficient." << std::endl;
         return -1;
     }
 
+    const auto problem = mloLRNHostProblem(
+        norm_region, pad, local_area, K, beta, n_batchs, n_inputs, bot_height, bot_width);
+    const lrn_cpu_dims bot_strides{
+        {size_t(bot_batch_stride), size_t(bot_channel_stride), size_t(bot_stride), 1}};
+    const lrn_cpu_dims top_strides{
+        {size_t(top_v_batch_stride), size_t(top_v_channel_stride), size_t(top_v_stride), 1}};
+    const lrn_cpu_dims scale_strides{
+        {size_t(scale_v_batch_stride), size_t(scale_v_channel_stride), size_t(scale_v_stride), 1}};
+    _Tcheck* scale_out = do_scale ? scale_v_ptr : nullptr;
+
     if(norm_region == MLO_LRN_ACROSS_CHANNELS)
     {
-        for(int b = 0; b < n_batchs; b++)
-        {
-            for(int j = 0; j < top_height; j++)
-            {
-                for(int i = 0; i < top_width; i++)
-                {
-                    // c-emulator
-                    _Tcheck accum_scale = _Tcheck{0};
-                    int head            = 0;
-                    _Tcheck bot_val;
-                    while(head < pad)
-                    {
-                        bot_val = (head < n_inputs)
-                                      ? static_cast<_Tcheck>(
-                                            bot_ptr[b * bot_batch_stride +
-                                                    head * bot_channel_stride + j * bot_stride + i])
-                                      : static_cast<_Tcheck>(0);
-                        accum_scale += bot_val * bot_val;
-                        ++head;
-                    }
-                    // until we reach size, nothing needs to be subtracted
-                    while(head < local_area)
-                    {
-                        bot_val = (head < n_inputs)
-                                      ? static_cast<_Tcheck>(
-                                            bot_ptr[b * bot_batch_stride +
-                                                    head * bot_channel_stride + j * bot_stride + i])
-                                      : static_cast<_Tcheck>(0);
-                        accum_scale += bot_val * bot_val;
-                        _Tcheck scale = K + accum_scale * alphaoverarea;
-                        if((head - pad) >= 0 && (head - pad) < n_outputs && do_scale)
-                        {
-                            scale_v_ptr[b * scale_v_batch_stride +
-                                        (head - pad) * scale_v_channel_stride + j * scale_v_stride +
-                                        i] = scale;
-                        }
-                        bot_val =
-                            ((head - pad) >= 0 && (head - pad) < n_inputs)
-                                ? static_cast<_Tcheck>(bot_ptr[b * bot_batch_stride +
-                                                               (head - pad) * bot_channel_stride +
-                                                               j * bot_stride + i])
-                                : static_cast<_Tcheck>(0);
-                        _Tcheck s     = pow(scale, -beta);
-                        _Tcheck c_val = bot_val * s;
-                        if((head - pad) >= 0 && (head - pad) < n_outputs)
-                        {
-                            top_v_ptr[b * top_v_batch_stride + (head - pad) * top_v_channel_stride +
-                                      j * top_v_stride + i] = c_val;
-                        }
-                        ++head;
-                    }
-                    // both add and subtract
-                    while(head < n_inputs)
-                    {
-                        bot_val = static_cast<_Tcheck>(
-                            bot_ptr[b * bot_batch_stride + head * bot_channel_stride +
-                                    j * bot_stride + i]);
-                        accum_scale += bot_val * bot_val;
-                        bot_val = ((head - local_area) >= 0)
-                                      ? static_cast<_Tcheck>(
-                                            bot_ptr[b * bot_batch_stride +
-                                                    (head - local_area) * bot_channel_stride +
-                                                    j * bot_stride + i])
-                                      : static_cast<_Tcheck>(0);
-                        accum_scale -= bot_val * bot_val;
-                        _Tcheck scale = K + accum_scale * alphaoverarea;
-                        if((head - pad) >= 0 && do_scale)
-                        {
-                            scale_v_ptr[b * scale_v_batch_stride +
-                                        (head - pad) * scale_v_channel_stride + j * scale_v_stride +
-                                        i] = scale;
-                        }
-                        _Tcheck s = pow(scale, -beta);
-                        bot_val =
-                            ((head - pad) >= 0)
-                                ? static_cast<_Tcheck>(bot_ptr[b * bot_batch_stride +
-                                                               (head - pad) * bot_channel_stride +
-                                                               j * bot_stride + i])
-                                : static_cast<_Tcheck>(0);
-                        _Tcheck c_val = bot_val * s;
-                        if((head - pad) >= 0)
-                        {
-                            top_v_ptr[b * top_v_batch_stride + (head - pad) * top_v_channel_stride +
-                                      j * top_v_stride + i] = c_val;
-                        }
-                        ++head;
-                    }
-                    // subtract only
-                    while(head < n_inputs + pad)
-                    {
-                        bot_val = ((head - local_area) >= 0 && (head - local_area) < n_inputs)
-                                      ? static_cast<_Tcheck>(
-                                            bot_ptr[b * bot_batch_stride +
-                                                    (head - local_area) * bot_channel_stride +
-                                                    j * bot_stride + i])
-                                      : static_cast<_Tcheck>(0);
-                        accum_scale -= bot_val * bot_val;
-                        _Tcheck scale = K + accum_scale * alphaoverarea;
-                        if((head - pad) >= 0 && (head - pad) < n_outputs && do_scale)
-                        {
-                            scale_v_ptr[b * scale_v_batch_stride +
-                                        (head - pad) * scale_v_channel_stride + j * scale_v_stride +
-                                        i] = scale;
-                        }
-                        bot_val =
-                            ((head - pad) >= 0 && (head - pad) < n_inputs)
-                                ? static_cast<_Tcheck>(bot_ptr[b * bot_batch_stride +
-                                                               (head - pad) * bot_channel_stride +
-                                                               j * bot_stride + i])
-                                : static_cast<_Tcheck>(0);
-                        _Tcheck s     = pow(scale, -beta);
-                        _Tcheck c_val = bot_val * s;
-                        if((head - pad) >= 0 && (head - pad) < n_outputs)
-                        {
-                            top_v_ptr[b * top_v_batch_stride + (head - pad) * top_v_channel_stride +
-                                      j * top_v_stride + i] = c_val;
-                        }
-                        ++head;
-                    }
-
-                } // for (int i = 0; i < top_width; i++)
-            }     // for (int j = 0; j < top_height; j++)
-        }         // for (int b = 0; b < batch; b++)
+        lrn_cpu_forward(problem,
+                        bot_ptr,
+                        bot_strides,
+                        top_v_ptr,
+                        top_strides,
+                        scale_out,
+                        scale_strides,
+                        [&](size_t, size_t) { return alphaoverarea; });
     }
     else
     {
-        for(int b = 0; b < n_batchs; b++)
-        {
-            for(int o = 0; o < n_outputs; o++)
-            {
-                for(int j = 0; j < top_height; j++)
-                {
-                    for(int i = 0; i < top_width; i++)
-                    {
-                        // c-emulator
-                        _Tcheck scale     = static_cast<_Tcheck>(0);
-                        int hstart        = j - (local_area - 1 - pad);
-                        int wstart        = i - (local_area - 1 - pad);
-                        int hend          = std::min(hstart + local_area, bot_height + pad);
-                        int wend          = std::min(wstart + local_area, bot_width + pad);
-                        int adj_area_size = (hend - hstart) * (wend - wstart);
-                        hstart            = std::max(hstart, 0);
-                        wstart            = std::max(wstart, 0);
-                        hend              = std::min(hend, bot_height);
-                        wend              = std::min(wend, bot_width);
-                        _Tcheck accum     = static_cast<_Tcheck>(0);
-                        for(int h = hstart; h < hend; ++h)
-                        {
-                            for(int w = wstart; w < wend; ++w)
-                            {
-
-                                _Tcheck bot_val = static_cast<_Tcheck>(
-                                    bot_ptr[b * bot_batch_stride + o * bot_channel_stride +
-                                            h * bot_stride + w]);
-                                accum += bot_val * bot_val;
-                            }
-                        }
-
-                        alphaoverarea = alpha / adj_area_size;
-                        scale         = K + accum * alphaoverarea;
-                        if(do_scale)
-                        {
-                            scale_v_ptr[b * scale_v_batch_stride + o * scale_v_channel_stride +
-                                        j * scale_v_stride + i] = scale;
-                        }
-
-                        _Tcheck s       = pow(scale, -beta);
-                        _Tcheck bot_val = static_cast<_Tcheck>(
-                            bot_ptr[b * bot_batch_stride + o * bot_channel_stride + j * bot_stride +
-                                    i]);
-                        _Tcheck c_val = bot_val * s;
-
-                        top_v_ptr[b * top_v_batch_stride + o * top_v_channel_stride +
-                                  j * top_v_stride + i] = c_val;
-
-                    } // for (int i = 0; i < top_width; i++)
-                }     // for (int j = 0; j < top_height; j++)
-            }         // for (int o = 0; o < outputs; o++)
-        }             // for (int b = 0; b < batch; b++)
-    }                 // (norm_region == ACROSS_CHANNELS)
+        // The area counts the padding before the window but at most "pad" elements past the
+        // end of the image.
+        const int pre_pad = local_area - 1 - pad;
+        auto adj_size     = [&](size_t i, int len) {
+            const int start = static_cast<int>(i) - pre_pad;
+            return std::min(start + local_area, len + pad) - start;
+        };
+        lrn_cpu_forward(problem,
+                        bot_ptr,
+                        bot_strides,
+                        top_v_ptr,
+                        top_strides,
+                        scale_out,
+                        scale_strides,
+                        [&](size_t j, size_t i) {
+                            return alpha / (adj_size(j, top_height) * adj_size(i, top_width));
+                        });
+    }
 
-    return (ret);
+    return 0;
 }
 
 template <typename _Tgpu /* the data type used in GPU computations (usually half) */,
@@ -300,274 +182,69 @@ int mloLRNBackwardRunHost(int norm_region,
                           const _Tgpu* bot_ptr,
                           _Tcheck* bot_df_v_ptr)
 {
-
-    int ret               = 0;
-    _Tcheck negative_beta = -beta;
-    int pre_pad           = local_area - 1 - pad;
+    const int pre_pad = local_area - 1 - pad;
     if(pre_pad < 0)
     {
         std::cout << "ERROR: Lrn kernel size is insufficient." << std::endl;
         return -1;
     }
 
+    const auto problem = mloLRNHostProblem(
+        norm_region, pad, local_area, 0., beta, n_batchs, n_inputs, bot_height, bot_width);
+    const lrn_cpu_dims bot_strides{
+        {size_t(bot_batch_stride), size_t(bot_channel_stride), size_t(bot_stride), 1}};
+    const lrn_cpu_dims top_strides{
+        {size_t(top_batch_stride), size_t(top_channel_stride), size_t(top_stride), 1}};
+    const lrn_cpu_dims top_df_strides{
+        {size_t(top_df_batch_stride), size_t(top_df_channel_stride), size_t(top_df_stride), 1}};
+    const lrn_cpu_dims scale_strides{
+        {size_t(scale_batch_stride), size_t(scale_channel_stride), size_t(scale_stride), 1}};
+    const lrn_cpu_dims bot_df_strides{{size_t(bot_df_v_batch_stride),
+                                       size_t(bot_df_v_channel_stride),
+                                       size_t(bot_df_v_stride),
+                                       1}};
+
     if(norm_region == MLO_LRN_ACROSS_CHANNELS)
     {
-
-        _Tcheck ratio_dta_bwd =
+        const _Tcheck ratio_dta_bwd =
             static_cast<_Tcheck>(2.) * alpha * beta / static_cast<_Tcheck>(local_area);
-
-        for(int b = 0; b < n_batchs; b++)
-        {
-            for(int j = 0; j < bot_height; j++)
-            {
-                for(int i = 0; i < bot_width; i++)
-                {
-
-                    // c-emulator
-                    int head            = 0;
-                    _Tcheck accum_ratio = static_cast<_Tcheck>(0);
-
-                    // accumulate values
-                    while(head < pre_pad)
-                    {
-                        if(head < n_inputs)
-                        {
-                            _Tcheck adder =
-                                (static_cast<_Tcheck>(top_df_ptr[b * top_df_batch_stride +
-                                                                 head * top_df_channel_stride +
-                                                                 j * top_df_stride + i]) *
-                                 static_cast<_Tcheck>(
-                                     top_ptr[b * top_batch_stride + head * top_channel_stride +
-                                             j * top_stride + i])) /
-                                static_cast<_Tcheck>(
-                                    scale_ptr[b * scale_batch_stride + head * scale_channel_stride +
-                                              j * scale_stride + i]);
-
-                            accum_ratio += adder;
-                        }
-
-                        ++head;
-                    }
-
-                    // until we reach size, nothing needs to be subtracted
-                    while(head < local_area)
-                    {
-
-                        if(head < n_inputs)
-                        {
-                            _Tcheck adder =
-                                (static_cast<_Tcheck>(top_df_ptr[b * top_df_batch_stride +
-                                                                 head * top_df_channel_stride +
-                                                                 j * top_df_stride + i]) *
-                                 static_cast<_Tcheck>(
-                                     top_ptr[b * top_batch_stride + head * top_channel_stride +
-                                             j * top_stride + i])) /
-                                static_cast<_Tcheck>(
-                                    scale_ptr[b * scale_batch_stride + head * scale_channel_stride +
-                                              j * scale_stride + i]);
-
-                            accum_ratio += adder;
-                        }
-
-                        if(head - pre_pad >= 0 && head - pre_pad < n_inputs)
-                        {
-                            bot_df_v_ptr[b * bot_df_v_batch_stride +
-                                         (head - pre_pad) * bot_df_v_channel_stride +
-                                         j * bot_df_v_stride + i] =
-                                static_cast<_Tcheck>(
-                                    top_df_ptr[b * top_df_batch_stride +
-                                               (head - pre_pad) * top_df_channel_stride +
-                                               j * top_df_stride + i]) *
-                                    pow(static_cast<_Tcheck>(
-                                            scale_ptr[b * scale_batch_stride +
-                                                      (head - pre_pad) * scale_channel_stride +
-                                                      j * scale_stride + i]),
-                                        negative_beta) -
-                                ratio_dta_bwd *
-                                    static_cast<_Tcheck>(
-                                        bot_ptr[b * bot_batch_stride +
-                                                (head - pre_pad) * bot_channel_stride +
-                                                j * bot_stride + i]) *
-                                    accum_ratio;
-                        }
-                        ++head;
-                    }
-
-                    // both add and subtract
-                    while(head < n_inputs)
-                    {
-
-                        _Tcheck adder =
-                            static_cast<_Tcheck>(
-                                top_df_ptr[b * top_df_batch_stride + head * top_df_channel_stride +
-                                           j * top_df_stride + i]) *
-                            static_cast<_Tcheck>(
-                                top_ptr[b * top_batch_stride + head * top_channel_stride +
-                                        j * top_stride + i]) /
-                            static_cast<_Tcheck>(
-                                scale_ptr[b * scale_batch_stride + head * scale_channel_stride +
-                                          j * scale_stride + i]);
-
-                        accum_ratio += adder;
-
-                        if(head - local_area >= 0)
-                        {
-                            _Tcheck subs =
-                                (static_cast<_Tcheck>(
-                                     top_df_ptr[b * top_df_batch_stride +
-                                                (head - local_area) * top_df_channel_stride +
-                                                j * top_df_stride + i]) *
-                                 static_cast<_Tcheck>(
-                                     top_ptr[b * top_batch_stride +
-                                             (head - local_area) * top_channel_stride +
-                                             j * top_stride + i])) /
-                                static_cast<_Tcheck>(
-                                    scale_ptr[b * scale_batch_stride +
-                                              (head - local_area) * scale_channel_stride +
-                                              j * scale_stride + i]);
-
-                            accum_ratio -= subs;
-                        }
-                        if(head - pre_pad >= 0)
-                        {
-                            bot_df_v_ptr[b * bot_df_v_batch_stride +
-                                         (head - pre_pad) * bot_df_v_channel_stride +
-                                         j * bot_df_v_stride + i] =
-                                static_cast<_Tcheck>(
-                                    top_df_ptr[b * top_df_batch_stride +
-                                               (head - pre_pad) * top_df_channel_stride +
-                                               j * top_df_stride + i]) *
-                                    pow(static_cast<_Tcheck>(
-                                            scale_ptr[b * scale_batch_stride +
-                                                      (head - pre_pad) * scale_channel_stride +
-                                                      j * scale_stride + i]),
-                                        negative_beta) -
-                                ratio_dta_bwd *
-                                    static_cast<_Tcheck>(
-                                        bot_ptr[b * bot_batch_stride +
-                                                (head - pre_pad) * bot_channel_stride +
-                                                j * bot_stride + i]) *
-                                    accum_ratio;
-                        }
-
-                        ++head;
-                    }
-                    // subtract only
-                    while(head < n_inputs + pre_pad)
-                    {
-                        if(head - local_area >= 0 && head - local_area < n_inputs)
-                        {
-                            _Tcheck subs =
-                                (static_cast<_Tcheck>(
-                                     top_df_ptr[b * top_df_batch_stride +
-                                                (head - local_area) * top_df_channel_stride +
-                                                j * top_df_stride + i]) *
-                                 static_cast<_Tcheck>(
-                                     top_ptr[b * top_batch_stride +
-                                             (head - local_area) * top_channel_stride +
-                                             j * top_stride + i])) /
-                                static_cast<_Tcheck>(
-                                    scale_ptr[b * scale_batch_stride +
-                                              (head - local_area) * scale_channel_stride +
-                                              j * scale_stride + i]);
-
-                            accum_ratio -= subs;
-                        }
-                        if(head - pre_pad >= 0 && head - pre_pad < n_inputs)
-                        {
-                            bot_df_v_ptr[b * bot_df_v_batch_stride +
-                                         (head - pre_pad) * bot_df_v_channel_stride +
-                                         j * bot_df_v_stride + i] =
-                                static_cast<_Tcheck>(
-                                    top_df_ptr[b * top_df_batch_stride +
-                                               (head - pre_pad) * top_df_channel_stride +
-                                               j * top_df_stride + i]) *
-                                    pow(static_cast<_Tcheck>(
-                                            scale_ptr[b * scale_batch_stride +
-                                                      (head - pre_pad) * scale_channel_stride +
-                                                      j * scale_stride + i]),
-                                        negative_beta) -
-                                ratio_dta_bwd *
-                                    static_cast<_Tcheck>(
-                                        bot_ptr[b * bot_batch_stride +
-                                                (head - pre_pad) * bot_channel_stride +
-                                                j * bot_stride + i]) *
-                                    accum_ratio;
-                        }
-
-                        ++head;
-                    }
-
-                } // for (int i = 0; i < bot_width; i++)
-            }     // for (int j = 0; j < bot_height; j++)
-        }         // for (int b = 0; b < n_batchs; b++)
-    }             // if (norm_region == MLO_LRN_ACROSS_CHANNELS)
+        lrn_cpu_backward(problem,
+                         bot_ptr,
+                         bot_strides,
+                         top_ptr,
+                         top_strides,
+                         top_df_ptr,
+                         top_df_strides,
+                         scale_ptr,
+                         scale_strides,
+                         bot_df_v_ptr,
+                         bot_df_strides,
+                         [&](size_t, size_t) { return ratio_dta_bwd; });
+    }
     else
     {
-        for(int b = 0; b < n_batchs; b++)
-        {
-            for(int o = 0; o < n_inputs; o++)
-            {
-                for(int j = 0; j < bot_height; j++)
-                {
-
-                    for(int i = 0; i < bot_width; i++)
-                    {
-                        _Tcheck accum_ratio = static_cast<_Tcheck>(0);
-
-                        int hstart        = j - pad;
-                        int wstart        = i - pad;
-                        int hend          = std::min(hstart + local_area, top_height + pre_pad);
-                        int wend          = std::min(wstart + local_area, top_width + pre_pad);
-                        int adj_area_size = (hend - hstart) * (wend - wstart);
-                        hstart            = std::max(hstart, 0);
-                        wstart            = std::max(wstart, 0);
-                        hend              = std::min(hend, top_height);
-                        wend              = std::min(wend, top_width);
-                        for(int h = hstart; h < hend; ++h)
-                        {
-                            for(int w = wstart; w < wend; ++w)
-                            {
-                                _Tcheck adder =
-                                    static_cast<_Tcheck>(top_df_ptr[b * top_df_batch_stride +
-                                                                    o * top_df_channel_stride +
-                                                                    h * top_df_stride + w]) *
-                                    static_cast<_Tcheck>(
-                                        top_ptr[b * top_batch_stride + o * top_channel_stride +
-                                                h * top_stride + w]) /
-                                    static_cast<_Tcheck>(
-                                        scale_ptr[b * scale_batch_stride +
-                                                  o * scale_channel_stride + h * scale_stride + w]);
-
-                                accum_ratio += adder;
-                            }
-                        }
-
-                        _Tcheck ratio_dta_bwd = static_cast<_Tcheck>(2.) * alpha * beta /
-                                                static_cast<_Tcheck>(adj_area_size);
-
-                        bot_df_v_ptr[b * bot_df_v_batch_stride + o * bot_df_v_channel_stride +
-                                     j * bot_df_v_stride + i] =
-                            static_cast<_Tcheck>(
-                                top_df_ptr[b * top_df_batch_stride + o * top_df_channel_stride +
-                                           j * top_df_stride + i]) *
-                                pow(static_cast<_Tcheck>(
-                                        scale_ptr[b * scale_batch_stride +
-                                                  o * scale_channel_stride + j * scale_stride + i]),
-                                    negative_beta) -
-                            ratio_dta_bwd *
-                                static_cast<_Tcheck>(
-                                    bot_ptr[b * bot_batch_stride + o * bot_channel_stride +
-                                            j * bot_stride + i]) *
-                                accum_ratio;
-                    }
-                }
-            }
-        }
-
-    } // if (norm_region == MLO_LRN_ACROSS_CHANNELS)
+        auto adj_size = [&](size_t i, int len) {
+            const int start = static_cast<int>(i) - pad;
+            return std::min(start + local_area, len + pre_pad) - start;
+        };
+        lrn_cpu_backward(problem,
+                         bot_ptr,
+                         bot_strides,
+                         top_ptr,
+                         top_strides,
+                         top_df_ptr,
+                         top_df_strides,
+                         scale_ptr,
+                         scale_strides,
+                         bot_df_v_ptr,
+                         bot_df_strides,
+                         [&](size_t j, size_t i) {
+                             return static_cast<_Tcheck>(2.) * alpha * beta /
+                                    (adj_size(j, top_height) * adj_size(i, top_width));
+                         });
+    }
 
-    return (ret);
+    return 0;
 }
 
 #endif
@@ -37,6 +37,7 @@
 #include <iomanip>
 
 #include "calcerr.hpp"
+#include <../test/cpu_pooling.hpp>
 
 #if 0
 template<typename _T>
@@ -75,6 +76,17 @@ double CalcErr( _T c_val, _T g_val)
 #define MLO_POOLING_OP_AVE_INCLUSIVE 3
 #endif
 
+inline bool mloPoolingHostMode(int pooling_method, miopenPoolingMode_t& mode)
+{
+    switch(pooling_method)
+    {
+    case MLO_POOLING_OP_MAX: mode = miopenPoolingMax; return true;
+    case MLO_POOLING_OP_AVE: mode = miopenPoolingAverage; return true;
+    case MLO_POOLING_OP_AVE_INCLUSIVE: mode = miopenPoolingAverageInclusive; return true;
+    default: return false;
+    }
+}
+
 template <typename _Tgpu /* the data type used in GPU computations (usually half) */,
           typename _Tcheck /* the data type used in CPU checkings (usually double) */,
           typename Index>
@@ -112,14 +124,40 @@ bool mloPoolingForwardRunHostAndVerify(int pooling_method,
                                        _Tcheck allowedEps,
                                        int index_position = 1)
 {
+    pooling_cpu_problem problem;
+    if(!mloPoolingHostMode(pooling_method, problem.mode))
+    {
+        std::cout << "ERROR: unknown operator : layer: pooling." << std::endl;
+        return false;
+    }
+    problem.n         = n_batchs;
+    problem.c         = n_outputs;
+    problem.in_lens   = {{size_t(bot_depth), size_t(bot_height), size_t(bot_width)}};
+    problem.out_lens  = {{size_t(top_depth), size_t(top_height), size_t(top_width)}};
+    problem.kernel    = {{size_t(filter_size_d), size_t(filter_size_h), size_t(filter_size_w)}};
+    problem.stride    = {{size_t(pool_stride_d), size_t(pool_stride_h), size_t(pool_stride_w)}};
+    problem.pad       = {{size_t(pad_d), size_t(pad_h), size_t(pad_w)}};
+    problem.x_strides = {{size_t(bot_batch_stride),
+                          size_t(bot_channel_stride),
+                          size_t(bot_depth_stride),
+                          size_t(bot_stride),
+                          1}};
+    problem.y_strides = {{size_t(top_batch_stride),
+                          size_t(top_channel_stride),
+                          size_t(top_depth_stride),
+                          size_t(top_stride),
+                          1}};
+
+    const size_t top_sz = size_t(n_batchs) * top_batch_stride;
+    std::vector<_Tcheck> top_host(top_sz);
+    // The reference stores the per-plane position of each maximum in the mask buffer; it is
+    // turned into a global offset below, which is what mloPoolingBackwardRunHost expects.
+    pooling_cpu_forward(problem, bot_ptr, top_host.data(), mask_ptr);
 
     bool match = true;
-    _Tcheck MAX_VAL(3.402823466e+38);
     _Tgpu G_MAX_VAL = (sizeof(_Tgpu) == 4 || sizeof(_Tgpu) == 8)
                           ? static_cast<_Tgpu>(3.402823466e+38)
                           : static_cast<_Tgpu>(65504);
-    // c-emulator
-    _Tcheck res = static_cast<_Tcheck>(0);
 
     for(int b = 0; b < n_batchs && match; b++)
     {
@@ -131,92 +169,37 @@ bool mloPoolingForwardRunHostAndVerify(int pooling_method,
                 {
                     for(int i = 0; i < top_width && match; i++)
                     {
-                        // c-emulator
-                        if(pooling_method == MLO_POOLING_OP_MAX)
-                        {
-                            res = -MAX_VAL;
-                        }
-                        else if(pooling_method == MLO_POOLING_OP_AVE ||
-                                pooling_method == MLO_POOLING_OP_AVE_INCLUSIVE)
-                        {
-                            res = static_cast<_Tcheck>(0);
-                        }
-
-                        int dstart = k * pool_stride_d - pad_d;
-                        int hstart = j * pool_stride_h - pad_h;
-                        int wstart = i * pool_stride_w - pad_w;
-                        int dend   = std::min(dstart + filter_size_d, bot_depth);
-                        int hend   = std::min(hstart + filter_size_h, bot_height);
-                        int wend   = std::min(wstart + filter_size_w, bot_width);
-                        dstart     = std::max(dstart, 0);
-                        hstart     = std::max(hstart, 0);
-                        wstart     = std::max(wstart, 0);
+                        size_t top_index = b * top_batch_stride + o * top_channel_stride +
+                                           k * top_depth_stride + j * top_stride + i;
+                        _Tcheck c_val = top_host[top_index];
 
-                        int pool_size;
-                        if(pooling_method == MLO_POOLING_OP_AVE)
-                            pool_size = (dend - dstart) * (hend - hstart) * (wend - wstart);
-                        else
-                            pool_size = filter_size_w * filter_size_h * filter_size_d;
-                        pool_size            = (pool_size == 0) ? 1 : pool_size;
-                        size_t res_index     = 0;
-                        size_t res_index_gpu = 0;
-                        bool found           = false;
-                        for(int d = dstart; d < dend; ++d)
+                        if(pooling_method == MLO_POOLING_OP_MAX)
                         {
-                            for(int h = hstart; h < hend; ++h)
+                            // special index value is used to mark top points which has no
+                            // associated bottom points
+                            const size_t plane_index = mask_ptr[top_index];
+                            size_t res_index         = std::numeric_limits<size_t>::max();
+                            size_t res_index_gpu     = std::numeric_limits<uint8_t>::max();
+                            if(plane_index != pooling_cpu_no_index)
                             {
-                                for(int w = wstart; w < wend; ++w)
-                                {
-                                    size_t bot_index = b * bot_batch_stride +
-                                                       o * bot_channel_stride +
-                                                       d * bot_depth_stride + h * bot_stride + w;
-                                    if(pooling_method == MLO_POOLING_OP_MAX)
-                                    {
-                                        if(static_cast<_Tcheck>(bot_ptr[bot_index]) > res)
-                                        {
-                                            res       = static_cast<_Tcheck>(bot_ptr[bot_index]);
-                                            res_index = bot_index;
-                                            res_index_gpu =
-                                                index_position == 1
-                                                    ? (d * bot_height * bot_width + h * bot_width +
-                                                       w)
-                                                    : ((d - k * pool_stride_d + pad_d) *
-                                                       filter_size_w * filter_size_h) +
-                                                          ((h - j * pool_stride_h + pad_h) *
-                                                           filter_size_w) +
-                                                          (w - i * pool_stride_w + pad_w);
-                                            found = true;
-                                        }
-                                    }
-                                    else if(pooling_method == MLO_POOLING_OP_AVE ||
-                                            pooling_method == MLO_POOLING_OP_AVE_INCLUSIVE)
-                                    {
-
-                                        res += static_cast<_Tcheck>(bot_ptr[bot_index]);
-                                    }
-                                    else
-                                    {
-                                        std::cout << "ERROR: unknown operator : layer: pooling."
-                                                  << std::endl;
-                                        match = false;
-                                        continue;
-                                    }
-                                }
+                                const int d = plane_index / (bot_height * bot_width);
+                                const int h = (plane_index / bot_width) % bot_height;
+                                const int w = plane_index % bot_width;
+                                res_index   = b * bot_batch_stride + o * bot_channel_stride +
+                                              d * bot_depth_stride + h * bot_stride + w;
+                                res_index_gpu =
+                                    index_position == 1
+                                        ? plane_index
+                                        : ((d - k * pool_stride_d + pad_d) * filter_size_w *
+                                           filter_size_h) +
+                                              ((h - j * pool_stride_h + pad_h) * filter_size_w) +
+                                              (w - i * pool_stride_w + pad_w);
+                            }
+                            else
+                            {
+                                c_val = 0;
                             }
-                        }
-                        // special index value is used to mark top points which has no associated
-                        // bottom
-                        // points
-                        if(!found)
-                        {
-                            res_index     = std::numeric_limits<size_t>::max();
-                            res_index_gpu = std::numeric_limits<uint8_t>::max();
-                        }
 
-                        size_t top_index = b * top_batch_stride + o * top_channel_stride +
-                                           k * top_depth_stride + j * top_stride + i;
-                        if(pooling_method == MLO_POOLING_OP_MAX)
-                        {
                             // the case with the odd input, the even kernel size and 2*pad == kernel
                             // size
                             mask_ptr[top_index] = res_index;
@@ -232,19 +215,11 @@ bool mloPoolingForwardRunHostAndVerify(int pooling_method,
                                 }
                             }
                         }
-                        if(pooling_method == MLO_POOLING_OP_AVE ||
-                           pooling_method == MLO_POOLING_OP_AVE_INCLUSIVE)
-                        {
-                            res /= pool_size;
-                        }
-                        _Tcheck c_val = res;
 
                         _Tgpu gg_val = (top_ptr[top_index]);
 
                         gg_val = (_Tgpu(gg_val) == _Tgpu(-G_MAX_VAL)) ? _Tgpu(0) : _Tgpu(gg_val);
 
-                        c_val = (c_val == -MAX_VAL) ? 0 : c_val;
-
                         _Tcheck g_val(gg_val);
 
                         double err = std::abs(c_val - g_val);
@@ -302,114 +277,59 @@ int mloPoolingBackwardRunHost(
     int top_height,
     int top_depth)
 {
-
-    int ret = 0;
-
-    for(int b = 0; b < n_batchs; b++)
+    pooling_cpu_problem problem;
+    if(!mloPoolingHostMode(pooling_method, problem.mode))
     {
-        for(int o = 0; o < n_outputs; o++)
-        {
-            int bot_df_v_off = b * bot_df_v_batch_stride + o * bot_df_v_channel_stride;
-            int top_df_off   = b * top_df_batch_stride + o * top_df_channel_stride;
+        std::cout << "ERROR: unknown operator : layer: pooling back-propagation." << std::endl;
+        return 0;
+    }
 
-            if(pooling_method == MLO_POOLING_OP_MAX)
-            {
-                for(int k = 0; k < top_depth; k++)
-                {
-                    for(int j = 0; j < top_height; j++)
-                    {
-                        for(int i = 0; i < top_width; i++)
-                        {
-                            size_t top_idx =
-                                top_df_off + k * top_df_depth_stride + j * top_df_stride + i;
-                            size_t bot_idx = mask_ptr[top_idx];
-                            // skip top points that don't have associated bottom points
-                            if(bot_idx == std::numeric_limits<size_t>::max())
-                                continue;
-                            bot_df_v_ptr[bot_idx] += static_cast<_Tcheck>(top_df_ptr[top_idx]);
-                        }
-                    }
-                }
-            }
-            else if(pooling_method == MLO_POOLING_OP_AVE ||
-                    pooling_method == MLO_POOLING_OP_AVE_INCLUSIVE)
+    if(problem.mode == miopenPoolingMax)
+    {
+        // mask_ptr holds global offsets into bot_df; every plane only touches its own part.
+        miopen::par_for(size_t(n_batchs) * n_outputs, 1, [&](size_t plane) {
+            const size_t b = plane / n_outputs;
+            const size_t o = plane % n_outputs;
+            int top_df_off = b * top_df_batch_stride + o * top_df_channel_stride;
+            for(int k = 0; k < top_depth; k++)
             {
-
-                for(int k = 0; k < bot_depth; k++)
+                for(int j = 0; j < top_height; j++)
                 {
-                    for(int j = 0; j < bot_height; j++)
+                    for(int i = 0; i < top_width; i++)
                     {
-                        for(int i = 0; i < bot_width; i++)
-                        {
-                            // c-emulator
-                            bot_df_v_ptr[bot_df_v_off + k * bot_df_v_depth_stride +
-                                         j * bot_df_v_stride + i] = static_cast<_Tcheck>(0);
-                            int d                                 = k + pad_d;
-                            int h                                 = j + pad_h;
-                            int w                                 = i + pad_w;
-                            int pdstart =
-                                (d < filter_size_d) ? 0 : (d - filter_size_d) / pool_stride_d + 1;
-                            int pdend = std::min(d / pool_stride_d + 1, top_depth);
-                            int phstart =
-                                (h < filter_size_h) ? 0 : (h - filter_size_h) / pool_stride_h + 1;
-                            int phend = std::min(h / pool_stride_h + 1, top_height);
-                            int pwstart =
-                                (w < filter_size_w) ? 0 : (w - filter_size_w) / pool_stride_w + 1;
-                            int pwend        = std::min(w / pool_stride_w + 1, top_width);
-                            _Tcheck gradient = static_cast<_Tcheck>(0);
-                            for(int pd = pdstart; pd < pdend; ++pd)
-                            {
-                                for(int ph = phstart; ph < phend; ++ph)
-                                {
-                                    for(int pw = pwstart; pw < pwend; ++pw)
-                                    {
-                                        // figure out the pooling size
-                                        int dstart = pd * pool_stride_d - pad_d;
-                                        int hstart = ph * pool_stride_h - pad_h;
-                                        int wstart = pw * pool_stride_w - pad_w;
-                                        int dend   = std::min(dstart + filter_size_d, bot_depth);
-                                        int hend   = std::min(hstart + filter_size_h, bot_height);
-                                        int wend   = std::min(wstart + filter_size_w, bot_width);
-                                        dstart     = std::max(dstart, 0);
-                                        hstart     = std::max(hstart, 0);
-                                        wstart     = std::max(wstart, 0);
-
-                                        int pool_size;
-                                        if(pooling_method == MLO_POOLING_OP_AVE)
-                                            pool_size = ((dend - dstart) * (hend - hstart) *
-                                                             (wend - wstart) ==
-                                                         0)
-                                                            ? 1
-                                                            : (dend - dstart) * (hend - hstart) *
-                                                                  (wend - wstart);
-                                        else
-                                            pool_size =
-                                                (filter_size_w * filter_size_h * filter_size_d == 0)
-                                                    ? 1
-                                                    : filter_size_w * filter_size_h * filter_size_d;
-                                        gradient +=
-                                            static_cast<_Tcheck>(
-                                                top_df_ptr[top_df_off + pd * top_df_depth_stride +
-                                                           ph * top_df_stride + pw]) /
-                                            static_cast<_Tcheck>(pool_size);
-                                    }
-                                }
-                            }
-                            bot_df_v_ptr[bot_df_v_off + k * bot_df_v_depth_stride +
-                                         j * bot_df_v_stride + i] = gradient;
-                        }
+                        size_t top_idx =
+                            top_df_off + k * top_df_depth_stride + j * top_df_stride + i;
+                        size_t bot_idx = mask_ptr[top_idx];
+                        // skip top points that don't have associated bottom points
+                        if(bot_idx == std::numeric_limits<size_t>::max())
+                            continue;
+                        bot_df_v_ptr[bot_idx] += static_cast<_Tcheck>(top_df_ptr[top_idx]);
                     }
                 }
             }
-            else
-            {
-                std::cout << "ERROR: unknown operator : layer: pooling back-propagation."
-                          << std::endl;
-                continue;
-            }
-        }
+        });
+        return 0;
     }
-    return (ret);
+
+    problem.n         = n_batchs;
+    problem.c         = n_outputs;
+    problem.in_lens   = {{size_t(bot_depth), size_t(bot_height), size_t(bot_width)}};
+    problem.out_lens  = {{size_t(top_depth), size_t(top_height), size_t(top_width)}};
+    problem.kernel    = {{size_t(filter_size_d), size_t(filter_size_h), size_t(filter_size_w)}};
+    problem.stride    = {{size_t(pool_stride_d), size_t(pool_stride_h), size_t(pool_stride_w)}};
+    problem.pad       = {{size_t(pad_d), size_t(pad_h), size_t(pad_w)}};
+    problem.x_strides = {{size_t(bot_df_v_batch_stride),
+                          size_t(bot_df_v_channel_stride),
+                          size_t(bot_df_v_depth_stride),
+                          size_t(bot_df_v_stride),
+                          1}};
+    problem.y_strides = {{size_t(top_df_batch_stride),
+                          size_t(top_df_channel_stride),
+                          size_t(top_df_depth_stride),
+                          size_t(top_df_stride),
+                          1}};
+    pooling_cpu_backward(problem, top_df_ptr, bot_df_v_ptr);
+    return 0;
 }
 
 #ifdef __clang__
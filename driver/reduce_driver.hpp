@@ -72,12 +72,14 @@ class ReduceDriver : public Driver
     int GetandSetData() override;
     std::vector<int> GetInputTensorLengthsFromCmdLine();
     std::vector<int> GetDimsToReduceFromCmdLine();
+    std::vector<int> GetMultiReduceOpsFromCmdLine();
 
     int SetReduceTensorDescriptorFromCmdLineArgs();
 
     int AllocateBuffersAndCopy() override;
 
     int RunForwardGPU() override;
+    int RunForwardGPUMulti();
     int RunForwardCPU();
 
     int RunBackwardGPU() override;
@@ -85,6 +87,7 @@ class ReduceDriver : public Driver
 
     int VerifyBackward() override;
     int VerifyForward() override;
+    int VerifyForwardMulti();
 
     ~ReduceDriver() override
     {
@@ -93,6 +96,8 @@ class ReduceDriver : public Driver
         miopenDestroyTensorDescriptor(inputTensor);
 
         miopenDestroyReduceTensorDescriptor(reduceDesc);
+        for(auto desc : multiDescs)
+            miopenDestroyReduceTensorDescriptor(desc);
     }
 
     private:
@@ -119,6 +124,12 @@ class ReduceDriver : public Driver
     std::size_t indices_sizeInBytes;
 
     miopenReduceTensorDescriptor_t reduceDesc;
+
+    // reductions fused by miopenReduceTensorMulti, empty unless MultiReduceOps is given
+    std::vector<miopenReduceTensorDescriptor_t> multiDescs;
+    std::vector<std::unique_ptr<GPUMem>> multi_out_dev;
+    std::vector<std::vector<Tgpu>> multi_out;
+    std::vector<std::vector<Tref>> multi_outhost;
 };
 
 template <typename Tgpu, typename Tref>
@@ -200,6 +211,14 @@ int ReduceDriver<Tgpu, Tref>::AddCmdLineArgs()
                          "operation is used (Default=0 to indicate no indices outputed)",
                          "int");
 
+    inflags.AddInputFlag("MultiReduceOps",
+                         'M',
+                         "",
+                         "Comma separated Reduction Operation Types computed together in one "
+                         "pass by miopenReduceTensorMulti, ReduceOp and IndicesUsed are ignored "
+                         "(Default= to use miopenReduceTensor)",
+                         "string");
+
     inflags.AddInputFlag("alpha", 'A', "1.0", "Scale factor for input tensor", "double");
     inflags.AddInputFlag("beta", 'B', "0.0", "Scale factor for output tensor", "double");
 
@@ -275,6 +294,28 @@ std::vector<int> ReduceDriver<Tgpu, Tref>::GetDimsToReduceFromCmdLine()
     return (lengths);
 }
 
+template <typename Tgpu, typename Tref>
+std::vector<int> ReduceDriver<Tgpu, Tref>::GetMultiReduceOpsFromCmdLine()
+{
+    std::string opsStr = inflags.GetValueStr("MultiReduceOps");
+
+    std::vector<int> ops;
+    std::size_t pos = 0;
+
+    while(pos < opsStr.size())
+    {
+        std::size_t new_pos = opsStr.find(',', pos);
+        if(new_pos == std::string::npos)
+            new_pos = opsStr.size();
+
+        ops.push_back(std::stoi(opsStr.substr(pos, new_pos - pos)));
+
+        pos = new_pos + 1;
+    };
+
+    return (ops);
+}
+
 template <typename Tgpu, typename Tref>
 int ReduceDriver<Tgpu, Tref>::SetReduceTensorDescriptorFromCmdLineArgs()
 {
@@ -296,6 +337,22 @@ int ReduceDriver<Tgpu, Tref>::SetReduceTensorDescriptorFromCmdLineArgs()
     if(std::is_same<Tgpu, double>::value)
         compType = miopenDouble;
 
+    for(const auto op : GetMultiReduceOpsFromCmdLine())
+    {
+        miopenReduceTensorDescriptor_t desc;
+        miopenCreateReduceTensorDescriptor(&desc);
+        miopenSetReduceTensorDescriptor(desc,
+                                        static_cast<miopenReduceTensorOp_t>(op),
+                                        compType,
+                                        nanOpt,
+                                        MIOPEN_REDUCE_TENSOR_NO_INDICES,
+                                        indicesType);
+        multiDescs.push_back(desc);
+    }
+
+    if(!multiDescs.empty())
+        this->need_indices = false;
+
     return (miopenSetReduceTensorDescriptor(
         reduceDesc, reduceOp, compType, nanOpt, indicesOpt, indicesType));
 }
@@ -308,10 +365,23 @@ int ReduceDriver<Tgpu, Tref>::AllocateBuffersAndCopy()
     size_t in_nelem  = GetTensorSize(inputTensor);
     size_t out_nelem = GetTensorSize(outputTensor);
 
-    miopenGetReductionWorkspaceSize(
-        GetHandle(), reduceDesc, inputTensor, outputTensor, &this->ws_sizeInBytes);
-    miopenGetReductionIndicesSize(
-        GetHandle(), reduceDesc, inputTensor, outputTensor, &this->indices_sizeInBytes);
+    if(multiDescs.empty())
+    {
+        miopenGetReductionWorkspaceSize(
+            GetHandle(), reduceDesc, inputTensor, outputTensor, &this->ws_sizeInBytes);
+        miopenGetReductionIndicesSize(
+            GetHandle(), reduceDesc, inputTensor, outputTensor, &this->indices_sizeInBytes);
+    }
+    else
+    {
+        miopenGetReductionMultiWorkspaceSize(GetHandle(),
+                                             static_cast<int>(multiDescs.size()),
+                                             multiDescs.data(),
+                                             inputTensor,
+                                             outputTensor,
+                                             &this->ws_sizeInBytes);
+        this->indices_sizeInBytes = 0;
+    }
 
     size_t ws_nelem = (!this->need_indices) ? this->ws_sizeInBytes / sizeof(Tgpu)
                                             : this->ws_sizeInBytes / (sizeof(Tgpu) + sizeof(int));
@@ -338,6 +408,13 @@ int ReduceDriver<Tgpu, Tref>::AllocateBuffersAndCopy()
     out_indices     = std::vector<int>(indices_nelem, static_cast<int>(0));
     outhost_indices = std::vector<int>(indices_nelem, static_cast<int>(0));
 
+    for(std::size_t i = 0; i < multiDescs.size(); i++)
+    {
+        multi_out_dev.emplace_back(new GPUMem(ctx, out_nelem, sizeof(Tgpu)));
+        multi_out.push_back(out);
+        multi_outhost.push_back(outhost);
+    }
+
     std::string inFileName = inflags.GetValueStr("in_data");
 
     bool rdResult = false;
@@ -359,6 +436,8 @@ int ReduceDriver<Tgpu, Tref>::AllocateBuffersAndCopy()
 #endif
     status = in_dev->ToGPU(q, in.data());
     status |= out_dev->ToGPU(q, out.data());
+    for(std::size_t i = 0; i < multi_out_dev.size(); i++)
+        status |= multi_out_dev[i]->ToGPU(q, multi_out[i].data());
 
     if(status != CL_SUCCESS)
         printf("Error copying data to GPU\n");
@@ -369,6 +448,9 @@ int ReduceDriver<Tgpu, Tref>::AllocateBuffersAndCopy()
 template <typename Tgpu, typename Tref>
 int ReduceDriver<Tgpu, Tref>::RunForwardGPU()
 {
+    if(!multiDescs.empty())
+        return RunForwardGPUMulti();
+
     auto alpha = static_cast<float>(this->inflags.GetValueDouble("alpha"));
     auto beta  = static_cast<float>(this->inflags.GetValueDouble("beta"));
 
@@ -450,6 +532,75 @@ int ReduceDriver<Tgpu, Tref>::RunForwardGPU()
     return miopenStatusSuccess;
 }
 
+template <typename Tgpu, typename Tref>
+int ReduceDriver<Tgpu, Tref>::RunForwardGPUMulti()
+{
+    auto alpha = static_cast<float>(this->inflags.GetValueDouble("alpha"));
+    auto beta  = static_cast<float>(this->inflags.GetValueDouble("beta"));
+
+    bool output_accumulate = !(reduce::float_equal_one(alpha) && reduce::float_equal_zero(beta));
+
+    const double alpha64       = alpha;
+    const double beta64        = beta;
+    const void* const alphaPtr = std::is_same<Tgpu, double>::value
+                                     ? static_cast<const void*>(&alpha64)
+                                     : static_cast<const void*>(&alpha);
+    const void* const betaPtr = std::is_same<Tgpu, double>::value
+                                    ? static_cast<const void*>(&beta64)
+                                    : static_cast<const void*>(&beta);
+
+    std::vector<void*> outputs;
+    for(auto& dev : multi_out_dev)
+        outputs.push_back(dev->GetMem());
+
+    auto run = [&]() {
+        miopenReduceTensorMulti(GetHandle(),
+                                static_cast<int>(multiDescs.size()),
+                                multiDescs.data(),
+                                ws_sizeInBytes > 0 ? ws_dev->GetMem() : nullptr,
+                                ws_sizeInBytes,
+                                alphaPtr,
+                                inputTensor,
+                                in_dev->GetMem(),
+                                betaPtr,
+                                outputTensor,
+                                outputs.data());
+    };
+
+    auto read_outputs = [&]() {
+        for(std::size_t i = 0; i < multi_out_dev.size(); i++)
+            multi_out_dev[i]->FromGPU(GetStream(), multi_out[i].data());
+    };
+
+    // must get the output here, since the host-based method only run once
+    run();
+    if(output_accumulate)
+        read_outputs();
+
+    Timer t;
+    START_TIME
+
+    for(int i = 0; i < inflags.GetValueInt("iter"); i++)
+        run();
+
+    if(!output_accumulate)
+        read_outputs();
+
+    if(inflags.GetValueInt("time") == 1)
+    {
+        float time = 0.0;
+        miopenGetKernelTime(GetHandle(), &time);
+
+        STOP_TIME
+        if(WALL_CLOCK)
+            printf("Wall-clock Time Multi Reduction Elapsed: %f ms\n",
+                   t.gettime_ms() / inflags.GetValueInt("iter"));
+        printf("GPU Kernel Time Multi Reduction Elapsed: %f ms\n", time);
+    }
+
+    return miopenStatusSuccess;
+}
+
 template <typename Tgpu, typename Tref>
 int ReduceDriver<Tgpu, Tref>::RunForwardCPU()
 {
@@ -465,6 +616,9 @@ int ReduceDriver<Tgpu, Tref>::RunBackwardGPU()
 template <typename Tgpu, typename Tref>
 int ReduceDriver<Tgpu, Tref>::VerifyForward()
 {
+    if(!multiDescs.empty())
+        return VerifyForwardMulti();
+
     miopenReductionHost<Tgpu, Tref> hostReduction(this->reduceDesc,
                                                   this->inputTensor,
                                                   this->outputTensor,
@@ -538,6 +692,63 @@ int ReduceDriver<Tgpu, Tref>::VerifyForward()
     return 0;
 }
 
+template <typename Tgpu, typename Tref>
+int ReduceDriver<Tgpu, Tref>::VerifyForwardMulti()
+{
+    miopenMultiReductionHost<Tgpu, Tref> hostReduction(this->multiDescs,
+                                                       this->inputTensor,
+                                                       this->outputTensor,
+                                                       this->dimsInvariant,
+                                                       this->dimsToReduce);
+
+    auto alpha = static_cast<float>(this->inflags.GetValueDouble("alpha"));
+    auto beta  = static_cast<float>(this->inflags.GetValueDouble("beta"));
+
+    std::vector<Tref*> outputs;
+    for(auto& host : multi_outhost)
+        outputs.push_back(host.data());
+
+    hostReduction.Run(alpha, in.data(), beta, outputs);
+
+    const auto ops = GetMultiReduceOpsFromCmdLine();
+    for(std::size_t i = 0; i < ops.size(); i++)
+    {
+        auto error       = miopen::rms_range(multi_outhost[i], multi_out[i]);
+        double tolerance = 1.5e-4;
+
+        // the fused kernels accumulate in float
+        if(!std::is_same<Tgpu, float>::value)
+            tolerance *= 4.0;
+
+        if(ops[i] == MIOPEN_REDUCE_TENSOR_NORM2)
+            tolerance *= 12.0;
+
+        if(error > tolerance)
+        {
+            std::cout << "ReduceTensorMulti() Failed for operation " << ops[i]
+                      << " with error = " << error << " , tolerance = " << tolerance << "\n";
+        }
+        else
+        {
+            printf("ReduceTensorMulti() operation %d Verifies on CPU and GPU (err=%f)\n",
+                   ops[i],
+                   error);
+        };
+
+        if(inflags.GetValueInt("dump_output"))
+        {
+            const auto suffix = std::to_string(i) + ".bin";
+            dumpBufferToFile(
+                ("dump_out" + suffix).c_str(), multi_out[i].data(), multi_out[i].size());
+            dumpBufferToFile(("dump_outhost" + suffix).c_str(),
+                             multi_outhost[i].data(),
+                             multi_outhost[i].size());
+        }
+    }
+
+    return 0;
+}
+
 template <typename Tgpu, typename Tref>
 int ReduceDriver<Tgpu, Tref>::RunBackwardCPU()
 {
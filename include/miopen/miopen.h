@@ -246,6 +246,80 @@ MIOPEN_EXPORT miopenStatus_t miopenGetKernelTime(miopenHandle_t handle, float* t
  * @return           miopenStatus_t
  */
 MIOPEN_EXPORT miopenStatus_t miopenEnableProfiling(miopenHandle_t handle, bool enable);
+
+/*! @brief Creates the miopenLaunchList_t type
+ *
+ * A launch list holds the kernel launches of a sequence of MIOpen calls, recorded between
+ * miopenBeginLaunchCapture and miopenEndLaunchCapture. Replaying the list enqueues the same
+ * kernels with the same arguments, without any of the per-call validation, solution selection
+ * and invoker lookup of the calls that were captured. GEMMs are replayed as rocBLAS calls, which
+ * repeat the host setup of rocBLAS on every replay.
+ */
+MIOPEN_DECLARE_OBJECT(miopenLaunchList);
+
+/*! @struct miopenLaunchBinding_t
+ * @brief Redirects the pointers into a buffer of a launch list to another buffer
+ */
+typedef struct
+{
+    const void* from; /*!< Buffer used while capturing or by the previous rebinding */
+    size_t size;      /*!< Size in bytes of the buffer */
+    void* to;         /*!< Buffer of the same size to use instead */
+} miopenLaunchBinding_t;
+
+/*! @brief Starts recording the kernel launches of a handle
+ *
+ * Until miopenEndLaunchCapture is called, the kernels of the MIOpen calls made with the handle
+ * are recorded instead of being launched, so none of the outputs of these calls is written.
+ * GEMMs and buffer copies are recorded as calls that are made again on replay. Capturing
+ * requires the HIP backend. Calls that allocate temporary device memory through the handle fail
+ * with miopenStatusBadParm while capturing, since their buffers would be freed before the list
+ * is replayed.
+ *
+ * @param handle     MIOpen handle (input)
+ * @return           miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenBeginLaunchCapture(miopenHandle_t handle);
+
+/*! @brief Stops recording the kernel launches of a handle
+ *
+ * @param handle     MIOpen handle (input)
+ * @param list       Pointer to the launches recorded since miopenBeginLaunchCapture (output)
+ * @return           miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenEndLaunchCapture(miopenHandle_t handle,
+                                                    miopenLaunchList_t* list);
+
+/*! @brief Redirects the buffers used by a launch list
+ *
+ * Every pointer argument of the list that points into one of the from buffers is moved to the
+ * same offset of the corresponding to buffer. The list keeps the new pointers, so the next
+ * rebinding starts from them.
+ *
+ * @param list       Launch list (input)
+ * @param count      Number of bindings (input)
+ * @param bindings   Array of count bindings (input)
+ * @return           miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenRebindLaunchList(miopenLaunchList_t list,
+                                                    size_t count,
+                                                    const miopenLaunchBinding_t* bindings);
+
+/*! @brief Enqueues the launches of a launch list
+ *
+ * @param handle     MIOpen handle the list was captured with (input)
+ * @param list       Launch list (input)
+ * @return           miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenReplayLaunchList(miopenHandle_t handle,
+                                                    miopenLaunchList_t list);
+
+/*! @brief Destroys a launch list
+ *
+ * @param list       Launch list to destroy (input)
+ * @return           miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenDestroyLaunchList(miopenLaunchList_t list);
 /** @} */
 // CLOSEOUT HANDLE DOXYGEN GROUP
 
@@ -307,6 +381,23 @@ MIOPEN_DECLARE_OBJECT(miopenActivationDescriptor);
  */
 MIOPEN_DECLARE_OBJECT(miopenRNNDescriptor);
 
+/*! @ingroup RNN
+ * @brief Creates the miopenRNNPlan_t type
+ *
+ * An RNN plan binds an RNN descriptor to its sequence length and tensor descriptors. The GEMM
+ * and tensor descriptors and the kernels of each pass are resolved on its first execution and
+ * reused by the following ones.
+ */
+MIOPEN_DECLARE_OBJECT(miopenRNNPlan);
+
+/*! @ingroup RNN
+ * @brief Creates the miopenRNNPackedPlan_t type
+ *
+ * A packed RNN plan runs an RNN plan on a batch of variable-length sequences given back to back
+ * without padding, sorting them into the order the RNN needs and back.
+ */
+MIOPEN_DECLARE_OBJECT(miopenRNNPackedPlan);
+
 /*! @ingroup LossFunction
  * @brief Creates the miopenCTCLossDescriptor_t type
  */
@@ -1481,6 +1572,128 @@ miopenConvolutionBackwardWeightsImmediate(miopenHandle_t handle,
                                           size_t workSpaceSize,
                                           const uint64_t solution_id);
 
+/*! @ingroup convolutions
+ * @brief Creates the miopenConvolutionPlan_t type
+ *
+ * A convolution plan binds the tensor descriptors, the convolution descriptor, the direction and
+ * the solution of a convolution once. Executing a plan only takes the buffers, which skips the
+ * per-call validation, problem construction and invoker lookup of the Immediate API.
+ */
+MIOPEN_DECLARE_OBJECT(miopenConvolutionPlan);
+
+/*! @enum miopenConvDirection_t
+ * Direction of the convolution executed by a plan.
+ */
+typedef enum
+{
+    miopenConvDirectionFwd        = 0, /*!< Forward convolution */
+    miopenConvDirectionBwdData    = 1, /*!< Backward convolution w-r-t data */
+    miopenConvDirectionBwdWeights = 2, /*!< Backward convolution w-r-t weights */
+} miopenConvDirection_t;
+
+/*! @brief Creates an execution plan for a convolution solution
+ *
+ * The tensors are always described in terms of the forward convolution: for the backward
+ * directions xDesc and yDesc describe dx and dy, and for backward weights wDesc describes dw.
+ * The kernels of the solution are compiled if they are not available yet. The plan only stays
+ * valid while the handle it was created with exists and may not be executed concurrently from
+ * several threads.
+ *
+ * @param handle         MIOpen handle (input)
+ * @param plan           Pointer to the convolution plan (output)
+ * @param direction      Direction of the convolution (input)
+ * @param xDesc          Tensor descriptor for data tensor x or dx (input)
+ * @param wDesc          Tensor descriptor for weight tensor w or dw (input)
+ * @param convDesc       Convolution layer descriptor (input)
+ * @param yDesc          Tensor descriptor for data tensor y or dy (input)
+ * @param solution_id    ID of the solution, as returned by the GetSolution API calls (input)
+ * @return               miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t
+miopenCreateConvolutionPlan(miopenHandle_t handle,
+                            miopenConvolutionPlan_t* plan,
+                            miopenConvDirection_t direction,
+                            const miopenTensorDescriptor_t xDesc,
+                            const miopenTensorDescriptor_t wDesc,
+                            const miopenConvolutionDescriptor_t convDesc,
+                            const miopenTensorDescriptor_t yDesc,
+                            const uint64_t solution_id);
+
+/*! @brief Query the workspace size required to execute a convolution plan
+ *
+ * @param plan           Convolution plan (input)
+ * @param workSpaceSize  Pointer to memory to return size in bytes (output)
+ * @return               miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenConvolutionPlanGetWorkSpaceSize(miopenConvolutionPlan_t plan,
+                                                                   size_t* workSpaceSize);
+
+/*! @brief Executes a convolution plan
+ *
+ * The buffers follow the naming of miopenCreateConvolutionPlan. The output of the convolution is
+ * y for the forward direction, x (dx) for backward data and w (dw) for backward weights; the
+ * other two buffers are only read. Executing the plan with a handle other than the one it was
+ * created with fails with miopenStatusBadParm.
+ *
+ * @param handle         MIOpen handle the plan was created with (input)
+ * @param plan           Convolution plan (input)
+ * @param x              Data tensor x or dx
+ * @param w              Weight tensor w or dw
+ * @param y              Data tensor y or dy
+ * @param workSpace      Workspace tensor (input)
+ * @param workSpaceSize  Size in bytes of the memory pointed to by workSpace, at least the value
+ * returned by miopenConvolutionPlanGetWorkSpaceSize (input)
+ * @return               miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenExecuteConvolutionPlan(miopenHandle_t handle,
+                                                          miopenConvolutionPlan_t plan,
+                                                          void* x,
+                                                          void* w,
+                                                          void* y,
+                                                          void* workSpace,
+                                                          size_t workSpaceSize);
+
+/*! @struct miopenConvolutionPlanLaunch_t
+ * @brief The buffers of one execution of a convolution plan, see miopenExecuteConvolutionPlans
+ */
+typedef struct
+{
+    miopenConvolutionPlan_t plan; /*!< Convolution plan */
+    void* x;                      /*!< Data tensor x or dx */
+    void* w;                      /*!< Weight tensor w or dw */
+    void* y;                      /*!< Data tensor y or dy */
+    void* workSpace;              /*!< Workspace tensor */
+    size_t workSpaceSize;         /*!< Size in bytes of the memory pointed to by workSpace */
+} miopenConvolutionPlanLaunch_t;
+
+/*! @brief Executes many independent convolution plans
+ *
+ * Equivalent to calling miopenExecuteConvolutionPlan for every launch, except that all the
+ * launches are validated before the first one is enqueued and that they are enqueued grouped by
+ * plan. No launch may read a buffer written by another launch of the same call.
+ *
+ * Launches of the same plan whose x, y and w buffers directly follow the ones of the previous
+ * launch (or share the same w) form a single convolution with a larger batch or group count.
+ * Where the solution of the plan is applicable to that convolution and the workspace of the
+ * first launch is large enough, such launches are executed together, in parts whose sizes are
+ * powers of two (7 launches run as 4, 2 and 1), so that the number of merged convolutions
+ * compiled for a plan stays small.
+ *
+ * @param handle         MIOpen handle the plans were created with (input)
+ * @param count          Number of launches (input)
+ * @param launches       Array of count launches (input)
+ * @return               miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenExecuteConvolutionPlans(
+    miopenHandle_t handle, size_t count, const miopenConvolutionPlanLaunch_t* launches);
+
+/*! @brief Destroys a convolution plan
+ *
+ * @param plan           Convolution plan to destroy (input)
+ * @return               miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenDestroyConvolutionPlan(miopenConvolutionPlan_t plan);
+
 /*! @brief Query the workspace size required for a forward convolution layer
  *
  * This call is required and must be executed once before running
@@ -2824,6 +3037,21 @@ miopenFusionPlanConvolutionGetAlgo(miopenFusionPlanDescriptor_t fusePlanDesc,
 MIOPEN_EXPORT miopenStatus_t miopenFusionPlanConvolutionSetAlgo(
     miopenFusionPlanDescriptor_t fusePlanDesc, miopenConvFwdAlgorithm_t algo);
 
+/*! @brief Requests tuning of the fused convolution kernel when the fusion plan is compiled
+ *
+ * @details When enabled, miopenCompileFusionPlan searches for the best performance parameters
+ * of the fused convolution kernel unless they are already present in the performance database,
+ * and stores the result in the user performance database. Later compilations of the same
+ * plan load the tuned parameters from the database without searching again.
+ * Must be called after the convolution operator has been added to the plan.
+ *
+ * @param fusePlanDesc A fusion plan descriptor (input)
+ * @param exhaustiveSearch Whether the fused convolution kernel should be tuned (input)
+ * @return miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenFusionPlanConvolutionSetExhaustiveSearch(
+    miopenFusionPlanDescriptor_t fusePlanDesc, bool exhaustiveSearch);
+
 /*! @brief Creates forward convolution operator.
  *
  * @param fusePlanDesc   A fusion plan descriptor (input)
@@ -3175,6 +3403,18 @@ typedef enum
     miopenRNNAlgoGEMM = 0,
 } miopenRNNGEMMalgoMode_t;
 
+/*! @enum miopenRNNWeightLayout_t
+ * Layout of the weight matrices in the weight buffer of an RNN
+ */
+typedef enum
+{
+    miopenRNNWeightsCanonical = 0, /*!< Each parameter matrix is fully packed at the offset
+                                      returned by miopenGetRNNLayerParamOffset */
+    miopenRNNWeightsPrepared = 1,  /*!< Weights written by miopenRNNPrepareWeights: the matrices
+                                      of the gates of a layer are concatenated and stored
+                                      transposed for the GEMMs of miopenRNNForwardInference */
+} miopenRNNWeightLayout_t;
+
 /*! @brief Create a RNN layer Descriptor
  *
  * API for creating an uninitialized RNN layer descriptor.
@@ -3292,6 +3532,63 @@ MIOPEN_EXPORT miopenStatus_t miopenSetRNNDescriptor_V2(miopenRNNDescriptor_t rnn
                                                        miopenRNNAlgo_t algo,
                                                        miopenDataType_t dataType);
 
+/*! @brief Set the number of streams that the layers of a stacked RNN are issued on
+ *
+ * When this is set to a non-zero value, miopenRNNForwardInference issues the work of every
+ * (layer, step) pair of a unidirectional RNN on one of up to streams auxiliary streams of the
+ * handle, with events between the streams. The first step of a layer projects the output of the
+ * layer below over the whole sequence, with the same GEMM as the default schedule, and the
+ * following steps only run the recurrence. Each layer therefore starts once the layer below has
+ * finished. The work is forked from and joined back into the stream of the handle, and the
+ * results are identical to the default schedule for every number of streams.
+ *
+ * The OpenCL backend and handles that capture their launches issue the same work in the same
+ * order on the stream of the handle. Bidirectional RNNs and the other RNN passes always use the
+ * default schedule. The setting is reset by miopenSetRNNDescriptor and
+ * miopenSetRNNDescriptor_V2. It defaults to 0 (disabled).
+ *
+ * @param rnnDesc      RNN layer descriptor type (input/output)
+ * @param streams      Maximum number of streams, or 0 to disable the wavefront schedule (input)
+ * @return             miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenSetRNNWavefrontStreams(miopenRNNDescriptor_t rnnDesc,
+                                                          size_t streams);
+
+/*! @brief Get the number of streams that the layers of a stacked RNN are issued on
+ *
+ * @param rnnDesc      RNN layer descriptor type (input)
+ * @param streams      Maximum number of streams, 0 if the wavefront schedule is disabled (output)
+ * @return             miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenGetRNNWavefrontStreams(miopenRNNDescriptor_t rnnDesc,
+                                                          size_t* streams);
+
+/*! @brief Set the layout of the weight buffer of an RNN
+ *
+ * With miopenRNNWeightsPrepared, the w argument of miopenRNNForwardInference,
+ * miopenGetRNNLayerParam and miopenSetRNNLayerParam is a buffer written by
+ * miopenRNNPrepareWeights. miopenGetRNNLayerParam and miopenSetRNNLayerParam keep taking and
+ * returning fully packed parameter matrices and map them to the prepared layout. The biases are
+ * stored as in the canonical layout. The training and backward passes only accept the canonical
+ * layout. The setting is reset by miopenSetRNNDescriptor and miopenSetRNNDescriptor_V2. It
+ * defaults to miopenRNNWeightsCanonical.
+ *
+ * @param rnnDesc      RNN layer descriptor type (input/output)
+ * @param layout       Layout of the weight buffer (input)
+ * @return             miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenSetRNNWeightLayout(miopenRNNDescriptor_t rnnDesc,
+                                                      miopenRNNWeightLayout_t layout);
+
+/*! @brief Get the layout of the weight buffer of an RNN
+ *
+ * @param rnnDesc      RNN layer descriptor type (input)
+ * @param layout       Layout of the weight buffer (output)
+ * @return             miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenGetRNNWeightLayout(miopenRNNDescriptor_t rnnDesc,
+                                                      miopenRNNWeightLayout_t* layout);
+
 /*! @brief Query the amount of memory required to execute the RNN layer
  *
  * This function calculates the amount of memory required to run the RNN layer given an RNN
@@ -3679,6 +3976,10 @@ MIOPEN_EXPORT miopenStatus_t miopenGetRNNLayerBias(miopenHandle_t handle,
  * The argument layerParamOffset should either be nullptr, or an address to place the
  * offset. If layerParamOffset is nullptr then only the paramDesc is populated and returned.
  *
+ * The matrices are not contiguous in the miopenRNNWeightsPrepared layout, so the offset can only
+ * be queried for the canonical layout. miopenGetRNNLayerParam and miopenSetRNNLayerParam work
+ * with both layouts.
+ *
  * Note: When inputSkip mode is selected there is no input layer matrix operation,
  * and therefore no associated memory. In this case miopenGetRNNLayerParamOffset() will return
  * a error status miopenStatusBadParm for input paramID associated with the input GEMM.
@@ -3878,6 +4179,36 @@ MIOPEN_EXPORT miopenStatus_t miopenSetRNNLayerBias(miopenHandle_t handle,
                                                    miopenTensorDescriptor_t biasDesc,
                                                    const void* layerBias);
 
+/*! @brief Write RNN weights in the layout preferred by forward inference
+ *
+ * Copies weights w in the canonical layout into prepared, where the input and hidden state
+ * matrices of all the gates of each layer are concatenated and stored transposed so that the
+ * GEMMs of miopenRNNForwardInference read them along their contiguous dimension. The biases are
+ * copied unchanged. This is meant to be done once for weights that are reused by many inference
+ * calls; see miopenSetRNNWeightLayout to use the result.
+ *
+ * prepared has the data type of the RNN descriptor and w may have any floating point type, so
+ * an RNN computing in half precision can be prepared from single precision weights. Both buffers
+ * hold the number of elements given by miopenGetRNNParamsSize. The layout of the RNN descriptor
+ * does not matter for this call: w is always read in the canonical layout.
+ *
+ * @param handle          MIOpen handle (input)
+ * @param rnnDesc         RNN layer descriptor type (input)
+ * @param xDesc           A tensor descriptor to input (input)
+ * @param wDesc           A tensor descriptor to the canonical weights (input)
+ * @param w               Pointer to the canonical weights (input)
+ * @param preparedDesc    A tensor descriptor to the prepared weights (input)
+ * @param prepared        Pointer to the prepared weights (output)
+ * @return                miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenRNNPrepareWeights(miopenHandle_t handle,
+                                                     miopenRNNDescriptor_t rnnDesc,
+                                                     miopenTensorDescriptor_t xDesc,
+                                                     miopenTensorDescriptor_t wDesc,
+                                                     const void* w,
+                                                     miopenTensorDescriptor_t preparedDesc,
+                                                     void* prepared);
+
 /*! @brief Execute forward training for recurrent layer
  *
  * Interface for executing the forward training pass on a RNN.
@@ -4184,6 +4515,276 @@ MIOPEN_EXPORT miopenStatus_t miopenRNNForwardInference(miopenHandle_t handle,
                                                        void* workSpace,
                                                        size_t workSpaceNumBytes);
 
+/*! @brief Creates an execution plan for a recurrent layer
+ *
+ * The descriptors have the meaning they have for miopenRNNForwardTraining. The plan keeps
+ * copies of them; the dropout descriptor of rnnDesc, if any, must outlive the plan. The hidden
+ * state tensors hy, cx, cy and their gradients are described by hxDesc and the gradients dx and
+ * dy by xDesc and yDesc.
+ *
+ * The first execution of each pass, and of each combination of optional NULL buffers, records
+ * the launches of the pass with its buffers, without running any of them, and then replays
+ * them. The following executions only replace the buffers in the recorded launches and replay
+ * them; the GEMMs among them still go through the host setup of rocBLAS. Executions whose
+ * buffers overlap, and all the executions without launch capture (OpenCL backend), run the
+ * regular RNN calls. The plan only stays valid while
+ * the handle it was created with exists and may not be executed concurrently from several
+ * threads.
+ *
+ * @param handle         MIOpen handle (input)
+ * @param plan           Pointer to the RNN plan (output)
+ * @param rnnDesc        RNN layer descriptor (input)
+ * @param sequenceLen    Temporal iterations to unroll (input)
+ * @param xDesc          An array of sequenceLen input tensor descriptors (input)
+ * @param hxDesc         Hidden state tensor descriptor (input)
+ * @param wDesc          Weights tensor descriptor (input)
+ * @param yDesc          An array of sequenceLen output tensor descriptors (input)
+ * @return               miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenCreateRNNPlan(miopenHandle_t handle,
+                                                 miopenRNNPlan_t* plan,
+                                                 const miopenRNNDescriptor_t rnnDesc,
+                                                 const int sequenceLen,
+                                                 const miopenTensorDescriptor_t* xDesc,
+                                                 const miopenTensorDescriptor_t hxDesc,
+                                                 const miopenTensorDescriptor_t wDesc,
+                                                 const miopenTensorDescriptor_t* yDesc);
+
+/*! @brief Query the workspace size required to execute the passes of an RNN plan
+ *
+ * @param plan           RNN plan (input)
+ * @param numBytes       Pointer to memory to return size in bytes (output)
+ * @return               miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenRNNPlanGetWorkSpaceSize(miopenRNNPlan_t plan,
+                                                           size_t* numBytes);
+
+/*! @brief Query the reserve space size required by the training passes of an RNN plan
+ *
+ * @param plan           RNN plan (input)
+ * @param numBytes       Pointer to memory to return size in bytes (output)
+ * @return               miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenRNNPlanGetReserveSpaceSize(miopenRNNPlan_t plan,
+                                                              size_t* numBytes);
+
+/*! @brief Executes the forward inference pass of an RNN plan
+ *
+ * The buffers have the meaning they have for miopenRNNForwardInference.
+ *
+ * @param handle             MIOpen handle the plan was created with (input)
+ * @param plan               RNN plan (input)
+ * @param x                  Pointer to input tensor (input)
+ * @param hx                 Pointer to the hidden layer input tensor, may be NULL (input)
+ * @param cx                 Pointer to the cell layer input tensor, may be NULL (input)
+ * @param w                  Pointer to input weights tensor (input)
+ * @param y                  Pointer to output tensor (output)
+ * @param hy                 Pointer to the hidden layer output tensor, may be NULL (output)
+ * @param cy                 Pointer to the cell layer output tensor, may be NULL (output)
+ * @param workSpace          Pointer to memory allocated for the pass (input)
+ * @param workSpaceNumBytes  Number of allocated bytes in memory for the workspace (input)
+ * @return                   miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenRNNPlanForwardInference(miopenHandle_t handle,
+                                                           miopenRNNPlan_t plan,
+                                                           const void* x,
+                                                           const void* hx,
+                                                           const void* cx,
+                                                           const void* w,
+                                                           void* y,
+                                                           void* hy,
+                                                           void* cy,
+                                                           void* workSpace,
+                                                           size_t workSpaceNumBytes);
+
+/*! @brief Executes the forward training pass of an RNN plan
+ *
+ * The buffers have the meaning they have for miopenRNNForwardTraining.
+ *
+ * @param handle                MIOpen handle the plan was created with (input)
+ * @param plan                  RNN plan (input)
+ * @param x                     Pointer to input tensor (input)
+ * @param hx                    Pointer to the hidden layer input tensor, may be NULL (input)
+ * @param cx                    Pointer to the cell layer input tensor, may be NULL (input)
+ * @param w                     Pointer to input weights tensor (input)
+ * @param y                     Pointer to output tensor (output)
+ * @param hy                    Pointer to the hidden layer output tensor, may be NULL (output)
+ * @param cy                    Pointer to the cell layer output tensor, may be NULL (output)
+ * @param workSpace             Pointer to memory allocated for the pass (input)
+ * @param workSpaceNumBytes     Number of allocated bytes in memory for the workspace (input)
+ * @param reserveSpace          Pointer to memory allocated for the backward passes (input)
+ * @param reserveSpaceNumBytes  Number of allocated bytes in memory for the reserve space (input)
+ * @return                      miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenRNNPlanForwardTraining(miopenHandle_t handle,
+                                                          miopenRNNPlan_t plan,
+                                                          const void* x,
+                                                          const void* hx,
+                                                          const void* cx,
+                                                          const void* w,
+                                                          void* y,
+                                                          void* hy,
+                                                          void* cy,
+                                                          void* workSpace,
+                                                          size_t workSpaceNumBytes,
+                                                          void* reserveSpace,
+                                                          size_t reserveSpaceNumBytes);
+
+/*! @brief Executes the backward data pass of an RNN plan
+ *
+ * The buffers have the meaning they have for miopenRNNBackwardData.
+ *
+ * @param handle                MIOpen handle the plan was created with (input)
+ * @param plan                  RNN plan (input)
+ * @param y                     Pointer to the output tensor of the forward pass (input)
+ * @param dy                    Pointer to the output gradient tensor (input)
+ * @param dhy                   Pointer to the hidden output gradient tensor, may be NULL (input)
+ * @param dcy                   Pointer to the cell output gradient tensor, may be NULL (input)
+ * @param w                     Pointer to input weights tensor (input)
+ * @param hx                    Pointer to the hidden layer input tensor, may be NULL (input)
+ * @param cx                    Pointer to the cell layer input tensor, may be NULL (input)
+ * @param dx                    Pointer to the input gradient tensor (output)
+ * @param dhx                   Pointer to the hidden input gradient tensor, may be NULL (output)
+ * @param dcx                   Pointer to the cell input gradient tensor, may be NULL (output)
+ * @param workSpace             Pointer to memory allocated for the pass (input)
+ * @param workSpaceNumBytes     Number of allocated bytes in memory for the workspace (input)
+ * @param reserveSpace          Reserve space written by the forward training pass (input / output)
+ * @param reserveSpaceNumBytes  Number of allocated bytes in memory for the reserve space (input)
+ * @return                      miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenRNNPlanBackwardData(miopenHandle_t handle,
+                                                       miopenRNNPlan_t plan,
+                                                       const void* y,
+                                                       const void* dy,
+                                                       const void* dhy,
+                                                       const void* dcy,
+                                                       const void* w,
+                                                       const void* hx,
+                                                       const void* cx,
+                                                       void* dx,
+                                                       void* dhx,
+                                                       void* dcx,
+                                                       void* workSpace,
+                                                       size_t workSpaceNumBytes,
+                                                       void* reserveSpace,
+                                                       size_t reserveSpaceNumBytes);
+
+/*! @brief Executes the backward weights pass of an RNN plan
+ *
+ * The buffers have the meaning they have for miopenRNNBackwardWeights.
+ *
+ * @param handle                MIOpen handle the plan was created with (input)
+ * @param plan                  RNN plan (input)
+ * @param x                     Pointer to input tensor (input)
+ * @param hx                    Pointer to the hidden layer input tensor, may be NULL (input)
+ * @param y                     Pointer to the output tensor (input)
+ * @param dw                    Pointer to the weights gradient tensor (input / output)
+ * @param workSpace             Pointer to memory allocated for the pass (input)
+ * @param workSpaceNumBytes     Number of allocated bytes in memory for the workspace (input)
+ * @param reserveSpace          Reserve space written by the forward training pass (input)
+ * @param reserveSpaceNumBytes  Number of allocated bytes in memory for the reserve space (input)
+ * @return                      miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenRNNPlanBackwardWeights(miopenHandle_t handle,
+                                                          miopenRNNPlan_t plan,
+                                                          const void* x,
+                                                          const void* hx,
+                                                          const void* y,
+                                                          void* dw,
+                                                          void* workSpace,
+                                                          size_t workSpaceNumBytes,
+                                                          const void* reserveSpace,
+                                                          size_t reserveSpaceNumBytes);
+
+/*! @brief Destroys an RNN plan
+ *
+ * @param plan           RNN plan to destroy (input)
+ * @return               miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenDestroyRNNPlan(miopenRNNPlan_t plan);
+
+/*! @brief Creates an RNN plan for a batch of variable-length sequences
+ *
+ * The sequences are packed one after another without padding: the input tensor has one row per
+ * time step of every sequence, the rows of sequence b starting after the rows of the sequences
+ * before it, and the output tensor has the same rows. The hidden and cell states have one row per
+ * sequence, in the order of the sequences, and sequences of length 0 are allowed.
+ *
+ * The RNN needs the sequences time-major with a batch size that never increases from one time step
+ * to the next. The plan sorts the sequences by decreasing length (ties keep their order), creates
+ * an RNN plan (see miopenCreateRNNPlan) for the resulting batch sizes, and uploads the indices of
+ * the reordering. Executing it gathers every input into the sorted order with one launch,
+ * executes the RNN plan and gathers every output back the same way.
+ *
+ * @param handle         MIOpen handle (input)
+ * @param plan           Pointer to the packed RNN plan (output)
+ * @param rnnDesc        RNN layer descriptor (input)
+ * @param batchSize      Number of sequences (input)
+ * @param lengths        Array of the batchSize sequence lengths (input)
+ * @param xDesc          Packed 2-D input tensor descriptor: total length by input size (input)
+ * @param hxDesc         Hidden state tensor descriptor, with batchSize rows per layer (input)
+ * @param wDesc          Weights tensor descriptor (input)
+ * @param yDesc          Packed 2-D output tensor descriptor: total length by output size (input)
+ * @return               miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenCreateRNNPackedPlan(miopenHandle_t handle,
+                                                       miopenRNNPackedPlan_t* plan,
+                                                       const miopenRNNDescriptor_t rnnDesc,
+                                                       const int batchSize,
+                                                       const int* lengths,
+                                                       const miopenTensorDescriptor_t xDesc,
+                                                       const miopenTensorDescriptor_t hxDesc,
+                                                       const miopenTensorDescriptor_t wDesc,
+                                                       const miopenTensorDescriptor_t yDesc);
+
+/*! @brief Query the workspace size required to execute a packed RNN plan
+ *
+ * The workspace holds the sorted copies of the buffers as well as the workspace of the RNN.
+ *
+ * @param plan           Packed RNN plan (input)
+ * @param numBytes       Pointer to memory to return size in bytes (output)
+ * @return               miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenRNNPackedPlanGetWorkSpaceSize(miopenRNNPackedPlan_t plan,
+                                                                 size_t* numBytes);
+
+/*! @brief Executes the forward inference pass of a packed RNN plan
+ *
+ * The buffers have the meaning they have for miopenRNNForwardInference, except that x and y hold
+ * packed sequences and the states are in the order of the sequences.
+ *
+ * @param handle             MIOpen handle the plan was created with (input)
+ * @param plan               Packed RNN plan (input)
+ * @param x                  Pointer to the packed input sequences (input)
+ * @param hx                 Pointer to the hidden layer input tensor, may be NULL (input)
+ * @param cx                 Pointer to the cell layer input tensor, may be NULL (input)
+ * @param w                  Pointer to input weights tensor (input)
+ * @param y                  Pointer to the packed output sequences (output)
+ * @param hy                 Pointer to the hidden layer output tensor, may be NULL (output)
+ * @param cy                 Pointer to the cell layer output tensor, may be NULL (output)
+ * @param workSpace          Pointer to memory allocated for the pass (input)
+ * @param workSpaceNumBytes  Number of allocated bytes in memory for the workspace (input)
+ * @return                   miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenRNNPackedPlanForwardInference(miopenHandle_t handle,
+                                                                 miopenRNNPackedPlan_t plan,
+                                                                 const void* x,
+                                                                 const void* hx,
+                                                                 const void* cx,
+                                                                 const void* w,
+                                                                 void* y,
+                                                                 void* hy,
+                                                                 void* cy,
+                                                                 void* workSpace,
+                                                                 size_t workSpaceNumBytes);
+
+/*! @brief Destroys a packed RNN plan
+ *
+ * @param plan           Packed RNN plan to destroy (input)
+ * @return               miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenDestroyRNNPackedPlan(miopenRNNPackedPlan_t plan);
+
 /** @} */
 // CLOSEOUT RNN DOXYGEN GROUP
 
@@ -4633,6 +5234,63 @@ miopenReduceTensor(miopenHandle_t handle,
                    const miopenTensorDescriptor_t cDesc,
                    void* C);
 
+/*! @brief Helper function to query the minimum workspace size required by the
+ * ReduceTensorMulti call
+ *
+ * @param handle                   MIOpen Handle (input)
+ * @param reduceTensorDescCount    Number of ReduceTensor descriptors, from 1 to 4 (input)
+ * @param reduceTensorDescs        Array of ReduceTensor descriptor objects (input)
+ * @param aDesc                    Pointer to the input tensor descriptor (input)
+ * @param cDesc                    Pointer to the output tensor descriptor (input)
+ * @param sizeInBytes              Pointer to data to return the minimum workspace size
+ * @return           miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t
+miopenGetReductionMultiWorkspaceSize(miopenHandle_t handle,
+                                     int reduceTensorDescCount,
+                                     const miopenReduceTensorDescriptor_t* reduceTensorDescs,
+                                     const miopenTensorDescriptor_t aDesc,
+                                     const miopenTensorDescriptor_t cDesc,
+                                     size_t* sizeInBytes);
+
+/*! @brief TensorReduce function doing several reductions of tensor A in one pass by implementing
+ * C[i] = alpha * reduceOp[i](A) + beta * C[i]
+ *
+ * All reductions use the same dimensions, given by cDesc as for miopenReduceTensor, and the same
+ * alpha and beta. For example the sum, the 2-norm and the maximum of every channel can be
+ * computed while A is read only once. The reductions cannot produce indices. Half, float and
+ * bfloat16 tensors are reduced in a single pass with float accumulation; other types are reduced
+ * one operation at a time.
+ *
+ * @param handle                   MIOpen Handle (input)
+ * @param reduceTensorDescCount    Number of ReduceTensor descriptors and outputs, from 1 to 4
+ * (input)
+ * @param reduceTensorDescs        Array of ReduceTensor descriptor objects (input)
+ * @param workspace                Address of the allocated workspace data (input)
+ * @param workspaceSizeInBytes     Size in bytes of the allocated workspace data (input)
+ * @param alpha                    Pointer to scale factor for data in input tensor A (input)
+ * @param aDesc                    Pointer to the tensor descriptor for input tensor A (input)
+ * @param A                        Pointer to the data of input tensor A (input)
+ * @param beta                     Pointer to scale factor for data in output tensors C (input)
+ * @param cDesc                    Pointer to the tensor descriptor shared by output tensors C
+ * (input)
+ * @param C                        Array of pointers to the data of output tensors C, one per
+ * descriptor (output)
+ * @return           miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t
+miopenReduceTensorMulti(miopenHandle_t handle,
+                        int reduceTensorDescCount,
+                        const miopenReduceTensorDescriptor_t* reduceTensorDescs,
+                        void* workspace,
+                        size_t workspaceSizeInBytes,
+                        const void* alpha,
+                        const miopenTensorDescriptor_t aDesc,
+                        const void* A,
+                        const void* beta,
+                        const miopenTensorDescriptor_t cDesc,
+                        void* const* C);
+
 /** @} */
 // CLOSEOUT TensorReduce DOXYGEN GROUP
 
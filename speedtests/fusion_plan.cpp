@@ -0,0 +1,155 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/fusion_plan.hpp>
+#include <miopen/miopen.h>
+#include <miopen/tensor.hpp>
+
+#include <driver.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Measures how many fusion plans can be created per second, i.e. the host cost of appending
+// operators to a plan and matching them against the metadata graph. The input shape changes
+// from one plan to the next, as it does when plans are created per request.
+
+namespace miopen {
+
+struct FusionPlanSpeedTest : public test_driver
+{
+    FusionPlanSpeedTest()
+    {
+        add(iterations, "iterations");
+        add(op_str, "op");
+    }
+
+    void run()
+    {
+        if(op_str == "all" || op_str == "cba")
+            ConvBiasActiv();
+        if(op_str == "all" || op_str == "cbna")
+            ConvBiasBNActiv();
+        if(op_str == "all" || op_str == "bna")
+            BNActiv();
+    }
+
+    void show_help()
+    {
+        test_driver::show_help();
+        std::cout << "Permitted ops: all, cba, cbna, bna" << std::endl;
+    }
+
+    private:
+    int iterations     = 100000;
+    std::string op_str = "all";
+
+    template <class F>
+    void Measure(const std::string& name, F f) const
+    {
+        std::size_t dead_code_saver = 0;
+
+        const auto start = std::chrono::steady_clock::now();
+        for(auto i = 0; i < iterations; i++)
+            dead_code_saver += f(i);
+        const auto time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                              std::chrono::steady_clock::now() - start)
+                              .count();
+
+        std::cout << name << ": " << static_cast<double>(time) / iterations << " ns per plan, "
+                  << 1e9 * iterations / static_cast<double>(time) << " plans per second"
+                  << std::endl;
+
+        // required in release builds
+        if(dead_code_saver == static_cast<std::size_t>(-1))
+            std::cout << dead_code_saver << std::endl;
+    }
+
+    static std::vector<TensorDescriptor> MakeInputs()
+    {
+        std::vector<TensorDescriptor> inputs;
+        for(std::size_t n : {1, 8, 32})
+            for(std::size_t hw : {7, 14, 28, 56})
+                inputs.emplace_back(miopenFloat, std::vector<std::size_t>{n, 64, hw, hw});
+        return inputs;
+    }
+
+    void ConvBiasActiv() const
+    {
+        const auto inputs = MakeInputs();
+        auto weights      = TensorDescriptor{miopenFloat, {64, 64, 3, 3}};
+        auto bias         = TensorDescriptor{miopenFloat, {1, 64, 1, 1}};
+        auto conv         = ConvolutionDescriptor{{1, 1}, {1, 1}, {1, 1}};
+        Measure("Conv + Bias + Activ", [&](int i) {
+            FusionPlanDescriptor plan(miopenVerticalFusion, inputs[i % inputs.size()]);
+            miopenFusionOpDescriptor_t op;
+            miopenCreateOpConvForward(&plan, &op, &conv, &weights);
+            miopenCreateOpBiasForward(&plan, &op, &bias);
+            miopenCreateOpActivationForward(&plan, &op, miopenActivationRELU);
+            return static_cast<std::size_t>(plan.isValid());
+        });
+    }
+
+    void ConvBiasBNActiv() const
+    {
+        const auto inputs = MakeInputs();
+        auto weights      = TensorDescriptor{miopenFloat, {64, 64, 1, 1}};
+        auto bias         = TensorDescriptor{miopenFloat, {1, 64, 1, 1}};
+        auto bn           = TensorDescriptor{miopenFloat, {1, 64, 1, 1}};
+        auto conv         = ConvolutionDescriptor{{0, 0}, {1, 1}, {1, 1}};
+        Measure("Conv + Bias + BN + Activ", [&](int i) {
+            FusionPlanDescriptor plan(miopenVerticalFusion, inputs[i % inputs.size()]);
+            miopenFusionOpDescriptor_t op;
+            miopenCreateOpConvForward(&plan, &op, &conv, &weights);
+            miopenCreateOpBiasForward(&plan, &op, &bias);
+            miopenCreateOpBatchNormInference(&plan, &op, miopenBNSpatial, &bn);
+            miopenCreateOpActivationForward(&plan, &op, miopenActivationRELU);
+            return static_cast<std::size_t>(plan.isValid());
+        });
+    }
+
+    void BNActiv() const
+    {
+        const auto inputs = MakeInputs();
+        auto bn           = TensorDescriptor{miopenFloat, {1, 64, 1, 1}};
+        Measure("BN + Activ", [&](int i) {
+            FusionPlanDescriptor plan(miopenVerticalFusion, inputs[i % inputs.size()]);
+            miopenFusionOpDescriptor_t op;
+            miopenCreateOpBatchNormInference(&plan, &op, miopenBNSpatial, &bn);
+            miopenCreateOpActivationForward(&plan, &op, miopenActivationRELU);
+            return static_cast<std::size_t>(plan.isValid());
+        });
+    }
+};
+
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::FusionPlanSpeedTest>(argc, argv);
+    return 0;
+}
@@ -0,0 +1,188 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/miopen.h>
+#include <miopen/tensor.hpp>
+
+#include <driver.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Measures the host overhead of the tensor descriptor operations that every API call goes
+// through: creating, copying and comparing descriptors and deriving their layouts.
+
+namespace miopen {
+
+struct TensorDescriptorSpeedTest : public test_driver
+{
+    TensorDescriptorSpeedTest()
+    {
+        add(iterations, "iterations");
+        add(op_str, "op");
+    }
+
+    void run()
+    {
+        if(op_str == "all" || op_str == "api")
+            Api();
+        if(op_str == "all" || op_str == "create")
+            Create();
+        if(op_str == "all" || op_str == "copy")
+            Copy();
+        if(op_str == "all" || op_str == "compare")
+            Compare();
+        if(op_str == "all" || op_str == "layout")
+            Layout();
+        if(op_str == "all" || op_str == "problem")
+            Problem();
+    }
+
+    void show_help()
+    {
+        test_driver::show_help();
+        std::cout << "Permitted ops: all, api, create, copy, compare, layout, problem" << std::endl;
+    }
+
+    private:
+    int iterations     = 1000000;
+    std::string op_str = "all";
+
+    template <class F>
+    void Measure(const std::string& name, F f) const
+    {
+        std::size_t dead_code_saver = 0;
+
+        const auto start = std::chrono::steady_clock::now();
+        for(auto i = 0; i < iterations; i++)
+            dead_code_saver += f(i);
+        const auto time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                              std::chrono::steady_clock::now() - start)
+                              .count();
+
+        std::cout << name << ": " << static_cast<double>(time) / iterations << " ns per call"
+                  << std::endl;
+
+        // required in release builds
+        if(dead_code_saver == static_cast<std::size_t>(-1))
+            std::cout << dead_code_saver << std::endl;
+    }
+
+    void Api() const
+    {
+        miopenTensorDescriptor_t desc;
+        miopenCreateTensorDescriptor(&desc);
+        int lens[]    = {32, 64, 56, 56};
+        int strides[] = {200704, 1, 3584, 64};
+        Measure("miopenSetTensorDescriptor", [&](int i) {
+            miopenSetTensorDescriptor(desc, miopenFloat, 4, lens, (i % 2) != 0 ? strides : nullptr);
+            return deref(desc).GetElementSize();
+        });
+        miopenDestroyTensorDescriptor(desc);
+    }
+
+    void Create() const
+    {
+        Measure("TensorDescriptor(lens)", [](int i) {
+            const std::size_t w = 56 + (i & 1);
+            const auto desc     = TensorDescriptor{miopenFloat, {32, 64, 56, w}};
+            return desc.GetElementSpace();
+        });
+        Measure("TensorDescriptor(lens, strides)", [](int i) {
+            const std::size_t w_stride = 64 + (i & 1);
+            const auto desc =
+                TensorDescriptor{miopenFloat, {32, 64, 56, 56}, {200704, 1, 3584, w_stride}};
+            return desc.GetElementSpace();
+        });
+    }
+
+    void Copy() const
+    {
+        const auto descs = MakeDescriptors();
+        Measure("copy", [&](int i) {
+            const auto copy = descs[i % descs.size()];
+            return copy.GetLengths()[0];
+        });
+    }
+
+    void Compare() const
+    {
+        const auto descs = MakeDescriptors();
+        const auto other = MakeDescriptors();
+        Measure("operator== (equal)", [&](int i) {
+            return static_cast<std::size_t>(descs[i % descs.size()] == other[i % other.size()]);
+        });
+        // Only descriptors of the same rank may be compared.
+        const std::pair<std::size_t, std::size_t> pairs[] = {{0, 1}, {1, 3}, {3, 0}};
+        Measure("operator== (different)", [&](int i) {
+            const auto& p = pairs[i % 3];
+            return static_cast<std::size_t>(descs[p.first] == other[p.second]);
+        });
+    }
+
+    void Layout() const
+    {
+        const auto descs = MakeDescriptors();
+        Measure("GetLayout", [&](int i) {
+            const auto& desc = descs[i % descs.size()];
+            return desc.GetLayout(desc.GetSize() == 4 ? "NCHW" : "NCDHW").size();
+        });
+    }
+
+    void Problem() const
+    {
+        const auto x    = TensorDescriptor{miopenFloat, {32, 64, 56, 56}, {200704, 1, 3584, 64}};
+        const auto w    = TensorDescriptor{miopenFloat, {64, 64, 3, 3}, {576, 1, 192, 64}};
+        const auto y    = TensorDescriptor{miopenFloat, {32, 64, 56, 56}, {200704, 1, 3584, 64}};
+        const auto conv = ConvolutionDescriptor{{1, 1}, {1, 1}, {1, 1}};
+        Measure("conv::ProblemDescription", [&](int) {
+            const auto problem =
+                conv::ProblemDescription{x, w, y, conv, conv::Direction::Forward};
+            return problem.GetKey().hash;
+        });
+    }
+
+    static std::vector<TensorDescriptor> MakeDescriptors()
+    {
+        return {
+            {miopenFloat, {32, 64, 56, 56}},
+            {miopenFloat, {32, 64, 56, 56}, {200704, 1, 3584, 64}},
+            {miopenHalf, {16, 32, 8, 28, 28}},
+            {miopenFloat, {256, 1024, 1, 1}},
+        };
+    }
+};
+
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::TensorDescriptorSpeedTest>(argc, argv);
+    return 0;
+}
@@ -27,6 +27,7 @@
 #include <miopen/miopen_internal.h>
 
 #include <miopen/convolution.hpp>
+#include <miopen/convolution_plan.hpp>
 #include <miopen/errors.hpp>
 #include <miopen/find_controls.hpp>
 #include <miopen/handle.hpp>
@@ -1024,6 +1025,106 @@ miopenConvolutionBackwardWeightsImmediate(miopenHandle_t handle,
     });
 }
 
+static miopen::conv::Direction ToConvDirection(miopenConvDirection_t direction)
+{
+    switch(direction)
+    {
+    case miopenConvDirectionFwd: return miopen::conv::Direction::Forward;
+    case miopenConvDirectionBwdData: return miopen::conv::Direction::BackwardData;
+    case miopenConvDirectionBwdWeights: return miopen::conv::Direction::BackwardWeights;
+    }
+    MIOPEN_THROW(miopenStatusBadParm, "Invalid convolution direction");
+}
+
+static ConvDirection ToLogCmdDirection(miopenConvDirection_t direction)
+{
+    switch(direction)
+    {
+    case miopenConvDirectionFwd: return ConvDirection::Fwd;
+    case miopenConvDirectionBwdData: return ConvDirection::Bwd;
+    case miopenConvDirectionBwdWeights: return ConvDirection::WrW;
+    }
+    MIOPEN_THROW(miopenStatusBadParm, "Invalid convolution direction");
+}
+
+extern "C" miopenStatus_t miopenCreateConvolutionPlan(miopenHandle_t handle,
+                                                      miopenConvolutionPlan_t* plan,
+                                                      miopenConvDirection_t direction,
+                                                      const miopenTensorDescriptor_t xDesc,
+                                                      const miopenTensorDescriptor_t wDesc,
+                                                      const miopenConvolutionDescriptor_t convDesc,
+                                                      const miopenTensorDescriptor_t yDesc,
+                                                      const uint64_t solution_id)
+{
+    MIOPEN_LOG_FUNCTION(handle, plan, direction, xDesc, wDesc, convDesc, yDesc, solution_id);
+    return miopen::try_([&] {
+        LogCmdConvolution(xDesc, wDesc, convDesc, yDesc, ToLogCmdDirection(direction), true);
+        miopen::deref(plan) = new miopen::ConvolutionPlan(miopen::deref(handle),
+                                                          miopen::deref(convDesc),
+                                                          ToConvDirection(direction),
+                                                          miopen::deref(xDesc),
+                                                          miopen::deref(wDesc),
+                                                          miopen::deref(yDesc),
+                                                          solution_id);
+    });
+}
+
+extern "C" miopenStatus_t miopenConvolutionPlanGetWorkSpaceSize(miopenConvolutionPlan_t plan,
+                                                                size_t* workSpaceSize)
+{
+    MIOPEN_LOG_FUNCTION(plan, workSpaceSize);
+    return miopen::try_(
+        [&] { miopen::deref(workSpaceSize) = miopen::deref(plan).GetWorkspaceSize(); });
+}
+
+extern "C" miopenStatus_t miopenExecuteConvolutionPlan(miopenHandle_t handle,
+                                                       miopenConvolutionPlan_t plan,
+                                                       void* x,
+                                                       void* w,
+                                                       void* y,
+                                                       void* workSpace,
+                                                       size_t workSpaceSize)
+{
+    MIOPEN_LOG_FUNCTION(handle, plan, x, w, y, workSpace, workSpaceSize);
+    return miopen::try_([&] {
+        miopen::deref(plan).Execute(miopen::deref(handle),
+                                    DataCast(x),
+                                    DataCast(w),
+                                    DataCast(y),
+                                    DataCast(workSpace),
+                                    workSpaceSize);
+    });
+}
+
+extern "C" miopenStatus_t miopenExecuteConvolutionPlans(
+    miopenHandle_t handle, size_t count, const miopenConvolutionPlanLaunch_t* launches)
+{
+    MIOPEN_LOG_FUNCTION(handle, count);
+    return miopen::try_([&] {
+        if(count > 0 && launches == nullptr)
+            MIOPEN_THROW(miopenStatusBadParm, "Launches cannot be NULL");
+        auto plan_launches = std::vector<miopen::ConvolutionPlanLaunch>{};
+        plan_launches.reserve(count);
+        for(std::size_t i = 0; i < count; ++i)
+        {
+            const auto& launch = launches[i];
+            plan_launches.push_back({launch.plan == nullptr ? nullptr : &miopen::deref(launch.plan),
+                                     DataCast(launch.x),
+                                     DataCast(launch.w),
+                                     DataCast(launch.y),
+                                     DataCast(launch.workSpace),
+                                     launch.workSpaceSize});
+        }
+        miopen::ExecuteConvolutionPlans(miopen::deref(handle), plan_launches);
+    });
+}
+
+extern "C" miopenStatus_t miopenDestroyConvolutionPlan(miopenConvolutionPlan_t plan)
+{
+    MIOPEN_LOG_FUNCTION(plan);
+    return miopen::try_([&] { miopen_destroy_object(plan); });
+}
+
 extern "C" miopenStatus_t
 miopenFindConvolutionBackwardDataAlgorithm(miopenHandle_t handle,
                                            const miopenTensorDescriptor_t dyDesc,
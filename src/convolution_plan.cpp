@@ -0,0 +1,341 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/convolution_plan.hpp>
+
+#include <miopen/check_numerics.hpp>
+#include <miopen/conv/data_invoke_params.hpp>
+#include <miopen/conv/wrw_invoke_params.hpp>
+#include <miopen/convolution.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/logger.hpp>
+
+#include <boost/optional.hpp>
+
+#include <ostream>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
+namespace miopen {
+
+// Transposed convolutions run the solvers of the opposite data direction with the roles of x
+// and y exchanged, like the Immediate API does.
+static conv::Direction TransposedDirection(conv::Direction direction)
+{
+    switch(direction)
+    {
+    case conv::Direction::Forward: return conv::Direction::BackwardData;
+    case conv::Direction::BackwardData: return conv::Direction::Forward;
+    case conv::Direction::BackwardWeights: return conv::Direction::BackwardWeights;
+    }
+    MIOPEN_THROW(miopenStatusInternalError);
+}
+
+ConvolutionPlan::ConvolutionPlan(Handle& handle,
+                                 const ConvolutionDescriptor& conv,
+                                 conv::Direction direction_,
+                                 const TensorDescriptor& xDesc_,
+                                 const TensorDescriptor& wDesc_,
+                                 const TensorDescriptor& yDesc_,
+                                 solver::Id solver_id_)
+    : direction(conv.mode == miopenTranspose ? TransposedDirection(direction_) : direction_),
+      swap_x_y(conv.mode == miopenTranspose),
+      xDesc(swap_x_y ? yDesc_ : xDesc_),
+      wDesc(wDesc_),
+      yDesc(swap_x_y ? xDesc_ : yDesc_),
+      solver_id(solver_id_),
+      built_with(&handle),
+      check_numerics(CheckNumericsEnabled()),
+      conv_desc(std::make_shared<ConvolutionDescriptor>(conv))
+{
+    // The workspace queries also check that the solver is applicable, so they go first.
+    const auto& fp16alt = conv.attribute.gfx90aFp16alt;
+    switch(direction)
+    {
+    case conv::Direction::Forward: {
+        workspace_size =
+            conv.GetForwardSolutionWorkspaceSize(handle, wDesc, xDesc, yDesc, solver_id);
+        const auto params = conv::DataInvokeParams{
+            {xDesc, nullptr, wDesc, nullptr, yDesc, nullptr}, nullptr, 0, fp16alt.GetFwd()};
+        invoke_params = params;
+        break;
+    }
+    case conv::Direction::BackwardData: {
+        workspace_size =
+            conv.GetBackwardSolutionWorkspaceSize(handle, yDesc, wDesc, xDesc, solver_id);
+        const auto params = conv::DataInvokeParams{
+            {yDesc, nullptr, wDesc, nullptr, xDesc, nullptr}, nullptr, 0, fp16alt.GetBwd()};
+        invoke_params = params;
+        break;
+    }
+    case conv::Direction::BackwardWeights: {
+        workspace_size = conv.GetWrwSolutionWorkspaceSize(handle, yDesc, xDesc, wDesc, solver_id);
+        const auto params = conv::WrWInvokeParams{
+            {yDesc, nullptr, xDesc, nullptr, wDesc, nullptr}, nullptr, 0, fp16alt.GetWrW()};
+        invoke_params = params;
+        break;
+    }
+    }
+
+    invoker = conv.PrepareSolutionInvoker(handle, xDesc, wDesc, yDesc, direction, solver_id);
+}
+
+void ConvolutionPlan::ValidateHandle(const Handle& handle) const
+{
+    if(&handle != built_with)
+        MIOPEN_THROW(miopenStatusBadParm, "The plan was created with a different handle");
+}
+
+void ConvolutionPlan::ValidateBuffers(
+    Data_t x, Data_t w, Data_t y, Data_t workSpace, std::size_t workSpaceSize) const
+{
+    if(x == nullptr || w == nullptr || y == nullptr)
+        MIOPEN_THROW(miopenStatusBadParm, "Buffers cannot be NULL");
+    if(workSpaceSize < workspace_size || (workspace_size > 0 && workSpace == nullptr))
+        MIOPEN_THROW(miopenStatusBadParm, "Insufficient workspace");
+}
+
+void ConvolutionPlan::Execute(const Handle& handle,
+                              Data_t x,
+                              Data_t w,
+                              Data_t y,
+                              Data_t workSpace,
+                              std::size_t workSpaceSize)
+{
+    ValidateHandle(handle);
+    ValidateBuffers(x, w, y, workSpace, workSpaceSize);
+    Run(handle, x, w, y, workSpace, workSpaceSize);
+}
+
+void ConvolutionPlan::Run(const Handle& handle,
+                          Data_t x,
+                          Data_t w,
+                          Data_t y,
+                          Data_t workSpace,
+                          std::size_t workSpaceSize)
+{
+    if(swap_x_y)
+        std::swap(x, y);
+
+    // The output of each direction and its two inputs.
+    Data_t out                    = y;
+    const TensorDescriptor* oDesc = &yDesc;
+    if(direction == conv::Direction::BackwardWeights)
+    {
+        auto& params         = invoke_params.CastTo<conv::WrWInvokeParams>();
+        params.tensors.dy    = y;
+        params.tensors.x     = x;
+        params.tensors.dw    = w;
+        params.workSpace     = workSpace;
+        params.workSpaceSize = workSpaceSize;
+        out                  = w;
+        oDesc                = &wDesc;
+    }
+    else
+    {
+        const auto forward   = direction == conv::Direction::Forward;
+        auto& params         = invoke_params.CastTo<conv::DataInvokeParams>();
+        params.tensors.in    = forward ? x : y;
+        params.tensors.w     = w;
+        params.tensors.out   = forward ? y : x;
+        params.workSpace     = workSpace;
+        params.workSpaceSize = workSpaceSize;
+        out                  = params.tensors.out;
+        oDesc                = forward ? &yDesc : &xDesc;
+    }
+
+    if(check_numerics)
+    {
+        if(direction != conv::Direction::Forward)
+            checkNumericsInput(handle, yDesc, y);
+        if(direction != conv::Direction::BackwardData)
+            checkNumericsInput(handle, xDesc, x);
+        if(direction != conv::Direction::BackwardWeights)
+            checkNumericsInput(handle, wDesc, w);
+    }
+
+    invoker(handle, invoke_params);
+
+    if(check_numerics)
+        checkNumericsOutput(handle, *oDesc, out);
+}
+
+// The descriptor of count tensors of desc stored back to back, as one tensor with dimension dim
+// multiplied by count. The dimensions before dim have to be 1 and dim has to be the outermost
+// of the others.
+static boost::optional<TensorDescriptor>
+StackTensors(const TensorDescriptor& desc, std::size_t dim, std::size_t count)
+{
+    const auto& lens = desc.GetLengths();
+    if(!desc.IsPacked() || lens.size() <= dim)
+        return boost::none;
+    for(std::size_t i = 0; i < dim; ++i)
+    {
+        if(lens[i] != 1)
+            return boost::none;
+    }
+    auto strides = std::vector<std::size_t>(desc.GetStrides().begin(), desc.GetStrides().end());
+    if(strides[dim] * lens[dim] != desc.GetElementSize())
+        return boost::none;
+
+    auto stacked_lens = std::vector<std::size_t>(lens.begin(), lens.end());
+    stacked_lens[dim] *= count;
+    for(std::size_t i = 0; i < dim; ++i)
+        strides[i] = strides[dim] * stacked_lens[dim];
+    return TensorDescriptor{desc.GetType(), stacked_lens, strides};
+}
+
+std::size_t ConvolutionPlan::CountMergeable(
+    const std::vector<const ConvolutionPlanLaunch*>& launches, std::size_t first, Merge merge) const
+{
+#if MIOPEN_BACKEND_HIP
+    const auto follows = [](Data_t prev, Data_t next, std::size_t bytes) {
+        return static_cast<char*>(prev) + bytes == static_cast<char*>(next);
+    };
+    const auto x_bytes = xDesc.GetNumBytes();
+    const auto w_bytes = wDesc.GetNumBytes();
+    const auto y_bytes = yDesc.GetNumBytes();
+
+    auto count = std::size_t{1};
+    for(auto i = first + 1; i < launches.size(); ++i, ++count)
+    {
+        const auto& prev = *launches[i - 1];
+        const auto& next = *launches[i];
+        const auto w_ok  = merge == Merge::Batch ? prev.w == next.w
+                                                 : follows(prev.w, next.w, w_bytes);
+        if(!w_ok || !follows(prev.x, next.x, x_bytes) || !follows(prev.y, next.y, y_bytes))
+            break;
+    }
+    return count;
+#else
+    // Buffers are opaque objects, their placement cannot be compared.
+    std::ignore = launches;
+    std::ignore = first;
+    std::ignore = merge;
+    return 1;
+#endif
+}
+
+ConvolutionPlan* ConvolutionPlan::GetMerged(Handle& handle, Merge merge, std::size_t count)
+{
+    const auto key = std::make_pair(merge, count);
+    const auto it  = merged.find(key);
+    if(it != merged.end())
+        return it->second.get();
+
+    auto& plan = merged[key];
+    // The backward weights of a batch are reduced into one dw, and transposed convolutions
+    // would need the weights stacked along their second dimension.
+    if(swap_x_y || (merge == Merge::Batch && direction == conv::Direction::BackwardWeights))
+        return nullptr;
+
+    auto stacked_conv = *conv_desc;
+    auto x            = StackTensors(xDesc, merge == Merge::Batch ? 0 : 1, count);
+    auto y            = StackTensors(yDesc, merge == Merge::Batch ? 0 : 1, count);
+    auto w            = merge == Merge::Batch ? boost::make_optional(wDesc)
+                                              : StackTensors(wDesc, 0, count);
+    if(!x || !y || !w)
+        return nullptr;
+    if(merge == Merge::Group)
+        stacked_conv.group_count *= static_cast<int>(count);
+
+    try
+    {
+        plan = std::make_unique<ConvolutionPlan>(
+            handle, stacked_conv, direction, *x, *w, *y, solver_id);
+    }
+    catch(const Exception& ex)
+    {
+        MIOPEN_LOG_I2("Launches of " << *this << " are not merged: " << ex.what());
+    }
+    return plan.get();
+}
+
+void ConvolutionPlan::ExecuteMany(Handle& handle,
+                                  const std::vector<const ConvolutionPlanLaunch*>& launches)
+{
+    for(std::size_t i = 0; i < launches.size();)
+    {
+        const auto& launch       = *launches[i];
+        auto count               = std::size_t{1};
+        ConvolutionPlan* stacked = nullptr;
+        for(const auto merge : {Merge::Batch, Merge::Group})
+        {
+            // Runs are merged in power of two parts, the rest is merged by the next iterations,
+            // so that at most one plan per power of two is built, whatever the batch sizes.
+            auto mergeable = CountMergeable(launches, i, merge);
+            while((mergeable & (mergeable - 1)) != 0)
+                mergeable &= mergeable - 1;
+            if(mergeable < 2)
+                continue;
+            stacked = GetMerged(handle, merge, mergeable);
+            if(stacked != nullptr && stacked->workspace_size <= launch.workSpaceSize)
+            {
+                count = mergeable;
+                break;
+            }
+            stacked = nullptr;
+        }
+
+        if(stacked != nullptr)
+            stacked->Run(
+                handle, launch.x, launch.w, launch.y, launch.workSpace, launch.workSpaceSize);
+        else
+            Run(handle, launch.x, launch.w, launch.y, launch.workSpace, launch.workSpaceSize);
+        i += count;
+    }
+}
+
+void ExecuteConvolutionPlans(Handle& handle, const std::vector<ConvolutionPlanLaunch>& launches)
+{
+    std::vector<ConvolutionPlan*> plans;
+    std::unordered_map<const ConvolutionPlan*, std::vector<const ConvolutionPlanLaunch*>> by_plan;
+    for(const auto& launch : launches)
+    {
+        if(launch.plan == nullptr)
+            MIOPEN_THROW(miopenStatusBadParm, "Plan cannot be NULL");
+        launch.plan->ValidateHandle(handle);
+        launch.plan->ValidateBuffers(
+            launch.x, launch.w, launch.y, launch.workSpace, launch.workSpaceSize);
+        auto& plan_launches = by_plan[launch.plan];
+        if(plan_launches.empty())
+            plans.push_back(launch.plan);
+        plan_launches.push_back(&launch);
+    }
+
+    for(auto* plan : plans)
+        plan->ExecuteMany(handle, by_plan.at(plan));
+}
+
+std::ostream& operator<<(std::ostream& stream, const ConvolutionPlan& plan)
+{
+    stream << "solver_id: " << plan.solver_id.ToString() << ", workspace: " << plan.workspace_size;
+    return stream;
+}
+
+} // namespace miopen
@@ -123,6 +123,18 @@ miopenFusionPlanConvolutionSetAlgo(miopenFusionPlanDescriptor_t fusePlanDesc,
     return res;
 }
 
+extern "C" miopenStatus_t
+miopenFusionPlanConvolutionSetExhaustiveSearch(miopenFusionPlanDescriptor_t fusePlanDesc,
+                                               bool exhaustiveSearch)
+{
+    MIOPEN_LOG_FUNCTION(fusePlanDesc, exhaustiveSearch);
+    miopenStatus_t res = miopenStatusUnknownError;
+    miopen::try_([&] {
+        res = miopen::deref(fusePlanDesc).SetConvExhaustiveSearch(exhaustiveSearch);
+    });
+    return res;
+}
+
 // Create convolution ops with unknown algorithms
 extern "C" miopenStatus_t miopenCreateOpConvForward(miopenFusionPlanDescriptor_t fusePlanDesc,
                                                     miopenFusionOpDescriptor_t* convOp,
@@ -31,14 +31,20 @@
 #include <miopen/handle.hpp>
 #include <miopen/visit_float.hpp>
 #include <miopen/stringutils.hpp>
+#include <miopen/env.hpp>
 #include <ostream>
 #include <ios>
 #include <algorithm>
 #include <string>
+#include <cstring>
+#include <memory>
 #include <half.hpp>
 
 namespace miopen {
 
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_FUSION_PARTITIONING)
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_FUSION_PLAN_CACHE)
+
 FusionPlanDescriptor::FusionPlanDescriptor(const miopenFusionDirection_t dir,
                                            const TensorDescriptor& inDesc)
     : fusion_dir(dir),
@@ -58,12 +64,20 @@ FusionPlanDescriptor::~FusionPlanDescriptor() { op_map.clear(); }
 
 miopenStatus_t FusionPlanDescriptor::AddOp(std::shared_ptr<FusionOpDescriptor> desc)
 {
-    // load the md graph for the first op
-    if(op_count == 0)
-    {
-        FusionMDGraph::Init(lu, desc->kind());
-    }
     desc->SetIdx(op_count);
+    AppendOp(desc);
+    if(is_valid)
+        return miopenStatusSuccess;
+    // Compile() can still run the operator as a part of a partitioned plan
+    if(!miopen::IsDisabled(MIOPEN_DEBUG_FUSION_PARTITIONING{}) && desc->IsStandaloneSupported())
+        return miopenStatusSuccess;
+    return miopenStatusUnsupportedOp;
+}
+
+// Appends the operator without renumbering it, so that the plans of the segments of a
+// partitioned plan use the same argument keys as the whole plan.
+void FusionPlanDescriptor::AppendOp(std::shared_ptr<FusionOpDescriptor> desc)
+{
     if(op_map.empty())
         desc->SetInputDesc(input_desc);
     else
@@ -71,7 +85,15 @@ miopenStatus_t FusionPlanDescriptor::AddOp(std::shared_ptr<FusionOpDescriptor> d
     desc->GetOutputDesc(output_desc);
     op_map.emplace_back(desc);
     op_count++;
+
+    // Once the sequence is not supported by the metadata graph it cannot become supported
+    if(op_count > 1 && !is_valid)
+        return;
     is_valid = false;
+    // load the md graph for the first op, Activ and Bias can not start a fused kernel
+    if(op_count == 1 &&
+       miopen::try_([&] { FusionMDGraph::Init(lu, desc->kind()); }, false) != miopenStatusSuccess)
+        return;
     miopen::try_([&] {
         is_valid = lu.Advance(desc, [&](const std::string& sym, int& val) -> bool {
             // check tensor attr
@@ -89,10 +111,6 @@ miopenStatus_t FusionPlanDescriptor::AddOp(std::shared_ptr<FusionOpDescriptor> d
             return false;
         });
     });
-    if(is_valid)
-        return miopenStatusSuccess;
-    else
-        return miopenStatusUnsupportedOp;
 }
 
 miopenStatus_t FusionPlanDescriptor::GetOp(int op_idx, std::shared_ptr<FusionOpDescriptor>& desc)
@@ -177,6 +195,26 @@ miopenStatus_t FusionPlanDescriptor::SetConvAlgo(miopenConvFwdAlgorithm_t algo)
         return miopenStatusUnknownError;
 }
 
+miopenStatus_t FusionPlanDescriptor::SetConvExhaustiveSearch(bool exhaustive_search)
+{
+    auto found = false;
+    for(auto&& op : op_map)
+    {
+        if(op->kind() != miopenFusionOpConvForward)
+            continue;
+        std::static_pointer_cast<ConvForwardOpDescriptor>(op)->exhaustive_search =
+            exhaustive_search;
+        found = true;
+    }
+    if(!found)
+    {
+        MIOPEN_LOG_I("The fusion plan has no convolution operator to tune");
+        return miopenStatusBadParm;
+    }
+    conv_exhaustive_search = exhaustive_search;
+    return miopenStatusSuccess;
+}
+
 std::ostream& operator<<(std::ostream& stream, const FusionPlanDescriptor& fpd)
 {
     stream << "kernel_name: " << fpd.kernel_name;
@@ -450,6 +488,7 @@ std::vector<std::pair<std::string, OpKernelArg>> ActivBwdFusionOpDescriptor::Get
         keys.emplace_back("activAlpha" + id, OpKernelArg(a));
         keys.emplace_back("activBeta" + id, OpKernelArg(a));
         keys.emplace_back("activGamma" + id, OpKernelArg(a));
+        keys.emplace_back("activDiffScale" + id, OpKernelArg(a));
     }
     else if(input_desc.GetType() == miopenHalf)
     {
@@ -457,8 +496,8 @@ std::vector<std::pair<std::string, OpKernelArg>> ActivBwdFusionOpDescriptor::Get
         keys.emplace_back("activAlpha" + id, OpKernelArg(a));
         keys.emplace_back("activBeta" + id, OpKernelArg(a));
         keys.emplace_back("activGamma" + id, OpKernelArg(a));
+        keys.emplace_back("activDiffScale" + id, OpKernelArg(a));
     }
-    keys.emplace_back("activDiffScale" + id, OpKernelArg(nullptr));
     keys.emplace_back("y" + id, OpKernelArg(nullptr));
     keys.emplace_back("x" + id, OpKernelArg(nullptr));
     return keys;
@@ -976,16 +1015,116 @@ OpKernelArg FusionPlanDescriptor::GetDevAttribute(const std::string& k, const Ha
     }
 }
 
+// Places the arguments one after another, each aligned to its own size, which is how
+// HIPOCKernelInvoke packs a list of OpKernelArg.
+template <class SizeOf>
+static FusionArgLayout MakeArgLayout(const std::vector<Exec_arg_t>& args, SizeOf size_of)
+{
+    FusionArgLayout layout;
+    std::size_t end = 0;
+    for(const auto& arg : args)
+    {
+        const std::size_t size   = size_of(arg);
+        const std::size_t offset = (end + size - 1) / size * size;
+        const std::size_t idx    = layout.slots.size();
+        const bool is_ptr =
+            arg.type == Input_Ptr || arg.type == Output_Ptr || arg.type == Pointer;
+        layout.slots.push_back({offset, size, is_ptr});
+        end = offset + size;
+
+        switch(arg.type)
+        {
+        case Input_Ptr: layout.input_slots.push_back(idx); break;
+        case Output_Ptr: layout.output_slots.push_back(idx); break;
+        case Scalar:
+        case Pointer: layout.op_slots.emplace(arg.key, idx); break;
+        case Padding:
+        case Default: break;
+        }
+    }
+
+    layout.block.resize(end, 0);
+    for(std::size_t idx = 0; idx < args.size(); idx++)
+    {
+        if(args[idx].type == Default)
+        {
+            const auto& val = args[idx].val.buffer;
+            std::copy(val.begin(), val.end(), layout.block.begin() + layout.slots[idx].offset);
+        }
+    }
+    return layout;
+}
+
 miopenStatus_t FusionPlanDescriptor::Compile(Handle& handle)
 {
-    miopenStatus_t status = miopenStatusUnknownError;
-    if(!isValid() || (lu.GetCurVertex(handle) == nullptr))
+    segments.clear();
+    compiled = nullptr;
+    const auto partitioning = !miopen::IsDisabled(MIOPEN_DEBUG_FUSION_PARTITIONING{});
+    if(isValid() && (lu.GetCurVertex(handle) != nullptr))
+    {
+        const auto status = CompileFused(handle);
+        if(status == miopenStatusSuccess || !partitioning)
+            return status;
+    }
+    else if(!partitioning)
     {
         MIOPEN_LOG_I2(
             "A previous attempt to add an operator unsuccessful or the GPU architecture is not "
             "supported for the fusion plan");
         MIOPEN_THROW(miopenStatusBadParm);
     }
+    return CompilePartitioned(handle);
+}
+
+FusionPlanKey FusionPlanDescriptor::GetPlanKey() const
+{
+    FusionPlanKey key;
+    key.Append(fusion_dir);
+    key.Append(input_desc);
+    key.Append(output_desc);
+    for(const auto& op : op_map)
+    {
+        key.Append(op->kind());
+        key.Append(op->GetIdx());
+        op->GetPlanKey(key);
+    }
+    // The kernels still matching the plan, this also covers the algorithm set by SetConvAlgo()
+    for(const auto& kinder : lu.cur_vertex)
+    {
+        const auto& path = kinder.second;
+        key.Append(kinder.first->graph_idx);
+        key.Append(path.weight);
+        key.Append(path.algo ? *path.algo + 1 : 0);
+        key.Append(path.solver.IsEmpty() ? 0 : path.solver.Type().hash_code());
+    }
+    return key;
+}
+
+miopenStatus_t FusionPlanDescriptor::CompileFused(Handle& handle)
+{
+    const auto use_cache = !miopen::IsDisabled(MIOPEN_DEBUG_FUSION_PLAN_CACHE{});
+    const auto key       = use_cache ? GetPlanKey() : FusionPlanKey{};
+    // A tuning run builds the kernel again and replaces the cached plan
+    if(use_cache && !conv_exhaustive_search)
+    {
+        if(const auto cached = handle.fusion_plans.Find(key))
+        {
+            MIOPEN_LOG_I2("Reusing the compiled fusion plan " << cached->algorithm_name << ','
+                                                              << cached->network_config);
+            lu.cur_vertex      = cached->vertices;
+            kernel_source_type = cached->kernel_source_type;
+            program_name       = cached->program_name;
+            kernel_name        = cached->kernel_name;
+            algorithm_name     = cached->algorithm_name;
+            network_config     = cached->network_config;
+            arg_list           = cached->arg_list;
+            arg_layout         = cached->arg_layout;
+            compiled           = cached;
+            return miopenStatusSuccess;
+        }
+    }
+
+    miopenStatus_t status = miopenStatusUnknownError;
     network_config =
         input_desc.ToString() + ((input_desc.GetType() == miopenHalf) ? "FP16" : "FP32");
     network_config +=
@@ -1015,8 +1154,10 @@ miopenStatus_t FusionPlanDescriptor::Compile(Handle& handle)
     else
         kernel_source_type = OpenclText;
 
+    // The network config does not include the performance parameters of the kernel, so
+    // a kernel built before tuning must not be reused.
     auto&& kernels = handle.GetKernels(algorithm_name, network_config);
-    if(!kernels.empty())
+    if(!kernels.empty() && !conv_exhaustive_search)
     {
         status = miopenStatusSuccess;
     }
@@ -1026,7 +1167,7 @@ miopenStatus_t FusionPlanDescriptor::Compile(Handle& handle)
         std::string compile_config;
         auto success = true;
         // lu.cur_vertex is sorted according to the weights from MDGraph::Advance method
-        std::vector<std::pair<MDGraph_vertex_ptr, cur_vertex_map>> new_list;
+        std::vector<std::pair<MDGraph_vertex_ptr, MDGraph_path>> new_list;
         for(auto& kinder : lu.cur_vertex)
         {
             if(kinder.first == nullptr)
@@ -1036,11 +1177,7 @@ miopenStatus_t FusionPlanDescriptor::Compile(Handle& handle)
             }
 
             success = true;
-            solver::AnySolver sol;
-            if(kinder.second.find("solver") != kinder.second.end())
-            {
-                sol = boost::any_cast<solver::AnySolver>(kinder.second.at("solver"));
-            }
+            const solver::AnySolver& sol = kinder.second.solver;
             program_name = kinder.first->vertex_data.at("program");
             auto d       = handle.GetDeviceName();
 
@@ -1090,7 +1227,7 @@ miopenStatus_t FusionPlanDescriptor::Compile(Handle& handle)
         {
             lu.cur_vertex   = new_list;
             auto&& kernels2 = handle.GetKernels(algorithm_name, network_config);
-            if(!kernels2.empty())
+            if(!kernels2.empty() && !conv_exhaustive_search)
             {
                 status = miopenStatusSuccess;
             }
@@ -1133,7 +1270,27 @@ miopenStatus_t FusionPlanDescriptor::Compile(Handle& handle)
             return status;
         }
     }
-    arg_list = CalcArgOrder(handle);
+    arg_list   = CalcArgOrder(handle);
+    arg_layout = std::make_shared<const FusionArgLayout>(MakeArgLayout(
+        arg_list, [](const Exec_arg_t& arg) { return static_cast<std::size_t>(arg.size); }));
+
+    const auto& built = handle.GetKernelsImpl(algorithm_name, network_config);
+    if(built.empty())
+        MIOPEN_THROW(miopenStatusInternalError, "The fused kernel was not built");
+    auto plan                = std::make_shared<FusionCompiledPlan>();
+    plan->vertices           = lu.cur_vertex;
+    plan->kernel_source_type = kernel_source_type;
+    plan->program_name       = program_name;
+    plan->kernel_name        = kernel_name;
+    plan->algorithm_name     = algorithm_name;
+    plan->network_config     = network_config;
+    plan->arg_list           = arg_list;
+    plan->arg_layout         = arg_layout;
+    // A tuned kernel is added after the one built before tuning
+    plan->kernel = conv_exhaustive_search ? built.back() : built.front();
+    compiled     = plan;
+    if(use_cache)
+        handle.fusion_plans.Register(key, std::move(plan));
     return status;
 }
 
@@ -1251,10 +1408,17 @@ std::vector<Exec_arg_t> FusionPlanDescriptor::CalcArgOrder(const Handle& handle)
             case OpArg:
                 if(arg.op_idx < op_map.size())
                 {
-                    auto& op = op_map.at(arg.op_idx);
-                    auto k   = op->GetArgKey(arg.key);
-                    arg_keys.emplace_back(
-                        k, arg.default_val.is_ptr ? Pointer : Scalar, arg.default_val.size());
+                    auto& op  = op_map.at(arg.op_idx);
+                    auto k    = op->GetArgKey(arg.key);
+                    auto size = arg.default_val.size();
+                    // The operator knows the type of the value it sets, the metadata may not
+                    // (e.g. half activation parameters)
+                    for(const auto& op_arg : op->GetArgs())
+                    {
+                        if(op_arg.first == k)
+                            size = op_arg.second.size();
+                    }
+                    arg_keys.emplace_back(k, arg.default_val.is_ptr ? Pointer : Scalar, size);
                     break;
                 }
                 else
@@ -1303,18 +1467,65 @@ std::vector<Exec_arg_t> FusionPlanDescriptor::CalcArgOrder(const Handle& handle)
     return arg_keys;
 }
 
-miopenStatus_t FusionPlanDescriptor::Execute(const Handle& handle,
+OperatorArgs::Binding& FusionPlanDescriptor::BindArgs(OperatorArgs& op_args) const
+{
+    auto& bindings = op_args.bindings;
+    // Forget the plans that have been recompiled or destroyed
+    bindings.erase(std::remove_if(bindings.begin(),
+                                  bindings.end(),
+                                  [&](const OperatorArgs::Binding& b) {
+                                      return b.plan_layout != arg_layout &&
+                                             b.plan_layout.use_count() == 1;
+                                  }),
+                   bindings.end());
+
+    auto binding = std::find_if(bindings.begin(), bindings.end(), [&](const auto& b) {
+        return b.plan_layout == arg_layout;
+    });
+    if(binding != bindings.end() && binding->layout != nullptr)
+        return *binding;
+    if(binding == bindings.end())
+        binding = bindings.insert(bindings.end(), OperatorArgs::Binding{arg_layout, {}, {}});
+
+    auto layout = arg_layout;
+    for(const auto& slot : arg_layout->op_slots)
+    {
+        const auto it = op_args.args_map.find(slot.first);
+        if(it == op_args.args_map.end())
+            MIOPEN_THROW(miopenStatusInternalError, "Argument Not Set: " + slot.first);
+        if(it->second.size() != arg_layout->slots[slot.second].size)
+            layout = nullptr;
+    }
+
+    if(layout == nullptr)
+    {
+        MIOPEN_LOG_I2("Operator argument sizes differ from the compiled layout");
+        layout = std::make_shared<const FusionArgLayout>(
+            MakeArgLayout(arg_list, [&](const Exec_arg_t& arg) -> std::size_t {
+                if(arg.type == Scalar || arg.type == Pointer)
+                    return op_args.args_map.at(arg.key).size();
+                return arg.size;
+            }));
+    }
+
+    binding->block = layout->block;
+    for(const auto& slot : layout->op_slots)
+    {
+        const auto& val   = op_args.args_map.at(slot.first).buffer;
+        const auto offset = layout->slots[slot.second].offset;
+        std::copy(val.begin(), val.end(), binding->block.begin() + offset);
+    }
+    binding->layout = std::move(layout);
+    return *binding;
+}
+
+miopenStatus_t FusionPlanDescriptor::Execute(Handle& handle,
                                              const TensorDescriptor& inputDesc,
                                              ConstData_t input,
                                              const TensorDescriptor& outputDesc,
                                              Data_t output,
-                                             const OperatorArgs& op_args)
+                                             OperatorArgs& op_args)
 {
-    if(!isValid() || (lu.GetCurVertex(handle) == nullptr))
-    {
-        MIOPEN_THROW(miopenStatusBadParm, "Attempting to execute an invalid fusion plan.");
-    }
-
     if(output_desc != outputDesc)
     {
         MIOPEN_THROW(miopenStatusBadParm, "The output descriptors dont match.");
@@ -1324,50 +1535,40 @@ miopenStatus_t FusionPlanDescriptor::Execute(const Handle& handle,
         MIOPEN_THROW(miopenStatusBadParm, "The input descriptors dont match.");
     }
 
-    auto ops_head = op_map[0];
-
-    auto&& kernels = handle.GetKernels(algorithm_name, network_config);
-    MIOPEN_LOG_I(algorithm_name << ',' << network_config);
-    if(kernels.empty())
+    if(!segments.empty())
     {
-        MIOPEN_THROW(miopenStatusBadParm, "The FusionPlan was not compiled for execution");
+        ExecutePartitioned(handle, input, output, op_args);
+        return miopenStatusSuccess;
     }
-    KernelInvoke kernel = kernels.front();
 
-    std::vector<OpKernelArg> args;
-    if(arg_list.empty())
+    if(!isValid() || (lu.GetCurVertex(handle) == nullptr))
     {
-        MIOPEN_THROW("Kernel arguments not setup properly");
+        MIOPEN_THROW(miopenStatusBadParm, "Attempting to execute an invalid fusion plan.");
     }
-    for(auto& arg : arg_list)
+
+    MIOPEN_LOG_I(algorithm_name << ',' << network_config);
+    if(compiled == nullptr)
     {
-        MIOPEN_LOG_I2("Key: " + arg.key);
-        switch(arg.type)
-        {
-        case Input_Ptr: args.emplace_back(OpKernelArg(input)); break;
-        case Output_Ptr: args.emplace_back(OpKernelArg(output)); break;
-        case Padding: args.emplace_back(OpKernelArg(0, arg.size)); break;
-        case Scalar:
-        case Pointer: {
-            auto it = op_args.args_map.find(arg.key);
-            if(it != op_args.args_map.end())
-            {
-                args.push_back(it->second);
-            }
-            else
-            {
-                MIOPEN_THROW(miopenStatusInternalError, "Argument Not Set: " + arg.key);
-            }
-            break;
-        }
-        case Default: args.push_back(arg.val); break;
-        }
+        MIOPEN_THROW(miopenStatusBadParm, "The FusionPlan was not compiled for execution");
     }
-    if(args.empty())
+    KernelInvoke kernel = handle.Run(compiled->kernel);
+
+    if(arg_layout == nullptr || arg_list.empty())
     {
-        MIOPEN_THROW("Operator args not populated properly");
+        MIOPEN_THROW("Kernel arguments not setup properly");
     }
-    kernel(args);
+
+    // Packs the operator arguments once; afterwards ins_arg() keeps the block up to date and
+    // only the tensors have to be filled in here.
+    auto& binding      = BindArgs(op_args);
+    const auto& layout = *binding.layout;
+    auto* block        = binding.block.data();
+    for(const auto idx : layout.input_slots)
+        std::memcpy(block + layout.slots[idx].offset, &input, sizeof(input));
+    for(const auto idx : layout.output_slots)
+        std::memcpy(block + layout.slots[idx].offset, &output, sizeof(output));
+
+    kernel(OpKernelArgBlock{block, binding.block.size(), layout.slots});
     return miopenStatusSuccess;
 }
 
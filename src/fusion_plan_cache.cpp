@@ -0,0 +1,55 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/fusion_plan_cache.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/tensor.hpp>
+
+namespace miopen {
+
+void FusionPlanKey::Append(const TensorDescriptor& desc)
+{
+    Append(desc.GetType());
+    AppendRange(desc.GetLengths());
+    AppendRange(desc.GetStrides());
+}
+
+std::shared_ptr<const FusionCompiledPlan> FusionPlanCache::Find(const FusionPlanKey& key) const
+{
+    const auto it = plans.find(key);
+    if(it == plans.end())
+        return nullptr;
+    return it->second;
+}
+
+void FusionPlanCache::Register(const FusionPlanKey& key,
+                               std::shared_ptr<const FusionCompiledPlan> plan)
+{
+    plans[key] = std::move(plan);
+    MIOPEN_LOG_I2("Fusion plan registered, " << plans.size() << " compiled plans in the cache");
+}
+
+} // namespace miopen
@@ -0,0 +1,371 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/fusion_plan.hpp>
+#include <miopen/activ.hpp>
+#include <miopen/batch_norm.hpp>
+#include <miopen/convolution_plan.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/tensor_ops.hpp>
+
+#include <half.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace miopen {
+
+namespace {
+
+template <class T>
+T GetArg(const OperatorArgs& args, const std::string& key)
+{
+    const auto it = args.args_map.find(key);
+    if(it == args.args_map.end())
+        MIOPEN_THROW(miopenStatusBadParm, "Argument Not Set: " + key);
+    if(it->second.size() != sizeof(T))
+        MIOPEN_THROW(miopenStatusBadParm, "Unexpected size of the argument: " + key);
+    T val;
+    std::memcpy(&val, it->second.buffer.data(), sizeof(T));
+    return val;
+}
+
+// The activation parameters are stored in the data type of the tensors, see SetArgs().
+double GetActivArg(const OperatorArgs& args, const std::string& key, miopenDataType_t type)
+{
+    if(type == miopenHalf)
+        return static_cast<float>(GetArg<half_float::half>(args, key));
+    return GetArg<float>(args, key);
+}
+
+const float one  = 1.0f;
+const float zero = 0.0f;
+
+} // namespace
+
+void FusionOpDescriptor::RunStandalone(Handle& /*handle*/,
+                                       ConstData_t /*x*/,
+                                       const TensorDescriptor& /*yDesc*/,
+                                       Data_t /*y*/,
+                                       const OperatorArgs& /*args*/,
+                                       Data_t /*workSpace*/,
+                                       std::size_t /*workSpaceSize*/) const
+{
+    MIOPEN_THROW(miopenStatusNotImplemented,
+                 "The fusion operator can only be run as a part of a fused kernel");
+}
+
+void ConvForwardOpDescriptor::CompileStandalone(Handle& handle,
+                                                const TensorDescriptor& output_desc)
+{
+    std::size_t count = 0;
+    miopenConvSolution_t solution;
+    bool fallback = false;
+    base_desc.GetForwardSolutions(
+        handle, filter_desc, input_desc, output_desc, 1, &count, &solution, &fallback);
+    if(count == 0)
+        MIOPEN_THROW(miopenStatusNotImplemented, "No solution for the convolution");
+    standalone_plan = std::make_shared<ConvolutionPlan>(handle,
+                                                        base_desc,
+                                                        conv::Direction::Forward,
+                                                        input_desc,
+                                                        filter_desc,
+                                                        output_desc,
+                                                        solver::Id(solution.solution_id));
+}
+
+std::size_t ConvForwardOpDescriptor::GetStandaloneWorkspaceSize() const
+{
+    return standalone_plan == nullptr ? 0 : standalone_plan->GetWorkspaceSize();
+}
+
+void ConvForwardOpDescriptor::RunStandalone(Handle& handle,
+                                            ConstData_t x,
+                                            const TensorDescriptor& /*yDesc*/,
+                                            Data_t y,
+                                            const OperatorArgs& args,
+                                            Data_t workSpace,
+                                            std::size_t workSpaceSize) const
+{
+    if(standalone_plan == nullptr)
+        MIOPEN_THROW(miopenStatusInternalError, "The convolution was not compiled standalone");
+    const auto w = GetArg<ConstData_t>(args, "weights" + std::to_string(GetIdx()));
+    // ConvolutionPlan takes mutable pointers for every direction but does not write x and w
+    auto mutable_x = const_cast<Data_t>(x); // NOLINT (cppcoreguidelines-pro-type-const-cast)
+    auto mutable_w = const_cast<Data_t>(w); // NOLINT (cppcoreguidelines-pro-type-const-cast)
+    standalone_plan->Execute(handle, mutable_x, mutable_w, y, workSpace, workSpaceSize);
+}
+
+void BiasFusionOpDescriptor::RunStandalone(Handle& handle,
+                                           ConstData_t x,
+                                           const TensorDescriptor& yDesc,
+                                           Data_t y,
+                                           const OperatorArgs& args,
+                                           Data_t /*workSpace*/,
+                                           std::size_t /*workSpaceSize*/) const
+{
+    const auto bias = GetArg<ConstData_t>(args, "bias" + std::to_string(GetIdx()));
+    OpTensor(handle,
+             miopenTensorOpAdd,
+             &one,
+             input_desc,
+             x,
+             &one,
+             base_desc,
+             bias,
+             &zero,
+             yDesc,
+             y);
+}
+
+void ActivFwdFusionOpDescriptor::RunStandalone(Handle& handle,
+                                               ConstData_t x,
+                                               const TensorDescriptor& yDesc,
+                                               Data_t y,
+                                               const OperatorArgs& args,
+                                               Data_t /*workSpace*/,
+                                               std::size_t /*workSpaceSize*/) const
+{
+    const auto id   = std::to_string(GetIdx());
+    const auto type = input_desc.GetType();
+    ActivationDescriptor desc{activMode,
+                              GetActivArg(args, "activAlpha" + id, type),
+                              GetActivArg(args, "activBeta" + id, type),
+                              GetActivArg(args, "activGamma" + id, type)};
+    desc.Forward(handle, &one, input_desc, x, &zero, yDesc, y);
+}
+
+void BatchNormInferenceFusionOpDescriptor::RunStandalone(Handle& handle,
+                                                         ConstData_t x,
+                                                         const TensorDescriptor& yDesc,
+                                                         Data_t y,
+                                                         const OperatorArgs& args,
+                                                         Data_t /*workSpace*/,
+                                                         std::size_t /*workSpaceSize*/) const
+{
+    const auto id = std::to_string(GetIdx());
+    BatchNormForwardInference(handle,
+                              mode,
+                              &one,
+                              &zero,
+                              input_desc,
+                              x,
+                              yDesc,
+                              y,
+                              base_desc,
+                              GetArg<ConstData_t>(args, "bnScale" + id),
+                              GetArg<ConstData_t>(args, "bnBias" + id),
+                              GetArg<ConstData_t>(args, "estimatedMean" + id),
+                              GetArg<ConstData_t>(args, "estimatedVariance" + id),
+                              GetArg<double>(args, "epsilon" + id));
+}
+
+void BatchNormFwdTrainFusionOpDescriptor::RunStandalone(Handle& handle,
+                                                        ConstData_t x,
+                                                        const TensorDescriptor& yDesc,
+                                                        Data_t y,
+                                                        const OperatorArgs& args,
+                                                        Data_t /*workSpace*/,
+                                                        std::size_t /*workSpaceSize*/) const
+{
+    const auto id = std::to_string(GetIdx());
+    TensorDescriptor bn_desc;
+    DeriveBNTensorDescriptor(bn_desc, input_desc, mode);
+    BatchNormForwardTraining(handle,
+                             mode,
+                             &one,
+                             &zero,
+                             input_desc,
+                             x,
+                             yDesc,
+                             y,
+                             bn_desc,
+                             GetArg<ConstData_t>(args, "bnScale" + id),
+                             GetArg<ConstData_t>(args, "bnBias" + id),
+                             GetArg<double>(args, "expAvgFactor" + id),
+                             GetArg<Data_t>(args, "runningMean" + id),
+                             GetArg<Data_t>(args, "runningVariance" + id),
+                             GetArg<double>(args, "epsilon" + id),
+                             GetArg<Data_t>(args, "savedMean" + id),
+                             GetArg<Data_t>(args, "savedInvVariance" + id));
+}
+
+std::shared_ptr<FusionPlanDescriptor>
+FusionPlanDescriptor::MatchSegment(Handle& handle, std::size_t first_op, std::size_t count) const
+{
+    auto plan = std::make_shared<FusionPlanDescriptor>(fusion_dir, op_map[first_op]->input_desc);
+    for(auto i = first_op; i < first_op + count; ++i)
+        plan->AppendOp(op_map[i]);
+    plan->conv_exhaustive_search = conv_exhaustive_search;
+    if(!plan->isValid() || plan->lu.GetCurVertex(handle) == nullptr)
+        return nullptr;
+    return plan;
+}
+
+miopenStatus_t FusionPlanDescriptor::CompilePartitioned(Handle& handle)
+{
+    const auto n = op_map.size();
+
+    // fused[i][j - i - 1] is the plan for the operators [i, j) when the metadata graph has a
+    // kernel for them, matched on first use. Only the segments of the chosen partition are
+    // compiled. A segment whose kernel fails to build is dropped and the partition is chosen
+    // again without it.
+    std::vector<std::vector<std::shared_ptr<FusionPlanDescriptor>>> fused(n);
+    std::vector<std::vector<bool>> tried(n);
+    std::vector<std::vector<bool>> built(n);
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        fused[i].resize(n - i);
+        tried[i].resize(n - i, false);
+        built[i].resize(n - i, false);
+    }
+    const auto get_fused = [&](std::size_t i, std::size_t j) {
+        if(!tried[i][j - i - 1])
+        {
+            tried[i][j - i - 1] = true;
+            fused[i][j - i - 1] = MatchSegment(handle, i, j - i);
+        }
+        return fused[i][j - i - 1];
+    };
+    const auto is_standalone = [&](std::size_t i, std::size_t j) {
+        return j == i + 1 && op_map[i]->IsStandaloneSupported();
+    };
+
+    // best[i] is the smallest number of kernel launches for the operators [i, n) and next[i]
+    // the end of the first segment. Standalone operators are preferred for single operators,
+    // longer fused segments for ties.
+    constexpr auto none = std::numeric_limits<std::size_t>::max();
+    std::vector<std::size_t> best(n + 1);
+    std::vector<std::size_t> next(n + 1);
+    for(auto partitioned = false; !partitioned;)
+    {
+        std::fill(best.begin(), best.end(), none);
+        std::fill(next.begin(), next.end(), none);
+        best[n] = 0;
+        for(auto i = n; i-- > 0;)
+        {
+            for(auto j = n; j > i; --j)
+            {
+                if(best[j] == none || best[j] + 1 >= best[i])
+                    continue;
+                if(is_standalone(i, j) || get_fused(i, j) != nullptr)
+                {
+                    best[i] = best[j] + 1;
+                    next[i] = j;
+                }
+            }
+        }
+        if(best[0] == none)
+        {
+            MIOPEN_LOG_I2("The fusion plan can not be partitioned into supported segments");
+            MIOPEN_THROW(miopenStatusBadParm);
+        }
+
+        partitioned = true;
+        for(std::size_t i = 0; i < n && partitioned; i = next[i])
+        {
+            const auto j = next[i];
+            if(is_standalone(i, j) || built[i][j - i - 1])
+                continue;
+            auto& plan  = fused[i][j - i - 1];
+            auto status = miopenStatusUnknownError;
+            miopen::try_([&] { status = plan->CompileFused(handle); }, false);
+            if(status == miopenStatusSuccess)
+            {
+                built[i][j - i - 1] = true;
+            }
+            else
+            {
+                plan        = nullptr;
+                partitioned = false;
+            }
+        }
+    }
+
+    std::size_t max_intermediate = 0;
+    workspace_size               = 0;
+    std::ostringstream ss;
+    for(std::size_t i = 0; i < n; i = next[i])
+    {
+        const auto j = next[i];
+        FusionSegment segment{i, j - i, nullptr, op_map[i]->input_desc, output_desc};
+        if(j < n)
+            segment.output_desc = op_map[j]->input_desc;
+        ss << '[';
+        if(is_standalone(i, j))
+        {
+            op_map[i]->CompileStandalone(handle, segment.output_desc);
+            workspace_size = std::max(workspace_size, op_map[i]->GetStandaloneWorkspaceSize());
+            ss << *op_map[i];
+        }
+        else
+        {
+            segment.fused = fused[i][j - i - 1];
+            for(auto k = i; k < j; ++k)
+                ss << (k == i ? "" : "+") << *op_map[k];
+        }
+        ss << ']';
+        if(j < n)
+            max_intermediate = std::max(max_intermediate, segment.output_desc.GetNumBytes());
+        segments.push_back(std::move(segment));
+    }
+    MIOPEN_LOG_I("Fusion plan partitioned into " << segments.size() << " kernels: " << ss.str());
+
+    for(auto& buffer : intermediates)
+        buffer = max_intermediate == 0 ? nullptr : handle.Create(max_intermediate);
+    workspace = workspace_size == 0 ? nullptr : handle.Create(workspace_size);
+    return miopenStatusSuccess;
+}
+
+void FusionPlanDescriptor::ExecutePartitioned(Handle& handle,
+                                              ConstData_t input,
+                                              Data_t output,
+                                              OperatorArgs& op_args) const
+{
+    for(std::size_t k = 0; k < segments.size(); ++k)
+    {
+        const auto& segment = segments[k];
+        const auto in       = k == 0 ? input : intermediates[(k - 1) % 2].get();
+        const auto out      = k + 1 == segments.size() ? output : intermediates[k % 2].get();
+        if(segment.fused != nullptr)
+        {
+            segment.fused->Execute(
+                handle, segment.input_desc, in, segment.output_desc, out, op_args);
+        }
+        else
+        {
+            op_map[segment.first_op]->RunStandalone(
+                handle, in, segment.output_desc, out, op_args, workspace.get(), workspace_size);
+        }
+    }
+}
+
+} // namespace miopen
@@ -29,6 +29,7 @@
 #include <miopen/tensor.hpp>
 #include <miopen/handle.hpp>
 #include <miopen/finddb_kernel_cache_key.hpp>
+#include <miopen/launch_list.hpp>
 
 #if MIOPEN_BACKEND_HIP
 #include <miopen/hipoc_kernel.hpp>
@@ -49,6 +50,7 @@
 #endif
 
 #include <boost/range/adaptors.hpp>
+#include <cstring>
 #include <tuple> // std::ignore
 
 #if MIOPEN_USE_ROCBLAS
@@ -439,6 +441,67 @@ static inline uint32_t FlagsForRocblasFp32Fp16Call(const bool gfx90aFp16Alt)
 }
 #endif //MIOPEN_USE_ROCBLAS
 
+using GemmCall = miopenStatus_t (*)(const Handle&,
+                                    GemmDescriptor,
+                                    ConstData_t,
+                                    int,
+                                    ConstData_t,
+                                    int,
+                                    Data_t,
+                                    int,
+                                    FindDbKCacheKey*,
+                                    GemmBackend_t,
+                                    bool);
+
+// Records the call into the launch list of a capturing handle (see Handle::BeginCapture()) and
+// replays it by calling the same function again. rocBLAS does not expose the kernel and the
+// argument block it resolves for a GEMM, so the replay goes through its whole host setup; only
+// the GEMM descriptor is kept from the capture. The buffers are kept among the arguments of the
+// recorded launch, where the list can rebind them.
+static miopenStatus_t CaptureGemm(const Handle& handle,
+                                  GemmCall call,
+                                  const GemmDescriptor& gemm_desc,
+                                  ConstData_t A,
+                                  int a_offset,
+                                  ConstData_t B,
+                                  int b_offset,
+                                  Data_t C,
+                                  int c_offset,
+                                  GemmBackend_t gemm_backend,
+                                  bool gfx90a_alt_impl)
+{
+    constexpr std::size_t ptr_size = sizeof(Data_t);
+    auto launch                    = CapturedLaunch{};
+    launch.args.resize(3 * ptr_size);
+    std::memcpy(launch.args.data(), &A, ptr_size);
+    std::memcpy(launch.args.data() + ptr_size, &B, ptr_size);
+    std::memcpy(launch.args.data() + 2 * ptr_size, &C, ptr_size);
+    launch.pointer_offsets = {0, ptr_size, 2 * ptr_size};
+    launch.call = [=](const Handle& replay_handle, const std::vector<char>& args) {
+        ConstData_t a;
+        ConstData_t b;
+        Data_t c;
+        std::memcpy(&a, args.data(), ptr_size);
+        std::memcpy(&b, args.data() + ptr_size, ptr_size);
+        std::memcpy(&c, args.data() + 2 * ptr_size, ptr_size);
+        const auto status = call(replay_handle,
+                                 gemm_desc,
+                                 a,
+                                 a_offset,
+                                 b,
+                                 b_offset,
+                                 c,
+                                 c_offset,
+                                 nullptr,
+                                 gemm_backend,
+                                 gfx90a_alt_impl);
+        if(status != miopenStatusSuccess)
+            MIOPEN_THROW(status, "Replaying a GEMM failed");
+    };
+    handle.Capture(std::move(launch));
+    return miopenStatusSuccess;
+}
+
 miopenStatus_t CallGemm(const Handle& handle,
                         GemmDescriptor gemm_desc,
                         ConstData_t A,
@@ -454,6 +517,18 @@ miopenStatus_t CallGemm(const Handle& handle,
     MIOPEN_LOG_I2("gemm_desc: " << gemm_desc);
 
     gemm_backend = enforce_gemm_backend(gemm_desc.dataType, gemm_backend);
+    if(handle.IsCapturing() && gemm_backend != GemmBackend_t::nogemmbackend)
+        return CaptureGemm(handle,
+                           CallGemm,
+                           gemm_desc,
+                           A,
+                           a_offset,
+                           B,
+                           b_offset,
+                           C,
+                           c_offset,
+                           gemm_backend,
+                           gfx90a_alt_impl);
 
 // do row-to-column major conversion here
 // add macro to distinguish MIOpenTensile and rocBlas logic
@@ -756,6 +831,18 @@ miopenStatus_t CallGemmStridedBatched(const Handle& handle,
     MIOPEN_LOG_I2("gemm_desc: " << gemm_desc);
 
     gemm_backend = enforce_gemm_backend(gemm_desc.dataType, gemm_backend);
+    if(handle.IsCapturing() && gemm_backend != GemmBackend_t::nogemmbackend)
+        return CaptureGemm(handle,
+                           CallGemmStridedBatched,
+                           gemm_desc,
+                           A,
+                           a_offset,
+                           B,
+                           b_offset,
+                           C,
+                           c_offset,
+                           gemm_backend,
+                           gfx90a_alt_impl);
 
 // do row-to-column major conversion here
 // add macro to distinguish MIOpenTensile and rocBlas logic
@@ -1007,6 +1094,18 @@ miopenStatus_t CallGemmStridedBatchedSequential(const Handle& handle,
     MIOPEN_LOG_I2("gemm_desc: " << gemm_desc);
 
     gemm_backend = enforce_gemm_backend(gemm_desc.dataType, gemm_backend);
+    if(handle.IsCapturing() && gemm_backend != GemmBackend_t::nogemmbackend)
+        return CaptureGemm(handle,
+                           CallGemmStridedBatchedSequential,
+                           gemm_desc,
+                           A,
+                           a_offset,
+                           B,
+                           b_offset,
+                           C,
+                           c_offset,
+                           gemm_backend,
+                           gfx90a_alt_impl);
 
 // do row-to-column major conversion here
 // add macro to distinguish MIOpenTensile and rocBlas logic
@@ -27,6 +27,8 @@
 #include <miopen/version.h>
 #include <miopen/errors.hpp>
 #include <miopen/handle.hpp>
+#include <miopen/launch_list.hpp>
+#include <miopen/logger.hpp>
 
 extern "C" const char* miopenGetErrorString(miopenStatus_t error)
 {
@@ -112,3 +114,46 @@ extern "C" miopenStatus_t miopenEnableProfiling(miopenHandle_t handle, bool enab
 {
     return miopen::try_([&] { miopen::deref(handle).EnableProfiling(enable); });
 }
+
+extern "C" miopenStatus_t miopenBeginLaunchCapture(miopenHandle_t handle)
+{
+    MIOPEN_LOG_FUNCTION(handle);
+    return miopen::try_([&] { miopen::deref(handle).BeginCapture(); });
+}
+
+extern "C" miopenStatus_t miopenEndLaunchCapture(miopenHandle_t handle, miopenLaunchList_t* list)
+{
+    MIOPEN_LOG_FUNCTION(handle);
+    return miopen::try_([&] {
+        miopen::deref(list) = new miopen::LaunchList(miopen::deref(handle).EndCapture());
+    });
+}
+
+extern "C" miopenStatus_t
+miopenRebindLaunchList(miopenLaunchList_t list, size_t count, const miopenLaunchBinding_t* bindings)
+{
+    MIOPEN_LOG_FUNCTION(list, count);
+    return miopen::try_([&] {
+        if(count != 0 && bindings == nullptr)
+            MIOPEN_THROW(miopenStatusBadParm, "No bindings given");
+        auto list_bindings = std::vector<miopen::LaunchBinding>{};
+        list_bindings.reserve(count);
+        for(std::size_t i = 0; i < count; i++)
+            list_bindings.push_back({DataCast(bindings[i].from),
+                                     bindings[i].size,
+                                     DataCast(bindings[i].to)});
+        miopen::deref(list).Rebind(list_bindings);
+    });
+}
+
+extern "C" miopenStatus_t miopenReplayLaunchList(miopenHandle_t handle, miopenLaunchList_t list)
+{
+    MIOPEN_LOG_FUNCTION(handle, list);
+    return miopen::try_([&] { miopen::deref(handle).Replay(miopen::deref(list)); });
+}
+
+extern "C" miopenStatus_t miopenDestroyLaunchList(miopenLaunchList_t list)
+{
+    MIOPEN_LOG_FUNCTION(list);
+    return miopen::try_([&] { miopen_destroy_object(list); });
+}
@@ -28,6 +28,10 @@
 #include <miopen/tensor.hpp>
 #include <miopen/magic_div.hpp>
 #include <miopen/float_equal.hpp>
+#include <miopen/env.hpp>
+#include <miopen/logger.hpp>
+#include <algorithm>
+#include <cmath>
 #include <string>
 #include <vector>
 #include <limits>
@@ -36,10 +40,9 @@
 
 #define BATCHED_TRANSPOSE_BLOCK_SIZE 256
 #define BATCHED_TRANSPOSE_PERSISTENT 0
-
-#if BATCHED_TRANSPOSE_PERSISTENT
 #define BATCHED_TRANSPOSE_OCCUPANCY 4
-#endif
+
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_BATCHED_TRANSPOSE_LEGACY)
 
 namespace miopen {
 namespace batched_transpose {
@@ -288,20 +291,122 @@ HeuristicGet(std::size_t data_size, uint32_t batch, uint32_t height, uint32_t wi
     return best_kernel;
 }
 
+// Width of the memory segment a fully coalesced access moves.
+static constexpr double cost_model_segment_bytes = 64;
+
+static inline double GetAccessEfficiency(std::size_t segment, std::size_t data_size)
+{
+    return std::min(1.0, static_cast<double>(segment * data_size) / cost_model_segment_bytes);
+}
+
+static inline double GetCost(const BatchedTransposeParam* kparam,
+                             std::size_t data_size,
+                             uint32_t batch,
+                             uint32_t height,
+                             uint32_t width,
+                             int num_cu)
+{
+    const std::size_t tile_x = kparam->tile_x;
+    const std::size_t tile_y = kparam->tile_y;
+    const std::size_t dim_h  = (height + tile_y - 1) / tile_y;
+    const std::size_t dim_w  = (width + tile_x - 1) / tile_x;
+    const std::size_t groups = static_cast<std::size_t>(batch) * dim_h * dim_w;
+
+    // Workgroups resident on one CU at a time, for counting the waves of a launch.
+    const std::size_t slots =
+        static_cast<std::size_t>(std::max(num_cu, 1)) * BATCHED_TRANSPOSE_OCCUPANCY;
+    const std::size_t waves = (groups + slots - 1) / slots;
+
+    // A tile reads rows of tile_x source elements and writes rows of tile_y destination
+    // elements. When a tile spans whole rows, its rows are adjacent in memory.
+    const std::size_t load_segment  = tile_x < width ? tile_x : std::size_t{width} * tile_y;
+    const std::size_t store_segment = tile_y < height ? tile_y : std::size_t{height} * tile_x;
+
+    const double per_element = 1.0 / GetAccessEfficiency(load_segment, data_size) +
+                               1.0 / GetAccessEfficiency(store_segment, data_size) +
+                               0.5 * (1.0 / kparam->ediv_x + 1.0 / kparam->ediv_y);
+    const double per_group =
+        static_cast<double>(tile_x * tile_y) * per_element + BATCHED_TRANSPOSE_BLOCK_SIZE;
+    return static_cast<double>(waves) * per_group;
+}
+
+static inline BatchedTransposeParam
+CostModelGet(std::size_t data_size, uint32_t batch, uint32_t height, uint32_t width, int num_cu)
+{
+    // Bigger kernels are at the end of the list, so they win the ties.
+    const auto& kernel_list = GetKernelList(data_size);
+    BatchedTransposeParam best_kernel;
+    double best_cost = std::numeric_limits<double>::max();
+    for(auto it = kernel_list.rbegin(); it != kernel_list.rend(); it++)
+    {
+        if(!IsApplicable(batch, height, width, &(*it)))
+            continue;
+        const auto cost = GetCost(&(*it), data_size, batch, height, width, num_cu);
+        if(cost < best_cost)
+        {
+            best_cost   = cost;
+            best_kernel = *it;
+        }
+    }
+    return best_kernel;
+}
+
 } // namespace batched_transpose
 
+std::ostream& operator<<(std::ostream& stream, const BatchedTransposeParam& param)
+{
+    return stream << "tile " << param.tile_x << "x" << param.tile_y << " pack " << param.pack_x
+                  << "x" << param.pack_y << " ediv " << param.ediv_x << "x" << param.ediv_y;
+}
+
+double GetBatchedTransposeCost(const BatchedTransposeParam& param,
+                               std::size_t data_size,
+                               uint32_t batch,
+                               uint32_t height,
+                               uint32_t width,
+                               int num_cu)
+{
+    return batched_transpose::GetCost(&param, data_size, batch, height, width, num_cu);
+}
+
+BatchedTransposeParam GetBatchedTransposeParam(std::size_t data_size,
+                                               uint32_t batch,
+                                               uint32_t height,
+                                               uint32_t width,
+                                               int num_cu)
+{
+    if(miopen::IsEnabled(MIOPEN_DEBUG_BATCHED_TRANSPOSE_LEGACY{}))
+        return batched_transpose::HeuristicGet(data_size, batch, height, width);
+    return batched_transpose::CostModelGet(data_size, batch, height, width, num_cu);
+}
+
 BatchedTransposeSolution::BatchedTransposeSolution(const ExecutionContext& ctx,
                                                    miopenDataType_t data_type_,
                                                    uint32_t batch_,
                                                    uint32_t height_,
                                                    uint32_t width_)
-    : data_type(data_type_), batch(batch_), height(height_), width(width_)
+    : BatchedTransposeSolution(static_cast<int>(ctx.GetStream().GetMaxComputeUnits()),
+                               data_type_,
+                               batch_,
+                               height_,
+                               width_)
+{
+}
+
+BatchedTransposeSolution::BatchedTransposeSolution(int num_cu_,
+                                                   miopenDataType_t data_type_,
+                                                   uint32_t batch_,
+                                                   uint32_t height_,
+                                                   uint32_t width_)
+    : data_type(data_type_), batch(batch_), height(height_), width(width_), num_cu(num_cu_)
 {
     if(data_type == miopenInt8x4 || data_type == miopenDouble)
         MIOPEN_THROW("These data type are not supported");
-    num_cu                 = ctx.GetStream().GetMaxComputeUnits();
     std::size_t data_size  = miopen::GetTypeSize(data_type);
-    kernel_param_heuristic = batched_transpose::HeuristicGet(data_size, batch, height, width);
+    kernel_param_heuristic = GetBatchedTransposeParam(data_size, batch, height, width, num_cu);
+    MIOPEN_LOG_I2("BatchedTransposeSolution " << batch << "x" << height << "x" << width << ": "
+                                              << kernel_param_heuristic << ", estimated cost "
+                                              << GetCost());
 }
 
 solver::KernelInfo BatchedTransposeSolution::GetKernel() const
@@ -332,6 +437,12 @@ solver::KernelInfo BatchedTransposeSolution::GetKernel() const
     return kernel;
 }
 
+double BatchedTransposeSolution::GetCost() const
+{
+    return GetBatchedTransposeCost(
+        kernel_param_heuristic, miopen::GetTypeSize(data_type), batch, height, width, num_cu);
+}
+
 std::vector<OpKernelArg> BatchedTransposeSolution::GetKernelArg() const
 {
     uint32_t dim_h = (height + kernel_param_heuristic.tile_y - 1) / kernel_param_heuristic.tile_y;
@@ -34,6 +34,7 @@
 #include <miopen/handle_lock.hpp>
 #include <miopen/invoker.hpp>
 #include <miopen/kernel_cache.hpp>
+#include <miopen/launch_list.hpp>
 #include <miopen/logger.hpp>
 #include <miopen/rocm_features.hpp>
 #include <miopen/stringutils.hpp>
@@ -206,6 +207,11 @@ struct HandleImpl
     KernelCache cache;
     hipCtx_t ctx;
     TargetProperties target_properties;
+    std::shared_ptr<LaunchList> capture;
+    std::vector<StreamPtr> aux_streams;
+    // The stream of the handle while it runs on another one, see Handle::SwitchStream()
+    StreamPtr switched_from = nullptr;
+    bool switched           = false;
 };
 
 Handle::Handle(miopenAcceleratorQueue_t stream) : impl(new HandleImpl())
@@ -262,6 +268,43 @@ void Handle::SetStream(miopenAcceleratorQueue_t streamID) const
 
 miopenAcceleratorQueue_t Handle::GetStream() const { return impl->stream.get(); }
 
+miopenAcceleratorQueue_t Handle::GetAuxStream(std::size_t index) const
+{
+    while(this->impl->aux_streams.size() <= index)
+    {
+        this->impl->set_ctx();
+        hipStream_t result;
+        auto status = hipStreamCreateWithFlags(&result, hipStreamNonBlocking);
+        if(status != hipSuccess)
+            MIOPEN_THROW_HIP_STATUS(status, "Failed to allocate stream");
+        this->impl->aux_streams.emplace_back(result, &hipStreamDestroy);
+    }
+    return this->impl->aux_streams[index].get();
+}
+
+void Handle::SwitchStream(miopenAcceleratorQueue_t streamID) const
+{
+    if(this->impl->switched)
+        MIOPEN_THROW("The handle already runs on another stream");
+    this->impl->switched_from = std::move(this->impl->stream);
+    this->impl->stream        = HandleImpl::reference_stream(streamID);
+    this->impl->switched      = true;
+#if MIOPEN_USE_ROCBLAS
+    rocblas_set_stream(this->rhandle_.get(), this->GetStream());
+#endif
+}
+
+void Handle::RestoreStream() const
+{
+    if(!this->impl->switched)
+        return;
+    this->impl->stream   = std::move(this->impl->switched_from);
+    this->impl->switched = false;
+#if MIOPEN_USE_ROCBLAS
+    rocblas_set_stream(this->rhandle_.get(), this->GetStream());
+#endif
+}
+
 void Handle::SetAllocator(miopenAllocatorFunction allocator,
                           miopenDeallocatorFunction deallocator,
                           void* allocatorContext) const
@@ -278,6 +321,9 @@ float Handle::GetKernelTime() const { return this->impl->profiling_result; }
 
 Allocator::ManageDataPtr Handle::Create(std::size_t sz) const
 {
+    // The buffer would be baked into the recorded launches and freed before they are replayed.
+    if(this->impl->capture)
+        MIOPEN_THROW(miopenStatusBadParm, "Buffers cannot be allocated while capturing");
     MIOPEN_HANDLE_LOCK
     this->Finish();
     return this->impl->allocator(sz);
@@ -305,6 +351,11 @@ void Handle::ReadTo(void* data, const Allocator::ManageDataPtr& ddata, std::size
 
 void Handle::Copy(ConstData_t src, Data_t dest, std::size_t size) const
 {
+    if(this->impl->capture)
+    {
+        this->impl->capture->Add(CaptureCopy(src, dest, size));
+        return;
+    }
     MIOPEN_HANDLE_LOCK
     this->impl->set_ctx();
     auto status = hipMemcpy(dest, src, size, hipMemcpyDeviceToDevice);
@@ -378,12 +429,74 @@ bool Handle::HasKernel(const std::string& algorithm, const std::string& network_
 KernelInvoke Handle::Run(Kernel k) const
 {
     this->impl->set_ctx();
+    if(this->impl->capture)
+    {
+        auto invoke    = k.Invoke(this->GetStream());
+        invoke.capture = this->impl->capture;
+        return invoke;
+    }
     if(this->impl->enable_profiling || MIOPEN_GPU_SYNC)
         return k.Invoke(this->GetStream(), this->impl->elapsed_time_handler());
     else
         return k.Invoke(this->GetStream());
 }
 
+void Handle::BeginCapture() const
+{
+    if(this->impl->capture)
+        MIOPEN_THROW(miopenStatusBadParm, "The handle is already capturing");
+    this->impl->capture = std::make_shared<LaunchList>();
+}
+
+LaunchList Handle::EndCapture() const
+{
+    if(!this->impl->capture)
+        MIOPEN_THROW(miopenStatusBadParm, "The handle is not capturing");
+    auto list = std::move(*this->impl->capture);
+    this->impl->capture.reset();
+    MIOPEN_LOG_I2("Captured " << list.GetLaunches().size() << " kernel launches");
+    return list;
+}
+
+bool Handle::IsCapturing() const { return this->impl->capture != nullptr; }
+
+void Handle::Capture(CapturedLaunch launch) const
+{
+    if(!this->impl->capture)
+        MIOPEN_THROW(miopenStatusBadParm, "The handle is not capturing");
+    this->impl->capture->Add(std::move(launch));
+}
+
+void Handle::Replay(LaunchList& list) const
+{
+    if(this->impl->capture)
+        MIOPEN_THROW(miopenStatusBadParm, "Launch lists cannot be replayed while capturing");
+
+    this->impl->set_ctx();
+    const auto stream  = this->GetStream();
+    const bool timed   = this->impl->enable_profiling || MIOPEN_GPU_SYNC;
+    const auto handler = timed ? this->impl->elapsed_time_handler() : nullptr;
+    float time         = 0.0f;
+    for(auto& launch : list.GetLaunches())
+    {
+        if(launch.call)
+        {
+            this->impl->profiling_result = 0.0f;
+            launch.call(*this, launch.args);
+            if(this->impl->enable_profiling)
+                time += this->impl->profiling_result;
+            continue;
+        }
+        launch.invoke.stream   = stream;
+        launch.invoke.callback = handler;
+        launch.invoke.run(launch.args.data(), launch.args.size());
+        if(this->impl->enable_profiling)
+            time += this->impl->profiling_result;
+    }
+    if(this->impl->enable_profiling)
+        this->impl->profiling_result = time;
+}
+
 Program Handle::LoadProgram(const std::string& program_name,
                             std::string params,
                             bool is_kernel_str,
@@ -28,6 +28,7 @@
 #include <miopen/errors.hpp>
 #include <miopen/hipoc_kernel.hpp>
 #include <miopen/handle_lock.hpp>
+#include <miopen/launch_list.hpp>
 
 #include <hip/hip_ext.h>
 #include <hip/hip_runtime.h>
@@ -102,6 +103,20 @@ void HIPOCKernelInvoke::run(void* args, std::size_t size) const
     }
 }
 
+void HIPOCKernelInvoke::record(const void* args,
+                               std::size_t size,
+                               std::vector<std::size_t> pointers) const
+{
+    auto launch            = CapturedLaunch{};
+    launch.invoke          = *this;
+    launch.invoke.callback = nullptr;
+    launch.invoke.capture  = nullptr;
+    const auto bytes       = static_cast<const char*>(args);
+    launch.args.assign(bytes, bytes + size);
+    launch.pointer_offsets = std::move(pointers);
+    capture->Add(std::move(launch));
+}
+
 HIPOCKernelInvoke HIPOCKernel::Invoke(hipStream_t stream,
                                       std::function<void(hipEvent_t, hipEvent_t)> callback) const
 {
@@ -30,6 +30,7 @@
 #include <miopen/kernel_info.hpp>
 #include <miopen/op_kernel_args.hpp>
 #include <miopen/execution_context.hpp>
+#include <iosfwd>
 #include <vector>
 
 namespace miopen {
@@ -42,8 +43,27 @@ struct BatchedTransposeParam
     int pack_y{0};
     int ediv_x{0};
     int ediv_y{0};
+
+    friend std::ostream& operator<<(std::ostream& stream, const BatchedTransposeParam& param);
 };
 
+/// Estimated run time of the kernel on a [batch, height, width] tensor with elements of
+/// data_size bytes, in arbitrary units. It counts the padded tiles in waves over the compute
+/// units and charges each element for the memory segments it touches on both sides.
+double GetBatchedTransposeCost(const BatchedTransposeParam& param,
+                               std::size_t data_size,
+                               uint32_t batch,
+                               uint32_t height,
+                               uint32_t width,
+                               int num_cu);
+
+/// The applicable kernel with the lowest estimated cost.
+BatchedTransposeParam GetBatchedTransposeParam(std::size_t data_size,
+                                               uint32_t batch,
+                                               uint32_t height,
+                                               uint32_t width,
+                                               int num_cu);
+
 struct BatchedTransposeSolution
 {
     BatchedTransposeSolution(const ExecutionContext& ctx_,
@@ -51,11 +71,18 @@ struct BatchedTransposeSolution
                              uint32_t batch_,
                              uint32_t height_,
                              uint32_t width_);
+    BatchedTransposeSolution(int num_cu_,
+                             miopenDataType_t data_type_,
+                             uint32_t batch_,
+                             uint32_t height_,
+                             uint32_t width_);
     solver::KernelInfo GetKernel() const;
     std::vector<OpKernelArg> GetKernelArg() const;
     std::string GetKernelName() const;
     bool IsSkippable() const;
     size_t GetSize() const;
+    /// Estimated cost of the chosen kernel, see GetBatchedTransposeCost().
+    double GetCost() const;
 
     miopenDataType_t data_type;
     uint32_t batch;
@@ -27,6 +27,7 @@
 #pragma once
 
 #include <miopen/conv_algo_name.hpp>
+#include <miopen/conv/problem_key.hpp>
 #include <miopen/convolution.hpp>
 #include <miopen/names.hpp>
 #include <miopen/sqlite_db.hpp>
@@ -55,67 +56,68 @@ inline std::string GetDataTypeName(miopenDataType_t data_type)
     return "Unknown(" + std::to_string(data_type) + ")";
 }
 
-template <class TElement>
-constexpr auto GetDHW(int spatial_dims, const std::vector<TElement>& data)
+template <class TRange>
+constexpr auto GetDHW(int spatial_dims, const TRange& data)
 {
     if(spatial_dims == 2)
         return std::make_tuple(0, data[0], data[1]);
     return std::make_tuple(data[0], data[1], data[2]);
 }
 
-template <class TElement>
-constexpr TElement GetD3(int spatial_dims, const std::vector<TElement>& data)
+template <class TRange>
+constexpr typename TRange::value_type GetD3(int spatial_dims, const TRange& data)
 {
     return std::get<0>(GetDHW(spatial_dims, data));
 }
 
-template <class TElement>
-constexpr TElement GetH3(int spatial_dims, const std::vector<TElement>& data)
+template <class TRange>
+constexpr typename TRange::value_type GetH3(int spatial_dims, const TRange& data)
 {
     return std::get<1>(GetDHW(spatial_dims, data));
 }
 
-template <class TElement>
-constexpr TElement GetW3(int spatial_dims, const std::vector<TElement>& data)
+template <class TRange>
+constexpr typename TRange::value_type GetW3(int spatial_dims, const TRange& data)
 {
     return std::get<2>(GetDHW(spatial_dims, data));
 }
 
-template <class TElement>
-constexpr auto GetNCDHW(int spatial_dims, const std::vector<TElement>& data)
+template <class TRange>
+constexpr auto GetNCDHW(int spatial_dims, const TRange& data)
 {
+    using TElement = typename TRange::value_type;
     if(spatial_dims == 3)
         return miopen::tien<5>(data, 1);
     else
         return std::make_tuple(data[0], data[1], static_cast<TElement>(1), data[2], data[3]);
 }
 
-template <class TElement>
-constexpr TElement GetN5(int spatial_dims, const std::vector<TElement>& data)
+template <class TRange>
+constexpr typename TRange::value_type GetN5(int spatial_dims, const TRange& data)
 {
     return std::get<0>(GetNCDHW(spatial_dims, data));
 }
 
-template <class TElement>
-constexpr TElement GetC5(int spatial_dims, const std::vector<TElement>& data)
+template <class TRange>
+constexpr typename TRange::value_type GetC5(int spatial_dims, const TRange& data)
 {
     return std::get<1>(GetNCDHW(spatial_dims, data));
 }
 
-template <class TElement>
-constexpr TElement GetD5(int spatial_dims, const std::vector<TElement>& data)
+template <class TRange>
+constexpr typename TRange::value_type GetD5(int spatial_dims, const TRange& data)
 {
     return std::get<2>(GetNCDHW(spatial_dims, data));
 }
 
-template <class TElement>
-constexpr TElement GetH5(int spatial_dims, const std::vector<TElement>& data)
+template <class TRange>
+constexpr typename TRange::value_type GetH5(int spatial_dims, const TRange& data)
 {
     return std::get<3>(GetNCDHW(spatial_dims, data));
 }
 
-template <class TElement>
-constexpr TElement GetW5(int spatial_dims, const std::vector<TElement>& data)
+template <class TRange>
+constexpr typename TRange::value_type GetW5(int spatial_dims, const TRange& data)
 {
     return std::get<4>(GetNCDHW(spatial_dims, data));
 }
@@ -146,6 +148,7 @@ struct ProblemDescription
           bias(bias_)
     {
         HeuristicUpdateLayouts();
+        UpdateKey();
     }
 
     // Conv descriptor getters
@@ -173,7 +176,7 @@ struct ProblemDescription
     std::size_t GetInStrideD() const { return GetD5(GetSpatialDims(), in.GetStrides()); }
     std::size_t GetInStrideH() const { return GetH5(GetSpatialDims(), in.GetStrides()); }
     std::size_t GetInStrideW() const { return GetW5(GetSpatialDims(), in.GetStrides()); }
-    std::string GetInLayout() const { return in_layout; }
+    const std::string& GetInLayout() const { return in_layout; }
     std::string ComputeInLayout() const
     {
         if(GetSpatialDims() == 2)
@@ -207,7 +210,7 @@ struct ProblemDescription
     std::size_t GetOutStrideD() const { return GetD5(GetSpatialDims(), out.GetStrides()); }
     std::size_t GetOutStrideH() const { return GetH5(GetSpatialDims(), out.GetStrides()); }
     std::size_t GetOutStrideW() const { return GetW5(GetSpatialDims(), out.GetStrides()); }
-    std::string GetOutLayout() const { return out_layout; }
+    const std::string& GetOutLayout() const { return out_layout; }
     std::string ComputeOutLayout() const
     {
         if(GetSpatialDims() == 2)
@@ -240,7 +243,7 @@ struct ProblemDescription
     // }
     // std::size_t GetWeightsStrideW() const { return GetW5(GetSpatialDims(), weights.GetStrides());
     // }
-    std::string GetWeightsLayout() const { return weights_layout; }
+    const std::string& GetWeightsLayout() const { return weights_layout; }
     std::string ComputeWeightsLayout() const
     {
         if(GetSpatialDims() == 2)
@@ -319,10 +322,13 @@ struct ProblemDescription
         MIOPEN_THROW("Direction must be known!");
     }
 
-    bool IsLayoutDefault() const;
+    bool IsLayoutDefault() const { return layout_default; }
 
     void HeuristicUpdateLayouts();
 
+    /// Binary counterpart of BuildConfKey() for the in-memory caches.
+    const ProblemKey& GetKey() const { return key; }
+
     void BuildConfKey(std::string& conf_key) const;
 
     NetworkConfig BuildConfKey() const
@@ -375,6 +381,8 @@ struct ProblemDescription
     }
 
     private:
+    void UpdateKey();
+
     TensorDescriptor in;
     TensorDescriptor weights;
     TensorDescriptor out;
@@ -384,6 +392,8 @@ struct ProblemDescription
     std::string out_layout;
     Direction direction = Direction::Forward;
     int bias            = 0;
+    bool layout_default = false;
+    ProblemKey key;
 };
 
 } // namespace conv
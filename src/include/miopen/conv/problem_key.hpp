@@ -0,0 +1,117 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#pragma once
+
+#include <miopen/simple_hash.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <tuple>
+#include <type_traits>
+
+namespace miopen {
+namespace conv {
+
+/// Fixed-size identity of a convolution problem for the in-memory caches.
+///
+/// It holds exactly the fields that make up the textual network config built by
+/// ProblemDescription::BuildConfKey(): two problems have equal keys if and only if their network
+/// configs are equal. The key is trivially copyable and its hash is computed once, when it is
+/// built, so looking it up costs a few integer compares instead of formatting and hashing a
+/// string. The text is still produced for the persistent databases, which need it.
+struct ProblemKey
+{
+    std::uint64_t hash = 0;
+    // in, weights, out; one layout label per byte, e.g. "NCHW" -> 'N' | 'C' << 8 | ...
+    std::array<std::uint64_t, 3> layouts{};
+    // in C, D, H, W; weights D, H, W; out K, D, H, W; N
+    std::array<std::uint64_t, 12> lengths{};
+    // pads, strides, dilations, each as D, H, W
+    std::array<std::int32_t, 9> conv_params{};
+    std::int32_t group_count = 0;
+    // in, weights, out
+    std::array<std::uint8_t, 3> data_types{};
+    std::uint8_t spatial_dims = 0;
+    std::uint8_t direction    = 0;
+
+    static std::uint64_t PackLayout(const std::string& layout)
+    {
+        std::uint64_t packed = 0;
+        for(std::size_t i = 0; i < layout.size() && i < sizeof(packed); ++i)
+            packed |= static_cast<std::uint64_t>(static_cast<unsigned char>(layout[i])) << (8 * i);
+        return packed;
+    }
+
+    /// Has to be called after all the fields are set.
+    void UpdateHash()
+    {
+        std::uint64_t h = HashSeed;
+        const auto mix  = [&](std::uint64_t v) { h = HashCombine(h, v); };
+        for(const auto layout : layouts)
+            mix(layout);
+        for(const auto length : lengths)
+            mix(length);
+        for(const auto param : conv_params)
+            mix(static_cast<std::uint32_t>(param));
+        mix(static_cast<std::uint32_t>(group_count));
+        mix(data_types[0] | data_types[1] << 8 | data_types[2] << 16 | spatial_dims << 24 |
+            static_cast<std::uint64_t>(direction) << 32);
+        hash = h;
+    }
+
+    auto Tie() const
+    {
+        return std::tie(
+            layouts, lengths, conv_params, group_count, data_types, spatial_dims, direction);
+    }
+
+    friend bool operator==(const ProblemKey& lhs, const ProblemKey& rhs)
+    {
+        return lhs.hash == rhs.hash && lhs.Tie() == rhs.Tie();
+    }
+
+    friend bool operator!=(const ProblemKey& lhs, const ProblemKey& rhs) { return !(lhs == rhs); }
+};
+
+static_assert(std::is_trivially_copyable<ProblemKey>{}, "ProblemKey is copied around by value");
+
+} // namespace conv
+} // namespace miopen
+
+namespace std {
+template <>
+struct hash<miopen::conv::ProblemKey>
+{
+    std::size_t operator()(const miopen::conv::ProblemKey& key) const
+    {
+        return static_cast<std::size_t>(key.hash);
+    }
+};
+} // namespace std
@@ -27,6 +27,7 @@
 #define GUARD_MIOPEN_CONVOLUTION_HPP_
 
 #include <miopen/common.hpp>
+#include <miopen/conv_algo_name.hpp>
 #include <miopen/env.hpp>
 #include <miopen/find_controls.hpp>
 #include <miopen/kernel.hpp>
@@ -35,6 +36,7 @@
 #include <miopen/solver_id.hpp>
 #include <miopen/names.hpp>
 #include <miopen/invoke_params.hpp>
+#include <miopen/invoker.hpp>
 
 #include <boost/any.hpp>
 
@@ -361,6 +363,15 @@ struct ConvolutionDescriptor : miopenConvolutionDescriptor
                                  std::size_t workSpaceSize,
                                  solver::Id solver_id) const;
 
+    /// Validates the problem and returns the invoker of the solution, compiling its kernels if
+    /// needed. The tensors are given in terms of the forward convolution for every direction.
+    Invoker PrepareSolutionInvoker(Handle& handle,
+                                   const TensorDescriptor& xDesc,
+                                   const TensorDescriptor& wDesc,
+                                   const TensorDescriptor& yDesc,
+                                   conv::Direction direction,
+                                   solver::Id solver_id) const;
+
     std::size_t BackwardWeightsGetWorkSpaceSize(Handle& handle,
                                                 const TensorDescriptor& dyDesc,
                                                 const TensorDescriptor& xDesc,
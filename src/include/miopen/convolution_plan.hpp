@@ -0,0 +1,143 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_CONVOLUTION_PLAN_HPP_
+#define GUARD_MIOPEN_CONVOLUTION_PLAN_HPP_
+
+#include <miopen/common.hpp>
+#include <miopen/conv_algo_name.hpp>
+#include <miopen/invoke_params.hpp>
+#include <miopen/invoker.hpp>
+#include <miopen/miopen.h>
+#include <miopen/object.hpp>
+#include <miopen/solver_id.hpp>
+#include <miopen/tensor.hpp>
+
+#include <iosfwd>
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace miopen {
+
+struct ConvolutionDescriptor;
+struct ConvolutionPlan;
+struct Handle;
+
+/// The buffers of one execution of a plan, see ExecuteConvolutionPlans().
+struct ConvolutionPlanLaunch
+{
+    ConvolutionPlan* plan;
+    Data_t x;
+    Data_t w;
+    Data_t y;
+    Data_t workSpace;
+    std::size_t workSpaceSize;
+};
+
+/// A convolution solution bound to its problem. Everything that does not depend on the buffers
+/// (validation, the invoker, the workspace size and the invoke parameters) is resolved at
+/// construction, so Execute() only patches the pointers into the prepared parameters.
+struct ConvolutionPlan : miopenConvolutionPlan
+{
+    /// The tensors are given in terms of the forward convolution for every direction.
+    ConvolutionPlan(Handle& handle,
+                    const ConvolutionDescriptor& conv,
+                    conv::Direction direction,
+                    const TensorDescriptor& xDesc,
+                    const TensorDescriptor& wDesc,
+                    const TensorDescriptor& yDesc,
+                    solver::Id solver_id);
+
+    std::size_t GetWorkspaceSize() const { return workspace_size; }
+
+    /// Not thread safe: the prepared invoke parameters are updated in place.
+    void Execute(const Handle& handle,
+                 Data_t x,
+                 Data_t w,
+                 Data_t y,
+                 Data_t workSpace,
+                 std::size_t workSpaceSize);
+
+    /// Executes independent launches of this plan in their order. A run of launches whose
+    /// buffers are laid out back to back, so that they form a single problem with a larger
+    /// batch or group count, is executed as launches of that problem when the solver is
+    /// applicable to it, one per power of two in the length of the run. Launches must have been
+    /// validated, see ExecuteConvolutionPlans().
+    void ExecuteMany(Handle& handle, const std::vector<const ConvolutionPlanLaunch*>& launches);
+
+    /// Kernels of the plan belong to the context of the handle it was built with.
+    void ValidateHandle(const Handle& handle) const;
+    void ValidateBuffers(
+        Data_t x, Data_t w, Data_t y, Data_t workSpace, std::size_t workSpaceSize) const;
+
+    friend std::ostream& operator<<(std::ostream& stream, const ConvolutionPlan& plan);
+
+    private:
+    enum class Merge
+    {
+        Batch, // the launches share the weights and are stacked along N
+        Group, // single images stacked along the channels, each with its own weights
+    };
+
+    void Run(const Handle& handle,
+             Data_t x,
+             Data_t w,
+             Data_t y,
+             Data_t workSpace,
+             std::size_t workSpaceSize);
+    std::size_t CountMergeable(const std::vector<const ConvolutionPlanLaunch*>& launches,
+                               std::size_t first,
+                               Merge merge) const;
+    ConvolutionPlan* GetMerged(Handle& handle, Merge merge, std::size_t count);
+
+    // Direction and tensor roles after transposed convolutions have been mapped onto the
+    // regular ones.
+    conv::Direction direction;
+    bool swap_x_y;
+    TensorDescriptor xDesc;
+    TensorDescriptor wDesc;
+    TensorDescriptor yDesc;
+    solver::Id solver_id;
+    const Handle* built_with;
+    std::size_t workspace_size = 0;
+    bool check_numerics;
+    Invoker invoker;
+    AnyInvokeParams invoke_params;
+    std::shared_ptr<const ConvolutionDescriptor> conv_desc;
+    // Plans of the merged problems by the number of launches, a power of two, null where not
+    // applicable.
+    std::map<std::pair<Merge, std::size_t>, std::unique_ptr<ConvolutionPlan>> merged;
+};
+
+/// Executes launches of any plans that do not depend on each other's results. All of them are
+/// validated before the first one is enqueued, then they are enqueued plan by plan, in the
+/// order of the first launch of each plan.
+void ExecuteConvolutionPlans(Handle& handle, const std::vector<ConvolutionPlanLaunch>& launches);
+
+} // namespace miopen
+MIOPEN_DEFINE_OBJECT(miopenConvolutionPlan, miopen::ConvolutionPlan);
+
+#endif // GUARD_MIOPEN_CONVOLUTION_PLAN_HPP_
@@ -0,0 +1,295 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_FLOAT_CONVERT_HPP
+#define GUARD_MIOPEN_FLOAT_CONVERT_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <half.hpp>
+#include <miopen/bfloat16.hpp>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && !defined(_MSC_VER)
+#define MIOPEN_FLOAT_CONVERT_F16C 1
+#include <cpuid.h>
+#include <immintrin.h>
+#else
+#define MIOPEN_FLOAT_CONVERT_F16C 0
+#endif
+
+/// Bulk conversions between float and the 16-bit host types (half_float::half, bfloat16).
+///
+/// Converting one element at a time through the class constructors is branchy and does not
+/// vectorize, which makes filling and reading back large fp16/bf16 tensors surprisingly slow.
+/// The routines below convert whole buffers with branch-free bit manipulation (so the compiler
+/// may vectorize them) and use F16C instructions for half when the host CPU supports them.
+///
+/// Float -> half conversion rounds to nearest even on every path, like the device code does.
+/// Float -> bfloat16 conversion is bit-identical to the bfloat16(float) constructor.
+
+namespace miopen {
+
+template <class T>
+struct is_reduced_float : std::false_type
+{
+};
+
+template <>
+struct is_reduced_float<half_float::half> : std::true_type
+{
+};
+
+template <>
+struct is_reduced_float<bfloat16> : std::true_type
+{
+};
+
+namespace float_convert_detail {
+
+static_assert(sizeof(half_float::half) == sizeof(std::uint16_t), "");
+static_assert(sizeof(bfloat16) == sizeof(std::uint16_t), "");
+
+inline std::uint32_t float_to_bits(float f)
+{
+    std::uint32_t u;
+    std::memcpy(&u, &f, sizeof(u));
+    return u;
+}
+
+inline float bits_to_float(std::uint32_t u)
+{
+    float f;
+    std::memcpy(&f, &u, sizeof(f));
+    return f;
+}
+
+template <class T>
+inline std::uint16_t load_bits(const T* p)
+{
+    std::uint16_t u;
+    std::memcpy(&u, static_cast<const void*>(p), sizeof(u));
+    return u;
+}
+
+template <class T>
+inline void store_bits(T* p, std::uint16_t u)
+{
+    std::memcpy(static_cast<void*>(p), &u, sizeof(u));
+}
+
+// Same rounding and NaN preservation as the bfloat16(float) constructor, without branches.
+inline std::uint16_t float_to_bf16_bits(float f)
+{
+    const std::uint32_t u       = float_to_bits(f);
+    const bool inf_or_nan       = (~u & 0x7f800000u) == 0;
+    const std::uint32_t special = u | (((u & 0xffffu) != 0) ? 0x10000u : 0u);
+#if MIOPEN_USE_RNE_BFLOAT16 == 1
+    const std::uint32_t rounded = u + (0x7fffu + ((u >> 16) & 1u));
+#else
+    const std::uint32_t rounded = u;
+#endif
+    return static_cast<std::uint16_t>((inf_or_nan ? special : rounded) >> 16);
+}
+
+inline float bf16_bits_to_float(std::uint16_t h)
+{
+    return bits_to_float(static_cast<std::uint32_t>(h) << 16);
+}
+
+// IEEE binary16 conversions computed with float arithmetic, so that both directions are exact
+// (round to nearest even for narrowing) and contain no data-dependent branches.
+inline std::uint16_t float_to_half_bits(float f)
+{
+    const float scale_to_inf  = bits_to_float(0x77800000u); // 2^112
+    const float scale_to_zero = bits_to_float(0x08800000u); // 2^-110
+    float base                = (std::fabs(f) * scale_to_inf) * scale_to_zero;
+
+    const std::uint32_t w      = float_to_bits(f);
+    const std::uint32_t shl1_w = w + w;
+    const std::uint32_t sign   = w & 0x80000000u;
+    std::uint32_t bias         = shl1_w & 0xff000000u;
+    bias                       = bias < 0x71000000u ? 0x71000000u : bias;
+
+    base                             = bits_to_float((bias >> 1) + 0x07800000u) + base;
+    const std::uint32_t bits         = float_to_bits(base);
+    const std::uint32_t exp_bits     = (bits >> 13) & 0x00007c00u;
+    const std::uint32_t mantissa     = bits & 0x00000fffu;
+    const std::uint32_t nonsign      = exp_bits + mantissa;
+    const std::uint32_t nan_or_value = shl1_w > 0xff000000u ? 0x7e00u : nonsign;
+    return static_cast<std::uint16_t>((sign >> 16) | nan_or_value);
+}
+
+inline float half_bits_to_float(std::uint16_t h)
+{
+    const std::uint32_t w     = static_cast<std::uint32_t>(h) << 16;
+    const std::uint32_t sign  = w & 0x80000000u;
+    const std::uint32_t two_w = w + w;
+
+    const float normalized =
+        bits_to_float((two_w >> 4) + (0xe0u << 23)) * bits_to_float(0x07800000u); // * 2^-112
+    const float denormalized = bits_to_float((two_w >> 17) | (126u << 23)) - 0.5f;
+
+    const std::uint32_t magnitude =
+        two_w < (1u << 27) ? float_to_bits(denormalized) : float_to_bits(normalized);
+    return bits_to_float(sign | magnitude);
+}
+
+#if MIOPEN_FLOAT_CONVERT_F16C
+inline bool host_has_f16c()
+{
+    static const bool result = [] {
+        if(!__builtin_cpu_supports("avx"))
+            return false;
+        unsigned eax = 0, ebx = 0, ecx = 0, edx = 0;
+        if(__get_cpuid(1, &eax, &ebx, &ecx, &edx) == 0)
+            return false;
+        return (ecx & bit_F16C) != 0;
+    }();
+    return result;
+}
+
+__attribute__((target("avx,f16c"))) inline std::size_t
+half_to_float_f16c(const std::uint16_t* src, float* dst, std::size_t n)
+{
+    std::size_t i = 0;
+    for(; i + 8 <= n; i += 8)
+    {
+        const __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(h));
+    }
+    return i;
+}
+
+__attribute__((target("avx,f16c"))) inline std::size_t
+float_to_half_f16c(const float* src, std::uint16_t* dst, std::size_t n)
+{
+    std::size_t i = 0;
+    for(; i + 8 <= n; i += 8)
+    {
+        const __m128i h = _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), h);
+    }
+    return i;
+}
+#endif
+
+// F16C instructions work on plain 16-bit words, so whole blocks are staged through a small
+// local buffer. This keeps the element types opaque and avoids aliasing through casts.
+constexpr std::size_t block_size = 256;
+
+} // namespace float_convert_detail
+
+/// Converts n elements from src to dst. The generic version falls back to static_cast;
+/// the overloads below handle the 16-bit floating point types in bulk.
+template <class Src, class Dst>
+void convert_n(const Src* src, std::size_t n, Dst* dst)
+{
+    for(std::size_t i = 0; i < n; ++i)
+        dst[i] = static_cast<Dst>(src[i]);
+}
+
+inline void convert_n(const half_float::half* src, std::size_t n, float* dst)
+{
+    using namespace float_convert_detail;
+#if MIOPEN_FLOAT_CONVERT_F16C
+    if(host_has_f16c())
+    {
+        std::uint16_t bits[block_size];
+        for(std::size_t start = 0; start < n; start += block_size)
+        {
+            const auto count = std::min(block_size, n - start);
+            std::memcpy(bits, static_cast<const void*>(src + start), count * sizeof(std::uint16_t));
+            const auto done = half_to_float_f16c(bits, dst + start, count);
+            for(std::size_t i = done; i < count; ++i)
+                dst[start + i] = half_bits_to_float(bits[i]);
+        }
+        return;
+    }
+#endif
+    for(std::size_t i = 0; i < n; ++i)
+        dst[i] = half_bits_to_float(load_bits(src + i));
+}
+
+inline void convert_n(const float* src, std::size_t n, half_float::half* dst)
+{
+    using namespace float_convert_detail;
+#if MIOPEN_FLOAT_CONVERT_F16C
+    if(host_has_f16c())
+    {
+        std::uint16_t bits[block_size];
+        for(std::size_t start = 0; start < n; start += block_size)
+        {
+            const auto count = std::min(block_size, n - start);
+            const auto done  = float_to_half_f16c(src + start, bits, count);
+            for(std::size_t i = done; i < count; ++i)
+                bits[i] = float_to_half_bits(src[start + i]);
+            std::memcpy(static_cast<void*>(dst + start), bits, count * sizeof(std::uint16_t));
+        }
+        return;
+    }
+#endif
+    for(std::size_t i = 0; i < n; ++i)
+        store_bits(dst + i, float_to_half_bits(src[i]));
+}
+
+inline void convert_n(const bfloat16* src, std::size_t n, float* dst)
+{
+    using namespace float_convert_detail;
+    for(std::size_t i = 0; i < n; ++i)
+        dst[i] = bf16_bits_to_float(load_bits(src + i));
+}
+
+inline void convert_n(const float* src, std::size_t n, bfloat16* dst)
+{
+    using namespace float_convert_detail;
+    for(std::size_t i = 0; i < n; ++i)
+        store_bits(dst + i, float_to_bf16_bits(src[i]));
+}
+
+/// Range helpers: dst must have at least as many elements as src.
+template <class SrcRange, class DstRange>
+void convert_range(const SrcRange& src, DstRange& dst)
+{
+    convert_n(src.data(), src.size(), dst.data());
+}
+
+template <class T, class Range>
+std::vector<T> convert_to_vector(const Range& src)
+{
+    std::vector<T> result(src.size());
+    convert_n(src.data(), src.size(), result.data());
+    return result;
+}
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_FLOAT_CONVERT_HPP
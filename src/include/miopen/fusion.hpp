@@ -33,7 +33,9 @@
 #include <miopen/solver.hpp>
 #include <miopen/op_kernel_args.hpp>
 #include <miopen/fusion_ops.hpp>
+#include <miopen/fusion_plan_cache.hpp>
 
+#include <memory>
 #include <set>
 #include <vector>
 #include <unordered_map>
@@ -41,6 +43,7 @@
 namespace miopen {
 
 struct Handle;
+struct ConvolutionPlan;
 
 enum FusionKernelSourceType
 {
@@ -49,13 +52,35 @@ enum FusionKernelSourceType
     Binary, /// \todo Unused, consider removing.
 };
 
+/// Kernel argument layout of a compiled fusion plan. Default and padding arguments are
+/// already filled in the block; the operator arguments are located by their keys.
+struct FusionArgLayout
+{
+    std::vector<OpKernelArgSlot> slots;
+    std::vector<char> block;
+    std::unordered_map<std::string, std::size_t> op_slots;
+    std::vector<std::size_t> input_slots;
+    std::vector<std::size_t> output_slots;
+};
+
 struct OperatorArgs : miopenOperatorArgs
 {
     OperatorArgs();
     void ins_arg(std::string name, OpKernelArg v);
     friend std::ostream& operator<<(std::ostream& stream, const OperatorArgs& x);
-    std::vector<OpKernelArg> args_vec;
     std::unordered_map<std::string, OpKernelArg> args_map;
+
+    // The arguments packed by FusionPlanDescriptor::Execute for the layout of a plan (several
+    // for partitioned plans). ins_arg() writes new values directly into the bound blocks.
+    // layout differs from plan_layout only when the argument sizes did not match those the
+    // plan expected; it is null once the block has to be packed again.
+    struct Binding
+    {
+        std::shared_ptr<const FusionArgLayout> plan_layout;
+        std::shared_ptr<const FusionArgLayout> layout;
+        std::vector<char> block;
+    };
+    std::vector<Binding> bindings;
 };
 
 struct FusionOpDescriptor : miopenFusionOpDescriptor
@@ -68,6 +93,9 @@ struct FusionOpDescriptor : miopenFusionOpDescriptor
     int GetIdx() const { return plan_idx; };
     virtual miopenStatus_t GetOutputDesc(TensorDescriptor& output_desc) = 0;
     virtual miopenStatus_t GetNetworkConfig(std::string& network_config, Handle& handle);
+    // Appends the attributes of the operator that the compiled kernel depends on, such as its
+    // mode and descriptors; the kind, the position and the input are added by the plan.
+    virtual void GetPlanKey(FusionPlanKey& /*key*/) const {}
     virtual miopenStatus_t GetCompileParms(std::string& compile_config,
                                            Handle& handle,
                                            FusionKernelSourceType source,
@@ -80,6 +108,18 @@ struct FusionOpDescriptor : miopenFusionOpDescriptor
     virtual bool GetOpAttr(const std::string& /*sym*/, int& /*val*/) const { return false; };
     virtual std::vector<size_t> GetLocalWGSz(Handle& handle, std::string algorithm_name);
     virtual std::vector<size_t> GetGlobalWGSz(Handle& handle, std::string algorithm_name);
+    // Running the operator through its regular, unfused implementation, for plans that have
+    // to be split into several kernels.
+    virtual bool IsStandaloneSupported() const { return false; }
+    virtual void CompileStandalone(Handle& /*handle*/, const TensorDescriptor& /*output_desc*/) {}
+    virtual std::size_t GetStandaloneWorkspaceSize() const { return 0; }
+    virtual void RunStandalone(Handle& handle,
+                               ConstData_t x,
+                               const TensorDescriptor& yDesc,
+                               Data_t y,
+                               const OperatorArgs& args,
+                               Data_t workSpace,
+                               std::size_t workSpaceSize) const;
     void SetInputDesc(TensorDescriptor i_desc) { input_desc = i_desc; };
     TensorDescriptor input_desc;
 
@@ -93,6 +133,7 @@ struct BiasFusionOpDescriptor : FusionOpDescriptor
     BiasFusionOpDescriptor(const TensorDescriptor& desc) : base_desc(desc){};
     miopenStatus_t GetOutputDesc(TensorDescriptor& output_desc) override;
     miopenStatus_t GetNetworkConfig(std::string& network_config, Handle& handle) override;
+    void GetPlanKey(FusionPlanKey& key) const override;
     miopenStatus_t GetCompileParms(std::string& compile_config,
                                    Handle& handle,
                                    FusionKernelSourceType source,
@@ -103,6 +144,14 @@ struct BiasFusionOpDescriptor : FusionOpDescriptor
     std::string GetArgKey(const std::string& k) const override;
     OpKernelArg GetOpAttr(const std::string& k) const override;
     miopenFusionOp_t kind() const override { return miopenFusionOpBiasForward; };
+    bool IsStandaloneSupported() const override { return true; }
+    void RunStandalone(Handle& handle,
+                       ConstData_t x,
+                       const TensorDescriptor& yDesc,
+                       Data_t y,
+                       const OperatorArgs& args,
+                       Data_t workSpace,
+                       std::size_t workSpaceSize) const override;
     std::vector<size_t> GetLocalWGSz(Handle& handle, std::string algorithm_name) override;
     std::vector<size_t> GetGlobalWGSz(Handle& handle, std::string algorithm_name) override;
     TensorDescriptor base_desc;
@@ -113,6 +162,7 @@ struct ActivFwdFusionOpDescriptor : FusionOpDescriptor
     ActivFwdFusionOpDescriptor(miopenActivationMode_t mode) : activMode(mode){};
     miopenStatus_t GetOutputDesc(TensorDescriptor& output_desc) override;
     miopenStatus_t GetNetworkConfig(std::string& network_config, Handle& handle) override;
+    void GetPlanKey(FusionPlanKey& key) const override;
     miopenStatus_t GetCompileParms(std::string& compile_config,
                                    Handle& handle,
                                    FusionKernelSourceType source,
@@ -128,6 +178,14 @@ struct ActivFwdFusionOpDescriptor : FusionOpDescriptor
     bool GetOpAttr(const std::string& sym, int& val) const override;
     OpKernelArg GetOpAttr(const std::string& k) const override;
     miopenFusionOp_t kind() const override { return miopenFusionOpActivForward; };
+    bool IsStandaloneSupported() const override { return true; }
+    void RunStandalone(Handle& handle,
+                       ConstData_t x,
+                       const TensorDescriptor& yDesc,
+                       Data_t y,
+                       const OperatorArgs& args,
+                       Data_t workSpace,
+                       std::size_t workSpaceSize) const override;
     std::vector<size_t> GetLocalWGSz(Handle& handle, std::string algorithm_name) override;
     std::vector<size_t> GetGlobalWGSz(Handle& handle, std::string algorithm_name) override;
     miopenActivationMode_t activMode;
@@ -138,6 +196,7 @@ struct ActivBwdFusionOpDescriptor : FusionOpDescriptor
     ActivBwdFusionOpDescriptor(miopenActivationMode_t mode) : activMode(mode){};
     miopenStatus_t GetOutputDesc(TensorDescriptor& output_desc) override;
     miopenStatus_t GetNetworkConfig(std::string& network_config, Handle& handle) override;
+    void GetPlanKey(FusionPlanKey& key) const override;
     miopenStatus_t GetCompileParms(std::string& compile_config,
                                    Handle& handle,
                                    FusionKernelSourceType source,
@@ -166,6 +225,7 @@ struct BatchNormInferenceFusionOpDescriptor : FusionOpDescriptor
         : mode(bn_mode), base_desc(desc){};
     miopenStatus_t GetOutputDesc(TensorDescriptor& output_desc) override;
     miopenStatus_t GetNetworkConfig(std::string& network_config, Handle& handle) override;
+    void GetPlanKey(FusionPlanKey& key) const override;
     miopenStatus_t GetCompileParms(std::string& compile_config,
                                    Handle& handle,
                                    FusionKernelSourceType source,
@@ -183,6 +243,14 @@ struct BatchNormInferenceFusionOpDescriptor : FusionOpDescriptor
     OpKernelArg GetOpAttr(const std::string& k) const override;
     bool GetOpAttr(const std::string& sym, int& val) const override;
     miopenFusionOp_t kind() const override { return miopenFusionOpBatchNormInference; };
+    bool IsStandaloneSupported() const override { return true; }
+    void RunStandalone(Handle& handle,
+                       ConstData_t x,
+                       const TensorDescriptor& yDesc,
+                       Data_t y,
+                       const OperatorArgs& args,
+                       Data_t workSpace,
+                       std::size_t workSpaceSize) const override;
     std::vector<size_t> GetLocalWGSz(Handle& handle, std::string algorithm_name) override;
     std::vector<size_t> GetGlobalWGSz(Handle& handle, std::string algorithm_name) override;
 
@@ -196,6 +264,7 @@ struct BatchNormFwdTrainFusionOpDescriptor : FusionOpDescriptor
         : mode(bn_mode), runningMeanVar(runningMeanVariance){};
     miopenStatus_t GetOutputDesc(TensorDescriptor& output_desc) override;
     miopenStatus_t GetNetworkConfig(std::string& network_config, Handle& handle) override;
+    void GetPlanKey(FusionPlanKey& key) const override;
     miopenStatus_t GetCompileParms(std::string& compile_config,
                                    Handle& handle,
                                    FusionKernelSourceType source,
@@ -216,6 +285,14 @@ struct BatchNormFwdTrainFusionOpDescriptor : FusionOpDescriptor
     bool GetOpAttr(const std::string& sym, int& val) const override;
     OpKernelArg GetOpAttr(const std::string& k) const override;
     miopenFusionOp_t kind() const override { return miopenFusionOpBatchNormFwdTrain; };
+    bool IsStandaloneSupported() const override { return true; }
+    void RunStandalone(Handle& handle,
+                       ConstData_t x,
+                       const TensorDescriptor& yDesc,
+                       Data_t y,
+                       const OperatorArgs& args,
+                       Data_t workSpace,
+                       std::size_t workSpaceSize) const override;
     std::vector<size_t> GetLocalWGSz(Handle& handle, std::string algorithm_name) override;
     std::vector<size_t> GetGlobalWGSz(Handle& handle, std::string algorithm_name) override;
     void calcBNParams(Handle& handle,
@@ -237,6 +314,7 @@ struct BatchNormBwdTrainFusionOpDescriptor : FusionOpDescriptor
         : mode(bn_mode), useBatchStats(true){};
     miopenStatus_t GetOutputDesc(TensorDescriptor& output_desc) override;
     miopenStatus_t GetNetworkConfig(std::string& network_config, Handle& handle) override;
+    void GetPlanKey(FusionPlanKey& key) const override;
     miopenStatus_t GetCompileParms(std::string& compile_config,
                                    Handle& handle,
                                    FusionKernelSourceType source,
@@ -286,6 +364,7 @@ struct ConvForwardOpDescriptor : FusionOpDescriptor
     OpKernelArg GetOpAttr(const std::string& k) const override;
     bool GetOpAttr(const std::string& sym, int& val) const override;
     miopenStatus_t GetNetworkConfig(std::string& network_config, Handle& handle) override;
+    void GetPlanKey(FusionPlanKey& key) const override;
     miopenStatus_t GetCompileParms(std::string& compile_config,
                                    Handle& handle,
                                    FusionKernelSourceType source,
@@ -294,12 +373,25 @@ struct ConvForwardOpDescriptor : FusionOpDescriptor
     miopenFusionOp_t kind() const override { return miopenFusionOpConvForward; };
     std::vector<size_t> GetLocalWGSz(Handle& handle, std::string algorithm_name) override;
     std::vector<size_t> GetGlobalWGSz(Handle& handle, std::string algorithm_name) override;
+    bool IsStandaloneSupported() const override { return true; }
+    void CompileStandalone(Handle& handle, const TensorDescriptor& output_desc) override;
+    std::size_t GetStandaloneWorkspaceSize() const override;
+    void RunStandalone(Handle& handle,
+                       ConstData_t x,
+                       const TensorDescriptor& yDesc,
+                       Data_t y,
+                       const OperatorArgs& args,
+                       Data_t workSpace,
+                       std::size_t workSpaceSize) const override;
 
     ConvolutionDescriptor base_desc;
     TensorDescriptor filter_desc;
     solver::KernelInfo kernel_info;
     bool kernel_info_valid;
     std::string conv_compiler_options;
+    // Tune the fused kernel through the perf-db, see miopenFusionPlanConvolutionSetExhaustiveSearch
+    bool exhaustive_search = false;
+    std::shared_ptr<ConvolutionPlan> standalone_plan;
 
     private:
     mlo_construct_direct2D_fusion ConstructParams(Handle& handle);
@@ -5,7 +5,13 @@
 #include <miopen/miopen.h>
 #include <miopen/tensor.hpp>
 #include <miopen/fusion.hpp>
+#include <miopen/kernel.hpp>
 #include <miopen/md_graph.hpp>
+#include <miopen/allocator.hpp>
+
+#include <array>
+#include <memory>
+#include <vector>
 
 namespace miopen {
 
@@ -35,6 +41,34 @@ struct Exec_arg_t
     }
 };
 
+struct FusionPlanDescriptor;
+
+/// The state of a fusion plan compiled into a single kernel. Plans with equal keys share it
+/// through the FusionPlanCache of the handle.
+struct FusionCompiledPlan
+{
+    std::vector<std::pair<MDGraph_vertex_ptr, MDGraph_path>> vertices;
+    FusionKernelSourceType kernel_source_type;
+    std::string program_name;
+    std::string kernel_name;
+    std::string algorithm_name;
+    std::string network_config;
+    std::vector<Exec_arg_t> arg_list;
+    std::shared_ptr<const FusionArgLayout> arg_layout;
+    Kernel kernel;
+};
+
+/// A kernel launch of a fusion plan that could not be fused into a single kernel: either a
+/// fused plan over a part of the operators or a single operator run on its own.
+struct FusionSegment
+{
+    std::size_t first_op;
+    std::size_t op_count;
+    std::shared_ptr<FusionPlanDescriptor> fused; // null for a standalone operator
+    TensorDescriptor input_desc;
+    TensorDescriptor output_desc;
+};
+
 struct FusionPlanDescriptor : miopenFusionPlanDescriptor
 {
     FusionPlanDescriptor(miopenFusionDirection_t dir, const TensorDescriptor& inDesc);
@@ -45,18 +79,25 @@ struct FusionPlanDescriptor : miopenFusionPlanDescriptor
     TensorDescriptor DeriveOutputDescriptor();
     miopenStatus_t
     GetWorkspaceSizeImmed(Handle& handle, size_t& workSpaceSize, miopenConvFwdAlgorithm_t algo);
-    miopenStatus_t Execute(const Handle& handle,
+    miopenStatus_t Execute(Handle& handle,
                            const TensorDescriptor& inputDesc,
                            ConstData_t input,
                            const TensorDescriptor& outputDesc,
                            Data_t output,
-                           const OperatorArgs& op_args);
+                           OperatorArgs& op_args);
+    /// Compiles the plan into a single fused kernel when possible. Otherwise the operators are
+    /// partitioned into the fewest fused segments and standalone operators, see GetSegments().
     miopenStatus_t Compile(Handle& handle);
+    /// Empty unless the compiled plan was partitioned.
+    const std::vector<FusionSegment>& GetSegments() const { return segments; }
+    /// Identifies the compiled plan in the FusionPlanCache of the handle.
+    FusionPlanKey GetPlanKey() const;
     friend std::ostream& operator<<(std::ostream& stream, const FusionPlanDescriptor& fpd);
 
     miopenStatus_t
     GetConvAlgos(int reqAlgoCount, int& retAlgoCount, miopenConvFwdAlgorithm_t* ptrAlgos);
     miopenStatus_t SetConvAlgo(miopenConvFwdAlgorithm_t algo);
+    miopenStatus_t SetConvExhaustiveSearch(bool exhaustive_search);
 
     miopenStatus_t GetOp(int op_idx, std::shared_ptr<FusionOpDescriptor>& desc);
 
@@ -68,6 +109,16 @@ struct FusionPlanDescriptor : miopenFusionPlanDescriptor
     auto GetLocalWGSz();
     auto GetGlobalWGSz();
     std::vector<Exec_arg_t> CalcArgOrder(const Handle& handle);
+    OperatorArgs::Binding& BindArgs(OperatorArgs& op_args) const;
+    void AppendOp(std::shared_ptr<FusionOpDescriptor> desc);
+    miopenStatus_t CompileFused(Handle& handle);
+    miopenStatus_t CompilePartitioned(Handle& handle);
+    std::shared_ptr<FusionPlanDescriptor>
+    MatchSegment(Handle& handle, std::size_t first_op, std::size_t count) const;
+    void ExecutePartitioned(Handle& handle,
+                            ConstData_t input,
+                            Data_t output,
+                            OperatorArgs& op_args) const;
     bool GetEnumVal(const std::string& sym, int& val) const;
     OpKernelArg GetDevAttribute(const std::string& k, const Handle& handle) const;
     OpKernelArg GetTensorAttr(const std::string& sym) const;
@@ -90,6 +141,15 @@ struct FusionPlanDescriptor : miopenFusionPlanDescriptor
     std::string network_config;
     miopenDataType_t data_type;
     std::vector<Exec_arg_t> arg_list;
+    std::shared_ptr<const FusionArgLayout> arg_layout;
+    std::shared_ptr<const FusionCompiledPlan> compiled;
+    bool conv_exhaustive_search = false;
+    std::vector<FusionSegment> segments;
+    // Intermediate tensors between the segments, used alternately, and the workspace of the
+    // standalone operators.
+    std::array<Allocator::ManageDataPtr, 2> intermediates;
+    Allocator::ManageDataPtr workspace;
+    std::size_t workspace_size = 0;
 };
 
 } // namespace miopen
@@ -0,0 +1,101 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#pragma once
+
+#include <miopen/simple_hash.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace miopen {
+
+struct TensorDescriptor;
+struct FusionCompiledPlan;
+
+/// Canonical signature of a fusion plan: the fusion direction, the input and output tensors,
+/// the kind, position and attributes of every operator and the kernels still matching the plan
+/// in the metadata graph. It is a flat sequence of integers hashed while it is built, so two
+/// plans are compared without formatting their network config strings.
+struct FusionPlanKey
+{
+    std::vector<std::uint64_t> words;
+    std::uint64_t hash = HashSeed;
+
+    void Append(std::uint64_t v)
+    {
+        words.push_back(v);
+        hash = HashCombine(hash, v);
+    }
+
+    template <class Range>
+    void AppendRange(const Range& r)
+    {
+        Append(r.size());
+        for(const auto& v : r)
+            Append(static_cast<std::uint64_t>(v));
+    }
+
+    void Append(const TensorDescriptor& desc);
+
+    friend bool operator==(const FusionPlanKey& lhs, const FusionPlanKey& rhs)
+    {
+        return lhs.hash == rhs.hash && lhs.words == rhs.words;
+    }
+
+    friend bool operator!=(const FusionPlanKey& lhs, const FusionPlanKey& rhs)
+    {
+        return !(lhs == rhs);
+    }
+};
+
+/// Fusion plans compiled on a handle, by their keys. A plan that is created again with the
+/// same operators and descriptors takes the chosen kernel and the argument order from here
+/// instead of matching and compiling it again, see FusionPlanDescriptor::Compile().
+class FusionPlanCache
+{
+    public:
+    std::shared_ptr<const FusionCompiledPlan> Find(const FusionPlanKey& key) const;
+    // Replaces the plan stored for the key, e.g. after the kernel has been tuned.
+    void Register(const FusionPlanKey& key, std::shared_ptr<const FusionCompiledPlan> plan);
+
+    private:
+    struct KeyHash
+    {
+        std::size_t operator()(const FusionPlanKey& key) const
+        {
+            return static_cast<std::size_t>(key.hash);
+        }
+    };
+
+    std::unordered_map<FusionPlanKey, std::shared_ptr<const FusionCompiledPlan>, KeyHash> plans;
+};
+
+} // namespace miopen
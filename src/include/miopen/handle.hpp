@@ -29,6 +29,7 @@
 #include <miopen/config.h>
 #include <miopen/kernel_info.hpp>
 #include <miopen/common.hpp>
+#include <miopen/fusion_plan_cache.hpp>
 #include <miopen/invoker_cache.hpp>
 #include <miopen/kernel.hpp>
 #include <miopen/miopen.h>
@@ -58,6 +59,8 @@
 namespace miopen {
 
 struct HandleImpl;
+struct LaunchList;
+struct CapturedLaunch;
 #if MIOPEN_USE_MIOPENGEMM
 struct GemmGeometry;
 using GemmKey = std::pair<std::string, std::string>;
@@ -79,6 +82,16 @@ struct Handle : miopenHandle
     miopenAcceleratorQueue_t GetStream() const;
     void SetStream(miopenAcceleratorQueue_t streamID) const;
 
+    /// Streams owned by the handle for work that is forked from and joined back into its stream
+    /// by the caller. They are created on first use and do not synchronize with the null stream.
+    /// Only supported by the HIP backend; nogpu handles return null streams.
+    miopenAcceleratorQueue_t GetAuxStream(std::size_t index) const;
+    /// Makes subsequent work run on streamID, like SetStream(), but keeps the target properties
+    /// and holds on to the stream of the handle until RestoreStream() switches back to it. Meant
+    /// to move briefly to an auxiliary stream, see AutoSwitchStream. Switches do not nest.
+    void SwitchStream(miopenAcceleratorQueue_t streamID) const;
+    void RestoreStream() const;
+
     void SetAllocator(miopenAllocatorFunction allocator,
                       miopenDeallocatorFunction deallocator,
                       void* allocatorContext) const;
@@ -123,6 +136,18 @@ struct Handle : miopenHandle
     }
 
     KernelInvoke Run(Kernel k) const;
+
+    /// Until EndCapture(), the kernels run through the handle are appended to a launch list
+    /// instead of being launched. GEMMs and buffer copies are recorded as calls that are made
+    /// again on replay (see Capture()). Only supported by the HIP backends. Operations that
+    /// allocate temporary buffers cannot be captured: Create() throws until EndCapture().
+    void BeginCapture() const;
+    LaunchList EndCapture() const;
+    bool IsCapturing() const;
+    /// Appends a launch to the list being captured.
+    void Capture(CapturedLaunch launch) const;
+    /// Enqueues the launches of a list on the stream of the handle.
+    void Replay(LaunchList& list) const;
     const std::vector<Kernel>& GetKernelsImpl(const std::string& algorithm,
                                               const std::string& network_config) const;
 
@@ -218,6 +243,10 @@ struct Handle : miopenHandle
 
     std::unique_ptr<HandleImpl> impl;
     std::unordered_map<std::string, std::vector<miopenConvSolution_t>> find_map;
+    // Compiled fusion plans, see FusionPlanDescriptor::Compile()
+    FusionPlanCache fusion_plans;
+    // Skip-ahead matrices of the dropout PRNG, see DropoutDescriptor::InitPRNGState()
+    Allocator::ManageDataPtr xorwow_skipahead;
 #if MIOPEN_USE_MIOPENGEMM
     std::unordered_map<GemmKey, std::unique_ptr<GemmGeometry>, SimpleHash> geo_map;
 #endif
@@ -234,6 +263,18 @@ struct Handle : miopenHandle
         invokers.SetAsFound1_0(config, algo, solver);
     }
 
+    void RegisterInvoker(const Invoker& invoker,
+                         const conv::ProblemKey& problem,
+                         const NetworkConfig& config,
+                         solver::Id solver,
+                         const boost::optional<AlgorithmName>& algo = boost::none)
+    {
+        const auto solver_str = solver.ToString();
+        invokers.Register({problem, solver.Value()}, {config, solver_str}, invoker);
+        if(algo)
+            invokers.SetAsFound1_0(config, *algo, solver_str);
+    }
+
     boost::optional<const Invoker&>
     GetInvoker(const NetworkConfig& config,
                const boost::optional<solver::Id>& solver,
@@ -252,6 +293,12 @@ struct Handle : miopenHandle
         return invokers.GetFound1_0(config, *algo);
     }
 
+    boost::optional<const Invoker&> GetInvoker(const conv::ProblemKey& problem,
+                                               solver::Id solver) const
+    {
+        return invokers[std::make_pair(problem, solver.Value())];
+    }
+
 #if MIOPEN_USE_ROCBLAS
     const rocblas_handle_ptr& rhandle() const { return rhandle_; }
 
@@ -285,6 +332,19 @@ struct AutoEnableProfiling
     bool prev_state;
 };
 
+struct AutoSwitchStream
+{
+    AutoSwitchStream(const Handle& x, miopenAcceleratorQueue_t stream) : h(x)
+    {
+        h.SwitchStream(stream);
+    }
+
+    ~AutoSwitchStream() { h.RestoreStream(); }
+
+    private:
+    const Handle& h;
+};
+
 } // namespace miopen
 MIOPEN_DEFINE_OBJECT(miopenHandle, miopen::Handle);
 
@@ -32,11 +32,15 @@
 #include <miopen/hipoc_program.hpp>
 #include <miopen/stringutils.hpp>
 #include <miopen/op_kernel_args.hpp>
+#include <memory>
+#include <type_traits>
 #include <vector>
 #include <memory.h>
 
 namespace miopen {
 
+struct LaunchList;
+
 using HipEventPtr = MIOPEN_MANAGE_PTR(hipEvent_t, hipEventDestroy);
 inline HipEventPtr make_hip_event()
 {
@@ -117,6 +121,25 @@ struct KernelArgs
     uint64_t hidden[6] = {};
 };
 
+/// Offsets of the pointer arguments in KernelArgsPack<Ts...>, which aligns every argument to
+/// its own size.
+template <class... Ts>
+std::vector<std::size_t> PointerArgOffsets()
+{
+    const std::size_t sizes[] = {sizeof(Ts)...};
+    const bool is_pointer[]   = {std::is_pointer<Ts>{}...};
+    std::vector<std::size_t> result;
+    std::size_t end = 0;
+    for(std::size_t i = 0; i < sizeof...(Ts); i++)
+    {
+        const auto offset = (end + sizes[i] - 1) / sizes[i] * sizes[i];
+        if(is_pointer[i])
+            result.push_back(offset);
+        end = offset + sizes[i];
+    }
+    return result;
+}
+
 struct HIPOCKernelInvoke
 {
     hipStream_t stream          = nullptr;
@@ -125,6 +148,9 @@ struct HIPOCKernelInvoke
     std::array<size_t, 3> gdims = {};
     std::string name;
     std::function<void(hipEvent_t, hipEvent_t)> callback;
+    // Set by Handle::Run() while the handle captures: the launches are appended to the list
+    // instead of being run.
+    std::shared_ptr<LaunchList> capture;
 
     // Workaround for aggregate types in c++11
     HIPOCKernelInvoke() {}
@@ -141,6 +167,9 @@ struct HIPOCKernelInvoke
     {
         char hip_args[256] = {0};
         auto sz_left       = any_args[0].size();
+        std::vector<std::size_t> pointers;
+        if(capture && any_args[0].is_ptr)
+            pointers.push_back(0);
 
         memcpy(hip_args, &(any_args[0].buffer[0]), any_args[0].size());
         //        copy_arg(any_args[0], hip_args, 0);
@@ -153,19 +182,44 @@ struct HIPOCKernelInvoke
             unsigned long second_index = sz_left + padding;
             memcpy(hip_args + second_index, &(any_arg.buffer[0]), any_arg.size());
             // copy_arg(any_arg, hip_args, second_index);
+            if(capture && any_arg.is_ptr)
+                pointers.push_back(second_index);
             sz_left = second_index + alignment;
         }
-        run(hip_args, sz_left);
+        if(capture)
+            record(hip_args, sz_left, std::move(pointers));
+        else
+            run(hip_args, sz_left);
+    }
+
+    void operator()(const OpKernelArgBlock& args) const
+    {
+        if(capture)
+        {
+            std::vector<std::size_t> pointers;
+            for(const auto& slot : args.slots)
+                if(slot.is_ptr)
+                    pointers.push_back(slot.offset);
+            record(args.data, args.size, std::move(pointers));
+        }
+        else
+        {
+            run(args.data, args.size);
+        }
     }
 
     template <class... Ts>
     void operator()(Ts... xs) const
     {
         KernelArgs<Ts...> args{xs...};
-        run(&args, sizeof(args));
+        if(capture)
+            record(&args, sizeof(args), PointerArgOffsets<Ts...>());
+        else
+            run(&args, sizeof(args));
     }
 
     void run(void* args, std::size_t size) const;
+    void record(const void* args, std::size_t size, std::vector<std::size_t> pointers) const;
 
     const std::string& GetName() const { return name; }
 };
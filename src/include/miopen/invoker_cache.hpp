@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include <miopen/conv/problem_key.hpp>
 #include <miopen/errors.hpp>
 #include <miopen/invoker.hpp>
 
@@ -34,6 +35,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
 
 namespace miopen {
@@ -43,12 +45,19 @@ class InvokerCache
     public:
     // network_config, solver_id
     using Key = std::pair<std::string, std::string>;
+    // problem key, solver_id value
+    using BinaryKey = std::pair<conv::ProblemKey, std::uint64_t>;
 
     boost::optional<const Invoker&> operator[](const Key& key) const;
+    // Same as above, but skips building and comparing the network config string.
+    boost::optional<const Invoker&> operator[](const BinaryKey& key) const;
     // For find 1.0
     boost::optional<const Invoker&> GetFound1_0(const std::string& network_config,
                                                 const std::string& algorithm) const;
     void Register(const Key& key, const Invoker& invoker);
+    // Also makes the invoker available by the binary key. Both keys must describe the same
+    // problem and solver.
+    void Register(const BinaryKey& binary_key, const Key& key, const Invoker& invoker);
     // For find 1.0
     void SetAsFound1_0(const std::string& network_config,
                        const std::string& algorithm,
@@ -64,8 +73,18 @@ class InvokerCache
         std::map<std::string, Invoker> invokers;
     };
 
+    struct BinaryKeyHash
+    {
+        std::size_t operator()(const BinaryKey& key) const
+        {
+            return std::hash<conv::ProblemKey>{}(key.first) ^ (key.second * 0x9e3779b97f4a7c15ull);
+        }
+    };
+
     // network_config -> Item
     std::map<std::string, Item> invokers;
+    // Points into invokers, whose entries are never replaced or removed.
+    std::unordered_map<BinaryKey, const Invoker*, BinaryKeyHash> binary_index;
 };
 
 } // namespace miopen
@@ -0,0 +1,92 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_LAUNCH_LIST_HPP_
+#define GUARD_MIOPEN_LAUNCH_LIST_HPP_
+
+#include <miopen/common.hpp>
+#include <miopen/kernel.hpp>
+#include <miopen/miopen.h>
+#include <miopen/object.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <iosfwd>
+#include <utility>
+#include <vector>
+
+namespace miopen {
+
+struct Handle;
+
+/// A kernel launch recorded by a handle instead of being run, see Handle::BeginCapture().
+struct CapturedLaunch
+{
+    KernelInvoke invoke;
+    /// Set instead of invoke for library calls (e.g. rocBLAS GEMMs): replays the call with the
+    /// recorded arguments on the given handle.
+    std::function<void(const Handle&, const std::vector<char>& args)> call;
+    std::vector<char> args;
+    /// Offsets of the buffer pointers among the arguments.
+    std::vector<std::size_t> pointer_offsets;
+};
+
+/// Moves the pointers into [from, from + size) by the distance between from and to.
+struct LaunchBinding
+{
+    ConstData_t from;
+    std::size_t size;
+    Data_t to;
+};
+
+/// The kernel launches of a sequence of operations, in the order they were issued. Replaying
+/// the list (Handle::Replay()) enqueues the kernels with the recorded arguments: the descriptor
+/// validation, solver selection and invoker lookup happened during the capture. The library
+/// calls among them (see CapturedLaunch::call) still do their own host setup on replay.
+struct LaunchList : miopenLaunchList
+{
+    void Add(CapturedLaunch launch) { launches.push_back(std::move(launch)); }
+
+    const std::vector<CapturedLaunch>& GetLaunches() const { return launches; }
+    std::vector<CapturedLaunch>& GetLaunches() { return launches; }
+
+    /// Redirects the pointer arguments to other buffers. Each pointer is moved by the first
+    /// binding that contains it; returns the number of pointers moved.
+    std::size_t Rebind(const std::vector<LaunchBinding>& bindings);
+
+    friend std::ostream& operator<<(std::ostream& stream, const LaunchList& list);
+
+    private:
+    std::vector<CapturedLaunch> launches;
+};
+
+/// A device to device copy of size bytes, recorded as a call to Handle::Copy().
+CapturedLaunch CaptureCopy(ConstData_t src, Data_t dest, std::size_t size);
+
+} // namespace miopen
+
+MIOPEN_DEFINE_OBJECT(miopenLaunchList, miopen::LaunchList);
+
+#endif // GUARD_MIOPEN_LAUNCH_LIST_HPP_
@@ -0,0 +1,81 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_LAYOUT_TRANSFORM_PLAN_HPP_
+#define GUARD_MIOPEN_LAYOUT_TRANSFORM_PLAN_HPP_
+
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace miopen {
+
+struct TensorDescriptor;
+struct TensorDims;
+
+/// What it takes to rewrite a tensor from the strides of x into the strides of y.
+enum class LayoutTransformKind
+{
+    View,             ///< x and y already put every element at the same place
+    BatchedTranspose, ///< x is packed [batch, height, width], y is packed [batch, width, height]
+    Generic,          ///< Any other strides
+};
+
+std::string ToString(LayoutTransformKind kind);
+
+/// The copy of x into y with the dimensions of length 1 removed, the others ordered from the
+/// largest to the smallest stride of y and adjacent dimensions merged wherever both tensors
+/// can walk them with a single stride.
+struct LayoutTransformPlan
+{
+    LayoutTransformKind kind = LayoutTransformKind::Generic;
+    std::vector<std::size_t> lens;
+    std::vector<std::size_t> x_strides;
+    std::vector<std::size_t> y_strides;
+
+    /// Lengths of the BatchedTranspose kind, all 1 for the other kinds.
+    std::size_t batch  = 1;
+    std::size_t height = 1;
+    std::size_t width  = 1;
+
+    std::size_t GetElementSize() const;
+
+    /// A View whose elements are one contiguous run, so the copy is a plain memory copy.
+    bool IsContiguous() const;
+
+    /// Builds the plan from the lengths shared by x and y and the strides of both.
+    static LayoutTransformPlan Make(const TensorDims& lens,
+                                    const TensorDims& x_strides,
+                                    const TensorDims& y_strides);
+
+    static LayoutTransformPlan Make(const TensorDescriptor& xDesc, const TensorDescriptor& yDesc);
+
+    friend std::ostream& operator<<(std::ostream& stream, const LayoutTransformPlan& plan);
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_LAYOUT_TRANSFORM_PLAN_HPP_
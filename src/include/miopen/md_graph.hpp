@@ -32,6 +32,7 @@
 #include <miopen/fusion.hpp>
 #include <miopen/any_solver.hpp>
 
+#include <memory>
 #include <unordered_map>
 
 namespace miopen {
@@ -73,6 +74,7 @@ struct MDGraph_vertex
     boost::optional<bool> supported_xnack = boost::none;
     size_t map_hash                       = 0;
     int id;
+    std::size_t graph_idx = 0; // position in the frozen graph, the root is 0
 
     MDGraph_vertex(const MDGraph_vertex& other) = delete;
     std::string& operator[](const std::string& x) { return vertex_data[x]; }
@@ -83,24 +85,28 @@ struct MDGraph_vertex
 };
 
 using MDGraph_vertex_ptr = std::shared_ptr<MDGraph_vertex>;
-using cur_vertex_map     = std::unordered_map<std::string, boost::any>;
 
+/// State of a path through the graph: the accumulated edge weight and, while the last
+/// operator is a convolution, the algorithm of the matched edge. The solver of the
+/// convolution vertex is kept for the rest of the path.
+struct MDGraph_path
+{
+    int weight = 0;
+    boost::optional<miopenConvFwdAlgorithm_t> algo;
+    solver::AnySolver solver;
+};
+
+struct FusionMDGraph_Table;
+
+/// Tracks the paths of a fusion plan through the metadata graph of its first operator. The
+/// graphs are built once per first operator and shared by all the plans, see Init().
 struct FusionMDGraph
 {
     FusionMDGraph() { Reset(); }
     static void Init(FusionMDGraph& g, miopenFusionOp_t op);
-    static void InitConv(FusionMDGraph& g);
-    static void InitBN(FusionMDGraph& g);
-    static void InitBNFwd(FusionMDGraph& g);
-    static void InitBNBwd(FusionMDGraph& g);
     void Reset();
     bool Advance(std::shared_ptr<FusionOpDescriptor> op,
                  std::function<bool(const std::string& sym, int& val)> attr_fun);
-    void AddEdge(MDGraph_vertex_ptr src, MDGraph_vertex_ptr dst, FusionMDGraph_Edge_Map& map);
-
-    bool CmpOpKey(const FusionMDGraph_Edge_Map& edge_val,
-                  std::function<bool(const std::string& sym, int& val)> attr_fun,
-                  std::unordered_map<std::string, int>& syms) const;
     MDGraph_vertex_ptr GetCurVertex(const Handle& handle);
     std::string GetProgramName(const Handle& handle);
     std::string GetKernelName(const Handle& handle);
@@ -109,14 +115,12 @@ struct FusionMDGraph
     std::vector<miopenConvFwdAlgorithm_t> GetConvAlgos() const;
     bool SetConvAlgo(miopenConvFwdAlgorithm_t algo);
     std::vector<solver::AnySolver> GetSolvers();
-    void WriteToFile(std::string filename = "");
+    void WriteToFile(std::string filename = "") const;
 
-    std::vector<std::pair<MDGraph_vertex_ptr, cur_vertex_map>> cur_vertex;
+    std::vector<std::pair<MDGraph_vertex_ptr, MDGraph_path>> cur_vertex;
     std::set<miopenConvFwdAlgorithm_t> conv_algo_set;
 
-    std::unordered_map<MDGraph_vertex_ptr,
-                       std::unordered_map<MDGraph_vertex_ptr, FusionMDGraph_Edge_Map_Vec>>
-        edge_list;
+    std::shared_ptr<const FusionMDGraph_Table> graph;
 };
 
 } // namespace miopen
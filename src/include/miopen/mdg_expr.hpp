@@ -8,9 +8,12 @@
 #include <miopen/logger.hpp>
 
 #include <cassert>
+#include <functional>
 #include <memory>
 #include <iostream>
+#include <string>
 #include <unordered_map>
+#include <vector>
 // Workaround tidy issues when using BOOST_FOREACH
 #ifdef MIOPEN_USE_CLANG_TIDY
 #define BOOST_FOREACH(x, y) for(x : y) // NOLINT
@@ -57,210 +60,80 @@ struct MDGExprParser : qi::grammar<Iterator, spirit::utree(), ascii::space_type>
     qi::rule<Iterator, std::string(), ascii::space_type> variable;
 };
 
-struct visit_res
-{
-    int res         = 0;
-    bool b_res      = false;
-    MDGraph_op_t op = OpAny;
-    std::string sym;
-    std::unordered_map<std::string, int> tabl;
-};
+/// Operator of an operator symbol produced by MDGExprParser.
+MDGraph_op_t MDGExprOp(const std::string& sym);
 
-struct tree_visit
+/// Symbol names of the constraint expressions, interned to dense ids.
+struct MDGExprSymbols
 {
-    std::unordered_map<std::string, int> tabl;
-    std::function<bool(const std::string&, int&)> var_lookup;
-
-    using result_type = visit_res;
-    tree_visit(){};
-    tree_visit(std::function<bool(const std::string&, int&)> f) : var_lookup(f){};
-    tree_visit(std::function<bool(const std::string&, int&)> f,
-               std::unordered_map<std::string, int> t)
-        : tabl(t), var_lookup(f){};
-    visit_res operator()(spirit::utree::invalid_type) const { return {}; }
-
-    visit_res operator()(spirit::utree::nil_type) const { return {}; };
+    int Intern(const std::string& name);
+    const std::string& Name(int id) const { return names[id]; }
+    std::size_t size() const { return names.size(); }
 
-    visit_res operator()(double d)
-    {
-        visit_res r;
-        r.res = static_cast<int>(d);
-        return r;
-    }
-
-    visit_res operator()(int i)
-    {
-        visit_res r;
-        r.res = i;
-        return r;
-    }
+    private:
+    std::unordered_map<std::string, int> ids;
+    std::vector<std::string> names;
+};
 
-    template <typename T>
-    visit_res operator()(T /*val*/)
+/// A graph constraint such as "c * x * y <= (2^28)" or "padded_x === (x ~ 3)", parsed once
+/// and stored in postfix form over symbol ids.
+struct MDGExprConstraint
+{
+    struct Instr
     {
-        return {};
-    }
+        enum Kind
+        {
+            Const, // push val
+            Symbol, // push the value of symbol val
+            Apply, // pop rhs and lhs, push (lhs op rhs)
+        };
+        Kind kind;
+        MDGraph_op_t op;
+        int val;
+    };
 
-    visit_res operator()(bool b)
-    {
-        visit_res r;
-        r.b_res = b;
-        return r;
-    }
+    static MDGExprConstraint
+    Compile(const MDGExprParser& parser, const std::string& expr, MDGExprSymbols& symbols);
 
-    visit_res operator()(spirit::binary_range_type const& /*b*/) const { return {}; }
+    std::string expr;
+    int assign_sym = -1; // "sym === rhs" assigns the value of code to sym
+    std::vector<Instr> code;
+};
 
-    visit_res operator()(spirit::utf8_string_range_type const& str)
-    {
-        visit_res r;
-        using iterator = spirit::utf8_string_range_type::const_iterator;
-        iterator i     = str.begin();
-        std::string sym(i, str.end());
-        int v = 0;
-        if(var_lookup(sym, v))
-        {
-            r.res = v;
-        }
-        else
-        {
-            if(tabl.count(sym) == 1)
-            {
-                r.res = tabl.at(sym);
-            }
-            else
-                r.sym = sym;
-        }
-        return r;
-    }
+/// Evaluates compiled constraints against the attributes of one operator. Every symbol is
+/// looked up with attr_fun at most once; the values assigned by the constraints of an edge
+/// are visible to the following constraints of the same edge until ResetLocals().
+struct MDGExprContext
+{
+    MDGExprContext(const MDGExprSymbols& s, std::function<bool(const std::string&, int&)> f);
+    bool Eval(const MDGExprConstraint& c);
+    void ResetLocals();
+    bool GetLocal(int sym, int& val) const;
 
-    visit_res operator()(spirit::utf8_symbol_range_type const& str)
+    private:
+    enum State : char
     {
-        using iterator = spirit::utf8_symbol_range_type::const_iterator;
-        iterator i     = str.begin();
-        std::string sym(i, str.end());
-        // This should return a function instead of a data struct
-        visit_res r;
-        if(sym == "+")
-            r.op = OpAdd;
-        else if(sym == "-")
-            r.op = OpSub;
-        else if(sym == "*")
-            r.op = OpMul;
-        else if(sym == "/")
-            r.op = OpDiv;
-        else if(sym == "%")
-            r.op = OpModulo;
-        else if(sym == ">=")
-            r.op = OpGTE;
-        else if(sym == "<=")
-            r.op = OpLTE;
-        else if(sym == "====")
-            r.op = OpEqual;
-        else if(sym == "!=")
-            r.op = OpNotEqual;
-        else if(sym == "^")
-            r.op = OpPow;
-        else if(sym == "&")
-            r.op = OpAnd;
-        else if(sym == "|")
-            r.op = OpOr;
-        else if(sym == "~")
-            r.op = OpCeil;
-        else if(sym == "===")
-            r.op = OpAssign;
-        else if(sym == ">>")
-            r.op = OpGT;
-        else if(sym == "<<")
-            r.op = OpLT;
-        else
-        {
-            MIOPEN_THROW(miopenStatusInternalError, "Parsing error: Unknown operator: " + sym);
-        }
-        return r;
-    }
-
-    template <typename Iterator>
-    visit_res operator()(boost::iterator_range<Iterator> const& range)
+        Unknown,
+        Found,
+        Missing,
+    };
+    struct Value
     {
-        std::vector<spirit::utree> v(range.begin(), range.end());
-        assert(v.size() == 3);
-        visit_res op_res, lhs_res, rhs_res, r;
-        op_res  = boost::spirit::utree::visit(v[0], *this);
-        lhs_res = boost::spirit::utree::visit(v[1], *this);
-        rhs_res = boost::spirit::utree::visit(v[2], *this);
-
-        if(op_res.op != OpAssign && !lhs_res.sym.empty())
-        {
-            std::string sym = lhs_res.sym;
-            MIOPEN_THROW("Invalid variable access: " + sym);
-        }
-
-        switch(op_res.op)
-        {
-        // Arith ops
-        case OpAdd: r.res = lhs_res.res + rhs_res.res; break;
-        case OpSub: r.res = lhs_res.res - rhs_res.res; break;
-        case OpMul: r.res = lhs_res.res * rhs_res.res; break;
-        case OpDiv: r.res = lhs_res.res / rhs_res.res; break;
-        case OpModulo: r.res = lhs_res.res % rhs_res.res; break;
-        case OpPow: r.res = static_cast<int>(std::pow(lhs_res.res, rhs_res.res)); break;
-        case OpCeil: {
-            int vv = lhs_res.res;
-            int mm = rhs_res.res;
-            r.res  = (vv % mm != 0) ? (vv / mm + 1) * mm : vv;
-            break;
-        }
-        case OpAssign: {
-            int val = 0;
-            if(var_lookup(lhs_res.sym, val))
-                MIOPEN_THROW("Invalid variable assignment: " + lhs_res.sym);
-            MIOPEN_LOG_I2(" Adding variable: " + lhs_res.sym);
-            r.tabl[lhs_res.sym] = rhs_res.res;
-            r.b_res             = true;
-            break;
-        }
-        // Logical ops
-        case OpEqual:
-            r.b_res = lhs_res.res == rhs_res.res;
-            r.res   = static_cast<int>(r.b_res);
-            break;
-        case OpNotEqual:
-            r.b_res = lhs_res.res != rhs_res.res;
-            r.res   = static_cast<int>(r.b_res);
-            break;
-        case OpGTE:
-            r.b_res = lhs_res.res >= rhs_res.res;
-            r.res   = static_cast<int>(r.b_res);
-            break;
-        case OpLTE:
-            r.b_res = lhs_res.res <= rhs_res.res;
-            r.res   = static_cast<int>(r.b_res);
-            break;
-        case OpGT:
-            r.b_res = lhs_res.res > rhs_res.res;
-            r.res   = static_cast<int>(r.b_res);
-            break;
-        case OpLT:
-            r.b_res = lhs_res.res < rhs_res.res;
-            r.res   = static_cast<int>(r.b_res);
-            break;
-        case OpAnd:
-            r.b_res = lhs_res.b_res && rhs_res.b_res;
-            r.res   = static_cast<int>(r.b_res);
-            break;
-        case OpOr:
-            r.b_res = lhs_res.b_res || rhs_res.b_res;
-            r.res   = static_cast<int>(r.b_res);
-            break;
-        case OpAny:
-        case OpEval: MIOPEN_THROW("Unsupported op");
-        }
-        return r;
-    }
+        int res        = 0;
+        bool b_res     = false;
+        int unresolved = -1; // symbol id of an unresolved variable
+    };
 
-    visit_res operator()(spirit::any_ptr const&) const { return {}; }
+    bool LookupAttr(int sym, int& val);
+    Value Apply(MDGraph_op_t op, const Value& lhs, const Value& rhs) const;
 
-    visit_res operator()(spirit::function_base const&) const { return {}; }
+    const MDGExprSymbols& symbols;
+    std::function<bool(const std::string&, int&)> attr_fun;
+    std::vector<State> attr_state;
+    std::vector<int> attr_val;
+    std::vector<char> local_set;
+    std::vector<int> local_val;
+    std::vector<Value> stack;
 };
 } // namespace miopen
 
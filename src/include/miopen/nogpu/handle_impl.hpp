@@ -60,6 +60,7 @@ struct HandleImpl
     KernelCache cache;
     std::int64_t ctx;
     TargetProperties target_properties;
+    std::shared_ptr<LaunchList> capture;
 };
 } // namespace miopen
 #endif // GUARD_MIOPEN_NOGPU_HANDLE_IMPL_HPP_
@@ -112,6 +112,23 @@ struct OCLKernelInvoke
         run();
     }
 
+    void operator()(const OpKernelArgBlock& args) const
+    {
+        for(size_t idx = 0; idx < args.slots.size(); idx++)
+        {
+            const auto& slot = args.slots[idx];
+            cl_int status    = clSetKernelArg(
+                kernel.get(), idx, slot.size, static_cast<const char*>(args.data) + slot.offset);
+            if(status != CL_SUCCESS)
+            {
+                MIOPEN_THROW("Error setting argument #" + std::to_string(idx) +
+                             " to kernel (size = " + std::to_string(slot.size) +
+                             "): " + OpenCLErrorMessage(status));
+            }
+        }
+        run();
+    }
+
     template <class... Ts>
     void operator()(const Ts&... xs) const
     {
@@ -2,7 +2,9 @@
 #define MIOPEN_GUARD_MLOPEN_OP_KERNEL_ARGS_HPP
 
 #include <type_traits>
+#include <cstddef>
 #include <cstdint>
+#include <vector>
 #include <half.hpp>
 
 #include <boost/container/small_vector.hpp>
@@ -32,4 +34,22 @@ struct OpKernelArg
     bool is_ptr = false;
 };
 
+/// Location of one kernel argument in an OpKernelArgBlock.
+struct OpKernelArgSlot
+{
+    std::size_t offset;
+    std::size_t size;
+    bool is_ptr;
+};
+
+/// Kernel arguments packed into one buffer ahead of time, with every argument aligned to its
+/// own size like HIPOCKernelInvoke lays out a list of OpKernelArg. The HIP backend passes the
+/// buffer to the kernel as is; the OpenCL backend sets the arguments from their slots.
+struct OpKernelArgBlock
+{
+    void* data;
+    std::size_t size;
+    const std::vector<OpKernelArgSlot>& slots;
+};
+
 #endif
@@ -0,0 +1,205 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_REDUCE_KERNEL_CONFIGURATOR_HPP
+#define GUARD_MIOPEN_REDUCE_KERNEL_CONFIGURATOR_HPP
+
+#include <miopen/errors.hpp>
+#include <miopen/miopen.h>
+
+#include <cassert>
+#include <cstddef>
+
+namespace miopen {
+
+enum ReductionMethod_t
+{
+    Reduce_DirectThreadWise = 1,
+    Reduce_DirectWarpWise   = 2,
+    Reduce_BlockWise        = 3,
+    Reduce_MultiBlock       = 4
+};
+
+namespace detail {
+
+struct ReductionKernelConfigurator
+{
+    ReductionKernelConfigurator() = default;
+
+    ReductionKernelConfigurator(int blockSize, int warpSize)
+        : blockSize_(blockSize), warpSize_(warpSize)
+    {
+        GredDirectThreadWiseUpperReductionLen = warpSize;
+        GredDirectWarpWiseUpperReductionLen   = blockSize;
+        GredBlockWiseUpperReductionLen        = blockSize * 4;
+        GredUpperNumBlocksPerReduction        = 32;
+
+        numWarpsPerBlock = blockSize / warpSize;
+    };
+
+    int blockSize_;
+    int warpSize_;
+    int numWarpsPerBlock;
+
+    std::size_t GredDirectThreadWiseUpperReductionLen;
+    std::size_t GredDirectWarpWiseUpperReductionLen;
+    std::size_t GredBlockWiseUpperReductionLen;
+    std::size_t GredUpperNumBlocksPerReduction;
+
+    std::size_t getGridSize(std::size_t invariantLength, std::size_t toReduceLength) const
+    {
+        assert(invariantLength > 0 && toReduceLength > 1);
+
+        if(invariantLength == 1)
+        {
+            if(toReduceLength <=
+               GredBlockWiseUpperReductionLen) // let one block to do this only reduction
+                return (1);
+            else
+                return ((toReduceLength + blockSize_ - 1) /
+                        blockSize_); // let multiple blocks to do this only reduction
+        }
+        else
+        {
+            if(toReduceLength <=
+               GredDirectThreadWiseUpperReductionLen) // let one thread to do each reduction
+                return ((invariantLength + blockSize_ - 1) / blockSize_);
+            else if(toReduceLength <=
+                    GredDirectWarpWiseUpperReductionLen) // let one warp to do each reduction
+                return ((invariantLength + numWarpsPerBlock - 1) / numWarpsPerBlock);
+            else if(toReduceLength <=
+                    GredBlockWiseUpperReductionLen) // let one block to do each reduction
+                return (invariantLength);
+            else
+            { // let multiple blocks to do each reduction
+                std::size_t expBlocksPerReduction =
+                    (toReduceLength + GredBlockWiseUpperReductionLen - 1) /
+                    GredBlockWiseUpperReductionLen;
+
+                if(expBlocksPerReduction > GredUpperNumBlocksPerReduction)
+                    return (invariantLength * GredUpperNumBlocksPerReduction);
+                else
+                    return (invariantLength * expBlocksPerReduction);
+            };
+        };
+    };
+
+    ReductionMethod_t getReductionMethod(std::size_t invariantLength,
+                                         std::size_t toReduceLength) const
+    {
+        assert(invariantLength > 0 && toReduceLength > 1);
+
+        if(invariantLength == 1)
+        {
+            if(toReduceLength <=
+               GredBlockWiseUpperReductionLen) // let one block to do this only reduction
+                return (Reduce_BlockWise);
+            else // let multiple blocks to do this only reduction
+                return (Reduce_MultiBlock);
+        }
+        else
+        {
+            if(toReduceLength <=
+               GredDirectThreadWiseUpperReductionLen) // let one thread to do each reduction
+                return (Reduce_DirectThreadWise);
+            else if(toReduceLength <=
+                    GredDirectWarpWiseUpperReductionLen) // let one warp to do each reduction
+                return (Reduce_DirectWarpWise);
+            else if(toReduceLength <=
+                    GredBlockWiseUpperReductionLen) // let one block to do each reduction
+                return (Reduce_BlockWise);
+            else
+                return (Reduce_MultiBlock); // let multiple blocks to do each reduction
+        };
+    };
+
+    std::size_t getWorkspaceSize(std::size_t invariantLength, std::size_t toReduceLength) const
+    {
+        assert(invariantLength > 0 && toReduceLength > 1);
+
+        if(getReductionMethod(invariantLength, toReduceLength) == Reduce_MultiBlock)
+        {
+            auto gridSize = getGridSize(invariantLength, toReduceLength);
+
+            return (gridSize);
+        };
+
+        return (0);
+    };
+
+    std::size_t getGridSize_2(std::size_t invariantLength, std::size_t toReduceLength) const
+    {
+        if(toReduceLength <= warpSize_ / 4) // let one thread to do each reduction
+            return ((invariantLength + blockSize_ - 1) / blockSize_);
+        else if(toReduceLength <= blockSize_) // let one warp to do each reduction
+            return ((invariantLength + numWarpsPerBlock - 1) / numWarpsPerBlock);
+        else
+            return (invariantLength); // let one block to do each reduction
+    };
+
+    ReductionMethod_t GetReductionMethod_2(std::size_t toReduceLength) const
+    {
+        if(toReduceLength <= warpSize_ / 4) // let one thread to do each reduction
+            return (Reduce_DirectThreadWise);
+        else if(toReduceLength <= blockSize_) // let one warp to do each reduction
+            return (Reduce_DirectWarpWise);
+        else
+            return (Reduce_BlockWise);
+    };
+};
+
+inline int GetIndicesTypeSize(miopenIndicesType_t t)
+{
+    switch(t)
+    {
+    case MIOPEN_32BIT_INDICES: return (4);
+    case MIOPEN_64BIT_INDICES: return (8);
+    case MIOPEN_16BIT_INDICES: return (2);
+    case MIOPEN_8BIT_INDICES: return (1);
+    }
+    MIOPEN_THROW("Unknown data type");
+}
+
+inline int GetDataTypeSize(miopenDataType_t t)
+{
+    switch(t)
+    {
+    case miopenHalf: return (2);
+    case miopenFloat: return (4);
+    case miopenDouble: return (8);
+    case miopenInt8: return (1);
+    case miopenInt8x4: return (4);
+    case miopenBFloat16: return (2);
+    case miopenInt32: return (4);
+    default:
+        MIOPEN_THROW("Only float, half, double, bfloat16, int8, int8x4 data type is supported.");
+    };
+};
+
+}; // end of namespace detail
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_REDUCE_KERNEL_CONFIGURATOR_HPP
@@ -0,0 +1,101 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#pragma once
+
+#include <miopen/db.hpp>
+#include <miopen/execution_context.hpp>
+#include <miopen/ramdb.hpp>
+#include <miopen/readonlyramdb.hpp>
+#include <miopen/reducetensor.hpp>
+#include <miopen/tensor.hpp>
+
+#include <cstddef>
+#include <ostream>
+
+namespace miopen {
+
+struct NetworkConfig;
+
+namespace reduce {
+
+struct ProblemDescription
+{
+    ProblemDescription(const ReduceTensorDescriptor& reduceDesc_,
+                       const TensorDescriptor& aDesc_,
+                       const TensorDescriptor& cDesc_)
+        : reduceDesc(reduceDesc_), aDesc(aDesc_), cDesc(cDesc_)
+    {
+    }
+
+    const ReduceTensorDescriptor& GetReduceDesc() const { return reduceDesc; }
+    const TensorDescriptor& GetADesc() const { return aDesc; }
+    const TensorDescriptor& GetCDesc() const { return cDesc; }
+
+    std::size_t GetInvariantLength() const { return cDesc.GetElementSize(); }
+    std::size_t GetToReduceLength() const
+    {
+        return aDesc.GetElementSize() / cDesc.GetElementSize();
+    }
+
+    /// Number of dimensions whose output length differs from the input length.
+    std::size_t GetNumToReduceDims() const;
+    bool IsAllDimsReduced() const { return GetNumToReduceDims() == aDesc.GetLengths().size(); }
+    bool NeedIndices() const;
+
+    NetworkConfig MakeNetworkConfig() const;
+
+    void Serialize(std::ostream& stream) const;
+
+    friend std::ostream& operator<<(std::ostream& os, const ProblemDescription& obj)
+    {
+        obj.Serialize(os);
+        return os;
+    }
+
+    private:
+    ReduceTensorDescriptor reduceDesc;
+    TensorDescriptor aDesc;
+    TensorDescriptor cDesc;
+};
+
+struct ReductionContext : ProblemDescription, ExecutionContext
+{
+    ReductionContext(const ProblemDescription& problem) : ProblemDescription(problem) {}
+
+    bool is_for_generic_search = false;
+};
+
+/// Tuned reduction configurations are kept in plain text files next to the convolution ones
+/// (<arch>.reduce.pdb.txt and <arch>.<suffix>.reduce.updb.txt): the SQLite perf-db schema is
+/// specific to convolution problems.
+using PerformanceDb = DbTimer<MultiFileDb<ReadonlyRamDb, RamDb, true>>;
+
+PerformanceDb GetDb(const ReductionContext& ctx);
+
+} // namespace reduce
+
+} // namespace miopen
@@ -0,0 +1,96 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#pragma once
+
+#include <miopen/solver.hpp>
+#include <miopen/reduce/problem_description.hpp>
+
+#include <string>
+
+namespace miopen {
+
+namespace solver {
+
+namespace reduce {
+
+using ReductionContext = miopen::reduce::ReductionContext;
+
+/// Tunables of the composable kernel generic reduction. Only the values used by the reduction
+/// method(s) selected for the problem are searched; the others stay at their defaults.
+struct PerformanceConfigGenericReduction : Serializable<PerformanceConfigGenericReduction>
+{
+    int BlockSize;                    // 2^n[64..1024], a multiple of the wavefront size
+    int GredThreadBufferLength;       // 2^n[1..16], thread-wise reduction
+    int GredAccessesPerThreadInBlock; // 2^n[1..4], block-wise and multi-block reduction
+    int GredAccessesPerThreadInWarp;  // 2^n[1..4], warp-wise reduction
+
+    PerformanceConfigGenericReduction(int block_size,
+                                      int thread_buffer_length,
+                                      int accesses_per_thread_in_block,
+                                      int accesses_per_thread_in_warp);
+    PerformanceConfigGenericReduction() : PerformanceConfigGenericReduction(-1, -1, -1, -1) {}
+    PerformanceConfigGenericReduction(bool) : PerformanceConfigGenericReduction(64, 1, 1, 1) {}
+
+    template <class Self, class F>
+    static void Visit(Self&& self, F f)
+    {
+        f(self.BlockSize, "BlockSize");
+        f(self.GredThreadBufferLength, "GredThreadBufferLength");
+        f(self.GredAccessesPerThreadInBlock, "GredAccessesPerThreadInBlock");
+        f(self.GredAccessesPerThreadInWarp, "GredAccessesPerThreadInWarp");
+    }
+
+    void HeuristicInit(const ReductionContext& ctx);
+    bool IsValidValue() const;
+    bool SetNextValue(const ReductionContext& ctx);
+    bool IsValid(const ReductionContext& ctx) const;
+    bool operator==(const PerformanceConfigGenericReduction& other) const;
+    std::string ToString() const;
+};
+
+struct GenericReduction : SolverBase<ReductionContext>
+{
+    bool IsApplicable(const ReductionContext& ctx) const;
+    bool IsDynamic() const { return true; }
+    /// Does not depend on the performance config: it covers the largest multi-block grid over
+    /// all block sizes that may be selected.
+    std::size_t GetWorkspaceSize(const ReductionContext& ctx) const;
+    PerformanceConfigGenericReduction GetPerformanceConfig(const ReductionContext& ctx) const;
+    bool IsValidPerformanceConfig(const ReductionContext& ctx,
+                                  const PerformanceConfigGenericReduction& config) const;
+    PerformanceConfigGenericReduction Search(const ReductionContext& ctx,
+                                             const AnyInvokeParams& invoke_ctx) const;
+    ConvSolution GetSolution(const ReductionContext& ctx,
+                             const PerformanceConfigGenericReduction& config,
+                             bool disableConfigOverrideFromEnv = false) const;
+};
+
+} // namespace reduce
+
+} // namespace solver
+
+} // namespace miopen
@@ -56,12 +56,12 @@ struct ReduceTensorDescriptor : miopenReduceTensorDescriptor
     miopenReduceTensorIndices_t reduceTensorIndices_;
     miopenIndicesType_t reduceTensorIndicesType_;
 
-    std::size_t GetWorkspaceSize(const Handle& handle,
+    std::size_t GetWorkspaceSize(Handle& handle,
                                  const TensorDescriptor& inDesc,
                                  const TensorDescriptor& outDesc) const;
     std::size_t GetIndicesSize(const TensorDescriptor& inDesc,
                                const TensorDescriptor& outDesc) const;
-    void ReduceTensor(const Handle& handle,
+    void ReduceTensor(Handle& handle,
                       Data_t indices,
                       size_t indicesSizeInBytes,
                       Data_t workspace,
@@ -76,6 +76,25 @@ struct ReduceTensorDescriptor : miopenReduceTensorDescriptor
 
 std::ostream& operator<<(std::ostream& stream, const ReduceTensorDescriptor& c);
 
+// Computes up to four reductions of A over the same dimensions in one pass over the input. All
+// outputs share cDesc, alpha and beta; none of the reductions may produce indices.
+std::size_t
+GetReduceTensorMultiWorkspaceSize(Handle& handle,
+                                  const std::vector<const ReduceTensorDescriptor*>& descs,
+                                  const TensorDescriptor& aDesc,
+                                  const TensorDescriptor& cDesc);
+
+void ReduceTensorMulti(Handle& handle,
+                       const std::vector<const ReduceTensorDescriptor*>& descs,
+                       Data_t workspace,
+                       size_t workspaceSizeInBytes,
+                       const void* alpha,
+                       const TensorDescriptor& aDesc,
+                       ConstData_t A,
+                       const void* beta,
+                       const TensorDescriptor& cDesc,
+                       const std::vector<Data_t>& C);
+
 } // namespace miopen
 MIOPEN_DEFINE_OBJECT(miopenReduceTensorDescriptor, miopen::ReduceTensorDescriptor);
 
@@ -102,6 +102,10 @@ struct RNNDescriptor : miopenRNNDescriptor
     miopenDataType_t dataType;
     std::size_t typeSize;
     miopenDropoutDescriptor_t dropoutDesc{};
+    // Maximum number of streams of the layer/step wavefront of RNNForwardInference, 0 when off.
+    std::size_t wavefrontStreams = 0;
+    // Layout of the weight matrices in w, see PrepareWeights.
+    miopenRNNWeightLayout_t weightLayout = miopenRNNWeightsCanonical;
 
     size_t biasOffsetCalculation(const TensorDescriptor& xDesc, int layer, int biasID) const;
 
@@ -110,6 +114,12 @@ struct RNNDescriptor : miopenRNNDescriptor
     std::vector<int>
     pTensorLengthsCalculation(const TensorDescriptor& xDesc, int layer, int paramID) const;
 
+    // Offset and (possibly strided) descriptor of a parameter matrix in the weight layout.
+    size_t paramsViewCalculation(const TensorDescriptor& xDesc,
+                                 int layer,
+                                 int paramID,
+                                 TensorDescriptor& viewDesc) const;
+
     size_t GetWorkspaceSize(Handle& handle,
                             int seqLength,
                             c_array_view<const miopenTensorDescriptor_t> xDesc) const;
@@ -167,6 +177,14 @@ struct RNNDescriptor : miopenRNNDescriptor
                       const TensorDescriptor& biasDesc,
                       ConstData_t bias) const;
 
+    // Copies canonical weights w into the prepared layout, casting them to dataType.
+    void PrepareWeights(Handle& handle,
+                        const TensorDescriptor& xDesc,
+                        const TensorDescriptor& wDesc,
+                        ConstData_t w,
+                        const TensorDescriptor& preparedDesc,
+                        Data_t prepared) const;
+
     void GetLayerParamOffset(int layer,
                              const TensorDescriptor& xDesc,
                              int paramID,
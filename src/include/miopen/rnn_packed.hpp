@@ -0,0 +1,190 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_RNN_PACKED_HPP_
+#define GUARD_MIOPEN_RNN_PACKED_HPP_
+
+#include <miopen/allocator.hpp>
+#include <miopen/common.hpp>
+#include <miopen/miopen.h>
+#include <miopen/object.hpp>
+#include <miopen/rnn.hpp>
+#include <miopen/rnn_plan.hpp>
+#include <miopen/tensor.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iosfwd>
+#include <vector>
+
+namespace miopen {
+
+struct Handle;
+
+/// Variable-length sequences in the order the RNN needs them.
+///
+/// The sequences are given sequence-major and without padding: sequence b is the rows
+/// [GetOffset(b), GetOffset(b) + lengths[b]) of the packed tensor. The RNN takes them time-major
+/// with a batch that never grows from one step to the next, which is what sorting the sequences
+/// by decreasing length gives: the row of the sequence of rank r at step t is
+/// GetStepOffset(t) + r. The sort is stable, so the order only depends on the lengths.
+struct RNNSequencePacking
+{
+    explicit RNNSequencePacking(std::vector<int> lengths_);
+
+    int GetSequenceCount() const { return static_cast<int>(lengths.size()); }
+    int GetMaxLength() const { return static_cast<int>(batch_sizes.size()); }
+    int GetTotalLength() const { return static_cast<int>(sort_rows.size()); }
+
+    const std::vector<int>& GetLengths() const { return lengths; }
+    /// Number of sequences still running at each step, never increasing.
+    const std::vector<int>& GetBatchSizes() const { return batch_sizes; }
+    /// The sequence of each rank.
+    const std::vector<int>& GetOrder() const { return order; }
+    int GetOffset(int sequence) const { return offsets[sequence]; }
+    int GetStepOffset(int step) const { return step_offsets[step]; }
+
+    /// Gather indices from the packed rows to the time-major rows and back.
+    const std::vector<int>& GetSortRows() const { return sort_rows; }
+    const std::vector<int>& GetUnsortRows() const { return unsort_rows; }
+
+    /// Gather indices of hidden states with slices of GetSequenceCount() rows each, from the
+    /// sequence order to the rank order and back.
+    std::vector<int> GetSortStateRows(int slices) const;
+    std::vector<int> GetUnsortStateRows(int slices) const;
+
+    friend std::ostream& operator<<(std::ostream& stream, const RNNSequencePacking& packing);
+
+    private:
+    std::vector<int> lengths;
+    std::vector<int> order;
+    std::vector<int> rank;
+    std::vector<int> offsets;
+    std::vector<int> batch_sizes;
+    std::vector<int> step_offsets;
+    std::vector<int> sort_rows;
+    std::vector<int> unsort_rows;
+};
+
+/// Host reference of RNNGatherRows(): dst row i = src row index[i], for rows of row_size
+/// contiguous elements.
+template <class T>
+void GatherRows(const T* src, T* dst, const std::vector<int>& index, std::size_t row_size)
+{
+    for(std::size_t i = 0; i < index.size(); ++i)
+    {
+        const auto* row = src + static_cast<std::size_t>(index[i]) * row_size;
+        std::copy(row, row + row_size, dst + i * row_size);
+    }
+}
+
+/// An RNN plan for a batch of variable-length sequences given packed, sequence-major and
+/// without padding (see RNNSequencePacking), with the hidden states in the order of the
+/// sequences.
+///
+/// Each pass gathers its inputs into the sorted time-major order with one launch per buffer,
+/// runs the passes of an RNNPlan on them and gathers the outputs back the same way. The sorted
+/// copies live in the workspace after the workspace of the RNN plan; the gather indices are
+/// uploaded once when the plan is created.
+struct RNNPackedPlan : miopenRNNPackedPlan
+{
+    RNNPackedPlan(Handle& handle,
+                  const RNNDescriptor& rnn,
+                  std::vector<int> lengths,
+                  const TensorDescriptor& xDesc,
+                  const TensorDescriptor& hxDesc,
+                  const TensorDescriptor& wDesc,
+                  const TensorDescriptor& yDesc);
+
+    std::size_t GetWorkspaceSize() const { return workspace_size; }
+    const RNNSequencePacking& GetPacking() const { return packing; }
+
+    /// The buffers of RNNDescriptor::RNNForwardInference, with x and y packed and hx, cx, hy and
+    /// cy in the order of the sequences. Not thread safe, like RNNPlan.
+    void ForwardInference(Handle& handle,
+                          ConstData_t x,
+                          ConstData_t hx,
+                          ConstData_t cx,
+                          ConstData_t w,
+                          Data_t y,
+                          Data_t hy,
+                          Data_t cy,
+                          Data_t workSpace,
+                          std::size_t workSpaceSize);
+
+    friend std::ostream& operator<<(std::ostream& stream, const RNNPackedPlan& plan);
+
+    private:
+    enum Staging
+    {
+        SortedX,
+        SortedY,
+        SortedHx,
+        SortedCx,
+        SortedHy,
+        SortedCy,
+        StagingCount,
+    };
+
+    enum Index
+    {
+        SortRows,
+        UnsortRows,
+        SortStateRows,
+        UnsortStateRows,
+        IndexCount,
+    };
+
+    /// Gathers index of rows of row_size elements from src to dst.
+    void Gather(const Handle& handle,
+                ConstData_t src,
+                Data_t dst,
+                Index index,
+                int rows,
+                int row_size) const;
+
+    RNNSequencePacking packing;
+    std::vector<TensorDescriptor> x_descs;
+    std::vector<TensorDescriptor> y_descs;
+    std::vector<miopenTensorDescriptor_t> x_desc_handles;
+    std::vector<miopenTensorDescriptor_t> y_desc_handles;
+    RNNPlan plan;
+    miopenDataType_t data_type;
+    int input_size;
+    int output_size;
+    int state_rows;
+    int hidden_size;
+    std::array<std::size_t, StagingCount> staging_offsets{};
+    std::array<std::size_t, StagingCount> staging_sizes{};
+    std::size_t workspace_size = 0;
+    std::array<std::size_t, IndexCount> index_offsets{};
+    Allocator::ManageDataPtr indices;
+};
+
+} // namespace miopen
+MIOPEN_DEFINE_OBJECT(miopenRNNPackedPlan, miopen::RNNPackedPlan);
+
+#endif // GUARD_MIOPEN_RNN_PACKED_HPP_
@@ -0,0 +1,197 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_RNN_PLAN_HPP_
+#define GUARD_MIOPEN_RNN_PLAN_HPP_
+
+#include <miopen/common.hpp>
+#include <miopen/launch_list.hpp>
+#include <miopen/miopen.h>
+#include <miopen/object.hpp>
+#include <miopen/rnn.hpp>
+#include <miopen/tensor.hpp>
+
+#include <array>
+#include <cstddef>
+#include <iosfwd>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace miopen {
+
+struct Handle;
+
+/// An RNN bound to its sequence length and tensor descriptors.
+///
+/// The first call of each pass (and of each combination of optional buffers) runs the regular
+/// RNNDescriptor code path with the handle capturing: the tensor descriptors, GEMM descriptors
+/// and kernel lookups are resolved once and kept as a launch list, recorded with the buffers of
+/// that call. Later calls only write their buffers into the recorded arguments and replay the
+/// list. The GEMMs are replayed as rocBLAS calls, which redo the host setup of rocBLAS on every
+/// replay: rocBLAS has no interface that hands out the kernel and arguments it resolved. Calls
+/// with overlapping buffers, and all the calls without launch capture (OpenCL backend), run
+/// RNNDescriptor directly.
+struct RNNPlan : miopenRNNPlan
+{
+    RNNPlan(Handle& handle,
+            const RNNDescriptor& rnn,
+            int seqLen,
+            c_array_view<const miopenTensorDescriptor_t> xDesc,
+            const TensorDescriptor& hxDesc,
+            const TensorDescriptor& wDesc,
+            c_array_view<const miopenTensorDescriptor_t> yDesc);
+
+    std::size_t GetWorkspaceSize() const { return workspace_size; }
+    std::size_t GetReserveSize() const { return reserve_size; }
+
+    /// The passes take the buffers of the matching RNNDescriptor calls. They are not thread
+    /// safe: the recorded launches are updated in place.
+    void ForwardInference(Handle& handle,
+                          ConstData_t x,
+                          ConstData_t hx,
+                          ConstData_t cx,
+                          ConstData_t w,
+                          Data_t y,
+                          Data_t hy,
+                          Data_t cy,
+                          Data_t workSpace,
+                          std::size_t workSpaceSize);
+
+    void ForwardTraining(Handle& handle,
+                         ConstData_t x,
+                         ConstData_t hx,
+                         ConstData_t cx,
+                         ConstData_t w,
+                         Data_t y,
+                         Data_t hy,
+                         Data_t cy,
+                         Data_t workSpace,
+                         std::size_t workSpaceSize,
+                         Data_t reserveSpace,
+                         std::size_t reserveSpaceSize);
+
+    void BackwardData(Handle& handle,
+                      ConstData_t y,
+                      ConstData_t dy,
+                      ConstData_t dhy,
+                      ConstData_t dcy,
+                      ConstData_t w,
+                      ConstData_t hx,
+                      ConstData_t cx,
+                      Data_t dx,
+                      Data_t dhx,
+                      Data_t dcx,
+                      Data_t workSpace,
+                      std::size_t workSpaceSize,
+                      Data_t reserveSpace,
+                      std::size_t reserveSpaceSize);
+
+    void BackwardWeights(Handle& handle,
+                         ConstData_t x,
+                         ConstData_t hx,
+                         ConstData_t y,
+                         Data_t dw,
+                         Data_t workSpace,
+                         std::size_t workSpaceSize,
+                         ConstData_t reserveSpace,
+                         std::size_t reserveSpaceSize);
+
+    /// Number of launches recorded over all the passes run so far.
+    std::size_t GetRecordedLaunchCount() const;
+
+    friend std::ostream& operator<<(std::ostream& stream, const RNNPlan& plan);
+
+    private:
+    enum Buffer
+    {
+        X,
+        Hx,
+        Cx,
+        W,
+        Y,
+        Hy,
+        Cy,
+        Dx,
+        Dhx,
+        Dcx,
+        Dy,
+        Dhy,
+        Dcy,
+        Dw,
+        WorkSpace,
+        ReserveSpace,
+        BufferCount,
+    };
+
+    enum class Pass
+    {
+        ForwardInference,
+        ForwardTraining,
+        BackwardData,
+        BackwardWeights,
+    };
+
+    using Buffers = std::array<Data_t, BufferCount>;
+
+    /// Moves the pointer argument at offset of a launch into a buffer of the pass.
+    struct Patch
+    {
+        std::size_t launch;
+        std::size_t offset;
+        Buffer buffer;
+        std::size_t delta;
+    };
+
+    struct Recording
+    {
+        LaunchList launches;
+        std::vector<Patch> patches;
+    };
+
+    void Run(Handle& handle, Pass pass, const Buffers& buffers) const;
+    void Execute(Handle& handle, Pass pass, const Buffers& buffers);
+    Recording Record(Handle& handle, Pass pass, const Buffers& buffers) const;
+    bool Overlap(const Buffers& buffers) const;
+
+    RNNDescriptor rnn;
+    int seq_len;
+    std::vector<TensorDescriptor> x_descs;
+    std::vector<TensorDescriptor> y_descs;
+    std::vector<miopenTensorDescriptor_t> x_desc_handles;
+    std::vector<miopenTensorDescriptor_t> y_desc_handles;
+    TensorDescriptor hx_desc;
+    TensorDescriptor w_desc;
+    std::size_t workspace_size = 0;
+    std::size_t reserve_size   = 0;
+    std::array<std::size_t, BufferCount> buffer_sizes{};
+    // By pass and by the mask of the buffers that were not null.
+    std::map<std::pair<Pass, unsigned>, Recording> recordings;
+};
+
+} // namespace miopen
+MIOPEN_DEFINE_OBJECT(miopenRNNPlan, miopen::RNNPlan);
+
+#endif // GUARD_MIOPEN_RNN_PLAN_HPP_
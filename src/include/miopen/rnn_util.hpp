@@ -90,6 +90,16 @@ void LSTMBackwardHiddenStateUpdate(const Handle& handle,
                                    std::size_t dcell_offset_pre,
                                    std::size_t dhidden_offset,
                                    std::size_t f_offset_pre);
+
+/// dst row i = src row index[index_offset + i] for rows of row_size contiguous elements.
+void RNNGatherRows(const Handle& handle,
+                   miopenDataType_t rnn_data_type,
+                   ConstData_t src,
+                   Data_t dst,
+                   ConstData_t index,
+                   std::size_t index_offset,
+                   int rows,
+                   int row_size);
 } // namespace miopen
 
 #endif // GUARD_MIOPEN_RNN_UTIL_HPP_
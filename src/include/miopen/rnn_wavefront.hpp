@@ -0,0 +1,111 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_RNN_WAVEFRONT_HPP_
+#define GUARD_MIOPEN_RNN_WAVEFRONT_HPP_
+
+#include <cstddef>
+#include <functional>
+#include <iosfwd>
+#include <vector>
+
+namespace miopen {
+
+struct Handle;
+
+/// The work of one layer at one time step of a stacked RNN.
+struct RNNWavefrontTask
+{
+    int layer;
+    int step;
+    std::size_t stream;
+};
+
+/// Task to must not start before task from has finished.
+struct RNNWavefrontEdge
+{
+    std::size_t from;
+    std::size_t to;
+};
+
+/// One operation of the host program that issues a schedule.
+struct RNNWavefrontOp
+{
+    enum Kind
+    {
+        Fork,   // stream waits for the work queued on the stream of the handle so far
+        Wait,   // stream waits for the event recorded after task
+        Run,    // the work of task is enqueued on stream
+        Record, // an event is recorded on stream after task
+        Join,   // the stream of the handle waits for all the work queued on stream
+    };
+
+    Kind kind;
+    std::size_t stream;
+    std::size_t task;
+    std::size_t event; // Wait and Record only
+};
+
+/// Schedule of the layers and steps of a stacked unidirectional RNN over a small pool of streams.
+///
+/// The first step of layer l projects the output of layer l - 1 over the whole sequence, with
+/// the same GEMM as the default schedule, so it depends on the last step of layer l - 1. The
+/// following steps only run the recurrence and depend on (l, t - 1). Tasks are issued layer by
+/// layer, and all the steps of a layer go to the same stream (layer modulo the number of
+/// streams), which makes the time dependencies implicit in the stream order. Only the
+/// dependencies between layers on different streams need events. The schedule only depends on
+/// its sizes, so every execution issues the same work in the same order.
+struct RNNWavefrontSchedule
+{
+    RNNWavefrontSchedule(int layers, int seq_len, std::size_t streams);
+
+    /// In issue order.
+    const std::vector<RNNWavefrontTask>& GetTasks() const { return tasks; }
+    const std::vector<RNNWavefrontEdge>& GetEdges() const { return edges; }
+    const std::vector<RNNWavefrontOp>& GetProgram() const { return program; }
+    std::size_t GetStreamCount() const { return stream_count; }
+    /// Events are reused once every wait on their previous record has been issued.
+    std::size_t GetEventCount() const { return event_count; }
+
+    /// Runs the program: run(task) must enqueue the work of the task on the stream of the handle.
+    /// The streams are auxiliary streams of the handle, forked from and joined back into its
+    /// stream. While the handle is capturing and without a GPU, the tasks are only run in issue
+    /// order on the stream of the handle, which is a valid serial order.
+    void Execute(const Handle& handle,
+                 const std::function<void(const RNNWavefrontTask&)>& run) const;
+
+    friend std::ostream& operator<<(std::ostream& stream, const RNNWavefrontSchedule& schedule);
+
+    private:
+    std::size_t stream_count;
+    std::size_t event_count = 0;
+    std::vector<RNNWavefrontTask> tasks;
+    std::vector<RNNWavefrontEdge> edges;
+    std::vector<RNNWavefrontOp> program;
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_RNN_WAVEFRONT_HPP_
@@ -27,9 +27,24 @@
 #ifndef GUARD_MLOPEN_SIMPLE_HASH_HPP
 #define GUARD_MLOPEN_SIMPLE_HASH_HPP
 
+#include <cstdint>
 #include <string>
 
 namespace miopen {
+
+/// Starting value for HashCombine().
+constexpr std::uint64_t HashSeed = 0xcbf29ce484222325ull;
+
+/// Mixes v into the running hash h with the splitmix64 finalizer, so that every input bit
+/// affects every output bit. Used for the fixed-size cache keys, which are hashed once.
+inline std::uint64_t HashCombine(std::uint64_t h, std::uint64_t v)
+{
+    v += 0x9e3779b97f4a7c15ull + h;
+    v = (v ^ (v >> 30)) * 0xbf58476d1ce4e5b9ull;
+    v = (v ^ (v >> 27)) * 0x94d049bb133111ebull;
+    return v ^ (v >> 31);
+}
+
 struct SimpleHash
 {
     size_t operator()(const std::pair<std::string, std::string>& p) const
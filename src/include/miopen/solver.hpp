@@ -3341,6 +3341,7 @@ struct mlo_construct_direct2D_fusion : mlo_construct_base
     }
 
     bool IsAutoTuneEnabled() const { return _search_params.do_search; }
+    void setDoSearch(bool do_search) { _search_params.do_search = do_search; }
 
     inline void mloCopyTo(miopen::ConvolutionContext& params) const /// TODO: get rid of this
     {
@@ -49,6 +49,7 @@ enum class Primitive
     Activation,
     Batchnorm,
     Pooling,
+    Reduce,
 };
 
 struct Id
@@ -34,8 +34,12 @@
 #include <miopen/errors.hpp>
 #include <miopen/functional.hpp>
 
+#include <boost/container/small_vector.hpp>
+
 #include <algorithm>
+#include <array>
 #include <cassert>
+#include <cstdint>
 #include <numeric>
 #include <vector>
 
@@ -118,6 +122,45 @@ std::ptrdiff_t integer_division_ceil(X x, Y y)
     return (tx + ty - 1) / ty;
 }
 
+/// Lengths or strides of a tensor. Up to 8 of them are stored in place, so creating and copying
+/// descriptors of any tensor MIOpen works with does not allocate.
+struct TensorDims : boost::container::small_vector<std::size_t, 8>
+{
+    using Base = boost::container::small_vector<std::size_t, 8>;
+    using Base::Base;
+
+    TensorDims() = default;
+    TensorDims(const std::vector<std::size_t>& v) : Base(v.begin(), v.end()) {}
+
+    // Most of the library still passes dimensions around as vectors.
+    operator std::vector<std::size_t>() const { return {begin(), end()}; }
+
+    // Exact overloads, so that comparing two TensorDims does not compete with the conversion
+    // to std::vector.
+    friend bool operator==(const TensorDims& lhs, const TensorDims& rhs)
+    {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+    friend bool operator!=(const TensorDims& lhs, const TensorDims& rhs) { return !(lhs == rhs); }
+
+    friend bool operator==(const TensorDims& lhs, const std::vector<std::size_t>& rhs)
+    {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+    friend bool operator==(const std::vector<std::size_t>& lhs, const TensorDims& rhs)
+    {
+        return rhs == lhs;
+    }
+    friend bool operator!=(const TensorDims& lhs, const std::vector<std::size_t>& rhs)
+    {
+        return !(lhs == rhs);
+    }
+    friend bool operator!=(const std::vector<std::size_t>& lhs, const TensorDims& rhs)
+    {
+        return !(rhs == lhs);
+    }
+};
+
 struct TensorDescriptor : miopenTensorDescriptor
 {
     TensorDescriptor();
@@ -144,12 +187,13 @@ struct TensorDescriptor : miopenTensorDescriptor
         : lens(plens.begin(), plens.end()), strides(pstrides.begin(), pstrides.end()), type(t)
     {
         packed = (this->GetElementSize() == this->GetElementSpace());
+        this->UpdateCache();
     }
 
     void CalculateStrides();
 
-    const std::vector<std::size_t>& GetLengths() const;
-    const std::vector<std::size_t>& GetStrides() const;
+    const TensorDims& GetLengths() const;
+    const TensorDims& GetStrides() const;
     int GetSize() const;
 
     miopenDataType_t GetType() const;
@@ -179,8 +223,9 @@ struct TensorDescriptor : miopenTensorDescriptor
 
     bool IsPossibleLayout(const std::string& labels, const std::string& layout) const;
 
-    static inline std::vector<int64_t> find_permutation(const std::vector<std::size_t>& lens,
-                                                        const std::vector<std::size_t>& strides)
+    template <class Lengths, class Strides>
+    static inline std::vector<int64_t> find_permutation(const Lengths& lens,
+                                                        const Strides& strides)
     {
         std::vector<std::int64_t> result(lens.size());
         std::iota(result.begin(), result.end(), 0);
@@ -201,20 +246,42 @@ struct TensorDescriptor : miopenTensorDescriptor
         // Copy construct the result string from labels. This allocates the space at one go
         // and is faster than calling push_back in transform.
         auto result = labels;
-        auto p      = find_permutation(lens, strides);
-        std::transform(p.begin(), p.end(), result.begin(), [&](auto i) { return labels[i]; });
+        if(lens.size() <= stride_order.size())
+        {
+            std::transform(stride_order.begin(),
+                           stride_order.begin() + lens.size(),
+                           result.begin(),
+                           [&](auto i) { return labels[i]; });
+        }
+        else
+        {
+            auto p = find_permutation(lens, strides);
+            std::transform(p.begin(), p.end(), result.begin(), [&](auto i) { return labels[i]; });
+        }
         return result;
     }
 
+    /// Hash of the type, lengths and strides, computed when the descriptor is built.
+    std::size_t GetHash() const { return hash; }
+
     friend std::ostream& operator<<(std::ostream& stream, const TensorDescriptor& t);
 
     private:
-    std::vector<std::size_t> lens;
-    std::vector<std::size_t> strides;
+    void UpdateCache();
+
+    TensorDims lens;
+    TensorDims strides;
 
     bool packed;
 
     miopenDataType_t type = miopenFloat;
+
+    // Both are derived from the fields above by UpdateCache() so that comparisons and layout
+    // queries do not have to sort or walk the dimensions again.
+    std::size_t hash = 0;
+    // Dimensions ordered from the outermost to the innermost stride, see find_permutation().
+    // Only valid for tensors of up to stride_order.size() dimensions.
+    std::array<std::uint8_t, 8> stride_order{};
 };
 
 } // namespace miopen
@@ -0,0 +1,89 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_TENSOR_OP_PLAN_HPP_
+#define GUARD_MIOPEN_TENSOR_OP_PLAN_HPP_
+
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace miopen {
+
+struct TensorDescriptor;
+struct TensorDims;
+
+/// Canonical shapes of C = op(alpha0 * A, alpha1 * B) + beta * C after the dimensions are
+/// collapsed. Each one has its own elementwise kernel, so every tensor shape that collapses to
+/// the same kind and rank shares a build.
+enum class TensorOpKind
+{
+    Contiguous, ///< A, B and C are one contiguous run of the same length
+    ScalarB,    ///< A and C are one contiguous run, B is a single value
+    ChannelB,   ///< A and C are packed [outer, mid, inner], B is a packed [mid] vector
+    Generic,    ///< Any strides, B broadcast over the dimensions where its stride is 0
+};
+
+std::string ToString(TensorOpKind kind);
+
+/// The elementwise problem with the dimensions of length 1 removed and adjacent dimensions
+/// merged wherever all three tensors can walk them with a single stride. Broadcast
+/// dimensions of B have stride 0.
+struct TensorOpPlan
+{
+    static constexpr std::size_t max_dims = 5;
+
+    TensorOpKind kind = TensorOpKind::Generic;
+    std::vector<std::size_t> lens;
+    std::vector<std::size_t> a_strides;
+    std::vector<std::size_t> b_strides;
+    std::vector<std::size_t> c_strides;
+
+    /// Lengths of the ChannelB kind, all 1 for the other kinds.
+    std::size_t outer = 1;
+    std::size_t mid   = 1;
+    std::size_t inner = 1;
+
+    std::size_t GetElementSize() const;
+
+    /// Builds the plan from the lengths and strides of the tensors. A has the lengths of C,
+    /// every length of B is either 1 or the length of C.
+    static TensorOpPlan Make(const TensorDims& c_lens,
+                             const TensorDims& a_strides,
+                             const TensorDims& b_lens,
+                             const TensorDims& b_strides,
+                             const TensorDims& c_strides);
+
+    static TensorOpPlan Make(const TensorDescriptor& aDesc,
+                             const TensorDescriptor& bDesc,
+                             const TensorDescriptor& cDesc);
+
+    friend std::ostream& operator<<(std::ostream& stream, const TensorOpPlan& plan);
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_TENSOR_OP_PLAN_HPP_
@@ -38,6 +38,7 @@
 namespace miopen {
 
 struct Handle;
+struct ActivationDescriptor;
 
 struct f_length_is_not_1_t
 {
@@ -176,6 +177,26 @@ void OpTensor(const Handle& handle,
               size_t Boffset = 0,
               size_t Coffset = 0);
 
+/// C = activ(op(alpha0 * A, alpha1 * B) + beta * C) for half, float and bfloat16 tensors. A has
+/// the lengths of C and B is broadcast over its dimensions of length 1. The dimensions are
+/// collapsed by TensorOpPlan and the result is computed in float. C is not read when beta is
+/// zero. activDesc may be null for no activation.
+void OpTensorFused(const Handle& handle,
+                   miopenTensorOp_t tensorOp,
+                   const void* alpha0,
+                   const TensorDescriptor& aTensorDesc,
+                   ConstData_t ATensor,
+                   const void* alpha1,
+                   const TensorDescriptor& bTensorDesc,
+                   ConstData_t BTensor,
+                   const void* beta,
+                   const TensorDescriptor& cTensorDesc,
+                   Data_t CTensor,
+                   const ActivationDescriptor* activDesc,
+                   size_t Aoffset = 0,
+                   size_t Boffset = 0,
+                   size_t Coffset = 0);
+
 void CopyTensor(const Handle& handle,
                 const TensorDescriptor& srcDesc,
                 ConstData_t src,
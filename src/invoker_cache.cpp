@@ -41,6 +41,14 @@ boost::optional<const Invoker&> InvokerCache::operator[](const Key& key) const
     return invoker->second;
 }
 
+boost::optional<const Invoker&> InvokerCache::operator[](const BinaryKey& key) const
+{
+    const auto it = binary_index.find(key);
+    if(it == binary_index.end())
+        return boost::none;
+    return *it->second;
+}
+
 boost::optional<const Invoker&> InvokerCache::GetFound1_0(const std::string& network_config,
                                                           const std::string& algorithm) const
 {
@@ -82,6 +90,13 @@ void InvokerCache::Register(const Key& key, const Invoker& invoker)
     MIOPEN_LOG_I2("Invoker registered for algorithm " << key.first << " and solver " << key.second);
 }
 
+void InvokerCache::Register(const BinaryKey& binary_key, const Key& key, const Invoker& invoker)
+{
+    Register(key, invoker);
+    // Register() keeps the first invoker for a key, so index whichever one is stored.
+    binary_index.emplace(binary_key, &invokers.at(key.first).invokers.at(key.second));
+}
+
 void InvokerCache::SetAsFound1_0(const std::string& network_config,
                                  const std::string& algorithm,
                                  const std::string& solver_id)
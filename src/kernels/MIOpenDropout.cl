@@ -70,8 +70,9 @@
 #endif
 
 #if RUN_INIT_PRNG
-#include "precalc_xorwow_skipahead_matrices_kernel.h"
-#include "precalc_xorwow_skipahead_sequence_matrices_kernel.h"
+// The skip-ahead matrices are passed in a buffer, the host sets their dimensions.
+#define XORWOW_PRECALC_MATRICES_SZ (XORWOW_BITS * XORWOW_DIM * XORWOW_DIM)
+#define XORWOW_JUMP_LOG2_MASK ((1 << XORWOW_JUMP_LOG2) - 1)
 #endif
 
 typedef struct xorwowStates
@@ -108,7 +109,7 @@ uint xorwow_lite_next(prngStates* cur_state)
 float uniform_distribution(uint v) { return ROCRAND_2POW32_INV + (v * ROCRAND_2POW32_INV); }
 
 #if RUN_INIT_PRNG
-void copy_const_arr(uint* dst, constant uint* src, const int arr_size)
+void copy_global_arr(uint* dst, const global uint* src, const int arr_size)
 {
     for(int i = 0; i < arr_size; i++)
     {
@@ -187,8 +188,7 @@ void mat_pow(uint* matrixP, const uint* matrix, unsigned long long power)
 
 void xorwow_skipahead(unsigned long long skp,
                       prngStates* state,
-                      constant uint
-                          skipahead_mat[XORWOW_PRECALC_MATRICES_NUM][XORWOW_PRECALC_MATRICES_SZ])
+                      const global uint* skipahead_mat)
 {
     uint xor_vec[XORWOW_DIM];
     uint* p = &(state->x);
@@ -205,9 +205,10 @@ void xorwow_skipahead(unsigned long long skp,
     )
     {
         uint mat[XORWOW_PRECALC_MATRICES_SZ];
-        copy_const_arr(mat, skipahead_mat[mat_idx], XORWOW_PRECALC_MATRICES_SZ);
+        copy_global_arr(
+            mat, skipahead_mat + mat_idx * XORWOW_PRECALC_MATRICES_SZ, XORWOW_PRECALC_MATRICES_SZ);
 
-        if(skp & XORWOW_JUMP_LOG2_MASK)
+        for(uint i = 0; i < (uint)(skp & XORWOW_JUMP_LOG2_MASK); i++)
         {
             mat_vec(mat, xor_vec);
         }
@@ -219,15 +220,17 @@ void xorwow_skipahead(unsigned long long skp,
     if(skp)
     {
         uint matrixA[XORWOW_PRECALC_MATRICES_SZ], matrixB[XORWOW_PRECALC_MATRICES_SZ];
-        copy_const_arr(
-            matrixA, skipahead_mat[XORWOW_PRECALC_MATRICES_NUM - 1], XORWOW_PRECALC_MATRICES_SZ);
+        copy_global_arr(matrixA,
+                        skipahead_mat +
+                            (XORWOW_PRECALC_MATRICES_NUM - 1) * XORWOW_PRECALC_MATRICES_SZ,
+                        XORWOW_PRECALC_MATRICES_SZ);
 
         while(skp)
         {
             mat_pow(matrixB, matrixA, 1ULL << XORWOW_JUMP_LOG2);
             copy_arr(matrixA, matrixB, XORWOW_PRECALC_MATRICES_SZ);
 
-            if(skp & XORWOW_JUMP_LOG2_MASK)
+            for(uint i = 0; i < (uint)(skp & XORWOW_JUMP_LOG2_MASK); i++)
             {
                 mat_vec(matrixA, xor_vec);
             }
@@ -245,7 +248,9 @@ void xorwow_skipahead(unsigned long long skp,
 void xorwow_lite_init(prngStates* cur_state,
                       const unsigned long long seed,
                       const unsigned long long subsequence,
-                      const unsigned long long offset)
+                      const unsigned long long offset,
+                      const global uint* skipahead_sequence_mat,
+                      const global uint* skipahead_mat)
 {
     cur_state->x = 123456789;
     cur_state->y = 362436069;
@@ -267,21 +272,33 @@ void xorwow_lite_init(prngStates* cur_state,
     cur_state->v += t0;
     cur_state->d += t1 + t0;
 
-    xorwow_skipahead(subsequence, cur_state, precalc_xorwow_skipahead_sequence_matrices);
+    xorwow_skipahead(subsequence, cur_state, skipahead_sequence_mat);
 
-    xorwow_skipahead(offset, cur_state, precalc_xorwow_skipahead_matrices);
+    xorwow_skipahead(offset, cur_state, skipahead_mat);
     cur_state->d += (uint)(offset)*362437;
 }
 
-__kernel void InitKernelState(__global prngStates* state)
+// skipahead_mat holds the matrices that skip ahead by subsequences followed by the ones that
+// skip ahead within a subsequence. The seed and the number of states are arguments so that a
+// single binary serves every seed.
+__kernel void InitKernelState(__global prngStates* state,
+                              const global uint* skipahead_mat,
+                              const ulong prng_seed,
+                              const ulong states_num)
 {
-    for(uint gid = get_global_id(0); gid < STATES_NUM; gid += get_global_size(0))
+    const global uint* skipahead_sequence_mat = skipahead_mat;
+    const global uint* skipahead_offset_mat =
+        skipahead_mat + XORWOW_PRECALC_MATRICES_NUM * XORWOW_PRECALC_MATRICES_SZ;
+
+    for(ulong gid = get_global_id(0); gid < states_num; gid += get_global_size(0))
     {
         prngStates state_gid;
         xorwow_lite_init(&state_gid,
-                         (unsigned long long)PRNG_SEED,
-                         (unsigned long long)gid,
-                         (unsigned long long)0);
+                         prng_seed,
+                         gid,
+                         (unsigned long long)0,
+                         skipahead_sequence_mat,
+                         skipahead_offset_mat);
 
         *((__global prngStates*)(state + gid)) = state_gid;
     }
@@ -0,0 +1,323 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef MIOPEN_USE_FP16
+#define MIOPEN_USE_FP16 0
+#endif
+#ifndef MIOPEN_USE_FP32
+#define MIOPEN_USE_FP32 0
+#endif
+#ifndef MIOPEN_USE_BFP16
+#define MIOPEN_USE_BFP16 0
+#endif
+
+#include "float_types.h"
+
+// Computes up to four reductions of the same input in one pass: every element of A is loaded
+// once and folded into one accumulator per operation. The reductions share the reduced
+// dimensions, the output descriptor and alpha/beta; each writes its own output tensor.
+//
+// MIO_RED_OP_<k> and MIO_RED_NAN_<k> are the miopenReduceTensorOp_t and the NaN propagation of
+// the k-th reduction. The dimensions of A are ordered invariant first, then reduced; lengths
+// come in l0..l5, strides of A in s0..s5 and strides of the outputs in o0..o5 (invariant dims
+// only). Accumulation is always done in float. The kernels loop over their work with a grid
+// stride, so the launch size does not depend on the problem and one build serves all shapes.
+
+#define RED_ADD 0
+#define RED_MUL 1
+#define RED_MIN 2
+#define RED_MAX 3
+#define RED_AMAX 4
+#define RED_AVG 5
+#define RED_NORM1 6
+#define RED_NORM2 7
+
+#ifndef MIO_RED_OP_1
+#define MIO_RED_OP_1 MIO_RED_OP_0
+#define MIO_RED_NAN_1 MIO_RED_NAN_0
+#endif
+#ifndef MIO_RED_OP_2
+#define MIO_RED_OP_2 MIO_RED_OP_0
+#define MIO_RED_NAN_2 MIO_RED_NAN_0
+#endif
+#ifndef MIO_RED_OP_3
+#define MIO_RED_OP_3 MIO_RED_OP_0
+#define MIO_RED_NAN_3 MIO_RED_NAN_0
+#endif
+
+#define MIO_RED_NUM_DIMS (MIO_RED_NUM_INV_DIMS + MIO_RED_NUM_RED_DIMS)
+
+static inline int red_op(const int k)
+{
+    return k == 0 ? MIO_RED_OP_0 : k == 1 ? MIO_RED_OP_1 : k == 2 ? MIO_RED_OP_2 : MIO_RED_OP_3;
+}
+
+static inline int red_nan(const int k)
+{
+    return k == 0 ? MIO_RED_NAN_0 : k == 1 ? MIO_RED_NAN_1 : k == 2 ? MIO_RED_NAN_2 : MIO_RED_NAN_3;
+}
+
+static inline float red_init(const int op)
+{
+    return op == RED_MUL ? 1.0f : op == RED_MIN ? FLT_MAX : op == RED_MAX ? -FLT_MAX : 0.0f;
+}
+
+static inline float red_pre(const int op, const float x)
+{
+    return (op == RED_AMAX || op == RED_NORM1) ? fabs(x) : op == RED_NORM2 ? x * x : x;
+}
+
+static inline float red_combine(const int op, const int nan, const float a, const float b)
+{
+    if(op == RED_MUL)
+        return a * b;
+    if(op == RED_MIN || op == RED_MAX || op == RED_AMAX)
+    {
+        // fmin/fmax drop NaNs, which is the behavior without NaN propagation.
+        if(nan != 0 && isnan(b))
+            return b;
+        if(nan != 0 && isnan(a))
+            return a;
+        return op == RED_MIN ? fmin(a, b) : fmax(a, b);
+    }
+    return a + b;
+}
+
+static inline float red_post(const int op, const float a, const int red_len)
+{
+    return op == RED_AVG ? a / (float)red_len : op == RED_NORM2 ? sqrt(a) : a;
+}
+
+static inline void red_store(const int k,
+                             global _FLOAT* C0,
+                             global _FLOAT* C1,
+                             global _FLOAT* C2,
+                             global _FLOAT* C3,
+                             const long offset,
+                             const float value,
+                             const float alpha,
+                             const float beta,
+                             const int red_len)
+{
+    global _FLOAT* C = k == 0 ? C0 : k == 1 ? C1 : k == 2 ? C2 : C3;
+    float out        = alpha * red_post(red_op(k), value, red_len);
+    if(beta != 0.0f)
+        out += beta * CVT_FLOAT2ACCUM(C[offset]);
+    C[offset] = CVT_ACCUM2FLOAT(out);
+}
+
+// Offsets of the invariant index inv in A and in the outputs.
+static inline void inv_offsets(int inv,
+                               const int* lens,
+                               const int* in_strides,
+                               const int* out_strides,
+                               long* in_offset,
+                               long* out_offset)
+{
+    *in_offset  = 0;
+    *out_offset = 0;
+    for(int d = MIO_RED_NUM_INV_DIMS - 1; d >= 0; --d)
+    {
+        const int i = inv % lens[d];
+        inv /= lens[d];
+        *in_offset += (long)i * in_strides[d];
+        *out_offset += (long)i * out_strides[d];
+    }
+}
+
+// Offset in A of the r-th element of the reduced dimensions.
+static inline long red_offset(int r, const int* lens, const int* in_strides)
+{
+    long offset = 0;
+    for(int d = MIO_RED_NUM_DIMS - 1; d > MIO_RED_NUM_INV_DIMS; --d)
+    {
+        offset += (long)(r % lens[d]) * in_strides[d];
+        r /= lens[d];
+    }
+    return offset + (long)r * in_strides[MIO_RED_NUM_INV_DIMS];
+}
+
+#define RED_DIM_ARGS                                                                     \
+    const int l0, const int l1, const int l2, const int l3, const int l4, const int l5, \
+        const int s0, const int s1, const int s2, const int s3, const int s4, const int s5, \
+        const int o0, const int o1, const int o2, const int o3, const int o4, const int o5
+
+#define RED_DIM_ARRAYS                                  \
+    const int lens[6]        = {l0, l1, l2, l3, l4, l5}; \
+    const int in_strides[6]  = {s0, s1, s2, s3, s4, s5}; \
+    const int out_strides[6] = {o0, o1, o2, o3, o4, o5};
+
+// One work-item per invariant index, for rows shorter than a wavefront.
+__kernel void ReduceMultiThreadwise(const global _FLOAT* A,
+                                    global _FLOAT* C0,
+                                    global _FLOAT* C1,
+                                    global _FLOAT* C2,
+                                    global _FLOAT* C3,
+                                    const float alpha,
+                                    const float beta,
+                                    const int inv_len,
+                                    const int red_len,
+                                    RED_DIM_ARGS)
+{
+    RED_DIM_ARRAYS
+
+    for(int inv = get_global_id(0); inv < inv_len; inv += get_global_size(0))
+    {
+        long in_offset, out_offset;
+        inv_offsets(inv, lens, in_strides, out_strides, &in_offset, &out_offset);
+
+        float acc[MIO_RED_NUM_OPS];
+        for(int k = 0; k < MIO_RED_NUM_OPS; ++k)
+            acc[k] = red_init(red_op(k));
+
+        for(int r = 0; r < red_len; ++r)
+        {
+            const float x = CVT_FLOAT2ACCUM(A[in_offset + red_offset(r, lens, in_strides)]);
+            for(int k = 0; k < MIO_RED_NUM_OPS; ++k)
+                acc[k] = red_combine(red_op(k), red_nan(k), acc[k], red_pre(red_op(k), x));
+        }
+
+        for(int k = 0; k < MIO_RED_NUM_OPS; ++k)
+            red_store(k, C0, C1, C2, C3, out_offset, acc[k], alpha, beta, red_len);
+    }
+}
+
+// blk_group_size work-groups per invariant index, each reducing red_per_blk elements. With a
+// single group the results are written directly, otherwise the partial results go to ws as
+// [inv][blk][op] and ReduceMultiFinal combines them.
+__kernel void ReduceMultiBlockwise(const global _FLOAT* A,
+                                   global _FLOAT* C0,
+                                   global _FLOAT* C1,
+                                   global _FLOAT* C2,
+                                   global _FLOAT* C3,
+                                   global float* ws,
+                                   const float alpha,
+                                   const float beta,
+                                   const int inv_len,
+                                   const int red_len,
+                                   const int blk_group_size,
+                                   const int red_per_blk,
+                                   RED_DIM_ARGS)
+{
+    RED_DIM_ARRAYS
+
+    local float lcl[MIO_RED_NUM_OPS * MIO_RED_GROUP_SIZE];
+
+    const int lid      = get_local_id(0);
+    const int n_groups = inv_len * blk_group_size;
+
+    for(int group = get_group_id(0); group < n_groups; group += get_num_groups(0))
+    {
+        const int inv = group / blk_group_size;
+        const int blk = group - inv * blk_group_size;
+
+        long in_offset, out_offset;
+        inv_offsets(inv, lens, in_strides, out_strides, &in_offset, &out_offset);
+
+        float acc[MIO_RED_NUM_OPS];
+        for(int k = 0; k < MIO_RED_NUM_OPS; ++k)
+            acc[k] = red_init(red_op(k));
+
+        const int begin = blk * red_per_blk;
+        const int end   = min(begin + red_per_blk, red_len);
+        for(int r = begin + lid; r < end; r += MIO_RED_GROUP_SIZE)
+        {
+            const float x = CVT_FLOAT2ACCUM(A[in_offset + red_offset(r, lens, in_strides)]);
+            for(int k = 0; k < MIO_RED_NUM_OPS; ++k)
+                acc[k] = red_combine(red_op(k), red_nan(k), acc[k], red_pre(red_op(k), x));
+        }
+
+        for(int k = 0; k < MIO_RED_NUM_OPS; ++k)
+            lcl[k * MIO_RED_GROUP_SIZE + lid] = acc[k];
+        barrier(CLK_LOCAL_MEM_FENCE);
+
+        for(int w = MIO_RED_GROUP_SIZE / 2; w > 0; w >>= 1)
+        {
+            if(lid < w)
+            {
+                for(int k = 0; k < MIO_RED_NUM_OPS; ++k)
+                {
+                    const int i = k * MIO_RED_GROUP_SIZE + lid;
+                    lcl[i]      = red_combine(red_op(k), red_nan(k), lcl[i], lcl[i + w]);
+                }
+            }
+            barrier(CLK_LOCAL_MEM_FENCE);
+        }
+
+        if(lid == 0)
+        {
+            for(int k = 0; k < MIO_RED_NUM_OPS; ++k)
+            {
+                const float value = lcl[k * MIO_RED_GROUP_SIZE];
+                if(blk_group_size == 1)
+                    red_store(k, C0, C1, C2, C3, out_offset, value, alpha, beta, red_len);
+                else
+                    ws[(long)group * MIO_RED_NUM_OPS + k] = value;
+            }
+        }
+        // lcl is written again by the next group of the loop
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+}
+
+// Combines the blk_group_size partial results of ReduceMultiBlockwise, one work-item per
+// invariant index.
+__kernel void ReduceMultiFinal(global _FLOAT* C0,
+                               global _FLOAT* C1,
+                               global _FLOAT* C2,
+                               global _FLOAT* C3,
+                               const global float* ws,
+                               const float alpha,
+                               const float beta,
+                               const int inv_len,
+                               const int red_len,
+                               const int blk_group_size,
+                               RED_DIM_ARGS)
+{
+    RED_DIM_ARRAYS
+
+    for(int inv = get_global_id(0); inv < inv_len; inv += get_global_size(0))
+    {
+        long in_offset, out_offset;
+        inv_offsets(inv, lens, in_strides, out_strides, &in_offset, &out_offset);
+
+        const global float* partial = ws + (long)inv * blk_group_size * MIO_RED_NUM_OPS;
+
+        float acc[MIO_RED_NUM_OPS];
+        for(int k = 0; k < MIO_RED_NUM_OPS; ++k)
+            acc[k] = partial[k];
+
+        for(int blk = 1; blk < blk_group_size; ++blk)
+        {
+            for(int k = 0; k < MIO_RED_NUM_OPS; ++k)
+                acc[k] = red_combine(
+                    red_op(k), red_nan(k), acc[k], partial[blk * MIO_RED_NUM_OPS + k]);
+        }
+
+        for(int k = 0; k < MIO_RED_NUM_OPS; ++k)
+            red_store(k, C0, C1, C2, C3, out_offset, acc[k], alpha, beta, red_len);
+    }
+}
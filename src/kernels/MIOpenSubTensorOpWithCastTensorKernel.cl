@@ -83,31 +83,7 @@
 #define _FLOAT8 PPCAT(_FLOAT, EIGHT)
 #define _AS_FLOAT PPCAT(as_, _FLOAT)
 
-#ifndef WORK_LENGTH_0
-#define WORK_LENGTH_0 1
-#endif
-
-#ifndef WORK_LENGTH_1
-#define WORK_LENGTH_1 1
-#endif
-
-#ifndef WORK_LENGTH_2
-#define WORK_LENGTH_2 1
-#endif
-
-#ifndef WORK_LENGTH_3
-#define WORK_LENGTH_3 1
-#endif
-
-#ifndef WORK_LENGTH_4
-#define WORK_LENGTH_4 1
-#endif
-
-#define WORK_STRIDE_4 1
-#define WORK_STRIDE_3 (WORK_LENGTH_4 * WORK_STRIDE_4)
-#define WORK_STRIDE_2 (WORK_LENGTH_3 * WORK_STRIDE_3)
-#define WORK_STRIDE_1 (WORK_LENGTH_2 * WORK_STRIDE_2)
-#define WORK_STRIDE_0 (WORK_LENGTH_1 * WORK_STRIDE_1)
+#include "subtensor_work_lengths.h"
 
 __kernel void SubTensorOpWithCastTensor1d(const global _FLOAT_SRC* __restrict src,
                                           const float alpha,
@@ -118,6 +94,8 @@ __kernel void SubTensorOpWithCastTensor1d(const global _FLOAT_SRC* __restrict sr
                                           const int dstOffset,
                                           const int dstStride0)
 {
+    SUBTENSOR_WORK_LENGTHS(srcLen0, 1, 1, 1, 1)
+
     uint itmp = get_global_id(0);
 
     const uint did0_begin = itmp / WORK_STRIDE_0;
@@ -150,6 +128,8 @@ __kernel void SubTensorOpWithCastTensor2d(const global _FLOAT_SRC* __restrict sr
                                           const int dstStride0,
                                           const int dstStride1)
 {
+    SUBTENSOR_WORK_LENGTHS(srcLen0, srcLen1, 1, 1, 1)
+
     uint itmp = get_global_id(0);
 
     const uint did0_begin = itmp / WORK_STRIDE_0;
@@ -193,6 +173,8 @@ __kernel void SubTensorOpWithCastTensor3d(const global _FLOAT_SRC* __restrict sr
                                           const int dstStride1,
                                           const int dstStride2)
 {
+    SUBTENSOR_WORK_LENGTHS(srcLen0, srcLen1, srcLen2, 1, 1)
+
     uint itmp = get_global_id(0);
 
     const uint did0_begin = itmp / WORK_STRIDE_0;
@@ -247,6 +229,8 @@ __kernel void SubTensorOpWithCastTensor4d(const global _FLOAT_SRC* __restrict sr
                                           const int dstStride2,
                                           const int dstStride3)
 {
+    SUBTENSOR_WORK_LENGTHS(srcLen0, srcLen1, srcLen2, srcLen3, 1)
+
     uint itmp = get_global_id(0);
 
     const uint did0_begin = itmp / WORK_STRIDE_0;
@@ -313,6 +297,8 @@ __kernel void SubTensorOpWithCastTensor5d(const global _FLOAT_SRC* __restrict sr
                                           const int dstStride3,
                                           const int dstStride4)
 {
+    SUBTENSOR_WORK_LENGTHS(srcLen0, srcLen1, srcLen2, srcLen3, srcLen4)
+
     uint itmp = get_global_id(0);
 
     const uint did0_begin = itmp / WORK_STRIDE_0;
@@ -61,31 +61,7 @@
 #endif
 #endif
 
-#ifndef WORK_LENGTH_0
-#define WORK_LENGTH_0 1
-#endif
-
-#ifndef WORK_LENGTH_1
-#define WORK_LENGTH_1 1
-#endif
-
-#ifndef WORK_LENGTH_2
-#define WORK_LENGTH_2 1
-#endif
-
-#ifndef WORK_LENGTH_3
-#define WORK_LENGTH_3 1
-#endif
-
-#ifndef WORK_LENGTH_4
-#define WORK_LENGTH_4 1
-#endif
-
-#define WORK_STRIDE_4 1
-#define WORK_STRIDE_3 (WORK_LENGTH_4 * WORK_STRIDE_4)
-#define WORK_STRIDE_2 (WORK_LENGTH_3 * WORK_STRIDE_3)
-#define WORK_STRIDE_1 (WORK_LENGTH_2 * WORK_STRIDE_2)
-#define WORK_STRIDE_0 (WORK_LENGTH_1 * WORK_STRIDE_1)
+#include "subtensor_work_lengths.h"
 
 #ifndef SUBTENSOR_OP_WITH_SCALAR
 #define SUBTENSOR_OP_WITH_SCALAR BREAK_COMPILE_INTENTIONALLY
@@ -100,6 +76,8 @@ __kernel void SubTensorOpWithScalar1d(global _FLOAT* __restrict dst,
                                       const int stride0,
                                       const int len0)
 {
+    SUBTENSOR_WORK_LENGTHS(len0, 1, 1, 1, 1)
+
     uint itmp = get_global_id(0);
 
     const uint did0_begin = itmp / WORK_STRIDE_0;
@@ -120,6 +98,8 @@ __kernel void SubTensorOpWithScalar2d(global _FLOAT* __restrict dst,
                                       const int len0,
                                       const int len1)
 {
+    SUBTENSOR_WORK_LENGTHS(len0, len1, 1, 1, 1)
+
     uint itmp = get_global_id(0);
 
     const uint did0_begin = itmp / WORK_STRIDE_0;
@@ -149,6 +129,8 @@ __kernel void SubTensorOpWithScalar3d(global _FLOAT* __restrict dst,
                                       const int len1,
                                       const int len2)
 {
+    SUBTENSOR_WORK_LENGTHS(len0, len1, len2, 1, 1)
+
     uint itmp = get_global_id(0);
 
     const uint did0_begin = itmp / WORK_STRIDE_0;
@@ -187,6 +169,8 @@ __kernel void SubTensorOpWithScalar4d(global _FLOAT* __restrict dst,
                                       const int len2,
                                       const int len3)
 {
+    SUBTENSOR_WORK_LENGTHS(len0, len1, len2, len3, 1)
+
     uint itmp = get_global_id(0);
 
     const uint did0_begin = itmp / WORK_STRIDE_0;
@@ -235,6 +219,8 @@ __kernel void SubTensorOpWithScalar5d(global _FLOAT* __restrict dst,
                                       const int len3,
                                       const int len4)
 {
+    SUBTENSOR_WORK_LENGTHS(len0, len1, len2, len3, len4)
+
     uint itmp = get_global_id(0);
 
     const uint did0_begin = itmp / WORK_STRIDE_0;
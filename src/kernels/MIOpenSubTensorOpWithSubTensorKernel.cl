@@ -85,31 +85,7 @@
 #define _FLOAT8 PPCAT(_FLOAT, EIGHT)
 #define _AS_FLOAT PPCAT(as_, _FLOAT)
 
-#ifndef WORK_LENGTH_0
-#define WORK_LENGTH_0 1
-#endif
-
-#ifndef WORK_LENGTH_1
-#define WORK_LENGTH_1 1
-#endif
-
-#ifndef WORK_LENGTH_2
-#define WORK_LENGTH_2 1
-#endif
-
-#ifndef WORK_LENGTH_3
-#define WORK_LENGTH_3 1
-#endif
-
-#ifndef WORK_LENGTH_4
-#define WORK_LENGTH_4 1
-#endif
-
-#define WORK_STRIDE_4 1
-#define WORK_STRIDE_3 (WORK_LENGTH_4 * WORK_STRIDE_4)
-#define WORK_STRIDE_2 (WORK_LENGTH_3 * WORK_STRIDE_3)
-#define WORK_STRIDE_1 (WORK_LENGTH_2 * WORK_STRIDE_2)
-#define WORK_STRIDE_0 (WORK_LENGTH_1 * WORK_STRIDE_1)
+#include "subtensor_work_lengths.h"
 
 #ifndef SUBTENSOR_OP_WITH_SUBTENSOR
 #define SUBTENSOR_OP_WITH_SUBTENSOR BREAK_COMPILE_INTENTIONALLY
@@ -125,6 +101,8 @@ __kernel void SubTensorOpWithSubTensor1d(const global _FLOAT* __restrict src,
                                          const int dstOffset,
                                          const int dstStride0)
 {
+    SUBTENSOR_WORK_LENGTHS(srcLen0, 1, 1, 1, 1)
+
     uint itmp = get_global_id(0);
 
     const uint did0_begin = itmp / WORK_STRIDE_0;
@@ -149,6 +127,8 @@ __kernel void SubTensorOpWithSubTensor2d(const global _FLOAT* __restrict src,
                                          const int dstStride0,
                                          const int dstStride1)
 {
+    SUBTENSOR_WORK_LENGTHS(srcLen0, srcLen1, 1, 1, 1)
+
     uint itmp = get_global_id(0);
 
     const uint did0_begin = itmp / WORK_STRIDE_0;
@@ -183,6 +163,8 @@ __kernel void SubTensorOpWithSubTensor3d(const global _FLOAT* __restrict src,
                                          const int dstStride1,
                                          const int dstStride2)
 {
+    SUBTENSOR_WORK_LENGTHS(srcLen0, srcLen1, srcLen2, 1, 1)
+
     uint itmp = get_global_id(0);
 
     const uint did0_begin = itmp / WORK_STRIDE_0;
@@ -227,6 +209,8 @@ __kernel void SubTensorOpWithSubTensor4d(const global _FLOAT* __restrict src,
                                          const int dstStride2,
                                          const int dstStride3)
 {
+    SUBTENSOR_WORK_LENGTHS(srcLen0, srcLen1, srcLen2, srcLen3, 1)
+
     uint itmp = get_global_id(0);
 
     const uint did0_begin = itmp / WORK_STRIDE_0;
@@ -283,6 +267,8 @@ __kernel void SubTensorOpWithSubTensor5d(const global _FLOAT* __restrict src,
                                          const int dstStride3,
                                          const int dstStride4)
 {
+    SUBTENSOR_WORK_LENGTHS(srcLen0, srcLen1, srcLen2, srcLen3, srcLen4)
+
     uint itmp = get_global_id(0);
 
     const uint did0_begin = itmp / WORK_STRIDE_0;
@@ -0,0 +1,257 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef MIOPEN_USE_FP16
+#define MIOPEN_USE_FP16 0
+#endif
+#ifndef MIOPEN_USE_FP32
+#define MIOPEN_USE_FP32 0
+#endif
+#ifndef MIOPEN_USE_BFP16
+#define MIOPEN_USE_BFP16 0
+#endif
+
+#include "float_types.h"
+
+// C = activ(op(alpha0 * A, alpha1 * B) + beta * C) for the canonical shapes of TensorOpPlan.
+// MIO_EW_OP is the miopenTensorOp_t, MIO_EW_ACTIV the miopenActivationMode_t applied to the
+// result and MIO_EW_BETA whether C is read at all. The computation is done in float. Every
+// kernel loops over its elements with a grid stride, handling MIO_EW_VEC consecutive elements
+// per work-item where the shape allows it. Offsets are in elements.
+
+#ifndef MIO_EW_OP
+#define MIO_EW_OP 0
+#endif
+#ifndef MIO_EW_ACTIV
+#define MIO_EW_ACTIV 0
+#endif
+#ifndef MIO_EW_BETA
+#define MIO_EW_BETA 1
+#endif
+#ifndef MIO_EW_VEC
+#define MIO_EW_VEC 1
+#endif
+#ifndef MIO_EW_NDIMS
+#define MIO_EW_NDIMS 5
+#endif
+
+#define EW_SCALE_ARGS                                                                  \
+    const float alpha0, const float alpha1, const float beta, const float activ_alpha, \
+        const float activ_beta, const float activ_gamma
+
+static inline float ew_op(const float a, const float b)
+{
+#if MIO_EW_OP == 0
+    return a + b;
+#elif MIO_EW_OP == 1
+    return a * b;
+#elif MIO_EW_OP == 2
+    return a < b ? a : b;
+#else
+    return a > b ? a : b;
+#endif
+}
+
+static inline float
+ew_activ(const float x, const float activ_alpha, const float activ_beta, const float activ_gamma)
+{
+#if MIO_EW_ACTIV == 1 // LOGISTIC
+    return 1.0f / (1.0f + exp(-x));
+#elif MIO_EW_ACTIV == 2 // TANH
+    return activ_beta * tanh(activ_alpha * x);
+#elif MIO_EW_ACTIV == 3 // RELU
+    return x > 0.0f ? x : 0.0f;
+#elif MIO_EW_ACTIV == 4 // SOFTRELU
+    return log(1.0f + exp(x));
+#elif MIO_EW_ACTIV == 5 // ABS
+    return fabs(x);
+#elif MIO_EW_ACTIV == 6 // POWER
+    return pow(activ_alpha + activ_beta * x, activ_gamma);
+#elif MIO_EW_ACTIV == 7 // CLIPPEDRELU
+    return fmin(activ_alpha, fmax(0.0f, x));
+#elif MIO_EW_ACTIV == 8 // LEAKYRELU
+    return x > 0.0f ? x : activ_alpha * x;
+#elif MIO_EW_ACTIV == 9 // ELU
+    return x > 0.0f ? x : activ_alpha * (exp(x) - 1.0f);
+#else
+    (void)activ_alpha;
+    (void)activ_beta;
+    (void)activ_gamma;
+    return x;
+#endif
+}
+
+// b is already scaled by alpha1.
+static inline void ew_store(global _FLOAT* c,
+                            const long i,
+                            const float a,
+                            const float b,
+                            const float alpha0,
+                            const float beta,
+                            const float activ_alpha,
+                            const float activ_beta,
+                            const float activ_gamma)
+{
+    float r = ew_op(alpha0 * a, b);
+#if MIO_EW_BETA
+    r += beta * CVT_FLOAT2ACCUM(c[i]);
+#else
+    (void)beta;
+#endif
+    c[i] = CVT_ACCUM2FLOAT(ew_activ(r, activ_alpha, activ_beta, activ_gamma));
+}
+
+#define EW_STORE(i, a, b) \
+    ew_store(c, i, a, b, alpha0, beta, activ_alpha, activ_beta, activ_gamma)
+
+__kernel void ElementwiseContiguous(const global _FLOAT* a,
+                                    const global _FLOAT* b,
+                                    global _FLOAT* c,
+                                    EW_SCALE_ARGS,
+                                    const long n,
+                                    const long a_offset,
+                                    const long b_offset,
+                                    const long c_offset)
+{
+    a += a_offset;
+    b += b_offset;
+    c += c_offset;
+
+    const long stride = (long)get_global_size(0) * MIO_EW_VEC;
+    for(long i = (long)get_global_id(0) * MIO_EW_VEC; i < n; i += stride)
+    {
+        if(i + MIO_EW_VEC <= n)
+        {
+            for(int v = 0; v < MIO_EW_VEC; ++v)
+                EW_STORE(i + v, CVT_FLOAT2ACCUM(a[i + v]), alpha1 * CVT_FLOAT2ACCUM(b[i + v]));
+        }
+        else
+        {
+            for(long j = i; j < n; ++j)
+                EW_STORE(j, CVT_FLOAT2ACCUM(a[j]), alpha1 * CVT_FLOAT2ACCUM(b[j]));
+        }
+    }
+}
+
+__kernel void ElementwiseScalarB(const global _FLOAT* a,
+                                 const global _FLOAT* b,
+                                 global _FLOAT* c,
+                                 EW_SCALE_ARGS,
+                                 const long n,
+                                 const long a_offset,
+                                 const long b_offset,
+                                 const long c_offset)
+{
+    a += a_offset;
+    c += c_offset;
+
+    const float operand = alpha1 * CVT_FLOAT2ACCUM(b[b_offset]);
+
+    const long stride = (long)get_global_size(0) * MIO_EW_VEC;
+    for(long i = (long)get_global_id(0) * MIO_EW_VEC; i < n; i += stride)
+    {
+        if(i + MIO_EW_VEC <= n)
+        {
+            for(int v = 0; v < MIO_EW_VEC; ++v)
+                EW_STORE(i + v, CVT_FLOAT2ACCUM(a[i + v]), operand);
+        }
+        else
+        {
+            for(long j = i; j < n; ++j)
+                EW_STORE(j, CVT_FLOAT2ACCUM(a[j]), operand);
+        }
+    }
+}
+
+// A and C are packed [outer, mid, inner] and B holds one value per mid index. The host only
+// picks MIO_EW_VEC > 1 when it divides inner, so the elements of a work-item share the value
+// of B.
+__kernel void ElementwiseChannelB(const global _FLOAT* a,
+                                  const global _FLOAT* b,
+                                  global _FLOAT* c,
+                                  EW_SCALE_ARGS,
+                                  const long outer,
+                                  const int mid,
+                                  const int inner,
+                                  const long a_offset,
+                                  const long b_offset,
+                                  const long c_offset)
+{
+    a += a_offset;
+    b += b_offset;
+    c += c_offset;
+
+    const long n      = outer * mid * inner;
+    const long stride = (long)get_global_size(0) * MIO_EW_VEC;
+    for(long i = (long)get_global_id(0) * MIO_EW_VEC; i < n; i += stride)
+    {
+        const float operand = alpha1 * CVT_FLOAT2ACCUM(b[(i / inner) % mid]);
+        for(int v = 0; v < MIO_EW_VEC; ++v)
+            EW_STORE(i + v, CVT_FLOAT2ACCUM(a[i + v]), operand);
+    }
+}
+
+#define EW_DIM_ARGS                                                                          \
+    const int l0, const int l1, const int l2, const int l3, const int l4, const int sa0,      \
+        const int sa1, const int sa2, const int sa3, const int sa4, const int sb0,            \
+        const int sb1, const int sb2, const int sb3, const int sb4, const int sc0,            \
+        const int sc1, const int sc2, const int sc3, const int sc4
+
+// Any strides, up to MIO_EW_NDIMS collapsed dimensions. B has stride 0 where it is broadcast.
+__kernel void ElementwiseGeneric(const global _FLOAT* a,
+                                 const global _FLOAT* b,
+                                 global _FLOAT* c,
+                                 EW_SCALE_ARGS,
+                                 const long n,
+                                 const long a_offset,
+                                 const long b_offset,
+                                 const long c_offset,
+                                 EW_DIM_ARGS)
+{
+    const int lens[5]      = {l0, l1, l2, l3, l4};
+    const int a_strides[5] = {sa0, sa1, sa2, sa3, sa4};
+    const int b_strides[5] = {sb0, sb1, sb2, sb3, sb4};
+    const int c_strides[5] = {sc0, sc1, sc2, sc3, sc4};
+
+    a += a_offset;
+    b += b_offset;
+    c += c_offset;
+
+    for(long i = get_global_id(0); i < n; i += get_global_size(0))
+    {
+        long rest = i;
+        long ai = 0, bi = 0, ci = 0;
+        for(int d = MIO_EW_NDIMS - 1; d >= 0; --d)
+        {
+            const long idx = rest % lens[d];
+            rest /= lens[d];
+            ai += idx * a_strides[d];
+            bi += idx * b_strides[d];
+            ci += idx * c_strides[d];
+        }
+        EW_STORE(ci, CVT_FLOAT2ACCUM(a[ai]), alpha1 * CVT_FLOAT2ACCUM(b[bi]));
+    }
+}
@@ -1,7499 +0,0 @@
-#define XORWOW_DIM 5
-#define XORWOW_BITS 32
-#define XORWOW_PRECALC_MATRICES_SZ (XORWOW_BITS * XORWOW_DIM * XORWOW_DIM)
-#define XORWOW_PRECALC_MATRICES_NUM 64
-#define XORWOW_JUMP_LOG2 1
-#define XORWOW_JUMP_LOG2_MASK ((1 << XORWOW_JUMP_LOG2) - 1)
-#define XORWOW_SEQUENCE_JUMP_LOG2 67
-
-static __constant unsigned int precalc_xorwow_skipahead_sequence_matrices
-    [XORWOW_PRECALC_MATRICES_NUM][XORWOW_PRECALC_MATRICES_SZ] = {
-        {
-            850664906,  2293210629, 1517805917, 1215500405, 1612415445, 645388200,  824349799,
-            3517232886, 4075591755, 3089899292, 4249786064, 3811424903, 1100783479, 53649761,
-            2817264826, 3159462529, 1654848550, 950025444,  3095510002, 4080567211, 4111078399,
-            3241719305, 2788212779, 4256963770, 2426893717, 4190211142, 1420776905, 3780537969,
-            1102912875, 1657948873, 3354905256, 2519610308, 515777663,  3396785394, 1832603711,
-            1154211550, 1915690212, 1933919046, 789578337,  337961173,  1359089498, 2249086205,
-            3417955173, 862571348,  528120760,  1265685672, 1970052076, 3585976752, 3645339918,
-            312171257,  1360991400, 1994321680, 2327168468, 2540437053, 1180483641, 2217962701,
-            182726833,  590204372,  1904496495, 2545607041, 3697978033, 1084030545, 3397906968,
-            2192325323, 2704204176, 1069092002, 2364406907, 1578647245, 3561974633, 3437665426,
-            1464127305, 1616628807, 2243114101, 3639967880, 1702613633, 2437350057, 39991274,
-            2024323584, 3795072940, 3604530798, 443099203,  643536212,  1919517328, 3931285769,
-            427935569,  276421624,  2492081750, 262729512,  3088549877, 2922650665, 1816283755,
-            4246096489, 842575914,  1460435650, 3050522190, 2640849794, 3697925816, 3465779075,
-            3856929655, 1365559780, 2897029415, 2747033756, 3611830629, 1891542518, 1897590206,
-            437451803,  677924906,  123809117,  3940574372, 687640291,  3488484529, 470218446,
-            1092571016, 1537938503, 1073323937, 611300083,  3809285994, 3975678726, 925845389,
-            2514775760, 2859302390, 2761919483, 993285307,  164095287,  3736193671, 2078946336,
-            1418537059, 1202525920, 4234029440, 1313593624, 2484428922, 1833969372, 661495122,
-            2217907395, 2795045321, 2950835531, 1402379354, 351314168,  1902476749, 1914974334,
-            2873973176, 1321203603, 3316118265, 3282193947, 1342191737, 793441242,  3281524559,
-            296088733,  487851702,  712098215,  1388727135, 1705533557, 3557800292, 399729516,
-            1355829467, 291276309,  421164833,  1318404599, 2064519128, 1161612642, 2076623594,
-            850664906,  2293210629, 1517805917, 1215500405, 3847487204, 645388200,  824349799,
-            3517232886, 4075591755, 2755872609, 4249786064, 3811424903, 1100783479, 53649761,
-            1417544262, 3159462529, 1654848550, 950025444,  3095510002, 1908900347, 4111078399,
-            3241719305, 2788212779, 4256963770, 3750258343, 4190211142, 1420776905, 3780537969,
-            1102912875, 1690550,    3354905256, 2519610308, 515777663,  3396785394, 2658162202,
-            1154211550, 1915690212, 1933919046, 789578337,  189880016,  1359089498, 2249086205,
-            3417955173, 862571348,  998719835,  1265685672, 1970052076, 3585976752, 3645339918,
-            2973042959, 1360991400, 1994321680, 2327168468, 2540437053, 2283905032, 2217962701,
-            182726833,  590204372,  1904496495, 110719262,  3697978033, 1084030545, 3397906968,
-            2192325323, 4133333579, 1069092002, 2364406907, 1578647245, 3561974633, 3629845331,
-            1464127305, 1616628807, 2243114101, 3639967880, 3256744141, 2437350057, 39991274,
-            2024323584, 3795072940, 1024703328, 443099203,  643536212,  1919517328, 3931285769,
-            2755167056, 276421624,  2492081750, 262729512,  3088549877, 2817867653, 1816283755,
-            4246096489, 842575914,  1460435650, 2276077438, 2640849794, 3697925816, 3465779075,
-            3856929655, 130551477,  2897029415, 2747033756, 3611830629, 1891542518, 804565809,
-            437451803,  677924906,  123809117,  3940574372, 2446610749, 3488484529, 470218446,
-            1092571016, 1537938503, 1502147484, 611300083,  3809285994, 3975678726, 925845389,
-            872826112,  2859302390, 2761919483, 993285307,  164095287,  3901654538, 2078946336,
-            1418537059, 1202525920, 4234029440, 704759480,  2484428922, 1833969372, 661495122,
-            2217907395, 3287413716, 2950835531, 1402379354, 351314168,  1902476749, 2033316109,
-            2873973176, 1321203603, 3316118265, 3282193947, 1316780684, 793441242,  3281524559,
-            296088733,  487851702,  314311643,  1388727135, 1705533557, 3557800292, 399729516,
-            1660074989, 291276309,  421164833,  1318404599, 2064519128, 3156334112, 2076623594,
-            850664906,  2293210629, 1517805917, 335452425,  3847487204, 645388200,  824349799,
-            3517232886, 954487767,  2755872609, 4249786064, 3811424903, 1100783479, 3408594583,
-            1417544262, 3159462529, 1654848550, 950025444,  324339737,  1908900347, 4111078399,
-            3241719305, 2788212779, 1890540205, 3750258343, 4190211142, 1420776905, 3780537969,
-            3716648585, 1690550,    3354905256, 2519610308, 515777663,  3758156132, 2658162202,
-            1154211550, 1915690212, 1933919046, 844149171,  189880016,  1359089498, 2249086205,
-            3417955173, 1031812215, 998719835,  1265685672, 1970052076, 3585976752, 3174204115,
-            2973042959, 1360991400, 1994321680, 2327168468, 714016907,  2283905032, 2217962701,
-            182726833,  590204372,  2151450260, 110719262,  3697978033, 1084030545, 3397906968,
-            767772303,  4133333579, 1069092002, 2364406907, 1578647245, 42955292,   3629845331,
-            1464127305, 1616628807, 2243114101, 3222189776, 3256744141, 2437350057, 39991274,
-            2024323584, 3142424684, 1024703328, 443099203,  643536212,  1919517328, 918511196,
-            2755167056, 276421624,  2492081750, 262729512,  4246877536, 2817867653, 1816283755,
-            4246096489, 842575914,  1425765936, 2276077438, 2640849794, 3697925816, 3465779075,
-            1491702526, 130551477,  2897029415, 2747033756, 3611830629, 1844578694, 804565809,
-            437451803,  677924906,  123809117,  3419189841, 2446610749, 3488484529, 470218446,
-            1092571016, 3272535988, 1502147484, 611300083,  3809285994, 3975678726, 2853681168,
-            872826112,  2859302390, 2761919483, 993285307,  1434560128, 3901654538, 2078946336,
-            1418537059, 1202525920, 2530097881, 704759480,  2484428922, 1833969372, 661495122,
-            503878844,  3287413716, 2950835531, 1402379354, 351314168,  4131886119, 2033316109,
-            2873973176, 1321203603, 3316118265, 237900321,  1316780684, 793441242,  3281524559,
-            296088733,  1730738847, 314311643,  1388727135, 1705533557, 3557800292, 1553835665,
-            1660074989, 291276309,  421164833,  1318404599, 964731488,  3156334112, 2076623594,
-            850664906,  2293210629, 1105350579, 335452425,  3847487204, 645388200,  824349799,
-            2789953706, 954487767,  2755872609, 4249786064, 3811424903, 3937839949, 3408594583,
-            1417544262, 3159462529, 1654848550, 624060530,  324339737,  1908900347, 4111078399,
-            3241719305, 2294919498, 1890540205, 3750258343, 4190211142, 1420776905, 2279133729,
-            3716648585, 1690550,    3354905256, 2519610308, 3563975602, 3758156132, 2658162202,
-            1154211550, 1915690212, 3505586122, 844149171,  189880016,  1359089498, 2249086205,
-            2389487504, 1031812215, 998719835,  1265685672, 1970052076, 2798611919, 3174204115,
-            2973042959, 1360991400, 1994321680, 1684134678, 714016907,  2283905032, 2217962701,
-            182726833,  1734988742, 2151450260, 110719262,  3697978033, 1084030545, 159906818,
-            767772303,  4133333579, 1069092002, 2364406907, 1290801202, 42955292,   3629845331,
-            1464127305, 1616628807, 987794861,  3222189776, 3256744141, 2437350057, 39991274,
-            3644076751, 3142424684, 1024703328, 443099203,  643536212,  1487589384, 918511196,
-            2755167056, 276421624,  2492081750, 137688638,  4246877536, 2817867653, 1816283755,
-            4246096489, 1518475380, 1425765936, 2276077438, 2640849794, 3697925816, 4226506771,
-            1491702526, 130551477,  2897029415, 2747033756, 2033599579, 1844578694, 804565809,
-            437451803,  677924906,  2749065512, 3419189841, 2446610749, 3488484529, 470218446,
-            290444026,  3272535988, 1502147484, 611300083,  3809285994, 2546040767, 2853681168,
-            872826112,  2859302390, 2761919483, 4097961150, 1434560128, 3901654538, 2078946336,
-            1418537059, 2725734455, 2530097881, 704759480,  2484428922, 1833969372, 3999408333,
-            503878844,  3287413716, 2950835531, 1402379354, 3861442503, 4131886119, 2033316109,
-            2873973176, 1321203603, 1267331405, 237900321,  1316780684, 793441242,  3281524559,
-            1273427916, 1730738847, 314311643,  1388727135, 1705533557, 1474310231, 1553835665,
-            1660074989, 291276309,  421164833,  3884815658, 3088049345, 3307042227, 3228948601,
-            1717605083, 1864502063, 3799516572, 2372822470, 2691586476, 1172840854, 1577099080,
-            870101866,  2139291021, 406996656,  255568268,  897760202,  674745664,  885214361,
-            3753233375, 3015215223, 1711461259, 3241363282, 2125360928, 2493601640, 2350228245,
-            3434627328, 2095642963, 3360932494, 3287396242, 4070512427, 3415702664, 1958354224,
-            3280206940, 3929504236, 3390499817, 4144225735, 3621750606, 3205006592, 3495743785,
-            269239326,  2181299371, 2898796651, 2613623219, 3988711298, 2162437858, 949553433,
-            3289670000, 3559525307, 3366925567, 2112148665, 955626393,  1790865381, 699223558,
-            3889584301, 1020750250, 4105283899, 2295851818, 4045668915, 2224770025, 766386910,
-            4265157386, 89139307,   2099710177, 1012450874, 1875492446, 1927399417, 767450812,
-            654474783,  4265293038, 4041215389, 4102336947, 4263617328, 2135826340, 2317231535,
-            3773895729, 403151111,  1400693138, 4255050194, 755369466,  2325764302, 2617301159,
-            4165707294, 1206304709, 2415645397, 4276004841, 1457022279, 662660652,  795140282,
-            828519889,  805830562,  1179976369, 2212548232, 755708248,  1034682071, 899950902,
-            1906046264, 1861009040, 310711525,  920739741,  2322414272, 3179236470, 81822135,
-            4111390320, 1800166783, 112253014,  688771939,  1050990794, 3124647483, 287052171,
-            1363630156, 3447798279, 1405733552, 3075862538, 1682808202, 1595154222, 1173705692,
-            680713285,  2748212230, 568610527,  3434965538, 1114942930, 2835858745, 2575992250,
-            3243355150, 2127580225, 1855934450, 3915941751, 2228679809, 1514780124, 1506688039,
-            1033083295, 793807083,  1120681149, 4105670165, 3999570340, 2083020131, 1213356023,
-            3684882757, 3375797774, 3577986103, 2092046164, 2593847443, 1826450612, 367828409,
-            3198272513, 1941316667, 943707510,  907134807,  2020457947, 1462193665, 2964617539,
-            4216491663, 2625270800, 2395371467, 3691003028, 3659016793, 2381847054, 3513105567,
-            3013019506, 2731245927,
-        },
-        {
-            1422614014, 745568314,  626407464,  4062559468, 2613459489, 4177655052, 1672395630,
-            1474977924, 2823487182, 465346019,  734137916,  4180764607, 2163513338, 606113658,
-            3174619730, 236399864,  1330756991, 501480170,  214631839,  3261385175, 375152635,
-            1167857634, 3209084532, 2627326222, 4116542738, 1141610533, 2611713002, 2879568649,
-            2450999424, 4178635237, 1577510171, 3602219173, 1086036574, 3847230824, 952482243,
-            3425534332, 3538133264, 100081443,  899217966,  4201856265, 3079090238, 534181866,
-            922058770,  2970777295, 369650741,  4119178891, 3687458877, 791773347,  1104312674,
-            1817383449, 2176704433, 2320954546, 5919830,    2667116610, 2528041838, 2507270250,
-            599611442,  1212200694, 1309013107, 3355393929, 2772549355, 2299276186, 992825286,
-            3422240806, 503594449,  51662720,   3222197639, 141783746,  2737882902, 2475601555,
-            908740719,  191019609,  2975375176, 243175543,  3730106217, 4071712904, 1687041846,
-            2634355887, 536261288,  3951913403, 3248345453, 397128304,  3569820105, 2603645138,
-            3337119827, 430438360,  3117458239, 1451121206, 3945746706, 966221054,  299140843,
-            2275672733, 3607591301, 553161648,  3412183424, 122428569,  1700141846, 3645464284,
-            2908320511, 3974328900, 3632774842, 728438630,  1454525397, 792806846,  1613261880,
-            955919338,  3491185541, 3088025223, 880384036,  2188908868, 3132909725, 2587987541,
-            2148544204, 2939041880, 1180486964, 1056296727, 1366626816, 264359013,  4122968290,
-            305060753,  2505315854, 1473453106, 1493379721, 2437980506, 3347660702, 1117268960,
-            737350320,  426755021,  3767690118, 557946404,  776356504,  3940866607, 4094636832,
-            1826751786, 3184358996, 681430125,  3677642982, 368203500,  3905975303, 1490281992,
-            1389642365, 137765097,  205669159,  1246244008, 4212479763, 1300084160, 4231139128,
-            2136901346, 3726585276, 623161609,  1811825608, 180789070,  2925990476, 2825279205,
-            1673043993, 3705651371, 1431745864, 1496694248, 4095386885, 4234561138, 4172917961,
-            1422614014, 745568314,  626407464,  4062559468, 3687237788, 4177655052, 1672395630,
-            1474977924, 2823487182, 1587943520, 734137916,  4180764607, 2163513338, 606113658,
-            26295413,   236399864,  1330756991, 501480170,  214631839,  2143738607, 375152635,
-            1167857634, 3209084532, 2627326222, 4163316777, 1141610533, 2611713002, 2879568649,
-            2450999424, 2896499380, 1577510171, 3602219173, 1086036574, 3847230824, 1747562651,
-            3425534332, 3538133264, 100081443,  899217966,  3175464274, 3079090238, 534181866,
-            922058770,  2970777295, 354960801,  4119178891, 3687458877, 791773347,  1104312674,
-            1324737541, 2176704433, 2320954546, 5919830,    2667116610, 3769675693, 2507270250,
-            599611442,  1212200694, 1309013107, 761362267,  2772549355, 2299276186, 992825286,
-            3422240806, 3454745046, 51662720,   3222197639, 141783746,  2737882902, 3685472695,
-            908740719,  191019609,  2975375176, 243175543,  3421729684, 4071712904, 1687041846,
-            2634355887, 536261288,  2224110105, 3248345453, 397128304,  3569820105, 2603645138,
-            3864052997, 430438360,  3117458239, 1451121206, 3945746706, 1341331776, 299140843,
-            2275672733, 3607591301, 553161648,  1770357812, 122428569,  1700141846, 3645464284,
-            2908320511, 1948506152, 3632774842, 728438630,  1454525397, 792806846,  2355940736,
-            955919338,  3491185541, 3088025223, 880384036,  3344528250, 3132909725, 2587987541,
-            2148544204, 2939041880, 3129382548, 1056296727, 1366626816, 264359013,  4122968290,
-            4277274394, 2505315854, 1473453106, 1493379721, 2437980506, 2679918744, 1117268960,
-            737350320,  426755021,  3767690118, 3288602888, 776356504,  3940866607, 4094636832,
-            1826751786, 3691211537, 681430125,  3677642982, 368203500,  3905975303, 3282179467,
-            1389642365, 137765097,  205669159,  1246244008, 190905788,  1300084160, 4231139128,
-            2136901346, 3726585276, 4195486416, 1811825608, 180789070,  2925990476, 2825279205,
-            4178449435, 3705651371, 1431745864, 1496694248, 4095386885, 2873097573, 4172917961,
-            1422614014, 745568314,  626407464,  1722312711, 3687237788, 4177655052, 1672395630,
-            1474977924, 2024003370, 1587943520, 734137916,  4180764607, 2163513338, 1364967574,
-            26295413,   236399864,  1330756991, 501480170,  1536139245, 2143738607, 375152635,
-            1167857634, 3209084532, 1734174521, 4163316777, 1141610533, 2611713002, 2879568649,
-            2064468840, 2896499380, 1577510171, 3602219173, 1086036574, 3798886620, 1747562651,
-            3425534332, 3538133264, 100081443,  2249267062, 3175464274, 3079090238, 534181866,
-            922058770,  2746781145, 354960801,  4119178891, 3687458877, 791773347,  2706864496,
-            1324737541, 2176704433, 2320954546, 5919830,    2869219459, 3769675693, 2507270250,
-            599611442,  1212200694, 850096640,  761362267,  2772549355, 2299276186, 992825286,
-            485094874,  3454745046, 51662720,   3222197639, 141783746,  2021374139, 3685472695,
-            908740719,  191019609,  2975375176, 1041779163, 3421729684, 4071712904, 1687041846,
-            2634355887, 19987553,   2224110105, 3248345453, 397128304,  3569820105, 1578508239,
-            3864052997, 430438360,  3117458239, 1451121206, 1684023254, 1341331776, 299140843,
-            2275672733, 3607591301, 1286144129, 1770357812, 122428569,  1700141846, 3645464284,
-            219076830,  1948506152, 3632774842, 728438630,  1454525397, 87546731,   2355940736,
-            955919338,  3491185541, 3088025223, 3515473498, 3344528250, 3132909725, 2587987541,
-            2148544204, 42072155,   3129382548, 1056296727, 1366626816, 264359013,  968091393,
-            4277274394, 2505315854, 1473453106, 1493379721, 782895604,  2679918744, 1117268960,
-            737350320,  426755021,  2470129671, 3288602888, 776356504,  3940866607, 4094636832,
-            2997418676, 3691211537, 681430125,  3677642982, 368203500,  2871942212, 3282179467,
-            1389642365, 137765097,  205669159,  4034462685, 190905788,  1300084160, 4231139128,
-            2136901346, 1290436652, 4195486416, 1811825608, 180789070,  2925990476, 297573148,
-            4178449435, 3705651371, 1431745864, 1496694248, 2639025266, 2873097573, 4172917961,
-            1422614014, 745568314,  79109127,   1722312711, 3687237788, 4177655052, 1672395630,
-            2275889686, 2024003370, 1587943520, 734137916,  4180764607, 2972478083, 1364967574,
-            26295413,   236399864,  1330756991, 2993537559, 1536139245, 2143738607, 375152635,
-            1167857634, 1642767614, 1734174521, 4163316777, 1141610533, 2611713002, 2305297588,
-            2064468840, 2896499380, 1577510171, 3602219173, 1186432020, 3798886620, 1747562651,
-            3425534332, 3538133264, 1520224863, 2249267062, 3175464274, 3079090238, 534181866,
-            896278173,  2746781145, 354960801,  4119178891, 3687458877, 498216399,  2706864496,
-            1324737541, 2176704433, 2320954546, 4079805360, 2869219459, 3769675693, 2507270250,
-            599611442,  3565226256, 850096640,  761362267,  2772549355, 2299276186, 2677346627,
-            485094874,  3454745046, 51662720,   3222197639, 3382050713, 2021374139, 3685472695,
-            908740719,  191019609,  3206529094, 1041779163, 3421729684, 4071712904, 1687041846,
-            1975653907, 19987553,   2224110105, 3248345453, 397128304,  3947867411, 1578508239,
-            3864052997, 430438360,  3117458239, 506184138,  1684023254, 1341331776, 299140843,
-            2275672733, 1246007175, 1286144129, 1770357812, 122428569,  1700141846, 1380627604,
-            219076830,  1948506152, 3632774842, 728438630,  741325400,  87546731,   2355940736,
-            955919338,  3491185541, 2009749241, 3515473498, 3344528250, 3132909725, 2587987541,
-            4179239555, 42072155,   3129382548, 1056296727, 1366626816, 662663329,  968091393,
-            4277274394, 2505315854, 1473453106, 2940801673, 782895604,  2679918744, 1117268960,
-            737350320,  3213008622, 2470129671, 3288602888, 776356504,  3940866607, 597265031,
-            2997418676, 3691211537, 681430125,  3677642982, 2831320482, 2871942212, 3282179467,
-            1389642365, 137765097,  4291409976, 4034462685, 190905788,  1300084160, 4231139128,
-            3405363480, 1290436652, 4195486416, 1811825608, 180789070,  961743232,  297573148,
-            4178449435, 3705651371, 1431745864, 867684235,  724340402,  908628085,  3495044652,
-            731336315,  533182385,  242923162,  3289197721, 1267997709, 3459795401, 2087259359,
-            1502664222, 1816646231, 1344831982, 663720651,  2837975898, 4231166412, 3124945345,
-            1993761181, 3485629662, 2245465419, 3057378210, 516102800,  2936944041, 3572161329,
-            352984364,  2900357636, 1415575560, 2091753672, 2825963801, 2724104407, 1299501923,
-            1657359321, 1550130457, 610114359,  3828744213, 388716699,  3439705129, 3070439867,
-            919619595,  2172728574, 4084688607, 3456890326, 1840820579, 3872838873, 3628026838,
-            2682088757, 3503650025, 2430005748, 746499283,  1715623680, 1420874706, 2450080884,
-            641622837,  204950771,  3047873690, 943754350,  305085705,  1308555468, 3635126672,
-            678074494,  3144516735, 519502311,  1021924740, 2425892921, 1921923198, 3970995205,
-            1428930748, 1227748268, 779177576,  792766749,  1743711958, 4207067972, 2880761975,
-            3377822914, 2126951236, 2171298276, 3210832488, 2404662,    4718070,    1199969553,
-            2536509336, 259971896,  154196822,  3860818601, 28032312,   2775753059, 3521972934,
-            1682502212, 2506942884, 2168174674, 3847722281, 2329799300, 1422640346, 4085576599,
-            1085412070, 1196631,    1958127818, 4073858120, 3278424297, 2775846042, 2575182017,
-            2195667575, 783442066,  2364909599, 1335275848, 713667690,  1408580999, 3900959800,
-            3982348261, 2051534001, 199907451,  2447718174, 3063656870, 1551155495, 182771510,
-            940435996,  4024502454, 922153016,  2725850983, 1849725135, 380619368,  3629023949,
-            2059433527, 1883932242, 1227931514, 2085311110, 924458047,  1025771575, 3781073659,
-            107471411,  1267118399, 3760715202, 1347622940, 4034372738, 3421706153, 3580697329,
-            1670475290, 2860126280, 1845615997, 1603283462, 4149391268, 1551692768, 2682185323,
-            3440026646, 2587033461, 1710966605, 2508342416, 2665658668, 3550416108, 4066627042,
-            949646586,  1953559766, 2388852230, 3852254670, 1023903711, 72650335,   367531331,
-            3974496600, 809091571,
-        },
-        {
-            1680024716, 2112340059, 3387475367, 2080916186, 1431532386, 3907378472, 2636491350,
-            2176128529, 2236616671, 3736851460, 2604001339, 3893075234, 3495918635, 4116370522,
-            1384310379, 3660102574, 2030233939, 2759207091, 49347923,   97526506,   2566932710,
-            1566181275, 3127827248, 578401670,  1499229308, 2581732444, 279715551,  809690877,
-            1438444015, 878935323,  1495277039, 3417305339, 2858903785, 3074075088, 603749086,
-            2370669734, 391683868,  3933465331, 2884128106, 1478317876, 1864988335, 2925823809,
-            4133578805, 218104493,  368652174,  1998600344, 1109346044, 1716435313, 415435111,
-            91393686,   2536620737, 1440068573, 481874870,  142128108,  988825519,  2077118779,
-            2858045339, 4068162251, 115593872,  1364244587, 3550167006, 3728768059, 1772423685,
-            2504624145, 248732306,  1412607307, 4081166331, 154438218,  1652901877, 3932533490,
-            3142799969, 3154073676, 3112018078, 2757873595, 2364830126, 2855791484, 793851407,
-            507785167,  263713916,  4060700051, 3291978358, 1584226715, 2546417990, 450747961,
-            2951067700, 2706009093, 1788578194, 4030171132, 2610979903, 573420740,  4269115622,
-            2180305819, 2646894726, 716649335,  3875715683, 853428184,  2436760738, 4190071217,
-            2754423535, 540698101,  4082489821, 741976046,  267559495,  1591532642, 2500610323,
-            3203248679, 147312102,  2772368222, 1412987047, 2295185573, 1932341300, 898396308,
-            1837129999, 3113914292, 2613354524, 3141601915, 276087167,  1887389351, 757801450,
-            3752353732, 2745818074, 1442953464, 3802648347, 223728071,  2169947402, 1338125300,
-            3642174036, 2794462634, 2326349851, 862746036,  3577092599, 627103363,  552173564,
-            4142604459, 2310329406, 583522272,  189323282,  1217612313, 73550248,   2434692829,
-            2757269706, 2392210091, 3032922600, 3573904125, 2897178037, 2632631469, 3085332665,
-            3775619904, 2563291734, 1351375865, 4043427793, 1803743084, 3112116579, 522940594,
-            2690374983, 2613871529, 3810037031, 1765642390, 534554747,  1930852049, 2264349344,
-            1680024716, 2112340059, 3387475367, 2080916186, 75966494,   3907378472, 2636491350,
-            2176128529, 2236616671, 2372987046, 2604001339, 3893075234, 3495918635, 4116370522,
-            534929913,  3660102574, 2030233939, 2759207091, 49347923,   987575186,  2566932710,
-            1566181275, 3127827248, 578401670,  3731513754, 2581732444, 279715551,  809690877,
-            1438444015, 2185866850, 1495277039, 3417305339, 2858903785, 3074075088, 4198538376,
-            2370669734, 391683868,  3933465331, 2884128106, 1400216510, 1864988335, 2925823809,
-            4133578805, 218104493,  2798390374, 1998600344, 1109346044, 1716435313, 415435111,
-            1892535124, 2536620737, 1440068573, 481874870,  142128108,  329082740,  2077118779,
-            2858045339, 4068162251, 115593872,  2644000449, 3550167006, 3728768059, 1772423685,
-            2504624145, 2140118619, 1412607307, 4081166331, 154438218,  1652901877, 3804911318,
-            3142799969, 3154073676, 3112018078, 2757873595, 50297646,   2855791484, 793851407,
-            507785167,  263713916,  3324588195, 3291978358, 1584226715, 2546417990, 450747961,
-            3455625012, 2706009093, 1788578194, 4030171132, 2610979903, 3835380965, 4269115622,
-            2180305819, 2646894726, 716649335,  2607142354, 853428184,  2436760738, 4190071217,
-            2754423535, 456808691,  4082489821, 741976046,  267559495,  1591532642, 2722205042,
-            3203248679, 147312102,  2772368222, 1412987047, 1950543946, 1932341300, 898396308,
-            1837129999, 3113914292, 428616392,  3141601915, 276087167,  1887389351, 757801450,
-            963534966,  2745818074, 1442953464, 3802648347, 223728071,  229039300,  1338125300,
-            3642174036, 2794462634, 2326349851, 206115203,  3577092599, 627103363,  552173564,
-            4142604459, 1492461846, 583522272,  189323282,  1217612313, 73550248,   3552211807,
-            2757269706, 2392210091, 3032922600, 3573904125, 810640644,  2632631469, 3085332665,
-            3775619904, 2563291734, 922608790,  4043427793, 1803743084, 3112116579, 522940594,
-            1785093944, 2613871529, 3810037031, 1765642390, 534554747,  3528050076, 2264349344,
-            1680024716, 2112340059, 3387475367, 3295682653, 75966494,   3907378472, 2636491350,
-            2176128529, 3574915532, 2372987046, 2604001339, 3893075234, 3495918635, 1280296085,
-            534929913,  3660102574, 2030233939, 2759207091, 299776535,  987575186,  2566932710,
-            1566181275, 3127827248, 3874691533, 3731513754, 2581732444, 279715551,  809690877,
-            3100791084, 2185866850, 1495277039, 3417305339, 2858903785, 1310351481, 4198538376,
-            2370669734, 391683868,  3933465331, 2749085130, 1400216510, 1864988335, 2925823809,
-            4133578805, 3352814594, 2798390374, 1998600344, 1109346044, 1716435313, 1571752941,
-            1892535124, 2536620737, 1440068573, 481874870,  2485033697, 329082740,  2077118779,
-            2858045339, 4068162251, 3837440666, 2644000449, 3550167006, 3728768059, 1772423685,
-            1176559812, 2140118619, 1412607307, 4081166331, 154438218,  2902622972, 3804911318,
-            3142799969, 3154073676, 3112018078, 2403391233, 50297646,   2855791484, 793851407,
-            507785167,  2351826747, 3324588195, 3291978358, 1584226715, 2546417990, 746876926,
-            3455625012, 2706009093, 1788578194, 4030171132, 3779307353, 3835380965, 4269115622,
-            2180305819, 2646894726, 2602235234, 2607142354, 853428184,  2436760738, 4190071217,
-            2066757692, 456808691,  4082489821, 741976046,  267559495,  3001080633, 2722205042,
-            3203248679, 147312102,  2772368222, 89950260,   1950543946, 1932341300, 898396308,
-            1837129999, 947911286,  428616392,  3141601915, 276087167,  1887389351, 2583987247,
-            963534966,  2745818074, 1442953464, 3802648347, 4229124441, 229039300,  1338125300,
-            3642174036, 2794462634, 2472155633, 206115203,  3577092599, 627103363,  552173564,
-            2586882739, 1492461846, 583522272,  189323282,  1217612313, 3501549884, 3552211807,
-            2757269706, 2392210091, 3032922600, 740675778,  810640644,  2632631469, 3085332665,
-            3775619904, 3643289881, 922608790,  4043427793, 1803743084, 3112116579, 2213337398,
-            1785093944, 2613871529, 3810037031, 1765642390, 762472016,  3528050076, 2264349344,
-            1680024716, 2112340059, 1372272974, 3295682653, 75966494,   3907378472, 2636491350,
-            3117471955, 3574915532, 2372987046, 2604001339, 3893075234, 915576383,  1280296085,
-            534929913,  3660102574, 2030233939, 346368350,  299776535,  987575186,  2566932710,
-            1566181275, 3535223896, 3874691533, 3731513754, 2581732444, 279715551,  2456894951,
-            3100791084, 2185866850, 1495277039, 3417305339, 1618871086, 1310351481, 4198538376,
-            2370669734, 391683868,  2009676005, 2749085130, 1400216510, 1864988335, 2925823809,
-            58955107,   3352814594, 2798390374, 1998600344, 1109346044, 3273979614, 1571752941,
-            1892535124, 2536620737, 1440068573, 1174168447, 2485033697, 329082740,  2077118779,
-            2858045339, 4062921629, 3837440666, 2644000449, 3550167006, 3728768059, 2642133401,
-            1176559812, 2140118619, 1412607307, 4081166331, 3124905304, 2902622972, 3804911318,
-            3142799969, 3154073676, 1449454613, 2403391233, 50297646,   2855791484, 793851407,
-            3514201526, 2351826747, 3324588195, 3291978358, 1584226715, 3636681672, 746876926,
-            3455625012, 2706009093, 1788578194, 3451519459, 3779307353, 3835380965, 4269115622,
-            2180305819, 3987989524, 2602235234, 2607142354, 853428184,  2436760738, 2151617107,
-            2066757692, 456808691,  4082489821, 741976046,  3590081269, 3001080633, 2722205042,
-            3203248679, 147312102,  3432947806, 89950260,   1950543946, 1932341300, 898396308,
-            3828432864, 947911286,  428616392,  3141601915, 276087167,  2517666433, 2583987247,
-            963534966,  2745818074, 1442953464, 2223986807, 4229124441, 229039300,  1338125300,
-            3642174036, 1053796945, 2472155633, 206115203,  3577092599, 627103363,  1113276084,
-            2586882739, 1492461846, 583522272,  189323282,  1490604990, 3501549884, 3552211807,
-            2757269706, 2392210091, 3545407532, 740675778,  810640644,  2632631469, 3085332665,
-            755862267,  3643289881, 922608790,  4043427793, 1803743084, 1954166630, 2213337398,
-            1785093944, 2613871529, 3810037031, 3042935707, 3162182177, 2791346436, 1901925289,
-            863100941,  3367519168, 1972623238, 3664303070, 604922059,  3026817982, 1436412310,
-            4096180631, 1597561857, 4206212303, 4127914332, 3228677359, 3985733659, 3597290113,
-            4251197894, 3451370603, 609679338,  3360835257, 1372239885, 638572328,  3806422284,
-            3974147336, 1804280837, 4209089291, 2021797469, 3557188838, 409727186,  2114649178,
-            687702120,  2542445992, 1235991799, 460479179,  2008348175, 887884478,  3942327811,
-            2999928223, 4171339789, 2286339235, 1293442231, 1575942850, 76122475,   1440527701,
-            2006558403, 1544148172, 895899367,  681826913,  4094701935, 3995413790, 1027509154,
-            2264990896, 1938238113, 213430250,  222469320,  609726517,  3581538106, 492802663,
-            120480843,  1720004062, 1132674507, 911082758,  2909148131, 566658805,  3964114445,
-            3483602509, 1793438750, 165562604,  3641830063, 2394205521, 3404874822, 1672998096,
-            916151953,  1141264477, 3171661340, 3803396219, 3018337382, 1863902683, 2474641928,
-            3250365071, 3897886220, 1219701051, 51332576,   1358614881, 1707407492, 3670647816,
-            923357625,  343687395,  3991339686, 3913575403, 1267727936, 4001357856, 3820224848,
-            2942896724, 3505936742, 1403285299, 1992762049, 567748449,  2202721585, 2781324216,
-            1724850068, 2408314541, 3073975813, 3992810029, 2475242354, 540562053,  2185198943,
-            3759352041, 3373885614, 1132999410, 1097554565, 4089342358, 3239542922, 2451748646,
-            407290679,  3188103200, 1708016248, 26848241,   2796711130, 3090711568, 4068389322,
-            3420916085, 3137567033, 2877819818, 22133454,   4629160,    3703695249, 1920151708,
-            1175452162, 130015299,  3331834713, 1099225384, 689254331,  1851083761, 2654970209,
-            3259297936, 3742819314, 3524284766, 2291819083, 3494031861, 16242889,   3545082774,
-            1997878108, 777447699,  4244916543, 3508640253, 3782278393, 2107258964, 2139074576,
-            1383217899, 2337934322, 3181899620, 1285955765, 2989610020, 3326862146, 1168587380,
-            801203532,  3020809957,
-        },
-        {
-            933490479,  3313125146, 2945930915, 542702775,  3130541830, 368308568,  3300121037,
-            140923563,  1808225350, 675755439,  2664595689, 3804947896, 66087696,   3985381451,
-            1558686487, 3666416555, 3379695889, 220246018,  1672881009, 2892069150, 2510439884,
-            971925663,  1215662923, 2970012114, 594984746,  381749398,  4126927079, 3157981459,
-            600499293,  3135598818, 2890711024, 929922151,  1712326103, 943907415,  1675320624,
-            766232204,  1242772053, 742014665,  1335204104, 912281589,  1579210154, 1494775520,
-            48716808,   706192311,  554455417,  2354910751, 710935413,  3770093716, 2618571729,
-            1851928820, 974014776,  2544194101, 3827992215, 2080193937, 3067172658, 133705061,
-            1985507145, 4188841492, 1179470883, 3292594785, 3799701864, 1785609515, 1626741985,
-            2417986600, 2577828889, 2103802149, 3862233680, 2045555174, 3756889459, 3525687273,
-            3359828116, 1128334880, 4279898765, 3365073678, 3741890898, 3962233804, 1542976376,
-            1431279211, 889316331,  499902334,  142639181,  3020615902, 3786584874, 3959096841,
-            1471001814, 444005693,  2336687155, 1884580597, 2787582476, 3568988824, 726629321,
-            1555382645, 561967149,  517653649,  1158334950, 3067524150, 2615156777, 1056114710,
-            650390650,  4099106961, 1344359578, 2114055012, 525298544,  860422162,  1403313066,
-            3780107277, 3244928128, 1200762180, 786579282,  3137931875, 288597876,  4079398129,
-            4197847995, 2627528953, 3177628578, 1092891102, 1112988009, 2385639207, 3840109460,
-            1063115781, 2399314881, 3683866831, 585408824,  3084332398, 3670131980, 2513502155,
-            2472149522, 782346683,  2044193079, 3443480823, 2754845916, 1562587631, 58946750,
-            530224335,  143978470,  624320750,  3451936383, 610538090,  3587449239, 942698445,
-            1547999527, 4066958832, 2717053960, 2448272087, 329221939,  4136759320, 3355157104,
-            804791891,  1255329234, 4259135027, 1903478128, 2014593283, 3117585574, 4082044186,
-            2245579365, 827758187,  357189974,  4045139244, 1791392939, 3206246257, 2723246950,
-            933490479,  3313125146, 2945930915, 542702775,  1145300473, 368308568,  3300121037,
-            140923563,  1808225350, 746067834,  2664595689, 3804947896, 66087696,   3985381451,
-            1128517870, 3666416555, 3379695889, 220246018,  1672881009, 2872762634, 2510439884,
-            971925663,  1215662923, 2970012114, 2087121873, 381749398,  4126927079, 3157981459,
-            600499293,  2435083611, 2890711024, 929922151,  1712326103, 943907415,  1713175926,
-            766232204,  1242772053, 742014665,  1335204104, 3035035938, 1579210154, 1494775520,
-            48716808,   706192311,  3638171625, 2354910751, 710935413,  3770093716, 2618571729,
-            666602987,  974014776,  2544194101, 3827992215, 2080193937, 1312422541, 133705061,
-            1985507145, 4188841492, 1179470883, 106286374,  3799701864, 1785609515, 1626741985,
-            2417986600, 2375400568, 2103802149, 3862233680, 2045555174, 3756889459, 1846971205,
-            3359828116, 1128334880, 4279898765, 3365073678, 3969283286, 3962233804, 1542976376,
-            1431279211, 889316331,  18574084,   142639181,  3020615902, 3786584874, 3959096841,
-            209987162,  444005693,  2336687155, 1884580597, 2787582476, 3178649166, 726629321,
-            1555382645, 561967149,  517653649,  2007367326, 3067524150, 2615156777, 1056114710,
-            650390650,  4028867061, 1344359578, 2114055012, 525298544,  860422162,  3989503987,
-            3780107277, 3244928128, 1200762180, 786579282,  2255518878, 288597876,  4079398129,
-            4197847995, 2627528953, 2784599308, 1092891102, 1112988009, 2385639207, 3840109460,
-            3223947367, 2399314881, 3683866831, 585408824,  3084332398, 526068544,  2513502155,
-            2472149522, 782346683,  2044193079, 2226209337, 2754845916, 1562587631, 58946750,
-            530224335,  3213006637, 624320750,  3451936383, 610538090,  3587449239, 2739588261,
-            1547999527, 4066958832, 2717053960, 2448272087, 3353816627, 4136759320, 3355157104,
-            804791891,  1255329234, 4266569275, 1903478128, 2014593283, 3117585574, 4082044186,
-            3967062994, 827758187,  357189974,  4045139244, 1791392939, 616060239,  2723246950,
-            933490479,  3313125146, 2945930915, 1332038051, 1145300473, 368308568,  3300121037,
-            140923563,  2511885556, 746067834,  2664595689, 3804947896, 66087696,   1980317332,
-            1128517870, 3666416555, 3379695889, 220246018,  4000878201, 2872762634, 2510439884,
-            971925663,  1215662923, 4133354120, 2087121873, 381749398,  4126927079, 3157981459,
-            292243391,  2435083611, 2890711024, 929922151,  1712326103, 3006681689, 1713175926,
-            766232204,  1242772053, 742014665,  3456364219, 3035035938, 1579210154, 1494775520,
-            48716808,   609753091,  3638171625, 2354910751, 710935413,  3770093716, 1545748034,
-            666602987,  974014776,  2544194101, 3827992215, 3602145649, 1312422541, 133705061,
-            1985507145, 4188841492, 1147157356, 106286374,  3799701864, 1785609515, 1626741985,
-            3752675260, 2375400568, 2103802149, 3862233680, 2045555174, 2603373505, 1846971205,
-            3359828116, 1128334880, 4279898765, 370622143,  3969283286, 3962233804, 1542976376,
-            1431279211, 204166996,  18574084,   142639181,  3020615902, 3786584874, 2484528249,
-            209987162,  444005693,  2336687155, 1884580597, 533456943,  3178649166, 726629321,
-            1555382645, 561967149,  1113881605, 2007367326, 3067524150, 2615156777, 1056114710,
-            1606394648, 4028867061, 1344359578, 2114055012, 525298544,  217251176,  3989503987,
-            3780107277, 3244928128, 1200762180, 1459132888, 2255518878, 288597876,  4079398129,
-            4197847995, 1620854868, 2784599308, 1092891102, 1112988009, 2385639207, 1948295741,
-            3223947367, 2399314881, 3683866831, 585408824,  1988430831, 526068544,  2513502155,
-            2472149522, 782346683,  448235353,  2226209337, 2754845916, 1562587631, 58946750,
-            3185138268, 3213006637, 624320750,  3451936383, 610538090,  3510634555, 2739588261,
-            1547999527, 4066958832, 2717053960, 2715837145, 3353816627, 4136759320, 3355157104,
-            804791891,  1536141167, 4266569275, 1903478128, 2014593283, 3117585574, 1639076913,
-            3967062994, 827758187,  357189974,  4045139244, 3694506809, 616060239,  2723246950,
-            933490479,  3313125146, 2827380925, 1332038051, 1145300473, 368308568,  3300121037,
-            2624177120, 2511885556, 746067834,  2664595689, 3804947896, 1049488043, 1980317332,
-            1128517870, 3666416555, 3379695889, 2216940208, 4000878201, 2872762634, 2510439884,
-            971925663,  239365839,  4133354120, 2087121873, 381749398,  4126927079, 3612034133,
-            292243391,  2435083611, 2890711024, 929922151,  2616513455, 3006681689, 1713175926,
-            766232204,  1242772053, 1384815328, 3456364219, 3035035938, 1579210154, 1494775520,
-            799283929,  609753091,  3638171625, 2354910751, 710935413,  3392684583, 1545748034,
-            666602987,  974014776,  2544194101, 2279084188, 3602145649, 1312422541, 133705061,
-            1985507145, 3058135623, 1147157356, 106286374,  3799701864, 1785609515, 1161163240,
-            3752675260, 2375400568, 2103802149, 3862233680, 1614030006, 2603373505, 1846971205,
-            3359828116, 1128334880, 1940452033, 370622143,  3969283286, 3962233804, 1542976376,
-            3287376549, 204166996,  18574084,   142639181,  3020615902, 4224982082, 2484528249,
-            209987162,  444005693,  2336687155, 1912032864, 533456943,  3178649166, 726629321,
-            1555382645, 3342806318, 1113881605, 2007367326, 3067524150, 2615156777, 2857995866,
-            1606394648, 4028867061, 1344359578, 2114055012, 2790012367, 217251176,  3989503987,
-            3780107277, 3244928128, 3733656941, 1459132888, 2255518878, 288597876,  4079398129,
-            2259492957, 1620854868, 2784599308, 1092891102, 1112988009, 4291653838, 1948295741,
-            3223947367, 2399314881, 3683866831, 2901697017, 1988430831, 526068544,  2513502155,
-            2472149522, 2945726643, 448235353,  2226209337, 2754845916, 1562587631, 3659083222,
-            3185138268, 3213006637, 624320750,  3451936383, 630682079,  3510634555, 2739588261,
-            1547999527, 4066958832, 2759190315, 2715837145, 3353816627, 4136759320, 3355157104,
-            4288173763, 1536141167, 4266569275, 1903478128, 2014593283, 3216774546, 1639076913,
-            3967062994, 827758187,  357189974,  605356478,  4153231248, 711495261,  745228380,
-            3341106470, 3782166180, 1478103347, 170947306,  2532511578, 2598647660, 635215721,
-            1350321048, 1643587244, 3199482613, 121720609,  40648139,   4229660203, 2888024656,
-            1489753828, 62340729,   263058711,  4183661698, 2756883815, 3706559061, 3222886153,
-            301154090,  491727482,  3632306249, 434424174,  28120602,   3922272017, 2754818496,
-            4080732963, 656930109,  3810713213, 3237652811, 640778991,  3081487450, 2180381494,
-            4112032074, 1926478629, 3010963356, 3548761656, 2304149648, 749764857,  49839007,
-            865224891,  3171066614, 243849186,  3518666855, 2595318404, 1180925276, 1161335621,
-            1749652656, 1905095368, 2101344267, 581702892,  1346552346, 1497799920, 181740510,
-            2469299801, 2935064351, 3996499850, 4224114115, 549029700,  516827645,  2865295950,
-            1800430333, 1399806362, 922954381,  384456191,  1601818715, 181045790,  600485696,
-            1263873754, 3628858491, 2757408647, 1195222119, 1416335947, 2107267250, 2342023937,
-            77857785,   329690991,  956662767,  3118014778, 4046662235, 506844943,  3047851807,
-            420022834,  3179367942, 698851602,  3466529156, 1192668699, 2698864910, 3286411776,
-            263829821,  4117769567, 4290790138, 3319474485, 2964946423, 1288507997, 455736258,
-            733497220,  2287739544, 3524940605, 349364502,  1065989225, 2686954359, 3204364553,
-            80987396,   2530207478, 2520928176, 1522372955, 1215346887, 114113167,  1039579468,
-            1221858208, 1304335697, 3283411188, 2223998671, 4257048517, 1865293662, 1405601001,
-            174538047,  3215336426, 2367119536, 2472338038, 4078169485, 1533190144, 3196000053,
-            3724983339, 2584168243, 2495436034, 1603151164, 1248929244, 4086270641, 1710673573,
-            737405097,  102717413,  1563659448, 1834879061, 1221163402, 2575921585, 985906452,
-            1720132659, 2998919999, 382338068,  3073009357, 1892501758, 2254223590, 3952460715,
-            336434536,  1333932551, 2982976572, 3233306956, 1281386946, 4091313232, 2456692833,
-            2115681203, 1330392536,
-        },
-        {
-            3810471203, 1017064446, 1595207573, 441087832,  3326746890, 3294064431, 167972517,
-            3625210015, 1011845006, 2980240819, 1778354660, 3041730987, 1598611350, 2015169745,
-            2321724978, 3390812967, 2432904511, 113261909,  3957193232, 3806115908, 2965828929,
-            2035392295, 3500116619, 2881232416, 1672212265, 1607201428, 425148945,  1262591961,
-            2221781268, 4215047456, 2148245850, 2787488981, 1077262192, 2085467561, 3053954888,
-            3584435116, 3013084787, 287099941,  1290407232, 4078552287, 2658945475, 4251530898,
-            2403086478, 2884923598, 3545110453, 4105390090, 343200643,  3189888821, 4086304363,
-            3466483195, 259435633,  2846377387, 497258846,  272775541,  985737911,  2957688879,
-            2180784344, 3434619542, 3643384838, 2228652440, 3107480718, 2208729807, 596436263,
-            3255120711, 3248886970, 519242965,  602979109,  1619614,    1391563565, 56262588,
-            1584463910, 1849038201, 728022295,  848624947,  1813827408, 428214945,  1246345586,
-            4213351865, 168985863,  456608054,  4277869380, 3886828599, 2264054549, 3110967170,
-            3138175314, 2649164828, 3369378320, 3648350039, 3524848759, 1468470706, 3558859222,
-            2669673235, 831851874,  4285651092, 4224147373, 1088456706, 231954609,  3118005852,
-            225508069,  883105389,  856371341,  2001356578, 639336670,  2363501707, 3622399552,
-            4024065226, 1093546838, 4263608561, 1852072422, 425195042,  2441102396, 296426333,
-            384641750,  3559334435, 1757327033, 1016016207, 3595686646, 24777793,   623926105,
-            2169195923, 1779396793, 646997837,  1459728476, 2644865980, 1994581089, 3956278544,
-            919592580,  2153558858, 2029633394, 3837501009, 4016560170, 484838096,  3652199054,
-            1971790561, 605295089,  637470291,  278970544,  3574824693, 295866521,  1755035156,
-            2542341803, 1588716357, 1502596918, 4124554133, 3547049843, 1768033045, 1531734630,
-            101448323,  3233017580, 1793222944, 3187853500, 186000900,  803444571,  2820254958,
-            2009384608, 2384668855, 2222812920, 633608665,  2028480056, 1258028235, 545095949,
-            3810471203, 1017064446, 1595207573, 441087832,  899068662,  3294064431, 167972517,
-            3625210015, 1011845006, 3951305793, 1778354660, 3041730987, 1598611350, 2015169745,
-            1885149424, 3390812967, 2432904511, 113261909,  3957193232, 3953443155, 2965828929,
-            2035392295, 3500116619, 2881232416, 329153573,  1607201428, 425148945,  1262591961,
-            2221781268, 78028761,   2148245850, 2787488981, 1077262192, 2085467561, 647235899,
-            3584435116, 3013084787, 287099941,  1290407232, 1467385694, 2658945475, 4251530898,
-            2403086478, 2884923598, 3489351040, 4105390090, 343200643,  3189888821, 4086304363,
-            3521512280, 259435633,  2846377387, 497258846,  272775541,  1367093111, 2957688879,
-            2180784344, 3434619542, 3643384838, 411877686,  3107480718, 2208729807, 596436263,
-            3255120711, 584605030,  519242965,  602979109,  1619614,    1391563565, 3902518209,
-            1584463910, 1849038201, 728022295,  848624947,  1932969318, 428214945,  1246345586,
-            4213351865, 168985863,  2770345237, 4277869380, 3886828599, 2264054549, 3110967170,
-            2953581033, 2649164828, 3369378320, 3648350039, 3524848759, 2380353977, 3558859222,
-            2669673235, 831851874,  4285651092, 1214052447, 1088456706, 231954609,  3118005852,
-            225508069,  1766983646, 856371341,  2001356578, 639336670,  2363501707, 1782816591,
-            4024065226, 1093546838, 4263608561, 1852072422, 1149716600, 2441102396, 296426333,
-            384641750,  3559334435, 2391309970, 1016016207, 3595686646, 24777793,   623926105,
-            362098678,  1779396793, 646997837,  1459728476, 2644865980, 3238673748, 3956278544,
-            919592580,  2153558858, 2029633394, 115778559,  4016560170, 484838096,  3652199054,
-            1971790561, 737357475,  637470291,  278970544,  3574824693, 295866521,  3989745853,
-            2542341803, 1588716357, 1502596918, 4124554133, 3016849744, 1768033045, 1531734630,
-            101448323,  3233017580, 4157527581, 3187853500, 186000900,  803444571,  2820254958,
-            1980528062, 2384668855, 2222812920, 633608665,  2028480056, 3166710281, 545095949,
-            3810471203, 1017064446, 1595207573, 693962828,  899068662,  3294064431, 167972517,
-            3625210015, 1486040398, 3951305793, 1778354660, 3041730987, 1598611350, 2859363132,
-            1885149424, 3390812967, 2432904511, 113261909,  664880478,  3953443155, 2965828929,
-            2035392295, 3500116619, 558081801,  329153573,  1607201428, 425148945,  1262591961,
-            3716247699, 78028761,   2148245850, 2787488981, 1077262192, 4206362947, 647235899,
-            3584435116, 3013084787, 287099941,  2536781098, 1467385694, 2658945475, 4251530898,
-            2403086478, 3075072413, 3489351040, 4105390090, 343200643,  3189888821, 2540485172,
-            3521512280, 259435633,  2846377387, 497258846,  2442427327, 1367093111, 2957688879,
-            2180784344, 3434619542, 1593967423, 411877686,  3107480718, 2208729807, 596436263,
-            1048686529, 584605030,  519242965,  602979109,  1619614,    2072745381, 3902518209,
-            1584463910, 1849038201, 728022295,  846033949,  1932969318, 428214945,  1246345586,
-            4213351865, 1066373275, 2770345237, 4277869380, 3886828599, 2264054549, 1877859690,
-            2953581033, 2649164828, 3369378320, 3648350039, 2537763389, 2380353977, 3558859222,
-            2669673235, 831851874,  522748140,  1214052447, 1088456706, 231954609,  3118005852,
-            1381269315, 1766983646, 856371341,  2001356578, 639336670,  667275675,  1782816591,
-            4024065226, 1093546838, 4263608561, 2057337961, 1149716600, 2441102396, 296426333,
-            384641750,  340523210,  2391309970, 1016016207, 3595686646, 24777793,   3094832341,
-            362098678,  1779396793, 646997837,  1459728476, 1169681568, 3238673748, 3956278544,
-            919592580,  2153558858, 388335108,  115778559,  4016560170, 484838096,  3652199054,
-            1764858181, 737357475,  637470291,  278970544,  3574824693, 3671458900, 3989745853,
-            2542341803, 1588716357, 1502596918, 2102871406, 3016849744, 1768033045, 1531734630,
-            101448323,  3964942332, 4157527581, 3187853500, 186000900,  803444571,  3425652083,
-            1980528062, 2384668855, 2222812920, 633608665,  3035373876, 3166710281, 545095949,
-            3810471203, 1017064446, 669282349,  693962828,  899068662,  3294064431, 167972517,
-            2007256988, 1486040398, 3951305793, 1778354660, 3041730987, 2827768941, 2859363132,
-            1885149424, 3390812967, 2432904511, 3700915653, 664880478,  3953443155, 2965828929,
-            2035392295, 1461208330, 558081801,  329153573,  1607201428, 425148945,  1700881129,
-            3716247699, 78028761,   2148245850, 2787488981, 2706775080, 4206362947, 647235899,
-            3584435116, 3013084787, 2958545221, 2536781098, 1467385694, 2658945475, 4251530898,
-            2241012567, 3075072413, 3489351040, 4105390090, 343200643,  490164649,  2540485172,
-            3521512280, 259435633,  2846377387, 4073611831, 2442427327, 1367093111, 2957688879,
-            2180784344, 1835510773, 1593967423, 411877686,  3107480718, 2208729807, 3306732468,
-            1048686529, 584605030,  519242965,  602979109,  2978864605, 2072745381, 3902518209,
-            1584463910, 1849038201, 3284115169, 846033949,  1932969318, 428214945,  1246345586,
-            194166002,  1066373275, 2770345237, 4277869380, 3886828599, 1874087886, 1877859690,
-            2953581033, 2649164828, 3369378320, 4145454028, 2537763389, 2380353977, 3558859222,
-            2669673235, 739345884,  522748140,  1214052447, 1088456706, 231954609,  3605603781,
-            1381269315, 1766983646, 856371341,  2001356578, 2049940324, 667275675,  1782816591,
-            4024065226, 1093546838, 152524382,  2057337961, 1149716600, 2441102396, 296426333,
-            3195130788, 340523210,  2391309970, 1016016207, 3595686646, 180492441,  3094832341,
-            362098678,  1779396793, 646997837,  2458167607, 1169681568, 3238673748, 3956278544,
-            919592580,  3421005218, 388335108,  115778559,  4016560170, 484838096,  2649676374,
-            1764858181, 737357475,  637470291,  278970544,  2236401278, 3671458900, 3989745853,
-            2542341803, 1588716357, 1241570134, 2102871406, 3016849744, 1768033045, 1531734630,
-            1765654724, 3964942332, 4157527581, 3187853500, 186000900,  2189716659, 3425652083,
-            1980528062, 2384668855, 2222812920, 3955466207, 2426547616, 3846752458, 3015538636,
-            2342593365, 3613176865, 3484860981, 4278370194, 1979143878, 1159739458, 3714038404,
-            396530346,  3276617756, 3293940597, 4050183149, 1418571985, 402563753,  2702853013,
-            2289900621, 2267058511, 3482161995, 3375026019, 1988640267, 3674438074, 4124612310,
-            1057883705, 434730475,  3210959778, 4102029739, 2140938750, 3176753074, 2356971512,
-            3969685288, 1556275580, 2648433428, 3959375381, 478841344,  1496991528, 3309714981,
-            569990368,  3660587501, 2550379574, 1177519842, 2652707373, 543943404,  1912551128,
-            2278132032, 1484596780, 3570913985, 2982401320, 1413776035, 3177275459, 3036211597,
-            1091740466, 3448424311, 1445187645, 3205024875, 3135795254, 823738729,  3742134467,
-            4066657438, 1226311678, 2403605393, 537573634,  3457409768, 1940233423, 1761431281,
-            1129427309, 2443661283, 3200814257, 4094866249, 2666869754, 604785127,  2213464116,
-            3002782918, 468024929,  2490681314, 3666681384, 1583346053, 3049668798, 3592153237,
-            2573082448, 3082970021, 1461796708, 832526980,  3728763274, 355291229,  4029588456,
-            832358279,  2125298737, 3681181038, 3245535160, 1333342738, 1868897492, 446790068,
-            1278093154, 2090118615, 4158925515, 4062165914, 822726809,  1154960183, 286518382,
-            1170424276, 2554691236, 3674133415, 2765714969, 2330865375, 1908307334, 3537287082,
-            410252600,  3977128218, 424210327,  2919071615, 2715518134, 64568844,   480972649,
-            2488797168, 1302817038, 2213995265, 4229997295, 2200797852, 109368057,  3033807022,
-            1907400078, 645977948,  1410909090, 3700787906, 3375062371, 629087832,  1344281719,
-            4249981139, 3457543297, 1218556849, 864222854,  1458445945, 914545469,  3451164212,
-            1088025757, 1129933985, 953788883,  2406172924, 170364546,  3505490646, 1027553899,
-            2864067776, 436854871,  1342782209, 761167471,  2660173631, 4159507498, 4172028400,
-            2442254644, 2110123720, 2315991253, 873066601,  1725470559, 3831299052, 678672031,
-            1585431329, 3495750550,
-        },
-        {
-            443822763,  2617975176, 3254044970, 1660258831, 83579601,   1808539465, 317885672,
-            3991427137, 3321564893, 268585981,  1229400339, 3047551438, 2972941475, 4215493850,
-            566964640,  3688585429, 3339063541, 3534646061, 4186461028, 1286953281, 2598882345,
-            2383770576, 731405653,  2880475907, 1040589184, 3009480184, 1208201220, 1827920473,
-            1794801377, 3982078619, 742140518,  3971280655, 1193278016, 3169150563, 313287645,
-            1831105827, 2731649953, 2404393252, 924461258,  2677319062, 2948772966, 937895795,
-            4189679732, 1774271828, 2677727602, 2707002233, 1809047411, 661004983,  3014267383,
-            2872139608, 3968587297, 19885975,   543152887,  366391029,  722324037,  1913211813,
-            146321786,  1997608519, 592650622,  1044778758, 3832189925, 3612680318, 2368236502,
-            3064266221, 981157115,  1627679873, 1799333574, 834335418,  1498039174, 2805033332,
-            1998016692, 1169957544, 1895071516, 1069647228, 1480489520, 3966691071, 3103927323,
-            2431237369, 2137206113, 2353809068, 1068011303, 2520651972, 2499924180, 3686002233,
-            3687347316, 788249577,  2896504415, 3759760094, 4014757389, 2024401878, 2300962374,
-            4119410323, 2441666788, 2786492592, 579299204,  4122027806, 311807642,  3219204958,
-            150608954,  2022629101, 3790300010, 3662519329, 4052037551, 4248835625, 1718235383,
-            2958660371, 1735279524, 1378834913, 1216129888, 2437510690, 2676923343, 1599285231,
-            3753618998, 480529245,  3087281583, 550426644,  3736836926, 2485041496, 1737549696,
-            1645102176, 1200055703, 3260394491, 940980471,  2623481712, 557314689,  1019099714,
-            3916495751, 3969283486, 1943011707, 2345285361, 483435037,  2321927081, 3188348849,
-            1766202170, 2785488406, 2113378713, 2144453617, 1471687985, 334794809,  293421420,
-            1446462098, 2522107873, 779958686,  3335813282, 766374152,  766890676,  655476498,
-            289677673,  2505730670, 2939590586, 1929433288, 4281171844, 986273287,  1561174708,
-            1447107231, 3704800272, 777744840,  2069677978, 414840083,  3152336277, 4184350749,
-            443822763,  2617975176, 3254044970, 1660258831, 2908796181, 1808539465, 317885672,
-            3991427137, 3321564893, 772854637,  1229400339, 3047551438, 2972941475, 4215493850,
-            477447548,  3688585429, 3339063541, 3534646061, 4186461028, 488767979,  2598882345,
-            2383770576, 731405653,  2880475907, 3543144493, 3009480184, 1208201220, 1827920473,
-            1794801377, 3866001719, 742140518,  3971280655, 1193278016, 3169150563, 2481140666,
-            1831105827, 2731649953, 2404393252, 924461258,  761267842,  2948772966, 937895795,
-            4189679732, 1774271828, 403871172,  2707002233, 1809047411, 661004983,  3014267383,
-            3879775701, 3968587297, 19885975,   543152887,  366391029,  3542671199, 1913211813,
-            146321786,  1997608519, 592650622,  1309467735, 3832189925, 3612680318, 2368236502,
-            3064266221, 755548658,  1627679873, 1799333574, 834335418,  1498039174, 2702935557,
-            1998016692, 1169957544, 1895071516, 1069647228, 66509916,   3966691071, 3103927323,
-            2431237369, 2137206113, 1949363292, 1068011303, 2520651972, 2499924180, 3686002233,
-            736508513,  788249577,  2896504415, 3759760094, 4014757389, 2209946842, 2300962374,
-            4119410323, 2441666788, 2786492592, 1146775182, 4122027806, 311807642,  3219204958,
-            150608954,  4225852770, 3790300010, 3662519329, 4052037551, 4248835625, 997662360,
-            2958660371, 1735279524, 1378834913, 1216129888, 774488397,  2676923343, 1599285231,
-            3753618998, 480529245,  593086335,  550426644,  3736836926, 2485041496, 1737549696,
-            544025459,  1200055703, 3260394491, 940980471,  2623481712, 1453424658, 1019099714,
-            3916495751, 3969283486, 1943011707, 953496058,  483435037,  2321927081, 3188348849,
-            1766202170, 3696561411, 2113378713, 2144453617, 1471687985, 334794809,  2819725485,
-            1446462098, 2522107873, 779958686,  3335813282, 788019418,  766890676,  655476498,
-            289677673,  2505730670, 2450394548, 1929433288, 4281171844, 986273287,  1561174708,
-            531305960,  3704800272, 777744840,  2069677978, 414840083,  1984992764, 4184350749,
-            443822763,  2617975176, 3254044970, 2383298053, 2908796181, 1808539465, 317885672,
-            3991427137, 4121461164, 772854637,  1229400339, 3047551438, 2972941475, 10090604,
-            477447548,  3688585429, 3339063541, 3534646061, 3746127528, 488767979,  2598882345,
-            2383770576, 731405653,  1407818058, 3543144493, 3009480184, 1208201220, 1827920473,
-            2908141953, 3866001719, 742140518,  3971280655, 1193278016, 4199758007, 2481140666,
-            1831105827, 2731649953, 2404393252, 3417769941, 761267842,  2948772966, 937895795,
-            4189679732, 2179112981, 403871172,  2707002233, 1809047411, 661004983,  359685773,
-            3879775701, 3968587297, 19885975,   543152887,  442036819,  3542671199, 1913211813,
-            146321786,  1997608519, 1247905547, 1309467735, 3832189925, 3612680318, 2368236502,
-            3955518778, 755548658,  1627679873, 1799333574, 834335418,  857000832,  2702935557,
-            1998016692, 1169957544, 1895071516, 1275870005, 66509916,   3966691071, 3103927323,
-            2431237369, 3300337481, 1949363292, 1068011303, 2520651972, 2499924180, 77121214,
-            736508513,  788249577,  2896504415, 3759760094, 3512317936, 2209946842, 2300962374,
-            4119410323, 2441666788, 4183005285, 1146775182, 4122027806, 311807642,  3219204958,
-            261580567,  4225852770, 3790300010, 3662519329, 4052037551, 323897843,  997662360,
-            2958660371, 1735279524, 1378834913, 323957150,  774488397,  2676923343, 1599285231,
-            3753618998, 1921232288, 593086335,  550426644,  3736836926, 2485041496, 3602163236,
-            544025459,  1200055703, 3260394491, 940980471,  1028398083, 1453424658, 1019099714,
-            3916495751, 3969283486, 393822731,  953496058,  483435037,  2321927081, 3188348849,
-            285532832,  3696561411, 2113378713, 2144453617, 1471687985, 69322298,   2819725485,
-            1446462098, 2522107873, 779958686,  1787836942, 788019418,  766890676,  655476498,
-            289677673,  2660626516, 2450394548, 1929433288, 4281171844, 986273287,  2548103379,
-            531305960,  3704800272, 777744840,  2069677978, 2747864397, 1984992764, 4184350749,
-            443822763,  2617975176, 1502436985, 2383298053, 2908796181, 1808539465, 317885672,
-            996189897,  4121461164, 772854637,  1229400339, 3047551438, 688295839,  10090604,
-            477447548,  3688585429, 3339063541, 4237469526, 3746127528, 488767979,  2598882345,
-            2383770576, 2090764278, 1407818058, 3543144493, 3009480184, 1208201220, 3861453329,
-            2908141953, 3866001719, 742140518,  3971280655, 3433119849, 4199758007, 2481140666,
-            1831105827, 2731649953, 1932519025, 3417769941, 761267842,  2948772966, 937895795,
-            1085066096, 2179112981, 403871172,  2707002233, 1809047411, 3634902634, 359685773,
-            3879775701, 3968587297, 19885975,   2414316707, 442036819,  3542671199, 1913211813,
-            146321786,  3511220895, 1247905547, 1309467735, 3832189925, 3612680318, 1245975354,
-            3955518778, 755548658,  1627679873, 1799333574, 3804960549, 857000832,  2702935557,
-            1998016692, 1169957544, 3104216487, 1275870005, 66509916,   3966691071, 3103927323,
-            720883648,  3300337481, 1949363292, 1068011303, 2520651972, 2823297395, 77121214,
-            736508513,  788249577,  2896504415, 275465265,  3512317936, 2209946842, 2300962374,
-            4119410323, 2844156698, 4183005285, 1146775182, 4122027806, 311807642,  1651130530,
-            261580567,  4225852770, 3790300010, 3662519329, 840597500,  323897843,  997662360,
-            2958660371, 1735279524, 633847174,  323957150,  774488397,  2676923343, 1599285231,
-            2134556840, 1921232288, 593086335,  550426644,  3736836926, 1569973061, 3602163236,
-            544025459,  1200055703, 3260394491, 1803108998, 1028398083, 1453424658, 1019099714,
-            3916495751, 1797728352, 393822731,  953496058,  483435037,  2321927081, 2525981247,
-            285532832,  3696561411, 2113378713, 2144453617, 2430836689, 69322298,   2819725485,
-            1446462098, 2522107873, 4255934708, 1787836942, 788019418,  766890676,  655476498,
-            3689654014, 2660626516, 2450394548, 1929433288, 4281171844, 1933604952, 2548103379,
-            531305960,  3704800272, 777744840,  2346268423, 3513447542, 365789810,  4221773731,
-            1997167178, 399644303,  278805852,  2000160893, 4283987314, 427779976,  86022759,
-            4252394781, 2999125664, 4015668879, 2585311752, 747522593,  2377240724, 729143413,
-            3395968510, 607029651,  4185577020, 3002590200, 386303436,  2531086146, 400493154,
-            1589736874, 3920104228, 620808218,  2380991923, 3010412828, 3275119027, 3122520593,
-            1938418498, 1007005076, 412587084,  2285442346, 2791174285, 4251631863, 899648696,
-            3977830462, 3072299666, 2058893468, 2633616229, 468027657,  3129569573, 3422026104,
-            2671860340, 2078006660, 2380613975, 2774849668, 2667749811, 1690480850, 2850211809,
-            145626046,  1908538286, 3804603854, 2707687629, 1528201205, 3047365029, 2366003425,
-            3196603519, 771159084,  2860270830, 246303818,  806924153,  337275004,  1702373349,
-            3995861271, 2312635050, 914382425,  594028299,  3629132222, 1175222666, 2514763313,
-            3564556054, 3427148192, 3760883051, 1033746703, 1252788961, 3057674925, 1110852300,
-            3454744521, 3940478195, 3671879894, 1705064014, 992369827,  1620069320, 1258078799,
-            3730583666, 807359987,  435362192,  2907216820, 1928577470, 914727315,  2114363539,
-            2506764652, 2444953425, 1959227314, 276989619,  3707534483, 2771040965, 3817012339,
-            1144156281, 2161494463, 1004604069, 4093513240, 787763001,  3209087068, 3233341032,
-            4083164658, 2765145621, 249753082,  3352263927, 3248940870, 896753599,  2908181799,
-            472903814,  538939279,  969923902,  218349811,  616695316,  2821188381, 1057414308,
-            1524605040, 4043115245, 4010819293, 2197606038, 1149831340, 2206296201, 7244326,
-            2415236713, 3663896723, 675306236,  1801134902, 2655765679, 3460457737, 1320407721,
-            982095310,  335726041,  2222986428, 3514175052, 1100321181, 1169446823, 3987066634,
-            3146943896, 110473933,  4214872633, 2443829303, 3209812205, 2464418393, 1051729562,
-            3847993444, 2077116464, 3921692036, 2596312396, 377413023,  1698604487, 4074659092,
-            3983886588, 833064172,
-        },
-        {
-            1998393432, 2665389278, 3989307699, 3267631636, 3861682977, 3243522970, 1243992413,
-            2200497260, 3821883021, 4187123083, 3451270040, 3044132745, 2101287249, 2340839784,
-            227040990,  1724350416, 3228881240, 3123386528, 4279362126, 3098224464, 2635534069,
-            3622906431, 206207480,  1894245533, 2152374527, 1011223653, 7271757,    2972858087,
-            207942127,  3355362797, 2593296740, 174093751,  3713822176, 4212355586, 3335605224,
-            1171716408, 2867257989, 1522213957, 2016192462, 4229688395, 2174928148, 1468226225,
-            3938290338, 493240317,  3229423344, 2585475729, 3112454413, 1881171707, 2555908056,
-            1997546352, 380428329,  3341885423, 3307510279, 3519476676, 3613100811, 2555826262,
-            109341943,  2382715395, 3883409616, 1593551879, 2163678014, 3379783137, 2810374300,
-            1516064864, 561144874,  316017838,  1899237567, 70857401,   3435185465, 4234661323,
-            2580352177, 32879620,   4171670150, 1986234067, 3589478191, 2073132526, 2603712175,
-            377997975,  2474419397, 3110698341, 812664089,  1778922726, 1686111212, 972784138,
-            3936486236, 2711468739, 423435866,  1661961159, 802312780,  1868728136, 1760295704,
-            3357409828, 215039860,  683184627,  4019111064, 3609261689, 2167554309, 1831085281,
-            3389357802, 4193421575, 628277197,  2900207619, 993609502,  3429627083, 2636466084,
-            3652352199, 1780133580, 1670387713, 4086070210, 4004540729, 783029246,  2165667566,
-            1739001057, 377639972,  1102689625, 1945278055, 3941185940, 3685368326, 1881761572,
-            2201338934, 801752,     2729497735, 492844690,  2998826141, 3844964457, 3679088359,
-            2196391660, 4222269404, 357321611,  3727170055, 1819614072, 2348798457, 4294366646,
-            1952884323, 3574345216, 2040734807, 232392443,  4183498179, 2614866055, 112120292,
-            3624018350, 3340709877, 3097507723, 1268833488, 3570501956, 3338260086, 293812421,
-            3683058169, 1147960351, 283731890,  2171233479, 1830154455, 4036602681, 1996981699,
-            132803834,  40256165,   2158110401, 3575159090, 3196553513, 3559872992, 3402884675,
-            1998393432, 2665389278, 3989307699, 3267631636, 3617519767, 3243522970, 1243992413,
-            2200497260, 3821883021, 3715729085, 3451270040, 3044132745, 2101287249, 2340839784,
-            3173635549, 1724350416, 3228881240, 3123386528, 4279362126, 2287520039, 2635534069,
-            3622906431, 206207480,  1894245533, 96723416,   1011223653, 7271757,    2972858087,
-            207942127,  1668335352, 2593296740, 174093751,  3713822176, 4212355586, 49226793,
-            1171716408, 2867257989, 1522213957, 2016192462, 118712412,  2174928148, 1468226225,
-            3938290338, 493240317,  3788174304, 2585475729, 3112454413, 1881171707, 2555908056,
-            3351139844, 380428329,  3341885423, 3307510279, 3519476676, 1368994724, 2555826262,
-            109341943,  2382715395, 3883409616, 1561509458, 2163678014, 3379783137, 2810374300,
-            1516064864, 2313252274, 316017838,  1899237567, 70857401,   3435185465, 2585770746,
-            2580352177, 32879620,   4171670150, 1986234067, 3317983509, 2073132526, 2603712175,
-            377997975,  2474419397, 908728599,  812664089,  1778922726, 1686111212, 972784138,
-            1992540005, 2711468739, 423435866,  1661961159, 802312780,  907108769,  1760295704,
-            3357409828, 215039860,  683184627,  2806826652, 3609261689, 2167554309, 1831085281,
-            3389357802, 2755692689, 628277197,  2900207619, 993609502,  3429627083, 3605915742,
-            3652352199, 1780133580, 1670387713, 4086070210, 3717326627, 783029246,  2165667566,
-            1739001057, 377639972,  2355216626, 1945278055, 3941185940, 3685368326, 1881761572,
-            4024097818, 801752,     2729497735, 492844690,  2998826141, 2719601647, 3679088359,
-            2196391660, 4222269404, 357321611,  1319821972, 1819614072, 2348798457, 4294366646,
-            1952884323, 3573866689, 2040734807, 232392443,  4183498179, 2614866055, 440744432,
-            3624018350, 3340709877, 3097507723, 1268833488, 224895395,  3338260086, 293812421,
-            3683058169, 1147960351, 3433425235, 2171233479, 1830154455, 4036602681, 1996981699,
-            2875889721, 40256165,   2158110401, 3575159090, 3196553513, 1094082574, 3402884675,
-            1998393432, 2665389278, 3989307699, 4068940467, 3617519767, 3243522970, 1243992413,
-            2200497260, 441678457,  3715729085, 3451270040, 3044132745, 2101287249, 2181502237,
-            3173635549, 1724350416, 3228881240, 3123386528, 1968352124, 2287520039, 2635534069,
-            3622906431, 206207480,  2065093599, 96723416,   1011223653, 7271757,    2972858087,
-            1094044749, 1668335352, 2593296740, 174093751,  3713822176, 2887397643, 49226793,
-            1171716408, 2867257989, 1522213957, 984348433,  118712412,  2174928148, 1468226225,
-            3938290338, 2279430036, 3788174304, 2585475729, 3112454413, 1881171707, 4247636500,
-            3351139844, 380428329,  3341885423, 3307510279, 2887754196, 1368994724, 2555826262,
-            109341943,  2382715395, 2836761616, 1561509458, 2163678014, 3379783137, 2810374300,
-            1635278016, 2313252274, 316017838,  1899237567, 70857401,   3481535811, 2585770746,
-            2580352177, 32879620,   4171670150, 2248003250, 3317983509, 2073132526, 2603712175,
-            377997975,  3286162818, 908728599,  812664089,  1778922726, 1686111212, 4024815755,
-            1992540005, 2711468739, 423435866,  1661961159, 2257259057, 907108769,  1760295704,
-            3357409828, 215039860,  3917391198, 2806826652, 3609261689, 2167554309, 1831085281,
-            4238043113, 2755692689, 628277197,  2900207619, 993609502,  2036092353, 3605915742,
-            3652352199, 1780133580, 1670387713, 118446953,  3717326627, 783029246,  2165667566,
-            1739001057, 203160626,  2355216626, 1945278055, 3941185940, 3685368326, 546361979,
-            4024097818, 801752,     2729497735, 492844690,  1023017124, 2719601647, 3679088359,
-            2196391660, 4222269404, 621859651,  1319821972, 1819614072, 2348798457, 4294366646,
-            1114888560, 3573866689, 2040734807, 232392443,  4183498179, 3959504609, 440744432,
-            3624018350, 3340709877, 3097507723, 3613295037, 224895395,  3338260086, 293812421,
-            3683058169, 1655305863, 3433425235, 2171233479, 1830154455, 4036602681, 3731384097,
-            2875889721, 40256165,   2158110401, 3575159090, 1847744924, 1094082574, 3402884675,
-            1998393432, 2665389278, 3781866777, 4068940467, 3617519767, 3243522970, 1243992413,
-            2723708256, 441678457,  3715729085, 3451270040, 3044132745, 4013832842, 2181502237,
-            3173635549, 1724350416, 3228881240, 2092292494, 1968352124, 2287520039, 2635534069,
-            3622906431, 3186333458, 2065093599, 96723416,   1011223653, 7271757,    649658033,
-            1094044749, 1668335352, 2593296740, 174093751,  4159420309, 2887397643, 49226793,
-            1171716408, 2867257989, 2590077953, 984348433,  118712412,  2174928148, 1468226225,
-            1065322711, 2279430036, 3788174304, 2585475729, 3112454413, 3932517386, 4247636500,
-            3351139844, 380428329,  3341885423, 1285273904, 2887754196, 1368994724, 2555826262,
-            109341943,  2318470582, 2836761616, 1561509458, 2163678014, 3379783137, 674658583,
-            1635278016, 2313252274, 316017838,  1899237567, 2192372173, 3481535811, 2585770746,
-            2580352177, 32879620,   300323274,  2248003250, 3317983509, 2073132526, 2603712175,
-            3086543917, 3286162818, 908728599,  812664089,  1778922726, 2263290659, 4024815755,
-            1992540005, 2711468739, 423435866,  819027349,  2257259057, 907108769,  1760295704,
-            3357409828, 1142221093, 3917391198, 2806826652, 3609261689, 2167554309, 4108155875,
-            4238043113, 2755692689, 628277197,  2900207619, 3041719497, 2036092353, 3605915742,
-            3652352199, 1780133580, 2397410862, 118446953,  3717326627, 783029246,  2165667566,
-            2721690354, 203160626,  2355216626, 1945278055, 3941185940, 2768842108, 546361979,
-            4024097818, 801752,     2729497735, 4045063232, 1023017124, 2719601647, 3679088359,
-            2196391660, 2666107451, 621859651,  1319821972, 1819614072, 2348798457, 3555102623,
-            1114888560, 3573866689, 2040734807, 232392443,  3359040541, 3959504609, 440744432,
-            3624018350, 3340709877, 1477919696, 3613295037, 224895395,  3338260086, 293812421,
-            4210187101, 1655305863, 3433425235, 2171233479, 1830154455, 4150241150, 3731384097,
-            2875889721, 40256165,   2158110401, 3350246687, 455561037,  2250400255, 3192153445,
-            3258870230, 1500391873, 4142878334, 1155955691, 1483275844, 4189436981, 323745948,
-            1976017426, 2804626790, 2717553615, 2315409034, 954508235,  3845175920, 3999878682,
-            1247696432, 1743319509, 2998248398, 3694350012, 4072006361, 191306987,  2816321878,
-            1324077734, 1083060006, 3406855480, 1619622379, 2160350,    3302238190, 3368021261,
-            3685228564, 3863934685, 771728612,  854205233,  2304696695, 421449207,  1265752117,
-            3852292419, 305345788,  1540622105, 1904883477, 833469256,  134406680,  3012455058,
-            4035477953, 2925192459, 1559200592, 3851612860, 718484562,  1377960276, 1586892849,
-            1361298269, 3417917896, 1281324499, 1012538763, 1350578667, 3946475598, 2982283954,
-            3548792804, 284542749,  1194648577, 3087899716, 3966595444, 2088330116, 3641652062,
-            327128507,  593906557,  1092448919, 2459189516, 4053392241, 3356198248, 2352376508,
-            470648997,  1017041256, 3234172340, 3928191489, 3266226858, 4219289150, 1229098319,
-            4275351308, 2720777751, 3566728718, 638322822,  2369792461, 2869492261, 3120083828,
-            1890399556, 3309991008, 3785452464, 4128660314, 3726791982, 167177896,  461294981,
-            3988638998, 2937794823, 3981029822, 1111681402, 2015965721, 7261806,    2669786265,
-            1083582734, 3270228881, 3892235938, 2695872715, 4246051290, 3214293333, 343604199,
-            3215604888, 661024127,  2931754053, 3787840039, 2053363765, 363432336,  112334132,
-            2871797223, 138911320,  3981126938, 2027332192, 1804730644, 590150270,  641538574,
-            6802174,    3551446076, 3908480472, 1004531022, 2097228524, 1919074232, 154482247,
-            121437972,  1215661323, 1178068273, 1097220699, 2823681422, 262636065,  2943371149,
-            1768780720, 3866040605, 1855991583, 3988248086, 629223947,  3380612330, 3552916762,
-            197596340,  573801686,  2049230598, 2910471867, 2686314264, 1726228846, 3516983332,
-            726840185,  1241204222, 2237574317, 70568042,   1932610099, 2221862221, 1510378092,
-            4050391637, 4077539568,
-        },
-        {
-            1865421371, 3855220097, 1192662720, 4053603741, 3498982078, 2149980242, 2238335564,
-            3222811776, 4085813132, 4165033841, 4028166647, 1560770711, 1838813654, 752041022,
-            2614535013, 2757001712, 2785653920, 3637983932, 87282193,   605048454,  924961619,
-            2682280948, 326431250,  4211686882, 833160077,  2504545012, 3952610051, 2681478826,
-            3369021896, 3356142984, 146379450,  1024932267, 2636884376, 2061811068, 1376983712,
-            361194627,  272549074,  192241473,  3727208608, 898476530,  2738601511, 3207243585,
-            2665084459, 2389742715, 2744065017, 3033430382, 770192937,  2541418947, 3454872293,
-            1577097398, 4108159492, 4219421026, 856464853,  3298781712, 2178867106, 2266047368,
-            4087648850, 3578908986, 3093601815, 1119634223, 3671095509, 2954169301, 1955466875,
-            3882719379, 2921692178, 3595064912, 803946480,  2134164180, 954279434,  3164638193,
-            2038017360, 2466144217, 3928575704, 3416495827, 602647914,  1223209540, 3199809225,
-            2808513978, 938324237,  3714656121, 1669584133, 3264385618, 902761440,  2043393982,
-            2846878985, 764960801,  1230586586, 486915550,  2410021040, 479648513,  476111955,
-            689036062,  3935398553, 1704467848, 2866523453, 4127270899, 1133622972, 3313003992,
-            2359068269, 3183429806, 1950272482, 1326018344, 1534546084, 1364075990, 1758534252,
-            3550724414, 591432841,  891034220,  1141814591, 3103578968, 4165735674, 2185345476,
-            2725964126, 938622176,  608813725,  888133966,  421620858,  3527977429, 793164895,
-            883970194,  2653160155, 3326119326, 1987333710, 2976200539, 2076107922, 1343977688,
-            4181822334, 2820231422, 4278414361, 264298438,  2870980378, 2166597194, 3610428477,
-            3523751966, 1698946292, 2824081025, 2139002735, 3068885560, 2596947845, 2153608790,
-            974462588,  1250349190, 44615848,   4043603166, 1938159648, 3799630632, 1410487989,
-            136065209,  1088176364, 1642339077, 1958726387, 2073434786, 933771929,  4072054702,
-            455203260,  2759771318, 4065759839, 1046141177, 1755449971, 3931223356, 3752531902,
-            1865421371, 3855220097, 1192662720, 4053603741, 3640601820, 2149980242, 2238335564,
-            3222811776, 4085813132, 3980562548, 4028166647, 1560770711, 1838813654, 752041022,
-            670533937,  2757001712, 2785653920, 3637983932, 87282193,   3980466606, 924961619,
-            2682280948, 326431250,  4211686882, 1663347455, 2504545012, 3952610051, 2681478826,
-            3369021896, 1689947333, 146379450,  1024932267, 2636884376, 2061811068, 112718424,
-            361194627,  272549074,  192241473,  3727208608, 1390957351, 2738601511, 3207243585,
-            2665084459, 2389742715, 4202117803, 3033430382, 770192937,  2541418947, 3454872293,
-            86249357,   4108159492, 4219421026, 856464853,  3298781712, 593053024,  2266047368,
-            4087648850, 3578908986, 3093601815, 289348723,  3671095509, 2954169301, 1955466875,
-            3882719379, 130090401,  3595064912, 803946480,  2134164180, 954279434,  1044443641,
-            2038017360, 2466144217, 3928575704, 3416495827, 2775502362, 1223209540, 3199809225,
-            2808513978, 938324237,  4210502235, 1669584133, 3264385618, 902761440,  2043393982,
-            3774048985, 764960801,  1230586586, 486915550,  2410021040, 1750392854, 476111955,
-            689036062,  3935398553, 1704467848, 2330012865, 4127270899, 1133622972, 3313003992,
-            2359068269, 472110226,  1950272482, 1326018344, 1534546084, 1364075990, 1986793636,
-            3550724414, 591432841,  891034220,  1141814591, 3814713993, 4165735674, 2185345476,
-            2725964126, 938622176,  1218699484, 888133966,  421620858,  3527977429, 793164895,
-            1554821561, 2653160155, 3326119326, 1987333710, 2976200539, 3431929083, 1343977688,
-            4181822334, 2820231422, 4278414361, 1755297453, 2870980378, 2166597194, 3610428477,
-            3523751966, 3175178411, 2824081025, 2139002735, 3068885560, 2596947845, 1801779549,
-            974462588,  1250349190, 44615848,   4043603166, 478782854,  3799630632, 1410487989,
-            136065209,  1088176364, 1418229287, 1958726387, 2073434786, 933771929,  4072054702,
-            3404885230, 2759771318, 4065759839, 1046141177, 1755449971, 2612191836, 3752531902,
-            1865421371, 3855220097, 1192662720, 348197893,  3640601820, 2149980242, 2238335564,
-            3222811776, 2689253279, 3980562548, 4028166647, 1560770711, 1838813654, 4082879926,
-            670533937,  2757001712, 2785653920, 3637983932, 2437009856, 3980466606, 924961619,
-            2682280948, 326431250,  3035929138, 1663347455, 2504545012, 3952610051, 2681478826,
-            378491109,  1689947333, 146379450,  1024932267, 2636884376, 3891892774, 112718424,
-            361194627,  272549074,  192241473,  1166960170, 1390957351, 2738601511, 3207243585,
-            2665084459, 3504326850, 4202117803, 3033430382, 770192937,  2541418947, 1460350268,
-            86249357,   4108159492, 4219421026, 856464853,  3756014281, 593053024,  2266047368,
-            4087648850, 3578908986, 2456229280, 289348723,  3671095509, 2954169301, 1955466875,
-            3164643165, 130090401,  3595064912, 803946480,  2134164180, 2885151028, 1044443641,
-            2038017360, 2466144217, 3928575704, 1311494491, 2775502362, 1223209540, 3199809225,
-            2808513978, 210763357,  4210502235, 1669584133, 3264385618, 902761440,  4263520968,
-            3774048985, 764960801,  1230586586, 486915550,  456893132,  1750392854, 476111955,
-            689036062,  3935398553, 3303532566, 2330012865, 4127270899, 1133622972, 3313003992,
-            3125813874, 472110226,  1950272482, 1326018344, 1534546084, 432100244,  1986793636,
-            3550724414, 591432841,  891034220,  3195889245, 3814713993, 4165735674, 2185345476,
-            2725964126, 1599473208, 1218699484, 888133966,  421620858,  3527977429, 3004128323,
-            1554821561, 2653160155, 3326119326, 1987333710, 2543685019, 3431929083, 1343977688,
-            4181822334, 2820231422, 616750014,  1755297453, 2870980378, 2166597194, 3610428477,
-            851625180,  3175178411, 2824081025, 2139002735, 3068885560, 2481354685, 1801779549,
-            974462588,  1250349190, 44615848,   1409190825, 478782854,  3799630632, 1410487989,
-            136065209,  3146828260, 1418229287, 1958726387, 2073434786, 933771929,  3197538503,
-            3404885230, 2759771318, 4065759839, 1046141177, 1157598630, 2612191836, 3752531902,
-            1865421371, 3855220097, 3238934533, 348197893,  3640601820, 2149980242, 2238335564,
-            1283961638, 2689253279, 3980562548, 4028166647, 1560770711, 3304871535, 4082879926,
-            670533937,  2757001712, 2785653920, 664115074,  2437009856, 3980466606, 924961619,
-            2682280948, 2622520428, 3035929138, 1663347455, 2504545012, 3952610051, 647863809,
-            378491109,  1689947333, 146379450,  1024932267, 3323700414, 3891892774, 112718424,
-            361194627,  272549074,  2486783762, 1166960170, 1390957351, 2738601511, 3207243585,
-            3847827218, 3504326850, 4202117803, 3033430382, 770192937,  570569892,  1460350268,
-            86249357,   4108159492, 4219421026, 166713290,  3756014281, 593053024,  2266047368,
-            4087648850, 1459141085, 2456229280, 289348723,  3671095509, 2954169301, 2065485135,
-            3164643165, 130090401,  3595064912, 803946480,  1032658086, 2885151028, 1044443641,
-            2038017360, 2466144217, 1102029355, 1311494491, 2775502362, 1223209540, 3199809225,
-            1567651341, 210763357,  4210502235, 1669584133, 3264385618, 2567323162, 4263520968,
-            3774048985, 764960801,  1230586586, 4073036209, 456893132,  1750392854, 476111955,
-            689036062,  2004015589, 3303532566, 2330012865, 4127270899, 1133622972, 2205796688,
-            3125813874, 472110226,  1950272482, 1326018344, 3572513558, 432100244,  1986793636,
-            3550724414, 591432841,  3487970872, 3195889245, 3814713993, 4165735674, 2185345476,
-            964113070,  1599473208, 1218699484, 888133966,  421620858,  2524343616, 3004128323,
-            1554821561, 2653160155, 3326119326, 2589293184, 2543685019, 3431929083, 1343977688,
-            4181822334, 807315547,  616750014,  1755297453, 2870980378, 2166597194, 297453390,
-            851625180,  3175178411, 2824081025, 2139002735, 2150787741, 2481354685, 1801779549,
-            974462588,  1250349190, 3313972880, 1409190825, 478782854,  3799630632, 1410487989,
-            2399710558, 3146828260, 1418229287, 1958726387, 2073434786, 2256785768, 3197538503,
-            3404885230, 2759771318, 4065759839, 1959168682, 3220259217, 788515126,  4132174225,
-            3505848280, 2433709867, 4175943505, 3747798187, 650494767,  2510247257, 342179175,
-            956294097,  753554215,  3733232734, 163274738,  2896935025, 309552327,  4054088324,
-            2514224517, 1045247704, 2412267165, 180120315,  119482137,  1233982578, 1354725377,
-            2833684607, 860102655,  559428440,  863800868,  55238911,   1612541328, 3026128745,
-            523001613,  656880219,  4113961461, 2049215193, 277664757,  1133508144, 264614573,
-            3394839447, 2732702692, 2632096802, 2748525253, 773039904,  1616454314, 133364716,
-            2800268949, 1895831427, 2776513583, 1482114643, 4074765560, 3187409025, 1555161491,
-            3668488468, 3864559079, 2897477010, 3036329955, 1258141381, 3491493305, 408552723,
-            2855954644, 2059391181, 3743997634, 3983621037, 609415878,  1145266795, 121072084,
-            772346119,  1239876370, 2727255072, 1830930653, 3058093102, 2201837322, 3358410487,
-            3426786136, 296132027,  568802287,  3116303900, 1330696994, 4272276600, 2256339396,
-            938482607,  593951004,  334737854,  1961308310, 946390768,  2510219150, 1613698996,
-            1025624418, 4176884451, 3874101333, 2660006416, 1968236548, 2098491647, 3427607911,
-            1911424127, 3597921448, 1400970020, 4179469598, 1790197302, 3976031334, 404298990,
-            3395445497, 77026349,   1690786285, 888151908,  194108146,  3187520527, 3897531296,
-            2628613438, 2326002676, 4041683160, 1611692269, 2906239435, 2352099246, 3505336626,
-            1091903386, 545100539,  1705557211, 1584192124, 2006825432, 1747672165, 3537297990,
-            342804002,  2067441785, 3952213632, 2947366249, 601767691,  2806067104, 2747528878,
-            3047357716, 780807784,  779494319,  3645344415, 3112062015, 2827820038, 1044286297,
-            225890044,  254525417,  3532770360, 2311096573, 166912608,  2585040349, 4050676864,
-            3412423420, 3731470697, 468619257,  1209009232, 1419354582, 3068158718, 2872474407,
-            608097913,  2678988701, 3408292282, 3214517065, 2265534481, 25854329,   3206287806,
-            1978563920, 3515922918,
-        },
-        {
-            3872117793, 803220151,  70843412,   1661103032, 1976811457, 2186373604, 564259972,
-            1475436923, 2260980893, 4245534505, 1075107552, 3692990573, 370098873,  4045905424,
-            2420395420, 2332395402, 207483321,  622317750,  3004242500, 833623111,  3151161301,
-            1629139881, 352228793,  2439953368, 3183333619, 2703537080, 3218957129, 3164695888,
-            1741641842, 963394141,  4241612717, 1034476784, 2035880432, 3977821313, 1543311495,
-            3010014356, 1638490901, 2364265378, 3420329129, 333361555,  1133565821, 1450937015,
-            616059115,  3216393887, 3041978455, 3990855695, 1238628750, 512746184,  3256670217,
-            1616316512, 2791405051, 93474487,   2865892488, 1901471398, 2930857966, 2178431077,
-            2325598341, 3189256113, 1302432091, 808592927,  2945846737, 3487931071, 2018175258,
-            752981057,  1097082589, 1307115286, 175147508,  3611190164, 850238914,  3318706185,
-            199743319,  328621708,  3183670050, 3609998315, 4075306371, 3554549067, 2119566187,
-            1498503842, 1261870696, 2216745780, 950288337,  1117344941, 2150569143, 2899286760,
-            1594966374, 888858617,  35840654,   2829539211, 2511395669, 3607190544, 3278412778,
-            2249895907, 1320858068, 3576889788, 266766189,  1522426851, 1903494122, 1928370573,
-            2628132591, 3322025904, 220280169,  433606853,  1428961479, 986074592,  2128892987,
-            467697583,  1616913929, 325674890,  444442578,  649166208,  1689709565, 1493452467,
-            2222122038, 121114616,  2134348225, 3512035688, 1283058921, 4230441398, 3701238559,
-            337534132,  1418548715, 1190006478, 500654385,  1766924757, 1944680746, 940574010,
-            922744002,  186142284,  3131162902, 1693891092, 3031823448, 2143051534, 1429025284,
-            1487843160, 3606456133, 2079235652, 2447285474, 2669283767, 3232117829, 2490054343,
-            3225501736, 2911340385, 382319031,  1516937595, 622543191,  1388990570, 1749179860,
-            1924483707, 2593474505, 472539197,  122872799,  2586347240, 880588515,  4046335279,
-            1712182607, 4270737941, 1336703451, 3390078162, 382216945,  3733326081, 460422073,
-            3872117793, 803220151,  70843412,   1661103032, 250339760,  2186373604, 564259972,
-            1475436923, 2260980893, 657986735,  1075107552, 3692990573, 370098873,  4045905424,
-            3201950123, 2332395402, 207483321,  622317750,  3004242500, 3732213278, 3151161301,
-            1629139881, 352228793,  2439953368, 3572618926, 2703537080, 3218957129, 3164695888,
-            1741641842, 685933373,  4241612717, 1034476784, 2035880432, 3977821313, 3855995181,
-            3010014356, 1638490901, 2364265378, 3420329129, 2355603679, 1133565821, 1450937015,
-            616059115,  3216393887, 1733804102, 3990855695, 1238628750, 512746184,  3256670217,
-            2651059231, 2791405051, 93474487,   2865892488, 1901471398, 2113461797, 2178431077,
-            2325598341, 3189256113, 1302432091, 2986990416, 2945846737, 3487931071, 2018175258,
-            752981057,  2428033310, 1307115286, 175147508,  3611190164, 850238914,  1033628405,
-            199743319,  328621708,  3183670050, 3609998315, 4024297327, 3554549067, 2119566187,
-            1498503842, 1261870696, 290361143,  950288337,  1117344941, 2150569143, 2899286760,
-            168826051,  888858617,  35840654,   2829539211, 2511395669, 2890882060, 3278412778,
-            2249895907, 1320858068, 3576889788, 1794920145, 1522426851, 1903494122, 1928370573,
-            2628132591, 1251697758, 220280169,  433606853,  1428961479, 986074592,  2707115661,
-            467697583,  1616913929, 325674890,  444442578,  122781510,  1689709565, 1493452467,
-            2222122038, 121114616,  3425723636, 3512035688, 1283058921, 4230441398, 3701238559,
-            1646155473, 1418548715, 1190006478, 500654385,  1766924757, 3920475367, 940574010,
-            922744002,  186142284,  3131162902, 54639113,   3031823448, 2143051534, 1429025284,
-            1487843160, 4152687885, 2079235652, 2447285474, 2669283767, 3232117829, 1601035152,
-            3225501736, 2911340385, 382319031,  1516937595, 3508441679, 1388990570, 1749179860,
-            1924483707, 2593474505, 2835403456, 122872799,  2586347240, 880588515,  4046335279,
-            2958058367, 4270737941, 1336703451, 3390078162, 382216945,  450517882,  460422073,
-            3872117793, 803220151,  70843412,   2066343874, 250339760,  2186373604, 564259972,
-            1475436923, 1683787449, 657986735,  1075107552, 3692990573, 370098873,  2615082840,
-            3201950123, 2332395402, 207483321,  622317750,  2655424371, 3732213278, 3151161301,
-            1629139881, 352228793,  3236724760, 3572618926, 2703537080, 3218957129, 3164695888,
-            9775065,    685933373,  4241612717, 1034476784, 2035880432, 1621920075, 3855995181,
-            3010014356, 1638490901, 2364265378, 1509475888, 2355603679, 1133565821, 1450937015,
-            616059115,  3666188236, 1733804102, 3990855695, 1238628750, 512746184,  3900473826,
-            2651059231, 2791405051, 93474487,   2865892488, 222759186,  2113461797, 2178431077,
-            2325598341, 3189256113, 2505499508, 2986990416, 2945846737, 3487931071, 2018175258,
-            2766733928, 2428033310, 1307115286, 175147508,  3611190164, 1909211603, 1033628405,
-            199743319,  328621708,  3183670050, 1680331218, 4024297327, 3554549067, 2119566187,
-            1498503842, 3516256046, 290361143,  950288337,  1117344941, 2150569143, 3182619063,
-            168826051,  888858617,  35840654,   2829539211, 645798943,  2890882060, 3278412778,
-            2249895907, 1320858068, 1436708568, 1794920145, 1522426851, 1903494122, 1928370573,
-            3693049252, 1251697758, 220280169,  433606853,  1428961479, 3724415861, 2707115661,
-            467697583,  1616913929, 325674890,  1448052253, 122781510,  1689709565, 1493452467,
-            2222122038, 2177448198, 3425723636, 3512035688, 1283058921, 4230441398, 3050940272,
-            1646155473, 1418548715, 1190006478, 500654385,  1106232,    3920475367, 940574010,
-            922744002,  186142284,  4144806511, 54639113,   3031823448, 2143051534, 1429025284,
-            2067453848, 4152687885, 2079235652, 2447285474, 2669283767, 428527087,  1601035152,
-            3225501736, 2911340385, 382319031,  2565464472, 3508441679, 1388990570, 1749179860,
-            1924483707, 1737735237, 2835403456, 122872799,  2586347240, 880588515,  597822462,
-            2958058367, 4270737941, 1336703451, 3390078162, 2532634475, 450517882,  460422073,
-            3872117793, 803220151,  801648827,  2066343874, 250339760,  2186373604, 564259972,
-            3417948976, 1683787449, 657986735,  1075107552, 3692990573, 2235306692, 2615082840,
-            3201950123, 2332395402, 207483321,  699310933,  2655424371, 3732213278, 3151161301,
-            1629139881, 1152704006, 3236724760, 3572618926, 2703537080, 3218957129, 2726926336,
-            9775065,    685933373,  4241612717, 1034476784, 2398119652, 1621920075, 3855995181,
-            3010014356, 1638490901, 252854480,  1509475888, 2355603679, 1133565821, 1450937015,
-            2655911639, 3666188236, 1733804102, 3990855695, 1238628750, 1115900497, 3900473826,
-            2651059231, 2791405051, 93474487,   1862985957, 222759186,  2113461797, 2178431077,
-            2325598341, 4179075132, 2505499508, 2986990416, 2945846737, 3487931071, 564667776,
-            2766733928, 2428033310, 1307115286, 175147508,  1759077815, 1909211603, 1033628405,
-            199743319,  328621708,  2552816198, 1680331218, 4024297327, 3554549067, 2119566187,
-            2267805778, 3516256046, 290361143,  950288337,  1117344941, 2897506172, 3182619063,
-            168826051,  888858617,  35840654,   2035476068, 645798943,  2890882060, 3278412778,
-            2249895907, 3278449102, 1436708568, 1794920145, 1522426851, 1903494122, 1500763736,
-            3693049252, 1251697758, 220280169,  433606853,  3914497854, 3724415861, 2707115661,
-            467697583,  1616913929, 918435305,  1448052253, 122781510,  1689709565, 1493452467,
-            609575172,  2177448198, 3425723636, 3512035688, 1283058921, 3661181550, 3050940272,
-            1646155473, 1418548715, 1190006478, 1047301661, 1106232,    3920475367, 940574010,
-            922744002,  2510633517, 4144806511, 54639113,   3031823448, 2143051534, 3242814908,
-            2067453848, 4152687885, 2079235652, 2447285474, 736638210,  428527087,  1601035152,
-            3225501736, 2911340385, 1849570436, 2565464472, 3508441679, 1388990570, 1749179860,
-            84517579,   1737735237, 2835403456, 122872799,  2586347240, 4002124614, 597822462,
-            2958058367, 4270737941, 1336703451, 3078170472, 1186434751, 700631413,  1497890797,
-            1195347450, 2560167391, 1116697259, 1254138573, 747913260,  240954704,  3107512667,
-            360584144,  3422778960, 3516528389, 3301260366, 1254513537, 122269053,  1579582456,
-            873334104,  3918835024, 1731872444, 1974410416, 1811172641, 4172523062, 4092675777,
-            4124987343, 1936078756, 1757348689, 2694415512, 128641660,  1744777659, 3173116729,
-            983733754,  1430789547, 701906842,  3367232568, 3266433501, 3572590347, 1453272962,
-            2106553114, 993786201,  2149441250, 1295181065, 2962229026, 3709052556, 3255608941,
-            3677730029, 483873127,  102227292,  2626265293, 2018984578, 2266388762, 1191709548,
-            2152725916, 583672623,  2230473473, 1995194269, 1740347812, 2558095372, 3070195183,
-            3023333227, 2497183195, 1908755188, 773027539,  3646876518, 2272586839, 493318726,
-            2107067517, 2000805278, 2530829636, 3183628745, 677565332,  1497629423, 82094920,
-            2214054433, 2635367545, 470855467,  2184853389, 2942188934, 188335670,  3656661644,
-            1883526235, 3990873975, 1490784356, 4047548172, 3149642641, 3289988179, 2590918909,
-            2893039564, 2350687346, 4252624874, 15372456,   1614496594, 2364847678, 2604511825,
-            422365460,  4195174772, 3266964836, 2008671995, 54038434,   781948549,  1276017666,
-            2756376612, 2436825273, 1711863836, 3541493950, 3821378841, 1007557618, 345375815,
-            2081905201, 2227278118, 1185927141, 1082173792, 3567361925, 1940465859, 541632942,
-            1830210248, 3757851982, 775883450,  1666577465, 1004944607, 878440834,  2146344131,
-            4195798476, 370164841,  3649112729, 37066142,   2311278904, 1935745497, 2304799402,
-            4107299626, 1348526232, 2473609635, 3284032699, 2374292786, 1762329186, 857978496,
-            1039346432, 2621413355, 29961014,   3582263091, 4268542513, 3890612190, 3096173646,
-            2026544230, 3856142618, 2347115934, 319800326,  3255916105, 2430273059, 823505311,
-            874255188,  1401925393, 4203707857, 4259159566, 2606881118, 1978288664, 1447576038,
-            3860341401, 412510348,
-        },
-        {
-            1055408858, 2242191468, 3951867727, 2021898793, 3867124911, 1825785041, 1563129912,
-            2277044630, 3455188514, 3413690575, 3438723540, 2892828728, 1868808836, 4273620662,
-            1838982869, 3721924640, 328367656,  2300853974, 1492938905, 3650692707, 805657283,
-            1473918273, 483589279,  1236248813, 3990140981, 1921457806, 2448718771, 2040016348,
-            3971501876, 2640337270, 1874555762, 1654325741, 1286588662, 3868828996, 2592221260,
-            3583247731, 987993830,  2993481681, 668508543,  3952645550, 1801710364, 2941866314,
-            640471465,  3852954380, 3404399228, 3601890973, 3243267466, 3825872716, 523646370,
-            2492455688, 1151747465, 1653266989, 2605730992, 2837888732, 3429975678, 2845863475,
-            1006986440, 2079243229, 755578405,  995218690,  1060887138, 2787471088, 2421743998,
-            1449236507, 998372909,  1294281917, 2645848962, 3861962775, 1937472748, 1094239925,
-            3319089388, 1040252094, 3680420610, 3113605235, 1766958310, 2089542908, 1397793536,
-            2495353475, 3898900148, 902316452,  1384146911, 1208206938, 4267314589, 2096283803,
-            1981336251, 2235191311, 2475153997, 1579669109, 2552131472, 4015199206, 676294329,
-            3828408998, 956109521,  364068845,  1136278486, 3317917299, 558513482,  2526639875,
-            2241803775, 1585765239, 224180995,  2688256685, 4230341701, 330820321,  3305681416,
-            1231342797, 2050030233, 1368690223, 2460154410, 2597507041, 2819048825, 1409694980,
-            2351535298, 538444167,  1735417155, 2028903233, 323791444,  1245161039, 2117860786,
-            2423493767, 2110528363, 395728066,  4068325655, 3854177242, 3944997313, 4124842716,
-            2934242448, 1107452751, 254609724,  1771481814, 3428890864, 3228564077, 1679718460,
-            4002875183, 1709162927, 172850006,  3655878022, 4113521879, 849665772,  1208420189,
-            3114209397, 81839451,   2811603877, 1865812827, 1292297548, 4181903312, 3554617247,
-            2167049971, 501688783,  4228492251, 161048509,  3331354774, 1192444475, 3396872469,
-            306734005,  1908656574, 2751628983, 1827946450, 2451966689, 326947418,  238101309,
-            1055408858, 2242191468, 3951867727, 2021898793, 1599826377, 1825785041, 1563129912,
-            2277044630, 3455188514, 543661739,  3438723540, 2892828728, 1868808836, 4273620662,
-            78811512,   3721924640, 328367656,  2300853974, 1492938905, 3711144351, 805657283,
-            1473918273, 483589279,  1236248813, 3090867608, 1921457806, 2448718771, 2040016348,
-            3971501876, 257279647,  1874555762, 1654325741, 1286588662, 3868828996, 3210838348,
-            3583247731, 987993830,  2993481681, 668508543,  3913785535, 1801710364, 2941866314,
-            640471465,  3852954380, 543036935,  3601890973, 3243267466, 3825872716, 523646370,
-            2394596786, 1151747465, 1653266989, 2605730992, 2837888732, 2606838747, 2845863475,
-            1006986440, 2079243229, 755578405,  3417906685, 1060887138, 2787471088, 2421743998,
-            1449236507, 3480233273, 1294281917, 2645848962, 3861962775, 1937472748, 905305814,
-            3319089388, 1040252094, 3680420610, 3113605235, 4098598250, 2089542908, 1397793536,
-            2495353475, 3898900148, 1459442794, 1384146911, 1208206938, 4267314589, 2096283803,
-            2384383767, 2235191311, 2475153997, 1579669109, 2552131472, 3376920651, 676294329,
-            3828408998, 956109521,  364068845,  1739925130, 3317917299, 558513482,  2526639875,
-            2241803775, 2244756204, 224180995,  2688256685, 4230341701, 330820321,  406558494,
-            1231342797, 2050030233, 1368690223, 2460154410, 4246720399, 2819048825, 1409694980,
-            2351535298, 538444167,  3373744534, 2028903233, 323791444,  1245161039, 2117860786,
-            4041191134, 2110528363, 395728066,  4068325655, 3854177242, 2776160647, 4124842716,
-            2934242448, 1107452751, 254609724,  3891051754, 3428890864, 3228564077, 1679718460,
-            4002875183, 4084933670, 172850006,  3655878022, 4113521879, 849665772,  1500156443,
-            3114209397, 81839451,   2811603877, 1865812827, 289055461,  4181903312, 3554617247,
-            2167049971, 501688783,  4007157482, 161048509,  3331354774, 1192444475, 3396872469,
-            2125997236, 1908656574, 2751628983, 1827946450, 2451966689, 519892072,  238101309,
-            1055408858, 2242191468, 3951867727, 365848666,  1599826377, 1825785041, 1563129912,
-            2277044630, 679708018,  543661739,  3438723540, 2892828728, 1868808836, 4274474372,
-            78811512,   3721924640, 328367656,  2300853974, 2688420146, 3711144351, 805657283,
-            1473918273, 483589279,  86721567,   3090867608, 1921457806, 2448718771, 2040016348,
-            720915725,  257279647,  1874555762, 1654325741, 1286588662, 3196789026, 3210838348,
-            3583247731, 987993830,  2993481681, 2130892099, 3913785535, 1801710364, 2941866314,
-            640471465,  3097682615, 543036935,  3601890973, 3243267466, 3825872716, 1680337967,
-            2394596786, 1151747465, 1653266989, 2605730992, 1253042869, 2606838747, 2845863475,
-            1006986440, 2079243229, 1416723286, 3417906685, 1060887138, 2787471088, 2421743998,
-            1117391156, 3480233273, 1294281917, 2645848962, 3861962775, 2536034905, 905305814,
-            3319089388, 1040252094, 3680420610, 3690310043, 4098598250, 2089542908, 1397793536,
-            2495353475, 3825625538, 1459442794, 1384146911, 1208206938, 4267314589, 3595975491,
-            2384383767, 2235191311, 2475153997, 1579669109, 2114505936, 3376920651, 676294329,
-            3828408998, 956109521,  3980339119, 1739925130, 3317917299, 558513482,  2526639875,
-            475018383,  2244756204, 224180995,  2688256685, 4230341701, 2458413123, 406558494,
-            1231342797, 2050030233, 1368690223, 3805506601, 4246720399, 2819048825, 1409694980,
-            2351535298, 2753879452, 3373744534, 2028903233, 323791444,  1245161039, 358407900,
-            4041191134, 2110528363, 395728066,  4068325655, 3824774657, 2776160647, 4124842716,
-            2934242448, 1107452751, 2659486145, 3891051754, 3428890864, 3228564077, 1679718460,
-            2780496948, 4084933670, 172850006,  3655878022, 4113521879, 1941528093, 1500156443,
-            3114209397, 81839451,   2811603877, 1652804271, 289055461,  4181903312, 3554617247,
-            2167049971, 2309116765, 4007157482, 161048509,  3331354774, 1192444475, 368291009,
-            2125997236, 1908656574, 2751628983, 1827946450, 3666580948, 519892072,  238101309,
-            1055408858, 2242191468, 3400533986, 365848666,  1599826377, 1825785041, 1563129912,
-            3480155119, 679708018,  543661739,  3438723540, 2892828728, 2126557832, 4274474372,
-            78811512,   3721924640, 328367656,  3679162525, 2688420146, 3711144351, 805657283,
-            1473918273, 2394179950, 86721567,   3090867608, 1921457806, 2448718771, 33777822,
-            720915725,  257279647,  1874555762, 1654325741, 457351771,  3196789026, 3210838348,
-            3583247731, 987993830,  595564116,  2130892099, 3913785535, 1801710364, 2941866314,
-            359576194,  3097682615, 543036935,  3601890973, 3243267466, 2512228297, 1680337967,
-            2394596786, 1151747465, 1653266989, 1685504316, 1253042869, 2606838747, 2845863475,
-            1006986440, 4028530786, 1416723286, 3417906685, 1060887138, 2787471088, 2141947715,
-            1117391156, 3480233273, 1294281917, 2645848962, 62951365,   2536034905, 905305814,
-            3319089388, 1040252094, 2367378942, 3690310043, 4098598250, 2089542908, 1397793536,
-            399954353,  3825625538, 1459442794, 1384146911, 1208206938, 2406435552, 3595975491,
-            2384383767, 2235191311, 2475153997, 2721200142, 2114505936, 3376920651, 676294329,
-            3828408998, 2990566956, 3980339119, 1739925130, 3317917299, 558513482,  998440159,
-            475018383,  2244756204, 224180995,  2688256685, 1618514135, 2458413123, 406558494,
-            1231342797, 2050030233, 1828358658, 3805506601, 4246720399, 2819048825, 1409694980,
-            792769953,  2753879452, 3373744534, 2028903233, 323791444,  2740053737, 358407900,
-            4041191134, 2110528363, 395728066,  31519172,   3824774657, 2776160647, 4124842716,
-            2934242448, 2999458508, 2659486145, 3891051754, 3428890864, 3228564077, 1922629414,
-            2780496948, 4084933670, 172850006,  3655878022, 1232440264, 1941528093, 1500156443,
-            3114209397, 81839451,   782800186,  1652804271, 289055461,  4181903312, 3554617247,
-            1255140809, 2309116765, 4007157482, 161048509,  3331354774, 2895233430, 368291009,
-            2125997236, 1908656574, 2751628983, 763173174,  1702165444, 4173008954, 2826376466,
-            2330837612, 2832742746, 2398637195, 2151197203, 1309192637, 1486805639, 4126359906,
-            155237661,  1305039921, 2238740850, 3158450327, 3694883126, 2377107670, 3421546670,
-            244546312,  3661259034, 2458023718, 2201159574, 1593648661, 477271460,  1092609825,
-            3968889395, 453938882,  2439737959, 2051354603, 1408534876, 870125456,  1812622430,
-            3906909160, 4123301937, 836741638,  794037096,  3096980988, 3251716830, 158403122,
-            2372573189, 3405439021, 2112891057, 2679906862, 1835542598, 2621667424, 2032842143,
-            2404300986, 1393866772, 1530312761, 3596639666, 1574177616, 2922156731, 307227974,
-            2879406405, 1042248977, 2358150351, 3351399936, 2009188768, 1368364868, 2177436768,
-            2490719944, 2639192028, 462662359,  2588457786, 1671577376, 3809132455, 1694032409,
-            679220778,  1541839638, 250980258,  1715803682, 3628372946, 928319921,  3508105693,
-            1553895857, 792333299,  4205604117, 3174001983, 2045179159, 3496135884, 4179951990,
-            3534491229, 1247939600, 3335609976, 1337886590, 4166638333, 236911879,  3169495045,
-            406196233,  515258736,  3183544885, 2017019962, 3552159418, 1213376640, 2006258512,
-            1485648664, 2625022385, 813841730,  3574586663, 945943761,  1012915866, 2093509519,
-            3662546434, 3689922265, 4200559303, 2032692506, 1688366657, 717387547,  2210036086,
-            842316171,  1741322753, 3582468688, 1387050609, 394843497,  716312174,  1992029317,
-            1103868764, 2184759023, 682446725,  1957163064, 2064992714, 3134609666, 2221799991,
-            753694493,  1343544729, 2113049484, 3706220825, 2973997427, 4176088112, 4041078989,
-            3736654419, 1710749704, 3090918551, 2503843454, 2104489575, 405860984,  1742186543,
-            1669515516, 618931452,  3826037560, 1653798433, 736591337,  1482564596, 20230639,
-            3098255770, 2700743505, 2387773035, 3973139652, 4260097569, 78195185,   159854743,
-            1128848734, 3404369411, 607310057,  766228308,  226469233,  2716755175, 3021850662,
-            3399871634, 3144033580,
-        },
-        {
-            4052471963, 683640040,  3043876021, 3466644483, 4222418025, 3035140128, 1466027937,
-            18198088,   3410320851, 3040963721, 488404231,  3157371815, 769336092,  3240417718,
-            808582581,  2075839263, 835026995,  3123726486, 3284240985, 1898453053, 3606056482,
-            512836002,  2715428547, 4182302879, 1644882480, 3160187826, 390292489,  980889545,
-            2776206633, 2482799995, 617042280,  3501667414, 689451808,  497018701,  238525753,
-            3890163301, 896679896,  1544533015, 3412477225, 3116575138, 4250402651, 3990990746,
-            819056741,  1459334146, 158377590,  3444755752, 8230450,    1378706455, 684191332,
-            3217423797, 2842520097, 1631477948, 2591254230, 959644473,  1020694107, 1748401915,
-            3452514983, 3892766171, 1227786994, 2086180800, 2394613217, 2091953150, 870094953,
-            2306851481, 571550601,  488878212,  873197214,  2630100528, 2067476907, 2162307009,
-            2026119728, 115875280,  2905867426, 248774881,  3110900450, 2236032812, 1888510348,
-            708001855,  996960491,  3514196956, 1407967546, 1826568876, 3659618284, 2614104317,
-            2230066308, 1055135881, 2537437343, 1858044413, 2608594891, 2750681169, 3241939420,
-            3966440877, 2375002886, 2417753441, 1405878685, 1081133199, 1496940727, 382467042,
-            2745477587, 1209424459, 811187075,  1385604734, 2623887355, 3443875720, 394141555,
-            4142998949, 4195414618, 1489846841, 2253433808, 1171450286, 84131191,   4387588,
-            2641405140, 3525405389, 3273000909, 423660319,  2366546732, 3698878607, 2161119729,
-            4263629085, 3029102089, 2692507376, 3266869596, 1658012061, 1960169440, 1002311379,
-            3724446882, 2004188516, 999513506,  2200093802, 4141037460, 351865836,  412875013,
-            1535823315, 3880657632, 3109944987, 3207577548, 3462087941, 584875517,  2635241084,
-            3834145971, 1693380373, 3524443732, 934775214,  1960588847, 2226778032, 1044609478,
-            12199016,   1120582000, 226430296,  665553142,  2570993348, 1685535237, 3325420136,
-            3925248326, 2855346376, 1205558328, 808835317,  3295908896, 4170076136, 2438272365,
-            4052471963, 683640040,  3043876021, 3466644483, 1385549869, 3035140128, 1466027937,
-            18198088,   3410320851, 2171386836, 488404231,  3157371815, 769336092,  3240417718,
-            2921774554, 2075839263, 835026995,  3123726486, 3284240985, 72352110,   3606056482,
-            512836002,  2715428547, 4182302879, 3869483469, 3160187826, 390292489,  980889545,
-            2776206633, 1385691983, 617042280,  3501667414, 689451808,  497018701,  2600411809,
-            3890163301, 896679896,  1544533015, 3412477225, 356556378,  4250402651, 3990990746,
-            819056741,  1459334146, 199003993,  3444755752, 8230450,    1378706455, 684191332,
-            1750733272, 2842520097, 1631477948, 2591254230, 959644473,  2113375576, 1748401915,
-            3452514983, 3892766171, 1227786994, 275473920,  2394613217, 2091953150, 870094953,
-            2306851481, 897057645,  488878212,  873197214,  2630100528, 2067476907, 944114068,
-            2026119728, 115875280,  2905867426, 248774881,  989201307,  2236032812, 1888510348,
-            708001855,  996960491,  2121706374, 1407967546, 1826568876, 3659618284, 2614104317,
-            2931815032, 1055135881, 2537437343, 1858044413, 2608594891, 1423973935, 3241939420,
-            3966440877, 2375002886, 2417753441, 2514473440, 1081133199, 1496940727, 382467042,
-            2745477587, 81977310,   811187075,  1385604734, 2623887355, 3443875720, 2100629879,
-            4142998949, 4195414618, 1489846841, 2253433808, 337182869,  84131191,   4387588,
-            2641405140, 3525405389, 661876463,  423660319,  2366546732, 3698878607, 2161119729,
-            309510684,  3029102089, 2692507376, 3266869596, 1658012061, 11119541,   1002311379,
-            3724446882, 2004188516, 999513506,  3486722046, 4141037460, 351865836,  412875013,
-            1535823315, 2818130700, 3109944987, 3207577548, 3462087941, 584875517,  322875622,
-            3834145971, 1693380373, 3524443732, 934775214,  3879414752, 2226778032, 1044609478,
-            12199016,   1120582000, 4207259464, 665553142,  2570993348, 1685535237, 3325420136,
-            553869152,  2855346376, 1205558328, 808835317,  3295908896, 470585896,  2438272365,
-            4052471963, 683640040,  3043876021, 1588419572, 1385549869, 3035140128, 1466027937,
-            18198088,   363815288,  2171386836, 488404231,  3157371815, 769336092,  2464768302,
-            2921774554, 2075839263, 835026995,  3123726486, 4229246330, 72352110,   3606056482,
-            512836002,  2715428547, 319830805,  3869483469, 3160187826, 390292489,  980889545,
-            2966401462, 1385691983, 617042280,  3501667414, 689451808,  4047377762, 2600411809,
-            3890163301, 896679896,  1544533015, 764316452,  356556378,  4250402651, 3990990746,
-            819056741,  965331966,  199003993,  3444755752, 8230450,    1378706455, 51902971,
-            1750733272, 2842520097, 1631477948, 2591254230, 426039404,  2113375576, 1748401915,
-            3452514983, 3892766171, 2833368447, 275473920,  2394613217, 2091953150, 870094953,
-            3524323828, 897057645,  488878212,  873197214,  2630100528, 3939852929, 944114068,
-            2026119728, 115875280,  2905867426, 3192643919, 989201307,  2236032812, 1888510348,
-            708001855,  2166012172, 2121706374, 1407967546, 1826568876, 3659618284, 135277096,
-            2931815032, 1055135881, 2537437343, 1858044413, 2588429924, 1423973935, 3241939420,
-            3966440877, 2375002886, 2477142003, 2514473440, 1081133199, 1496940727, 382467042,
-            1760129281, 81977310,   811187075,  1385604734, 2623887355, 4070531513, 2100629879,
-            4142998949, 4195414618, 1489846841, 2688068550, 337182869,  84131191,   4387588,
-            2641405140, 1837403234, 661876463,  423660319,  2366546732, 3698878607, 2916121190,
-            309510684,  3029102089, 2692507376, 3266869596, 303422295,  11119541,   1002311379,
-            3724446882, 2004188516, 2652711421, 3486722046, 4141037460, 351865836,  412875013,
-            113149471,  2818130700, 3109944987, 3207577548, 3462087941, 1443140792, 322875622,
-            3834145971, 1693380373, 3524443732, 901891935,  3879414752, 2226778032, 1044609478,
-            12199016,   2213168758, 4207259464, 665553142,  2570993348, 1685535237, 1114492412,
-            553869152,  2855346376, 1205558328, 808835317,  3266626294, 470585896,  2438272365,
-            4052471963, 683640040,  3581539398, 1588419572, 1385549869, 3035140128, 1466027937,
-            4075470388, 363815288,  2171386836, 488404231,  3157371815, 2759472233, 2464768302,
-            2921774554, 2075839263, 835026995,  1030654310, 4229246330, 72352110,   3606056482,
-            512836002,  961858496,  319830805,  3869483469, 3160187826, 390292489,  2366221117,
-            2966401462, 1385691983, 617042280,  3501667414, 295865937,  4047377762, 2600411809,
-            3890163301, 896679896,  21714884,   764316452,  356556378,  4250402651, 3990990746,
-            1012967081, 965331966,  199003993,  3444755752, 8230450,    1255302023, 51902971,
-            1750733272, 2842520097, 1631477948, 2321320272, 426039404,  2113375576, 1748401915,
-            3452514983, 2847013518, 2833368447, 275473920,  2394613217, 2091953150, 1250695522,
-            3524323828, 897057645,  488878212,  873197214,  1452317325, 3939852929, 944114068,
-            2026119728, 115875280,  4061820350, 3192643919, 989201307,  2236032812, 1888510348,
-            3986446165, 2166012172, 2121706374, 1407967546, 1826568876, 2910745432, 135277096,
-            2931815032, 1055135881, 2537437343, 2976455307, 2588429924, 1423973935, 3241939420,
-            3966440877, 2418897705, 2477142003, 2514473440, 1081133199, 1496940727, 1321648771,
-            1760129281, 81977310,   811187075,  1385604734, 17644628,   4070531513, 2100629879,
-            4142998949, 4195414618, 2697310527, 2688068550, 337182869,  84131191,   4387588,
-            1724191700, 1837403234, 661876463,  423660319,  2366546732, 693430992,  2916121190,
-            309510684,  3029102089, 2692507376, 3917396098, 303422295,  11119541,   1002311379,
-            3724446882, 841468294,  2652711421, 3486722046, 4141037460, 351865836,  1733384185,
-            113149471,  2818130700, 3109944987, 3207577548, 2326233100, 1443140792, 322875622,
-            3834145971, 1693380373, 1580706359, 901891935,  3879414752, 2226778032, 1044609478,
-            3805470822, 2213168758, 4207259464, 665553142,  2570993348, 3406548636, 1114492412,
-            553869152,  2855346376, 1205558328, 4287831475, 1329654114, 2347235746, 2477803138,
-            2962371859, 3610024283, 4197266903, 1162294689, 1746713323, 2815058477, 2152552186,
-            4214791071, 2382522482, 3713914466, 3974765132, 348354997,  1670276150, 2173074887,
-            381736894,  3866219357, 1919366695, 3635118824, 2298653261, 3534332682, 1627699897,
-            4168636618, 3787938690, 2144231271, 2067679462, 217001062,  2308928337, 1620415125,
-            3526559172, 749451561,  2456947371, 3543607786, 1893824735, 962598819,  2332807164,
-            1691114891, 2543992233, 2914780639, 1610287145, 1700599697, 3185174208, 552323208,
-            2367242224, 3797136972, 3415066418, 2468049249, 1677937401, 40445671,   2886682530,
-            2585715434, 194932329,  2994003812, 3099556382, 680852222,  135838738,  1371063256,
-            995454898,  3754526418, 803635682,  634588682,  3869250783, 2442285521, 1455637058,
-            570621479,  2512681851, 1220136924, 750260121,  2909903038, 1582019728, 955115170,
-            1608265445, 2157390890, 2303678604, 1568394164, 831914289,  1971271392, 1294799854,
-            1489945167, 442427880,  1305083700, 1211218668, 2380073713, 2798736785, 2193524273,
-            3227386915, 1636588977, 3612937642, 435113647,  1591761830, 536210039,  2475747073,
-            4223795480, 1786737271, 1444661534, 3249410301, 3333695212, 4169107188, 3280638635,
-            702659930,  1444127970, 225340755,  2255629368, 746584456,  3965677674, 2671132955,
-            2080717656, 2145343886, 3712441197, 368422910,  1297685674, 4076123901, 26214470,
-            2948764826, 40503299,   1198194334, 2100063637, 1966331612, 2189582064, 2064696934,
-            1797550642, 3469793941, 2868963812, 851437659,  240918534,  365060070,  3530600064,
-            39695324,   1753898837, 1286976449, 3131971360, 2406485219, 3365373704, 3224113403,
-            1651742834, 587601940,  1574206085, 3739575036, 1413669616, 38172232,   293127854,
-            4126190109, 1891744061, 787878666,  456643669,  4228710325, 2025132037, 1492133135,
-            3122840937, 969442079,  3272420439, 3836126369, 1877655562, 2766212758, 3867984746,
-            3348077578, 1841216706,
-        },
-        {
-            448725004,  1973129079, 415692355,  1644323896, 1365751269, 2020292799, 3024792866,
-            1330258445, 3448701738, 3669528761, 1527894691, 2794359523, 213197793,  3918593407,
-            1461083677, 3090909405, 1080414335, 3772132348, 3395163645, 3944667,    2162018326,
-            3744088638, 3293425507, 3831416109, 1458556170, 3256590499, 753989969,  3623943535,
-            1518045704, 4175780446, 1154620080, 773605637,  2245413152, 3615326362, 652568832,
-            693600070,  2022644674, 560170236,  547514022,  2717915225, 671075912,  2788296784,
-            3261902694, 3327882459, 774843486,  2006522427, 3845473538, 3051883157, 1708705098,
-            668829349,  1215710910, 2655930874, 3165431996, 2021006848, 3208526183, 3305978800,
-            3906140543, 3729329954, 716915197,  3446107956, 261994418,  3329711182, 1947662437,
-            1260749803, 2903585291, 943909834,  2445388241, 2692780293, 2051780727, 4062077444,
-            154256124,  35584276,   3059817392, 2838049026, 3225568830, 1870866616, 2189837689,
-            3164349394, 439965136,  1071365155, 3693303123, 460404401,  1305509429, 3275070979,
-            2134404900, 4019949540, 2794653052, 2350761899, 3641562907, 2163439164, 1642672757,
-            2505433243, 1811617736, 2791161132, 1221526297, 1570253374, 153839098,  44907762,
-            3027096621, 3821842775, 418718665,  2205534017, 3619425163, 2922249308, 2616214202,
-            2106928241, 4008254940, 189597391,  2701655664, 1315051421, 1612962171, 1486399129,
-            3532362552, 2124445019, 160198740,  9440259,    110668192,  2527900208, 4265037720,
-            685162693,  1157535180, 2687487570, 4103465411, 1198196156, 3310190878, 367166777,
-            1761082924, 2840402021, 1599265562, 434777242,  352675591,  3779360833, 229936354,
-            3724264483, 359247599,  1557061870, 559799662,  2401381577, 2824842004, 3580391824,
-            2451233292, 3579803991, 2001247134, 105928994,  2603910572, 2837336674, 124895810,
-            1353103622, 2740218964, 3951419080, 2606539151, 3562295897, 3787548817, 2974245342,
-            2122398374, 2396461493, 626625853,  2653615590, 32868499,   1152592035, 229348598,
-            448725004,  1973129079, 415692355,  1644323896, 1359092033, 2020292799, 3024792866,
-            1330258445, 3448701738, 463410701,  1527894691, 2794359523, 213197793,  3918593407,
-            785233986,  3090909405, 1080414335, 3772132348, 3395163645, 2391864462, 2162018326,
-            3744088638, 3293425507, 3831416109, 3475514941, 3256590499, 753989969,  3623943535,
-            1518045704, 2821947373, 1154620080, 773605637,  2245413152, 3615326362, 1617255108,
-            693600070,  2022644674, 560170236,  547514022,  2942778390, 671075912,  2788296784,
-            3261902694, 3327882459, 3294675537, 2006522427, 3845473538, 3051883157, 1708705098,
-            858543899,  1215710910, 2655930874, 3165431996, 2021006848, 910868281,  3305978800,
-            3906140543, 3729329954, 716915197,  1021530474, 261994418,  3329711182, 1947662437,
-            1260749803, 478451371,  943909834,  2445388241, 2692780293, 2051780727, 1198882192,
-            154256124,  35584276,   3059817392, 2838049026, 2820960321, 1870866616, 2189837689,
-            3164349394, 439965136,  1650108068, 3693303123, 460404401,  1305509429, 3275070979,
-            2670437902, 4019949540, 2794653052, 2350761899, 3641562907, 2913742780, 1642672757,
-            2505433243, 1811617736, 2791161132, 3236947064, 1570253374, 153839098,  44907762,
-            3027096621, 1543391016, 418718665,  2205534017, 3619425163, 2922249308, 1141585846,
-            2106928241, 4008254940, 189597391,  2701655664, 1865262609, 1612962171, 1486399129,
-            3532362552, 2124445019, 3658422179, 9440259,    110668192,  2527900208, 4265037720,
-            2409079373, 1157535180, 2687487570, 4103465411, 1198196156, 3200503423, 367166777,
-            1761082924, 2840402021, 1599265562, 246931525,  352675591,  3779360833, 229936354,
-            3724264483, 1177978725, 1557061870, 559799662,  2401381577, 2824842004, 2323708744,
-            2451233292, 3579803991, 2001247134, 105928994,  597104495,  2837336674, 124895810,
-            1353103622, 2740218964, 2450875552, 2606539151, 3562295897, 3787548817, 2974245342,
-            4106540031, 2396461493, 626625853,  2653615590, 32868499,   2384390196, 229348598,
-            448725004,  1973129079, 415692355,  618922126,  1359092033, 2020292799, 3024792866,
-            1330258445, 3518879031, 463410701,  1527894691, 2794359523, 213197793,  464824883,
-            785233986,  3090909405, 1080414335, 3772132348, 3842426231, 2391864462, 2162018326,
-            3744088638, 3293425507, 3446701915, 3475514941, 3256590499, 753989969,  3623943535,
-            72445421,   2821947373, 1154620080, 773605637,  2245413152, 3256923847, 1617255108,
-            693600070,  2022644674, 560170236,  3565766921, 2942778390, 671075912,  2788296784,
-            3261902694, 1658434043, 3294675537, 2006522427, 3845473538, 3051883157, 79696111,
-            858543899,  1215710910, 2655930874, 3165431996, 3224061201, 910868281,  3305978800,
-            3906140543, 3729329954, 3999041800, 1021530474, 261994418,  3329711182, 1947662437,
-            1481955661, 478451371,  943909834,  2445388241, 2692780293, 552989581,  1198882192,
-            154256124,  35584276,   3059817392, 3796803250, 2820960321, 1870866616, 2189837689,
-            3164349394, 1055391362, 1650108068, 3693303123, 460404401,  1305509429, 2768599040,
-            2670437902, 4019949540, 2794653052, 2350761899, 670109263,  2913742780, 1642672757,
-            2505433243, 1811617736, 2738794769, 3236947064, 1570253374, 153839098,  44907762,
-            27696561,   1543391016, 418718665,  2205534017, 3619425163, 141376763,  1141585846,
-            2106928241, 4008254940, 189597391,  2851270785, 1865262609, 1612962171, 1486399129,
-            3532362552, 27671370,   3658422179, 9440259,    110668192,  2527900208, 1199580753,
-            2409079373, 1157535180, 2687487570, 4103465411, 727882363,  3200503423, 367166777,
-            1761082924, 2840402021, 3422420249, 246931525,  352675591,  3779360833, 229936354,
-            2526110051, 1177978725, 1557061870, 559799662,  2401381577, 3478746170, 2323708744,
-            2451233292, 3579803991, 2001247134, 1187420786, 597104495,  2837336674, 124895810,
-            1353103622, 906799761,  2450875552, 2606539151, 3562295897, 3787548817, 4011150742,
-            4106540031, 2396461493, 626625853,  2653615590, 371800015,  2384390196, 229348598,
-            448725004,  1973129079, 2001406289, 618922126,  1359092033, 2020292799, 3024792866,
-            1418986098, 3518879031, 463410701,  1527894691, 2794359523, 2983320811, 464824883,
-            785233986,  3090909405, 1080414335, 1244805001, 3842426231, 2391864462, 2162018326,
-            3744088638, 304221213,  3446701915, 3475514941, 3256590499, 753989969,  4161054275,
-            72445421,   2821947373, 1154620080, 773605637,  2509296648, 3256923847, 1617255108,
-            693600070,  2022644674, 3465025559, 3565766921, 2942778390, 671075912,  2788296784,
-            20287780,   1658434043, 3294675537, 2006522427, 3845473538, 2603727741, 79696111,
-            858543899,  1215710910, 2655930874, 1953507868, 3224061201, 910868281,  3305978800,
-            3906140543, 1516876641, 3999041800, 1021530474, 261994418,  3329711182, 473477274,
-            1481955661, 478451371,  943909834,  2445388241, 2784171087, 552989581,  1198882192,
-            154256124,  35584276,   3263698315, 3796803250, 2820960321, 1870866616, 2189837689,
-            1282585103, 1055391362, 1650108068, 3693303123, 460404401,  4275911694, 2768599040,
-            2670437902, 4019949540, 2794653052, 3024110721, 670109263,  2913742780, 1642672757,
-            2505433243, 2698615626, 2738794769, 3236947064, 1570253374, 153839098,  3881440109,
-            27696561,   1543391016, 418718665,  2205534017, 119918142,  141376763,  1141585846,
-            2106928241, 4008254940, 3455427366, 2851270785, 1865262609, 1612962171, 1486399129,
-            1188901781, 27671370,   3658422179, 9440259,    110668192,  1030002803, 1199580753,
-            2409079373, 1157535180, 2687487570, 933844486,  727882363,  3200503423, 367166777,
-            1761082924, 2329663979, 3422420249, 246931525,  352675591,  3779360833, 3098718564,
-            2526110051, 1177978725, 1557061870, 559799662,  2397454867, 3478746170, 2323708744,
-            2451233292, 3579803991, 3574008037, 1187420786, 597104495,  2837336674, 124895810,
-            641726218,  906799761,  2450875552, 2606539151, 3562295897, 1212909364, 4011150742,
-            4106540031, 2396461493, 626625853,  3038180512, 4039273811, 1652416553, 778402932,
-            1301638858, 3230497751, 3892615952, 8356881,    2130889105, 783861102,  1959253749,
-            2806954269, 3455092539, 2780453160, 4112205303, 2815611745, 3007147199, 1180835452,
-            2748035792, 1715190659, 1409134140, 480339278,  1102252203, 2035225266, 70826319,
-            1606609302, 3432980367, 780096705,  701576256,  1312068772, 2266852762, 3137596177,
-            1943390238, 196136572,  1293987915, 2772329269, 4008433904, 3412333806, 2110488974,
-            2981412996, 91159803,   3088361618, 3060592279, 4255802347, 1436981275, 2172647940,
-            797979669,  3364243132, 2784886855, 401557252,  3290046664, 3431419618, 3495328143,
-            37905543,   393811633,  3729092557, 3887037145, 3603615652, 3844619852, 4149288842,
-            1945259134, 3673231116, 3835801962, 2415080888, 4026813871, 2950324021, 2244985682,
-            2836956330, 3314048376, 2023831757, 2477577559, 403777410,  3778562579, 1565340808,
-            4143635428, 1301954312, 4048482412, 94916305,   3614710390, 2814336413, 4083871763,
-            3490461550, 1471272376, 1886048165, 1998645021, 908930301,  1954782901, 1880379257,
-            2238418559, 2544335881, 776922778,  3655114268, 4211081995, 2726702480, 3027986258,
-            2120014575, 380117007,  2063082726, 524840787,  443960823,  1863611762, 3109690452,
-            1166130361, 3681123819, 967807832,  3161689670, 2710743500, 1783916296, 4250369426,
-            2416864682, 1137851399, 86872920,   4096393511, 1997830327, 3162797311, 3358417322,
-            3480139256, 2774511565, 1487276186, 202608246,  823425611,  4252843356, 3306587770,
-            4197698938, 2231323315, 449112500,  3282825791, 3540528428, 281820233,  1539207429,
-            2332691577, 1492476670, 3960725377, 2880689459, 1706310755, 1100933063, 1805066623,
-            670478580,  1411746543, 3385459840, 4044218212, 2146147703, 2964515149, 976359941,
-            2821244937, 4005973389, 1002521960, 2097667866, 1586546805, 4153317911, 1495578476,
-            2132492390, 1226304247, 3674377815, 1079914456, 2461759452, 3673223400, 904248702,
-            3240193665, 1341552436,
-        },
-        {
-            1676507466, 1017841240, 2992644565, 476936158,  2468072723, 3113105154, 1154120402,
-            460889625,  1942263502, 1761593999, 3020908939, 3078194866, 310971889,  1644896012,
-            3756044556, 3549937583, 3710822994, 3554313733, 2174654326, 4251063242, 2340485150,
-            950951909,  4288936895, 3744348848, 706644559,  1085927825, 1595992020, 3288724966,
-            1367247946, 2950094970, 3925419886, 2628739022, 2528254629, 3582224789, 3907345559,
-            3373329273, 4255542251, 1185418446, 4018656113, 2854344020, 1381160022, 3642438773,
-            4284399225, 935780030,  4142412144, 1263328494, 1154237693, 2684443667, 3067549398,
-            4253090033, 1251034970, 1874233020, 3222830495, 3866931656, 286048055,  3146635362,
-            1436483376, 2821876495, 3927829532, 2648886905, 2142862852, 1368937545, 2647327844,
-            1072219385, 2621337706, 3543274652, 911792564,  1204178178, 4127214323, 2821691380,
-            3101998294, 730811902,  1989156224, 2872353003, 278290276,  1390223786, 2657819643,
-            552729795,  1736270535, 2759207116, 1897013739, 3657020278, 1387364861, 1966588302,
-            1049203087, 486446521,  3675999281, 714737345,  686837530,  85509025,   3609089773,
-            2117061768, 3935682560, 3859508784, 4105287041, 1808988481, 83680601,   1464326680,
-            1657693523, 3318062731, 1391154023, 234460119,  3551348221, 2245244809, 3635923821,
-            2814385745, 3497626257, 916790795,  245338628,  2514528380, 3711787525, 2239286063,
-            1054058916, 3963706010, 3176203796, 2230543409, 2173597546, 3786733892, 1396036965,
-            1038764273, 2032556038, 3216540537, 3298170974, 1008892557, 141155464,  1863766055,
-            3931110690, 191299053,  2019139711, 2409528317, 739418419,  1377144055, 2876702705,
-            3911939673, 1197696462, 2814009721, 600813233,  1535885024, 1486280357, 3084650548,
-            2324695947, 2293284974, 2036339249, 3465600153, 1624446108, 327866771,  3356772175,
-            1826625240, 1947102360, 3661848193, 1421374867, 3228945021, 1358646008, 1067180174,
-            2190741258, 643362354,  109899594,  2064362635, 3249674888, 2165543887, 4180291913,
-            1676507466, 1017841240, 2992644565, 476936158,  3608467942, 3113105154, 1154120402,
-            460889625,  1942263502, 1862994005, 3020908939, 3078194866, 310971889,  1644896012,
-            693774191,  3549937583, 3710822994, 3554313733, 2174654326, 37658897,   2340485150,
-            950951909,  4288936895, 3744348848, 2258231402, 1085927825, 1595992020, 3288724966,
-            1367247946, 3850509554, 3925419886, 2628739022, 2528254629, 3582224789, 3124287811,
-            3373329273, 4255542251, 1185418446, 4018656113, 1989726178, 1381160022, 3642438773,
-            4284399225, 935780030,  3622052196, 1263328494, 1154237693, 2684443667, 3067549398,
-            2786224913, 1251034970, 1874233020, 3222830495, 3866931656, 1529490307, 3146635362,
-            1436483376, 2821876495, 3927829532, 979247444,  2142862852, 1368937545, 2647327844,
-            1072219385, 294065371,  3543274652, 911792564,  1204178178, 4127214323, 103582737,
-            3101998294, 730811902,  1989156224, 2872353003, 1885087777, 1390223786, 2657819643,
-            552729795,  1736270535, 3325206451, 1897013739, 3657020278, 1387364861, 1966588302,
-            2117065739, 486446521,  3675999281, 714737345,  686837530,  3946214694, 3609089773,
-            2117061768, 3935682560, 3859508784, 2916136885, 1808988481, 83680601,   1464326680,
-            1657693523, 3438751781, 1391154023, 234460119,  3551348221, 2245244809, 3948410079,
-            2814385745, 3497626257, 916790795,  245338628,  1767303496, 3711787525, 2239286063,
-            1054058916, 3963706010, 4140631909, 2230543409, 2173597546, 3786733892, 1396036965,
-            1116033475, 2032556038, 3216540537, 3298170974, 1008892557, 667272562,  1863766055,
-            3931110690, 191299053,  2019139711, 272901326,  739418419,  1377144055, 2876702705,
-            3911939673, 3839312742, 2814009721, 600813233,  1535885024, 1486280357, 4256065219,
-            2324695947, 2293284974, 2036339249, 3465600153, 1215859603, 327866771,  3356772175,
-            1826625240, 1947102360, 4240407984, 1421374867, 3228945021, 1358646008, 1067180174,
-            4100357988, 643362354,  109899594,  2064362635, 3249674888, 2898852084, 4180291913,
-            1676507466, 1017841240, 2992644565, 1569683812, 3608467942, 3113105154, 1154120402,
-            460889625,  966040649,  1862994005, 3020908939, 3078194866, 310971889,  786634113,
-            693774191,  3549937583, 3710822994, 3554313733, 1578429713, 37658897,   2340485150,
-            950951909,  4288936895, 2528123823, 2258231402, 1085927825, 1595992020, 3288724966,
-            3544041088, 3850509554, 3925419886, 2628739022, 2528254629, 2562145937, 3124287811,
-            3373329273, 4255542251, 1185418446, 3693565710, 1989726178, 1381160022, 3642438773,
-            4284399225, 3271478204, 3622052196, 1263328494, 1154237693, 2684443667, 3615401444,
-            2786224913, 1251034970, 1874233020, 3222830495, 2572413057, 1529490307, 3146635362,
-            1436483376, 2821876495, 3993894153, 979247444,  2142862852, 1368937545, 2647327844,
-            1353904396, 294065371,  3543274652, 911792564,  1204178178, 3165709748, 103582737,
-            3101998294, 730811902,  1989156224, 893293786,  1885087777, 1390223786, 2657819643,
-            552729795,  3388458110, 3325206451, 1897013739, 3657020278, 1387364861, 3025318046,
-            2117065739, 486446521,  3675999281, 714737345,  2085926890, 3946214694, 3609089773,
-            2117061768, 3935682560, 868009118,  2916136885, 1808988481, 83680601,   1464326680,
-            797410789,  3438751781, 1391154023, 234460119,  3551348221, 4068940987, 3948410079,
-            2814385745, 3497626257, 916790795,  3722456098, 1767303496, 3711787525, 2239286063,
-            1054058916, 2030352819, 4140631909, 2230543409, 2173597546, 3786733892, 3211336683,
-            1116033475, 2032556038, 3216540537, 3298170974, 2589589144, 667272562,  1863766055,
-            3931110690, 191299053,  1139480458, 272901326,  739418419,  1377144055, 2876702705,
-            1954361769, 3839312742, 2814009721, 600813233,  1535885024, 3587775605, 4256065219,
-            2324695947, 2293284974, 2036339249, 1534849280, 1215859603, 327866771,  3356772175,
-            1826625240, 720372669,  4240407984, 1421374867, 3228945021, 1358646008, 3409069246,
-            4100357988, 643362354,  109899594,  2064362635, 4243434294, 2898852084, 4180291913,
-            1676507466, 1017841240, 3243922356, 1569683812, 3608467942, 3113105154, 1154120402,
-            1479311403, 966040649,  1862994005, 3020908939, 3078194866, 1556392996, 786634113,
-            693774191,  3549937583, 3710822994, 920664071,  1578429713, 37658897,   2340485150,
-            950951909,  740197415,  2528123823, 2258231402, 1085927825, 1595992020, 2580760267,
-            3544041088, 3850509554, 3925419886, 2628739022, 3867556156, 2562145937, 3124287811,
-            3373329273, 4255542251, 3185271749, 3693565710, 1989726178, 1381160022, 3642438773,
-            3042165367, 3271478204, 3622052196, 1263328494, 1154237693, 1016814036, 3615401444,
-            2786224913, 1251034970, 1874233020, 2956086971, 2572413057, 1529490307, 3146635362,
-            1436483376, 1513970396, 3993894153, 979247444,  2142862852, 1368937545, 3275665128,
-            1353904396, 294065371,  3543274652, 911792564,  2209636872, 3165709748, 103582737,
-            3101998294, 730811902,  965151434,  893293786,  1885087777, 1390223786, 2657819643,
-            3278634059, 3388458110, 3325206451, 1897013739, 3657020278, 4293473749, 3025318046,
-            2117065739, 486446521,  3675999281, 620561205,  2085926890, 3946214694, 3609089773,
-            2117061768, 163384588,  868009118,  2916136885, 1808988481, 83680601,   10243015,
-            797410789,  3438751781, 1391154023, 234460119,  1278218413, 4068940987, 3948410079,
-            2814385745, 3497626257, 1233272798, 3722456098, 1767303496, 3711787525, 2239286063,
-            3968895688, 2030352819, 4140631909, 2230543409, 2173597546, 2866251044, 3211336683,
-            1116033475, 2032556038, 3216540537, 4233849723, 2589589144, 667272562,  1863766055,
-            3931110690, 2468422423, 1139480458, 272901326,  739418419,  1377144055, 4240143411,
-            1954361769, 3839312742, 2814009721, 600813233,  3976840004, 3587775605, 4256065219,
-            2324695947, 2293284974, 437604123,  1534849280, 1215859603, 327866771,  3356772175,
-            2757237699, 720372669,  4240407984, 1421374867, 3228945021, 3284801305, 3409069246,
-            4100357988, 643362354,  109899594,  1301585321, 2528806870, 1838904064, 448772403,
-            1097849740, 1899994097, 618309123,  1911948510, 2309256224, 1861398151, 905306403,
-            1067595802, 36868624,   3780886191, 835126206,  3190251977, 2672497726, 2085944002,
-            2912993968, 2493776706, 667136329,  1474890786, 2383346554, 943528949,  3376706013,
-            2495573574, 144956345,  793159960,  1591274917, 477107637,  1383815442, 67384899,
-            2355242218, 1687409818, 3801093871, 2108217811, 3455908733, 4172160797, 3935534685,
-            631067839,  1187677548, 2280856137, 3020767646, 2063176246, 3736904984, 2952933848,
-            2975164686, 4144473303, 34670977,   1250976509, 3484166554, 1532744745, 225700994,
-            1878713627, 2122358980, 1456610194, 2917522161, 2818947075, 102678939,  53743858,
-            2095250656, 4023979225, 3094092874, 4128760696, 3411610028, 3020200609, 2225866341,
-            586320946,  63813522,   1238216159, 2825692263, 2169937231, 3298517640, 1542128261,
-            2205544184, 1258655704, 2629012083, 4113650203, 3198617867, 2742310794, 3372657381,
-            3115904410, 1948638822, 1123521744, 1080429281, 4086706732, 4142693211, 817377147,
-            2570194641, 26001503,   2861456160, 4185725555, 2573003804, 1618628779, 2588489212,
-            3996192609, 1555844274, 1003123505, 1326350123, 1130583849, 3017128756, 74119042,
-            4041266437, 1938014170, 3528465794, 4203969698, 1913054398, 3617979809, 2218810167,
-            2453899816, 1997423206, 477446533,  303090065,  757937082,  1523238256, 3140505311,
-            1422588701, 3642014639, 1740624195, 1276017154, 3072526193, 3675105122, 1335122682,
-            4080595263, 2308519420, 3299182769, 1461978532, 3098694217, 2982399822, 3088698511,
-            586759229,  3548750902, 1449857891, 2866451663, 2525162286, 57294602,   4107991297,
-            1214672265, 2940391280, 4285346034, 3338216759, 737207923,  4264163846, 59219141,
-            2300024654, 1876616814, 1976543605, 783571061,  1724699622, 1967524469, 1650309916,
-            3322257631, 3975521122, 273342162,  1156754241, 185315896,  3368133921, 66314655,
-            4153777915, 3519901897,
-        },
-        {
-            593832592,  246586301,  3915418583, 1560209072, 87645153,   1524036266, 2107185286,
-            3718698439, 4246841866, 140191566,  2685307939, 2081898217, 1119056328, 287318224,
-            810494505,  500114461,  240037818,  2641533362, 961046449,  557068561,  3299225208,
-            2966578378, 1096668757, 2870974168, 1670690750, 1566199692, 3070506472, 127606212,
-            1055471862, 2191576630, 3153959397, 2063695340, 3339560212, 3912369852, 1486332905,
-            2728690969, 2527551174, 2695029512, 2564110273, 523719378,  3049511955, 1298556056,
-            1455763586, 2701387106, 65428480,   1427761988, 1299437191, 1379476008, 3649817534,
-            3419888605, 3929140387, 1597486673, 3128114634, 2085850687, 3067626300, 3207969420,
-            3230202084, 2242210466, 403375004,  2627948194, 2610369084, 3945853070, 3426713745,
-            1658959046, 1848874642, 2609175594, 3840967546, 1838211217, 42197520,   3587854722,
-            1570882730, 3731490385, 1669492220, 304989523,  2845633061, 1959962934, 1191233807,
-            2060728147, 4200927443, 3770104070, 422731858,  568752140,  2373467915, 1474466741,
-            1907985100, 3981409756, 1976254789, 1395108303, 3828640666, 2022479216, 2628632324,
-            2377006033, 3395512828, 824756362,  1878318938, 127785110,  3660287061, 298201983,
-            2980471263, 446448649,  1845107234, 4057903874, 2466520526, 2497352403, 3876967448,
-            1721583826, 3770115034, 1040008931, 3095616514, 4008622913, 2111551705, 1469271872,
-            461608981,  3018813497, 1552678643, 925630701,  2334942451, 2661991720, 2731164877,
-            3100554025, 142055720,  1486359019, 1691983695, 2056164604, 2055721244, 246118853,
-            2660676692, 469806817,  810224396,  512010629,  2414103991, 1582990689, 3504005487,
-            566991906,  785972933,  3170112612, 2582314447, 1836079313, 3167683576, 3890174500,
-            963355285,  169739317,  1049994664, 3857345412, 4209559743, 2789246697, 1127427770,
-            1163632784, 2683544497, 1096604987, 835394002,  3540033879, 3250335392, 233042751,
-            744797696,  778124612,  2084011646, 133394496,  330736218,  3447591748, 2765333747,
-            593832592,  246586301,  3915418583, 1560209072, 466962714,  1524036266, 2107185286,
-            3718698439, 4246841866, 338637075,  2685307939, 2081898217, 1119056328, 287318224,
-            1668599999, 500114461,  240037818,  2641533362, 961046449,  3962030551, 3299225208,
-            2966578378, 1096668757, 2870974168, 4076137599, 1566199692, 3070506472, 127606212,
-            1055471862, 409323625,  3153959397, 2063695340, 3339560212, 3912369852, 3410020011,
-            2728690969, 2527551174, 2695029512, 2564110273, 3191374898, 3049511955, 1298556056,
-            1455763586, 2701387106, 2904131412, 1427761988, 1299437191, 1379476008, 3649817534,
-            3367942078, 3929140387, 1597486673, 3128114634, 2085850687, 54115464,   3207969420,
-            3230202084, 2242210466, 403375004,  408146319,  2610369084, 3945853070, 3426713745,
-            1658959046, 2296671064, 2609175594, 3840967546, 1838211217, 42197520,   2699288151,
-            1570882730, 3731490385, 1669492220, 304989523,  3134030716, 1959962934, 1191233807,
-            2060728147, 4200927443, 968785529,  422731858,  568752140,  2373467915, 1474466741,
-            2433853688, 3981409756, 1976254789, 1395108303, 3828640666, 911865621,  2628632324,
-            2377006033, 3395512828, 824756362,  1942308477, 127785110,  3660287061, 298201983,
-            2980471263, 3715987595, 1845107234, 4057903874, 2466520526, 2497352403, 2443189204,
-            1721583826, 3770115034, 1040008931, 3095616514, 1497287021, 2111551705, 1469271872,
-            461608981,  3018813497, 3679238362, 925630701,  2334942451, 2661991720, 2731164877,
-            3038355071, 142055720,  1486359019, 1691983695, 2056164604, 3532177836, 246118853,
-            2660676692, 469806817,  810224396,  232908337,  2414103991, 1582990689, 3504005487,
-            566991906,  1753229370, 3170112612, 2582314447, 1836079313, 3167683576, 4283429921,
-            963355285,  169739317,  1049994664, 3857345412, 3589340269, 2789246697, 1127427770,
-            1163632784, 2683544497, 2293873924, 835394002,  3540033879, 3250335392, 233042751,
-            2206330999, 778124612,  2084011646, 133394496,  330736218,  413439323,  2765333747,
-            593832592,  246586301,  3915418583, 1203033206, 466962714,  1524036266, 2107185286,
-            3718698439, 545061386,  338637075,  2685307939, 2081898217, 1119056328, 3958525739,
-            1668599999, 500114461,  240037818,  2641533362, 2292350044, 3962030551, 3299225208,
-            2966578378, 1096668757, 4289444210, 4076137599, 1566199692, 3070506472, 127606212,
-            4155542815, 409323625,  3153959397, 2063695340, 3339560212, 351655507,  3410020011,
-            2728690969, 2527551174, 2695029512, 2705087573, 3191374898, 3049511955, 1298556056,
-            1455763586, 2038452840, 2904131412, 1427761988, 1299437191, 1379476008, 711709033,
-            3367942078, 3929140387, 1597486673, 3128114634, 1467285853, 54115464,   3207969420,
-            3230202084, 2242210466, 3823426609, 408146319,  2610369084, 3945853070, 3426713745,
-            3176925017, 2296671064, 2609175594, 3840967546, 1838211217, 905539963,  2699288151,
-            1570882730, 3731490385, 1669492220, 3498928960, 3134030716, 1959962934, 1191233807,
-            2060728147, 3378448797, 968785529,  422731858,  568752140,  2373467915, 1706402518,
-            2433853688, 3981409756, 1976254789, 1395108303, 4136191165, 911865621,  2628632324,
-            2377006033, 3395512828, 3131823765, 1942308477, 127785110,  3660287061, 298201983,
-            392013686,  3715987595, 1845107234, 4057903874, 2466520526, 947397900,  2443189204,
-            1721583826, 3770115034, 1040008931, 217112815,  1497287021, 2111551705, 1469271872,
-            461608981,  1533242326, 3679238362, 925630701,  2334942451, 2661991720, 1056667393,
-            3038355071, 142055720,  1486359019, 1691983695, 1235898915, 3532177836, 246118853,
-            2660676692, 469806817,  1159875465, 232908337,  2414103991, 1582990689, 3504005487,
-            48119110,   1753229370, 3170112612, 2582314447, 1836079313, 3625586565, 4283429921,
-            963355285,  169739317,  1049994664, 2930243609, 3589340269, 2789246697, 1127427770,
-            1163632784, 1536220049, 2293873924, 835394002,  3540033879, 3250335392, 3782406546,
-            2206330999, 778124612,  2084011646, 133394496,  3386823186, 413439323,  2765333747,
-            593832592,  246586301,  3967484902, 1203033206, 466962714,  1524036266, 2107185286,
-            2291616883, 545061386,  338637075,  2685307939, 2081898217, 3902254922, 3958525739,
-            1668599999, 500114461,  240037818,  2313193489, 2292350044, 3962030551, 3299225208,
-            2966578378, 1426701615, 4289444210, 4076137599, 1566199692, 3070506472, 3381814495,
-            4155542815, 409323625,  3153959397, 2063695340, 4131405640, 351655507,  3410020011,
-            2728690969, 2527551174, 2622923666, 2705087573, 3191374898, 3049511955, 1298556056,
-            1394039953, 2038452840, 2904131412, 1427761988, 1299437191, 3267082142, 711709033,
-            3367942078, 3929140387, 1597486673, 919913815,  1467285853, 54115464,   3207969420,
-            3230202084, 2773841169, 3823426609, 408146319,  2610369084, 3945853070, 1473449931,
-            3176925017, 2296671064, 2609175594, 3840967546, 955882787,  905539963,  2699288151,
-            1570882730, 3731490385, 4198086533, 3498928960, 3134030716, 1959962934, 1191233807,
-            1928091492, 3378448797, 968785529,  422731858,  568752140,  3983313351, 1706402518,
-            2433853688, 3981409756, 1976254789, 2749555318, 4136191165, 911865621,  2628632324,
-            2377006033, 742138296,  3131823765, 1942308477, 127785110,  3660287061, 577999312,
-            392013686,  3715987595, 1845107234, 4057903874, 2549085497, 947397900,  2443189204,
-            1721583826, 3770115034, 3665613884, 217112815,  1497287021, 2111551705, 1469271872,
-            2108351201, 1533242326, 3679238362, 925630701,  2334942451, 3159728112, 1056667393,
-            3038355071, 142055720,  1486359019, 769407932,  1235898915, 3532177836, 246118853,
-            2660676692, 763785890,  1159875465, 232908337,  2414103991, 1582990689, 3784250295,
-            48119110,   1753229370, 3170112612, 2582314447, 1769505225, 3625586565, 4283429921,
-            963355285,  169739317,  3663613778, 2930243609, 3589340269, 2789246697, 1127427770,
-            3569170532, 1536220049, 2293873924, 835394002,  3540033879, 1965521160, 3782406546,
-            2206330999, 778124612,  2084011646, 2056718370, 3146203969, 3345317153, 2361123730,
-            840839592,  1948619679, 1390921878, 2610666385, 2307045491, 410416133,  163351321,
-            2403409233, 1723478427, 2178522941, 1094383019, 2065247821, 613607246,  728037371,
-            3031428853, 3354937794, 147757425,  1682352955, 4010621504, 2646669482, 2198265667,
-            3401144559, 2395506545, 164391672,  3408019164, 1099645278, 241883707,  3381122752,
-            4081885109, 1626203829, 1942789688, 3072091721, 3825491870, 4240427441, 1855488810,
-            3752566264, 3848845915, 65662247,   2666138429, 3663726993, 2679689613, 293102257,
-            2024756475, 807057499,  3623038990, 2810786676, 243230756,  3447440490, 2344923497,
-            2833047912, 1373121459, 2774009503, 206454908,  1499958320, 328702923,  3279094059,
-            2060973294, 1010809423, 4206003870, 4028302351, 3535585567, 985688795,  825605832,
-            1257246465, 627304510,  176844768,  29301712,   1825875050, 3953584063, 322250360,
-            1419041558, 2680325044, 39636241,   1237953395, 1875976300, 1672143644, 3820829616,
-            627695840,  318395166,  3106985772, 1817901825, 1546050520, 3331962512, 3883371623,
-            3027065844, 281472461,  1435640473, 2995466926, 1483743120, 436222404,  2505494621,
-            1739061536, 2602044706, 2631207011, 2024368710, 3052969252, 3023604788, 4274829923,
-            2457139787, 3428338815, 2311018488, 2010375311, 1146853409, 3255533419, 1239731173,
-            2765368039, 1157362241, 477260163,  1948897601, 335238813,  433635392,  3498300858,
-            3177632724, 2545493080, 3402379252, 124802989,  1753720711, 2078664542, 2203176639,
-            672989605,  3245358537, 2758248855, 3190342214, 441429850,  2343414224, 329050974,
-            2197114878, 1688950829, 1055674033, 2012753412, 877680691,  273671311,  1908186202,
-            2251928438, 4203772084, 3519840095, 2939674409, 3327090400, 508907877,  3776619844,
-            3631286225, 932409453,  3989651263, 1131071270, 2526690123, 819641762,  3419956593,
-            526736661,  1156941444, 3427548032, 4253491794, 2155637602, 4116386410, 338289656,
-            2544374671, 3116969675,
-        },
-        {
-            3672467167, 68684525,   1738833632, 3081329135, 2583806115, 2291130512, 503032614,
-            3658059597, 571493931,  685537959,  3498787788, 422428426,  3879256913, 1173158320,
-            4000800121, 298972869,  1718342816, 2541691685, 2490502642, 2321452806, 4223212804,
-            1812334632, 3717655725, 4238191852, 3001307165, 2621896355, 2572404999, 3590094954,
-            760765206,  2293618001, 1392353032, 1733137169, 2674005018, 4067961151, 1505710487,
-            451078217,  2591688848, 12635611,   507045428,  694822241,  1789383090, 1140183890,
-            1720695967, 1994318191, 3340349873, 2793804971, 1054433135, 2345087879, 3179939285,
-            1651968615, 1793223686, 1055357758, 914271617,  483007580,  2127727816, 2754998083,
-            3179053982, 598442002,  1950227301, 213053613,  3566888111, 2832258993, 4260365359,
-            443662829,  1706542890, 3852730296, 3643260763, 2163607277, 1812905006, 171529637,
-            215187467,  2369406909, 1929000706, 2572441025, 2133955541, 810692262,  1337974799,
-            4030350704, 2159178715, 3769451556, 1026825278, 593628480,  1817383139, 878832429,
-            2253876350, 203612980,  2102950440, 3407143936, 1912362251, 1595387637, 2827580539,
-            305467658,  3292706746, 44135525,   4001933553, 3697343089, 760470915,  587414402,
-            1419378814, 2852774010, 3891626781, 2757016765, 1090707384, 3997074427, 1047182100,
-            2855539022, 36229159,   1591415533, 3471572739, 1237952140, 2614469314, 213338525,
-            886212578,  2620301943, 713590207,  2430496777, 1198164420, 2644841698, 3654164701,
-            36283572,   1461695896, 1770331341, 1641501876, 3470919184, 3181021559, 3053795110,
-            3533531372, 3134337355, 668308383,  388340999,  3221275220, 1589659138, 294382235,
-            1447443579, 690177534,  1799726917, 2838977761, 4172949119, 2360858031, 159385920,
-            2248389027, 1790015671, 3925738275, 1049918544, 4107349511, 1619955951, 4188275966,
-            1672572975, 2672697497, 1863413666, 747724021,  4037561738, 1605940213, 445253292,
-            3362434828, 610898209,  1473244091, 735444769,  1540599852, 2449351720, 1032410949,
-            3672467167, 68684525,   1738833632, 3081329135, 519684794,  2291130512, 503032614,
-            3658059597, 571493931,  2400186105, 3498787788, 422428426,  3879256913, 1173158320,
-            4120704752, 298972869,  1718342816, 2541691685, 2490502642, 1686027891, 4223212804,
-            1812334632, 3717655725, 4238191852, 642431972,  2621896355, 2572404999, 3590094954,
-            760765206,  2949609717, 1392353032, 1733137169, 2674005018, 4067961151, 1526077846,
-            451078217,  2591688848, 12635611,   507045428,  2417951415, 1789383090, 1140183890,
-            1720695967, 1994318191, 3465605863, 2793804971, 1054433135, 2345087879, 3179939285,
-            3079297626, 1793223686, 1055357758, 914271617,  483007580,  306802527,  2754998083,
-            3179053982, 598442002,  1950227301, 2473418737, 3566888111, 2832258993, 4260365359,
-            443662829,  2097776414, 3852730296, 3643260763, 2163607277, 1812905006, 3957721904,
-            215187467,  2369406909, 1929000706, 2572441025, 3779486126, 810692262,  1337974799,
-            4030350704, 2159178715, 1127012865, 1026825278, 593628480,  1817383139, 878832429,
-            361018423,  203612980,  2102950440, 3407143936, 1912362251, 1475218277, 2827580539,
-            305467658,  3292706746, 44135525,   1900092336, 3697343089, 760470915,  587414402,
-            1419378814, 343303227,  3891626781, 2757016765, 1090707384, 3997074427, 745490961,
-            2855539022, 36229159,   1591415533, 3471572739, 3920625546, 2614469314, 213338525,
-            886212578,  2620301943, 827771411,  2430496777, 1198164420, 2644841698, 3654164701,
-            2747674190, 1461695896, 1770331341, 1641501876, 3470919184, 919857376,  3053795110,
-            3533531372, 3134337355, 668308383,  201138876,  3221275220, 1589659138, 294382235,
-            1447443579, 4211579707, 1799726917, 2838977761, 4172949119, 2360858031, 416103844,
-            2248389027, 1790015671, 3925738275, 1049918544, 3481887924, 1619955951, 4188275966,
-            1672572975, 2672697497, 564854400,  747724021,  4037561738, 1605940213, 445253292,
-            604900912,  610898209,  1473244091, 735444769,  1540599852, 3036173307, 1032410949,
-            3672467167, 68684525,   1738833632, 973022696,  519684794,  2291130512, 503032614,
-            3658059597, 1500301452, 2400186105, 3498787788, 422428426,  3879256913, 3923611748,
-            4120704752, 298972869,  1718342816, 2541691685, 2323881484, 1686027891, 4223212804,
-            1812334632, 3717655725, 2109094458, 642431972,  2621896355, 2572404999, 3590094954,
-            1837882537, 2949609717, 1392353032, 1733137169, 2674005018, 3252348987, 1526077846,
-            451078217,  2591688848, 12635611,   3971261781, 2417951415, 1789383090, 1140183890,
-            1720695967, 2906966040, 3465605863, 2793804971, 1054433135, 2345087879, 915518921,
-            3079297626, 1793223686, 1055357758, 914271617,  791633499,  306802527,  2754998083,
-            3179053982, 598442002,  324402573,  2473418737, 3566888111, 2832258993, 4260365359,
-            2168046398, 2097776414, 3852730296, 3643260763, 2163607277, 2595175979, 3957721904,
-            215187467,  2369406909, 1929000706, 657446369,  3779486126, 810692262,  1337974799,
-            4030350704, 1865557469, 1127012865, 1026825278, 593628480,  1817383139, 3414354529,
-            361018423,  203612980,  2102950440, 3407143936, 1739372987, 1475218277, 2827580539,
-            305467658,  3292706746, 825045562,  1900092336, 3697343089, 760470915,  587414402,
-            2000637694, 343303227,  3891626781, 2757016765, 1090707384, 4015377800, 745490961,
-            2855539022, 36229159,   1591415533, 2208656873, 3920625546, 2614469314, 213338525,
-            886212578,  2729976209, 827771411,  2430496777, 1198164420, 2644841698, 1922667440,
-            2747674190, 1461695896, 1770331341, 1641501876, 357535311,  919857376,  3053795110,
-            3533531372, 3134337355, 1004072597, 201138876,  3221275220, 1589659138, 294382235,
-            1148950143, 4211579707, 1799726917, 2838977761, 4172949119, 892664404,  416103844,
-            2248389027, 1790015671, 3925738275, 2612357890, 3481887924, 1619955951, 4188275966,
-            1672572975, 2005534713, 564854400,  747724021,  4037561738, 1605940213, 2620990454,
-            604900912,  610898209,  1473244091, 735444769,  3571225334, 3036173307, 1032410949,
-            3672467167, 68684525,   3327351604, 973022696,  519684794,  2291130512, 503032614,
-            3814902238, 1500301452, 2400186105, 3498787788, 422428426,  1756753750, 3923611748,
-            4120704752, 298972869,  1718342816, 652903081,  2323881484, 1686027891, 4223212804,
-            1812334632, 1599640566, 2109094458, 642431972,  2621896355, 2572404999, 1668409355,
-            1837882537, 2949609717, 1392353032, 1733137169, 3691709793, 3252348987, 1526077846,
-            451078217,  2591688848, 3353622601, 3971261781, 2417951415, 1789383090, 1140183890,
-            4113853791, 2906966040, 3465605863, 2793804971, 1054433135, 2195882948, 915518921,
-            3079297626, 1793223686, 1055357758, 898713552,  791633499,  306802527,  2754998083,
-            3179053982, 2469350088, 324402573,  2473418737, 3566888111, 2832258993, 1377718274,
-            2168046398, 2097776414, 3852730296, 3643260763, 3492388484, 2595175979, 3957721904,
-            215187467,  2369406909, 4243449339, 657446369,  3779486126, 810692262,  1337974799,
-            3960230785, 1865557469, 1127012865, 1026825278, 593628480,  732793312,  3414354529,
-            361018423,  203612980,  2102950440, 2401792405, 1739372987, 1475218277, 2827580539,
-            305467658,  2454275289, 825045562,  1900092336, 3697343089, 760470915,  2146882409,
-            2000637694, 343303227,  3891626781, 2757016765, 3997473261, 4015377800, 745490961,
-            2855539022, 36229159,   2375394427, 2208656873, 3920625546, 2614469314, 213338525,
-            2055366274, 2729976209, 827771411,  2430496777, 1198164420, 1789631187, 1922667440,
-            2747674190, 1461695896, 1770331341, 4284442852, 357535311,  919857376,  3053795110,
-            3533531372, 2124270060, 1004072597, 201138876,  3221275220, 1589659138, 1418386120,
-            1148950143, 4211579707, 1799726917, 2838977761, 3540708069, 892664404,  416103844,
-            2248389027, 1790015671, 3936883,    2612357890, 3481887924, 1619955951, 4188275966,
-            2963623483, 2005534713, 564854400,  747724021,  4037561738, 3431155922, 2620990454,
-            604900912,  610898209,  1473244091, 3880001339, 2879060316, 3300897679, 3960972039,
-            3201086624, 3814462934, 3426650044, 1930881632, 1981178788, 2956279691, 4272406256,
-            372705521,  1359389771, 1590302979, 3940206208, 3817999127, 2527835456, 2739078164,
-            716997849,  3235607043, 2550297745, 3688700200, 354502605,  2285793656, 2339138034,
-            3912354142, 2262255668, 469322622,  1319943359, 1916101235, 200441823,  509436982,
-            2160284593, 1687919695, 4153615582, 495735041,  3694469424, 2086893117, 4223008799,
-            105344742,  1698033424, 1149223145, 4183918790, 4176151950, 415739351,  817762972,
-            3768072560, 1931430949, 2698979439, 3481477932, 1994322914, 4078299950, 1268233995,
-            3254069145, 91029129,   498234704,  1636613942, 3710087092, 3876816560, 3510446387,
-            3870169008, 1370156410, 2442498047, 2324396523, 1258730334, 621954739,  1053015373,
-            491820717,  3386515432, 2203703266, 120167176,  2383669740, 1038666440, 2927342870,
-            3583197824, 1236241846, 2474675929, 679052891,  2451259584, 2177706146, 606842882,
-            3546980104, 2289281509, 353873434,  2041926837, 1238346748, 2729109726, 2843938395,
-            2938124210, 2554443866, 1494477920, 693378319,  2020963566, 2000385949, 3744098787,
-            650307220,  2631327075, 1529128757, 595871428,  3206666562, 458062987,  875238192,
-            3729317374, 1368843921, 3478430230, 3234384578, 3232435428, 321359326,  994274524,
-            361184397,  4285497594, 915263578,  1486882838, 9988613,    829077170,  677216046,
-            4141828204, 165804609,  1086678519, 2933434608, 1351662802, 2640085040, 2611502932,
-            2033698714, 2008873254, 3995557835, 1020873906, 67873555,   2230337823, 1263800417,
-            1148712155, 3985159589, 2979503513, 2854714997, 1539343345, 2751484352, 1569100732,
-            2020758949, 2126757134, 3426641899, 2808587825, 1953320148, 1096398464, 1502907172,
-            3751230087, 765557661,  765290990,  3056075500, 2040620632, 422573751,  3613558930,
-            1741145769, 273531216,  837238736,  494297893,  2903251124, 1636782182, 4256592784,
-            3652746656, 4258393217,
-        },
-        {
-            3212670511, 2153890933, 3389886302, 1679212425, 785515994,  1690035549, 962461839,
-            3640286237, 2301044507, 1910937887, 1142148809, 3245573732, 4117348033, 3976342376,
-            3415747994, 3582248192, 1966205684, 2771477410, 2674572269, 876608859,  1434522460,
-            408643068,  3365059323, 3921654422, 1649056382, 2014601419, 1555489831, 1188870717,
-            2171915279, 4255644222, 82775988,   1490062301, 1510938253, 1946745561, 216663702,
-            2100953920, 2053436353, 87855084,   4064756739, 3262919864, 3796114505, 111059952,
-            4158134036, 519828811,  1502095139, 480817312,  3067368763, 1141560125, 1959957723,
-            2360513480, 3023544934, 2523337925, 836886107,  1158245305, 2493334248, 2042859741,
-            3145003667, 875425746,  3021854247, 1658568518, 2885761,    3459772512, 3100734919,
-            1385670675, 1891958720, 1777736228, 914691402,  3793284329, 1426052767, 3494876375,
-            2154155559, 803057789,  2383558656, 3603487205, 3514986451, 1709472704, 3460406793,
-            1004452150, 2944352161, 1411310532, 385359737,  3821256454, 3553084631, 2034479847,
-            2819146749, 406752143,  784756521,  3618615044, 1477019288, 1680600,    2417417802,
-            2281769642, 3202208293, 2059859798, 1962450048, 1706598865, 2955736789, 840128589,
-            2972407555, 1590043562, 3530713159, 213291443,  3957318061, 1510092553, 1577137960,
-            1659634508, 2394399613, 2756077993, 1275222214, 3640461128, 2715808259, 725619310,
-            1112786880, 1521643391, 1758763269, 2337719558, 2251023383, 1752914648, 999489268,
-            1459305500, 2758241773, 1971214466, 2938474470, 2143119156, 2383442154, 949297524,
-            2502051844, 897901634,  4247473697, 1976584440, 2238070868, 3550286351, 756951370,
-            2286225164, 2376523739, 746680483,  731554793,  2064563598, 1619898191, 2033452205,
-            1919758267, 3344692592, 3895181770, 4176278728, 3237981830, 2860981081, 2053769331,
-            157311464,  1201516486, 2484534576, 1975651513, 222498320,  1189392814, 2620758671,
-            54063389,   661698866,  876716783,  2340138819, 4134809989, 414974325,  3414438654,
-            3212670511, 2153890933, 3389886302, 1679212425, 3790319322, 1690035549, 962461839,
-            3640286237, 2301044507, 2383626279, 1142148809, 3245573732, 4117348033, 3976342376,
-            4142800936, 3582248192, 1966205684, 2771477410, 2674572269, 3221539936, 1434522460,
-            408643068,  3365059323, 3921654422, 771191244,  2014601419, 1555489831, 1188870717,
-            2171915279, 320618350,  82775988,   1490062301, 1510938253, 1946745561, 3271824692,
-            2100953920, 2053436353, 87855084,   4064756739, 2043280650, 3796114505, 111059952,
-            4158134036, 519828811,  3157634347, 480817312,  3067368763, 1141560125, 1959957723,
-            2858914969, 3023544934, 2523337925, 836886107,  1158245305, 1757885452, 2042859741,
-            3145003667, 875425746,  3021854247, 120347518,  2885761,    3459772512, 3100734919,
-            1385670675, 2661031647, 1777736228, 914691402,  3793284329, 1426052767, 768521597,
-            2154155559, 803057789,  2383558656, 3603487205, 3388125628, 1709472704, 3460406793,
-            1004452150, 2944352161, 820679032,  385359737,  3821256454, 3553084631, 2034479847,
-            1604307882, 406752143,  784756521,  3618615044, 1477019288, 2996146664, 2417417802,
-            2281769642, 3202208293, 2059859798, 2305609619, 1706598865, 2955736789, 840128589,
-            2972407555, 2954436492, 3530713159, 213291443,  3957318061, 1510092553, 4032708322,
-            1659634508, 2394399613, 2756077993, 1275222214, 2701131602, 2715808259, 725619310,
-            1112786880, 1521643391, 1520119626, 2337719558, 2251023383, 1752914648, 999489268,
-            132023133,  2758241773, 1971214466, 2938474470, 2143119156, 4110135379, 949297524,
-            2502051844, 897901634,  4247473697, 1725478235, 2238070868, 3550286351, 756951370,
-            2286225164, 204194829,  746680483,  731554793,  2064563598, 1619898191, 1908759394,
-            1919758267, 3344692592, 3895181770, 4176278728, 2017413224, 2860981081, 2053769331,
-            157311464,  1201516486, 982921805,  1975651513, 222498320,  1189392814, 2620758671,
-            2892057301, 661698866,  876716783,  2340138819, 4134809989, 77109873,   3414438654,
-            3212670511, 2153890933, 3389886302, 1567957442, 3790319322, 1690035549, 962461839,
-            3640286237, 935321414,  2383626279, 1142148809, 3245573732, 4117348033, 741795793,
-            4142800936, 3582248192, 1966205684, 2771477410, 2040221430, 3221539936, 1434522460,
-            408643068,  3365059323, 3035064600, 771191244,  2014601419, 1555489831, 1188870717,
-            1659397424, 320618350,  82775988,   1490062301, 1510938253, 2960290001, 3271824692,
-            2100953920, 2053436353, 87855084,   2771081412, 2043280650, 3796114505, 111059952,
-            4158134036, 641981117,  3157634347, 480817312,  3067368763, 1141560125, 3789183399,
-            2858914969, 3023544934, 2523337925, 836886107,  2554877500, 1757885452, 2042859741,
-            3145003667, 875425746,  3829356005, 120347518,  2885761,    3459772512, 3100734919,
-            2754364285, 2661031647, 1777736228, 914691402,  3793284329, 3105084886, 768521597,
-            2154155559, 803057789,  2383558656, 520614030,  3388125628, 1709472704, 3460406793,
-            1004452150, 2760554751, 820679032,  385359737,  3821256454, 3553084631, 1136986682,
-            1604307882, 406752143,  784756521,  3618615044, 3551003262, 2996146664, 2417417802,
-            2281769642, 3202208293, 2997834248, 2305609619, 1706598865, 2955736789, 840128589,
-            3380678618, 2954436492, 3530713159, 213291443,  3957318061, 3061718766, 4032708322,
-            1659634508, 2394399613, 2756077993, 277911057,  2701131602, 2715808259, 725619310,
-            1112786880, 1519388368, 1520119626, 2337719558, 2251023383, 1752914648, 3566835597,
-            132023133,  2758241773, 1971214466, 2938474470, 2787782228, 4110135379, 949297524,
-            2502051844, 897901634,  3924587650, 1725478235, 2238070868, 3550286351, 756951370,
-            2027967155, 204194829,  746680483,  731554793,  2064563598, 2816390631, 1908759394,
-            1919758267, 3344692592, 3895181770, 2473875938, 2017413224, 2860981081, 2053769331,
-            157311464,  1886208153, 982921805,  1975651513, 222498320,  1189392814, 2652276669,
-            2892057301, 661698866,  876716783,  2340138819, 910165364,  77109873,   3414438654,
-            3212670511, 2153890933, 627403186,  1567957442, 3790319322, 1690035549, 962461839,
-            3558357884, 935321414,  2383626279, 1142148809, 3245573732, 2885149890, 741795793,
-            4142800936, 3582248192, 1966205684, 4042181787, 2040221430, 3221539936, 1434522460,
-            408643068,  1498836946, 3035064600, 771191244,  2014601419, 1555489831, 2935049386,
-            1659397424, 320618350,  82775988,   1490062301, 2482071158, 2960290001, 3271824692,
-            2100953920, 2053436353, 2692402096, 2771081412, 2043280650, 3796114505, 111059952,
-            2718672360, 641981117,  3157634347, 480817312,  3067368763, 1440455522, 3789183399,
-            2858914969, 3023544934, 2523337925, 3757150169, 2554877500, 1757885452, 2042859741,
-            3145003667, 1765356059, 3829356005, 120347518,  2885761,    3459772512, 1983257601,
-            2754364285, 2661031647, 1777736228, 914691402,  983906121,  3105084886, 768521597,
-            2154155559, 803057789,  207920004,  520614030,  3388125628, 1709472704, 3460406793,
-            88367398,   2760554751, 820679032,  385359737,  3821256454, 255272841,  1136986682,
-            1604307882, 406752143,  784756521,  1909046907, 3551003262, 2996146664, 2417417802,
-            2281769642, 1713779253, 2997834248, 2305609619, 1706598865, 2955736789, 483189064,
-            3380678618, 2954436492, 3530713159, 213291443,  2570339738, 3061718766, 4032708322,
-            1659634508, 2394399613, 1544361015, 277911057,  2701131602, 2715808259, 725619310,
-            1669035844, 1519388368, 1520119626, 2337719558, 2251023383, 1669872591, 3566835597,
-            132023133,  2758241773, 1971214466, 1107196584, 2787782228, 4110135379, 949297524,
-            2502051844, 2613154326, 3924587650, 1725478235, 2238070868, 3550286351, 1249371684,
-            2027967155, 204194829,  746680483,  731554793,  4103975442, 2816390631, 1908759394,
-            1919758267, 3344692592, 1511927326, 2473875938, 2017413224, 2860981081, 2053769331,
-            1858231586, 1886208153, 982921805,  1975651513, 222498320,  2347138704, 2652276669,
-            2892057301, 661698866,  876716783,  238734257,  2181196260, 1421887250, 3119293051,
-            1088071406, 2388332484, 1209001658, 819394715,  2537465761, 852394616,  3070562123,
-            2432023207, 3119636352, 3872931518, 3690901129, 4128722266, 2945551160, 820333409,
-            59905790,   617167272,  3128469281, 3529159815, 648599447,  1179349690, 2601984370,
-            3811672268, 632045539,  1174663648, 3242967172, 3823137616, 4092104336, 515619425,
-            3510280473, 2033540862, 3520445279, 4067500704, 3007457160, 3315170743, 4074760790,
-            1695928928, 2563563325, 2372480486, 2699520333, 2296201364, 335733223,  2680934653,
-            3611862811, 2864660648, 1522520863, 246935590,  1134721115, 2909371976, 3138633865,
-            2886724117, 347916657,  3535954782, 3332975342, 4097999573, 3941612406, 2014211033,
-            3051305323, 2292522095, 1374934227, 2124135738, 2242938006, 3934835214, 1538538766,
-            1278557852, 1218483097, 2514500125, 3138428273, 4154517350, 3179003397, 210010370,
-            678734082,  3415918185, 2862874119, 1987415471, 3946692722, 285557656,  1413682975,
-            1030331737, 675558039,  4211552557, 1019650131, 3339383553, 3014476015, 2584327130,
-            3031872416, 419012365,  1981107550, 4090006709, 2620492410, 2761287207, 384495146,
-            1834853354, 3285287718, 1421540449, 2682058794, 3583066012, 1819208544, 2980517681,
-            3819541186, 3510210055, 3965570398, 2073072743, 1784805647, 1897974736, 3027347234,
-            3121041338, 4094984080, 3159426225, 2318532021, 577361479,  1512032785, 3366589177,
-            633613647,  1108003800, 804611687,  1931498021, 3238337817, 2609875497, 2190017353,
-            4011207454, 1358280347, 2294622450, 2906598449, 890196496,  1822092244, 2170456927,
-            340291350,  653291285,  145216672,  3651792469, 3515814882, 2383759602, 1029627975,
-            929334005,  3615748420, 3148840078, 956476671,  3449757421, 1782688522, 461697128,
-            1776934867, 1678016107, 1041911925, 2909669783, 3578872319, 2144754342, 2843316757,
-            3350974263, 3084292014, 2369830371, 4169314650, 4181479057, 1926901761, 3972839356,
-            1085144425, 1742554203,
-        },
-        {
-            2657510202, 270297201,  2970166904, 3151626326, 973127447,  1523852613, 598650578,
-            10289043,   1138773500, 1379558769, 2202575480, 1622690708, 181345079,  228706650,
-            2807760507, 3061024281, 2310359315, 3094465578, 4062753882, 2744510393, 3844622451,
-            1759718963, 2393602744, 977540509,  870449791,  1484134272, 2838962253, 3079492430,
-            2617141201, 3744868057, 994295425,  1302594555, 277777192,  1793039043, 1620482692,
-            2518563014, 1163760339, 2709515777, 4220588138, 531143270,  2528377633, 931694828,
-            1472659070, 900489303,  3538137811, 3849822545, 1304182427, 2423451948, 587259647,
-            296795227,  3843393378, 100570026,  1824916038, 3155192628, 1205830295, 2205840913,
-            2598785234, 2138099222, 1585588098, 1304106911, 2443465671, 3007665864, 3350433156,
-            3623458138, 629407548,  3209244941, 2102270358, 952701496,  2715374730, 2142960491,
-            2566649458, 2386659994, 4201648072, 367516884,  211986877,  3970312395, 4153651951,
-            3794120671, 614826776,  769672874,  2218713182, 236114529,  1614697510, 2420862368,
-            3471485219, 3080341429, 2394724619, 3585194114, 1394678495, 2137969611, 3955498999,
-            2765569351, 3084915757, 765232390,  1406483345, 2796499268, 2491128017, 1052428931,
-            1713430644, 3921576513, 3753414774, 973530327,  2545412294, 1841110931, 1174406073,
-            1104865218, 1586606252, 2612244473, 1407875673, 1823397519, 2613642581, 3163449384,
-            3129975397, 2059184961, 818092118,  3182607992, 1658516909, 2467681581, 1065789733,
-            799857247,  2492902195, 168866110,  2251316716, 1607684829, 2347941418, 2382781983,
-            3298500129, 3609200925, 3060374324, 2602420483, 2357812057, 3739699403, 3260652552,
-            205015857,  1936033273, 3955997259, 821264237,  1882720491, 159294165,  3197657094,
-            528058988,  2768830342, 805087358,  896645931,  1360375456, 3417488932, 3863200799,
-            4033907887, 983658874,  1828706965, 875027318,  1310362653, 3711487613, 4148261033,
-            3145162047, 485182003,  2633647498, 1369395018, 4163384029, 1827719274, 270658892,
-            2657510202, 270297201,  2970166904, 3151626326, 499420828,  1523852613, 598650578,
-            10289043,   1138773500, 640170086,  2202575480, 1622690708, 181345079,  228706650,
-            3957853780, 3061024281, 2310359315, 3094465578, 4062753882, 2049506087, 3844622451,
-            1759718963, 2393602744, 977540509,  2346891936, 1484134272, 2838962253, 3079492430,
-            2617141201, 2112540708, 994295425,  1302594555, 277777192,  1793039043, 981072592,
-            2518563014, 1163760339, 2709515777, 4220588138, 1992965594, 2528377633, 931694828,
-            1472659070, 900489303,  32461040,   3849822545, 1304182427, 2423451948, 587259647,
-            3728056788, 3843393378, 100570026,  1824916038, 3155192628, 1194916233, 2205840913,
-            2598785234, 2138099222, 1585588098, 2944318376, 2443465671, 3007665864, 3350433156,
-            3623458138, 1413669939, 3209244941, 2102270358, 952701496,  2715374730, 826676012,
-            2566649458, 2386659994, 4201648072, 367516884,  4272143576, 3970312395, 4153651951,
-            3794120671, 614826776,  4106382849, 2218713182, 236114529,  1614697510, 2420862368,
-            138091237,  3080341429, 2394724619, 3585194114, 1394678495, 2113895281, 3955498999,
-            2765569351, 3084915757, 765232390,  2247301699, 2796499268, 2491128017, 1052428931,
-            1713430644, 1076867271, 3753414774, 973530327,  2545412294, 1841110931, 3427639042,
-            1104865218, 1586606252, 2612244473, 1407875673, 2159805028, 2613642581, 3163449384,
-            3129975397, 2059184961, 1251595655, 3182607992, 1658516909, 2467681581, 1065789733,
-            524065102,  2492902195, 168866110,  2251316716, 1607684829, 877205873,  2382781983,
-            3298500129, 3609200925, 3060374324, 1983477493, 2357812057, 3739699403, 3260652552,
-            205015857,  3578808491, 3955997259, 821264237,  1882720491, 159294165,  3639531297,
-            528058988,  2768830342, 805087358,  896645931,  2309781073, 3417488932, 3863200799,
-            4033907887, 983658874,  3756437847, 875027318,  1310362653, 3711487613, 4148261033,
-            3264363953, 485182003,  2633647498, 1369395018, 4163384029, 184614728,  270658892,
-            2657510202, 270297201,  2970166904, 884907665,  499420828,  1523852613, 598650578,
-            10289043,   2023902217, 640170086,  2202575480, 1622690708, 181345079,  1358722197,
-            3957853780, 3061024281, 2310359315, 3094465578, 4156960892, 2049506087, 3844622451,
-            1759718963, 2393602744, 1018272187, 2346891936, 1484134272, 2838962253, 3079492430,
-            663361761,  2112540708, 994295425,  1302594555, 277777192,  4201292427, 981072592,
-            2518563014, 1163760339, 2709515777, 3301905324, 1992965594, 2528377633, 931694828,
-            1472659070, 3170286187, 32461040,   3849822545, 1304182427, 2423451948, 166213287,
-            3728056788, 3843393378, 100570026,  1824916038, 1534589402, 1194916233, 2205840913,
-            2598785234, 2138099222, 767439709,  2944318376, 2443465671, 3007665864, 3350433156,
-            257274072,  1413669939, 3209244941, 2102270358, 952701496,  893224047,  826676012,
-            2566649458, 2386659994, 4201648072, 1336000731, 4272143576, 3970312395, 4153651951,
-            3794120671, 2381517352, 4106382849, 2218713182, 236114529,  1614697510, 2427291612,
-            138091237,  3080341429, 2394724619, 3585194114, 1339840651, 2113895281, 3955498999,
-            2765569351, 3084915757, 1920073265, 2247301699, 2796499268, 2491128017, 1052428931,
-            1720704700, 1076867271, 3753414774, 973530327,  2545412294, 655938239,  3427639042,
-            1104865218, 1586606252, 2612244473, 748629647,  2159805028, 2613642581, 3163449384,
-            3129975397, 1868740512, 1251595655, 3182607992, 1658516909, 2467681581, 3092135795,
-            524065102,  2492902195, 168866110,  2251316716, 229376275,  877205873,  2382781983,
-            3298500129, 3609200925, 1270454086, 1983477493, 2357812057, 3739699403, 3260652552,
-            3976376418, 3578808491, 3955997259, 821264237,  1882720491, 2211365699, 3639531297,
-            528058988,  2768830342, 805087358,  1351870678, 2309781073, 3417488932, 3863200799,
-            4033907887, 2317721807, 3756437847, 875027318,  1310362653, 3711487613, 1929459086,
-            3264363953, 485182003,  2633647498, 1369395018, 2141675718, 184614728,  270658892,
-            2657510202, 270297201,  3337954073, 884907665,  499420828,  1523852613, 598650578,
-            3874207188, 2023902217, 640170086,  2202575480, 1622690708, 2020255059, 1358722197,
-            3957853780, 3061024281, 2310359315, 753738868,  4156960892, 2049506087, 3844622451,
-            1759718963, 1672276116, 1018272187, 2346891936, 1484134272, 2838962253, 1680679979,
-            663361761,  2112540708, 994295425,  1302594555, 1941500850, 4201292427, 981072592,
-            2518563014, 1163760339, 184357645,  3301905324, 1992965594, 2528377633, 931694828,
-            3462653134, 3170286187, 32461040,   3849822545, 1304182427, 396808784,  166213287,
-            3728056788, 3843393378, 100570026,  876691173,  1534589402, 1194916233, 2205840913,
-            2598785234, 4286653520, 767439709,  2944318376, 2443465671, 3007665864, 2793587144,
-            257274072,  1413669939, 3209244941, 2102270358, 2792966616, 893224047,  826676012,
-            2566649458, 2386659994, 798757973,  1336000731, 4272143576, 3970312395, 4153651951,
-            2930383268, 2381517352, 4106382849, 2218713182, 236114529,  1936008889, 2427291612,
-            138091237,  3080341429, 2394724619, 4157586029, 1339840651, 2113895281, 3955498999,
-            2765569351, 2243544114, 1920073265, 2247301699, 2796499268, 2491128017, 3372810009,
-            1720704700, 1076867271, 3753414774, 973530327,  484392041,  655938239,  3427639042,
-            1104865218, 1586606252, 1373046326, 748629647,  2159805028, 2613642581, 3163449384,
-            1558595520, 1868740512, 1251595655, 3182607992, 1658516909, 3503432306, 3092135795,
-            524065102,  2492902195, 168866110,  4106973392, 229376275,  877205873,  2382781983,
-            3298500129, 2366096961, 1270454086, 1983477493, 2357812057, 3739699403, 4223323197,
-            3976376418, 3578808491, 3955997259, 821264237,  1581729952, 2211365699, 3639531297,
-            528058988,  2768830342, 3946263978, 1351870678, 2309781073, 3417488932, 3863200799,
-            3948072426, 2317721807, 3756437847, 875027318,  1310362653, 3439391360, 1929459086,
-            3264363953, 485182003,  2633647498, 3576868480, 2527748673, 3116247125, 4020801612,
-            2594734840, 3308177137, 665011257,  40118275,   3584569179, 3399729283, 3867174947,
-            658488234,  1099195903, 2274511402, 1872529118, 2518961094, 2633598693, 4160728307,
-            449442630,  164837956,  1010805767, 605336924,  1178031445, 3949359502, 2585151633,
-            611885521,  293204651,  3389557188, 1172294301, 2503819061, 659842653,  504992348,
-            3762165683, 1799777932, 4161843209, 1924622448, 1006263939, 115233249,  2775142171,
-            3228632586, 885407023,  2514866293, 3615088636, 2488824172, 2631364137, 1454226414,
-            3888177876, 70646265,   2291458600, 2370783730, 1566625834, 3652033806, 4136806683,
-            2819973124, 3207365429, 989185345,  3343822313, 2580472874, 4077285847, 4032963783,
-            2883518039, 2253593637, 904631114,  2654790756, 2967911632, 2131672564, 1594073414,
-            2370718497, 3769371275, 1547951748, 2473303924, 651625138,  2159175883, 4062995539,
-            696224922,  3388626509, 100118553,  770731124,  2149458689, 3223175313, 3524052514,
-            2651241522, 78236806,   3212708723, 1045780878, 2257575290, 3709360831, 966829465,
-            61269250,   405063245,  331731998,  2472078870, 1138237364, 1135091387, 3245001409,
-            3817992705, 1738939574, 1397617581, 2896546651, 4207083421, 3802162100, 391930524,
-            1326819828, 85308067,   3235336831, 686989692,  1947564282, 842881662,  2887279866,
-            3850666935, 2001895525, 2673649961, 2106555006, 1762053005, 2334552700, 26094213,
-            1184502058, 2048598709, 4039640450, 1439363714, 1022688817, 1053169108, 170896272,
-            444231850,  1500204748, 1077470703, 1630597179, 1382588806, 138805391,  1636536505,
-            3118018426, 3461152216, 2486547351, 2045361316, 2976067436, 468876399,  1407419455,
-            3226137264, 414206328,  1011039713, 3537947031, 2359787831, 258556532,  3615987029,
-            3372097337, 3586352388, 1056198830, 1852291192, 3888893481, 746156045,  4203877603,
-            297851145,  2615507398, 1141098641, 1881412583, 3014341741, 2125186797, 229307235,
-            3476606674, 3553854689,
-        },
-        {
-            625483965,  954730856,  1205163837, 3915411513, 3946726893, 1000629942, 917571039,
-            3982105450, 2800280168, 3665380687, 4096901474, 4290662116, 9987680,    2220439,
-            1308176727, 1385561029, 4146150049, 3831234937, 3086012320, 2271615124, 2285088783,
-            1198117452, 333393585,  1127107835, 2145457623, 3971812766, 2795796231, 3869791442,
-            1471212257, 1791569874, 421781105,  3855084990, 4067215933, 3855867249, 1016969874,
-            2014967428, 1362640552, 436696539,  4126085007, 2835606018, 90540003,   3071893415,
-            703908155,  161089037,  3262791250, 1475189376, 2493385665, 399814902,  1513754694,
-            4212962830, 927656329,  475146723,  2288475455, 2294530448, 3989980787, 2602963214,
-            3707281376, 673791816,  4213894549, 3002900423, 3701235475, 1168814696, 1620029652,
-            2427105139, 408222363,  1961396928, 1399483960, 2082777862, 430498033,  1781229294,
-            2800050419, 2741578023, 963286944,  1473269534, 1818785513, 1991535001, 1705575571,
-            386998987,  578919179,  3471081139, 1044755786, 544150804,  1557192831, 1694173354,
-            3181010333, 1517609364, 1878642743, 659249052,  3826483154, 2373333598, 3607539016,
-            466062705,  591646921,  3179209367, 793181048,  1966927999, 1008342432, 2109169360,
-            1698265974, 3381676497, 4087814026, 2243261456, 2094928297, 3377689298, 1069083724,
-            1326804350, 1654946750, 1963625944, 3034833059, 3353010172, 1372858279, 2816310514,
-            2156113397, 1575625156, 355316807,  1768663771, 2167147575, 1710928954, 545342218,
-            712598169,  2910256949, 1478760285, 3551536987, 1976351181, 3033896379, 130828799,
-            660467065,  2240596703, 1684802505, 8849551,    959374465,  4289123451, 3324088616,
-            3600784794, 406176042,  3320938656, 2288316767, 3720424416, 3496487125, 3894015504,
-            1916570086, 1620547092, 555143759,  324617436,  1428267278, 471598067,  637106052,
-            458232305,  2737113223, 4174290144, 3587975182, 2760660566, 3091539324, 3584058790,
-            2358650536, 1399041676, 931254387,  509315591,  2812721244, 354870432,  2775324623,
-            625483965,  954730856,  1205163837, 3915411513, 224264014,  1000629942, 917571039,
-            3982105450, 2800280168, 929341248,  4096901474, 4290662116, 9987680,    2220439,
-            928938608,  1385561029, 4146150049, 3831234937, 3086012320, 3357459141, 2285088783,
-            1198117452, 333393585,  1127107835, 4252072148, 3971812766, 2795796231, 3869791442,
-            1471212257, 1701975316, 421781105,  3855084990, 4067215933, 3855867249, 26216822,
-            2014967428, 1362640552, 436696539,  4126085007, 1045785774, 90540003,   3071893415,
-            703908155,  161089037,  33417184,   1475189376, 2493385665, 399814902,  1513754694,
-            2260124801, 927656329,  475146723,  2288475455, 2294530448, 2346682162, 2602963214,
-            3707281376, 673791816,  4213894549, 1740852490, 3701235475, 1168814696, 1620029652,
-            2427105139, 2259637243, 1961396928, 1399483960, 2082777862, 430498033,  4246953998,
-            2800050419, 2741578023, 963286944,  1473269534, 2592712095, 1991535001, 1705575571,
-            386998987,  578919179,  1750665380, 1044755786, 544150804,  1557192831, 1694173354,
-            532802256,  1517609364, 1878642743, 659249052,  3826483154, 815262404,  3607539016,
-            466062705,  591646921,  3179209367, 2296197275, 1966927999, 1008342432, 2109169360,
-            1698265974, 732119330,  4087814026, 2243261456, 2094928297, 3377689298, 281984046,
-            1326804350, 1654946750, 1963625944, 3034833059, 2766534913, 1372858279, 2816310514,
-            2156113397, 1575625156, 30411796,   1768663771, 2167147575, 1710928954, 545342218,
-            1869299837, 2910256949, 1478760285, 3551536987, 1976351181, 404676034,  130828799,
-            660467065,  2240596703, 1684802505, 2976619114, 959374465,  4289123451, 3324088616,
-            3600784794, 3709091523, 3320938656, 2288316767, 3720424416, 3496487125, 3954581490,
-            1916570086, 1620547092, 555143759,  324617436,  3770205531, 471598067,  637106052,
-            458232305,  2737113223, 20974152,   3587975182, 2760660566, 3091539324, 3584058790,
-            1400411119, 1399041676, 931254387,  509315591,  2812721244, 2488070234, 2775324623,
-            625483965,  954730856,  1205163837, 1852557490, 224264014,  1000629942, 917571039,
-            3982105450, 3396829041, 929341248,  4096901474, 4290662116, 9987680,    3263498835,
-            928938608,  1385561029, 4146150049, 3831234937, 791807634,  3357459141, 2285088783,
-            1198117452, 333393585,  1590024385, 4252072148, 3971812766, 2795796231, 3869791442,
-            364829381,  1701975316, 421781105,  3855084990, 4067215933, 4220604133, 26216822,
-            2014967428, 1362640552, 436696539,  1999309309, 1045785774, 90540003,   3071893415,
-            703908155,  3655721535, 33417184,   1475189376, 2493385665, 399814902,  1687531153,
-            2260124801, 927656329,  475146723,  2288475455, 4086648412, 2346682162, 2602963214,
-            3707281376, 673791816,  2331505380, 1740852490, 3701235475, 1168814696, 1620029652,
-            2969759217, 2259637243, 1961396928, 1399483960, 2082777862, 2326220066, 4246953998,
-            2800050419, 2741578023, 963286944,  4239088192, 2592712095, 1991535001, 1705575571,
-            386998987,  2401836419, 1750665380, 1044755786, 544150804,  1557192831, 3184587677,
-            532802256,  1517609364, 1878642743, 659249052,  2013270472, 815262404,  3607539016,
-            466062705,  591646921,  1413963901, 2296197275, 1966927999, 1008342432, 2109169360,
-            3974304692, 732119330,  4087814026, 2243261456, 2094928297, 2795054625, 281984046,
-            1326804350, 1654946750, 1963625944, 1515778636, 2766534913, 1372858279, 2816310514,
-            2156113397, 191552192,  30411796,   1768663771, 2167147575, 1710928954, 1863438973,
-            1869299837, 2910256949, 1478760285, 3551536987, 3108615720, 404676034,  130828799,
-            660467065,  2240596703, 662859378,  2976619114, 959374465,  4289123451, 3324088616,
-            1495344105, 3709091523, 3320938656, 2288316767, 3720424416, 3558371969, 3954581490,
-            1916570086, 1620547092, 555143759,  3379561090, 3770205531, 471598067,  637106052,
-            458232305,  1243037074, 20974152,   3587975182, 2760660566, 3091539324, 983174475,
-            1400411119, 1399041676, 931254387,  509315591,  2356607427, 2488070234, 2775324623,
-            625483965,  954730856,  1936994902, 1852557490, 224264014,  1000629942, 917571039,
-            3484116122, 3396829041, 929341248,  4096901474, 4290662116, 709388853,  3263498835,
-            928938608,  1385561029, 4146150049, 3570547081, 791807634,  3357459141, 2285088783,
-            1198117452, 3533608060, 1590024385, 4252072148, 3971812766, 2795796231, 4170641364,
-            364829381,  1701975316, 421781105,  3855084990, 4112731201, 4220604133, 26216822,
-            2014967428, 1362640552, 1223484282, 1999309309, 1045785774, 90540003,   3071893415,
-            2652791835, 3655721535, 33417184,   1475189376, 2493385665, 4092665391, 1687531153,
-            2260124801, 927656329,  475146723,  308266165,  4086648412, 2346682162, 2602963214,
-            3707281376, 4006091450, 2331505380, 1740852490, 3701235475, 1168814696, 170710920,
-            2969759217, 2259637243, 1961396928, 1399483960, 3054247054, 2326220066, 4246953998,
-            2800050419, 2741578023, 3542934090, 4239088192, 2592712095, 1991535001, 1705575571,
-            565058228,  2401836419, 1750665380, 1044755786, 544150804,  3179570443, 3184587677,
-            532802256,  1517609364, 1878642743, 1695572448, 2013270472, 815262404,  3607539016,
-            466062705,  1717780245, 1413963901, 2296197275, 1966927999, 1008342432, 2121694393,
-            3974304692, 732119330,  4087814026, 2243261456, 3695857832, 2795054625, 281984046,
-            1326804350, 1654946750, 4104914971, 1515778636, 2766534913, 1372858279, 2816310514,
-            2389188982, 191552192,  30411796,   1768663771, 2167147575, 3392942231, 1863438973,
-            1869299837, 2910256949, 1478760285, 1543225320, 3108615720, 404676034,  130828799,
-            660467065,  2559049259, 662859378,  2976619114, 959374465,  4289123451, 2487968337,
-            1495344105, 3709091523, 3320938656, 2288316767, 890448222,  3558371969, 3954581490,
-            1916570086, 1620547092, 712505321,  3379561090, 3770205531, 471598067,  637106052,
-            4026882823, 1243037074, 20974152,   3587975182, 2760660566, 4087936666, 983174475,
-            1400411119, 1399041676, 931254387,  1609136113, 2229898630, 1887999811, 314391032,
-            4023847294, 1728151193, 3275545275, 2582177658, 4186143765, 3273878517, 1370520390,
-            778486225,  1056965906, 603601242,  3776576359, 2531671242, 1764487308, 3594622140,
-            2235387360, 79785605,   1467351988, 1613621919, 3344546164, 3626111035, 497934495,
-            3611924084, 884995443,  1832281121, 17068374,   2277824974, 2961038861, 3675372466,
-            731816712,  919733087,  541414957,  3582305907, 2112843363, 1679991596, 3546929312,
-            1859585785, 3817459874, 2286310777, 3613748106, 1304182955, 1514888791, 828962683,
-            122440083,  2437115299, 1786619142, 4249223132, 2482670187, 3845243519, 2017375555,
-            263490307,  1161131516, 1565099089, 3797713834, 3067835130, 3316066525, 2640642313,
-            589522593,  671627022,  2760656783, 311597343,  2115000137, 2822429427, 1340786191,
-            4207095621, 3235233882, 127314414,  2235192891, 4187675053, 4047305409, 2110461814,
-            2517176112, 2907358030, 2803023628, 4171488533, 3286513882, 3565461695, 3856878357,
-            108233317,  3520959386, 2954793285, 3633514467, 3992767348, 69928123,   3166289124,
-            3014386548, 2891727881, 3400307480, 2181131854, 1909755321, 1294432437, 795123448,
-            3648298504, 2736404569, 2714648656, 1641345532, 2815138756, 3258897348, 1485245564,
-            161090171,  1455956972, 3438526804, 1414769348, 88230850,   282309952,  1166231273,
-            3518601820, 767401142,  2346054207, 207888328,  3041217285, 3850812051, 470653252,
-            1452480628, 1221034295, 3005454919, 1910072190, 3838812929, 3187545523, 1961978037,
-            1771894066, 1566230543, 2371596718, 3003701411, 1168002951, 3677336011, 3136560865,
-            1388603026, 3723042747, 499428812,  18339377,   2495732079, 3304497222, 356402051,
-            4197717860, 2878428130, 2980657896, 2467137061, 2787028859, 1913052666, 2578498056,
-            3951840238, 1705563877, 1340023052, 2259624846, 1712842453, 2047599910, 397051650,
-            3887062021, 2914574743, 2901994463, 2032452561, 1166246292, 3056301838, 2360441413,
-            3754551722, 2359969574,
-        },
-        {
-            3768542219, 2777948797, 3328832678, 3488502819, 2708053041, 2217907094, 2133505056,
-            2218961277, 2148551748, 1420045625, 1709182366, 1816409641, 3791695288, 4207813971,
-            22588497,   2211317602, 616238454,  2394270012, 3212896041, 213408768,  2199328374,
-            3188624050, 811443809,  2818548979, 3150758902, 2022548260, 2462701924, 3793704672,
-            2358080321, 483288372,  450033142,  772942770,  2224873625, 241543410,  312552314,
-            1268067149, 915918620,  3906238422, 132545832,  3486041298, 2414090506, 3798383292,
-            2257004699, 130309284,  1158673651, 152325583,  3499865580, 4094273597, 1029041593,
-            93538481,   3963199522, 4215066819, 2851084137, 950351173,  2758084052, 3408506640,
-            2468905351, 3982226741, 3591899344, 2972879639, 3321078070, 252381865,  409397320,
-            741653003,  1936712854, 1198684021, 922916691,  10413506,   3546896248, 1704703870,
-            1479762464, 104399432,  4144557684, 68239720,   2666028745, 362625839,  2591539911,
-            2837165752, 2180226515, 4076543943, 2956460273, 312410753,  2566731139, 2532653524,
-            2399030172, 207904356,  354574195,  485696336,  3816686234, 3016971115, 4272692603,
-            2352732136, 33493163,   780255811,  4092242980, 4121521600, 2119254314, 42767673,
-            1081488778, 2757446871, 2267513620, 3472164720, 2750308207, 1707164045, 3125591821,
-            3236687597, 299194858,  537384087,  1695155491, 2078250102, 1705861659, 2416322096,
-            1692335914, 1178915980, 3405431297, 4059323309, 2014660182, 3847682866, 4037583683,
-            2629253995, 867809161,  2167953720, 2290558548, 417635396,  53496289,   1890906570,
-            2842247580, 807266805,  1226139132, 2067929784, 1697038549, 3312131466, 1234311530,
-            3199840935, 4185078776, 1807030355, 215385887,  845421530,  1350380353, 4209181096,
-            2576197887, 1275262872, 2806513944, 2718623701, 2779287384, 71403197,   219220133,
-            2181111477, 2000396844, 3595837555, 1232425455, 2630647391, 3280867676, 2622740782,
-            1578938469, 3624564545, 992324522,  3056113148, 3473635768, 3664935418, 1786902552,
-            3768542219, 2777948797, 3328832678, 3488502819, 2530862473, 2217907094, 2133505056,
-            2218961277, 2148551748, 4050672856, 1709182366, 1816409641, 3791695288, 4207813971,
-            4175126713, 2211317602, 616238454,  2394270012, 3212896041, 732700649,  2199328374,
-            3188624050, 811443809,  2818548979, 972036137,  2022548260, 2462701924, 3793704672,
-            2358080321, 1200725173, 450033142,  772942770,  2224873625, 241543410,  1907109304,
-            1268067149, 915918620,  3906238422, 132545832,  301668366,  2414090506, 3798383292,
-            2257004699, 130309284,  1228520287, 152325583,  3499865580, 4094273597, 1029041593,
-            3267460249, 3963199522, 4215066819, 2851084137, 950351173,  47361585,   3408506640,
-            2468905351, 3982226741, 3591899344, 1878226915, 3321078070, 252381865,  409397320,
-            741653003,  1716437506, 1198684021, 922916691,  10413506,   3546896248, 1591998796,
-            1479762464, 104399432,  4144557684, 68239720,   3810955599, 362625839,  2591539911,
-            2837165752, 2180226515, 3908378015, 2956460273, 312410753,  2566731139, 2532653524,
-            687490649,  207904356,  354574195,  485696336,  3816686234, 378445403,  4272692603,
-            2352732136, 33493163,   780255811,  1303281526, 4121521600, 2119254314, 42767673,
-            1081488778, 1734311274, 2267513620, 3472164720, 2750308207, 1707164045, 4212588163,
-            3236687597, 299194858,  537384087,  1695155491, 2250704950, 1705861659, 2416322096,
-            1692335914, 1178915980, 677982197,  4059323309, 2014660182, 3847682866, 4037583683,
-            1765435945, 867809161,  2167953720, 2290558548, 417635396,  2125103002, 1890906570,
-            2842247580, 807266805,  1226139132, 2056644398, 1697038549, 3312131466, 1234311530,
-            3199840935, 3063718636, 1807030355, 215385887,  845421530,  1350380353, 3610667273,
-            2576197887, 1275262872, 2806513944, 2718623701, 2492912955, 71403197,   219220133,
-            2181111477, 2000396844, 3465351710, 1232425455, 2630647391, 3280867676, 2622740782,
-            1331873639, 3624564545, 992324522,  3056113148, 3473635768, 782257020,  1786902552,
-            3768542219, 2777948797, 3328832678, 856888454,  2530862473, 2217907094, 2133505056,
-            2218961277, 3752437534, 4050672856, 1709182366, 1816409641, 3791695288, 1581813910,
-            4175126713, 2211317602, 616238454,  2394270012, 1796414157, 732700649,  2199328374,
-            3188624050, 811443809,  4225173324, 972036137,  2022548260, 2462701924, 3793704672,
-            1410793611, 1200725173, 450033142,  772942770,  2224873625, 3889840648, 1907109304,
-            1268067149, 915918620,  3906238422, 1249098244, 301668366,  2414090506, 3798383292,
-            2257004699, 1620796656, 1228520287, 152325583,  3499865580, 4094273597, 82853050,
-            3267460249, 3963199522, 4215066819, 2851084137, 1212493334, 47361585,   3408506640,
-            2468905351, 3982226741, 3195419905, 1878226915, 3321078070, 252381865,  409397320,
-            1584154733, 1716437506, 1198684021, 922916691,  10413506,   1734068880, 1591998796,
-            1479762464, 104399432,  4144557684, 1973878859, 3810955599, 362625839,  2591539911,
-            2837165752, 1727282404, 3908378015, 2956460273, 312410753,  2566731139, 3656295687,
-            687490649,  207904356,  354574195,  485696336,  355953909,  378445403,  4272692603,
-            2352732136, 33493163,   3784169684, 1303281526, 4121521600, 2119254314, 42767673,
-            2331527847, 1734311274, 2267513620, 3472164720, 2750308207, 820692528,  4212588163,
-            3236687597, 299194858,  537384087,  781151234,  2250704950, 1705861659, 2416322096,
-            1692335914, 4288008793, 677982197,  4059323309, 2014660182, 3847682866, 3328850880,
-            1765435945, 867809161,  2167953720, 2290558548, 542850707,  2125103002, 1890906570,
-            2842247580, 807266805,  3803006390, 2056644398, 1697038549, 3312131466, 1234311530,
-            809106036,  3063718636, 1807030355, 215385887,  845421530,  654189622,  3610667273,
-            2576197887, 1275262872, 2806513944, 1517875462, 2492912955, 71403197,   219220133,
-            2181111477, 3826277490, 3465351710, 1232425455, 2630647391, 3280867676, 3343597872,
-            1331873639, 3624564545, 992324522,  3056113148, 3725661598, 782257020,  1786902552,
-            3768542219, 2777948797, 3392298403, 856888454,  2530862473, 2217907094, 2133505056,
-            4160889036, 3752437534, 4050672856, 1709182366, 1816409641, 1282922706, 1581813910,
-            4175126713, 2211317602, 616238454,  3806252779, 1796414157, 732700649,  2199328374,
-            3188624050, 983474330,  4225173324, 972036137,  2022548260, 2462701924, 880446667,
-            1410793611, 1200725173, 450033142,  772942770,  3179870546, 3889840648, 1907109304,
-            1268067149, 915918620,  4261932110, 1249098244, 301668366,  2414090506, 3798383292,
-            471794009,  1620796656, 1228520287, 152325583,  3499865580, 1275109063, 82853050,
-            3267460249, 3963199522, 4215066819, 4209882674, 1212493334, 47361585,   3408506640,
-            2468905351, 1324785625, 3195419905, 1878226915, 3321078070, 252381865,  4259927884,
-            1584154733, 1716437506, 1198684021, 922916691,  1800164165, 1734068880, 1591998796,
-            1479762464, 104399432,  2774114308, 1973878859, 3810955599, 362625839,  2591539911,
-            2126614872, 1727282404, 3908378015, 2956460273, 312410753,  4098052715, 3656295687,
-            687490649,  207904356,  354574195,  937379582,  355953909,  378445403,  4272692603,
-            2352732136, 2694800574, 3784169684, 1303281526, 4121521600, 2119254314, 1741415022,
-            2331527847, 1734311274, 2267513620, 3472164720, 480821513,  820692528,  4212588163,
-            3236687597, 299194858,  1128762168, 781151234,  2250704950, 1705861659, 2416322096,
-            160918735,  4288008793, 677982197,  4059323309, 2014660182, 3354205317, 3328850880,
-            1765435945, 867809161,  2167953720, 3363861382, 542850707,  2125103002, 1890906570,
-            2842247580, 2459935488, 3803006390, 2056644398, 1697038549, 3312131466, 2378675900,
-            809106036,  3063718636, 1807030355, 215385887,  3528413525, 654189622,  3610667273,
-            2576197887, 1275262872, 993221887,  1517875462, 2492912955, 71403197,   219220133,
-            1805256638, 3826277490, 3465351710, 1232425455, 2630647391, 3718538519, 3343597872,
-            1331873639, 3624564545, 992324522,  3490576382, 2532191937, 1108692984, 802110050,
-            3984561242, 1973015939, 1351080551, 2382044123, 2393286227, 860228704,  179528099,
-            3569709850, 233527199,  3657599850, 3269634908, 3278075383, 4037814788, 952837871,
-            2050210570, 2376157484, 2566048929, 4200278597, 123440514,  573557299,  1585379806,
-            4012659271, 4000306490, 2508478465, 970078629,  4064973573, 645149301,  109544347,
-            647594029,  2097163688, 1515080116, 2142799649, 2519702653, 3122920796, 1952249156,
-            3932382760, 2155292687, 2517875978, 249059416,  4282787227, 2595461065, 1004349415,
-            2151451255, 2510715277, 3004500356, 3410567758, 344538405,  1946747709, 470298928,
-            1033671146, 4207801290, 1411375630, 3419808553, 3218285984, 3584735265, 811222695,
-            3898833227, 3535298390, 3764741581, 3927026520, 2850086968, 2818485449, 1963038474,
-            1871366998, 1900570117, 997663534,  746627295,  1827737271, 3814054979, 728285698,
-            1696496343, 1696888597, 1010837663, 1756050352, 785994134,  1436861536, 1949153732,
-            2360018842, 1703393654, 2248338006, 3884572674, 789998735,  1155994673, 2022469457,
-            223162974,  309571006,  725482797,  3909032036, 2531190541, 373676789,  1061107200,
-            4231921550, 558635876,  2773807977, 1860218585, 1150041015, 2252812038, 2413330952,
-            191909567,  3518171813, 3513416318, 2679253717, 3850755687, 1564154710, 324714884,
-            1600953447, 4095583159, 1796641692, 2518000547, 3621187982, 501166402,  2112782420,
-            1704276185, 2249859782, 3754293422, 1942321901, 1851019104, 240158224,  3181132144,
-            2281632719, 808029657,  1721710011, 2287207169, 3044484177, 2363339534, 805273402,
-            3696016147, 3549191229, 3353631259, 2946802391, 383414270,  300735554,  471515206,
-            1907815837, 1576327662, 3825043525, 2817119733, 1973847200, 1398317206, 2221853087,
-            501440864,  642467132,  494410179,  1191241925, 3549838846, 3621239619, 2640266286,
-            4140123024, 315957218,  3696758268, 2502777875, 2150738616, 1570099119, 2598276767,
-            3585886712, 230047417,
-        },
-        {
-            589830376,  752414733,  2869608742, 2518380070, 2478287814, 1199344360, 1799837956,
-            1418343396, 753650914,  20900668,   2370829792, 3473912241, 192828140,  3447435385,
-            2355752474, 1108910673, 1664736959, 131348369,  2358812851, 2999247956, 2314271211,
-            835946595,  656482274,  988510519,  1020676298, 2040863011, 2354634680, 416809240,
-            1688615097, 2445488982, 3471104377, 3122617405, 403248473,  3284008539, 2679712697,
-            2794249317, 3856183324, 3572622200, 3969461225, 3661035197, 3844053810, 3385932262,
-            3677490580, 4001133205, 250837866,  2912073181, 2423302273, 2763438468, 1573869515,
-            3368963901, 4276493734, 3034081021, 1710621017, 1045413970, 1682534189, 1032749876,
-            1117845372, 15750469,   3817033980, 3335377241, 862470781,  2260762748, 4080397000,
-            3146003524, 2872712017, 865562660,  3464194059, 79232127,   2434805371, 387527938,
-            3952041839, 3827899638, 120454427,  323165204,  2358504956, 1452600490, 525473769,
-            919903434,  3678992758, 1719146665, 1232687517, 3964594583, 2116460683, 3001642557,
-            820047613,  211896510,  2406007022, 2282757145, 727120778,  3875162709, 1443890364,
-            438634096,  3937136814, 4057596534, 124766080,  2938181112, 729395380,  3818980378,
-            3491894295, 1697013868, 3973248544, 3426566986, 1263852852, 1778910645, 463751992,
-            2807158355, 3565172789, 2130722527, 3658588279, 979598294,  2573274804, 1569944511,
-            1795617816, 1515618350, 245989074,  213788449,  1753359127, 4219749974, 4138090602,
-            3323943056, 2671142010, 708993393,  28016174,   3980779390, 1893490255, 3996515143,
-            1881308188, 2431906096, 2010091263, 1215980054, 105772205,  139079530,  3193657975,
-            2320598532, 4118819821, 3726059612, 861202133,  1709422500, 1314775378, 3707756935,
-            779050007,  2337446492, 4069110470, 3808352940, 538269172,  372065666,  3500856829,
-            3334652495, 2458910050, 2191516523, 4175392666, 2788557068, 2350929547, 3465842713,
-            4181321622, 406508523,  1961290332, 3263007561, 2478036854, 3981001996, 3848175103,
-            589830376,  752414733,  2869608742, 2518380070, 2172198775, 1199344360, 1799837956,
-            1418343396, 753650914,  1752788033, 2370829792, 3473912241, 192828140,  3447435385,
-            2398203633, 1108910673, 1664736959, 131348369,  2358812851, 3040129737, 2314271211,
-            835946595,  656482274,  988510519,  3153933073, 2040863011, 2354634680, 416809240,
-            1688615097, 680686349,  3471104377, 3122617405, 403248473,  3284008539, 1141958501,
-            2794249317, 3856183324, 3572622200, 3969461225, 39004881,   3844053810, 3385932262,
-            3677490580, 4001133205, 903512834,  2912073181, 2423302273, 2763438468, 1573869515,
-            2008578107, 4276493734, 3034081021, 1710621017, 1045413970, 158622339,  1032749876,
-            1117845372, 15750469,   3817033980, 3037782377, 862470781,  2260762748, 4080397000,
-            3146003524, 1770765049, 865562660,  3464194059, 79232127,   2434805371, 2021710304,
-            3952041839, 3827899638, 120454427,  323165204,  3390140910, 1452600490, 525473769,
-            919903434,  3678992758, 3054036799, 1232687517, 3964594583, 2116460683, 3001642557,
-            3969436228, 211896510,  2406007022, 2282757145, 727120778,  2268876093, 1443890364,
-            438634096,  3937136814, 4057596534, 1901012382, 2938181112, 729395380,  3818980378,
-            3491894295, 1497994998, 3973248544, 3426566986, 1263852852, 1778910645, 869494694,
-            2807158355, 3565172789, 2130722527, 3658588279, 2355661200, 2573274804, 1569944511,
-            1795617816, 1515618350, 945555512,  213788449,  1753359127, 4219749974, 4138090602,
-            4177729446, 2671142010, 708993393,  28016174,   3980779390, 844156307,  3996515143,
-            1881308188, 2431906096, 2010091263, 1580581766, 105772205,  139079530,  3193657975,
-            2320598532, 606288963,  3726059612, 861202133,  1709422500, 1314775378, 1230497269,
-            779050007,  2337446492, 4069110470, 3808352940, 326872275,  372065666,  3500856829,
-            3334652495, 2458910050, 1562021486, 4175392666, 2788557068, 2350929547, 3465842713,
-            815509703,  406508523,  1961290332, 3263007561, 2478036854, 1669931989, 3848175103,
-            589830376,  752414733,  2869608742, 3654091005, 2172198775, 1199344360, 1799837956,
-            1418343396, 3928685206, 1752788033, 2370829792, 3473912241, 192828140,  2388799090,
-            2398203633, 1108910673, 1664736959, 131348369,  3795361859, 3040129737, 2314271211,
-            835946595,  656482274,  1082662886, 3153933073, 2040863011, 2354634680, 416809240,
-            4095349234, 680686349,  3471104377, 3122617405, 403248473,  3907535884, 1141958501,
-            2794249317, 3856183324, 3572622200, 1692587980, 39004881,   3844053810, 3385932262,
-            3677490580, 3194689531, 903512834,  2912073181, 2423302273, 2763438468, 3483407883,
-            2008578107, 4276493734, 3034081021, 1710621017, 1237150252, 158622339,  1032749876,
-            1117845372, 15750469,   3989926575, 3037782377, 862470781,  2260762748, 4080397000,
-            1566306447, 1770765049, 865562660,  3464194059, 79232127,   3837732369, 2021710304,
-            3952041839, 3827899638, 120454427,  2867901840, 3390140910, 1452600490, 525473769,
-            919903434,  489226920,  3054036799, 1232687517, 3964594583, 2116460683, 3573383851,
-            3969436228, 211896510,  2406007022, 2282757145, 3210931423, 2268876093, 1443890364,
-            438634096,  3937136814, 113338908,  1901012382, 2938181112, 729395380,  3818980378,
-            2774094387, 1497994998, 3973248544, 3426566986, 1263852852, 1007514207, 869494694,
-            2807158355, 3565172789, 2130722527, 2859935208, 2355661200, 2573274804, 1569944511,
-            1795617816, 3156749253, 945555512,  213788449,  1753359127, 4219749974, 1116982762,
-            4177729446, 2671142010, 708993393,  28016174,   1252773969, 844156307,  3996515143,
-            1881308188, 2431906096, 2515438590, 1580581766, 105772205,  139079530,  3193657975,
-            637279421,  606288963,  3726059612, 861202133,  1709422500, 326802093,  1230497269,
-            779050007,  2337446492, 4069110470, 320429814,  326872275,  372065666,  3500856829,
-            3334652495, 1712710322, 1562021486, 4175392666, 2788557068, 2350929547, 616751227,
-            815509703,  406508523,  1961290332, 3263007561, 888586100,  1669931989, 3848175103,
-            589830376,  752414733,  1629505408, 3654091005, 2172198775, 1199344360, 1799837956,
-            3670766947, 3928685206, 1752788033, 2370829792, 3473912241, 4050858743, 2388799090,
-            2398203633, 1108910673, 1664736959, 3417135398, 3795361859, 3040129737, 2314271211,
-            835946595,  1060548821, 1082662886, 3153933073, 2040863011, 2354634680, 18394405,
-            4095349234, 680686349,  3471104377, 3122617405, 3813501775, 3907535884, 1141958501,
-            2794249317, 3856183324, 2934624935, 1692587980, 39004881,   3844053810, 3385932262,
-            3634143427, 3194689531, 903512834,  2912073181, 2423302273, 1871077413, 3483407883,
-            2008578107, 4276493734, 3034081021, 754411795,  1237150252, 158622339,  1032749876,
-            1117845372, 3337559077, 3989926575, 3037782377, 862470781,  2260762748, 472225328,
-            1566306447, 1770765049, 865562660,  3464194059, 3012999068, 3837732369, 2021710304,
-            3952041839, 3827899638, 2424166932, 2867901840, 3390140910, 1452600490, 525473769,
-            1026670639, 489226920,  3054036799, 1232687517, 3964594583, 1083156465, 3573383851,
-            3969436228, 211896510,  2406007022, 1044076808, 3210931423, 2268876093, 1443890364,
-            438634096,  4002986935, 113338908,  1901012382, 2938181112, 729395380,  813093623,
-            2774094387, 1497994998, 3973248544, 3426566986, 1308544839, 1007514207, 869494694,
-            2807158355, 3565172789, 1219681521, 2859935208, 2355661200, 2573274804, 1569944511,
-            199584140,  3156749253, 945555512,  213788449,  1753359127, 2935749038, 1116982762,
-            4177729446, 2671142010, 708993393,  1293404624, 1252773969, 844156307,  3996515143,
-            1881308188, 3631350051, 2515438590, 1580581766, 105772205,  139079530,  733562188,
-            637279421,  606288963,  3726059612, 861202133,  2626500242, 326802093,  1230497269,
-            779050007,  2337446492, 164562509,  320429814,  326872275,  372065666,  3500856829,
-            901604401,  1712710322, 1562021486, 4175392666, 2788557068, 2330526569, 616751227,
-            815509703,  406508523,  1961290332, 326229298,  2562773114, 1864582824, 2763877685,
-            495260326,  1068051775, 868880732,  4181207182, 923453171,  3379439222, 1424913467,
-            1732256440, 3587433580, 909389263,  542803580,  3073979783, 3342119282, 2394110515,
-            703227923,  1281538750, 3209146940, 2490021127, 784356962,  2584766331, 3430884591,
-            1833139171, 322910511,  1330376970, 3105385069, 2908787956, 3915719648, 1488534594,
-            2342430178, 2602653267, 148499758,  2172564994, 3353716019, 698940625,  663777532,
-            168557685,  3766509085, 1485980454, 31753168,   3751787135, 1201349958, 1095430681,
-            486332355,  1303292022, 1843259322, 3227877333, 2965680775, 658344018,  942506172,
-            1562141188, 1120220149, 2782296190, 111484398,  1244162888, 2333561068, 2785303498,
-            385404828,  1033115450, 3693613950, 2098922507, 3649287976, 2234156313, 4013516878,
-            363449550,  2764210,    1695516272, 4169095920, 3501235941, 311007875,  3779021911,
-            1033239495, 2407795843, 87039114,   3360381223, 278759442,  3070321023, 3984835715,
-            208500459,  337901084,  2549150046, 724629105,  1983282023, 2815120399, 2080922501,
-            1454562278, 1914921962, 2606330761, 646324855,  2335575860, 925231359,  2010592338,
-            449432093,  1737224253, 315072731,  4043834823, 2615873788, 3705631303, 90669663,
-            903602301,  4122564274, 610586722,  2440202393, 255757601,  3324135975, 674295986,
-            294834316,  2212759798, 315802012,  992979702,  383965201,  2714186477, 2480570775,
-            1938635514, 2457895042, 3317825731, 2974054106, 3922600687, 2514825233, 2569740345,
-            1024422128, 3058284048, 3551709951, 4111578457, 3720467763, 2666788461, 316624692,
-            3649312155, 2206879362, 2712009591, 776266824,  2764522034, 3954365153, 1562743229,
-            1864271993, 2016956728, 2779851937, 3536907088, 1314774466, 1562855279, 342925978,
-            975175309,  1807005302, 1652273211, 1902309069, 1645822494, 1949566876, 2189187642,
-            3082894859, 3520388281, 2362331863, 1947286861, 2637039120, 398919033,  856024322,
-            60708293,   463767086,
-        },
-        {
-            220882755,  630187688,  2600079656, 3103815531, 4259457395, 306940008,  760977254,
-            558299017,  73879495,   2342545344, 572800511,  3922797738, 3754011306, 698257357,
-            1274843132, 1455757442, 1014649591, 3205662508, 2997738251, 613949432,  2267018388,
-            2925762681, 3702061213, 299380602,  1711070497, 4140032336, 4134705925, 2836703879,
-            3776863395, 507121465,  3480792188, 1862887216, 247780795,  2528677869, 2881446422,
-            271754977,  833498724,  1489102731, 3636156177, 1839744487, 2011839858, 2353400914,
-            510437606,  561141583,  2979592314, 3844268262, 3011027242, 3113817193, 3491178377,
-            1448376742, 2478683391, 2597550150, 699310968,  1979488062, 277591964,  1312002175,
-            168047351,  1826859926, 2030631355, 3097860388, 1950614326, 4070838751, 4454933,
-            1890661188, 3929835227, 1008498572, 3301557438, 3906313590, 1240635175, 280935563,
-            113509402,  226900299,  1246395851, 1220916742, 2651515540, 2058590162, 1983114332,
-            2040467861, 780818345,  544262576,  2826997265, 349354812,  2360120613, 1181324247,
-            2380347783, 3938729706, 1610628643, 2008635822, 2937909233, 1583978206, 3589167073,
-            1942470196, 402177406,  2636510744, 3709747478, 2428569572, 4071828137, 2880315633,
-            1433558231, 1137076031, 3833202201, 2378168250, 1412413704, 3349323744, 1740721660,
-            3155643175, 2580327273, 3020661883, 1658910832, 2065649368, 3277572880, 3795585437,
-            1266185861, 2925935368, 4147230645, 203577834,  2230529041, 2864778434, 270386174,
-            2867122465, 2676624544, 2035972330, 500973884,  2983028740, 117131866,  1456450936,
-            429171245,  3921563262, 342800398,  255116920,  1219580025, 1549741331, 3832317567,
-            3750096895, 4036554472, 4099775516, 1451717480, 149159438,  3593827664, 1406572509,
-            27774796,   1138983585, 1577536190, 978350835,  2704344602, 95204061,   1507155668,
-            304760810,  1981315657, 3139306913, 3908131532, 3767856445, 3851422551, 2018732047,
-            2474676116, 2745551516, 1585868430, 1125303733, 3147584753, 2368921260, 1524991519,
-            220882755,  630187688,  2600079656, 3103815531, 2671841243, 306940008,  760977254,
-            558299017,  73879495,   1196617651, 572800511,  3922797738, 3754011306, 698257357,
-            1982654891, 1455757442, 1014649591, 3205662508, 2997738251, 3769735713, 2267018388,
-            2925762681, 3702061213, 299380602,  2224634157, 4140032336, 4134705925, 2836703879,
-            3776863395, 1027030708, 3480792188, 1862887216, 247780795,  2528677869, 300214141,
-            271754977,  833498724,  1489102731, 3636156177, 1683033001, 2011839858, 2353400914,
-            510437606,  561141583,  2832813585, 3844268262, 3011027242, 3113817193, 3491178377,
-            316500941,  2478683391, 2597550150, 699310968,  1979488062, 4092049617, 1312002175,
-            168047351,  1826859926, 2030631355, 2797906491, 1950614326, 4070838751, 4454933,
-            1890661188, 2602196847, 1008498572, 3301557438, 3906313590, 1240635175, 946440664,
-            113509402,  226900299,  1246395851, 1220916742, 1314772486, 2058590162, 1983114332,
-            2040467861, 780818345,  3064382079, 2826997265, 349354812,  2360120613, 1181324247,
-            3434653713, 3938729706, 1610628643, 2008635822, 2937909233, 2815835447, 3589167073,
-            1942470196, 402177406,  2636510744, 865459039,  2428569572, 4071828137, 2880315633,
-            1433558231, 1582478959, 3833202201, 2378168250, 1412413704, 3349323744, 3686787615,
-            3155643175, 2580327273, 3020661883, 1658910832, 3152644489, 3277572880, 3795585437,
-            1266185861, 2925935368, 3101079227, 203577834,  2230529041, 2864778434, 270386174,
-            3024925346, 2676624544, 2035972330, 500973884,  2983028740, 974511421,  1456450936,
-            429171245,  3921563262, 342800398,  1540218139, 1219580025, 1549741331, 3832317567,
-            3750096895, 2195381148, 4099775516, 1451717480, 149159438,  3593827664, 3715984838,
-            27774796,   1138983585, 1577536190, 978350835,  2060213898, 95204061,   1507155668,
-            304760810,  1981315657, 774471092,  3908131532, 3767856445, 3851422551, 2018732047,
-            1649125731, 2745551516, 1585868430, 1125303733, 3147584753, 1661721342, 1524991519,
-            220882755,  630187688,  2600079656, 3647143842, 2671841243, 306940008,  760977254,
-            558299017,  3406011854, 1196617651, 572800511,  3922797738, 3754011306, 2314291278,
-            1982654891, 1455757442, 1014649591, 3205662508, 3471741326, 3769735713, 2267018388,
-            2925762681, 3702061213, 1593850639, 2224634157, 4140032336, 4134705925, 2836703879,
-            3918266498, 1027030708, 3480792188, 1862887216, 247780795,  3383776045, 300214141,
-            271754977,  833498724,  1489102731, 2477093804, 1683033001, 2011839858, 2353400914,
-            510437606,  2361664959, 2832813585, 3844268262, 3011027242, 3113817193, 1468705704,
-            316500941,  2478683391, 2597550150, 699310968,  1593029686, 4092049617, 1312002175,
-            168047351,  1826859926, 3922295193, 2797906491, 1950614326, 4070838751, 4454933,
-            485374579,  2602196847, 1008498572, 3301557438, 3906313590, 2102043683, 946440664,
-            113509402,  226900299,  1246395851, 2635764090, 1314772486, 2058590162, 1983114332,
-            2040467861, 354791,     3064382079, 2826997265, 349354812,  2360120613, 2126504772,
-            3434653713, 3938729706, 1610628643, 2008635822, 2400061949, 2815835447, 3589167073,
-            1942470196, 402177406,  806469309,  865459039,  2428569572, 4071828137, 2880315633,
-            2512200928, 1582478959, 3833202201, 2378168250, 1412413704, 2767451252, 3686787615,
-            3155643175, 2580327273, 3020661883, 1040874588, 3152644489, 3277572880, 3795585437,
-            1266185861, 238446394,  3101079227, 203577834,  2230529041, 2864778434, 653319712,
-            3024925346, 2676624544, 2035972330, 500973884,  3839534784, 974511421,  1456450936,
-            429171245,  3921563262, 602320448,  1540218139, 1219580025, 1549741331, 3832317567,
-            1068872823, 2195381148, 4099775516, 1451717480, 149159438,  1699607068, 3715984838,
-            27774796,   1138983585, 1577536190, 837921790,  2060213898, 95204061,   1507155668,
-            304760810,  1446133066, 774471092,  3908131532, 3767856445, 3851422551, 2672625648,
-            1649125731, 2745551516, 1585868430, 1125303733, 2181520384, 1661721342, 1524991519,
-            220882755,  630187688,  1599074811, 3647143842, 2671841243, 306940008,  760977254,
-            3020017536, 3406011854, 1196617651, 572800511,  3922797738, 810584907,  2314291278,
-            1982654891, 1455757442, 1014649591, 1775783567, 3471741326, 3769735713, 2267018388,
-            2925762681, 319055602,  1593850639, 2224634157, 4140032336, 4134705925, 2794599326,
-            3918266498, 1027030708, 3480792188, 1862887216, 659607854,  3383776045, 300214141,
-            271754977,  833498724,  4054679386, 2477093804, 1683033001, 2011839858, 2353400914,
-            283191425,  2361664959, 2832813585, 3844268262, 3011027242, 137688840,  1468705704,
-            316500941,  2478683391, 2597550150, 1468220070, 1593029686, 4092049617, 1312002175,
-            168047351,  1602414610, 3922295193, 2797906491, 1950614326, 4070838751, 3858763082,
-            485374579,  2602196847, 1008498572, 3301557438, 2719858709, 2102043683, 946440664,
-            113509402,  226900299,  798285817,  2635764090, 1314772486, 2058590162, 1983114332,
-            2526463430, 354791,     3064382079, 2826997265, 349354812,  249430921,  2126504772,
-            3434653713, 3938729706, 1610628643, 967431506,  2400061949, 2815835447, 3589167073,
-            1942470196, 669129162,  806469309,  865459039,  2428569572, 4071828137, 3447449944,
-            2512200928, 1582478959, 3833202201, 2378168250, 1945768856, 2767451252, 3686787615,
-            3155643175, 2580327273, 2905624117, 1040874588, 3152644489, 3277572880, 3795585437,
-            3869959934, 238446394,  3101079227, 203577834,  2230529041, 1087760616, 653319712,
-            3024925346, 2676624544, 2035972330, 741014356,  3839534784, 974511421,  1456450936,
-            429171245,  598362053,  602320448,  1540218139, 1219580025, 1549741331, 401740328,
-            1068872823, 2195381148, 4099775516, 1451717480, 412110161,  1699607068, 3715984838,
-            27774796,   1138983585, 1531670562, 837921790,  2060213898, 95204061,   1507155668,
-            90279751,   1446133066, 774471092,  3908131532, 3767856445, 1136546910, 2672625648,
-            1649125731, 2745551516, 1585868430, 857721974,  1470900829, 64550776,   3252081369,
-            1649342279, 378546910,  3444980597, 3134750739, 1010105258, 1395608241, 1003208120,
-            3960524028, 3200241620, 3079969898, 1508044775, 4153769914, 2838198142, 773928818,
-            25836261,   3812652461, 3870603819, 931071963,  2565579710, 2930918109, 1091097445,
-            2223628368, 2934719684, 430797922,  2102409587, 720592077,  1675280068, 2578226918,
-            1316600845, 3427946098, 682896800,  1861125007, 251332674,  1502078012, 3020904394,
-            1458399451, 3088315263, 1635399147, 3605560130, 1755669804, 3754169290, 962708070,
-            3896576937, 3764679740, 2707457262, 3082551065, 1558451132, 1046028905, 3206335691,
-            731828142,  1765772975, 1195727587, 2664218451, 4234957963, 4073757168, 3230123616,
-            683981262,  607599877,  3659273671, 3230354324, 3393069074, 3250708814, 2229361194,
-            3923623619, 4093221649, 2441971643, 1787414237, 3603907850, 2254399656, 3508336126,
-            3578571587, 2383062806, 1012097006, 4250629546, 2086981615, 4190388250, 1399942361,
-            400707931,  3159618664, 2129750192, 911779896,  2736829998, 1909644954, 2168355517,
-            1583901478, 3468891177, 509297602,  769296769,  1865028750, 43276967,   3375387845,
-            2647467777, 1544731454, 3479333955, 4279441447, 485490313,  3523606596, 2880752852,
-            1946443431, 3760803481, 3115278477, 3693898557, 2387822435, 334412170,  2054111717,
-            269013084,  170401553,  3456013554, 3395842846, 508189059,  3398715186, 3862791669,
-            2741070272, 65318715,   1933435210, 4086198650, 3033193928, 1242412691, 3397363281,
-            3187419149, 1019508117, 562380742,  961415837,  2990412400, 3597720222, 2754100415,
-            1793508822, 966564784,  1875616532, 394646945,  1386107842, 2750810827, 2931007937,
-            3356489930, 2358364634, 3703772713, 3188884403, 2793590498, 3285138686, 515002680,
-            521510516,  887213583,  1873460781, 1583027667, 613895001,  557578628,  1892686243,
-            1974572772, 595831726,  229299738,  3847982294, 448248098,  1493822844, 3326405260,
-            2752463855, 128616819,
-        },
-        {
-            1389391119, 3181525936, 4149536000, 263244710,  1259917919, 2464880859, 768536415,
-            3429592524, 1156616077, 4055628361, 1704479137, 1158147668, 2128295916, 885175419,
-            933663950,  1831413569, 2462524755, 1597395366, 2108588036, 2370054601, 705732047,
-            77056661,   3921871790, 2207568312, 3349449825, 3336829202, 1672695745, 1371859990,
-            4242319595, 1254180189, 3998317669, 3969441264, 4131405488, 444986851,  937540495,
-            130910465,  211193059,  1929925103, 1901330638, 4272800983, 573512071,  4137673314,
-            3005923275, 1870742312, 4290184169, 3351776475, 2422699780, 1775440709, 3475187841,
-            3664929747, 2497288840, 1236856789, 1703791232, 656249387,  87772365,   1897537809,
-            1289037268, 1297789070, 2324218622, 3989792066, 784500268,  4177432870, 1049683274,
-            4207461910, 2296823426, 2311471587, 1831763608, 798609688,  3892714882, 3415944146,
-            999089616,  2569556494, 517148228,  798656586,  2174772843, 1204967129, 1364947624,
-            3484177841, 453255942,  1742380721, 1580851468, 3095132333, 3482166016, 4073686620,
-            2738551967, 3251877929, 1116902202, 2611180271, 2690687171, 2834877571, 3063924476,
-            3068416091, 2105211402, 3764615980, 2666297242, 3749239986, 3659553403, 3529511628,
-            2157622219, 744734023,  1637305853, 431927436,  2151091568, 3623425557, 180586509,
-            4012038153, 3291898175, 4008156512, 1608477005, 4089641813, 3438569096, 50528742,
-            1884664255, 93972314,   3045221134, 753178598,  2170223001, 419911463,  2316002644,
-            913508168,  1626519005, 2095637439, 1091971529, 215687754,  3246238956, 3541336163,
-            2174774851, 3042121450, 3678830456, 3693619331, 1569260153, 258284483,  1438653255,
-            2121973835, 920179972,  403706966,  2762976457, 2040982931, 201871201,  1620459035,
-            3710784265, 4238859286, 1109118477, 4227994160, 3447596014, 4064930769, 3171785728,
-            1673076378, 3422455718, 679200924,  98251572,   346334109,  1878703671, 4149948335,
-            1154462968, 1806795879, 1001900341, 1709785278, 2476633029, 1627150128, 2001699129,
-            1389391119, 3181525936, 4149536000, 263244710,  2332112549, 2464880859, 768536415,
-            3429592524, 1156616077, 4224246787, 1704479137, 1158147668, 2128295916, 885175419,
-            510101193,  1831413569, 2462524755, 1597395366, 2108588036, 4010868076, 705732047,
-            77056661,   3921871790, 2207568312, 554598743,  3336829202, 1672695745, 1371859990,
-            4242319595, 2840018885, 3998317669, 3969441264, 4131405488, 444986851,  1830854585,
-            130910465,  211193059,  1929925103, 1901330638, 3759679436, 573512071,  4137673314,
-            3005923275, 1870742312, 1317077351, 3351776475, 2422699780, 1775440709, 3475187841,
-            1055846338, 2497288840, 1236856789, 1703791232, 656249387,  2647367621, 1897537809,
-            1289037268, 1297789070, 2324218622, 2447898074, 784500268,  4177432870, 1049683274,
-            4207461910, 2988669717, 2311471587, 1831763608, 798609688,  3892714882, 1039304601,
-            999089616,  2569556494, 517148228,  798656586,  1349491803, 1204967129, 1364947624,
-            3484177841, 453255942,  603614891,  1580851468, 3095132333, 3482166016, 4073686620,
-            3362462143, 3251877929, 1116902202, 2611180271, 2690687171, 3971608130, 3063924476,
-            3068416091, 2105211402, 3764615980, 2084467386, 3749239986, 3659553403, 3529511628,
-            2157622219, 2115956383, 1637305853, 431927436,  2151091568, 3623425557, 1064881717,
-            4012038153, 3291898175, 4008156512, 1608477005, 1241759600, 3438569096, 50528742,
-            1884664255, 93972314,   3305429957, 753178598,  2170223001, 419911463,  2316002644,
-            1017853,    1626519005, 2095637439, 1091971529, 215687754,  3198975966, 3541336163,
-            2174774851, 3042121450, 3678830456, 3073897403, 1569260153, 258284483,  1438653255,
-            2121973835, 3060609400, 403706966,  2762976457, 2040982931, 201871201,  1089906594,
-            3710784265, 4238859286, 1109118477, 4227994160, 4131996615, 4064930769, 3171785728,
-            1673076378, 3422455718, 2603100699, 98251572,   346334109,  1878703671, 4149948335,
-            2651018537, 1806795879, 1001900341, 1709785278, 2476633029, 1669848360, 2001699129,
-            1389391119, 3181525936, 4149536000, 4214170316, 2332112549, 2464880859, 768536415,
-            3429592524, 2972520689, 4224246787, 1704479137, 1158147668, 2128295916, 2514244146,
-            510101193,  1831413569, 2462524755, 1597395366, 2387533890, 4010868076, 705732047,
-            77056661,   3921871790, 1942146908, 554598743,  3336829202, 1672695745, 1371859990,
-            2895850132, 2840018885, 3998317669, 3969441264, 4131405488, 3630105689, 1830854585,
-            130910465,  211193059,  1929925103, 1207959614, 3759679436, 573512071,  4137673314,
-            3005923275, 3741267802, 1317077351, 3351776475, 2422699780, 1775440709, 3351894497,
-            1055846338, 2497288840, 1236856789, 1703791232, 225818730,  2647367621, 1897537809,
-            1289037268, 1297789070, 473788688,  2447898074, 784500268,  4177432870, 1049683274,
-            3713306823, 2988669717, 2311471587, 1831763608, 798609688,  2418075592, 1039304601,
-            999089616,  2569556494, 517148228,  494565915,  1349491803, 1204967129, 1364947624,
-            3484177841, 1455843695, 603614891,  1580851468, 3095132333, 3482166016, 1726602384,
-            3362462143, 3251877929, 1116902202, 2611180271, 4168188072, 3971608130, 3063924476,
-            3068416091, 2105211402, 621938126,  2084467386, 3749239986, 3659553403, 3529511628,
-            4034375638, 2115956383, 1637305853, 431927436,  2151091568, 1003231260, 1064881717,
-            4012038153, 3291898175, 4008156512, 3938603203, 1241759600, 3438569096, 50528742,
-            1884664255, 24488619,   3305429957, 753178598,  2170223001, 419911463,  986791316,
-            1017853,    1626519005, 2095637439, 1091971529, 3736076914, 3198975966, 3541336163,
-            2174774851, 3042121450, 3904430661, 3073897403, 1569260153, 258284483,  1438653255,
-            1218033816, 3060609400, 403706966,  2762976457, 2040982931, 1859566307, 1089906594,
-            3710784265, 4238859286, 1109118477, 1805970117, 4131996615, 4064930769, 3171785728,
-            1673076378, 3825719370, 2603100699, 98251572,   346334109,  1878703671, 2043943412,
-            2651018537, 1806795879, 1001900341, 1709785278, 1794172394, 1669848360, 2001699129,
-            1389391119, 3181525936, 3694404651, 4214170316, 2332112549, 2464880859, 768536415,
-            3777700725, 2972520689, 4224246787, 1704479137, 1158147668, 2158749436, 2514244146,
-            510101193,  1831413569, 2462524755, 2094209460, 2387533890, 4010868076, 705732047,
-            77056661,   110688100,  1942146908, 554598743,  3336829202, 1672695745, 1492180223,
-            2895850132, 2840018885, 3998317669, 3969441264, 1910193850, 3630105689, 1830854585,
-            130910465,  211193059,  486075897,  1207959614, 3759679436, 573512071,  4137673314,
-            2291712819, 3741267802, 1317077351, 3351776475, 2422699780, 1897990825, 3351894497,
-            1055846338, 2497288840, 1236856789, 1348227896, 225818730,  2647367621, 1897537809,
-            1289037268, 4180770128, 473788688,  2447898074, 784500268,  4177432870, 2790893568,
-            3713306823, 2988669717, 2311471587, 1831763608, 252820178,  2418075592, 1039304601,
-            999089616,  2569556494, 1634100115, 494565915,  1349491803, 1204967129, 1364947624,
-            2365131811, 1455843695, 603614891,  1580851468, 3095132333, 2361802307, 1726602384,
-            3362462143, 3251877929, 1116902202, 2086588697, 4168188072, 3971608130, 3063924476,
-            3068416091, 3036432590, 621938126,  2084467386, 3749239986, 3659553403, 3447592634,
-            4034375638, 2115956383, 1637305853, 431927436,  3770536238, 1003231260, 1064881717,
-            4012038153, 3291898175, 843980102,  3938603203, 1241759600, 3438569096, 50528742,
-            1673425224, 24488619,   3305429957, 753178598,  2170223001, 2378153815, 986791316,
-            1017853,    1626519005, 2095637439, 488031545,  3736076914, 3198975966, 3541336163,
-            2174774851, 2062151567, 3904430661, 3073897403, 1569260153, 258284483,  2755737336,
-            1218033816, 3060609400, 403706966,  2762976457, 620794913,  1859566307, 1089906594,
-            3710784265, 4238859286, 82038072,   1805970117, 4131996615, 4064930769, 3171785728,
-            362183917,  3825719370, 2603100699, 98251572,   346334109,  1328232542, 2043943412,
-            2651018537, 1806795879, 1001900341, 2425642830, 3174051565, 1114291042, 1042527558,
-            3895644168, 758539518,  1248119789, 1306161348, 1966827289, 3624648051, 16288673,
-            2249172513, 153812809,  2223021392, 3908927645, 4166868549, 260076749,  844660884,
-            4164869057, 269080979,  1196725321, 2631747751, 184979229,  2227243073, 3814515351,
-            3144059704, 4237400549, 3017810296, 1071366833, 3355000364, 1742474997, 1040730521,
-            1986168346, 166024300,  3415481439, 2004274292, 2818877035, 3556892060, 2233345299,
-            3632571935, 2807743834, 429205496,  1624734256, 1301116697, 3403362312, 1097852345,
-            1018394561, 2905957022, 1052837263, 2732709659, 19176339,   3841058071, 3602967987,
-            740308054,  3617853400, 2930332837, 2757394350, 1010788150, 1515653645, 992046248,
-            2721517403, 826433014,  3443665637, 2776194710, 3367534326, 4114895179, 1333338629,
-            3715458678, 1541987919, 1294345165, 2499048493, 4126724421, 3289265703, 1868407046,
-            810472908,  1521449011, 2500894962, 4221825790, 275531700,  1908862400, 1782853629,
-            3762095619, 4191977897, 1124312652, 3971361745, 476371790,  1331221684, 884917036,
-            2668149857, 3883109731, 1847402426, 2715156650, 2527137976, 1688178970, 1335801252,
-            2933504850, 1942562839, 3147835665, 645463213,  2570601705, 109061597,  1328017093,
-            2569357646, 4052511889, 3798346171, 3757715897, 487574280,  1675454194, 3114830123,
-            405566381,  3012939273, 3473313978, 512192480,  2644435522, 3517047527, 1777130379,
-            3984262344, 3789989638, 1614308598, 3323226721, 2228870562, 645204061,  381143872,
-            1920796887, 918314690,  575155103,  1159640550, 3842843116, 1319510671, 2130484630,
-            1323123701, 994291609,  3373937362, 2160813613, 3096242443, 3878268427, 233310565,
-            1155143733, 2328402289, 1956931634, 789801640,  169082505,  1690649706, 607380424,
-            4179488961, 2051038016, 2124650104, 352812221,  3813556090, 285725867,  259458019,
-            450985742,  4276528964, 1708035423, 1612037739, 1317048726, 28027336,   2021634108,
-            3866944789, 2379047282,
-        },
-        {
-            2014765631, 3938779303, 1811986049, 2101875601, 887194972,  3966228860, 3450775746,
-            4026039255, 4082308025, 432404123,  3181099213, 1228097256, 2368258457, 2953933351,
-            2582232464, 1657799516, 3525421629, 3927364159, 978138132,  3603597064, 342571522,
-            2100072168, 676229632,  2062864895, 3713317279, 4255773013, 1179492389, 3501226604,
-            1641801113, 2066614519, 3303232023, 1717768923, 2333501450, 4246883128, 1655087824,
-            1547897374, 754215285,  2832638094, 1365153701, 3309513970, 765738141,  1177808869,
-            324127419,  1171195868, 3494966448, 1714410667, 3645762436, 603810292,  489970006,
-            3126166124, 1616642501, 2646836239, 734727001,  118064420,  1164195304, 3692353914,
-            2267623847, 405457397,  2510437259, 3245015882, 2110859730, 967046702,  265790493,
-            3007163818, 3178475505, 1784447992, 3662964942, 1509963062, 1867864652, 1377871790,
-            4185567242, 657897796,  1762205546, 3895944199, 693988565,  2359023506, 1667660316,
-            478341078,  1898651054, 2352226314, 202416031,  855532642,  2290137962, 1573485803,
-            3675269487, 2346740592, 3111005795, 1741227661, 1222572879, 2176146608, 1595608675,
-            197451178,  1729118168, 876472937,  3201705210, 2315408645, 699968623,  2185639066,
-            3960900430, 539499973,  4226318752, 266371152,  2714506838, 945022093,  1378798863,
-            1925020181, 574417318,  1341455098, 3664225722, 3020780778, 3256613994, 2081255019,
-            3082744844, 3572803922, 1726854692, 1167777002, 557257486,  3577067012, 3806913480,
-            1578577194, 2631896730, 3937479909, 826138924,  670145071,  832017019,  715875283,
-            2008704579, 804955545,  4184114494, 867004874,  3586861289, 1190193155, 3288754776,
-            2271906590, 2007547109, 2206084232, 1621944575, 973990634,  3981493346, 1972746975,
-            1040348653, 2895228417, 691038334,  775610724,  3837025597, 714850057,  2912426839,
-            774555258,  3553866253, 2096154755, 1645117543, 3401470072, 2056183169, 2029528044,
-            3145728013, 1090530001, 49523828,   2228313334, 4013648604, 4289025873, 2749397923,
-            2014765631, 3938779303, 1811986049, 2101875601, 1575247143, 3966228860, 3450775746,
-            4026039255, 4082308025, 532118065,  3181099213, 1228097256, 2368258457, 2953933351,
-            896129082,  1657799516, 3525421629, 3927364159, 978138132,  3403930517, 342571522,
-            2100072168, 676229632,  2062864895, 38934050,   4255773013, 1179492389, 3501226604,
-            1641801113, 4195983797, 3303232023, 1717768923, 2333501450, 4246883128, 2854551758,
-            1547897374, 754215285,  2832638094, 1365153701, 1406220165, 765738141,  1177808869,
-            324127419,  1171195868, 625985592,  1714410667, 3645762436, 603810292,  489970006,
-            344948229,  1616642501, 2646836239, 734727001,  118064420,  3360380275, 3692353914,
-            2267623847, 405457397,  2510437259, 3697919521, 2110859730, 967046702,  265790493,
-            3007163818, 1395299303, 1784447992, 3662964942, 1509963062, 1867864652, 849544728,
-            4185567242, 657897796,  1762205546, 3895944199, 1219998053, 2359023506, 1667660316,
-            478341078,  1898651054, 943166064,  202416031,  855532642,  2290137962, 1573485803,
-            4238971908, 2346740592, 3111005795, 1741227661, 1222572879, 2670048596, 1595608675,
-            197451178,  1729118168, 876472937,  94688481,   2315408645, 699968623,  2185639066,
-            3960900430, 1224638706, 4226318752, 266371152,  2714506838, 945022093,  2683523818,
-            1925020181, 574417318,  1341455098, 3664225722, 1168593559, 3256613994, 2081255019,
-            3082744844, 3572803922, 2816021735, 1167777002, 557257486,  3577067012, 3806913480,
-            740433434,  2631896730, 3937479909, 826138924,  670145071,  4127240538, 715875283,
-            2008704579, 804955545,  4184114494, 1692532062, 3586861289, 1190193155, 3288754776,
-            2271906590, 922306057,  2206084232, 1621944575, 973990634,  3981493346, 3555073644,
-            1040348653, 2895228417, 691038334,  775610724,  1798939042, 714850057,  2912426839,
-            774555258,  3553866253, 4209859609, 1645117543, 3401470072, 2056183169, 2029528044,
-            2169159734, 1090530001, 49523828,   2228313334, 4013648604, 1499948031, 2749397923,
-            2014765631, 3938779303, 1811986049, 2169095159, 1575247143, 3966228860, 3450775746,
-            4026039255, 1220311069, 532118065,  3181099213, 1228097256, 2368258457, 649921441,
-            896129082,  1657799516, 3525421629, 3927364159, 2546335470, 3403930517, 342571522,
-            2100072168, 676229632,  3090148374, 38934050,   4255773013, 1179492389, 3501226604,
-            2613176152, 4195983797, 3303232023, 1717768923, 2333501450, 3923041739, 2854551758,
-            1547897374, 754215285,  2832638094, 731392091,  1406220165, 765738141,  1177808869,
-            324127419,  12876722,   625985592,  1714410667, 3645762436, 603810292,  2789313462,
-            344948229,  1616642501, 2646836239, 734727001,  3369486664, 3360380275, 3692353914,
-            2267623847, 405457397,  4284067044, 3697919521, 2110859730, 967046702,  265790493,
-            2779045063, 1395299303, 1784447992, 3662964942, 1509963062, 3233239196, 849544728,
-            4185567242, 657897796,  1762205546, 2086953994, 1219998053, 2359023506, 1667660316,
-            478341078,  4137166515, 943166064,  202416031,  855532642,  2290137962, 1053737970,
-            4238971908, 2346740592, 3111005795, 1741227661, 3570501235, 2670048596, 1595608675,
-            197451178,  1729118168, 4162077327, 94688481,   2315408645, 699968623,  2185639066,
-            2842562270, 1224638706, 4226318752, 266371152,  2714506838, 755620309,  2683523818,
-            1925020181, 574417318,  1341455098, 3323621213, 1168593559, 3256613994, 2081255019,
-            3082744844, 3845230416, 2816021735, 1167777002, 557257486,  3577067012, 66225918,
-            740433434,  2631896730, 3937479909, 826138924,  522548622,  4127240538, 715875283,
-            2008704579, 804955545,  22190845,   1692532062, 3586861289, 1190193155, 3288754776,
-            610751818,  922306057,  2206084232, 1621944575, 973990634,  1771882567, 3555073644,
-            1040348653, 2895228417, 691038334,  149995790,  1798939042, 714850057,  2912426839,
-            774555258,  2020442761, 4209859609, 1645117543, 3401470072, 2056183169, 460813741,
-            2169159734, 1090530001, 49523828,   2228313334, 504317288,  1499948031, 2749397923,
-            2014765631, 3938779303, 1175469033, 2169095159, 1575247143, 3966228860, 3450775746,
-            1032079910, 1220311069, 532118065,  3181099213, 1228097256, 3353583885, 649921441,
-            896129082,  1657799516, 3525421629, 2830418357, 2546335470, 3403930517, 342571522,
-            2100072168, 1099053459, 3090148374, 38934050,   4255773013, 1179492389, 1634035942,
-            2613176152, 4195983797, 3303232023, 1717768923, 4175785502, 3923041739, 2854551758,
-            1547897374, 754215285,  3674851127, 731392091,  1406220165, 765738141,  1177808869,
-            776475327,  12876722,   625985592,  1714410667, 3645762436, 759189800,  2789313462,
-            344948229,  1616642501, 2646836239, 1228911282, 3369486664, 3360380275, 3692353914,
-            2267623847, 3058856811, 4284067044, 3697919521, 2110859730, 967046702,  3601311392,
-            2779045063, 1395299303, 1784447992, 3662964942, 284169442,  3233239196, 849544728,
-            4185567242, 657897796,  905886381,  2086953994, 1219998053, 2359023506, 1667660316,
-            2784311626, 4137166515, 943166064,  202416031,  855532642,  895862877,  1053737970,
-            4238971908, 2346740592, 3111005795, 1509264114, 3570501235, 2670048596, 1595608675,
-            197451178,  3653040124, 4162077327, 94688481,   2315408645, 699968623,  1071988392,
-            2842562270, 1224638706, 4226318752, 266371152,  4214356293, 755620309,  2683523818,
-            1925020181, 574417318,  119162126,  3323621213, 1168593559, 3256613994, 2081255019,
-            1317924999, 3845230416, 2816021735, 1167777002, 557257486,  638058809,  66225918,
-            740433434,  2631896730, 3937479909, 411228024,  522548622,  4127240538, 715875283,
-            2008704579, 2246049355, 22190845,   1692532062, 3586861289, 1190193155, 4078828073,
-            610751818,  922306057,  2206084232, 1621944575, 907181435,  1771882567, 3555073644,
-            1040348653, 2895228417, 940846326,  149995790,  1798939042, 714850057,  2912426839,
-            3345560812, 2020442761, 4209859609, 1645117543, 3401470072, 2036328600, 460813741,
-            2169159734, 1090530001, 49523828,   510136795,  2233313725, 1046048857, 700202384,
-            926275751,  4104982908, 3910999868, 1125213128, 492681420,  3891914731, 956545470,
-            115696875,  2957144177, 77090391,   467732901,  2599813105, 3888976883, 2098926023,
-            2844817051, 2069408123, 2239429902, 3793992219, 3020240490, 1721698056, 3012473888,
-            1537226153, 725991171,  61376035,   381912667,  3904514327, 40015731,   4263210119,
-            2876064791, 2732785471, 2934318283, 3134934287, 3161129365, 3789733734, 2954419388,
-            2742205850, 3488450208, 3252908703, 410643191,  3246033194, 2846558783, 828879673,
-            2428687670, 389617242,  63987225,   439842832,  2635895570, 3468152776, 4086700701,
-            3370617315, 2400127386, 4266992260, 3026019128, 4225721108, 1328114488, 2808680961,
-            3574018824, 4060262451, 2329039960, 1165344648, 3635963149, 2414703792, 2269100254,
-            832995451,  2143875746, 1031309981, 2129333746, 2606784227, 805236091,  666141116,
-            2749351381, 53998350,   2270447972, 2092784991, 877961283,  3019419608, 2438459472,
-            2273921167, 332279281,  3759993687, 2465113760, 3732237006, 322823266,  491053374,
-            686619591,  4192648122, 4118497267, 1948902148, 988375775,  2098328675, 3107501958,
-            2979856583, 2274193457, 6179961,    188209161,  1491245003, 3005972885, 1658799053,
-            3420802262, 2128792168, 3272743598, 4163716849, 817350318,  3372322557, 1525295885,
-            490587460,  3634834949, 2584809384, 3638373352, 2603765126, 3223396315, 4021061386,
-            2143780551, 248332433,  3654752967, 27201989,   3994156272, 5505477,    4260955724,
-            1175998822, 2665646240, 866875674,  3569324422, 202962714,  896177244,  3146417201,
-            1168925859, 2228636445, 105395449,  2567482935, 1301265751, 3739617610, 2486939910,
-            1891847857, 2647840744, 1141826566, 3360553996, 4267671927, 2546157872, 1143297884,
-            2049385137, 4288036836, 3347190546, 3480408604, 2756408254, 2396048567, 1151717877,
-            2211243289, 4221659024, 21773193,   1665317870, 3116384869, 3231689469, 3689471824,
-            1520574310, 463615415,
-        },
-        {
-            2872582799, 2126482280, 1097839927, 2195122034, 3432204538, 2054977701, 3008162088,
-            2639895513, 1642522268, 3018067284, 1312015181, 2975592532, 1942227152, 4012902247,
-            2614958943, 603750646,  1692448645, 4214006021, 1766548926, 3368260612, 917232349,
-            1830840788, 2023930487, 1483595080, 3441752155, 2080242129, 1711150666, 916538923,
-            570770453,  3691863148, 477922265,  1567604675, 1932027661, 2971496735, 3885758659,
-            2575659217, 3239311831, 2473330246, 1114232553, 3492102366, 3562612585, 1158829342,
-            473252764,  2078825715, 3218444729, 4242950736, 507113371,  396619998,  2303123414,
-            486829580,  3601631698, 141971783,  2519544253, 2347162362, 2629089605, 2152908819,
-            3920831873, 2180925141, 1664108738, 3894760831, 710420381,  1614148322, 1516157847,
-            1748204161, 1942894196, 2174697423, 2096052992, 3245885798, 1885494447, 4088405430,
-            3342202804, 1421924156, 1227696457, 4134707928, 2416067650, 1652499078, 2073323446,
-            1860189109, 3951817908, 3806328261, 315841614,  1167654396, 1075178962, 514167959,
-            2693287005, 1438371976, 4151083092, 4251796122, 4282013650, 900263121,  3385783362,
-            2685639772, 1473688576, 477494228,  362813355,  720367987,  1292116385, 4063338350,
-            4025092782, 2497238154, 2711393754, 2504770707, 3268425804, 3798735378, 3490578883,
-            1533001481, 731639818,  1496622888, 3353335896, 1999174380, 3526754374, 1319337437,
-            750318392,  3725785240, 4069468337, 763325185,  4051345282, 1150909863, 1397871709,
-            980885426,  1853858913, 2752650647, 651553945,  2515405043, 2198790694, 519534978,
-            1863925267, 2630611858, 373117438,  2785903739, 2787396201, 3820838073, 3662615151,
-            3575481021, 112478845,  706249248,  2911461152, 2876487471, 1723729953, 125393228,
-            3356340402, 94465354,   4144428207, 3724281367, 554648399,  3549553313, 355115131,
-            1766908721, 2156376577, 2966704925, 929118324,  4230182526, 4129773994, 3728890332,
-            117922671,  323175980,  574829868,  1370311172, 1101097543, 1290826305, 3878536735,
-            2872582799, 2126482280, 1097839927, 2195122034, 2632144074, 2054977701, 3008162088,
-            2639895513, 1642522268, 1682536501, 1312015181, 2975592532, 1942227152, 4012902247,
-            3665266631, 603750646,  1692448645, 4214006021, 1766548926, 3241970795, 917232349,
-            1830840788, 2023930487, 1483595080, 2443381369, 2080242129, 1711150666, 916538923,
-            570770453,  4255565434, 477922265,  1567604675, 1932027661, 2971496735, 1884885838,
-            2575659217, 3239311831, 2473330246, 1114232553, 3978297784, 3562612585, 1158829342,
-            473252764,  2078825715, 3436274503, 4242950736, 507113371,  396619998,  2303123414,
-            3045629124, 3601631698, 141971783,  2519544253, 2347162362, 1968783196, 2152908819,
-            3920831873, 2180925141, 1664108738, 1822304726, 710420381,  1614148322, 1516157847,
-            1748204161, 2836877868, 2174697423, 2096052992, 3245885798, 1885494447, 3426243181,
-            3342202804, 1421924156, 1227696457, 4134707928, 1941189849, 1652499078, 2073323446,
-            1860189109, 3951817908, 4028972871, 315841614,  1167654396, 1075178962, 514167959,
-            334011179,  1438371976, 4151083092, 4251796122, 4282013650, 2637493230, 3385783362,
-            2685639772, 1473688576, 477494228,  2839429989, 720367987,  1292116385, 4063338350,
-            4025092782, 260121049,  2711393754, 2504770707, 3268425804, 3798735378, 2617737840,
-            1533001481, 731639818,  1496622888, 3353335896, 2624754566, 3526754374, 1319337437,
-            750318392,  3725785240, 4134822587, 763325185,  4051345282, 1150909863, 1397871709,
-            4187598979, 1853858913, 2752650647, 651553945,  2515405043, 1485024636, 519534978,
-            1863925267, 2630611858, 373117438,  1742280896, 2787396201, 3820838073, 3662615151,
-            3575481021, 3408434211, 706249248,  2911461152, 2876487471, 1723729953, 3558087349,
-            3356340402, 94465354,   4144428207, 3724281367, 321689936,  3549553313, 355115131,
-            1766908721, 2156376577, 283511019,  929118324,  4230182526, 4129773994, 3728890332,
-            245074365,  323175980,  574829868,  1370311172, 1101097543, 1515506710, 3878536735,
-            2872582799, 2126482280, 1097839927, 3554974147, 2632144074, 2054977701, 3008162088,
-            2639895513, 2140117105, 1682536501, 1312015181, 2975592532, 1942227152, 434349342,
-            3665266631, 603750646,  1692448645, 4214006021, 3028510289, 3241970795, 917232349,
-            1830840788, 2023930487, 3994386333, 2443381369, 2080242129, 1711150666, 916538923,
-            1081232946, 4255565434, 477922265,  1567604675, 1932027661, 1325166673, 1884885838,
-            2575659217, 3239311831, 2473330246, 2959136644, 3978297784, 3562612585, 1158829342,
-            473252764,  2204978463, 3436274503, 4242950736, 507113371,  396619998,  577539236,
-            3045629124, 3601631698, 141971783,  2519544253, 1166529585, 1968783196, 2152908819,
-            3920831873, 2180925141, 1755848744, 1822304726, 710420381,  1614148322, 1516157847,
-            2101040249, 2836877868, 2174697423, 2096052992, 3245885798, 476313395,  3426243181,
-            3342202804, 1421924156, 1227696457, 3782851827, 1941189849, 1652499078, 2073323446,
-            1860189109, 4152053718, 4028972871, 315841614,  1167654396, 1075178962, 2516665631,
-            334011179,  1438371976, 4151083092, 4251796122, 3680502874, 2637493230, 3385783362,
-            2685639772, 1473688576, 3707875967, 2839429989, 720367987,  1292116385, 4063338350,
-            3374455645, 260121049,  2711393754, 2504770707, 3268425804, 3374998463, 2617737840,
-            1533001481, 731639818,  1496622888, 3744024191, 2624754566, 3526754374, 1319337437,
-            750318392,  4156827474, 4134822587, 763325185,  4051345282, 1150909863, 1568414791,
-            4187598979, 1853858913, 2752650647, 651553945,  833383855,  1485024636, 519534978,
-            1863925267, 2630611858, 2024937447, 1742280896, 2787396201, 3820838073, 3662615151,
-            3977752439, 3408434211, 706249248,  2911461152, 2876487471, 946413621,  3558087349,
-            3356340402, 94465354,   4144428207, 594291498,  321689936,  3549553313, 355115131,
-            1766908721, 4161577410, 283511019,  929118324,  4230182526, 4129773994, 3412896427,
-            245074365,  323175980,  574829868,  1370311172, 2524576196, 1515506710, 3878536735,
-            2872582799, 2126482280, 191747443,  3554974147, 2632144074, 2054977701, 3008162088,
-            2536173413, 2140117105, 1682536501, 1312015181, 2975592532, 2513339541, 434349342,
-            3665266631, 603750646,  1692448645, 1465274836, 3028510289, 3241970795, 917232349,
-            1830840788, 86162585,   3994386333, 2443381369, 2080242129, 1711150666, 2329728546,
-            1081232946, 4255565434, 477922265,  1567604675, 4271485670, 1325166673, 1884885838,
-            2575659217, 3239311831, 3400204877, 2959136644, 3978297784, 3562612585, 1158829342,
-            2281472745, 2204978463, 3436274503, 4242950736, 507113371,  3334149639, 577539236,
-            3045629124, 3601631698, 141971783,  1098326373, 1166529585, 1968783196, 2152908819,
-            3920831873, 334082409,  1755848744, 1822304726, 710420381,  1614148322, 3956683394,
-            2101040249, 2836877868, 2174697423, 2096052992, 4088615100, 476313395,  3426243181,
-            3342202804, 1421924156, 3060969854, 3782851827, 1941189849, 1652499078, 2073323446,
-            4133990114, 4152053718, 4028972871, 315841614,  1167654396, 593533853,  2516665631,
-            334011179,  1438371976, 4151083092, 1123006149, 3680502874, 2637493230, 3385783362,
-            2685639772, 781112891,  3707875967, 2839429989, 720367987,  1292116385, 21944878,
-            3374455645, 260121049,  2711393754, 2504770707, 2661702552, 3374998463, 2617737840,
-            1533001481, 731639818,  2899328700, 3744024191, 2624754566, 3526754374, 1319337437,
-            2996727126, 4156827474, 4134822587, 763325185,  4051345282, 2558702967, 1568414791,
-            4187598979, 1853858913, 2752650647, 27949785,   833383855,  1485024636, 519534978,
-            1863925267, 3444494082, 2024937447, 1742280896, 2787396201, 3820838073, 2444703748,
-            3977752439, 3408434211, 706249248,  2911461152, 2045399292, 946413621,  3558087349,
-            3356340402, 94465354,   3519033415, 594291498,  321689936,  3549553313, 355115131,
-            1395066480, 4161577410, 283511019,  929118324,  4230182526, 4043917599, 3412896427,
-            245074365,  323175980,  574829868,  1171053280, 1136836117, 3535562179, 1633068230,
-            4163284436, 997413256,  44895010,   1349157553, 2915429436, 2140869882, 2285877408,
-            2683605243, 831284269,  505536872,  1595565946, 1205584796, 2908695836, 1550484536,
-            1232057037, 409609305,  2423758129, 3408533440, 1422329626, 843590557,  18178752,
-            850628569,  2166558800, 1632385607, 2820833379, 336406710,  2162280254, 3522653351,
-            1273298288, 252200287,  3199040620, 2135583253, 3906341946, 3480400178, 1928926818,
-            406169496,  202103589,  728659595,  2813567212, 100045696,  2697513811, 3065127696,
-            242898314,  1489875037, 3352449284, 1728915803, 3687480763, 3663847397, 3108666965,
-            2916727530, 1456644624, 1761989833, 1767427417, 3453137950, 4081697067, 3823145447,
-            3989745635, 1019019747, 1332032212, 1902608314, 1485149722, 1060435059, 3587877064,
-            1406042654, 1547252239, 3284698711, 3339760729, 1095183636, 2702923899, 765956392,
-            1377130296, 1093286133, 3775769974, 1271024233, 2432407775, 1115150844, 3264880489,
-            460329759,  1385981112, 62574141,   2477498223, 20475449,   4214193839, 2799755837,
-            510561175,  292357569,  1977928177, 4232020572, 1082432318, 3095867812, 1860702061,
-            374678781,  1270242284, 2827871855, 2968740773, 2940740398, 797811348,  3197581425,
-            2701366722, 2193755420, 1768202969, 3648490251, 3419330957, 2875650689, 1522032350,
-            3794158237, 3409247592, 1742413112, 1698126196, 530696843,  4147471899, 1936566570,
-            1043992572, 2973812399, 894743032,  2378605831, 2421440715, 3602298606, 742439175,
-            1245329951, 1873983312, 2350844190, 2843887795, 1842949679, 3821118282, 948003713,
-            4185836,    3720675891, 3873702009, 983739606,  939481659,  4291414912, 2025778689,
-            1918899692, 2515369982, 2647362130, 3730850642, 2810844078, 2682467227, 1274489134,
-            2214238620, 607599476,  4126608179, 3600490521, 3317152073, 371612648,  280237021,
-            1133712813, 3147805807, 2876882052, 2618852592, 381689221,  3888731290, 749076017,
-            574519180,  830288288,
-        },
-        {
-            2647200400, 1592194261, 1289872755, 2079982087, 3431487085, 1101851783, 3373292799,
-            2148994262, 2785319928, 3206527339, 2731839331, 1280366172, 1146205735, 2930495205,
-            2876978398, 3885758458, 2062812458, 2448488486, 192141900,  3861696664, 2677929258,
-            3606729729, 2920965773, 1156521508, 3168665640, 298794036,  957896625,  2606719899,
-            3699219026, 3120096333, 2531109351, 1920936462, 2848868175, 1406404729, 2956672675,
-            1376226240, 3667482110, 2551426756, 3433640449, 2603906744, 4217864690, 47671552,
-            2993859190, 1269153270, 3463588775, 1655126430, 3453916724, 2157890969, 252769449,
-            1583335064, 2560819344, 52639671,   39618615,   313192112,  2625914283, 2964928555,
-            4226359627, 4141969666, 183405146,  1455378225, 2994063945, 3146629795, 2992956289,
-            368634554,  4110058153, 1156556441, 3690317172, 906928962,  3773042217, 948650679,
-            4134172918, 2922802573, 1417921660, 291400676,  3120733115, 3225369425, 3200455006,
-            2207799613, 1766261260, 914727455,  1927023103, 572959294,  3447057855, 4042691162,
-            840021910,  4187195325, 3627831667, 1671506539, 242673485,  3330397756, 776552069,
-            684550924,  261597601,  1857936262, 1022869402, 4209077103, 14248159,   2366156245,
-            1910356465, 2020463550, 873419743,  4290775093, 3670978210, 1726974037, 784115717,
-            3574834402, 357805142,  3820795621, 1854247318, 1161642656, 3977404318, 2054677775,
-            1737374322, 2852015019, 4277252452, 1392810771, 3742661504, 1900815804, 1965911170,
-            3540183220, 2106191537, 3606954134, 2108636204, 2981827052, 2506861567, 184003599,
-            3319252632, 1370913077, 940955681,  2244100002, 3683661822, 3215832318, 3463899341,
-            134577035,  3404365179, 2262494389, 88039196,   114405083,  1071449574, 4008494055,
-            765981248,  758357266,  2564125377, 901977407,  955156196,  3900980822, 134031448,
-            2566915950, 3445833537, 3138903399, 2113076217, 713587277,  3396078039, 3987657193,
-            3004104774, 800324742,  652529813,  3999083342, 486108562,  2103591900, 104743736,
-            2647200400, 1592194261, 1289872755, 2079982087, 552781204,  1101851783, 3373292799,
-            2148994262, 2785319928, 1222851809, 2731839331, 1280366172, 1146205735, 2930495205,
-            942360591,  3885758458, 2062812458, 2448488486, 192141900,  1909229999, 2677929258,
-            3606729729, 2920965773, 1156521508, 2995805883, 298794036,  957896625,  2606719899,
-            3699219026, 2447513005, 2531109351, 1920936462, 2848868175, 1406404729, 2751142611,
-            1376226240, 3667482110, 2551426756, 3433640449, 3724189478, 4217864690, 47671552,
-            2993859190, 1269153270, 2144136371, 1655126430, 3453916724, 2157890969, 252769449,
-            2959496542, 2560819344, 52639671,   39618615,   313192112,  2367743540, 2964928555,
-            4226359627, 4141969666, 183405146,  2006751422, 2994063945, 3146629795, 2992956289,
-            368634554,  1529794973, 1156556441, 3690317172, 906928962,  3773042217, 2005599428,
-            4134172918, 2922802573, 1417921660, 291400676,  2664982078, 3225369425, 3200455006,
-            2207799613, 1766261260, 2623711877, 1927023103, 572959294,  3447057855, 4042691162,
-            3510199782, 4187195325, 3627831667, 1671506539, 242673485,  1978730938, 776552069,
-            684550924,  261597601,  1857936262, 3273582958, 4209077103, 14248159,   2366156245,
-            1910356465, 457933823,  873419743,  4290775093, 3670978210, 1726974037, 1414288023,
-            3574834402, 357805142,  3820795621, 1854247318, 2679386897, 3977404318, 2054677775,
-            1737374322, 2852015019, 2411291453, 1392810771, 3742661504, 1900815804, 1965911170,
-            3719529323, 2106191537, 3606954134, 2108636204, 2981827052, 3702357099, 184003599,
-            3319252632, 1370913077, 940955681,  4262675711, 3683661822, 3215832318, 3463899341,
-            134577035,  3494669542, 2262494389, 88039196,   114405083,  1071449574, 1060831201,
-            765981248,  758357266,  2564125377, 901977407,  3003279383, 3900980822, 134031448,
-            2566915950, 3445833537, 2846863035, 2113076217, 713587277,  3396078039, 3987657193,
-            2067196130, 800324742,  652529813,  3999083342, 486108562,  2321935002, 104743736,
-            2647200400, 1592194261, 1289872755, 466892855,  552781204,  1101851783, 3373292799,
-            2148994262, 3078568050, 1222851809, 2731839331, 1280366172, 1146205735, 1710937426,
-            942360591,  3885758458, 2062812458, 2448488486, 3418446265, 1909229999, 2677929258,
-            3606729729, 2920965773, 1103324742, 2995805883, 298794036,  957896625,  2606719899,
-            675602173,  2447513005, 2531109351, 1920936462, 2848868175, 1509959171, 2751142611,
-            1376226240, 3667482110, 2551426756, 2447143807, 3724189478, 4217864690, 47671552,
-            2993859190, 2821422976, 2144136371, 1655126430, 3453916724, 2157890969, 3665277070,
-            2959496542, 2560819344, 52639671,   39618615,   2817859210, 2367743540, 2964928555,
-            4226359627, 4141969666, 2856219617, 2006751422, 2994063945, 3146629795, 2992956289,
-            3176479073, 1529794973, 1156556441, 3690317172, 906928962,  97899274,   2005599428,
-            4134172918, 2922802573, 1417921660, 1492426675, 2664982078, 3225369425, 3200455006,
-            2207799613, 2275640124, 2623711877, 1927023103, 572959294,  3447057855, 1036984002,
-            3510199782, 4187195325, 3627831667, 1671506539, 1827895694, 1978730938, 776552069,
-            684550924,  261597601,  3493571621, 3273582958, 4209077103, 14248159,   2366156245,
-            211745521,  457933823,  873419743,  4290775093, 3670978210, 1909994881, 1414288023,
-            3574834402, 357805142,  3820795621, 1911700755, 2679386897, 3977404318, 2054677775,
-            1737374322, 213019511,  2411291453, 1392810771, 3742661504, 1900815804, 237536256,
-            3719529323, 2106191537, 3606954134, 2108636204, 665423205,  3702357099, 184003599,
-            3319252632, 1370913077, 3583034472, 4262675711, 3683661822, 3215832318, 3463899341,
-            4027471772, 3494669542, 2262494389, 88039196,   114405083,  3580272354, 1060831201,
-            765981248,  758357266,  2564125377, 2592170747, 3003279383, 3900980822, 134031448,
-            2566915950, 1722483656, 2846863035, 2113076217, 713587277,  3396078039, 244197359,
-            2067196130, 800324742,  652529813,  3999083342, 2310369213, 2321935002, 104743736,
-            2647200400, 1592194261, 1610483859, 466892855,  552781204,  1101851783, 3373292799,
-            2617595614, 3078568050, 1222851809, 2731839331, 1280366172, 808483717,  1710937426,
-            942360591,  3885758458, 2062812458, 3260452154, 3418446265, 1909229999, 2677929258,
-            3606729729, 341113837,  1103324742, 2995805883, 298794036,  957896625,  2309730124,
-            675602173,  2447513005, 2531109351, 1920936462, 2268824429, 1509959171, 2751142611,
-            1376226240, 3667482110, 2745634237, 2447143807, 3724189478, 4217864690, 47671552,
-            2787057737, 2821422976, 2144136371, 1655126430, 3453916724, 339095616,  3665277070,
-            2959496542, 2560819344, 52639671,   3200765881, 2817859210, 2367743540, 2964928555,
-            4226359627, 3206913703, 2856219617, 2006751422, 2994063945, 3146629795, 1042016834,
-            3176479073, 1529794973, 1156556441, 3690317172, 171871257,  97899274,   2005599428,
-            4134172918, 2922802573, 1501051393, 1492426675, 2664982078, 3225369425, 3200455006,
-            1356823782, 2275640124, 2623711877, 1927023103, 572959294,  319456586,  1036984002,
-            3510199782, 4187195325, 3627831667, 3026392291, 1827895694, 1978730938, 776552069,
-            684550924,  2862336749, 3493571621, 3273582958, 4209077103, 14248159,   1597498830,
-            211745521,  457933823,  873419743,  4290775093, 2990300609, 1909994881, 1414288023,
-            3574834402, 357805142,  1957211849, 1911700755, 2679386897, 3977404318, 2054677775,
-            1006075205, 213019511,  2411291453, 1392810771, 3742661504, 1443139437, 237536256,
-            3719529323, 2106191537, 3606954134, 2671394121, 665423205,  3702357099, 184003599,
-            3319252632, 1632983188, 3583034472, 4262675711, 3683661822, 3215832318, 4080585934,
-            4027471772, 3494669542, 2262494389, 88039196,   677218369,  3580272354, 1060831201,
-            765981248,  758357266,  1277026792, 2592170747, 3003279383, 3900980822, 134031448,
-            4189207981, 1722483656, 2846863035, 2113076217, 713587277,  2098603934, 244197359,
-            2067196130, 800324742,  652529813,  1307843279, 3205610699, 1606722715, 2749781905,
-            3500078806, 320007706,  4092615096, 608085660,  1869480444, 459160631,  3657609957,
-            1944540526, 2184854884, 3497113751, 2817682182, 3367276652, 2069300794, 1466691974,
-            3078806052, 3998756116, 2068892089, 1789981386, 4196184114, 4004623319, 3029515569,
-            3206332209, 3424306963, 1805804276, 899469644,  1149853995, 903917909,  1185042552,
-            447265042,  3579272434, 116409560,  2211704275, 1237721838, 3636618157, 3191931082,
-            2430339315, 3551966793, 1533877057, 1700891210, 3317627852, 828148584,  1733460943,
-            3866870689, 3970886915, 1624935507, 3236099078, 4209593953, 1951283095, 1579020365,
-            1165668813, 1423097998, 1294879824, 3406063424, 3313007028, 2090501113, 842064167,
-            729587893,  2949702260, 2099637920, 260436310,  1056109549, 657874983,  2734575906,
-            4088958435, 3265216971, 1081848592, 2593212854, 4028921684, 2868974814, 2299228627,
-            49944924,   955114665,  2844328062, 885136505,  4262681333, 977883895,  998890598,
-            2026602293, 87852872,   2197997810, 910583259,  3151223623, 3960726944, 1778982325,
-            3322631234, 2940402694, 1619768059, 1592832128, 1434542537, 2107314297, 1170789408,
-            3357335254, 3317662644, 1409884338, 73741139,   1093507243, 329113525,  4199840577,
-            442295615,  3348669654, 435948047,  1154137005, 3151357655, 2101029905, 2430218233,
-            2474305449, 2316834456, 1736616135, 1575712778, 370866908,  4256943043, 2805503887,
-            1099763491, 2473785999, 3215573143, 472701386,  3070116154, 3969279119, 3331310102,
-            3932945670, 1502564397, 1294139579, 3073834823, 3115143551, 3602082994, 3707103500,
-            2570195094, 1268510174, 3561337287, 112422529,  1483304061, 3712148969, 3729628891,
-            2741131557, 4035019342, 2395091348, 208448216,  607199897,  4049058939, 3463267226,
-            3821711834, 1697628853, 691151709,  3014869414, 11610545,   3895793639, 3019679196,
-            1246664817, 753245113,  2236232962, 4172861179, 4030183420, 2367787106, 2209331085,
-            4170801007, 3609895913,
-        },
-        {
-            1692707525, 1557286711, 1914115397, 2296438762, 4052043761, 2740189920, 2312811379,
-            3444794781, 1039960005, 3717427642, 2187053367, 1352639846, 3961853897, 3492600397,
-            1445193529, 2854100676, 22091422,   1949402322, 1542153197, 107621107,  4074461068,
-            4240106316, 3972865709, 3188162278, 4263710561, 2784188560, 790262000,  3690920824,
-            1050510902, 3209658326, 2006503510, 4097301012, 3747575444, 4259473916, 1788590536,
-            4272325871, 3791723657, 820207818,  468165881,  2663743024, 3317906078, 3690000614,
-            2740345020, 4151157732, 3488327758, 2284237674, 2945646625, 197227772,  2868134844,
-            3955863346, 148077080,  3615952952, 889874655,  792903372,  3375295456, 3186057059,
-            665981349,  3025138810, 3117482232, 1179171787, 2568284233, 2025489429, 915542822,
-            2891109459, 666191334,  3644367133, 3852305372, 1612705887, 568580989,  4185629939,
-            1396387932, 2825654646, 4104349055, 1936897805, 1964506925, 3463887135, 341232759,
-            1157492440, 1794053436, 1999526693, 2989676904, 2939827283, 3923563383, 3456026757,
-            1337869474, 34114136,   2603531307, 2586444857, 2253071995, 147976885,  701967022,
-            133289675,  1132599489, 3445254317, 1140864538, 1057570914, 3781797148, 3733548556,
-            394486297,  2191489678, 988653443,  3657306331, 1559066085, 2494411352, 1968251141,
-            1395257776, 3526799494, 1173567880, 2080044565, 3709538947, 621502449,  1274774170,
-            680143914,  1191339675, 2181068883, 1056657620, 1273397229, 407573378,  428846486,
-            1452400505, 74120177,   4081061689, 1155491118, 739402883,  1995669002, 3378060221,
-            2940324388, 1093761863, 557249651,  1783887860, 2587931652, 3240915531, 1815509464,
-            1345214029, 652821553,  3301838915, 2648687469, 3590354178, 3475762213, 1986035671,
-            1976321884, 3460734243, 2123242114, 634905295,  3060056286, 2977924989, 1888875286,
-            2954813652, 1640548452, 3248921642, 580444239,  3727473484, 1705098142, 865689987,
-            945335316,  501385674,  1661415640, 687161171,  215935405,  2585442595, 1112179422,
-            1692707525, 1557286711, 1914115397, 2296438762, 3722731908, 2740189920, 2312811379,
-            3444794781, 1039960005, 1694627301, 2187053367, 1352639846, 3961853897, 3492600397,
-            2168603191, 2854100676, 22091422,   1949402322, 1542153197, 2143370161, 4074461068,
-            4240106316, 3972865709, 3188162278, 751525376,  2784188560, 790262000,  3690920824,
-            1050510902, 4184776154, 2006503510, 4097301012, 3747575444, 4259473916, 308254355,
-            4272325871, 3791723657, 820207818,  468165881,  4211707768, 3317906078, 3690000614,
-            2740345020, 4151157732, 2230082504, 2284237674, 2945646625, 197227772,  2868134844,
-            224687568,  148077080,  3615952952, 889874655,  792903372,  3885974337, 3186057059,
-            665981349,  3025138810, 3117482232, 4217488214, 2568284233, 2025489429, 915542822,
-            2891109459, 1468247287, 3644367133, 3852305372, 1612705887, 568580989,  363754773,
-            1396387932, 2825654646, 4104349055, 1936897805, 1920154169, 3463887135, 341232759,
-            1157492440, 1794053436, 974966747,  2989676904, 2939827283, 3923563383, 3456026757,
-            1261223560, 34114136,   2603531307, 2586444857, 2253071995, 4129515953, 701967022,
-            133289675,  1132599489, 3445254317, 1229660366, 1057570914, 3781797148, 3733548556,
-            394486297,  2027373302, 988653443,  3657306331, 1559066085, 2494411352, 173145175,
-            1395257776, 3526799494, 1173567880, 2080044565, 3155857034, 621502449,  1274774170,
-            680143914,  1191339675, 1538291886, 1056657620, 1273397229, 407573378,  428846486,
-            1842255033, 74120177,   4081061689, 1155491118, 739402883,  4115831515, 3378060221,
-            2940324388, 1093761863, 557249651,  3917593903, 2587931652, 3240915531, 1815509464,
-            1345214029, 876855474,  3301838915, 2648687469, 3590354178, 3475762213, 2634390809,
-            1976321884, 3460734243, 2123242114, 634905295,  1982556983, 2977924989, 1888875286,
-            2954813652, 1640548452, 351342414,  580444239,  3727473484, 1705098142, 865689987,
-            4095620343, 501385674,  1661415640, 687161171,  215935405,  1590560836, 1112179422,
-            1692707525, 1557286711, 1914115397, 3603357386, 3722731908, 2740189920, 2312811379,
-            3444794781, 1156916901, 1694627301, 2187053367, 1352639846, 3961853897, 799755067,
-            2168603191, 2854100676, 22091422,   1949402322, 2728473761, 2143370161, 4074461068,
-            4240106316, 3972865709, 946037192,  751525376,  2784188560, 790262000,  3690920824,
-            1540036576, 4184776154, 2006503510, 4097301012, 3747575444, 3602789694, 308254355,
-            4272325871, 3791723657, 820207818,  710767455,  4211707768, 3317906078, 3690000614,
-            2740345020, 3313613311, 2230082504, 2284237674, 2945646625, 197227772,  4165482625,
-            224687568,  148077080,  3615952952, 889874655,  4185866573, 3885974337, 3186057059,
-            665981349,  3025138810, 2379602537, 4217488214, 2568284233, 2025489429, 915542822,
-            4294883239, 1468247287, 3644367133, 3852305372, 1612705887, 1350697880, 363754773,
-            1396387932, 2825654646, 4104349055, 3875185893, 1920154169, 3463887135, 341232759,
-            1157492440, 3105719602, 974966747,  2989676904, 2939827283, 3923563383, 2007649368,
-            1261223560, 34114136,   2603531307, 2586444857, 1910470213, 4129515953, 701967022,
-            133289675,  1132599489, 423289705,  1229660366, 1057570914, 3781797148, 3733548556,
-            3457074915, 2027373302, 988653443,  3657306331, 1559066085, 712307036,  173145175,
-            1395257776, 3526799494, 1173567880, 2188926988, 3155857034, 621502449,  1274774170,
-            680143914,  1706845402, 1538291886, 1056657620, 1273397229, 407573378,  443825820,
-            1842255033, 74120177,   4081061689, 1155491118, 3958579557, 4115831515, 3378060221,
-            2940324388, 1093761863, 1143084227, 3917593903, 2587931652, 3240915531, 1815509464,
-            3961298737, 876855474,  3301838915, 2648687469, 3590354178, 1913851107, 2634390809,
-            1976321884, 3460734243, 2123242114, 2504424512, 1982556983, 2977924989, 1888875286,
-            2954813652, 88977955,   351342414,  580444239,  3727473484, 1705098142, 3022002333,
-            4095620343, 501385674,  1661415640, 687161171,  1305862349, 1590560836, 1112179422,
-            1692707525, 1557286711, 2481435554, 3603357386, 3722731908, 2740189920, 2312811379,
-            1895805009, 1156916901, 1694627301, 2187053367, 1352639846, 3862989701, 799755067,
-            2168603191, 2854100676, 22091422,   2453210803, 2728473761, 2143370161, 4074461068,
-            4240106316, 3472961632, 946037192,  751525376,  2784188560, 790262000,  3759093503,
-            1540036576, 4184776154, 2006503510, 4097301012, 1104723092, 3602789694, 308254355,
-            4272325871, 3791723657, 2609305581, 710767455,  4211707768, 3317906078, 3690000614,
-            978153929,  3313613311, 2230082504, 2284237674, 2945646625, 2715610545, 4165482625,
-            224687568,  148077080,  3615952952, 1257644548, 4185866573, 3885974337, 3186057059,
-            665981349,  1456248788, 2379602537, 4217488214, 2568284233, 2025489429, 1559558913,
-            4294883239, 1468247287, 3644367133, 3852305372, 1583513977, 1350697880, 363754773,
-            1396387932, 2825654646, 258232174,  3875185893, 1920154169, 3463887135, 341232759,
-            3157308069, 3105719602, 974966747,  2989676904, 2939827283, 1915652941, 2007649368,
-            1261223560, 34114136,   2603531307, 306740754,  1910470213, 4129515953, 701967022,
-            133289675,  3554544490, 423289705,  1229660366, 1057570914, 3781797148, 3351136968,
-            3457074915, 2027373302, 988653443,  3657306331, 1887131063, 712307036,  173145175,
-            1395257776, 3526799494, 1553946431, 2188926988, 3155857034, 621502449,  1274774170,
-            1225233595, 1706845402, 1538291886, 1056657620, 1273397229, 2878421297, 443825820,
-            1842255033, 74120177,   4081061689, 3352300929, 3958579557, 4115831515, 3378060221,
-            2940324388, 3148079742, 1143084227, 3917593903, 2587931652, 3240915531, 2765383185,
-            3961298737, 876855474,  3301838915, 2648687469, 4034858841, 1913851107, 2634390809,
-            1976321884, 3460734243, 2674491879, 2504424512, 1982556983, 2977924989, 1888875286,
-            4121456653, 88977955,   351342414,  580444239,  3727473484, 557055585,  3022002333,
-            4095620343, 501385674,  1661415640, 212475371,  471552821,  3336215391, 3381476222,
-            883779343,  1350062812, 1846298224, 1312441525, 940080271,  1528487794, 3651330479,
-            2740921325, 1942406000, 3852143925, 3275209088, 3589213182, 1030562145, 722126551,
-            1111338493, 2144000218, 1566879251, 2215624750, 1293755135, 2579822260, 109416564,
-            2912134926, 4142980111, 2882951614, 3225508125, 4108160750, 167932435,  2490156600,
-            4082908064, 2767682946, 1404753706, 247636250,  969714829,  3899992349, 2548657123,
-            3695296573, 1263691918, 1806947952, 2870538234, 1838821708, 1252354741, 2489469793,
-            1699079289, 1197235875, 2440007523, 3923463495, 2120319700, 1023142520, 2932202488,
-            2161474302, 3592264461, 1993781507, 117944494,  1841550445, 3037605681, 831194301,
-            3144116499, 3942009557, 1032540622, 3808190823, 2603437121, 3412778705, 3885499173,
-            1390381576, 4036129102, 3785932442, 3813049629, 1786120449, 594859222,  1578867691,
-            341083723,  992420777,  2478515598, 1062385693, 962753775,  2192014768, 123581458,
-            1521009010, 605484031,  3771057519, 1957533180, 1879451381, 1253654154, 4123940785,
-            3355602633, 4123447763, 3612478821, 427875919,  1757493800, 427044348,  2174556456,
-            2818066761, 1242773878, 1950611147, 1974710336, 1611803314, 3787835333, 3349395391,
-            4275042635, 643467771,  4001104041, 1217499954, 3369936227, 1994426352, 1070347586,
-            1934315715, 3701124408, 10392098,   2274786917, 2973638266, 967562767,  1043692373,
-            661269716,  1220240965, 715709072,  1916920593, 3789044402, 4150429719, 2688692806,
-            4073402065, 1424211991, 4030194662, 2487833551, 1132285669, 531534897,  157131956,
-            2157668389, 91262027,   2326982293, 2912851844, 3984779504, 1347994426, 174927435,
-            967033979,  1712482645, 1026564221, 3173747604, 1297384653, 1061652526, 2722239799,
-            3616428651, 2746138024, 1019690063, 2843820047, 3752471352, 1859497029, 1044907536,
-            3420485149, 3467494462, 3663514480, 4173605695, 4276194144, 3755111681, 1811049884,
-            2683066731, 2182008993,
-        },
-        {
-            930278208,  223382535,  720499309,  2613473585, 4173439516, 2132019243, 468054579,
-            1141433627, 1328639101, 3222455434, 4023859457, 892124224,  2940688706, 2894552260,
-            1595432126, 2558709596, 2057191226, 1116728192, 3767370344, 1457278707, 3171850455,
-            3733161247, 149922078,  3860652874, 743952057,  1024625539, 3982786483, 2077838781,
-            3713742913, 2790452624, 3014482913, 2928857967, 476371337,  611803300,  3000092437,
-            57069608,   1554852195, 1406780525, 2288998898, 460131340,  3945168588, 18495216,
-            547882902,  1624966119, 2229423551, 1492565146, 706052879,  2733955743, 1450476708,
-            2565285196, 2491601298, 850297175,  331472128,  3275065709, 3154247398, 1364512871,
-            1193063601, 579449294,  4097747196, 3572372000, 2712499116, 1172861307, 3964137156,
-            1300564854, 1057993198, 2785733262, 3548277076, 2572944411, 3299232577, 2031854568,
-            2468534978, 602097973,  2068619195, 2639336890, 1694467033, 1581263823, 809076686,
-            2892861850, 4042078087, 3178152001, 706023882,  3236709493, 3603158102, 2575690800,
-            2831218686, 2492604085, 207296828,  1561595438, 2961967115, 3304283504, 835276604,
-            3005485731, 58946395,   3979071161, 1560535337, 2679058432, 1061627241, 1142692919,
-            1476802977, 1306619165, 1297953898, 4282928317, 3630719944, 2305895643, 2656730970,
-            916308118,  4160016206, 3541795573, 4222235077, 1289754532, 1963633184, 3595798857,
-            2273299603, 1687478595, 2249344966, 2267127964, 2201115693, 917609614,  3731921025,
-            1634893875, 3039440017, 1122674005, 2906728840, 921166852,  3525309936, 633872502,
-            821930665,  3861074060, 3309559821, 304858441,  1530517912, 1140212033, 3168869568,
-            3223449972, 1343718360, 2831361172, 1723616626, 3675867172, 2586694335, 2374941766,
-            387033391,  1528180036, 1561421035, 2735360720, 3952587140, 13543969,   3987997725,
-            4273177532, 2200558169, 461920718,  459441276,  4225054447, 2248193798, 1103878063,
-            3027778665, 1844457031, 1364117386, 1575430424, 2276483962, 2665252582, 1572038262,
-            930278208,  223382535,  720499309,  2613473585, 4025056228, 2132019243, 468054579,
-            1141433627, 1328639101, 304940359,  4023859457, 892124224,  2940688706, 2894552260,
-            2006939659, 2558709596, 2057191226, 1116728192, 3767370344, 3026555841, 3171850455,
-            3733161247, 149922078,  3860652874, 2068299929, 1024625539, 3982786483, 2077838781,
-            3713742913, 2512419366, 3014482913, 2928857967, 476371337,  611803300,  259065762,
-            57069608,   1554852195, 1406780525, 2288998898, 2261401631, 3945168588, 18495216,
-            547882902,  1624966119, 3049748661, 1492565146, 706052879,  2733955743, 1450476708,
-            910808481,  2491601298, 850297175,  331472128,  3275065709, 3877736250, 1364512871,
-            1193063601, 579449294,  4097747196, 3029512053, 2712499116, 1172861307, 3964137156,
-            1300564854, 2398462790, 2785733262, 3548277076, 2572944411, 3299232577, 3497485227,
-            2468534978, 602097973,  2068619195, 2639336890, 4271191874, 1581263823, 809076686,
-            2892861850, 4042078087, 3046259144, 706023882,  3236709493, 3603158102, 2575690800,
-            591682100,  2492604085, 207296828,  1561595438, 2961967115, 3885379584, 835276604,
-            3005485731, 58946395,   3979071161, 2784795951, 2679058432, 1061627241, 1142692919,
-            1476802977, 2864266022, 1297953898, 4282928317, 3630719944, 2305895643, 3374260620,
-            916308118,  4160016206, 3541795573, 4222235077, 3025355241, 1963633184, 3595798857,
-            2273299603, 1687478595, 4115795122, 2267127964, 2201115693, 917609614,  3731921025,
-            2905712346, 3039440017, 1122674005, 2906728840, 921166852,  2881663141, 633872502,
-            821930665,  3861074060, 3309559821, 2816533968, 1530517912, 1140212033, 3168869568,
-            3223449972, 1894667948, 2831361172, 1723616626, 3675867172, 2586694335, 3974041178,
-            387033391,  1528180036, 1561421035, 2735360720, 2014321457, 13543969,   3987997725,
-            4273177532, 2200558169, 2259553303, 459441276,  4225054447, 2248193798, 1103878063,
-            3889361594, 1844457031, 1364117386, 1575430424, 2276483962, 3302182736, 1572038262,
-            930278208,  223382535,  720499309,  4173186621, 4025056228, 2132019243, 468054579,
-            1141433627, 2396654717, 304940359,  4023859457, 892124224,  2940688706, 2903529759,
-            2006939659, 2558709596, 2057191226, 1116728192, 715931354,  3026555841, 3171850455,
-            3733161247, 149922078,  3342675578, 2068299929, 1024625539, 3982786483, 2077838781,
-            1157097180, 2512419366, 3014482913, 2928857967, 476371337,  2192872017, 259065762,
-            57069608,   1554852195, 1406780525, 4165039782, 2261401631, 3945168588, 18495216,
-            547882902,  2453072030, 3049748661, 1492565146, 706052879,  2733955743, 2233423433,
-            910808481,  2491601298, 850297175,  331472128,  1154483111, 3877736250, 1364512871,
-            1193063601, 579449294,  690173400,  3029512053, 2712499116, 1172861307, 3964137156,
-            2683130322, 2398462790, 2785733262, 3548277076, 2572944411, 4075824857, 3497485227,
-            2468534978, 602097973,  2068619195, 2711665545, 4271191874, 1581263823, 809076686,
-            2892861850, 3558962856, 3046259144, 706023882,  3236709493, 3603158102, 274706518,
-            591682100,  2492604085, 207296828,  1561595438, 1532885415, 3885379584, 835276604,
-            3005485731, 58946395,   4143205928, 2784795951, 2679058432, 1061627241, 1142692919,
-            2539503297, 2864266022, 1297953898, 4282928317, 3630719944, 3333189589, 3374260620,
-            916308118,  4160016206, 3541795573, 1771535488, 3025355241, 1963633184, 3595798857,
-            2273299603, 1735171204, 4115795122, 2267127964, 2201115693, 917609614,  4220503034,
-            2905712346, 3039440017, 1122674005, 2906728840, 868453017,  2881663141, 633872502,
-            821930665,  3861074060, 1928586970, 2816533968, 1530517912, 1140212033, 3168869568,
-            1082127627, 1894667948, 2831361172, 1723616626, 3675867172, 496773835,  3974041178,
-            387033391,  1528180036, 1561421035, 2763161987, 2014321457, 13543969,   3987997725,
-            4273177532, 2110570579, 2259553303, 459441276,  4225054447, 2248193798, 53021618,
-            3889361594, 1844457031, 1364117386, 1575430424, 1105247032, 3302182736, 1572038262,
-            930278208,  223382535,  2159964170, 4173186621, 4025056228, 2132019243, 468054579,
-            1397544344, 2396654717, 304940359,  4023859457, 892124224,  2800429255, 2903529759,
-            2006939659, 2558709596, 2057191226, 296054924,  715931354,  3026555841, 3171850455,
-            3733161247, 863280930,  3342675578, 2068299929, 1024625539, 3982786483, 949122664,
-            1157097180, 2512419366, 3014482913, 2928857967, 2585465463, 2192872017, 259065762,
-            57069608,   1554852195, 3650462338, 4165039782, 2261401631, 3945168588, 18495216,
-            524715648,  2453072030, 3049748661, 1492565146, 706052879,  123143857,  2233423433,
-            910808481,  2491601298, 850297175,  3272095697, 1154483111, 3877736250, 1364512871,
-            1193063601, 2394240337, 690173400,  3029512053, 2712499116, 1172861307, 598335483,
-            2683130322, 2398462790, 2785733262, 3548277076, 678275336,  4075824857, 3497485227,
-            2468534978, 602097973,  1861912463, 2711665545, 4271191874, 1581263823, 809076686,
-            3324887617, 3558962856, 3046259144, 706023882,  3236709493, 1776103512, 274706518,
-            591682100,  2492604085, 207296828,  1739697610, 1532885415, 3885379584, 835276604,
-            3005485731, 2931144546, 4143205928, 2784795951, 2679058432, 1061627241, 1487949699,
-            2539503297, 2864266022, 1297953898, 4282928317, 4101955339, 3333189589, 3374260620,
-            916308118,  4160016206, 376029432,  1771535488, 3025355241, 1963633184, 3595798857,
-            2826786027, 1735171204, 4115795122, 2267127964, 2201115693, 2572535497, 4220503034,
-            2905712346, 3039440017, 1122674005, 2482828099, 868453017,  2881663141, 633872502,
-            821930665,  2579406681, 1928586970, 2816533968, 1530517912, 1140212033, 2547368381,
-            1082127627, 1894667948, 2831361172, 1723616626, 1903980411, 496773835,  3974041178,
-            387033391,  1528180036, 2681142643, 2763161987, 2014321457, 13543969,   3987997725,
-            2583502227, 2110570579, 2259553303, 459441276,  4225054447, 177868402,  53021618,
-            3889361594, 1844457031, 1364117386, 2369166739, 240269378,  689700242,  297384154,
-            1052178701, 2154172820, 614713903,  3000863907, 3916962502, 94341217,   2609111975,
-            1621831476, 4260159710, 694869580,  1708268072, 2751452128, 3843916827, 3400387883,
-            2394104046, 2348934617, 3263438569, 3818556032, 1695621950, 410888855,  347231182,
-            612084657,  1858306225, 3024940417, 2482215564, 2728249904, 2825132299, 329106327,
-            3333110741, 2742025573, 2947035922, 3758718780, 2191527983, 864130510,  2586839659,
-            662702978,  817620197,  2888275812, 3372817000, 2982240654, 2211025418, 2043458594,
-            498221898,  1559803796, 209509183,  3004637012, 2204871924, 2445352606, 4026842262,
-            3211433366, 3533095828, 4172447076, 865408944,  2797639687, 3201749441, 1286664278,
-            1158271235, 2641361834, 4261559289, 3643706696, 2017210420, 2067296744, 3548126272,
-            3846378526, 3885857009, 3013926193, 368948443,  3839554625, 2032663713, 4185819024,
-            4279332940, 137321733,  3515190288, 4281845500, 2738024944, 3350239126, 1456676856,
-            1246688651, 2478709188, 12570320,   989306366,  2347610707, 2849134988, 2351681449,
-            4063448910, 1193872626, 3645565330, 1863134777, 1345198234, 2504863006, 3815974850,
-            3075495578, 2400383333, 2727346254, 985812393,  1432182882, 3668977714, 231840487,
-            647229148,  274547428,  2856186783, 1273158535, 900081267,  1566366419, 562584841,
-            2247144789, 3522587233, 1686032132, 586483076,  1207387616, 3040778905, 2532774045,
-            3681992451, 1034866888, 4029685195, 3307070989, 2412903766, 3156200186, 2625083166,
-            4148004113, 1756566287, 2319065855, 2924909429, 3050022486, 2464491722, 1137782196,
-            2749457821, 790410752,  3511746957, 2277733721, 2871407058, 3858561909, 2176119631,
-            952943025,  2987154266, 120799539,  2862346597, 3689389598, 3329995989, 715438735,
-            1035277216, 3079684809, 677298106,  2364292665, 4110165256, 4096954153, 356732100,
-            2361282903, 4050817284, 2010946835, 1824397679, 4087204231, 4178036725, 4197370951,
-            503070461,  1879838906,
-        },
-        {
-            1324585761, 2607333521, 3397020404, 539170585,  3346503351, 3160542733, 164333355,
-            3852730100, 712206106,  2290551621, 641933516,  2164460271, 2150779896, 4284577936,
-            3379448498, 4245242938, 2971084648, 4007397862, 248693528,  2576880794, 2293028149,
-            4014925430, 4293006111, 3094036158, 1814082146, 2276914221, 2991024636, 1114197844,
-            476951892,  3066106844, 1706182840, 1379979267, 108990590,  240153198,  3477826555,
-            3580887415, 3246391157, 383835730,  316888489,  819513650,  578980375,  4071922422,
-            4161809082, 2106755628, 3922936646, 3353267599, 943993520,  3967646651, 1284049372,
-            291359536,  1424840624, 4271910774, 2463066280, 3474088850, 3457005789, 2016854673,
-            3877450832, 614078040,  613697803,  940484523,  3963994351, 1600892655, 1634274500,
-            3562065077, 3066839937, 2749291591, 262924310,  2156962509, 1198872564, 1801855339,
-            3452167829, 2417233031, 1695160485, 4001250057, 3945159053, 2599200884, 1973826015,
-            1163912194, 3739806929, 770143406,  2012495447, 2449583804, 2305630888, 4051087441,
-            1987666149, 2366648630, 3357498057, 2213922018, 2999711268, 3514274790, 2320442215,
-            3985906099, 2871677943, 1646435025, 2835672009, 3172835391, 2780546786, 2372470973,
-            3848498303, 2575982762, 2029544354, 901542699,  1005798457, 1382080445, 1950752150,
-            3942450529, 1222430268, 218701950,  2103218673, 264437151,  2825658397, 1336763380,
-            533577773,  3268340601, 2761755755, 4004350771, 266561106,  1629413077, 530335375,
-            3975381820, 3607767957, 3827921318, 466108522,  3272148939, 1249685797, 2329611037,
-            1977639402, 4142204051, 3916024540, 194900826,  2612817427, 3783023236, 44390845,
-            685009288,  462254963,  929534774,  2500803309, 521123215,  3357542912, 3406138395,
-            3738465206, 187406162,  3759330635, 3941052029, 2609019494, 1831873488, 2152213351,
-            1045257494, 3257609222, 1772726886, 2046457544, 411515726,  1049730351, 3195886884,
-            2385015844, 2148815200, 4063176572, 3976897806, 2789636344, 122608691,  1327113847,
-            1324585761, 2607333521, 3397020404, 539170585,  3479697134, 3160542733, 164333355,
-            3852730100, 712206106,  1432325095, 641933516,  2164460271, 2150779896, 4284577936,
-            3984399154, 4245242938, 2971084648, 4007397862, 248693528,  4075611152, 2293028149,
-            4014925430, 4293006111, 3094036158, 3809964597, 2276914221, 2991024636, 1114197844,
-            476951892,  446898755,  1706182840, 1379979267, 108990590,  240153198,  89247329,
-            3580887415, 3246391157, 383835730,  316888489,  4199172999, 578980375,  4071922422,
-            4161809082, 2106755628, 2779357818, 3353267599, 943993520,  3967646651, 1284049372,
-            1075032708, 1424840624, 4271910774, 2463066280, 3474088850, 4036082495, 2016854673,
-            3877450832, 614078040,  613697803,  3612977584, 3963994351, 1600892655, 1634274500,
-            3562065077, 4096892782, 2749291591, 262924310,  2156962509, 1198872564, 1294011738,
-            3452167829, 2417233031, 1695160485, 4001250057, 154387409,  2599200884, 1973826015,
-            1163912194, 3739806929, 2790237669, 2012495447, 2449583804, 2305630888, 4051087441,
-            926049383,  2366648630, 3357498057, 2213922018, 2999711268, 2259613280, 2320442215,
-            3985906099, 2871677943, 1646435025, 507227523,  3172835391, 2780546786, 2372470973,
-            3848498303, 3436344798, 2029544354, 901542699,  1005798457, 1382080445, 2976443357,
-            3942450529, 1222430268, 218701950,  2103218673, 4168521010, 2825658397, 1336763380,
-            533577773,  3268340601, 3410724267, 4004350771, 266561106,  1629413077, 530335375,
-            3105502455, 3607767957, 3827921318, 466108522,  3272148939, 3920968957, 2329611037,
-            1977639402, 4142204051, 3916024540, 3141244961, 2612817427, 3783023236, 44390845,
-            685009288,  1722865652, 929534774,  2500803309, 521123215,  3357542912, 2438827467,
-            3738465206, 187406162,  3759330635, 3941052029, 1624877056, 1831873488, 2152213351,
-            1045257494, 3257609222, 2538934869, 2046457544, 411515726,  1049730351, 3195886884,
-            1451499166, 2148815200, 4063176572, 3976897806, 2789636344, 4196548124, 1327113847,
-            1324585761, 2607333521, 3397020404, 2781966818, 3479697134, 3160542733, 164333355,
-            3852730100, 588730442,  1432325095, 641933516,  2164460271, 2150779896, 97008802,
-            3984399154, 4245242938, 2971084648, 4007397862, 1977616806, 4075611152, 2293028149,
-            4014925430, 4293006111, 3970327125, 3809964597, 2276914221, 2991024636, 1114197844,
-            787994346,  446898755,  1706182840, 1379979267, 108990590,  760330145,  89247329,
-            3580887415, 3246391157, 383835730,  3482951357, 4199172999, 578980375,  4071922422,
-            4161809082, 685003684,  2779357818, 3353267599, 943993520,  3967646651, 3933776402,
-            1075032708, 1424840624, 4271910774, 2463066280, 904033428,  4036082495, 2016854673,
-            3877450832, 614078040,  2988390003, 3612977584, 3963994351, 1600892655, 1634274500,
-            1372654124, 4096892782, 2749291591, 262924310,  2156962509, 2453436688, 1294011738,
-            3452167829, 2417233031, 1695160485, 1370240276, 154387409,  2599200884, 1973826015,
-            1163912194, 2225030726, 2790237669, 2012495447, 2449583804, 2305630888, 82304130,
-            926049383,  2366648630, 3357498057, 2213922018, 3991125352, 2259613280, 2320442215,
-            3985906099, 2871677943, 3143511719, 507227523,  3172835391, 2780546786, 2372470973,
-            1531901274, 3436344798, 2029544354, 901542699,  1005798457, 2141764987, 2976443357,
-            3942450529, 1222430268, 218701950,  420008858,  4168521010, 2825658397, 1336763380,
-            533577773,  3796429138, 3410724267, 4004350771, 266561106,  1629413077, 3848645222,
-            3105502455, 3607767957, 3827921318, 466108522,  653656644,  3920968957, 2329611037,
-            1977639402, 4142204051, 1757737,    3141244961, 2612817427, 3783023236, 44390845,
-            3614037777, 1722865652, 929534774,  2500803309, 521123215,  3416268285, 2438827467,
-            3738465206, 187406162,  3759330635, 181973781,  1624877056, 1831873488, 2152213351,
-            1045257494, 3767483937, 2538934869, 2046457544, 411515726,  1049730351, 2702921922,
-            1451499166, 2148815200, 4063176572, 3976897806, 1321513539, 4196548124, 1327113847,
-            1324585761, 2607333521, 3941807150, 2781966818, 3479697134, 3160542733, 164333355,
-            201360462,  588730442,  1432325095, 641933516,  2164460271, 4215706423, 97008802,
-            3984399154, 4245242938, 2971084648, 2197942956, 1977616806, 4075611152, 2293028149,
-            4014925430, 2522843722, 3970327125, 3809964597, 2276914221, 2991024636, 645070793,
-            787994346,  446898755,  1706182840, 1379979267, 2578671652, 760330145,  89247329,
-            3580887415, 3246391157, 421267664,  3482951357, 4199172999, 578980375,  4071922422,
-            4078076318, 685003684,  2779357818, 3353267599, 943993520,  2821668983, 3933776402,
-            1075032708, 1424840624, 4271910774, 3193602656, 904033428,  4036082495, 2016854673,
-            3877450832, 1397117022, 2988390003, 3612977584, 3963994351, 1600892655, 3912277726,
-            1372654124, 4096892782, 2749291591, 262924310,  1124621554, 2453436688, 1294011738,
-            3452167829, 2417233031, 3790905315, 1370240276, 154387409,  2599200884, 1973826015,
-            3733868272, 2225030726, 2790237669, 2012495447, 2449583804, 1386377950, 82304130,
-            926049383,  2366648630, 3357498057, 1861153754, 3991125352, 2259613280, 2320442215,
-            3985906099, 3956401732, 3143511719, 507227523,  3172835391, 2780546786, 4037857101,
-            1531901274, 3436344798, 2029544354, 901542699,  2683673703, 2141764987, 2976443357,
-            3942450529, 1222430268, 3032300230, 420008858,  4168521010, 2825658397, 1336763380,
-            1794674865, 3796429138, 3410724267, 4004350771, 266561106,  3124933754, 3848645222,
-            3105502455, 3607767957, 3827921318, 2429401235, 653656644,  3920968957, 2329611037,
-            1977639402, 1127928390, 1757737,    3141244961, 2612817427, 3783023236, 2464933592,
-            3614037777, 1722865652, 929534774,  2500803309, 959652883,  3416268285, 2438827467,
-            3738465206, 187406162,  1957206425, 181973781,  1624877056, 1831873488, 2152213351,
-            3084298137, 3767483937, 2538934869, 2046457544, 411515726,  3696999538, 2702921922,
-            1451499166, 2148815200, 4063176572, 3382608419, 2127601604, 2496429058, 3198787071,
-            503696649,  1391870642, 3031102768, 3035589403, 2044595016, 1239066869, 1530774937,
-            1359547332, 2661026817, 4049141773, 4238508402, 1096159207, 457255624,  1105093512,
-            4282440712, 2223193117, 4186615716, 272555482,  1702872970, 3999253463, 2000648188,
-            212829100,  2778001353, 39229117,   2355539376, 1589476953, 104090131,  3967965071,
-            983205867,  733520307,  2638004430, 2706486808, 1599567330, 1407427762, 2261427247,
-            169898650,  1790279890, 10556406,   2043469901, 298606878,  3565262177, 1063577135,
-            1264851745, 1831291192, 1433216964, 1226582437, 3435455061, 4176414350, 193004571,
-            3543542213, 2303145306, 1739959262, 568682225,  3497578236, 1503320002, 4168530551,
-            1929944052, 3069472006, 2454375124, 3889135208, 713354700,  2266135696, 244777405,
-            2648951942, 3685729262, 4164995084, 2617549996, 420915335,  2560925530, 245123887,
-            1791825302, 4161425231, 3296713881, 2037621249, 3654987556, 3802124379, 2528814764,
-            2527170977, 2732334348, 554586955,  1199224116, 1622533107, 3265644311, 2994573318,
-            2150750117, 1625050122, 3323613401, 328093389,  3675904303, 2844964908, 4056662894,
-            3716222005, 3969928076, 2845495028, 2712262411, 373445067,  3734338045, 2967653099,
-            631106466,  293656616,  815197429,  4038219322, 1950321555, 92152772,   1845340825,
-            1282553720, 3145395662, 628370058,  4096104291, 3524679717, 3918357090, 3673203197,
-            4268010463, 369669244,  183903999,  4273802010, 2665184347, 3459372051, 4174333524,
-            1508792191, 126014717,  460865998,  250156332,  3656082048, 3413284992, 3663527264,
-            716438914,  3361304179, 3729087092, 2482444890, 1771552275, 1315740307, 170194673,
-            3618969384, 451323606,  3504754036, 3936885810, 3550165025, 406529500,  2305206295,
-            1471339425, 2237459569, 4059330024, 4214015741, 2616553213, 4140123437, 2714780087,
-            369550894,  4136228879, 1641859674, 405191826,  3601042106, 184039112,  2883806730,
-            4251416724, 2104699380,
-        },
-        {
-            4117851084, 2941903397, 1156439261, 1922510465, 2925632294, 2272105738, 641404242,
-            3414739418, 2602896978, 672876430,  1998875331, 1325970749, 1633717408, 3567722815,
-            2088144733, 95705225,   580635702,  3543633503, 1469889369, 239816045,  2254984383,
-            1632695776, 2033839470, 4117902893, 509938588,  1291002316, 3600816069, 2962644092,
-            4269959520, 3161890066, 1908855486, 1177948589, 473118979,  3205649854, 2027137481,
-            227656706,  1485922673, 3380103860, 2080286336, 2588604114, 1727893393, 3602757903,
-            3126385963, 2101893784, 3058515017, 833779022,  719369683,  3768029740, 1123855192,
-            2580550821, 3694463505, 1137588651, 1724433728, 3847324234, 2368689516, 1226895255,
-            1126753016, 2557024841, 3187601018, 3790080711, 2423256074, 2463913828, 1753321774,
-            1621519784, 3456900204, 3550875802, 3783120790, 2740104077, 2010858632, 1569277627,
-            1492853575, 2182681191, 3866043645, 2566155095, 770150438,  2482504045, 3916834400,
-            222960658,  342285296,  3354506276, 1371039946, 3717269950, 3632913684, 2557531969,
-            3934379214, 1732115898, 1598596195, 1180866173, 3526785234, 2740387380, 3540138766,
-            338607286,  3262593182, 2413619772, 2248013920, 3557851982, 2470276596, 1549877186,
-            447909575,  4010548064, 282941857,  3418249797, 3300699992, 1957423733, 2615274674,
-            370155667,  1109991145, 933065597,  3947818943, 3221736239, 402503017,  4016454981,
-            3640556350, 243947268,  1175418215, 2752078014, 371928981,  3354635500, 3471578165,
-            2735623932, 445067764,  2732367763, 3225606514, 1214718589, 2197756425, 2134958042,
-            680726116,  3098695319, 2103463364, 4058022972, 2428195541, 2433504485, 4042288512,
-            2383438250, 3821638336, 2375226348, 806148488,  197247918,  768984129,  412771011,
-            4020619856, 3030619444, 3242554868, 282156707,  3718880754, 2938924979, 4189583150,
-            1604586306, 1245779881, 4006389745, 2437150739, 1749517801, 2903749036, 1247308303,
-            2580023735, 2457849017, 342934950,  216040419,  3176519601, 4151509434, 2404801649,
-            4117851084, 2941903397, 1156439261, 1922510465, 14864453,   2272105738, 641404242,
-            3414739418, 2602896978, 2179417586, 1998875331, 1325970749, 1633717408, 3567722815,
-            428880410,  95705225,   580635702,  3543633503, 1469889369, 3132946201, 2254984383,
-            1632695776, 2033839470, 4117902893, 3029657560, 1291002316, 3600816069, 2962644092,
-            4269959520, 397442545,  1908855486, 1177948589, 473118979,  3205649854, 990384909,
-            227656706,  1485922673, 3380103860, 2080286336, 3295033100, 1727893393, 3602757903,
-            3126385963, 2101893784, 1132286601, 833779022,  719369683,  3768029740, 1123855192,
-            283414013,  3694463505, 1137588651, 1724433728, 3847324234, 1735742473, 1226895255,
-            1126753016, 2557024841, 3187601018, 2090644528, 2423256074, 2463913828, 1753321774,
-            1621519784, 1037552449, 3550875802, 3783120790, 2740104077, 2010858632, 3730461081,
-            1492853575, 2182681191, 3866043645, 2566155095, 2782805925, 2482504045, 3916834400,
-            222960658,  342285296,  2406892654, 1371039946, 3717269950, 3632913684, 2557531969,
-            4071148456, 1732115898, 1598596195, 1180866173, 3526785234, 1110366522, 3540138766,
-            338607286,  3262593182, 2413619772, 995824548,  3557851982, 2470276596, 1549877186,
-            447909575,  2962194596, 282941857,  3418249797, 3300699992, 1957423733, 1859612288,
-            370155667,  1109991145, 933065597,  3947818943, 3005912276, 402503017,  4016454981,
-            3640556350, 243947268,  2884057401, 2752078014, 371928981,  3354635500, 3471578165,
-            908942821,  445067764,  2732367763, 3225606514, 1214718589, 4104754911, 2134958042,
-            680726116,  3098695319, 2103463364, 2946640978, 2428195541, 2433504485, 4042288512,
-            2383438250, 1252490765, 2375226348, 806148488,  197247918,  768984129,  2578888115,
-            4020619856, 3030619444, 3242554868, 282156707,  3433259466, 2938924979, 4189583150,
-            1604586306, 1245779881, 616758943,  2437150739, 1749517801, 2903749036, 1247308303,
-            2722580830, 2457849017, 342934950,  216040419,  3176519601, 545097903,  2404801649,
-            4117851084, 2941903397, 1156439261, 1253296096, 14864453,   2272105738, 641404242,
-            3414739418, 2989955985, 2179417586, 1998875331, 1325970749, 1633717408, 1896726594,
-            428880410,  95705225,   580635702,  3543633503, 3294258049, 3132946201, 2254984383,
-            1632695776, 2033839470, 829668922,  3029657560, 1291002316, 3600816069, 2962644092,
-            715635401,  397442545,  1908855486, 1177948589, 473118979,  443010703,  990384909,
-            227656706,  1485922673, 3380103860, 727464961,  3295033100, 1727893393, 3602757903,
-            3126385963, 3020775130, 1132286601, 833779022,  719369683,  3768029740, 2215591597,
-            283414013,  3694463505, 1137588651, 1724433728, 2124955521, 1735742473, 1226895255,
-            1126753016, 2557024841, 1719121879, 2090644528, 2423256074, 2463913828, 1753321774,
-            1283364713, 1037552449, 3550875802, 3783120790, 2740104077, 3326764615, 3730461081,
-            1492853575, 2182681191, 3866043645, 1353658829, 2782805925, 2482504045, 3916834400,
-            222960658,  2681616579, 2406892654, 1371039946, 3717269950, 3632913684, 2373372484,
-            4071148456, 1732115898, 1598596195, 1180866173, 3787873944, 1110366522, 3540138766,
-            338607286,  3262593182, 1714619779, 995824548,  3557851982, 2470276596, 1549877186,
-            2342751414, 2962194596, 282941857,  3418249797, 3300699992, 2080590834, 1859612288,
-            370155667,  1109991145, 933065597,  4126279826, 3005912276, 402503017,  4016454981,
-            3640556350, 618040940,  2884057401, 2752078014, 371928981,  3354635500, 2952377979,
-            908942821,  445067764,  2732367763, 3225606514, 935181950,  4104754911, 2134958042,
-            680726116,  3098695319, 652514936,  2946640978, 2428195541, 2433504485, 4042288512,
-            1834165243, 1252490765, 2375226348, 806148488,  197247918,  1459523569, 2578888115,
-            4020619856, 3030619444, 3242554868, 2222750155, 3433259466, 2938924979, 4189583150,
-            1604586306, 400149547,  616758943,  2437150739, 1749517801, 2903749036, 571531698,
-            2722580830, 2457849017, 342934950,  216040419,  3302138698, 545097903,  2404801649,
-            4117851084, 2941903397, 2926001994, 1253296096, 14864453,   2272105738, 641404242,
-            2446601571, 2989955985, 2179417586, 1998875331, 1325970749, 2470418771, 1896726594,
-            428880410,  95705225,   580635702,  95529058,   3294258049, 3132946201, 2254984383,
-            1632695776, 3381575123, 829668922,  3029657560, 1291002316, 3600816069, 332821128,
-            715635401,  397442545,  1908855486, 1177948589, 3324147260, 443010703,  990384909,
-            227656706,  1485922673, 3468390490, 727464961,  3295033100, 1727893393, 3602757903,
-            3849734062, 3020775130, 1132286601, 833779022,  719369683,  3336941985, 2215591597,
-            283414013,  3694463505, 1137588651, 1245145305, 2124955521, 1735742473, 1226895255,
-            1126753016, 1536376839, 1719121879, 2090644528, 2423256074, 2463913828, 4035794571,
-            1283364713, 1037552449, 3550875802, 3783120790, 4233012781, 3326764615, 3730461081,
-            1492853575, 2182681191, 654850701,  1353658829, 2782805925, 2482504045, 3916834400,
-            1556782509, 2681616579, 2406892654, 1371039946, 3717269950, 1227526114, 2373372484,
-            4071148456, 1732115898, 1598596195, 1777009717, 3787873944, 1110366522, 3540138766,
-            338607286,  1161080599, 1714619779, 995824548,  3557851982, 2470276596, 3162659171,
-            2342751414, 2962194596, 282941857,  3418249797, 1032034511, 2080590834, 1859612288,
-            370155667,  1109991145, 2568097099, 4126279826, 3005912276, 402503017,  4016454981,
-            3196575353, 618040940,  2884057401, 2752078014, 371928981,  4223799564, 2952377979,
-            908942821,  445067764,  2732367763, 174723563,  935181950,  4104754911, 2134958042,
-            680726116,  649687363,  652514936,  2946640978, 2428195541, 2433504485, 3735735592,
-            1834165243, 1252490765, 2375226348, 806148488,  3720638976, 1459523569, 2578888115,
-            4020619856, 3030619444, 283333114,  2222750155, 3433259466, 2938924979, 4189583150,
-            870522428,  400149547,  616758943,  2437150739, 1749517801, 999295363,  571531698,
-            2722580830, 2457849017, 342934950,  3151292467, 2839665217, 2452261456, 208520727,
-            2269948412, 344787478,  3987474076, 3770524881, 2718719281, 2537804795, 850790212,
-            639946566,  2073602691, 2316769983, 3577216077, 3538374748, 61447995,   3718817085,
-            1476398788, 3239144530, 3595014456, 454482110,  286330934,  2119173159, 1693518756,
-            1464218560, 1201825197, 1112746405, 2988579776, 1626663767, 2236015969, 4018896468,
-            1885926862, 671386673,  1583086162, 1114723892, 2936863300, 2620955107, 2628074015,
-            426673611,  3370181092, 3462245129, 3590185736, 2630441788, 171626554,  3647663038,
-            880996914,  1155913149, 2653278555, 508978149,  2031872445, 3041145171, 1339819022,
-            127509725,  1336955078, 727702092,  693349672,  999665905,  2287631318, 961427722,
-            3355851447, 821851136,  2370998072, 4027450519, 2054803464, 144596514,  3295312213,
-            2579322479, 2982266864, 4275468400, 179988815,  2123828208, 1486957870, 2484928010,
-            288096701,  1211834301, 1819157080, 3569000238, 4164201803, 3042117433, 2741571248,
-            3688451311, 29376415,   437788821,  994675658,  1014591996, 296335443,  363551454,
-            2628890394, 332401256,  2288239762, 3766239385, 317162173,  3721125104, 2296650899,
-            56428392,   3900411067, 2303724992, 3735005983, 1377320198, 612032498,  1171213235,
-            2494454628, 1894368149, 4124860986, 1694123597, 2306091209, 2075278956, 3898366152,
-            937522278,  32800830,   324902076,  2365753207, 2251160429, 1692543836, 2920424644,
-            119047416,  1821685115, 1486296407, 3055580738, 3711421730, 1522703457, 1422399573,
-            2515073038, 3788816887, 3490575947, 2395299159, 4248373284, 3383561277, 3128107243,
-            2344292809, 1806504793, 3087395022, 4113720664, 2749262038, 395148869,  1331347439,
-            2682558741, 1253966763, 4204248490, 2083995727, 2717069903, 4144872894, 1857751053,
-            2166276701, 1419950839, 1145170701, 3225260742, 211743500,  2746391743, 3333387219,
-            4115426799, 3801457092, 3327614811, 1460971336, 2256342146, 3186427137, 2684216499,
-            1035644397, 2948948308,
-        },
-        {
-            1219261098, 1267184784, 594006317,  985125700,  3031624805, 2876142206, 2938691653,
-            120543987,  40456301,   2143758111, 735245928,  208753770,  3091275316, 2978626835,
-            1936113447, 3035602369, 2877191093, 888099293,  2494476690, 3127992907, 3200875422,
-            2186210892, 3144098859, 664812663,  2159093702, 69510376,   2144603827, 1901451081,
-            2380689679, 1000768401, 2870362137, 563759191,  3611791267, 1533437206, 704529691,
-            1727567247, 2516683609, 2985615778, 1037209732, 2280704298, 3900487548, 1238958201,
-            3811458449, 1826186774, 2639243060, 484294245,  3715677603, 1785248825, 1979410666,
-            269135304,  1895745256, 3341749139, 4120209241, 2091588386, 1788029809, 1208195499,
-            136196263,  2636209387, 4162589824, 3748758934, 262405198,  571940555,  2706208220,
-            2380544476, 2601582634, 3288770830, 2295822692, 3792657002, 319673899,  3459446010,
-            2310107508, 4279148143, 2734157470, 4193030096, 3492640956, 4063389737, 837344045,
-            725646720,  1194806245, 849265739,  1392589263, 1134269497, 1313892697, 757865348,
-            1452608836, 3267471882, 3816078164, 603870747,  131421080,  4130469864, 3781816987,
-            336815565,  2809439388, 2364709264, 1318498470, 376135674,  4155980234, 724087166,
-            912381423,  2527845193, 3320328914, 3962995147, 1989842740, 304733223,  1263584796,
-            4030585331, 448501425,  3800548210, 3968390831, 4145428079, 3231413044, 397406166,
-            93647527,   2321210204, 3841828483, 624035395,  2614734882, 2666055064, 2962958253,
-            2927892773, 1849751919, 2702625529, 996438392,  3194316954, 1785554218, 1898973444,
-            1651944016, 4240176248, 1736496152, 3323023758, 1638522306, 2156698666, 2668376465,
-            1271761456, 2388657773, 853507205,  3487079100, 789765766,  3260312172, 3876999118,
-            151881712,  464531801,  1814197234, 266270505,  3263078112, 61198111,   4056297224,
-            4280963895, 3288543639, 2373594821, 768872067,  214029851,  3967144728, 1646287950,
-            541247530,  1219744681, 242283037,  1919049791, 2203714231, 412497855,  3599412659,
-            1219261098, 1267184784, 594006317,  985125700,  4094836914, 2876142206, 2938691653,
-            120543987,  40456301,   2459805488, 735245928,  208753770,  3091275316, 2978626835,
-            697281811,  3035602369, 2877191093, 888099293,  2494476690, 1544358348, 3200875422,
-            2186210892, 3144098859, 664812663,  752320072,  69510376,   2144603827, 1901451081,
-            2380689679, 2599305443, 2870362137, 563759191,  3611791267, 1533437206, 3825667144,
-            1727567247, 2516683609, 2985615778, 1037209732, 268468173,  3900487548, 1238958201,
-            3811458449, 1826186774, 312200088,  484294245,  3715677603, 1785248825, 1979410666,
-            2422254356, 1895745256, 3341749139, 4120209241, 2091588386, 2100273346, 1208195499,
-            136196263,  2636209387, 4162589824, 2676890301, 262405198,  571940555,  2706208220,
-            2380544476, 1226322713, 3288770830, 2295822692, 3792657002, 319673899,  1901328431,
-            2310107508, 4279148143, 2734157470, 4193030096, 49725303,   4063389737, 837344045,
-            725646720,  1194806245, 2037722624, 1392589263, 1134269497, 1313892697, 757865348,
-            1665180607, 3267471882, 3816078164, 603870747,  131421080,  95371287,   3781816987,
-            336815565,  2809439388, 2364709264, 1470382018, 376135674,  4155980234, 724087166,
-            912381423,  555414881,  3320328914, 3962995147, 1989842740, 304733223,  2483943445,
-            4030585331, 448501425,  3800548210, 3968390831, 2662139502, 3231413044, 397406166,
-            93647527,   2321210204, 248577269,  624035395,  2614734882, 2666055064, 2962958253,
-            3627767402, 1849751919, 2702625529, 996438392,  3194316954, 2475710056, 1898973444,
-            1651944016, 4240176248, 1736496152, 552159478,  1638522306, 2156698666, 2668376465,
-            1271761456, 3436157159, 853507205,  3487079100, 789765766,  3260312172, 3652100460,
-            151881712,  464531801,  1814197234, 266270505,  3394414616, 61198111,   4056297224,
-            4280963895, 3288543639, 3863909680, 768872067,  214029851,  3967144728, 1646287950,
-            3083864096, 1219744681, 242283037,  1919049791, 2203714231, 501478214,  3599412659,
-            1219261098, 1267184784, 594006317,  611457565,  4094836914, 2876142206, 2938691653,
-            120543987,  1671548132, 2459805488, 735245928,  208753770,  3091275316, 2226948411,
-            697281811,  3035602369, 2877191093, 888099293,  3537526319, 1544358348, 3200875422,
-            2186210892, 3144098859, 1244544573, 752320072,  69510376,   2144603827, 1901451081,
-            2324951894, 2599305443, 2870362137, 563759191,  3611791267, 1808998056, 3825667144,
-            1727567247, 2516683609, 2985615778, 3127508494, 268468173,  3900487548, 1238958201,
-            3811458449, 1972583851, 312200088,  484294245,  3715677603, 1785248825, 1505055668,
-            2422254356, 1895745256, 3341749139, 4120209241, 3179676404, 2100273346, 1208195499,
-            136196263,  2636209387, 3755825408, 2676890301, 262405198,  571940555,  2706208220,
-            1494691097, 1226322713, 3288770830, 2295822692, 3792657002, 3920669879, 1901328431,
-            2310107508, 4279148143, 2734157470, 2467634556, 49725303,   4063389737, 837344045,
-            725646720,  1693260745, 2037722624, 1392589263, 1134269497, 1313892697, 195973099,
-            1665180607, 3267471882, 3816078164, 603870747,  989499311,  95371287,   3781816987,
-            336815565,  2809439388, 2074809382, 1470382018, 376135674,  4155980234, 724087166,
-            3378410859, 555414881,  3320328914, 3962995147, 1989842740, 3621311625, 2483943445,
-            4030585331, 448501425,  3800548210, 2543408225, 2662139502, 3231413044, 397406166,
-            93647527,   2581458409, 248577269,  624035395,  2614734882, 2666055064, 3640480178,
-            3627767402, 1849751919, 2702625529, 996438392,  1067090474, 2475710056, 1898973444,
-            1651944016, 4240176248, 447434022,  552159478,  1638522306, 2156698666, 2668376465,
-            3313038855, 3436157159, 853507205,  3487079100, 789765766,  2137910750, 3652100460,
-            151881712,  464531801,  1814197234, 2672836458, 3394414616, 61198111,   4056297224,
-            4280963895, 4182983831, 3863909680, 768872067,  214029851,  3967144728, 2537232757,
-            3083864096, 1219744681, 242283037,  1919049791, 2503528566, 501478214,  3599412659,
-            1219261098, 1267184784, 945863549,  611457565,  4094836914, 2876142206, 2938691653,
-            3957693576, 1671548132, 2459805488, 735245928,  208753770,  3541562762, 2226948411,
-            697281811,  3035602369, 2877191093, 151157582,  3537526319, 1544358348, 3200875422,
-            2186210892, 1090574418, 1244544573, 752320072,  69510376,   2144603827, 1223439055,
-            2324951894, 2599305443, 2870362137, 563759191,  823942580,  1808998056, 3825667144,
-            1727567247, 2516683609, 387706229,  3127508494, 268468173,  3900487548, 1238958201,
-            3859521837, 1972583851, 312200088,  484294245,  3715677603, 4291520786, 1505055668,
-            2422254356, 1895745256, 3341749139, 3278886895, 3179676404, 2100273346, 1208195499,
-            136196263,  2121836721, 3755825408, 2676890301, 262405198,  571940555,  2182998370,
-            1494691097, 1226322713, 3288770830, 2295822692, 3064335974, 3920669879, 1901328431,
-            2310107508, 4279148143, 53041801,   2467634556, 49725303,   4063389737, 837344045,
-            3666682602, 1693260745, 2037722624, 1392589263, 1134269497, 2399079086, 195973099,
-            1665180607, 3267471882, 3816078164, 2372536627, 989499311,  95371287,   3781816987,
-            336815565,  2110787568, 2074809382, 1470382018, 376135674,  4155980234, 956511483,
-            3378410859, 555414881,  3320328914, 3962995147, 4060343870, 3621311625, 2483943445,
-            4030585331, 448501425,  748300966,  2543408225, 2662139502, 3231413044, 397406166,
-            1965912376, 2581458409, 248577269,  624035395,  2614734882, 1633508006, 3640480178,
-            3627767402, 1849751919, 2702625529, 3106442208, 1067090474, 2475710056, 1898973444,
-            1651944016, 3260272990, 447434022,  552159478,  1638522306, 2156698666, 157776824,
-            3313038855, 3436157159, 853507205,  3487079100, 2628163361, 2137910750, 3652100460,
-            151881712,  464531801,  221748411,  2672836458, 3394414616, 61198111,   4056297224,
-            3497622718, 4182983831, 3863909680, 768872067,  214029851,  2707190311, 2537232757,
-            3083864096, 1219744681, 242283037,  863288260,  842528681,  2437790895, 4088275250,
-            2176561094, 2029195092, 290465412,  2885316587, 1193069911, 2444113907, 3621515025,
-            377453687,  2844999558, 953936456,  2428850751, 2418872299, 2371466094, 581882321,
-            4279220490, 2797034315, 2491128859, 3197745216, 3026792494, 985267294,  281540527,
-            1371771565, 2664977266, 418701838,  2111604954, 513526518,  708906990,  3696070421,
-            64320254,   2211204639, 642992869,  3462613263, 726395780,  4096705992, 3981934464,
-            476123958,  601906965,  3626686017, 3537749436, 2495049839, 1570642331, 2384140685,
-            3422719809, 1241453724, 1734600388, 1488796633, 3202396724, 1426788029, 452426754,
-            243877091,  635253304,  3560243007, 3031838948, 4252939776, 2546923833, 1444681197,
-            3973145633, 2963205619, 1449839134, 559275656,  3977265337, 2752657377, 4033783414,
-            1007106496, 587424632,  2685231105, 337696155,  373891339,  2216596469, 1537912883,
-            689277912,  2750224436, 4098786320, 396357627,  2312205695, 1251290983, 574038371,
-            959020781,  3903917611, 3286655615, 2335986208, 3596712181, 2508108463, 1444702625,
-            1191750263, 523941727,  3033529078, 2078744137, 2934430697, 4212017823, 1563362024,
-            1418380973, 1891923607, 2629314035, 829829681,  92327702,   3247668580, 3044371215,
-            1377976916, 467339664,  2408680820, 3454058740, 3368850661, 1918132329, 2599663394,
-            886351356,  1111682444, 4026157583, 1346818401, 1195948780, 1827096464, 1503576010,
-            2547468098, 4201261056, 580756189,  1833128352, 1306862224, 772365360,  1759755941,
-            1369617974, 121024716,  4147100207, 1832919045, 2091528030, 1578814253, 1415108650,
-            2166525221, 673566479,  2309189091, 3946090056, 783117799,  3143928240, 4099965611,
-            3592910376, 1793914174, 2682755690, 45163526,   2652353319, 3782893305, 953483157,
-            836335717,  591860170,  779128177,  2971709979, 2071075331, 2027410716, 1800704884,
-            3140349898, 1115597661, 2754625133, 2313433326, 1180922019, 3879666308, 1879317489,
-            3352564689, 2405941368,
-        },
-        {
-            216975964,  4145824263, 2147471723, 4154469597, 161744273,  1299764439, 3468614543,
-            4190517158, 4124232403, 754999274,  208153182,  1442063188, 2940825403, 729331312,
-            2124186505, 1136411459, 1083787490, 442264548,  442338468,  464589685,  3509461223,
-            4241734851, 370778328,  4003105058, 3163637982, 3747133182, 1433548371, 1876378240,
-            536564977,  1171222160, 3268902719, 2725776746, 1547771137, 2818791461, 4129042013,
-            2677094853, 1594765197, 1556725424, 569252594,  2640731848, 2947042710, 2633188904,
-            1640957370, 1806863786, 2803403654, 2632220187, 2740076538, 383549855,  3211856699,
-            3933793958, 1988232112, 404006876,  1369488120, 1963339964, 609604643,  2488118016,
-            3936354252, 1980115609, 189069630,  860670414,  85775513,   2447581620, 886385122,
-            3047212472, 2470718978, 4044569663, 430717074,  1598133481, 1905362808, 2981511487,
-            1842297666, 2992320857, 1682119455, 1753461544, 700013801,  3025873251, 3413358770,
-            1673092091, 113651375,  2618875026, 1479752146, 81598739,   1530418117, 962911586,
-            778994423,  3944331100, 4116504755, 480712357,  1078821437, 1091665476, 3696871260,
-            2074607518, 3226459752, 3767432525, 768289441,  3142741843, 2969151790, 1814889320,
-            2122849610, 451935137,  2784993892, 1836517944, 1565951586, 1663606442, 1578543925,
-            33407321,   1445768530, 2156093253, 3164165477, 3093293932, 298945371,  2558835427,
-            1386275152, 2649603495, 893605644,  1147537351, 1889670166, 3203610476, 2598985714,
-            966335150,  3384227644, 2584671737, 552770393,  2430097209, 3085150053, 3633667948,
-            1319147485, 1999467843, 3676133150, 2314789604, 1443760911, 1552954684, 2411684219,
-            3708965016, 2607719926, 484007519,  491681421,  2498192461, 6342020,    4226570819,
-            2329860147, 1097040622, 1270325434, 2572535504, 918592905,  193599782,  4223250613,
-            1640082589, 1817957216, 2937344769, 3768793871, 2982566292, 1607453458, 4096207317,
-            696907828,  2431936270, 627206620,  3267100287, 1161821973, 2322099303, 1700245615,
-            216975964,  4145824263, 2147471723, 4154469597, 2836499116, 1299764439, 3468614543,
-            4190517158, 4124232403, 2176257299, 208153182,  1442063188, 2940825403, 729331312,
-            2954254860, 1136411459, 1083787490, 442264548,  442338468,  3098695824, 3509461223,
-            4241734851, 370778328,  4003105058, 2963948505, 3747133182, 1433548371, 1876378240,
-            536564977,  1565224991, 3268902719, 2725776746, 1547771137, 2818791461, 2118790546,
-            2677094853, 1594765197, 1556725424, 569252594,  610771792,  2947042710, 2633188904,
-            1640957370, 1806863786, 2121022793, 2632220187, 2740076538, 383549855,  3211856699,
-            14274926,   1988232112, 404006876,  1369488120, 1963339964, 1661081792, 2488118016,
-            3936354252, 1980115609, 189069630,  595192504,  85775513,   2447581620, 886385122,
-            3047212472, 1596069326, 4044569663, 430717074,  1598133481, 1905362808, 2670961612,
-            1842297666, 2992320857, 1682119455, 1753461544, 1121764918, 3025873251, 3413358770,
-            1673092091, 113651375,  1721474883, 1479752146, 81598739,   1530418117, 962911586,
-            3478535046, 3944331100, 4116504755, 480712357,  1078821437, 1456786415, 3696871260,
-            2074607518, 3226459752, 3767432525, 2947648865, 3142741843, 2969151790, 1814889320,
-            2122849610, 3367879697, 2784993892, 1836517944, 1565951586, 1663606442, 2621366329,
-            33407321,   1445768530, 2156093253, 3164165477, 619266142,  298945371,  2558835427,
-            1386275152, 2649603495, 97967685,   1147537351, 1889670166, 3203610476, 2598985714,
-            504495866,  3384227644, 2584671737, 552770393,  2430097209, 2168477293, 3633667948,
-            1319147485, 1999467843, 3676133150, 2755203144, 1443760911, 1552954684, 2411684219,
-            3708965016, 2301846628, 484007519,  491681421,  2498192461, 6342020,    318325395,
-            2329860147, 1097040622, 1270325434, 2572535504, 3458698828, 193599782,  4223250613,
-            1640082589, 1817957216, 1861636211, 3768793871, 2982566292, 1607453458, 4096207317,
-            1871072589, 2431936270, 627206620,  3267100287, 1161821973, 3904037207, 1700245615,
-            216975964,  4145824263, 2147471723, 2789343849, 2836499116, 1299764439, 3468614543,
-            4190517158, 639361502,  2176257299, 208153182,  1442063188, 2940825403, 2962998954,
-            2954254860, 1136411459, 1083787490, 442264548,  1812626669, 3098695824, 3509461223,
-            4241734851, 370778328,  1673951193, 2963948505, 3747133182, 1433548371, 1876378240,
-            3651623536, 1565224991, 3268902719, 2725776746, 1547771137, 1938402968, 2118790546,
-            2677094853, 1594765197, 1556725424, 3267956202, 610771792,  2947042710, 2633188904,
-            1640957370, 1448040688, 2121022793, 2632220187, 2740076538, 383549855,  300148175,
-            14274926,   1988232112, 404006876,  1369488120, 3313508750, 1661081792, 2488118016,
-            3936354252, 1980115609, 2631341293, 595192504,  85775513,   2447581620, 886385122,
-            2465820467, 1596069326, 4044569663, 430717074,  1598133481, 4191772516, 2670961612,
-            1842297666, 2992320857, 1682119455, 997741285,  1121764918, 3025873251, 3413358770,
-            1673092091, 1493832846, 1721474883, 1479752146, 81598739,   1530418117, 2762019274,
-            3478535046, 3944331100, 4116504755, 480712357,  448437372,  1456786415, 3696871260,
-            2074607518, 3226459752, 2507199309, 2947648865, 3142741843, 2969151790, 1814889320,
-            2268952501, 3367879697, 2784993892, 1836517944, 1565951586, 377207573,  2621366329,
-            33407321,   1445768530, 2156093253, 1325490318, 619266142,  298945371,  2558835427,
-            1386275152, 2662699426, 97967685,   1147537351, 1889670166, 3203610476, 1999783658,
-            504495866,  3384227644, 2584671737, 552770393,  1562106652, 2168477293, 3633667948,
-            1319147485, 1999467843, 2037219988, 2755203144, 1443760911, 1552954684, 2411684219,
-            1579607443, 2301846628, 484007519,  491681421,  2498192461, 745333677,  318325395,
-            2329860147, 1097040622, 1270325434, 208017379,  3458698828, 193599782,  4223250613,
-            1640082589, 4049245262, 1861636211, 3768793871, 2982566292, 1607453458, 2058912455,
-            1871072589, 2431936270, 627206620,  3267100287, 1186015034, 3904037207, 1700245615,
-            216975964,  4145824263, 2422827462, 2789343849, 2836499116, 1299764439, 3468614543,
-            2084839633, 639361502,  2176257299, 208153182,  1442063188, 4065931048, 2962998954,
-            2954254860, 1136411459, 1083787490, 465529524,  1812626669, 3098695824, 3509461223,
-            4241734851, 3818602366, 1673951193, 2963948505, 3747133182, 1433548371, 2475307467,
-            3651623536, 1565224991, 3268902719, 2725776746, 2374226870, 1938402968, 2118790546,
-            2677094853, 1594765197, 348828658,  3267956202, 610771792,  2947042710, 2633188904,
-            1713124265, 1448040688, 2121022793, 2632220187, 2740076538, 1400362266, 300148175,
-            14274926,   1988232112, 404006876,  3662575932, 3313508750, 1661081792, 2488118016,
-            3936354252, 3100635752, 2631341293, 595192504,  85775513,   2447581620, 2417839883,
-            2465820467, 1596069326, 4044569663, 430717074,  1093503127, 4191772516, 2670961612,
-            1842297666, 2992320857, 3292586028, 997741285,  1121764918, 3025873251, 3413358770,
-            222522839,  1493832846, 1721474883, 1479752146, 81598739,   3132900738, 2762019274,
-            3478535046, 3944331100, 4116504755, 3429405501, 448437372,  1456786415, 3696871260,
-            2074607518, 1492852861, 2507199309, 2947648865, 3142741843, 2969151790, 2186889362,
-            2268952501, 3367879697, 2784993892, 1836517944, 3169157745, 377207573,  2621366329,
-            33407321,   1445768530, 4266168148, 1325490318, 619266142,  298945371,  2558835427,
-            1447045944, 2662699426, 97967685,   1147537351, 1889670166, 3354555370, 1999783658,
-            504495866,  3384227644, 2584671737, 2489662408, 1562106652, 2168477293, 3633667948,
-            1319147485, 3353555249, 2037219988, 2755203144, 1443760911, 1552954684, 4137514176,
-            1579607443, 2301846628, 484007519,  491681421,  164627749,  745333677,  318325395,
-            2329860147, 1097040622, 3587444362, 208017379,  3458698828, 193599782,  4223250613,
-            1102471426, 4049245262, 1861636211, 3768793871, 2982566292, 1941698603, 2058912455,
-            1871072589, 2431936270, 627206620,  2511999766, 1406946444, 1571284360, 1416792763,
-            1774410400, 1655066897, 740531687,  2852637013, 1574342442, 3931672444, 2887289502,
-            3588598337, 1607795590, 1893126336, 4113959952, 250670029,  89330705,   2198706475,
-            133060312,  4033807246, 2161604768, 3871950931, 1820516188, 828316231,  3126087794,
-            3740050736, 543577819,  1589693651, 4210480257, 3844498352, 96010254,   2888517657,
-            2931088981, 2307454606, 2411141663, 4193964276, 918899600,  888509951,  3023902229,
-            1371276096, 2107726407, 3863079906, 3849297291, 1512401618, 3098628219, 487705749,
-            492891601,  345791371,  3230138831, 1022138839, 974682588,  3677932604, 2054641860,
-            3303576494, 1416653965, 1119635666, 1907978487, 4269977208, 2047880336, 205698774,
-            2401894999, 3253173123, 2603439113, 1295808319, 2965198050, 1718424301, 1605627562,
-            2860017421, 1619060227, 1130717786, 2992070906, 2964091191, 3192265220, 3860528275,
-            45139953,   3914023193, 1253834497, 3885013544, 3793695046, 3632364934, 4127361980,
-            3323804519, 4117285262, 4171102020, 1863837906, 2848174924, 1731389076, 2514130112,
-            3539384422, 2950752200, 1138137434, 4147328087, 3345958235, 2305097760, 974161669,
-            1739611700, 2522036172, 1196649816, 2395301283, 911135539,  1029496076, 1786766951,
-            1802412425, 3485017668, 2837835718, 1951207514, 1447650206, 2289702688, 2517625074,
-            2408021138, 2022522416, 719777136,  417238676,  1865171065, 801820378,  2836941189,
-            1148226009, 1713866138, 64608707,   1458585813, 3581572089, 2251042907, 1818903516,
-            3278072806, 2838874249, 2665607605, 3360214955, 2185961451, 410342713,  364484774,
-            2887998484, 2100888426, 1394314931, 1362560504, 3487221127, 3140021092, 3168968161,
-            1613267484, 290430673,  2588210538, 2493788232, 2641638765, 2971195072, 2749469779,
-            692014176,  3268150742, 387451740,  461249727,  3579417331, 3738405845, 385445455,
-            1464799053, 2786433795, 3370371952, 675344511,  4049011269, 2196568686, 4166285481,
-            2547135972, 119952106,
-        },
-        {
-            1294107716, 4083134066, 1647291621, 4084107324, 411543479,  2167874178, 3741472320,
-            2737004384, 3333933522, 1690595019, 1734289038, 1090547146, 2188382369, 1330758482,
-            1663532472, 2483582935, 752844068,  3158938453, 2010661171, 3557365654, 2371394649,
-            4034803934, 4062640406, 2497835837, 3715196998, 2408447039, 3022287375, 204615457,
-            3543468307, 4184649607, 2336422575, 3192465186, 3455689659, 3979758499, 2393644392,
-            1139484331, 2458478505, 1173272547, 4032405651, 1823942788, 678001464,  3900392600,
-            3705490065, 2404357956, 3565648014, 4199181596, 1644767500, 1779157993, 203675431,
-            2145816638, 4196714706, 460298480,  3657454718, 3093347744, 3658196718, 1448311673,
-            43305839,   290883038,  4063681999, 1359864384, 3481561371, 3103820018, 1705656001,
-            1288302222, 879242458,  265135685,  97785029,   2349173016, 2494184523, 3639402832,
-            3880103597, 1459422373, 1307051729, 1136058812, 2467873861, 30109066,   217013154,
-            1226168179, 2300413344, 1294957893, 1899599754, 1243497578, 1206978737, 601580771,
-            773006514,  1764185201, 3535952892, 3083923116, 323207287,  3956432886, 3409226801,
-            866107626,  273585717,  3585805063, 1962280739, 182323415,  566608890,  1046446807,
-            1754114701, 1212677504, 1635430524, 111081465,  1448125852, 4092103508, 2822397252,
-            2199116591, 2357396102, 2596081284, 178388888,  4202135191, 1685176762, 1725949772,
-            3064764308, 3664772322, 2627640426, 2383968485, 4279440604, 3079482884, 1743921735,
-            1433536461, 9520765,    3633850803, 3309428237, 1958966829, 726286160,  2698713511,
-            3817745200, 2815958313, 410617480,  3486006626, 1869295752, 2649706793, 1352413893,
-            3776952897, 1180681936, 2937050803, 2135283464, 4133102213, 2985163104, 3362386873,
-            543063756,  2564555546, 3510929925, 396038891,  4284427171, 2291693851, 3127371533,
-            2829908835, 1850380794, 613196229,  1248337717, 2845904017, 196010235,  3428268458,
-            2550190367, 2343903258, 520070697,  644025426,  3119647371, 1261101025, 2429319838,
-            1294107716, 4083134066, 1647291621, 4084107324, 1409019206, 2167874178, 3741472320,
-            2737004384, 3333933522, 2480065453, 1734289038, 1090547146, 2188382369, 1330758482,
-            2443553084, 2483582935, 752844068,  3158938453, 2010661171, 33847777,   2371394649,
-            4034803934, 4062640406, 2497835837, 3333166927, 2408447039, 3022287375, 204615457,
-            3543468307, 1937225249, 2336422575, 3192465186, 3455689659, 3979758499, 1814377444,
-            1139484331, 2458478505, 1173272547, 4032405651, 3072771922, 678001464,  3900392600,
-            3705490065, 2404357956, 3212133331, 4199181596, 1644767500, 1779157993, 203675431,
-            2199505975, 4196714706, 460298480,  3657454718, 3093347744, 2862068292, 1448311673,
-            43305839,   290883038,  4063681999, 3168634767, 3481561371, 3103820018, 1705656001,
-            1288302222, 3458817867, 265135685,  97785029,   2349173016, 2494184523, 2271639532,
-            3880103597, 1459422373, 1307051729, 1136058812, 4035412438, 30109066,   217013154,
-            1226168179, 2300413344, 360184601,  1899599754, 1243497578, 1206978737, 601580771,
-            2629223974, 1764185201, 3535952892, 3083923116, 323207287,  2339822832, 3409226801,
-            866107626,  273585717,  3585805063, 2039812361, 182323415,  566608890,  1046446807,
-            1754114701, 695041685,  1635430524, 111081465,  1448125852, 4092103508, 4104065873,
-            2199116591, 2357396102, 2596081284, 178388888,  1288207178, 1685176762, 1725949772,
-            3064764308, 3664772322, 919915591,  2383968485, 4279440604, 3079482884, 1743921735,
-            233732278,  9520765,    3633850803, 3309428237, 1958966829, 1071682605, 2698713511,
-            3817745200, 2815958313, 410617480,  3173059276, 1869295752, 2649706793, 1352413893,
-            3776952897, 3828917100, 2937050803, 2135283464, 4133102213, 2985163104, 2794405343,
-            543063756,  2564555546, 3510929925, 396038891,  2065532014, 2291693851, 3127371533,
-            2829908835, 1850380794, 1786571580, 1248337717, 2845904017, 196010235,  3428268458,
-            3820599864, 2343903258, 520070697,  644025426,  3119647371, 3202277881, 2429319838,
-            1294107716, 4083134066, 1647291621, 1038516338, 1409019206, 2167874178, 3741472320,
-            2737004384, 1261106644, 2480065453, 1734289038, 1090547146, 2188382369, 3368739863,
-            2443553084, 2483582935, 752844068,  3158938453, 813298740,  33847777,   2371394649,
-            4034803934, 4062640406, 159622477,  3333166927, 2408447039, 3022287375, 204615457,
-            1144805557, 1937225249, 2336422575, 3192465186, 3455689659, 2265560490, 1814377444,
-            1139484331, 2458478505, 1173272547, 1851251452, 3072771922, 678001464,  3900392600,
-            3705490065, 2606421239, 3212133331, 4199181596, 1644767500, 1779157993, 2552835703,
-            2199505975, 4196714706, 460298480,  3657454718, 1118621555, 2862068292, 1448311673,
-            43305839,   290883038,  3953834641, 3168634767, 3481561371, 3103820018, 1705656001,
-            1606255467, 3458817867, 265135685,  97785029,   2349173016, 1506061686, 2271639532,
-            3880103597, 1459422373, 1307051729, 4089701844, 4035412438, 30109066,   217013154,
-            1226168179, 200088525,  360184601,  1899599754, 1243497578, 1206978737, 2475727521,
-            2629223974, 1764185201, 3535952892, 3083923116, 1435518183, 2339822832, 3409226801,
-            866107626,  273585717,  3199520557, 2039812361, 182323415,  566608890,  1046446807,
-            2582320949, 695041685,  1635430524, 111081465,  1448125852, 305556538,  4104065873,
-            2199116591, 2357396102, 2596081284, 44914711,   1288207178, 1685176762, 1725949772,
-            3064764308, 3039787691, 919915591,  2383968485, 4279440604, 3079482884, 2207342656,
-            233732278,  9520765,    3633850803, 3309428237, 1423270105, 1071682605, 2698713511,
-            3817745200, 2815958313, 1969625840, 3173059276, 1869295752, 2649706793, 1352413893,
-            403665430,  3828917100, 2937050803, 2135283464, 4133102213, 1483267976, 2794405343,
-            543063756,  2564555546, 3510929925, 4206216492, 2065532014, 2291693851, 3127371533,
-            2829908835, 4013802214, 1786571580, 1248337717, 2845904017, 196010235,  2316894483,
-            3820599864, 2343903258, 520070697,  644025426,  2959202011, 3202277881, 2429319838,
-            1294107716, 4083134066, 1664102186, 1038516338, 1409019206, 2167874178, 3741472320,
-            1491631969, 1261106644, 2480065453, 1734289038, 1090547146, 4135640281, 3368739863,
-            2443553084, 2483582935, 752844068,  3477538122, 813298740,  33847777,   2371394649,
-            4034803934, 2332828578, 159622477,  3333166927, 2408447039, 3022287375, 1758760467,
-            1144805557, 1937225249, 2336422575, 3192465186, 1145091218, 2265560490, 1814377444,
-            1139484331, 2458478505, 1919615494, 1851251452, 3072771922, 678001464,  3900392600,
-            3545874044, 2606421239, 3212133331, 4199181596, 1644767500, 3903127240, 2552835703,
-            2199505975, 4196714706, 460298480,  3724839577, 1118621555, 2862068292, 1448311673,
-            43305839,   4208254782, 3953834641, 3168634767, 3481561371, 3103820018, 1522555190,
-            1606255467, 3458817867, 265135685,  97785029,   621005488,  1506061686, 2271639532,
-            3880103597, 1459422373, 2912783910, 4089701844, 4035412438, 30109066,   217013154,
-            3059831435, 200088525,  360184601,  1899599754, 1243497578, 898542911,  2475727521,
-            2629223974, 1764185201, 3535952892, 3353593412, 1435518183, 2339822832, 3409226801,
-            866107626,  16943203,   3199520557, 2039812361, 182323415,  566608890,  333887209,
-            2582320949, 695041685,  1635430524, 111081465,  1565623064, 305556538,  4104065873,
-            2199116591, 2357396102, 3120929440, 44914711,   1288207178, 1685176762, 1725949772,
-            3106836128, 3039787691, 919915591,  2383968485, 4279440604, 1772190408, 2207342656,
-            233732278,  9520765,    3633850803, 4019165804, 1423270105, 1071682605, 2698713511,
-            3817745200, 3241262864, 1969625840, 3173059276, 1869295752, 2649706793, 600649929,
-            403665430,  3828917100, 2937050803, 2135283464, 2593342993, 1483267976, 2794405343,
-            543063756,  2564555546, 3166449544, 4206216492, 2065532014, 2291693851, 3127371533,
-            322692536,  4013802214, 1786571580, 1248337717, 2845904017, 2535153739, 2316894483,
-            3820599864, 2343903258, 520070697,  3700719844, 3720267317, 2162647565, 2823158015,
-            4195151466, 801844886,  3213978320, 1938418225, 2965528392, 2286902610, 4039735510,
-            481441200,  3040748515, 3557175683, 1128456527, 1117174638, 4243425780, 151087245,
-            2946952076, 3821585720, 2974519306, 3817293249, 3094274156, 527143633,  1866705333,
-            4083837804, 4059955347, 2427476031, 3115983000, 935177269,  3029545479, 3802588039,
-            4075477453, 4028364354, 539169311,  1224470083, 1025901934, 922888765,  3630586211,
-            3859157115, 2643185793, 1804620185, 2768309084, 4252018493, 2741976982, 2308458589,
-            1758330337, 4020662248, 25850002,   2670699398, 1054957459, 1416651519, 1904646574,
-            1534729970, 379585880,  832397247,  2368576249, 2202091706, 2106290099, 497507948,
-            2221966110, 2697363513, 4015483699, 1987502995, 296996891,  839650240,  472991486,
-            1364810921, 1693433352, 1827798962, 2184561572, 3185562918, 2850376555, 3086930808,
-            579130857,  1655984095, 1287656752, 1415421261, 914311846,  2666476895, 3731020825,
-            2755350939, 637275951,  2822855315, 1300786473, 1962742792, 315988284,  4221550058,
-            131327999,  2304439477, 451533874,  1308504891, 2575167487, 1916774460, 2574880738,
-            2213139657, 3948834217, 2460309053, 2841318003, 1815603754, 3426279177, 2318026105,
-            2563419813, 2498797616, 2828413915, 1403396107, 2061155959, 1627036723, 3886958395,
-            4247511986, 2431920461, 2165544995, 1614060339, 544377839,  2163458952, 1773482243,
-            3343905977, 1114330439, 3484610702, 126845783,  1442065561, 2332818665, 626487296,
-            1562131351, 2393338644, 1949113700, 135679614,  1942734937, 2576777126, 2548941245,
-            2883726286, 3817495303, 210660246,  3304098269, 3032005358, 399788826,  806083413,
-            3138218382, 1176832828, 327394921,  3076434616, 768470185,  1973760801, 3542748926,
-            4084494386, 2478098806, 789112574,  3585942482, 2929764284, 641261223,  2304364505,
-            2590124641, 1969219719, 522388411,  1430985870, 68329606,   2466889933, 420528606,
-            4205411302, 1897683964,
-        },
-        {
-            2307933966, 145940188,  4247815717, 2995341855, 3245382498, 1213200792, 232910392,
-            2718014238, 918321585,  3583102265, 3176078796, 937696513,  266558688,  1520650260,
-            3655025189, 1653323191, 538426778,  491545855,  4064663509, 2788350755, 3941259490,
-            3471552693, 1851151228, 3279627338, 845228710,  29883500,   1503432309, 593880175,
-            2488716480, 828058076,  3287933183, 3510981973, 3970051135, 3803049980, 898259836,
-            2890959433, 234437380,  201835406,  1523016285, 2419577439, 2943482079, 4219300984,
-            1490698759, 533411805,  1644926459, 4097374623, 265292490,  2694560848, 285667083,
-            1563945375, 3128365011, 95277844,   2938824634, 2717708621, 3374928056, 3672802273,
-            3445399260, 2422205637, 1106030557, 1269805720, 1781057614, 3491203689, 2454028630,
-            2158698380, 2578431870, 3540412661, 2206372988, 3138025266, 474100503,  3310048546,
-            126856999,  3144057206, 917199551,  3549528813, 343855771,  391118877,  1900257963,
-            1616289477, 3663959751, 1887891784, 697303016,  1346369879, 3634838543, 909311683,
-            3534738830, 2676838865, 3020679234, 1248902118, 1517698896, 414632197,  199589058,
-            2922557451, 3915079510, 1309075563, 3836275459, 2549095941, 1643088840, 1153547003,
-            2254144060, 3585420425, 915059870,  2410951596, 1876156254, 2384812180, 3893647829,
-            4119002503, 1535078752, 3888310943, 1483731374, 3915992153, 3662664617, 1065246672,
-            2307959656, 1845927873, 2075990232, 1346396900, 4218283385, 3427468026, 1518645158,
-            3092538772, 3383570452, 1317710387, 3390054918, 4222595168, 2468387909, 3864538174,
-            2442851586, 1858344050, 1537617445, 1090881039, 2055021834, 4011332463, 2797336692,
-            280272261,  3350338577, 1682666744, 1256176165, 2017003515, 3666229067, 4288064377,
-            3407437449, 2957152445, 3557139753, 4106922773, 2612653316, 3491950269, 1107293753,
-            2926461368, 1433860998, 1975669351, 1680462513, 4283282673, 168788571,  57021447,
-            3888396304, 2218068386, 2170981202, 1587568797, 2097820654, 1308061343, 4096726326,
-            2307933966, 145940188,  4247815717, 2995341855, 2894586378, 1213200792, 232910392,
-            2718014238, 918321585,  520434726,  3176078796, 937696513,  266558688,  1520650260,
-            645408471,  1653323191, 538426778,  491545855,  4064663509, 2605358672, 3941259490,
-            3471552693, 1851151228, 3279627338, 1290188176, 29883500,   1503432309, 593880175,
-            2488716480, 1172244224, 3287933183, 3510981973, 3970051135, 3803049980, 3836242189,
-            2890959433, 234437380,  201835406,  1523016285, 1720566850, 2943482079, 4219300984,
-            1490698759, 533411805,  982587365,  4097374623, 265292490,  2694560848, 285667083,
-            3905392425, 3128365011, 95277844,   2938824634, 2717708621, 262111126,  3672802273,
-            3445399260, 2422205637, 1106030557, 233401560,  1781057614, 3491203689, 2454028630,
-            2158698380, 3314008662, 3540412661, 2206372988, 3138025266, 474100503,  1150191741,
-            126856999,  3144057206, 917199551,  3549528813, 84516590,   391118877,  1900257963,
-            1616289477, 3663959751, 2831036790, 697303016,  1346369879, 3634838543, 909311683,
-            2206291004, 2676838865, 3020679234, 1248902118, 1517698896, 882506847,  199589058,
-            2922557451, 3915079510, 1309075563, 3675129276, 2549095941, 1643088840, 1153547003,
-            2254144060, 1702669516, 915059870,  2410951596, 1876156254, 2384812180, 393602062,
-            4119002503, 1535078752, 3888310943, 1483731374, 1135074988, 3662664617, 1065246672,
-            2307959656, 1845927873, 883002610,  1346396900, 4218283385, 3427468026, 1518645158,
-            1478839081, 3383570452, 1317710387, 3390054918, 4222595168, 3009846855, 3864538174,
-            2442851586, 1858344050, 1537617445, 2419526192, 2055021834, 4011332463, 2797336692,
-            280272261,  2937342669, 1682666744, 1256176165, 2017003515, 3666229067, 3563024742,
-            3407437449, 2957152445, 3557139753, 4106922773, 610182860,  3491950269, 1107293753,
-            2926461368, 1433860998, 2493047579, 1680462513, 4283282673, 168788571,  57021447,
-            2151356582, 2218068386, 2170981202, 1587568797, 2097820654, 2738927570, 4096726326,
-            2307933966, 145940188,  4247815717, 1887236689, 2894586378, 1213200792, 232910392,
-            2718014238, 2028538736, 520434726,  3176078796, 937696513,  266558688,  305624632,
-            645408471,  1653323191, 538426778,  491545855,  4188864445, 2605358672, 3941259490,
-            3471552693, 1851151228, 1720039364, 1290188176, 29883500,   1503432309, 593880175,
-            2595662526, 1172244224, 3287933183, 3510981973, 3970051135, 2763703998, 3836242189,
-            2890959433, 234437380,  201835406,  2652280530, 1720566850, 2943482079, 4219300984,
-            1490698759, 1968049758, 982587365,  4097374623, 265292490,  2694560848, 1165326939,
-            3905392425, 3128365011, 95277844,   2938824634, 2521869983, 262111126,  3672802273,
-            3445399260, 2422205637, 395183943,  233401560,  1781057614, 3491203689, 2454028630,
-            249721174,  3314008662, 3540412661, 2206372988, 3138025266, 1644439373, 1150191741,
-            126856999,  3144057206, 917199551,  1997133400, 84516590,   391118877,  1900257963,
-            1616289477, 3843764922, 2831036790, 697303016,  1346369879, 3634838543, 1901125181,
-            2206291004, 2676838865, 3020679234, 1248902118, 344347894,  882506847,  199589058,
-            2922557451, 3915079510, 2919277604, 3675129276, 2549095941, 1643088840, 1153547003,
-            3305575634, 1702669516, 915059870,  2410951596, 1876156254, 1416053196, 393602062,
-            4119002503, 1535078752, 3888310943, 3993632377, 1135074988, 3662664617, 1065246672,
-            2307959656, 1044670394, 883002610,  1346396900, 4218283385, 3427468026, 1792832168,
-            1478839081, 3383570452, 1317710387, 3390054918, 1596709924, 3009846855, 3864538174,
-            2442851586, 1858344050, 2428482265, 2419526192, 2055021834, 4011332463, 2797336692,
-            424213503,  2937342669, 1682666744, 1256176165, 2017003515, 717473071,  3563024742,
-            3407437449, 2957152445, 3557139753, 3319575432, 610182860,  3491950269, 1107293753,
-            2926461368, 3052637648, 2493047579, 1680462513, 4283282673, 168788571,  1401253163,
-            2151356582, 2218068386, 2170981202, 1587568797, 3994937670, 2738927570, 4096726326,
-            2307933966, 145940188,  3928146647, 1887236689, 2894586378, 1213200792, 232910392,
-            833120806,  2028538736, 520434726,  3176078796, 937696513,  3704968451, 305624632,
-            645408471,  1653323191, 538426778,  939335571,  4188864445, 2605358672, 3941259490,
-            3471552693, 2168499975, 1720039364, 1290188176, 29883500,   1503432309, 524387655,
-            2595662526, 1172244224, 3287933183, 3510981973, 2444664749, 2763703998, 3836242189,
-            2890959433, 234437380,  3272987579, 2652280530, 1720566850, 2943482079, 4219300984,
-            1045589319, 1968049758, 982587365,  4097374623, 265292490,  1077412791, 1165326939,
-            3905392425, 3128365011, 95277844,   2896038035, 2521869983, 262111126,  3672802273,
-            3445399260, 4273256145, 395183943,  233401560,  1781057614, 3491203689, 8343453,
-            249721174,  3314008662, 3540412661, 2206372988, 3738630867, 1644439373, 1150191741,
-            126856999,  3144057206, 65169501,   1997133400, 84516590,   391118877,  1900257963,
-            2914085557, 3843764922, 2831036790, 697303016,  1346369879, 2007568079, 1901125181,
-            2206291004, 2676838865, 3020679234, 2097032931, 344347894,  882506847,  199589058,
-            2922557451, 3740400148, 2919277604, 3675129276, 2549095941, 1643088840, 199560818,
-            3305575634, 1702669516, 915059870,  2410951596, 117939268,  1416053196, 393602062,
-            4119002503, 1535078752, 4281599711, 3993632377, 1135074988, 3662664617, 1065246672,
-            2854253374, 1044670394, 883002610,  1346396900, 4218283385, 803910659,  1792832168,
-            1478839081, 3383570452, 1317710387, 1311168874, 1596709924, 3009846855, 3864538174,
-            2442851586, 1967982878, 2428482265, 2419526192, 2055021834, 4011332463, 2725198749,
-            424213503,  2937342669, 1682666744, 1256176165, 713350501,  717473071,  3563024742,
-            3407437449, 2957152445, 2363682828, 3319575432, 610182860,  3491950269, 1107293753,
-            3429638328, 3052637648, 2493047579, 1680462513, 4283282673, 2672311163, 1401253163,
-            2151356582, 2218068386, 2170981202, 431601500,  4193143261, 2985267149, 1556712183,
-            4135181832, 285960576,  81711096,   57066962,   2646151573, 3692824605, 485132216,
-            2799654118, 903527523,  1210637484, 3195346614, 599540837,  1410108963, 3723542120,
-            1350764011, 1717225239, 239736775,  3946934722, 420024332,  589304817,  1331122625,
-            4294403247, 2009397371, 844641869,  166387728,  4093361096, 2342369656, 3958170613,
-            1660376297, 1259528150, 4240809115, 2875563845, 2613790323, 2869665108, 1414690635,
-            944649070,  3539368342, 199532147,  2707660205, 2258475730, 771169023,  158544851,
-            588872178,  2002019277, 4225148852, 641266809,  2133909450, 330112418,  1815776319,
-            1949213618, 3868452239, 2702722715, 2491030937, 468812562,  3226259052, 199165016,
-            436679774,  881956108,  1098105661, 68909298,   248572829,  339224422,  553849953,
-            3054752668, 701934162,  1898925107, 749060575,  987950022,  4040401060, 684345838,
-            3449205676, 2583450513, 433795092,  3559011048, 293161429,  3947766299, 3491895171,
-            1651265910, 1216468759, 1625512737, 412235874,  893680794,  2582820523, 1514322840,
-            2348781204, 2720801933, 3364999370, 2822073391, 2627166519, 3805500773, 177760590,
-            2210728920, 3136345252, 3226658259, 3982978003, 86264452,   536816704,  3489051867,
-            2161950016, 1375640747, 4116957650, 3676292350, 3001078542, 1379688752, 3059678152,
-            3740664918, 475697670,  539253230,  1256048653, 3819847913, 141216227,  3888391528,
-            3567424851, 4131097532, 2142453586, 3606575354, 3689715433, 2318212425, 3026095399,
-            2451038695, 4052322172, 1861782452, 3032216562, 4078403318, 2636775961, 2188864067,
-            3276459319, 2230349722, 3939784264, 831216291,  2483460713, 2571551493, 484276565,
-            3173595164, 4177831244, 4132249231, 2116763555, 1420812998, 2121017321, 2855491215,
-            1630144518, 2489688364, 411521312,  3713786536, 4177871972, 690465497,  855092147,
-            4271606539, 1265108699, 3757106624, 3151574897, 670335437,  3099376310, 3946436509,
-            1795346235, 4013409945,
-        },
-        {
-            4049223238, 859972524,  2620858246, 1771032662, 2901122285, 3954658056, 2103968350,
-            1479802536, 3787183565, 669531015,  622740687,  4036650691, 2461375985, 2416306710,
-            1861476247, 1211280530, 3197443258, 2228048655, 3308914160, 663069046,  2640550054,
-            2362316714, 4266520782, 1521244061, 1096362653, 2157001185, 2320793416, 1758724197,
-            920894716,  3282601752, 507398841,  4152339321, 3522403153, 2952158211, 3960871527,
-            4244636703, 3044589238, 3057286941, 4200544101, 2380276809, 125602026,  2376774124,
-            421502155,  4264487998, 2868994907, 2129157023, 256348087,  436872936,  4008362393,
-            2427039303, 414645584,  1674715717, 4005036231, 3209448353, 360653224,  1736977214,
-            3404945170, 3412448336, 1161134378, 4229018645, 3399250653, 537929734,  3370884776,
-            2889101284, 559437587,  3131944176, 557162412,  1231629449, 3391772822, 894310850,
-            1248230670, 4274053469, 3800434284, 226232768,  1928714647, 662091819,  267087950,
-            1386650230, 1485398574, 2297420911, 3612526572, 2345029135, 2344446152, 1007731105,
-            315083725,  663596220,  944913296,  2203747292, 214287007,  3040173161, 2783064949,
-            2233755241, 699509000,  4276207124, 3682378927, 3623996918, 883786124,  2181779327,
-            780039324,  4260319914, 1570783024, 2508598538, 2297699915, 64217795,   2520352924,
-            823028155,  710204948,  486981153,  3210391004, 1403874859, 438726000,  3399474215,
-            1057433909, 212622282,  2941853659, 3292868399, 2516741410, 1112352364, 121488262,
-            3946415154, 3477418286, 1198144041, 908898789,  1861862812, 2911727820, 3585254576,
-            3750835299, 2979406801, 2772393574, 3548971202, 1068770131, 671115698,  2782073749,
-            1581704807, 1655501584, 2467669248, 993972327,  243136038,  1962068179, 2353853638,
-            1896702704, 1359169854, 838543181,  1267353379, 436165806,  2641929843, 3184411286,
-            2554156256, 1091305152, 4176773990, 3802196614, 2253220242, 4275667275, 3629128501,
-            3430047300, 2817112620, 3591278832, 2292997053, 2267323166, 346052787,  973755297,
-            4049223238, 859972524,  2620858246, 1771032662, 1548251847, 3954658056, 2103968350,
-            1479802536, 3787183565, 2289692748, 622740687,  4036650691, 2461375985, 2416306710,
-            3208362152, 1211280530, 3197443258, 2228048655, 3308914160, 1944758720, 2640550054,
-            2362316714, 4266520782, 1521244061, 2708697114, 2157001185, 2320793416, 1758724197,
-            920894716,  1979947791, 507398841,  4152339321, 3522403153, 2952158211, 1479954192,
-            4244636703, 3044589238, 3057286941, 4200544101, 3184276995, 125602026,  2376774124,
-            421502155,  4264487998, 1793213085, 2129157023, 256348087,  436872936,  4008362393,
-            997264582,  414645584,  1674715717, 4005036231, 3209448353, 1259346833, 1736977214,
-            3404945170, 3412448336, 1161134378, 4214096603, 3399250653, 537929734,  3370884776,
-            2889101284, 976465114,  3131944176, 557162412,  1231629449, 3391772822, 2041329243,
-            1248230670, 4274053469, 3800434284, 226232768,  970585625,  662091819,  267087950,
-            1386650230, 1485398574, 2220795461, 3612526572, 2345029135, 2344446152, 1007731105,
-            3912208040, 663596220,  944913296,  2203747292, 214287007,  1375923678, 2783064949,
-            2233755241, 699509000,  4276207124, 373457986,  3623996918, 883786124,  2181779327,
-            780039324,  2042823300, 1570783024, 2508598538, 2297699915, 64217795,   3331376347,
-            823028155,  710204948,  486981153,  3210391004, 3772374924, 438726000,  3399474215,
-            1057433909, 212622282,  2721692581, 3292868399, 2516741410, 1112352364, 121488262,
-            478556053,  3477418286, 1198144041, 908898789,  1861862812, 3600333263, 3585254576,
-            3750835299, 2979406801, 2772393574, 1603964315, 1068770131, 671115698,  2782073749,
-            1581704807, 1899894147, 2467669248, 993972327,  243136038,  1962068179, 2275837660,
-            1896702704, 1359169854, 838543181,  1267353379, 2036731005, 2641929843, 3184411286,
-            2554156256, 1091305152, 1786701849, 3802196614, 2253220242, 4275667275, 3629128501,
-            2157717449, 2817112620, 3591278832, 2292997053, 2267323166, 397154112,  973755297,
-            4049223238, 859972524,  2620858246, 316385833,  1548251847, 3954658056, 2103968350,
-            1479802536, 528034958,  2289692748, 622740687,  4036650691, 2461375985, 3377298769,
-            3208362152, 1211280530, 3197443258, 2228048655, 857920020,  1944758720, 2640550054,
-            2362316714, 4266520782, 1491646547, 2708697114, 2157001185, 2320793416, 1758724197,
-            3870985575, 1979947791, 507398841,  4152339321, 3522403153, 499982517,  1479954192,
-            4244636703, 3044589238, 3057286941, 614435241,  3184276995, 125602026,  2376774124,
-            421502155,  4029860390, 1793213085, 2129157023, 256348087,  436872936,  1961470146,
-            997264582,  414645584,  1674715717, 4005036231, 322348615,  1259346833, 1736977214,
-            3404945170, 3412448336, 1260063663, 4214096603, 3399250653, 537929734,  3370884776,
-            3282492590, 976465114,  3131944176, 557162412,  1231629449, 2610071173, 2041329243,
-            1248230670, 4274053469, 3800434284, 3580163872, 970585625,  662091819,  267087950,
-            1386650230, 91494956,   2220795461, 3612526572, 2345029135, 2344446152, 1960565931,
-            3912208040, 663596220,  944913296,  2203747292, 911396549,  1375923678, 2783064949,
-            2233755241, 699509000,  2947167851, 373457986,  3623996918, 883786124,  2181779327,
-            52115850,   2042823300, 1570783024, 2508598538, 2297699915, 669551689,  3331376347,
-            823028155,  710204948,  486981153,  2559816580, 3772374924, 438726000,  3399474215,
-            1057433909, 706242349,  2721692581, 3292868399, 2516741410, 1112352364, 3731770156,
-            478556053,  3477418286, 1198144041, 908898789,  97242289,   3600333263, 3585254576,
-            3750835299, 2979406801, 2099890663, 1603964315, 1068770131, 671115698,  2782073749,
-            2747284163, 1899894147, 2467669248, 993972327,  243136038,  687954653,  2275837660,
-            1896702704, 1359169854, 838543181,  944625279,  2036731005, 2641929843, 3184411286,
-            2554156256, 1382679709, 1786701849, 3802196614, 2253220242, 4275667275, 1705972289,
-            2157717449, 2817112620, 3591278832, 2292997053, 2708000301, 397154112,  973755297,
-            4049223238, 859972524,  1091281090, 316385833,  1548251847, 3954658056, 2103968350,
-            771308952,  528034958,  2289692748, 622740687,  4036650691, 1489634108, 3377298769,
-            3208362152, 1211280530, 3197443258, 3138940773, 857920020,  1944758720, 2640550054,
-            2362316714, 822216521,  1491646547, 2708697114, 2157001185, 2320793416, 1058511754,
-            3870985575, 1979947791, 507398841,  4152339321, 4032029131, 499982517,  1479954192,
-            4244636703, 3044589238, 938994609,  614435241,  3184276995, 125602026,  2376774124,
-            1276548305, 4029860390, 1793213085, 2129157023, 256348087,  3217729624, 1961470146,
-            997264582,  414645584,  1674715717, 3078690023, 322348615,  1259346833, 1736977214,
-            3404945170, 1243667298, 1260063663, 4214096603, 3399250653, 537929734,  559325052,
-            3282492590, 976465114,  3131944176, 557162412,  2365184076, 2610071173, 2041329243,
-            1248230670, 4274053469, 2129468682, 3580163872, 970585625,  662091819,  267087950,
-            3131191694, 91494956,   2220795461, 3612526572, 2345029135, 3712745221, 1960565931,
-            3912208040, 663596220,  944913296,  2287515097, 911396549,  1375923678, 2783064949,
-            2233755241, 2310760468, 2947167851, 373457986,  3623996918, 883786124,  4228677913,
-            52115850,   2042823300, 1570783024, 2508598538, 2818004412, 669551689,  3331376347,
-            823028155,  710204948,  981723367,  2559816580, 3772374924, 438726000,  3399474215,
-            3168837858, 706242349,  2721692581, 3292868399, 2516741410, 3471148688, 3731770156,
-            478556053,  3477418286, 1198144041, 1757613159, 97242289,   3600333263, 3585254576,
-            3750835299, 3373236017, 2099890663, 1603964315, 1068770131, 671115698,  1689773683,
-            2747284163, 1899894147, 2467669248, 993972327,  641082260,  687954653,  2275837660,
-            1896702704, 1359169854, 2322128279, 944625279,  2036731005, 2641929843, 3184411286,
-            3311917331, 1382679709, 1786701849, 3802196614, 2253220242, 296603593,  1705972289,
-            2157717449, 2817112620, 3591278832, 4201356709, 4016550996, 30726590,   1865792583,
-            3089907879, 3374956041, 1934666706, 1750796776, 3286114474, 2372649187, 3024206935,
-            727930234,  2313215013, 3828751149, 2817517898, 2006579512, 635557645,  1886053989,
-            640571479,  1737241069, 3026511836, 4179589802, 1424701016, 641974950,  4237665928,
-            4218598681, 164628499,  4157430661, 2768415553, 2792390387, 3000751285, 3187320273,
-            3853465412, 1724364456, 630622117,  179449097,  2630241337, 3917416090, 160482600,
-            2027326448, 4133745171, 2664865510, 21126462,   1203109000, 3994164567, 3282090563,
-            2801134533, 4089217246, 2212752467, 2745284761, 808905454,  3203342322, 4117437155,
-            1567587252, 211858305,  1713864955, 1752459798, 3101265058, 2353416903, 540273515,
-            1598195524, 3138079345, 4214986677, 2933614901, 814118693,  692307287,  2776342845,
-            448605712,  1588203349, 545635154,  823352644,  1064152531, 2473946513, 1232680293,
-            3985959594, 3117612554, 3281731827, 2140134900, 3422390930, 1228882157, 2926122583,
-            187422315,  2932800603, 1421962445, 4055970281, 2909731606, 2086687619, 2116324767,
-            3296860407, 1281062538, 2189895899, 931808967,  2745200303, 4002128577, 1618400706,
-            77898739,   1768974887, 2376835455, 2780066388, 620084230,  534835634,  2693869596,
-            2119251667, 1918016200, 432055513,  205870992,  1990132407, 1401494464, 2941567681,
-            2008718661, 1029036997, 2725832365, 522789296,  723469430,  1679957374, 3832521152,
-            1265761587, 1046304617, 1497367460, 1969282301, 1132282039, 3722133317, 1975561887,
-            909246753,  564475640,  3710714011, 50238782,   978132442,  3923785279, 1073810648,
-            2779698575, 633500825,  3572480586, 1427846264, 3737123995, 335477777,  1597295991,
-            3307532136, 3898994806, 2811459618, 1346632034, 1987435254, 1601470507, 3637642999,
-            2849989639, 3071318466, 1031291989, 87396906,   2085854807, 3777706020, 1231281703,
-            2349074228, 3731751849, 3021007792, 1454375222, 679335701,  969939164,  1551829661,
-            3705875796, 2064291704,
-        },
-        {
-            650684252,  2220445579, 537394374,  571322423,  2781663439, 899394682,  364129622,
-            328438826,  1219862153, 830435885,  3278649457, 3072225531, 2838645991, 3150905380,
-            1251952499, 1751415553, 2034088483, 1437197870, 1907624878, 1786974150, 4207811086,
-            768131803,  2713210999, 4004509777, 3510764535, 2740991637, 3000313526, 1355959320,
-            938244439,  4093313692, 2476002145, 835527260,  2084758949, 4223775017, 91645393,
-            2251723899, 3159477758, 2008655575, 912220875,  1525327655, 2067948386, 2006141522,
-            450235614,  3945671083, 2852189452, 3804118704, 3302604345, 1712745267, 349281154,
-            19331179,   3423301791, 416995358,  2049170698, 684574142,  3271042138, 3438668017,
-            1645378852, 1995123150, 1835887948, 2347182898, 3828432892, 3710259931, 713144773,
-            3246285450, 2196135622, 1611287338, 2845388948, 3690657633, 2403178686, 2946296994,
-            2180908599, 3072014497, 3436535724, 2948908116, 3080353236, 1669938872, 3572731079,
-            1100892983, 308060688,  3092946261, 2725115972, 887278263,  991869336,  3597899723,
-            3454505181, 1108269267, 851855066,  1940998002, 3539084542, 3102161424, 965450940,
-            1942363226, 1430246588, 1368971075, 4251556311, 642683738,  3035789355, 1829444044,
-            4234626091, 671403403,  2809844786, 2251172733, 970188857,  3910072565, 1131847479,
-            3397535176, 3290884849, 861868157,  2811422184, 3280310458, 3502085520, 1499698865,
-            2446269873, 236680785,  1896103604, 1179896471, 83960622,   3303129336, 1191373247,
-            177898275,  3077388457, 1022975703, 2535144448, 8680269,    3602435630, 1810825915,
-            2293529378, 2307085218, 483894148,  2872435038, 2043868156, 3038491874, 3786518530,
-            3606440668, 3336713377, 120183042,  86901386,   2233164457, 2881782972, 3135264768,
-            2294460421, 2996668315, 658184098,  3558825846, 2386173040, 1950463910, 551627788,
-            2464303444, 893474565,  3277869222, 2852725906, 1191310725, 2398932683, 4164956002,
-            1689291769, 2619288187, 3429362702, 3205668166, 1668126623, 955771270,  2106753333,
-            650684252,  2220445579, 537394374,  571322423,  2369694095, 899394682,  364129622,
-            328438826,  1219862153, 4195985755, 3278649457, 3072225531, 2838645991, 3150905380,
-            2389919,    1751415553, 2034088483, 1437197870, 1907624878, 1516966376, 4207811086,
-            768131803,  2713210999, 4004509777, 1955929377, 2740991637, 3000313526, 1355959320,
-            938244439,  4263287583, 2476002145, 835527260,  2084758949, 4223775017, 110659216,
-            2251723899, 3159477758, 2008655575, 912220875,  2378803214, 2067948386, 2006141522,
-            450235614,  3945671083, 4112321452, 3804118704, 3302604345, 1712745267, 349281154,
-            3834044005, 3423301791, 416995358,  2049170698, 684574142,  3651360887, 3438668017,
-            1645378852, 1995123150, 1835887948, 1022257616, 3828432892, 3710259931, 713144773,
-            3246285450, 2485142597, 1611287338, 2845388948, 3690657633, 2403178686, 2201888000,
-            2180908599, 3072014497, 3436535724, 2948908116, 1647734358, 1669938872, 3572731079,
-            1100892983, 308060688,  592016509,  2725115972, 887278263,  991869336,  3597899723,
-            819708104,  1108269267, 851855066,  1940998002, 3539084542, 3156419045, 965450940,
-            1942363226, 1430246588, 1368971075, 224112021,  642683738,  3035789355, 1829444044,
-            4234626091, 314715303,  2809844786, 2251172733, 970188857,  3910072565, 155628632,
-            3397535176, 3290884849, 861868157,  2811422184, 1847583676, 3502085520, 1499698865,
-            2446269873, 236680785,  3698448762, 1179896471, 83960622,   3303129336, 1191373247,
-            1567908030, 3077388457, 1022975703, 2535144448, 8680269,    3979982957, 1810825915,
-            2293529378, 2307085218, 483894148,  4003402870, 2043868156, 3038491874, 3786518530,
-            3606440668, 3062185402, 120183042,  86901386,   2233164457, 2881782972, 3345668738,
-            2294460421, 2996668315, 658184098,  3558825846, 2121278529, 1950463910, 551627788,
-            2464303444, 893474565,  183176481,  2852725906, 1191310725, 2398932683, 4164956002,
-            788617081,  2619288187, 3429362702, 3205668166, 1668126623, 29124108,   2106753333,
-            650684252,  2220445579, 537394374,  725338795,  2369694095, 899394682,  364129622,
-            328438826,  1727397396, 4195985755, 3278649457, 3072225531, 2838645991, 583924693,
-            2389919,    1751415553, 2034088483, 1437197870, 1017611325, 1516966376, 4207811086,
-            768131803,  2713210999, 761144580,  1955929377, 2740991637, 3000313526, 1355959320,
-            840696976,  4263287583, 2476002145, 835527260,  2084758949, 3729075247, 110659216,
-            2251723899, 3159477758, 2008655575, 4127907945, 2378803214, 2067948386, 2006141522,
-            450235614,  3240776806, 4112321452, 3804118704, 3302604345, 1712745267, 1079549936,
-            3834044005, 3423301791, 416995358,  2049170698, 3913510119, 3651360887, 3438668017,
-            1645378852, 1995123150, 841590980,  1022257616, 3828432892, 3710259931, 713144773,
-            1272133892, 2485142597, 1611287338, 2845388948, 3690657633, 3083851146, 2201888000,
-            2180908599, 3072014497, 3436535724, 4162521870, 1647734358, 1669938872, 3572731079,
-            1100892983, 986584939,  592016509,  2725115972, 887278263,  991869336,  2711883653,
-            819708104,  1108269267, 851855066,  1940998002, 4050477073, 3156419045, 965450940,
-            1942363226, 1430246588, 4285490865, 224112021,  642683738,  3035789355, 1829444044,
-            4197159994, 314715303,  2809844786, 2251172733, 970188857,  3018833494, 155628632,
-            3397535176, 3290884849, 861868157,  2883971818, 1847583676, 3502085520, 1499698865,
-            2446269873, 2621709156, 3698448762, 1179896471, 83960622,   3303129336, 2192966710,
-            1567908030, 3077388457, 1022975703, 2535144448, 95661399,   3979982957, 1810825915,
-            2293529378, 2307085218, 485952375,  4003402870, 2043868156, 3038491874, 3786518530,
-            575288835,  3062185402, 120183042,  86901386,   2233164457, 2864966512, 3345668738,
-            2294460421, 2996668315, 658184098,  2892259673, 2121278529, 1950463910, 551627788,
-            2464303444, 2699734841, 183176481,  2852725906, 1191310725, 2398932683, 3505505465,
-            788617081,  2619288187, 3429362702, 3205668166, 2157859363, 29124108,   2106753333,
-            650684252,  2220445579, 978263237,  725338795,  2369694095, 899394682,  364129622,
-            3795063930, 1727397396, 4195985755, 3278649457, 3072225531, 1996768476, 583924693,
-            2389919,    1751415553, 2034088483, 1069211024, 1017611325, 1516966376, 4207811086,
-            768131803,  1365857736, 761144580,  1955929377, 2740991637, 3000313526, 1057560595,
-            840696976,  4263287583, 2476002145, 835527260,  76517292,   3729075247, 110659216,
-            2251723899, 3159477758, 3272987770, 4127907945, 2378803214, 2067948386, 2006141522,
-            1223694226, 3240776806, 4112321452, 3804118704, 3302604345, 2218568154, 1079549936,
-            3834044005, 3423301791, 416995358,  3661322119, 3913510119, 3651360887, 3438668017,
-            1645378852, 3606917602, 841590980,  1022257616, 3828432892, 3710259931, 1270853142,
-            1272133892, 2485142597, 1611287338, 2845388948, 131877212,  3083851146, 2201888000,
-            2180908599, 3072014497, 2459348479, 4162521870, 1647734358, 1669938872, 3572731079,
-            4285199726, 986584939,  592016509,  2725115972, 887278263,  3824306591, 2711883653,
-            819708104,  1108269267, 851855066,  190839383,  4050477073, 3156419045, 965450940,
-            1942363226, 1750931697, 4285490865, 224112021,  642683738,  3035789355, 1544088048,
-            4197159994, 314715303,  2809844786, 2251172733, 3155072709, 3018833494, 155628632,
-            3397535176, 3290884849, 4153861738, 2883971818, 1847583676, 3502085520, 1499698865,
-            1780983485, 2621709156, 3698448762, 1179896471, 83960622,   3849402190, 2192966710,
-            1567908030, 3077388457, 1022975703, 1639944917, 95661399,   3979982957, 1810825915,
-            2293529378, 3477014442, 485952375,  4003402870, 2043868156, 3038491874, 1482314580,
-            575288835,  3062185402, 120183042,  86901386,   3129494022, 2864966512, 3345668738,
-            2294460421, 2996668315, 1986664970, 2892259673, 2121278529, 1950463910, 551627788,
-            3105369079, 2699734841, 183176481,  2852725906, 1191310725, 3154591925, 3505505465,
-            788617081,  2619288187, 3429362702, 4204415531, 1321048315, 4247243973, 3085535935,
-            114618345,  2126710176, 1857709117, 3744103666, 304437872,  2388303947, 1802971382,
-            2099900439, 2543837819, 593111133,  3788847386, 1479546758, 4095492150, 240996968,
-            3423191009, 2666077260, 884572403,  2988847666, 928827215,  2549465610, 2773670136,
-            708214104,  2594951780, 1076989709, 2850313793, 1401578686, 4100639899, 2353261688,
-            1323066237, 31664438,   951240198,  3676836716, 3633113483, 3262159382, 981784748,
-            1172850762, 3106238289, 3118297408, 4207023277, 3362324732, 844983306,  3790928628,
-            4156848237, 2638267501, 1494090858, 3955182404, 1193294064, 4035152789, 2971914580,
-            2865046609, 3782329083, 120288587,  3300482994, 4268540970, 4183426205, 3572724103,
-            3287140971, 3038086532, 3210919007, 2171998100, 3958495101, 1589679371, 2880366694,
-            827575211,  1343189406, 364332706,  866065087,  33080625,   4284492640, 2277479989,
-            4110331130, 430538110,  3549886335, 3734345920, 3780943339, 638033279,  2684714509,
-            945721631,  49994267,   2394351381, 1996532760, 3201422203, 3509459657, 4118609520,
-            632454166,  696027759,  901486290,  1230453723, 4225865813, 4072619256, 3111686961,
-            1487480830, 4112016561, 1577020285, 2765241900, 2496609620, 1731271292, 6970479,
-            2936359283, 1541124937, 3705956773, 2349695021, 2247551804, 3759489710, 1321217706,
-            379586757,  2008242014, 1138475935, 3044902216, 1917596533, 2905651936, 3320601534,
-            1468557693, 4101437636, 374575138,  730079080,  995340259,  1430552870, 3860649629,
-            541396702,  3413070856, 3052797396, 3591116740, 2811484252, 2464310183, 1597327051,
-            3288232619, 1564716093, 2838386049, 264313861,  881377066,  4165178494, 1069189853,
-            1045737884, 2072266205, 2700673629, 2338724235, 837702541,  2603464957, 1548182143,
-            3565539962, 38172869,   1949065935, 3628598166, 2788698071, 3531182193, 1367529788,
-            3902468811, 1215323634, 1117475027, 3901912129, 2678279671, 597953858,  4082485755,
-            3696533122, 1078703353,
-        },
-        {
-            1617452472, 70512951,   2657211283, 4174431439, 1317735205, 3355608337, 602125731,
-            2094434905, 2163110446, 3684556230, 3366593152, 1606216833, 4259471420, 2024094678,
-            2073711993, 3682970981, 54265999,   2746165634, 185717000,  2927547985, 3393052075,
-            2020566448, 3125077447, 404509268,  4250790879, 272991047,  2692416050, 234984655,
-            2349243648, 3264224409, 2126250902, 1225930207, 1775433332, 2398791071, 224526012,
-            371156786,  3897761774, 3965701904, 319682511,  3243309067, 555107954,  356679322,
-            3626295209, 3244878404, 358519738,  3127969366, 866037677,  3775273785, 3917091475,
-            1790778677, 3037989058, 2959060357, 4261278881, 2857469855, 3354514461, 2787888937,
-            3371969183, 2327452872, 1243511099, 2018959907, 17496810,   4286918462, 2180011513,
-            558661200,  3722012434, 274000228,  2795870434, 498101314,  3336428356, 780809409,
-            4149626549, 3275765227, 2100020217, 235670768,  1605818633, 40663806,   3292578749,
-            4043071227, 1338607663, 3184090178, 838375616,  637822690,  2590647601, 3946567243,
-            3694094773, 3126401556, 2071044792, 839827269,  3747689912, 2487395141, 1900144538,
-            145981228,  3299735739, 3311728685, 1083033213, 32342458,   1991025698, 608680946,
-            2242568771, 253371660,  2344671068, 3824739902, 1986746216, 1408835162, 4209436383,
-            1102478808, 2329549740, 2701509377, 3362617631, 33017427,   2575790435, 981792238,
-            3175602300, 1536571562, 1155735968, 117958887,  2158710783, 3094089809, 2504912897,
-            2989283796, 2764104727, 1742217798, 1281388716, 4149797383, 4024796873, 4133601567,
-            4112811457, 3975022272, 2989955811, 3205273759, 1016104921, 2452971593, 2554372859,
-            3603005410, 3673153101, 3961994471, 2763196623, 2398036036, 2844848028, 1383180905,
-            346911638,  3880118939, 1385556643, 3156780344, 2758326058, 3993333392, 455791130,
-            4043936912, 4266423798, 3321172014, 2898267294, 4210768426, 3394062496, 1068155087,
-            2016841879, 1561397283, 2124582283, 3609426379, 1975129157, 1813166917, 307992775,
-            1617452472, 70512951,   2657211283, 4174431439, 1013578336, 3355608337, 602125731,
-            2094434905, 2163110446, 1625516974, 3366593152, 1606216833, 4259471420, 2024094678,
-            3272917561, 3682970981, 54265999,   2746165634, 185717000,  704422753,  3393052075,
-            2020566448, 3125077447, 404509268,  2921486649, 272991047,  2692416050, 234984655,
-            2349243648, 3810962283, 2126250902, 1225930207, 1775433332, 2398791071, 1295158671,
-            371156786,  3897761774, 3965701904, 319682511,  2557806882, 555107954,  356679322,
-            3626295209, 3244878404, 3273336936, 3127969366, 866037677,  3775273785, 3917091475,
-            1397127207, 3037989058, 2959060357, 4261278881, 2857469855, 1803814431, 2787888937,
-            3371969183, 2327452872, 1243511099, 2253931879, 17496810,   4286918462, 2180011513,
-            558661200,  2838819926, 274000228,  2795870434, 498101314,  3336428356, 1943956755,
-            4149626549, 3275765227, 2100020217, 235670768,  3362583030, 40663806,   3292578749,
-            4043071227, 1338607663, 1697406621, 838375616,  637822690,  2590647601, 3946567243,
-            3128124380, 3126401556, 2071044792, 839827269,  3747689912, 2491229013, 1900144538,
-            145981228,  3299735739, 3311728685, 2505906414, 32342458,   1991025698, 608680946,
-            2242568771, 2762895145, 2344671068, 3824739902, 1986746216, 1408835162, 4224273936,
-            1102478808, 2329549740, 2701509377, 3362617631, 2979501176, 2575790435, 981792238,
-            3175602300, 1536571562, 658822057,  117958887,  2158710783, 3094089809, 2504912897,
-            3823882120, 2764104727, 1742217798, 1281388716, 4149797383, 3517794735, 4133601567,
-            4112811457, 3975022272, 2989955811, 3866468868, 1016104921, 2452971593, 2554372859,
-            3603005410, 3887547715, 3961994471, 2763196623, 2398036036, 2844848028, 1580531544,
-            346911638,  3880118939, 1385556643, 3156780344, 2440555808, 3993333392, 455791130,
-            4043936912, 4266423798, 3128101344, 2898267294, 4210768426, 3394062496, 1068155087,
-            850152384,  1561397283, 2124582283, 3609426379, 1975129157, 2865765754, 307992775,
-            1617452472, 70512951,   2657211283, 363224142,  1013578336, 3355608337, 602125731,
-            2094434905, 954635053,  1625516974, 3366593152, 1606216833, 4259471420, 1795522439,
-            3272917561, 3682970981, 54265999,   2746165634, 44337022,   704422753,  3393052075,
-            2020566448, 3125077447, 725287918,  2921486649, 272991047,  2692416050, 234984655,
-            563866081,  3810962283, 2126250902, 1225930207, 1775433332, 315738683,  1295158671,
-            371156786,  3897761774, 3965701904, 1838744611, 2557806882, 555107954,  356679322,
-            3626295209, 3329181677, 3273336936, 3127969366, 866037677,  3775273785, 2901142557,
-            1397127207, 3037989058, 2959060357, 4261278881, 765075220,  1803814431, 2787888937,
-            3371969183, 2327452872, 2001113068, 2253931879, 17496810,   4286918462, 2180011513,
-            3437326973, 2838819926, 274000228,  2795870434, 498101314,  2136926918, 1943956755,
-            4149626549, 3275765227, 2100020217, 1936924901, 3362583030, 40663806,   3292578749,
-            4043071227, 1539233144, 1697406621, 838375616,  637822690,  2590647601, 1353300809,
-            3128124380, 3126401556, 2071044792, 839827269,  873334568,  2491229013, 1900144538,
-            145981228,  3299735739, 2207756787, 2505906414, 32342458,   1991025698, 608680946,
-            4273030258, 2762895145, 2344671068, 3824739902, 1986746216, 551209783,  4224273936,
-            1102478808, 2329549740, 2701509377, 3631907432, 2979501176, 2575790435, 981792238,
-            3175602300, 2021674752, 658822057,  117958887,  2158710783, 3094089809, 602850891,
-            3823882120, 2764104727, 1742217798, 1281388716, 1790538539, 3517794735, 4133601567,
-            4112811457, 3975022272, 2651288275, 3866468868, 1016104921, 2452971593, 2554372859,
-            1402753546, 3887547715, 3961994471, 2763196623, 2398036036, 1467934177, 1580531544,
-            346911638,  3880118939, 1385556643, 3294410109, 2440555808, 3993333392, 455791130,
-            4043936912, 1059533444, 3128101344, 2898267294, 4210768426, 3394062496, 1508043383,
-            850152384,  1561397283, 2124582283, 3609426379, 2479937807, 2865765754, 307992775,
-            1617452472, 70512951,   711099309,  363224142,  1013578336, 3355608337, 602125731,
-            4126344009, 954635053,  1625516974, 3366593152, 1606216833, 2802704521, 1795522439,
-            3272917561, 3682970981, 54265999,   811359886,  44337022,   704422753,  3393052075,
-            2020566448, 3049997219, 725287918,  2921486649, 272991047,  2692416050, 3212756212,
-            563866081,  3810962283, 2126250902, 1225930207, 2859907063, 315738683,  1295158671,
-            371156786,  3897761774, 1815333569, 1838744611, 2557806882, 555107954,  356679322,
-            1272461263, 3329181677, 3273336936, 3127969366, 866037677,  4188038799, 2901142557,
-            1397127207, 3037989058, 2959060357, 1353316174, 765075220,  1803814431, 2787888937,
-            3371969183, 1691833316, 2001113068, 2253931879, 17496810,   4286918462, 2511330816,
-            3437326973, 2838819926, 274000228,  2795870434, 1639263410, 2136926918, 1943956755,
-            4149626549, 3275765227, 638920808,  1936924901, 3362583030, 40663806,   3292578749,
-            2418009022, 1539233144, 1697406621, 838375616,  637822690,  2284405385, 1353300809,
-            3128124380, 3126401556, 2071044792, 4253454094, 873334568,  2491229013, 1900144538,
-            145981228,  321543232,  2207756787, 2505906414, 32342458,   1991025698, 3032859112,
-            4273030258, 2762895145, 2344671068, 3824739902, 2820833718, 551209783,  4224273936,
-            1102478808, 2329549740, 3509993842, 3631907432, 2979501176, 2575790435, 981792238,
-            3626454263, 2021674752, 658822057,  117958887,  2158710783, 1028119378, 602850891,
-            3823882120, 2764104727, 1742217798, 4171984550, 1790538539, 3517794735, 4133601567,
-            4112811457, 522954776,  2651288275, 3866468868, 1016104921, 2452971593, 709485940,
-            1402753546, 3887547715, 3961994471, 2763196623, 2570553034, 1467934177, 1580531544,
-            346911638,  3880118939, 4114077485, 3294410109, 2440555808, 3993333392, 455791130,
-            1856572626, 1059533444, 3128101344, 2898267294, 4210768426, 840904639,  1508043383,
-            850152384,  1561397283, 2124582283, 4102881611, 3478142209, 4103951556, 1643082265,
-            3045908112, 4039045244, 1362226834, 206409739,  795113788,  2602678431, 3546105311,
-            770139339,  2359550501, 4110001402, 4150777286, 2295486569, 1315231588, 215358780,
-            3253271206, 343166784,  2819482949, 2434626751, 2267659802, 3020681521, 101505820,
-            2347605315, 1222255319, 524292951,  2085045426, 3293309174, 189342301,  2577536451,
-            414788977,  3409204156, 23039257,   1639673732, 699905503,  237643171,  236525699,
-            3142823450, 156028788,  345001435,  450817098,  2017130374, 2662428748, 1996291127,
-            2090938990, 3441757916, 2823368451, 536773479,  764801898,  2692796755, 816567718,
-            3034045747, 1179081489, 3799674284, 894196295,  1291956399, 2740310443, 3608617697,
-            1911507054, 1675077042, 4203811566, 3349004728, 3816128417, 1099299222, 2011921247,
-            2792819127, 231123506,  1907547283, 1958036662, 1019275496, 3610931378, 1199869664,
-            3208350789, 2275393701, 1440216572, 2245027611, 3530112099, 3601014726, 1995423288,
-            3992991920, 3142882865, 635585779,  2121235377, 2747358409, 494731413,  42293203,
-            1814077381, 1336269255, 700481772,  2493805212, 3814757185, 266945552,  2320551702,
-            4099743025, 2742333954, 2681580174, 111565147,  1157197385, 149972278,  250248185,
-            4221209695, 1786095490, 2098147112, 915742421,  1330768911, 3570838474, 2581355542,
-            478094021,  1088585086, 1137370869, 2029319172, 4109921436, 3379457845, 1141109619,
-            3208030591, 204401467,  1135785640, 1659153973, 3001016103, 197243860,  893469940,
-            2629459958, 744394803,  3521540972, 3143470322, 3066280396, 3289711371, 7920732,
-            3525237497, 3812921497, 1033571552, 2752606922, 1561141469, 588388091,  3415739716,
-            1759022650, 642904186,  1373944926, 2220472225, 493760875,  1242616970, 337914834,
-            9001028,    2450559288, 1730627093, 2742809448, 839654984,  3691606232, 779215480,
-            1087958698, 2147474478, 3314341326, 1766644048, 3267624651, 4041003380, 2839427843,
-            2610065603, 3330504928,
-        },
-        {
-            590004384,  3025338414, 1764374188, 20686172,   932343559,  1798441768, 1013577341,
-            4275903797, 853441141,  1065980978, 3665193407, 1555165047, 2962781443, 1822487181,
-            3329200135, 1527094489, 3805115799, 2252376033, 2137546519, 3632426270, 2439842864,
-            2525211849, 602876448,  1488163727, 3169015136, 832084039,  81097112,   994974428,
-            1945411347, 1020609213, 2863240894, 1639194881, 3078842449, 1885382385, 2595105518,
-            3857547190, 3654577058, 3853111480, 2237941224, 625422255,  3292783340, 750206381,
-            1002246874, 900879607,  820635221,  3318328110, 3980484559, 3924790669, 4260574943,
-            3658381114, 3673068643, 1319175627, 3620071157, 3914274380, 3310864044, 1529070914,
-            1760958838, 818806045,  3056976418, 2337737150, 2061530784, 1036243443, 2058675708,
-            1932546035, 1604709219, 1317296740, 2505350414, 624826181,  2710208816, 2208469912,
-            1930700024, 3769953790, 2092911082, 520309780,  3787727278, 684095804,  3697683979,
-            111440289,  4043494885, 1571375993, 1828801775, 3589061974, 3016563679, 2026002784,
-            3810490061, 2634997537, 2715287551, 1973545003, 3407971274, 3239387641, 2479429785,
-            324785401,  2622755198, 1525605325, 3280412074, 2453630352, 726090704,  4170024046,
-            248003549,  3319518538, 1331224401, 1203416669, 3497395173, 2465693133, 15303334,
-            267163358,  627307819,  294350450,  3691559013, 2491765952, 839609873,  1598505629,
-            3905396753, 583168080,  281403302,  1658629464, 1498139453, 2860737994, 148007837,
-            1439496901, 3226624586, 1708925351, 195473107,  1150552649, 2856922985, 1853471286,
-            1286593394, 2025932254, 1300583198, 3169702837, 1255226060, 3482666699, 1515557266,
-            1964035766, 1604627993, 641427670,  450188959,  1095230428, 293179001,  1293554079,
-            3022335608, 610535626,  1329467104, 3717935497, 1252385485, 441595535,  2937045243,
-            2846877561, 668719121,  3604154741, 1150714166, 1689640190, 2219487087, 2445975095,
-            3492083575, 377195836,  2727989292, 2460040634, 2910322481, 399050881,  3601292788,
-            590004384,  3025338414, 1764374188, 20686172,   3576058865, 1798441768, 1013577341,
-            4275903797, 853441141,  3862104007, 3665193407, 1555165047, 2962781443, 1822487181,
-            1058917817, 1527094489, 3805115799, 2252376033, 2137546519, 780594798,  2439842864,
-            2525211849, 602876448,  1488163727, 642430472,  832084039,  81097112,   994974428,
-            1945411347, 2231598766, 2863240894, 1639194881, 3078842449, 1885382385, 2387524763,
-            3857547190, 3654577058, 3853111480, 2237941224, 991026264,  3292783340, 750206381,
-            1002246874, 900879607,  1178067772, 3318328110, 3980484559, 3924790669, 4260574943,
-            1964983082, 3673068643, 1319175627, 3620071157, 3914274380, 992141498,  1529070914,
-            1760958838, 818806045,  3056976418, 3295305429, 2061530784, 1036243443, 2058675708,
-            1932546035, 3724542133, 1317296740, 2505350414, 624826181,  2710208816, 3359715256,
-            1930700024, 3769953790, 2092911082, 520309780,  1979908015, 684095804,  3697683979,
-            111440289,  4043494885, 3256907235, 1828801775, 3589061974, 3016563679, 2026002784,
-            1967781780, 2634997537, 2715287551, 1973545003, 3407971274, 391604110,  2479429785,
-            324785401,  2622755198, 1525605325, 462777294,  2453630352, 726090704,  4170024046,
-            248003549,  3125444318, 1331224401, 1203416669, 3497395173, 2465693133, 1610778556,
-            267163358,  627307819,  294350450,  3691559013, 3302305047, 839609873,  1598505629,
-            3905396753, 583168080,  1502262581, 1658629464, 1498139453, 2860737994, 148007837,
-            2973368511, 3226624586, 1708925351, 195473107,  1150552649, 522423348,  1853471286,
-            1286593394, 2025932254, 1300583198, 555770116,  1255226060, 3482666699, 1515557266,
-            1964035766, 877073175,  641427670,  450188959,  1095230428, 293179001,  4216364784,
-            3022335608, 610535626,  1329467104, 3717935497, 1665384485, 441595535,  2937045243,
-            2846877561, 668719121,  978801343,  1150714166, 1689640190, 2219487087, 2445975095,
-            3819595050, 377195836,  2727989292, 2460040634, 2910322481, 1200428010, 3601292788,
-            590004384,  3025338414, 1764374188, 3586255253, 3576058865, 1798441768, 1013577341,
-            4275903797, 1511067357, 3862104007, 3665193407, 1555165047, 2962781443, 2749766525,
-            1058917817, 1527094489, 3805115799, 2252376033, 817362043,  780594798,  2439842864,
-            2525211849, 602876448,  2309049006, 642430472,  832084039,  81097112,   994974428,
-            3148197354, 2231598766, 2863240894, 1639194881, 3078842449, 311769962,  2387524763,
-            3857547190, 3654577058, 3853111480, 1888597091, 991026264,  3292783340, 750206381,
-            1002246874, 2904195378, 1178067772, 3318328110, 3980484559, 3924790669, 4265386540,
-            1964983082, 3673068643, 1319175627, 3620071157, 1635921454, 992141498,  1529070914,
-            1760958838, 818806045,  3002614702, 3295305429, 2061530784, 1036243443, 2058675708,
-            2534375036, 3724542133, 1317296740, 2505350414, 624826181,  3042995618, 3359715256,
-            1930700024, 3769953790, 2092911082, 1870611696, 1979908015, 684095804,  3697683979,
-            111440289,  1111193348, 3256907235, 1828801775, 3589061974, 3016563679, 2203918092,
-            1967781780, 2634997537, 2715287551, 1973545003, 17967467,   391604110,  2479429785,
-            324785401,  2622755198, 3993572289, 462777294,  2453630352, 726090704,  4170024046,
-            813760479,  3125444318, 1331224401, 1203416669, 3497395173, 2528908686, 1610778556,
-            267163358,  627307819,  294350450,  4252461657, 3302305047, 839609873,  1598505629,
-            3905396753, 3407593947, 1502262581, 1658629464, 1498139453, 2860737994, 1137070983,
-            2973368511, 3226624586, 1708925351, 195473107,  1973834367, 522423348,  1853471286,
-            1286593394, 2025932254, 1636839834, 555770116,  1255226060, 3482666699, 1515557266,
-            4244619305, 877073175,  641427670,  450188959,  1095230428, 710341587,  4216364784,
-            3022335608, 610535626,  1329467104, 262034293,  1665384485, 441595535,  2937045243,
-            2846877561, 1059914271, 978801343,  1150714166, 1689640190, 2219487087, 258315233,
-            3819595050, 377195836,  2727989292, 2460040634, 1828274968, 1200428010, 3601292788,
-            590004384,  3025338414, 3487643146, 3586255253, 3576058865, 1798441768, 1013577341,
-            3609472816, 1511067357, 3862104007, 3665193407, 1555165047, 4188135767, 2749766525,
-            1058917817, 1527094489, 3805115799, 1547526585, 817362043,  780594798,  2439842864,
-            2525211849, 3949139098, 2309049006, 642430472,  832084039,  81097112,   2619711743,
-            3148197354, 2231598766, 2863240894, 1639194881, 3018692935, 311769962,  2387524763,
-            3857547190, 3654577058, 2418052942, 1888597091, 991026264,  3292783340, 750206381,
-            2501986418, 2904195378, 1178067772, 3318328110, 3980484559, 655757623,  4265386540,
-            1964983082, 3673068643, 1319175627, 1539823819, 1635921454, 992141498,  1529070914,
-            1760958838, 1840073710, 3002614702, 3295305429, 2061530784, 1036243443, 2212957003,
-            2534375036, 3724542133, 1317296740, 2505350414, 2754670042, 3042995618, 3359715256,
-            1930700024, 3769953790, 3307920786, 1870611696, 1979908015, 684095804,  3697683979,
-            326641529,  1111193348, 3256907235, 1828801775, 3589061974, 1408835557, 2203918092,
-            1967781780, 2634997537, 2715287551, 1958610929, 17967467,   391604110,  2479429785,
-            324785401,  3833051255, 3993572289, 462777294,  2453630352, 726090704,  1236380896,
-            813760479,  3125444318, 1331224401, 1203416669, 728276857,  2528908686, 1610778556,
-            267163358,  627307819,  4276734917, 4252461657, 3302305047, 839609873,  1598505629,
-            3827653659, 3407593947, 1502262581, 1658629464, 1498139453, 3636064463, 1137070983,
-            2973368511, 3226624586, 1708925351, 2288771247, 1973834367, 522423348,  1853471286,
-            1286593394, 798364204,  1636839834, 555770116,  1255226060, 3482666699, 2385578475,
-            4244619305, 877073175,  641427670,  450188959,  3502743047, 710341587,  4216364784,
-            3022335608, 610535626,  2388448039, 262034293,  1665384485, 441595535,  2937045243,
-            3028160550, 1059914271, 978801343,  1150714166, 1689640190, 169488023,  258315233,
-            3819595050, 377195836,  2727989292, 837094660,  3531987448, 1901453576, 3312447598,
-            1036467641, 2243300650, 3148869460, 1886274644, 4076707689, 257110870,  3118463831,
-            1165161057, 1118846497, 3446934363, 1514176098, 1362957326, 2629874126, 791374320,
-            1015673947, 4252955786, 2409207780, 3831311130, 1654475922, 3682733431, 780405105,
-            4059616372, 503333525,  1471514828, 2526848791, 607539645,  730408454,  1574159005,
-            1777808061, 1296178310, 1078855633, 878462103,  269337411,  750735378,  2599590920,
-            4206153248, 939121991,  3061289971, 2543431563, 1684736054, 2319658494, 77300347,
-            3222569207, 3882064339, 2201120493, 289098227,  3934209124, 2407620042, 2713079957,
-            2812644841, 115993752,  2545688211, 774350907,  939749505,  2242588062, 960853876,
-            296665594,  1367312411, 3370351589, 711706404,  3331136631, 1370376958, 2322438166,
-            577115138,  1472236592, 4029835216, 1122502809, 3490426739, 1930206806, 2074277138,
-            1360950220, 3797708387, 2007430804, 2257239461, 3889012648, 710165871,  763101711,
-            728019024,  652403220,  2517020147, 1801290767, 1478810019, 1057288808, 2879821959,
-            3916870020, 1480362189, 919816752,  375872647,  3236906236, 1504223782, 128306943,
-            1355826533, 2656243649, 390454690,  3848250363, 377480950,  358651174,  1337795904,
-            1925462532, 2421843219, 173144626,  886649902,  402617827,  932830871,  742712936,
-            4033430386, 1409945926, 3617206544, 2383446356, 3452204096, 615486157,  720696019,
-            1730134434, 3918468503, 1629431965, 2174079220, 325852294,  234479771,  1490297289,
-            3579002992, 3538738636, 139386548,  3067789050, 2078261059, 3552654276, 1774602596,
-            2105142163, 2768099869, 2265044995, 3680536732, 3601322356, 2848878442, 1166743022,
-            3508176959, 2186695985, 550278868,  3324775634, 384537301,  1019044102, 3354263542,
-            1942540686, 922714337,  3097711558, 3074228403, 3565076630, 3459053081, 4128383906,
-            1114387332, 2101424539, 1192649508, 58778130,   1651798895, 1752063480, 1728826905,
-            2225187635, 2463770127,
-        },
-        {
-            1123931753, 800915839,  2670146685, 2584517290, 2689011569, 2836407660, 820138968,
-            1285057392, 715132499,  1637756570, 839920967,  3589119389, 3031070812, 3405810201,
-            1615493612, 2445706402, 1352408597, 3321459216, 2425605839, 1785857120, 693025248,
-            1497005709, 3686646713, 2259172623, 3646396061, 1014346354, 3862403446, 1320353729,
-            3067167802, 217235240,  3635504673, 202326371,  1466433944, 207711957,  253799962,
-            1334707885, 214725936,  1908553137, 644961462,  1517362679, 1024843293, 1858720837,
-            3277204973, 2492875541, 1186198287, 4213093118, 4107189076, 2686671722, 739268562,
-            3336468643, 289704831,  453230615,  4233490966, 323429330,  1135200837, 1652318601,
-            3460413949, 1499191745, 388305475,  3589823129, 206613678,  1180389202, 4209221845,
-            4228948070, 1828374065, 1675541745, 597891459,  4025248441, 3147443437, 3142404546,
-            3219746229, 3297213941, 3864631443, 3050751039, 2962348197, 476861939,  349150886,
-            364037918,  3120331780, 1423365899, 2921348708, 2001561287, 2334707221, 2156910740,
-            3268874550, 88169610,   3689872609, 3490498514, 12840880,   2343875604, 3258836513,
-            612588749,  3410382282, 2642014841, 1965291809, 219296730,  946126149,  4094063630,
-            2987893712, 244255730,  1382729642, 1005706665, 3200819095, 3223360291, 2876054479,
-            1727515981, 1347376635, 1060950159, 3980863080, 3259534468, 2354603687, 2058930276,
-            902005393,  174994039,  564561406,  3056649086, 3876683821, 4156506560, 1177295407,
-            1645162639, 2989697876, 1068685891, 1127624342, 2115013844, 2255747372, 2948112463,
-            726719982,  2304680006, 1219523085, 276944376,  4164894357, 3645932525, 4165497675,
-            316525744,  3847188940, 3747041397, 1015071339, 429094506,  994947030,  1654284243,
-            414814954,  1945926998, 2080468951, 873133960,  3810303617, 2079452418, 1577806975,
-            1241008040, 1696885638, 3613569428, 3300830546, 1922790539, 2290589939, 2127550540,
-            608561771,  4246437376, 128905801,  607732349,  2125761043, 2152410573, 1832041438,
-            1123931753, 800915839,  2670146685, 2584517290, 2161968057, 2836407660, 820138968,
-            1285057392, 715132499,  3338774486, 839920967,  3589119389, 3031070812, 3405810201,
-            2378531473, 2445706402, 1352408597, 3321459216, 2425605839, 378124519,  693025248,
-            1497005709, 3686646713, 2259172623, 2535748903, 1014346354, 3862403446, 1320353729,
-            3067167802, 2589713297, 3635504673, 202326371,  1466433944, 207711957,  200330572,
-            1334707885, 214725936,  1908553137, 644961462,  1839857912, 1024843293, 1858720837,
-            3277204973, 2492875541, 3526639193, 4213093118, 4107189076, 2686671722, 739268562,
-            3845845105, 289704831,  453230615,  4233490966, 323429330,  3214730104, 1652318601,
-            3460413949, 1499191745, 388305475,  4088600974, 206613678,  1180389202, 4209221845,
-            4228948070, 3111171140, 1675541745, 597891459,  4025248441, 3147443437, 4115383341,
-            3219746229, 3297213941, 3864631443, 3050751039, 666273540,  476861939,  349150886,
-            364037918,  3120331780, 884015026,  2921348708, 2001561287, 2334707221, 2156910740,
-            1681253914, 88169610,   3689872609, 3490498514, 12840880,   285467488,  3258836513,
-            612588749,  3410382282, 2642014841, 2746401767, 219296730,  946126149,  4094063630,
-            2987893712, 741373072,  1382729642, 1005706665, 3200819095, 3223360291, 2346471471,
-            1727515981, 1347376635, 1060950159, 3980863080, 1675706297, 2354603687, 2058930276,
-            902005393,  174994039,  4246233151, 3056649086, 3876683821, 4156506560, 1177295407,
-            172722911,  2989697876, 1068685891, 1127624342, 2115013844, 1490769705, 2948112463,
-            726719982,  2304680006, 1219523085, 2459791802, 4164894357, 3645932525, 4165497675,
-            316525744,  1230031228, 3747041397, 1015071339, 429094506,  994947030,  2759169529,
-            414814954,  1945926998, 2080468951, 873133960,  1288497112, 2079452418, 1577806975,
-            1241008040, 1696885638, 1908271182, 3300830546, 1922790539, 2290589939, 2127550540,
-            3280906312, 4246437376, 128905801,  607732349,  2125761043, 1113568667, 1832041438,
-            1123931753, 800915839,  2670146685, 3074725076, 2161968057, 2836407660, 820138968,
-            1285057392, 380573526,  3338774486, 839920967,  3589119389, 3031070812, 3413558724,
-            2378531473, 2445706402, 1352408597, 3321459216, 1312149288, 378124519,  693025248,
-            1497005709, 3686646713, 229625569,  2535748903, 1014346354, 3862403446, 1320353729,
-            3500942492, 2589713297, 3635504673, 202326371,  1466433944, 879409166,  200330572,
-            1334707885, 214725936,  1908553137, 3884051125, 1839857912, 1024843293, 1858720837,
-            3277204973, 2925836298, 3526639193, 4213093118, 4107189076, 2686671722, 508595376,
-            3845845105, 289704831,  453230615,  4233490966, 1593743192, 3214730104, 1652318601,
-            3460413949, 1499191745, 3037114238, 4088600974, 206613678,  1180389202, 4209221845,
-            2020833840, 3111171140, 1675541745, 597891459,  4025248441, 401720208,  4115383341,
-            3219746229, 3297213941, 3864631443, 1112344504, 666273540,  476861939,  349150886,
-            364037918,  1971810572, 884015026,  2921348708, 2001561287, 2334707221, 2505325618,
-            1681253914, 88169610,   3689872609, 3490498514, 1299034731, 285467488,  3258836513,
-            612588749,  3410382282, 3460481655, 2746401767, 219296730,  946126149,  4094063630,
-            2815810096, 741373072,  1382729642, 1005706665, 3200819095, 421824526,  2346471471,
-            1727515981, 1347376635, 1060950159, 731301608,  1675706297, 2354603687, 2058930276,
-            902005393,  1384273787, 4246233151, 3056649086, 3876683821, 4156506560, 3358602264,
-            172722911,  2989697876, 1068685891, 1127624342, 4026755102, 1490769705, 2948112463,
-            726719982,  2304680006, 3802635934, 2459791802, 4164894357, 3645932525, 4165497675,
-            3095846288, 1230031228, 3747041397, 1015071339, 429094506,  2898637009, 2759169529,
-            414814954,  1945926998, 2080468951, 3197308445, 1288497112, 2079452418, 1577806975,
-            1241008040, 582894084,  1908271182, 3300830546, 1922790539, 2290589939, 3332408439,
-            3280906312, 4246437376, 128905801,  607732349,  875877517,  1113568667, 1832041438,
-            1123931753, 800915839,  667157472,  3074725076, 2161968057, 2836407660, 820138968,
-            3724013555, 380573526,  3338774486, 839920967,  3589119389, 2739903548, 3413558724,
-            2378531473, 2445706402, 1352408597, 3235211546, 1312149288, 378124519,  693025248,
-            1497005709, 1378055076, 229625569,  2535748903, 1014346354, 3862403446, 1844599649,
-            3500942492, 2589713297, 3635504673, 202326371,  3210789171, 879409166,  200330572,
-            1334707885, 214725936,  872288394,  3884051125, 1839857912, 1024843293, 1858720837,
-            178797602,  2925836298, 3526639193, 4213093118, 4107189076, 4051178534, 508595376,
-            3845845105, 289704831,  453230615,  3959388026, 1593743192, 3214730104, 1652318601,
-            3460413949, 2482676196, 3037114238, 4088600974, 206613678,  1180389202, 1116228600,
-            2020833840, 3111171140, 1675541745, 597891459,  757863101,  401720208,  4115383341,
-            3219746229, 3297213941, 4194517258, 1112344504, 666273540,  476861939,  349150886,
-            2898197682, 1971810572, 884015026,  2921348708, 2001561287, 3154500222, 2505325618,
-            1681253914, 88169610,   3689872609, 2970945806, 1299034731, 285467488,  3258836513,
-            612588749,  886306465,  3460481655, 2746401767, 219296730,  946126149,  313552055,
-            2815810096, 741373072,  1382729642, 1005706665, 771558245,  421824526,  2346471471,
-            1727515981, 1347376635, 1337838057, 731301608,  1675706297, 2354603687, 2058930276,
-            3873138467, 1384273787, 4246233151, 3056649086, 3876683821, 2830476841, 3358602264,
-            172722911,  2989697876, 1068685891, 246120800,  4026755102, 1490769705, 2948112463,
-            726719982,  3166720445, 3802635934, 2459791802, 4164894357, 3645932525, 1230893785,
-            3095846288, 1230031228, 3747041397, 1015071339, 3649791052, 2898637009, 2759169529,
-            414814954,  1945926998, 2392469476, 3197308445, 1288497112, 2079452418, 1577806975,
-            2490934112, 582894084,  1908271182, 3300830546, 1922790539, 963984560,  3332408439,
-            3280906312, 4246437376, 128905801,  2433958887, 2974111493, 856473559,  916586248,
-            1220914149, 3199091352, 778199928,  2835359101, 2531717241, 439728017,  2387349824,
-            1660553224, 2208312110, 4151893731, 3887400178, 1948028322, 1232553001, 3534502813,
-            930457726,  2450822544, 342016111,  3222691145, 1755314945, 1016693380, 2082408973,
-            3070763520, 807850705,  3208369853, 633561732,  548887690,  826406587,  4160042096,
-            3017363995, 584972118,  1490873741, 2653181367, 1353562736, 1746669938, 883407180,
-            3405362251, 346158140,  3871107424, 1116717410, 1774727529, 2873380545, 3574432629,
-            2192755341, 232571166,  956402812,  1109143126, 2873530794, 2491433719, 190793436,
-            2729475322, 3337815180, 1911107316, 215683852,  1464558962, 2983201706, 1772155118,
-            3252915670, 1135755959, 1189998835, 4288258485, 3893863168, 1561818586, 554349465,
-            3874059067, 2147684564, 4125063884, 3468611451, 2173667483, 1289079383, 1963455241,
-            4136290455, 2530036354, 91152678,   1493667232, 3121388237, 3808106694, 296447621,
-            2958630202, 1254574280, 467578395,  3582774455, 1049988539, 3213933202, 3751466923,
-            369284841,  2695056567, 1646089565, 3668672860, 3432643955, 1013208619, 2870505834,
-            1772153518, 505703230,  3300757609, 1151064056, 4009507488, 223121165,  2400789758,
-            1705580897, 1618107592, 298021595,  1023470935, 4116599051, 2913855320, 3017852628,
-            2190148846, 161733903,  1533005380, 3791538232, 1430372704, 447367795,  1129805617,
-            349911328,  596935798,  2809519746, 1140746058, 2430977860, 1298524079, 703279417,
-            601614777,  904267083,  3852711737, 1104625245, 2509336995, 1469845367, 775840029,
-            490855074,  2436317332, 3613308641, 3283348916, 3426816384, 2975279410, 1707993645,
-            2046376651, 1388018358, 745540490,  1966442178, 2898190990, 8082015,    2752432038,
-            3166131532, 2866743300, 608511968,  2597726717, 3592080933, 2917868327, 817286027,
-            2764990699, 2255497967, 4157457057, 863203315,  2647077318, 2763132278, 1645381889,
-            2711363913, 1552375625,
-        },
-        {
-            1978406995, 576106282,  2238958298, 2073551095, 624788087,  4231569260, 1853272808,
-            238274694,  2389334758, 410188028,  2293786099, 4243662908, 2317700970, 4050493361,
-            2348206908, 485250660,  1212732903, 169414736,  292623762,  1602229231, 2466348869,
-            3063669700, 1872890881, 1887188929, 3447638989, 162521682,  1470651713, 4036975255,
-            3423782623, 4043724693, 1686690883, 2610958712, 35940353,   78593759,   1565950713,
-            1304303952, 2004267248, 1417268036, 3328228522, 789915977,  2567452041, 3564175714,
-            1838409932, 1455795236, 22377452,   455201131,  3340286965, 184599544,  4102076073,
-            4007870762, 1470247063, 1579231003, 3544385556, 3408973464, 3759098465, 3243598964,
-            532452279,  1172265732, 3520978258, 2880513876, 41188252,   1663974668, 3444236420,
-            338981290,  2140558860, 3310465688, 552673362,  3277110106, 948036400,  1346056406,
-            3257468427, 4008294878, 3788890535, 2414511414, 3539325895, 3025695322, 3727849930,
-            3922840362, 535899902,  665898223,  1456499692, 354208792,  247894771,  2093316680,
-            2945209002, 1029298544, 976007759,  394966955,  1843302845, 3689202777, 1999949614,
-            1070472810, 4233404701, 667526747,  2313963966, 3519400667, 1548274317, 3272402139,
-            2570038689, 892260481,  3547254358, 1540409404, 3687395534, 3751445920, 546406228,
-            2167638865, 4234783150, 806401261,  1351195286, 1085913868, 3109267901, 1882610112,
-            1568734773, 239430641,  3971361190, 383932711,  149541490,  196701535,  108079452,
-            888590964,  1708559652, 3196290573, 2115587458, 3198525248, 3580113911, 3098818120,
-            4271558926, 3208851696, 3354604918, 3536923694, 1087345822, 2292802521, 3500230819,
-            411564772,  2408049547, 1215342690, 1707182109, 774540619,  1613606757, 836141085,
-            1061962136, 348765795,  2852610966, 3526215991, 2708801073, 3467537935, 472234793,
-            3944263763, 1782219410, 502724699,  3525703395, 1756411033, 1358811278, 3938603279,
-            3701976555, 3259537961, 628617330,  1553932236, 1974037630, 2090519666, 2185028543,
-            1978406995, 576106282,  2238958298, 2073551095, 638634424,  4231569260, 1853272808,
-            238274694,  2389334758, 3808551433, 2293786099, 4243662908, 2317700970, 4050493361,
-            957981276,  485250660,  1212732903, 169414736,  292623762,  1956197178, 2466348869,
-            3063669700, 1872890881, 1887188929, 1162224455, 162521682,  1470651713, 4036975255,
-            3423782623, 3243414978, 1686690883, 2610958712, 35940353,   78593759,   1648686849,
-            1304303952, 2004267248, 1417268036, 3328228522, 3740797237, 2567452041, 3564175714,
-            1838409932, 1455795236, 1045087636, 455201131,  3340286965, 184599544,  4102076073,
-            2685677331, 1470247063, 1579231003, 3544385556, 3408973464, 3832799869, 3243598964,
-            532452279,  1172265732, 3520978258, 531684354,  41188252,   1663974668, 3444236420,
-            338981290,  1286622338, 3310465688, 552673362,  3277110106, 948036400,  2987864230,
-            3257468427, 4008294878, 3788890535, 2414511414, 2613137548, 3025695322, 3727849930,
-            3922840362, 535899902,  3288883992, 1456499692, 354208792,  247894771,  2093316680,
-            3775770224, 1029298544, 976007759,  394966955,  1843302845, 1484214934, 1999949614,
-            1070472810, 4233404701, 667526747,  3708951530, 3519400667, 1548274317, 3272402139,
-            2570038689, 3457725296, 3547254358, 1540409404, 3687395534, 3751445920, 181641144,
-            2167638865, 4234783150, 806401261,  1351195286, 3457819598, 3109267901, 1882610112,
-            1568734773, 239430641,  4037392309, 383932711,  149541490,  196701535,  108079452,
-            1724276622, 1708559652, 3196290573, 2115587458, 3198525248, 3784683125, 3098818120,
-            4271558926, 3208851696, 3354604918, 149872004,  1087345822, 2292802521, 3500230819,
-            411564772,  4068437023, 1215342690, 1707182109, 774540619,  1613606757, 1062624488,
-            1061962136, 348765795,  2852610966, 3526215991, 1518538195, 3467537935, 472234793,
-            3944263763, 1782219410, 1835413488, 3525703395, 1756411033, 1358811278, 3938603279,
-            1054245423, 3259537961, 628617330,  1553932236, 1974037630, 2030751433, 2185028543,
-            1978406995, 576106282,  2238958298, 3877268821, 638634424,  4231569260, 1853272808,
-            238274694,  2482404724, 3808551433, 2293786099, 4243662908, 2317700970, 1955227186,
-            957981276,  485250660,  1212732903, 169414736,  1333246101, 1956197178, 2466348869,
-            3063669700, 1872890881, 3662049503, 1162224455, 162521682,  1470651713, 4036975255,
-            3593925064, 3243414978, 1686690883, 2610958712, 35940353,   2530174792, 1648686849,
-            1304303952, 2004267248, 1417268036, 1299827381, 3740797237, 2567452041, 3564175714,
-            1838409932, 4221368409, 1045087636, 455201131,  3340286965, 184599544,  486448047,
-            2685677331, 1470247063, 1579231003, 3544385556, 1404931688, 3832799869, 3243598964,
-            532452279,  1172265732, 3373048034, 531684354,  41188252,   1663974668, 3444236420,
-            1375188728, 1286622338, 3310465688, 552673362,  3277110106, 655980467,  2987864230,
-            3257468427, 4008294878, 3788890535, 763995173,  2613137548, 3025695322, 3727849930,
-            3922840362, 1850434657, 3288883992, 1456499692, 354208792,  247894771,  3440471938,
-            3775770224, 1029298544, 976007759,  394966955,  3298245949, 1484214934, 1999949614,
-            1070472810, 4233404701, 3788558253, 3708951530, 3519400667, 1548274317, 3272402139,
-            3117201719, 3457725296, 3547254358, 1540409404, 3687395534, 3871454027, 181641144,
-            2167638865, 4234783150, 806401261,  1627904858, 3457819598, 3109267901, 1882610112,
-            1568734773, 3178105921, 4037392309, 383932711,  149541490,  196701535,  424324376,
-            1724276622, 1708559652, 3196290573, 2115587458, 2946026327, 3784683125, 3098818120,
-            4271558926, 3208851696, 2551504859, 149872004,  1087345822, 2292802521, 3500230819,
-            3055410013, 4068437023, 1215342690, 1707182109, 774540619,  2466902579, 1062624488,
-            1061962136, 348765795,  2852610966, 355211123,  1518538195, 3467537935, 472234793,
-            3944263763, 3159176627, 1835413488, 3525703395, 1756411033, 1358811278, 2153206130,
-            1054245423, 3259537961, 628617330,  1553932236, 1741202495, 2030751433, 2185028543,
-            1978406995, 576106282,  2832311581, 3877268821, 638634424,  4231569260, 1853272808,
-            3103974717, 2482404724, 3808551433, 2293786099, 4243662908, 2607780401, 1955227186,
-            957981276,  485250660,  1212732903, 3214649174, 1333246101, 1956197178, 2466348869,
-            3063669700, 2428387069, 3662049503, 1162224455, 162521682,  1470651713, 3563435961,
-            3593925064, 3243414978, 1686690883, 2610958712, 1021669488, 2530174792, 1648686849,
-            1304303952, 2004267248, 1150095671, 1299827381, 3740797237, 2567452041, 3564175714,
-            1992360540, 4221368409, 1045087636, 455201131,  3340286965, 3795860292, 486448047,
-            2685677331, 1470247063, 1579231003, 3012017918, 1404931688, 3832799869, 3243598964,
-            532452279,  2740401823, 3373048034, 531684354,  41188252,   1663974668, 1239982773,
-            1375188728, 1286622338, 3310465688, 552673362,  2159084435, 655980467,  2987864230,
-            3257468427, 4008294878, 1526518186, 763995173,  2613137548, 3025695322, 3727849930,
-            4161669345, 1850434657, 3288883992, 1456499692, 354208792,  1648970767, 3440471938,
-            3775770224, 1029298544, 976007759,  292829454,  3298245949, 1484214934, 1999949614,
-            1070472810, 949984087,  3788558253, 3708951530, 3519400667, 1548274317, 3691975282,
-            3117201719, 3457725296, 3547254358, 1540409404, 3414085332, 3871454027, 181641144,
-            2167638865, 4234783150, 487427004,  1627904858, 3457819598, 3109267901, 1882610112,
-            2942538550, 3178105921, 4037392309, 383932711,  149541490,  528605550,  424324376,
-            1724276622, 1708559652, 3196290573, 2042399752, 2946026327, 3784683125, 3098818120,
-            4271558926, 2493686919, 2551504859, 149872004,  1087345822, 2292802521, 3257357826,
-            3055410013, 4068437023, 1215342690, 1707182109, 1101368233, 2466902579, 1062624488,
-            1061962136, 348765795,  377675640,  355211123,  1518538195, 3467537935, 472234793,
-            1918362523, 3159176627, 1835413488, 3525703395, 1756411033, 490591069,  2153206130,
-            1054245423, 3259537961, 628617330,  2464143505, 3547421156, 4181103091, 1646291356,
-            2711273600, 2961799099, 1443009342, 2191618308, 1193143275, 1858488142, 3741304147,
-            1479629752, 214641634,  1601114903, 3032545707, 5784133,    1466424840, 2251379876,
-            4054080092, 2965144328, 644228426,  1397556958, 422190032,  3059134799, 3779253493,
-            1314537880, 867798895,  3819721559, 3588436937, 670021879,  1070365654, 3339455790,
-            2963659516, 1662488399, 2336157317, 3427798652, 2782719134, 1317842084, 1576308528,
-            1129452059, 3400565954, 84977051,   3689257381, 3289717503, 3535165628, 3982356490,
-            173255911,  1929987033, 4221790572, 3473317939, 749060417,  2711561754, 316719217,
-            2359410057, 2014271053, 1432982162, 2107582322, 1899811989, 1394115707, 1134266213,
-            2334994542, 2475488907, 3238562415, 2410379210, 4147209396, 2446286513, 2194020199,
-            3068194593, 797186100,  1299000541, 1870322719, 2944499140, 1045779179, 2735528787,
-            3057750264, 2607876894, 1595833743, 3327636115, 3520489322, 3864068029, 3153522810,
-            2609437702, 1360208295, 2062444770, 3927110355, 1524755299, 1708215998, 3587488663,
-            2813888113, 686192293,  1078633032, 3066910876, 793688350,  3613674912, 387713910,
-            2660476731, 3032509241, 2353038709, 2212424333, 2110412913, 3631228061, 2765134272,
-            4025821789, 3324834269, 187577732,  1568270802, 2098502315, 2472645526, 2986813860,
-            1621191378, 3891512282, 1561648319, 2690491944, 3075246584, 3202791012, 315381589,
-            3645907425, 3532420114, 802256935,  1270128258, 2695868207, 4075358890, 3888212208,
-            510396943,  3683116722, 3943939501, 146061942,  733291914,  1402325031, 672641124,
-            2817168601, 2622398925, 3641379870, 2969146913, 4232866548, 1694492034, 3065141682,
-            234404736,  1921499010, 2300706258, 1304904939, 207802178,  2674605425, 2688377241,
-            2674991105, 2585496531, 2358858923, 2578793432, 3275116043, 228073476,  2936443283,
-            3713102344, 1629243323, 209348683,  3730808488, 275442226,  223820143,  2365614109,
-            3017206322, 1906208795,
-        },
-        {
-            1099029101, 1701048915, 660023640,  924841201,  3461127277, 2669772399, 3310617629,
-            1156241884, 1223658488, 2567989828, 1645353581, 3795054067, 2213566170, 2352168181,
-            4178319806, 3683165541, 3740728728, 1414553868, 4281176003, 4210772168, 1854361582,
-            2423407916, 2944076471, 3576987608, 4278915611, 408774781,  4062001009, 4154649791,
-            744276169,  3336929490, 750849434,  792509031,  2243475276, 3515532577, 2017469936,
-            3084537852, 339927898,  1811569595, 758774991,  3493303885, 3622691124, 759880366,
-            4151395926, 3898412662, 2694454548, 3984037521, 477186761,  1203186856, 3864847766,
-            3440760042, 3819586644, 2286027759, 169086087,  918454031,  30468593,   683300560,
-            2251922318, 1468111088, 3734551184, 4188523514, 1146491209, 2589258220, 789509252,
-            2377837185, 2384154376, 569281628,  541419124,  906516057,  1810220849, 3318327282,
-            821336629,  2573762886, 2902980874, 991226041,  2168817138, 4250448811, 3269566992,
-            171302113,  612159603,  2683334480, 2654342277, 137777859,  2747140217, 999518401,
-            2966995004, 60101885,   457915382,  3471130463, 1730381538, 1540579085, 4210568805,
-            99433542,   3941306723, 1741787859, 4178980451, 618420947,  653233225,  303380980,
-            756560737,  3412196740, 2628565904, 2924393650, 1231156279, 3931499216, 2538578634,
-            2619748424, 3722820647, 1368900953, 387028169,  581338912,  129717382,  2440785604,
-            3530341647, 737699905,  2653938938, 1436230426, 1412615207, 3302580369, 3567972303,
-            2168444722, 3623715629, 2482069294, 1382302080, 2228359384, 1725721682, 3527121772,
-            3082436023, 1041454975, 2256217909, 3304403811, 3340198501, 407239139,  2145350911,
-            431083079,  3131715853, 3371686806, 1121754410, 201421844,  286410433,  3405810621,
-            391655053,  1816468367, 3356727296, 2357478642, 472354519,  3359677658, 2580116312,
-            2526676655, 4097406088, 4089899479, 2215622881, 3361577862, 3799655766, 1325630936,
-            3153231462, 186914749,  2400764456, 1130065596, 3102960960, 1976942679, 2897640954,
-            1099029101, 1701048915, 660023640,  924841201,  1006478010, 2669772399, 3310617629,
-            1156241884, 1223658488, 1906083828, 1645353581, 3795054067, 2213566170, 2352168181,
-            1113766110, 3683165541, 3740728728, 1414553868, 4281176003, 552379988,  1854361582,
-            2423407916, 2944076471, 3576987608, 3513842379, 408774781,  4062001009, 4154649791,
-            744276169,  3206234572, 750849434,  792509031,  2243475276, 3515532577, 3522396813,
-            3084537852, 339927898,  1811569595, 758774991,  2618223000, 3622691124, 759880366,
-            4151395926, 3898412662, 932959034,  3984037521, 477186761,  1203186856, 3864847766,
-            986336866,  3819586644, 2286027759, 169086087,  918454031,  2636450439, 683300560,
-            2251922318, 1468111088, 3734551184, 2469869254, 1146491209, 2589258220, 789509252,
-            2377837185, 216704875,  569281628,  541419124,  906516057,  1810220849, 3421994251,
-            821336629,  2573762886, 2902980874, 991226041,  2309624638, 4250448811, 3269566992,
-            171302113,  612159603,  3626190108, 2654342277, 137777859,  2747140217, 999518401,
-            4217401604, 60101885,   457915382,  3471130463, 1730381538, 2164812288, 4210568805,
-            99433542,   3941306723, 1741787859, 393513705,  618420947,  653233225,  303380980,
-            756560737,  1607446727, 2628565904, 2924393650, 1231156279, 3931499216, 813369580,
-            2619748424, 3722820647, 1368900953, 387028169,  3406562846, 129717382,  2440785604,
-            3530341647, 737699905,  148831433,  1436230426, 1412615207, 3302580369, 3567972303,
-            3073281031, 3623715629, 2482069294, 1382302080, 2228359384, 443961000,  3527121772,
-            3082436023, 1041454975, 2256217909, 322002616,  3340198501, 407239139,  2145350911,
-            431083079,  1383196293, 3371686806, 1121754410, 201421844,  286410433,  970413737,
-            391655053,  1816468367, 3356727296, 2357478642, 4242561595, 3359677658, 2580116312,
-            2526676655, 4097406088, 56668552,   2215622881, 3361577862, 3799655766, 1325630936,
-            849757860,  186914749,  2400764456, 1130065596, 3102960960, 3851093625, 2897640954,
-            1099029101, 1701048915, 660023640,  4263489253, 1006478010, 2669772399, 3310617629,
-            1156241884, 352495790,  1906083828, 1645353581, 3795054067, 2213566170, 2230181201,
-            1113766110, 3683165541, 3740728728, 1414553868, 2943839854, 552379988,  1854361582,
-            2423407916, 2944076471, 3014011048, 3513842379, 408774781,  4062001009, 4154649791,
-            74816329,   3206234572, 750849434,  792509031,  2243475276, 1182966629, 3522396813,
-            3084537852, 339927898,  1811569595, 3759353600, 2618223000, 3622691124, 759880366,
-            4151395926, 2462493576, 932959034,  3984037521, 477186761,  1203186856, 2746529930,
-            986336866,  3819586644, 2286027759, 169086087,  1087157888, 2636450439, 683300560,
-            2251922318, 1468111088, 4069677827, 2469869254, 1146491209, 2589258220, 789509252,
-            283132789,  216704875,  569281628,  541419124,  906516057,  834011329,  3421994251,
-            821336629,  2573762886, 2902980874, 2939983975, 2309624638, 4250448811, 3269566992,
-            171302113,  2989944501, 3626190108, 2654342277, 137777859,  2747140217, 4260428444,
-            4217401604, 60101885,   457915382,  3471130463, 413921450,  2164812288, 4210568805,
-            99433542,   3941306723, 138107452,  393513705,  618420947,  653233225,  303380980,
-            380910094,  1607446727, 2628565904, 2924393650, 1231156279, 4151627775, 813369580,
-            2619748424, 3722820647, 1368900953, 2439948578, 3406562846, 129717382,  2440785604,
-            3530341647, 4142267746, 148831433,  1436230426, 1412615207, 3302580369, 2358075637,
-            3073281031, 3623715629, 2482069294, 1382302080, 4121165293, 443961000,  3527121772,
-            3082436023, 1041454975, 2704873119, 322002616,  3340198501, 407239139,  2145350911,
-            1543705705, 1383196293, 3371686806, 1121754410, 201421844,  1456579442, 970413737,
-            391655053,  1816468367, 3356727296, 3422462043, 4242561595, 3359677658, 2580116312,
-            2526676655, 2903227464, 56668552,   2215622881, 3361577862, 3799655766, 2640125935,
-            849757860,  186914749,  2400764456, 1130065596, 3274982622, 3851093625, 2897640954,
-            1099029101, 1701048915, 2518861145, 4263489253, 1006478010, 2669772399, 3310617629,
-            4263761516, 352495790,  1906083828, 1645353581, 3795054067, 3855242917, 2230181201,
-            1113766110, 3683165541, 3740728728, 321862238,  2943839854, 552379988,  1854361582,
-            2423407916, 444936098,  3014011048, 3513842379, 408774781,  4062001009, 4121875038,
-            74816329,   3206234572, 750849434,  792509031,  3737307494, 1182966629, 3522396813,
-            3084537852, 339927898,  3362265077, 3759353600, 2618223000, 3622691124, 759880366,
-            2741723609, 2462493576, 932959034,  3984037521, 477186761,  3460480863, 2746529930,
-            986336866,  3819586644, 2286027759, 3196012381, 1087157888, 2636450439, 683300560,
-            2251922318, 3222223029, 4069677827, 2469869254, 1146491209, 2589258220, 224302876,
-            283132789,  216704875,  569281628,  541419124,  2116608815, 834011329,  3421994251,
-            821336629,  2573762886, 2197489804, 2939983975, 2309624638, 4250448811, 3269566992,
-            532057607,  2989944501, 3626190108, 2654342277, 137777859,  3869477804, 4260428444,
-            4217401604, 60101885,   457915382,  1940239785, 413921450,  2164812288, 4210568805,
-            99433542,   4107105251, 138107452,  393513705,  618420947,  653233225,  16987260,
-            380910094,  1607446727, 2628565904, 2924393650, 4072009117, 4151627775, 813369580,
-            2619748424, 3722820647, 1018425035, 2439948578, 3406562846, 129717382,  2440785604,
-            2488737026, 4142267746, 148831433,  1436230426, 1412615207, 2288398280, 2358075637,
-            3073281031, 3623715629, 2482069294, 2371016992, 4121165293, 443961000,  3527121772,
-            3082436023, 2164519546, 2704873119, 322002616,  3340198501, 407239139,  737153544,
-            1543705705, 1383196293, 3371686806, 1121754410, 3865317956, 1456579442, 970413737,
-            391655053,  1816468367, 1806281358, 3422462043, 4242561595, 3359677658, 2580116312,
-            2075865578, 2903227464, 56668552,   2215622881, 3361577862, 3696310256, 2640125935,
-            849757860,  186914749,  2400764456, 2849955306, 4294005941, 841691567,  3752382156,
-            1115065115, 3434950585, 3634789869, 87344478,   300176033,  2597397692, 166276004,
-            2622268465, 1306218150, 2297706725, 1543276708, 2394502148, 954981299,  4143416994,
-            3216293174, 1697448007, 2501627265, 676422499,  1094025881, 3697254330, 3337682003,
-            2184812301, 596448854,  791491909,  336857202,  1760617252, 1803966969, 3298116153,
-            3031691703, 2971314732, 1095681124, 1402517778, 1257340992, 186745674,  17897492,
-            2065658599, 2925892796, 3323170708, 3179723639, 1948789767, 798671679,  3140595449,
-            3204844475, 3930703868, 1689879339, 2596999779, 1522387358, 1951606983, 3132234327,
-            3700777938, 2826480814, 3349934132, 122855535,  3686996435, 3453232399, 1815508176,
-            2686323933, 2609257443, 1436581608, 2355039756, 1524890603, 2807874715, 3347670991,
-            3110836205, 319096793,  247866160,  3769392646, 1834322458, 1559050215, 2538048296,
-            3690923268, 2122716934, 2623344444, 2335323739, 2304247567, 1604174533, 4220989323,
-            1018445320, 1254639138, 2464867502, 2889998178, 1837839432, 1845670743, 2793682783,
-            1009625269, 1606110131, 4090574643, 965948,     6144452,    2085360665, 1326517135,
-            1612714166, 3092488448, 2344624746, 731739745,  2555721993, 3633684356, 3293222559,
-            124816,     2694657865, 2210170968, 3844738227, 896958100,  1640623854, 1610872827,
-            2076543784, 2155495334, 418942034,  4246323165, 3383046643, 2777811895, 750699093,
-            1000921430, 3072974562, 2534675899, 734273908,  500972903,  3539946241, 4283654174,
-            3213689985, 2790734237, 585736122,  2748014469, 833688057,  2279623835, 85761542,
-            2754698559, 1955568301, 4289759280, 1804365506, 687211877,  2202076673, 2053438166,
-            685979536,  3914012629, 2160282663, 1195727278, 2703313898, 4159760536, 3458711089,
-            3649015996, 208673055,  1742320529, 2888242122, 1355237873, 2559038763, 1371354600,
-            705037314,  2265823306, 2221738434, 6467875,    3537235679, 243587375,  2480522944,
-            2709487716, 2858129369,
-        },
-        {
-            1545504510, 1985586093, 2005504076, 2487099791, 2348737867, 2254755902, 3789154730,
-            3268946922, 99552511,   1369361877, 1888041043, 3105269579, 4044127396, 2380045264,
-            2970234287, 293292961,  1811276320, 1083136897, 3016497500, 950611584,  2165628367,
-            4140133899, 2402926185, 990501164,  2185997143, 1769871204, 721625457,  567446962,
-            1695515231, 1848699963, 4163520111, 2316975723, 4268269680, 1021066723, 517434635,
-            3827063239, 3483118065, 760366769,  3072996795, 3548263896, 2131401627, 4167855065,
-            410255606,  1992500865, 1322267629, 1599293552, 2389387938, 3721625360, 216375429,
-            2002236178, 1834631738, 1585275126, 3879559071, 2517667239, 1397456303, 4095227658,
-            589002062,  137665950,  3933018338, 1519132173, 3566494128, 3914066872, 3233332246,
-            855336825,  1882502420, 1081015168, 4148374722, 1683880703, 1161266344, 99374978,
-            733926790,  3520260556, 3643143173, 927318029,  398003191,  3472026294, 3518018860,
-            2319507998, 2650129369, 3781620600, 1294634949, 3977318486, 3068540117, 3732334866,
-            740308004,  1988900647, 2936479173, 2348744493, 1357856242, 3842428732, 3746094733,
-            214260739,  3493892012, 2358001919, 1775614809, 952871363,  1216985499, 2706067772,
-            1008517818, 4189424856, 1260334069, 2420035836, 311831945,  3409272605, 4266242510,
-            3590716427, 537257045,  3153762469, 1620749663, 3338743851, 3644831936, 3243426619,
-            783551642,  1305153827, 2026979662, 3164955857, 4082645339, 1633544228, 3389303153,
-            440623817,  204979344,  1674764841, 633231391,  4180702701, 1953210184, 2534954734,
-            4252100558, 2993632630, 4050264705, 678445398,  1502035091, 302442688,  493504779,
-            2321459487, 1141171231, 1507727159, 672678623,  4046722895, 65675127,   2936731189,
-            441159654,  832039862,  2252252769, 3090962795, 2839688755, 645344032,  2921087914,
-            2264738834, 2341060101, 778789539,  737962654,  2859693559, 2784310535, 493247978,
-            185832691,  3321631011, 641506549,  2652806878, 480335604,  2908694258, 984807024,
-            1545504510, 1985586093, 2005504076, 2487099791, 127488455,  2254755902, 3789154730,
-            3268946922, 99552511,   2160330513, 1888041043, 3105269579, 4044127396, 2380045264,
-            3185912634, 293292961,  1811276320, 1083136897, 3016497500, 116883339,  2165628367,
-            4140133899, 2402926185, 990501164,  4099344218, 1769871204, 721625457,  567446962,
-            1695515231, 1218419978, 4163520111, 2316975723, 4268269680, 1021066723, 237254804,
-            3827063239, 3483118065, 760366769,  3072996795, 1020639813, 2131401627, 4167855065,
-            410255606,  1992500865, 1887858126, 1599293552, 2389387938, 3721625360, 216375429,
-            2096265248, 1834631738, 1585275126, 3879559071, 2517667239, 3267338158, 4095227658,
-            589002062,  137665950,  3933018338, 3823062902, 3566494128, 3914066872, 3233332246,
-            855336825,  3240858503, 1081015168, 4148374722, 1683880703, 1161266344, 4034899335,
-            733926790,  3520260556, 3643143173, 927318029,  2130442867, 3472026294, 3518018860,
-            2319507998, 2650129369, 253769320,  1294634949, 3977318486, 3068540117, 3732334866,
-            3100107703, 1988900647, 2936479173, 2348744493, 1357856242, 477065277,  3746094733,
-            214260739,  3493892012, 2358001919, 52055911,   952871363,  1216985499, 2706067772,
-            1008517818, 2820619262, 1260334069, 2420035836, 311831945,  3409272605, 2066128794,
-            3590716427, 537257045,  3153762469, 1620749663, 2261931254, 3644831936, 3243426619,
-            783551642,  1305153827, 3937339872, 3164955857, 4082645339, 1633544228, 3389303153,
-            3304461891, 204979344,  1674764841, 633231391,  4180702701, 2649553051, 2534954734,
-            4252100558, 2993632630, 4050264705, 3777379050, 1502035091, 302442688,  493504779,
-            2321459487, 1795212504, 1507727159, 672678623,  4046722895, 65675127,   2810951967,
-            441159654,  832039862,  2252252769, 3090962795, 3317253399, 645344032,  2921087914,
-            2264738834, 2341060101, 1431934790, 737962654,  2859693559, 2784310535, 493247978,
-            555655767,  3321631011, 641506549,  2652806878, 480335604,  1837415425, 984807024,
-            1545504510, 1985586093, 2005504076, 2274320195, 127488455,  2254755902, 3789154730,
-            3268946922, 3812459919, 2160330513, 1888041043, 3105269579, 4044127396, 2341347785,
-            3185912634, 293292961,  1811276320, 1083136897, 825098089,  116883339,  2165628367,
-            4140133899, 2402926185, 4124720284, 4099344218, 1769871204, 721625457,  567446962,
-            3598160577, 1218419978, 4163520111, 2316975723, 4268269680, 923374392,  237254804,
-            3827063239, 3483118065, 760366769,  2263405553, 1020639813, 2131401627, 4167855065,
-            410255606,  3382265961, 1887858126, 1599293552, 2389387938, 3721625360, 3440586186,
-            2096265248, 1834631738, 1585275126, 3879559071, 711626863,  3267338158, 4095227658,
-            589002062,  137665950,  1190761134, 3823062902, 3566494128, 3914066872, 3233332246,
-            3844456625, 3240858503, 1081015168, 4148374722, 1683880703, 589447946,  4034899335,
-            733926790,  3520260556, 3643143173, 3202263729, 2130442867, 3472026294, 3518018860,
-            2319507998, 3458685425, 253769320,  1294634949, 3977318486, 3068540117, 702365700,
-            3100107703, 1988900647, 2936479173, 2348744493, 969926974,  477065277,  3746094733,
-            214260739,  3493892012, 2890740482, 52055911,   952871363,  1216985499, 2706067772,
-            1079370138, 2820619262, 1260334069, 2420035836, 311831945,  701108525,  2066128794,
-            3590716427, 537257045,  3153762469, 2900214585, 2261931254, 3644831936, 3243426619,
-            783551642,  3143067452, 3937339872, 3164955857, 4082645339, 1633544228, 1680728882,
-            3304461891, 204979344,  1674764841, 633231391,  689425572,  2649553051, 2534954734,
-            4252100558, 2993632630, 865432399,  3777379050, 1502035091, 302442688,  493504779,
-            1282312650, 1795212504, 1507727159, 672678623,  4046722895, 976003271,  2810951967,
-            441159654,  832039862,  2252252769, 726554843,  3317253399, 645344032,  2921087914,
-            2264738834, 1325395107, 1431934790, 737962654,  2859693559, 2784310535, 3876486226,
-            555655767,  3321631011, 641506549,  2652806878, 3848380198, 1837415425, 984807024,
-            1545504510, 1985586093, 3711682090, 2274320195, 127488455,  2254755902, 3789154730,
-            1595223697, 3812459919, 2160330513, 1888041043, 3105269579, 2773455385, 2341347785,
-            3185912634, 293292961,  1811276320, 3280464626, 825098089,  116883339,  2165628367,
-            4140133899, 3092114881, 4124720284, 4099344218, 1769871204, 721625457,  1514083147,
-            3598160577, 1218419978, 4163520111, 2316975723, 200993429,  923374392,  237254804,
-            3827063239, 3483118065, 677187089,  2263405553, 1020639813, 2131401627, 4167855065,
-            1892382552, 3382265961, 1887858126, 1599293552, 2389387938, 4153928364, 3440586186,
-            2096265248, 1834631738, 1585275126, 3348317504, 711626863,  3267338158, 4095227658,
-            589002062,  3125839176, 1190761134, 3823062902, 3566494128, 3914066872, 1320578396,
-            3844456625, 3240858503, 1081015168, 4148374722, 258762412,  589447946,  4034899335,
-            733926790,  3520260556, 4290301810, 3202263729, 2130442867, 3472026294, 3518018860,
-            2904238635, 3458685425, 253769320,  1294634949, 3977318486, 2517006218, 702365700,
-            3100107703, 1988900647, 2936479173, 3227096174, 969926974,  477065277,  3746094733,
-            214260739,  3868449115, 2890740482, 52055911,   952871363,  1216985499, 2857823043,
-            1079370138, 2820619262, 1260334069, 2420035836, 1843837226, 701108525,  2066128794,
-            3590716427, 537257045,  1202524172, 2900214585, 2261931254, 3644831936, 3243426619,
-            2113758468, 3143067452, 3937339872, 3164955857, 4082645339, 3987431298, 1680728882,
-            3304461891, 204979344,  1674764841, 2684386058, 689425572,  2649553051, 2534954734,
-            4252100558, 3511996574, 865432399,  3777379050, 1502035091, 302442688,  970989610,
-            1282312650, 1795212504, 1507727159, 672678623,  3080995547, 976003271,  2810951967,
-            441159654,  832039862,  2670291295, 726554843,  3317253399, 645344032,  2921087914,
-            3039207936, 1325395107, 1431934790, 737962654,  2859693559, 2452474228, 3876486226,
-            555655767,  3321631011, 641506549,  712394572,  931322445,  3691485988, 77755644,
-            3585967569, 1546642657, 1074481665, 1211742891, 2405208503, 1015438825, 3187019083,
-            2194891243, 1305917012, 3737279586, 2633137983, 1924729261, 72781059,   1412697099,
-            3828782214, 1637665425, 4170514983, 2248277352, 3793164712, 2365683667, 1287488796,
-            3240061130, 2411573225, 3237771995, 901649504,  4107276625, 1613775409, 741888560,
-            332459303,  850991886,  3249391248, 3550484151, 3689717953, 233288631,  2496730550,
-            3221264250, 3172144573, 1429937065, 1776357872, 1084763904, 1993209913, 4142869218,
-            3130780078, 18180577,   2819625557, 1978393449, 372704074,  3919523286, 1777756963,
-            188652529,  411213996,  62282979,   3775037518, 2534579861, 2966280971, 3863833471,
-            3228893189, 3123894696, 362579125,  1232030882, 575379775,  1019196436, 1914161190,
-            3649246842, 2192095564, 2368224476, 138396720,  1299868479, 507152626,  2129033575,
-            3801624222, 623352301,  1551535796, 3848329776, 2727905150, 1109499603, 3222756581,
-            3914846131, 3207366497, 3216028717, 3712661572, 1970542,    1320230637, 2583706801,
-            1341029904, 1903168049, 1244252579, 1885511879, 2426625042, 3082846847, 3858784104,
-            2263210027, 130350645,  956540733,  776729371,  2266749094, 2220603773, 2556170531,
-            263980324,  802194348,  697108594,  3634984969, 4251738712, 1831444758, 1209156358,
-            3089957258, 4195548426, 3641578987, 990686800,  2391278490, 2233755358, 1739784005,
-            2458544650, 340925249,  2442887806, 3503407512, 3058778909, 3619026333, 2289286518,
-            1296212011, 3879317178, 1210295163, 3113210467, 1578990986, 641384071,  2437977832,
-            1689385197, 1323268226, 861337916,  3532905860, 3735971843, 2294673483, 1032787575,
-            1868992735, 4260308791, 2091311463, 2354047234, 1005300697, 29821726,   2790044161,
-            3154591207, 1370229266, 3464848205, 3855301526, 544374401,  101012897,  4214903025,
-            1310520049, 14884434,   1438288148, 2118574986, 2360002070, 512167778,  4186534704,
-            3633828199, 493600836,
-        },
-        {
-            3630746050, 3859845279, 402434064,  3823658558, 1532253053, 2816329453, 2157119584,
-            525908078,  2602384943, 3160450667, 2181863566, 1553616107, 1073532619, 1517340596,
-            378137662,  452350626,  3107411951, 3568313089, 3770407938, 1924172496, 3853367492,
-            2231927005, 1462460507, 3243053458, 3048901482, 3875086280, 3061592457, 70256486,
-            2132563742, 3212103058, 3526698415, 2446413412, 2713023809, 2875023524, 1749140756,
-            70285469,   2454867667, 307248076,  4144788616, 3579728667, 581515020,  3547934664,
-            1227206208, 1818762839, 2773328031, 2959721180, 464057826,  162687670,  2065297563,
-            1561518447, 4235085591, 1843018148, 259545381,  705897451,  2055544370, 2838775396,
-            3222065603, 318590822,  3851463496, 1224011656, 1766612394, 896167327,  1191842825,
-            1939986931, 1847209539, 606090970,  3594121561, 1154708600, 879601315,  522455575,
-            3473570747, 1313274420, 3577469129, 4079898288, 710241525,  979407708,  1376992856,
-            2326648309, 287458780,  2260377218, 3403058029, 3415965591, 3742291382, 718077689,
-            1823822195, 3009582539, 2118741658, 712984550,  3688066770, 2926230123, 3595776787,
-            2781557657, 922339018,  3286213332, 403268408,  3664694492, 2257291448, 1951060070,
-            3724297309, 758932973,  2270837317, 2030399357, 935850756,  3168281045, 1328454571,
-            1673776455, 2251479720, 2070439310, 2331230005, 3554822546, 3409014755, 1787467372,
-            4023880515, 2418376424, 3512193680, 4293694869, 742097470,  1042642500, 3788355182,
-            3738996396, 2311795947, 2369173108, 280798720,  4078871575, 4057493249, 1570256021,
-            1943939246, 1619485718, 637483371,  1186434855, 2398032996, 4081638551, 2076689781,
-            4099174700, 3476977753, 4050180494, 3259548619, 3541515356, 2409101731, 1931819018,
-            990975946,  4067655858, 610482844,  743182358,  29491307,   2001170494, 377776221,
-            4050628945, 1560870533, 287979823,  4001249281, 239376420,  72203548,   505091938,
-            2949528451, 552156614,  741878204,  1726106700, 2274241439, 2081054242, 2819790721,
-            3630746050, 3859845279, 402434064,  3823658558, 1752896218, 2816329453, 2157119584,
-            525908078,  2602384943, 1270628269, 2181863566, 1553616107, 1073532619, 1517340596,
-            1819406808, 452350626,  3107411951, 3568313089, 3770407938, 716308213,  3853367492,
-            2231927005, 1462460507, 3243053458, 367244335,  3875086280, 3061592457, 70256486,
-            2132563742, 3897741589, 3526698415, 2446413412, 2713023809, 2875023524, 1041178004,
-            70285469,   2454867667, 307248076,  4144788616, 75297909,   581515020,  3547934664,
-            1227206208, 1818762839, 1755668431, 2959721180, 464057826,  162687670,  2065297563,
-            1085276537, 4235085591, 1843018148, 259545381,  705897451,  2412894634, 2838775396,
-            3222065603, 318590822,  3851463496, 461538816,  1766612394, 896167327,  1191842825,
-            1939986931, 3818149786, 606090970,  3594121561, 1154708600, 879601315,  2271070806,
-            3473570747, 1313274420, 3577469129, 4079898288, 1710201693, 979407708,  1376992856,
-            2326648309, 287458780,  1262655890, 3403058029, 3415965591, 3742291382, 718077689,
-            1397835462, 3009582539, 2118741658, 712984550,  3688066770, 2192977797, 3595776787,
-            2781557657, 922339018,  3286213332, 3512094677, 3664694492, 2257291448, 1951060070,
-            3724297309, 297578824,  2270837317, 2030399357, 935850756,  3168281045, 1119145841,
-            1673776455, 2251479720, 2070439310, 2331230005, 4273012256, 3409014755, 1787467372,
-            4023880515, 2418376424, 413031757,  4293694869, 742097470,  1042642500, 3788355182,
-            337423741,  2311795947, 2369173108, 280798720,  4078871575, 3703100688, 1570256021,
-            1943939246, 1619485718, 637483371,  4001000937, 2398032996, 4081638551, 2076689781,
-            4099174700, 61803411,   4050180494, 3259548619, 3541515356, 2409101731, 1246845276,
-            990975946,  4067655858, 610482844,  743182358,  1871021127, 2001170494, 377776221,
-            4050628945, 1560870533, 1071013427, 4001249281, 239376420,  72203548,   505091938,
-            2883039177, 552156614,  741878204,  1726106700, 2274241439, 2915367906, 2819790721,
-            3630746050, 3859845279, 402434064,  653996876,  1752896218, 2816329453, 2157119584,
-            525908078,  1835411716, 1270628269, 2181863566, 1553616107, 1073532619, 576757140,
-            1819406808, 452350626,  3107411951, 3568313089, 1336296211, 716308213,  3853367492,
-            2231927005, 1462460507, 3756206090, 367244335,  3875086280, 3061592457, 70256486,
-            3233532995, 3897741589, 3526698415, 2446413412, 2713023809, 1433332634, 1041178004,
-            70285469,   2454867667, 307248076,  3180793841, 75297909,   581515020,  3547934664,
-            1227206208, 1241877558, 1755668431, 2959721180, 464057826,  162687670,  2491713032,
-            1085276537, 4235085591, 1843018148, 259545381,  2470881224, 2412894634, 2838775396,
-            3222065603, 318590822,  805805101,  461538816,  1766612394, 896167327,  1191842825,
-            3697321377, 3818149786, 606090970,  3594121561, 1154708600, 635439993,  2271070806,
-            3473570747, 1313274420, 3577469129, 3647693382, 1710201693, 979407708,  1376992856,
-            2326648309, 3475934417, 1262655890, 3403058029, 3415965591, 3742291382, 4053810597,
-            1397835462, 3009582539, 2118741658, 712984550,  1830920072, 2192977797, 3595776787,
-            2781557657, 922339018,  1230946721, 3512094677, 3664694492, 2257291448, 1951060070,
-            1112310259, 297578824,  2270837317, 2030399357, 935850756,  4254116619, 1119145841,
-            1673776455, 2251479720, 2070439310, 1738429940, 4273012256, 3409014755, 1787467372,
-            4023880515, 3698806738, 413031757,  4293694869, 742097470,  1042642500, 1250315611,
-            337423741,  2311795947, 2369173108, 280798720,  917401590,  3703100688, 1570256021,
-            1943939246, 1619485718, 340296019,  4001000937, 2398032996, 4081638551, 2076689781,
-            3820923579, 61803411,   4050180494, 3259548619, 3541515356, 4214934957, 1246845276,
-            990975946,  4067655858, 610482844,  1956842341, 1871021127, 2001170494, 377776221,
-            4050628945, 4154204450, 1071013427, 4001249281, 239376420,  72203548,   1649626516,
-            2883039177, 552156614,  741878204,  1726106700, 2787721454, 2915367906, 2819790721,
-            3630746050, 3859845279, 1749492936, 653996876,  1752896218, 2816329453, 2157119584,
-            2018835136, 1835411716, 1270628269, 2181863566, 1553616107, 1150112418, 576757140,
-            1819406808, 452350626,  3107411951, 2873865879, 1336296211, 716308213,  3853367492,
-            2231927005, 2529743291, 3756206090, 367244335,  3875086280, 3061592457, 3505059459,
-            3233532995, 3897741589, 3526698415, 2446413412, 2966917934, 1433332634, 1041178004,
-            70285469,   2454867667, 3069907146, 3180793841, 75297909,   581515020,  3547934664,
-            2045811056, 1241877558, 1755668431, 2959721180, 464057826,  3154080921, 2491713032,
-            1085276537, 4235085591, 1843018148, 1477470102, 2470881224, 2412894634, 2838775396,
-            3222065603, 452799106,  805805101,  461538816,  1766612394, 896167327,  1089027980,
-            3697321377, 3818149786, 606090970,  3594121561, 4003961123, 635439993,  2271070806,
-            3473570747, 1313274420, 2315623753, 3647693382, 1710201693, 979407708,  1376992856,
-            2055100659, 3475934417, 1262655890, 3403058029, 3415965591, 1934399941, 4053810597,
-            1397835462, 3009582539, 2118741658, 1362341803, 1830920072, 2192977797, 3595776787,
-            2781557657, 2713259426, 1230946721, 3512094677, 3664694492, 2257291448, 1564270892,
-            1112310259, 297578824,  2270837317, 2030399357, 1849846056, 4254116619, 1119145841,
-            1673776455, 2251479720, 474157614,  1738429940, 4273012256, 3409014755, 1787467372,
-            1495817106, 3698806738, 413031757,  4293694869, 742097470,  4219410213, 1250315611,
-            337423741,  2311795947, 2369173108, 3522023007, 917401590,  3703100688, 1570256021,
-            1943939246, 1986504205, 340296019,  4001000937, 2398032996, 4081638551, 3661561521,
-            3820923579, 61803411,   4050180494, 3259548619, 1087586504, 4214934957, 1246845276,
-            990975946,  4067655858, 2932930106, 1956842341, 1871021127, 2001170494, 377776221,
-            1211321994, 4154204450, 1071013427, 4001249281, 239376420,  2889473344, 1649626516,
-            2883039177, 552156614,  741878204,  555759119,  1132747754, 1183323688, 316247095,
-            3159469868, 3341854352, 1417212922, 2774560790, 1234034506, 1624754007, 1201909488,
-            1260407700, 1048399417, 4125980961, 2294472310, 4247351940, 1663053135, 2279993267,
-            3090204258, 3452131876, 3297586443, 2831726112, 4232252830, 1994451673, 1488072395,
-            4212093346, 3622023328, 2224471430, 2391269104, 2531978316, 1960255396, 406531241,
-            2150369461, 4280500185, 711615583,  3666087273, 3332726632, 1403312137, 1862651620,
-            598181824,  3339595196, 455997613,  2685540786, 3422518486, 282642102,  3122925753,
-            2358650156, 536008537,  4271123828, 2525430551, 3154560398, 1487726687, 2539513465,
-            125599273,  2370855747, 2901852463, 3228527867, 44960633,   1217540537, 2621776006,
-            1792591323, 111734510,  1871810833, 4186869100, 3315838941, 1329769701, 3647045187,
-            2311300578, 3631934655, 3459250475, 1599428936, 1534429230, 3499202857, 1984060029,
-            232100003,  881445442,  1367851082, 3320701802, 2112051035, 2349025807, 1988952503,
-            1497293778, 2375916157, 1432452891, 4293103032, 3603623210, 2361556480, 2989301447,
-            846537550,  3513805709, 3934734405, 2919504510, 562956546,  3030233445, 1251991850,
-            4010514241, 1291927910, 3722522476, 3414199816, 3638253534, 1439546006, 462288254,
-            2478734580, 1616148942, 2295424633, 692325103,  3478084962, 3540613967, 1348984072,
-            1288121578, 363920784,  3802893556, 396728290,  676422492,  2086571973, 62118789,
-            3653152683, 3342331569, 3375699210, 1986355947, 326938308,  3397322873, 3797333106,
-            1876895218, 902853816,  2286501541, 3788934438, 3252316470, 2137210021, 796855540,
-            3948438346, 2458930914, 3242461854, 2671674234, 2651270432, 2200252348, 3271429832,
-            379365110,  1086120564, 1334631202, 578597272,  1655697744, 2576694525, 3552863649,
-            3906302571, 3094511068, 379751398,  1644265603, 226755780,  2059629818, 263162789,
-            1201456431, 2952848397, 2413214270, 1638433343, 2615533509, 937165445,  1435455249,
-            4267237592, 3736198430,
-        },
-        {
-            2932801042, 4101748508, 3363559072, 1213475638, 2400369070, 1726749444, 3175844814,
-            2600020277, 3779799804, 1886667522, 1228105891, 589138388,  3960459504, 450669757,
-            3773736740, 2107201112, 1437834675, 3618095315, 3662453347, 968349971,  1891706458,
-            2333451375, 4242907074, 3265111057, 3648168902, 4137035018, 105573058,  2075999861,
-            1053920954, 3768713177, 1836088599, 2015103258, 2649187541, 2717894301, 534937136,
-            3492326400, 2406499346, 617315838,  1384748442, 519804615,  524657043,  832148261,
-            156272480,  394759604,  2428809631, 3401589884, 2588359262, 3826333418, 2427993050,
-            3254067543, 2570694144, 2876613091, 2883884893, 613070434,  1599903665, 3476967713,
-            1729385632, 207879231,  1256308247, 2538975486, 2550001448, 1820975095, 915640692,
-            1633749116, 1294669585, 3257901643, 3193347552, 3369630539, 285165240,  2337727802,
-            1854640523, 1034379307, 1206304638, 889104297,  3084078942, 3485609519, 3903898589,
-            4274630316, 3290195566, 2071163950, 775170461,  551343738,  164916146,  1678786363,
-            123960948,  2721608023, 3463122611, 1525791510, 1531697627, 1457848578, 665433501,
-            1784274031, 3436850186, 3976095421, 383031580,  2146948399, 3137780800, 410458873,
-            381977170,  4264728702, 1515223147, 3358033956, 139804933,  438534588,  901342240,
-            1536972976, 184570377,  681864510,  844333847,  2515362910, 917461167,  2538721219,
-            4268394152, 680292330,  3420438710, 3784725677, 1983802086, 4165891809, 2369490764,
-            3808530114, 3391499460, 2509287180, 970129219,  2492785859, 3611863290, 1303524794,
-            2991964551, 1828774928, 3950385781, 3251583775, 14901408,   1890180396, 1306701779,
-            3161784071, 637842485,  2830070006, 3867491336, 1594948357, 2579795132, 479188700,
-            806498245,  3905876458, 3499065005, 3168076042, 769094339,  3769363696, 1241457026,
-            1073618847, 251335726,  2574341631, 2534047421, 3151952274, 534046859,  3264754113,
-            1325368288, 2131927230, 3229420672, 336348290,  3768781638, 2593952436, 849969290,
-            2932801042, 4101748508, 3363559072, 1213475638, 1710895496, 1726749444, 3175844814,
-            2600020277, 3779799804, 4044580435, 1228105891, 589138388,  3960459504, 450669757,
-            4253882965, 2107201112, 1437834675, 3618095315, 3662453347, 3625360228, 1891706458,
-            2333451375, 4242907074, 3265111057, 3638586625, 4137035018, 105573058,  2075999861,
-            1053920954, 3014895241, 1836088599, 2015103258, 2649187541, 2717894301, 701652515,
-            3492326400, 2406499346, 617315838,  1384748442, 1142040801, 524657043,  832148261,
-            156272480,  394759604,  944890908,  3401589884, 2588359262, 3826333418, 2427993050,
-            337891051,  2570694144, 2876613091, 2883884893, 613070434,  659063916,  3476967713,
-            1729385632, 207879231,  1256308247, 311608860,  2550001448, 1820975095, 915640692,
-            1633749116, 1772334285, 3257901643, 3193347552, 3369630539, 285165240,  2627441892,
-            1854640523, 1034379307, 1206304638, 889104297,  2289660031, 3485609519, 3903898589,
-            4274630316, 3290195566, 3572160580, 775170461,  551343738,  164916146,  1678786363,
-            3109616684, 2721608023, 3463122611, 1525791510, 1531697627, 3660976089, 665433501,
-            1784274031, 3436850186, 3976095421, 1696775162, 2146948399, 3137780800, 410458873,
-            381977170,  1669455215, 1515223147, 3358033956, 139804933,  438534588,  1738237971,
-            1536972976, 184570377,  681864510,  844333847,  770765754,  917461167,  2538721219,
-            4268394152, 680292330,  1993152157, 3784725677, 1983802086, 4165891809, 2369490764,
-            3411542022, 3391499460, 2509287180, 970129219,  2492785859, 1869391890, 1303524794,
-            2991964551, 1828774928, 3950385781, 4139486157, 14901408,   1890180396, 1306701779,
-            3161784071, 174545194,  2830070006, 3867491336, 1594948357, 2579795132, 4132973523,
-            806498245,  3905876458, 3499065005, 3168076042, 538076966,  3769363696, 1241457026,
-            1073618847, 251335726,  2085586137, 2534047421, 3151952274, 534046859,  3264754113,
-            643987981,  2131927230, 3229420672, 336348290,  3768781638, 3468816701, 849969290,
-            2932801042, 4101748508, 3363559072, 2524943673, 1710895496, 1726749444, 3175844814,
-            2600020277, 3677241699, 4044580435, 1228105891, 589138388,  3960459504, 3903077887,
-            4253882965, 2107201112, 1437834675, 3618095315, 2362822379, 3625360228, 1891706458,
-            2333451375, 4242907074, 2289503940, 3638586625, 4137035018, 105573058,  2075999861,
-            1299938293, 3014895241, 1836088599, 2015103258, 2649187541, 3727003343, 701652515,
-            3492326400, 2406499346, 617315838,  1627975589, 1142040801, 524657043,  832148261,
-            156272480,  3658645823, 944890908,  3401589884, 2588359262, 3826333418, 3645806126,
-            337891051,  2570694144, 2876613091, 2883884893, 2866570997, 659063916,  3476967713,
-            1729385632, 207879231,  298556768,  311608860,  2550001448, 1820975095, 915640692,
-            1014996737, 1772334285, 3257901643, 3193347552, 3369630539, 96395889,   2627441892,
-            1854640523, 1034379307, 1206304638, 2546521293, 2289660031, 3485609519, 3903898589,
-            4274630316, 2360048518, 3572160580, 775170461,  551343738,  164916146,  2068601014,
-            3109616684, 2721608023, 3463122611, 1525791510, 1228011534, 3660976089, 665433501,
-            1784274031, 3436850186, 1620580129, 1696775162, 2146948399, 3137780800, 410458873,
-            2753059283, 1669455215, 1515223147, 3358033956, 139804933,  2786429190, 1738237971,
-            1536972976, 184570377,  681864510,  358796749,  770765754,  917461167,  2538721219,
-            4268394152, 2355846025, 1993152157, 3784725677, 1983802086, 4165891809, 360259050,
-            3411542022, 3391499460, 2509287180, 970129219,  4055494275, 1869391890, 1303524794,
-            2991964551, 1828774928, 3508750618, 4139486157, 14901408,   1890180396, 1306701779,
-            3684762156, 174545194,  2830070006, 3867491336, 1594948357, 702781070,  4132973523,
-            806498245,  3905876458, 3499065005, 1372989388, 538076966,  3769363696, 1241457026,
-            1073618847, 3579114424, 2085586137, 2534047421, 3151952274, 534046859,  1882037168,
-            643987981,  2131927230, 3229420672, 336348290,  555833786,  3468816701, 849969290,
-            2932801042, 4101748508, 1095934625, 2524943673, 1710895496, 1726749444, 3175844814,
-            2287140069, 3677241699, 4044580435, 1228105891, 589138388,  1596938176, 3903077887,
-            4253882965, 2107201112, 1437834675, 2605388022, 2362822379, 3625360228, 1891706458,
-            2333451375, 174003035,  2289503940, 3638586625, 4137035018, 105573058,  697023108,
-            1299938293, 3014895241, 1836088599, 2015103258, 4128339205, 3727003343, 701652515,
-            3492326400, 2406499346, 426422678,  1627975589, 1142040801, 524657043,  832148261,
-            2461054373, 3658645823, 944890908,  3401589884, 2588359262, 3184255074, 3645806126,
-            337891051,  2570694144, 2876613091, 187151044,  2866570997, 659063916,  3476967713,
-            1729385632, 2811989057, 298556768,  311608860,  2550001448, 1820975095, 1806779934,
-            1014996737, 1772334285, 3257901643, 3193347552, 2145947779, 96395889,   2627441892,
-            1854640523, 1034379307, 2748996070, 2546521293, 2289660031, 3485609519, 3903898589,
-            452746826,  2360048518, 3572160580, 775170461,  551343738,  669098691,  2068601014,
-            3109616684, 2721608023, 3463122611, 22889155,   1228011534, 3660976089, 665433501,
-            1784274031, 227705324,  1620580129, 1696775162, 2146948399, 3137780800, 4267814323,
-            2753059283, 1669455215, 1515223147, 3358033956, 2806778033, 2786429190, 1738237971,
-            1536972976, 184570377,  3310279262, 358796749,  770765754,  917461167,  2538721219,
-            2247224091, 2355846025, 1993152157, 3784725677, 1983802086, 2399541755, 360259050,
-            3411542022, 3391499460, 2509287180, 2335541531, 4055494275, 1869391890, 1303524794,
-            2991964551, 392724462,  3508750618, 4139486157, 14901408,   1890180396, 2513331299,
-            3684762156, 174545194,  2830070006, 3867491336, 1887131931, 702781070,  4132973523,
-            806498245,  3905876458, 2263606492, 1372989388, 538076966,  3769363696, 1241457026,
-            170472774,  3579114424, 2085586137, 2534047421, 3151952274, 1488165272, 1882037168,
-            643987981,  2131927230, 3229420672, 1158405862, 1469009373, 4117356830, 4063868500,
-            2006417445, 2976934394, 2683607933, 3174943272, 2099974138, 2250858961, 205251124,
-            84783688,   1551294676, 224349432,  1893741756, 3680361724, 561624088,  251553631,
-            1654870642, 2195380145, 866503297,  1814519294, 905566144,  727763043,  1910034093,
-            1876316198, 3031876716, 2783769690, 2649650479, 2024342098, 2170858649, 2186613759,
-            2688207487, 881594599,  1010953695, 2768977700, 3341020856, 2446339960, 2648757147,
-            1317083878, 3301541769, 3574285525, 3331294407, 712581268,  3612116700, 3510601489,
-            2569879282, 3772968052, 332485239,  280920979,  716834274,  1863623285, 654670865,
-            1706917935, 1598315563, 2486805657, 2295746319, 635609792,  55141757,   4089183045,
-            145257162,  1921789879, 2833550514, 3798992859, 1532875864, 3668053062, 2749191097,
-            3412220447, 3383752088, 3191842833, 4167387125, 2438940746, 1453011669, 2747298308,
-            1057877757, 399006034,  132680506,  31671249,   1070386969, 2415113777, 3720335676,
-            3416473189, 1476808053, 785398955,  3335661823, 315496929,  1421907623, 1802371914,
-            3049258946, 1773374729, 382902076,  3262814446, 1774244917, 4064677234, 2281551331,
-            3019541390, 2445483046, 3059154103, 2147309319, 566587847,  216051987,  521013398,
-            2721884570, 3325443529, 1921922591, 1643064709, 1155714395, 1737031844, 2117338012,
-            1876262536, 3589621009, 3800806613, 1102108318, 1376914700, 539544394,  799741508,
-            1192097712, 2894663754, 567276527,  106814343,  3985577014, 422246623,  126568764,
-            4008211389, 4037889581, 2185357423, 2239644921, 2116447019, 1249715620, 2095747493,
-            4063243162, 3059330950, 1045571624, 1150656233, 3024439196, 3981904623, 1743764595,
-            4220253496, 3322182853, 2132911849, 2074342674, 198749193,  574306951,  3563262292,
-            3832626833, 2349475213, 182567249,  1530390173, 2066055611, 2609802571, 1392638962,
-            1495846580, 2356952332, 4029921749, 1731839848, 527880959,  1204112231, 938004695,
-            294300378,  1855457892,
-        },
-        {
-            1272009436, 1616999861, 1230907383, 917244180,  3161397712, 2579667867, 3265758815,
-            2259124846, 988364163,  1860989467, 1540823742, 4110921053, 1987801760, 3308439749,
-            1653356841, 4046078683, 4294656535, 2999836980, 3752594447, 3565251002, 3355676157,
-            2409211454, 2617300758, 3201004997, 560889347,  1768836618, 265612713,  1159904343,
-            2034435611, 1449786547, 1497360900, 1450405044, 3392429775, 2939772880, 2269800321,
-            3322891462, 37869319,   3740137454, 2761270148, 3834356500, 1421247469, 59254818,
-            687693023,  58786845,   326289444,  402515609,  2314238620, 997436178,  1652457583,
-            4206478976, 3351457411, 2807382347, 947095143,  590880511,  2607492266, 1378385928,
-            2706867632, 380752350,  1943631994, 4073192060, 33026756,   4144433521, 3980183354,
-            538014690,  704259276,  2930555451, 1659955020, 1804800948, 2546756164, 3743207024,
-            1972913359, 2001228746, 1155046195, 3351514646, 2051419706, 2781991058, 3019824501,
-            2194587912, 3877151905, 1685716232, 999413357,  425350215,  2662520471, 246147133,
-            2811017259, 807958835,  1884086263, 1562675401, 2068845300, 4130330343, 1600848122,
-            4243305890, 3754531584, 1964677250, 1651687686, 1817355446, 310733229,  269234795,
-            2144387277, 2533737809, 1896527301, 2685328360, 2516765748, 2619594691, 4238695849,
-            3683402935, 1928157965, 2150799367, 280418009,  3617110215, 3035998523, 1712068175,
-            3681609475, 3290375768, 3330169406, 1367492323, 1568099780, 309103505,  3145116805,
-            2609720071, 201732189,  3870987217, 1597478804, 1879479930, 3828524658, 3958843866,
-            4226431013, 1301047748, 3564091542, 1008438817, 3951884177, 173801885,  1110908492,
-            1995059635, 2186148053, 2119807963, 3079801213, 1227300463, 2400051312, 1141396143,
-            4022145459, 3610478476, 2540462032, 278991510,  1352947105, 1124916533, 21972574,
-            1457344822, 867875267,  4015549969, 2710892042, 990223007,  2770972026, 1442277262,
-            625708546,  3280976948, 220550309,  1273830608, 4227403660, 1934243748, 2147562394,
-            1272009436, 1616999861, 1230907383, 917244180,  1201117002, 2579667867, 3265758815,
-            2259124846, 988364163,  2408902469, 1540823742, 4110921053, 1987801760, 3308439749,
-            1082516905, 4046078683, 4294656535, 2999836980, 3752594447, 658398103,  3355676157,
-            2409211454, 2617300758, 3201004997, 1946902176, 1768836618, 265612713,  1159904343,
-            2034435611, 1592040025, 1497360900, 1450405044, 3392429775, 2939772880, 110803392,
-            3322891462, 37869319,   3740137454, 2761270148, 531760595,  1421247469, 59254818,
-            687693023,  58786845,   1999542673, 402515609,  2314238620, 997436178,  1652457583,
-            1628244265, 3351457411, 2807382347, 947095143,  590880511,  1980148008, 1378385928,
-            2706867632, 380752350,  1943631994, 102965047,  33026756,   4144433521, 3980183354,
-            538014690,  375914533,  2930555451, 1659955020, 1804800948, 2546756164, 1439498490,
-            1972913359, 2001228746, 1155046195, 3351514646, 2367596358, 2781991058, 3019824501,
-            2194587912, 3877151905, 839532285,  999413357,  425350215,  2662520471, 246147133,
-            3755810452, 807958835,  1884086263, 1562675401, 2068845300, 4244674021, 1600848122,
-            4243305890, 3754531584, 1964677250, 3282094672, 1817355446, 310733229,  269234795,
-            2144387277, 3000952888, 1896527301, 2685328360, 2516765748, 2619594691, 2633935773,
-            3683402935, 1928157965, 2150799367, 280418009,  4274085757, 3035998523, 1712068175,
-            3681609475, 3290375768, 2758430989, 1367492323, 1568099780, 309103505,  3145116805,
-            1772339743, 201732189,  3870987217, 1597478804, 1879479930, 3080580849, 3958843866,
-            4226431013, 1301047748, 3564091542, 2711286423, 3951884177, 173801885,  1110908492,
-            1995059635, 3740561553, 2119807963, 3079801213, 1227300463, 2400051312, 4161786276,
-            4022145459, 3610478476, 2540462032, 278991510,  2186529714, 1124916533, 21972574,
-            1457344822, 867875267,  499865978,  2710892042, 990223007,  2770972026, 1442277262,
-            388737760,  3280976948, 220550309,  1273830608, 4227403660, 2280852587, 2147562394,
-            1272009436, 1616999861, 1230907383, 1529127113, 1201117002, 2579667867, 3265758815,
-            2259124846, 2518859817, 2408902469, 1540823742, 4110921053, 1987801760, 864585761,
-            1082516905, 4046078683, 4294656535, 2999836980, 1292038676, 658398103,  3355676157,
-            2409211454, 2617300758, 3802022928, 1946902176, 1768836618, 265612713,  1159904343,
-            2600873851, 1592040025, 1497360900, 1450405044, 3392429775, 1776557575, 110803392,
-            3322891462, 37869319,   3740137454, 2092298456, 531760595,  1421247469, 59254818,
-            687693023,  1209491036, 1999542673, 402515609,  2314238620, 997436178,  1876461642,
-            1628244265, 3351457411, 2807382347, 947095143,  82388325,   1980148008, 1378385928,
-            2706867632, 380752350,  3296762847, 102965047,  33026756,   4144433521, 3980183354,
-            4230894783, 375914533,  2930555451, 1659955020, 1804800948, 2637962044, 1439498490,
-            1972913359, 2001228746, 1155046195, 4182235769, 2367596358, 2781991058, 3019824501,
-            2194587912, 3985621560, 839532285,  999413357,  425350215,  2662520471, 2414866915,
-            3755810452, 807958835,  1884086263, 1562675401, 1029827480, 4244674021, 1600848122,
-            4243305890, 3754531584, 782384322,  3282094672, 1817355446, 310733229,  269234795,
-            3785121678, 3000952888, 1896527301, 2685328360, 2516765748, 2806580407, 2633935773,
-            3683402935, 1928157965, 2150799367, 3045015777, 4274085757, 3035998523, 1712068175,
-            3681609475, 2935145679, 2758430989, 1367492323, 1568099780, 309103505,  1559869922,
-            1772339743, 201732189,  3870987217, 1597478804, 4280902642, 3080580849, 3958843866,
-            4226431013, 1301047748, 3256655547, 2711286423, 3951884177, 173801885,  1110908492,
-            4030252590, 3740561553, 2119807963, 3079801213, 1227300463, 1087035816, 4161786276,
-            4022145459, 3610478476, 2540462032, 102009750,  2186529714, 1124916533, 21972574,
-            1457344822, 2119593743, 499865978,  2710892042, 990223007,  2770972026, 3361142725,
-            388737760,  3280976948, 220550309,  1273830608, 3511331853, 2280852587, 2147562394,
-            1272009436, 1616999861, 3800727705, 1529127113, 1201117002, 2579667867, 3265758815,
-            2483203401, 2518859817, 2408902469, 1540823742, 4110921053, 1926050452, 864585761,
-            1082516905, 4046078683, 4294656535, 1261595488, 1292038676, 658398103,  3355676157,
-            2409211454, 3186404791, 3802022928, 1946902176, 1768836618, 265612713,  1192615713,
-            2600873851, 1592040025, 1497360900, 1450405044, 2329504454, 1776557575, 110803392,
-            3322891462, 37869319,   232504585,  2092298456, 531760595,  1421247469, 59254818,
-            476411234,  1209491036, 1999542673, 402515609,  2314238620, 1259639919, 1876461642,
-            1628244265, 3351457411, 2807382347, 2999240930, 82388325,   1980148008, 1378385928,
-            2706867632, 3786252532, 3296762847, 102965047,  33026756,   4144433521, 454846069,
-            4230894783, 375914533,  2930555451, 1659955020, 827991404,  2637962044, 1439498490,
-            1972913359, 2001228746, 76586678,   4182235769, 2367596358, 2781991058, 3019824501,
-            224635007,  3985621560, 839532285,  999413357,  425350215,  525290141,  2414866915,
-            3755810452, 807958835,  1884086263, 1228501095, 1029827480, 4244674021, 1600848122,
-            4243305890, 507226728,  782384322,  3282094672, 1817355446, 310733229,  397641360,
-            3785121678, 3000952888, 1896527301, 2685328360, 2416433298, 2806580407, 2633935773,
-            3683402935, 1928157965, 2428112709, 3045015777, 4274085757, 3035998523, 1712068175,
-            2687410582, 2935145679, 2758430989, 1367492323, 1568099780, 1478146409, 1559869922,
-            1772339743, 201732189,  3870987217, 103847027,  4280902642, 3080580849, 3958843866,
-            4226431013, 1227725619, 3256655547, 2711286423, 3951884177, 173801885,  1684616039,
-            4030252590, 3740561553, 2119807963, 3079801213, 3638853520, 1087035816, 4161786276,
-            4022145459, 3610478476, 4269968693, 102009750,  2186529714, 1124916533, 21972574,
-            3518787177, 2119593743, 499865978,  2710892042, 990223007,  1777773353, 3361142725,
-            388737760,  3280976948, 220550309,  3263258595, 3686155079, 1128636415, 2594174800,
-            4259054159, 2732599894, 2464703664, 1978242795, 653323904,  1814924322, 1615309833,
-            340780766,  1325443944, 1209834651, 751867918,  4112610529, 728413065,  3164498617,
-            2533342306, 537516521,  3363680425, 520147155,  1507547957, 747808707,  2881636712,
-            3531787903, 3156562578, 344911649,  3542087993, 2660705594, 3758811038, 3446508959,
-            2290669750, 1058741803, 2968839328, 2894525948, 2759610641, 1793340274, 1205610320,
-            2816321260, 2622425882, 198801906,  1383573345, 1330864982, 1025135931, 3544920410,
-            1245051299, 3013232824, 619090441,  3435149353, 1785902368, 3739449938, 3916913860,
-            3603959951, 824558655,  2183384619, 2809953380, 732081634,  638504314,  4151468098,
-            2588790753, 622538315,  43434468,   654292352,  533209590,  2233187739, 2981687111,
-            3763487520, 4292562105, 1834614552, 4286929693, 1481420508, 1588217186, 540473907,
-            607857155,  2543549101, 2285368547, 2074790320, 2203331888, 831309683,  1593524574,
-            3809309808, 575302483,  952133298,  3471233594, 801060009,  2915367128, 165744572,
-            1009650074, 1535697355, 2526269613, 2614816898, 726777771,  1905628415, 1951851924,
-            456921336,  182118186,  1977631686, 386480849,  2108966479, 2962595153, 751361307,
-            679490332,  3451347685, 754566396,  2637465324, 734660231,  3927054514, 1468961122,
-            2754857410, 1148211272, 2380965041, 2814688945, 1520988561, 1826390376, 266165690,
-            1368954926, 2705961799, 116381736,  4023660567, 2347681498, 3855921545, 1474935233,
-            2420380636, 3393428007, 653875449,  1720785538, 560079437,  674307095,  4284165844,
-            1495333820, 2672909025, 61706333,   2189515202, 1416678433, 4268450818, 1579413414,
-            63715938,   3099176668, 3024769992, 908119610,  4005867946, 2920179714, 1442953638,
-            3116148757, 1180227080, 3101317949, 3201224875, 1016929049, 2140259884, 2405186158,
-            1591759879, 548813576,  1031627378, 2632551544, 3290544323, 2916553706, 1703011375,
-            1923763919, 2972054267,
-        },
-        {
-            1438083560, 1727969469, 703174449,  1296281193, 1386452240, 3304170302, 3048300096,
-            277697908,  2675939661, 3382564518, 1639425457, 2210719281, 3173605115, 1685375802,
-            1317820682, 1960916541, 4230888182, 1924357010, 3322827982, 1663716994, 976583570,
-            4146230815, 525755678,  3608894680, 1715438458, 1519478303, 2845291872, 1115405802,
-            2468673244, 2289739992, 46988928,   2559411080, 2466723374, 2995303634, 3871022237,
-            1794652692, 2424766096, 2849910020, 978542234,  1667051478, 3393290740, 1508376445,
-            4090541488, 1314139749, 1271060027, 3272019878, 4032394060, 757805987,  619143288,
-            1165760536, 225099797,  871754591,  2065691940, 2016593817, 1705071529, 2559080067,
-            2048856253, 3217759224, 2691334730, 1576829868, 3356759591, 1570481357, 1097065360,
-            852561431,  3559721965, 1403648739, 1772347635, 1196457607, 462142253,  761176322,
-            2209893444, 217724244,  3356132814, 2838131962, 3571552868, 1197135963, 3239010986,
-            2612283238, 2606429155, 2194090162, 4256137634, 935551404,  3057660021, 866672836,
-            1119670384, 1757615349, 649402076,  2814108193, 3312658713, 2627947214, 2982267121,
-            486762785,  2746076238, 2134737126, 4106010468, 3151832629, 2419694200, 2803791741,
-            2100250718, 3171079849, 1874606681, 1884940331, 926257211,  1940082331, 1024435222,
-            609478334,  2501896844, 518643063,  4285619138, 1054300997, 4024681853, 2287236199,
-            2891891855, 1519666047, 1919500932, 3880316442, 1994336737, 1025147784, 3433493260,
-            1647319600, 3298872174, 3744513628, 2918990402, 2649193481, 234630674,  1963357481,
-            1118148435, 2658522312, 2563194501, 2238556876, 1210050812, 748709882,  3894824022,
-            2575692519, 436044710,  3465014792, 3686094502, 2963529475, 3251316066, 2834750227,
-            789471563,  853201732,  4119014483, 1312738151, 2018934495, 542908921,  732294449,
-            2519981401, 1663929229, 4041419972, 3038382188, 3182489020, 353453260,  4074472601,
-            1187952022, 2118553383, 1068338764, 3699144039, 3129056770, 1419222328, 2666827910,
-            1438083560, 1727969469, 703174449,  1296281193, 2134413940, 3304170302, 3048300096,
-            277697908,  2675939661, 3817858752, 1639425457, 2210719281, 3173605115, 1685375802,
-            2587083472, 1960916541, 4230888182, 1924357010, 3322827982, 2582901426, 976583570,
-            4146230815, 525755678,  3608894680, 524232549,  1519478303, 2845291872, 1115405802,
-            2468673244, 591800699,  46988928,   2559411080, 2466723374, 2995303634, 2307625850,
-            1794652692, 2424766096, 2849910020, 978542234,  1284927074, 3393290740, 1508376445,
-            4090541488, 1314139749, 3508281898, 3272019878, 4032394060, 757805987,  619143288,
-            1846615167, 225099797,  871754591,  2065691940, 2016593817, 1193455869, 2559080067,
-            2048856253, 3217759224, 2691334730, 2665708717, 3356759591, 1570481357, 1097065360,
-            852561431,  1652864273, 1403648739, 1772347635, 1196457607, 462142253,  1222855287,
-            2209893444, 217724244,  3356132814, 2838131962, 3060983219, 1197135963, 3239010986,
-            2612283238, 2606429155, 4171729370, 4256137634, 935551404,  3057660021, 866672836,
-            75618353,   1757615349, 649402076,  2814108193, 3312658713, 3975515213, 2982267121,
-            486762785,  2746076238, 2134737126, 3251020123, 3151832629, 2419694200, 2803791741,
-            2100250718, 624531676,  1874606681, 1884940331, 926257211,  1940082331, 3678479182,
-            609478334,  2501896844, 518643063,  4285619138, 1725899979, 4024681853, 2287236199,
-            2891891855, 1519666047, 702508101,  3880316442, 1994336737, 1025147784, 3433493260,
-            4212959134, 3298872174, 3744513628, 2918990402, 2649193481, 1782150764, 1963357481,
-            1118148435, 2658522312, 2563194501, 3330122355, 1210050812, 748709882,  3894824022,
-            2575692519, 637240921,  3465014792, 3686094502, 2963529475, 3251316066, 1510158901,
-            789471563,  853201732,  4119014483, 1312738151, 3018953017, 542908921,  732294449,
-            2519981401, 1663929229, 2696317636, 3038382188, 3182489020, 353453260,  4074472601,
-            4249950407, 2118553383, 1068338764, 3699144039, 3129056770, 2334590922, 2666827910,
-            1438083560, 1727969469, 703174449,  1679528518, 2134413940, 3304170302, 3048300096,
-            277697908,  3417107827, 3817858752, 1639425457, 2210719281, 3173605115, 1858788112,
-            2587083472, 1960916541, 4230888182, 1924357010, 3692988029, 2582901426, 976583570,
-            4146230815, 525755678,  1122319464, 524232549,  1519478303, 2845291872, 1115405802,
-            205855120,  591800699,  46988928,   2559411080, 2466723374, 3358512221, 2307625850,
-            1794652692, 2424766096, 2849910020, 2865273283, 1284927074, 3393290740, 1508376445,
-            4090541488, 2453941323, 3508281898, 3272019878, 4032394060, 757805987,  3191753865,
-            1846615167, 225099797,  871754591,  2065691940, 1301630578, 1193455869, 2559080067,
-            2048856253, 3217759224, 3858428004, 2665708717, 3356759591, 1570481357, 1097065360,
-            3550687085, 1652864273, 1403648739, 1772347635, 1196457607, 2158802672, 1222855287,
-            2209893444, 217724244,  3356132814, 1954043011, 3060983219, 1197135963, 3239010986,
-            2612283238, 2156334822, 4171729370, 4256137634, 935551404,  3057660021, 3331206175,
-            75618353,   1757615349, 649402076,  2814108193, 1313890357, 3975515213, 2982267121,
-            486762785,  2746076238, 2023213803, 3251020123, 3151832629, 2419694200, 2803791741,
-            392313450,  624531676,  1874606681, 1884940331, 926257211,  3369012310, 3678479182,
-            609478334,  2501896844, 518643063,  3638013610, 1725899979, 4024681853, 2287236199,
-            2891891855, 429282096,  702508101,  3880316442, 1994336737, 1025147784, 1217486411,
-            4212959134, 3298872174, 3744513628, 2918990402, 1279832521, 1782150764, 1963357481,
-            1118148435, 2658522312, 2379123622, 3330122355, 1210050812, 748709882,  3894824022,
-            3987054169, 637240921,  3465014792, 3686094502, 2963529475, 2167876400, 1510158901,
-            789471563,  853201732,  4119014483, 1746447311, 3018953017, 542908921,  732294449,
-            2519981401, 1908715414, 2696317636, 3038382188, 3182489020, 353453260,  2132930364,
-            4249950407, 2118553383, 1068338764, 3699144039, 433893434,  2334590922, 2666827910,
-            1438083560, 1727969469, 1154725669, 1679528518, 2134413940, 3304170302, 3048300096,
-            31944135,   3417107827, 3817858752, 1639425457, 2210719281, 4203237786, 1858788112,
-            2587083472, 1960916541, 4230888182, 2712081548, 3692988029, 2582901426, 976583570,
-            4146230815, 3948659885, 1122319464, 524232549,  1519478303, 2845291872, 2881616509,
-            205855120,  591800699,  46988928,   2559411080, 3645011109, 3358512221, 2307625850,
-            1794652692, 2424766096, 3667888476, 2865273283, 1284927074, 3393290740, 1508376445,
-            1605429636, 2453941323, 3508281898, 3272019878, 4032394060, 3904681057, 3191753865,
-            1846615167, 225099797,  871754591,  696516502,  1301630578, 1193455869, 2559080067,
-            2048856253, 2589248412, 3858428004, 2665708717, 3356759591, 1570481357, 1884333722,
-            3550687085, 1652864273, 1403648739, 1772347635, 3418430008, 2158802672, 1222855287,
-            2209893444, 217724244,  4164333189, 1954043011, 3060983219, 1197135963, 3239010986,
-            2300947859, 2156334822, 4171729370, 4256137634, 935551404,  1258856668, 3331206175,
-            75618353,   1757615349, 649402076,  772455867,  1313890357, 3975515213, 2982267121,
-            486762785,  3671941628, 2023213803, 3251020123, 3151832629, 2419694200, 4264015999,
-            392313450,  624531676,  1874606681, 1884940331, 2460787316, 3369012310, 3678479182,
-            609478334,  2501896844, 2131090271, 3638013610, 1725899979, 4024681853, 2287236199,
-            455349830,  429282096,  702508101,  3880316442, 1994336737, 1727894434, 1217486411,
-            4212959134, 3298872174, 3744513628, 1120563681, 1279832521, 1782150764, 1963357481,
-            1118148435, 3362151087, 2379123622, 3330122355, 1210050812, 748709882,  2506587900,
-            3987054169, 637240921,  3465014792, 3686094502, 1265652315, 2167876400, 1510158901,
-            789471563,  853201732,  3472479264, 1746447311, 3018953017, 542908921,  732294449,
-            659090240,  1908715414, 2696317636, 3038382188, 3182489020, 174113867,  2132930364,
-            4249950407, 2118553383, 1068338764, 4115132848, 1714842877, 1153237667, 1015943026,
-            2014412384, 2478393613, 1340079052, 167685322,  1848482402, 3252973254, 638064461,
-            1599254200, 2525050247, 2813349060, 2415037971, 3274852801, 3415369586, 3216396500,
-            3147792606, 438338168,  2326605175, 2846648724, 3871841623, 287840506,  3218295001,
-            2562000356, 574276928,  418096348,  1798854554, 1913561074, 2025706546, 41907788,
-            3535708035, 1240819558, 208810147,  4062740265, 451865782,  2652508890, 3579720859,
-            1243967909, 2191937647, 2473947838, 1847359263, 2496539569, 4061942257, 1372849161,
-            2016697844, 1827460131, 1135062647, 1255573479, 3506657283, 3699699807, 3087913374,
-            1196140869, 4095306490, 830793530,  1289366065, 3268392251, 4119035690, 1631012325,
-            3410799501, 1470209122, 3057922764, 2895379380, 2654121201, 1984999545, 2258412956,
-            4267137150, 3396740662, 2480013857, 3845856317, 3669454152, 2438423716, 3191341994,
-            1571280634, 1423782557, 3279999352, 1886288620, 205278284,  793062897,  112852083,
-            69164746,   2218046933, 4206182754, 3021072495, 2157753215, 2875773583, 1453706073,
-            168681204,  3905840714, 4098714445, 3410804508, 1737239929, 1613207828, 2987997090,
-            1869303136, 3348561687, 3391148819, 1680062950, 4150476788, 2340622122, 11331065,
-            2250669421, 3003852975, 2145739501, 1627177260, 994260425,  1479134620, 2315299915,
-            1268765340, 285960682,  3801150032, 3948820512, 1677682247, 1735541155, 1914753931,
-            1965156079, 1875233710, 681418791,  2077804400, 1963479724, 2447942398, 269798686,
-            2740088859, 1974178779, 3373487761, 2879779843, 157827737,  3855390825, 2779173093,
-            2359181541, 3508102362, 4001266348, 3949912729, 3232414439, 472195874,  57835121,
-            1854343116, 3020785997, 2024437594, 2182964208, 3379376555, 1213864603, 307833006,
-            1029130725, 545051507,  4001695571, 2258480284, 896286117,  355474524,  2514583184,
-            2997458384, 3278715462, 1675341954, 3603020014, 2318410671, 2152785892, 4285597912,
-            35655711,   2087100216,
-        },
-        {
-            3198598225, 2508598798, 2201564843, 3780498726, 2901148071, 1848187395, 373072947,
-            2110951867, 4229859899, 308393348,  1874119655, 2642071060, 3985012403, 414396116,
-            821381933,  3268808864, 3515076725, 1011804597, 2359929057, 1724115045, 241403154,
-            798796131,  155281910,  2423789371, 826786663,  1943753069, 457652746,  709313685,
-            830108813,  3451990464, 299755829,  2134530058, 3385475525, 1798769234, 3998467303,
-            4069501924, 1156817426, 3068872547, 3991927475, 3081928606, 1573294897, 3961603292,
-            3537267493, 1014102937, 3534460338, 893919735,  3064595785, 2441112165, 143317234,
-            3285630640, 1287556398, 3365649450, 3607541519, 229094668,  1160342870, 551292104,
-            1479566766, 3017949230, 2081761072, 3827087946, 2353088960, 191280423,  401086278,
-            2106491789, 2126312240, 2919750744, 2258434421, 3313206711, 612895413,  2751071634,
-            3796319095, 3826197925, 3500005249, 936413110,  3066664175, 3479254392, 3789247263,
-            2653891245, 1779054078, 3986513279, 939720312,  4076464924, 750578235,  2449705210,
-            1410861998, 1946371610, 741875609,  2534525352, 946479691,  1375176405, 550759299,
-            2417483826, 3741767358, 3494489537, 209898393,  3255383240, 794870092,  3865110199,
-            176245983,  1732080565, 2140923817, 2082284391, 2150295337, 1388636364, 2057424551,
-            1332240282, 3339976059, 1364204331, 722977397,  131052397,  2828727420, 159117439,
-            2659738179, 532099128,  534703388,  2253231857, 3749399140, 3456077924, 794815387,
-            2366164902, 1088569507, 2226954722, 1289378015, 1293209575, 3635589069, 2721723371,
-            367199190,  1087566699, 2644357444, 3276642003, 123956591,  1243948750, 104992341,
-            3659516963, 1678692571, 639613655,  1951714163, 1817853016, 1262979510, 431133187,
-            1022169593, 3876375405, 886052025,  3140674714, 3058343048, 2385400183, 4273445833,
-            2107507021, 4080399965, 3371312341, 1883649869, 1583297969, 559658983,  2900188615,
-            2290447132, 4264200609, 3742743442, 3736564641, 3413931114, 1412049212, 970326758,
-            3198598225, 2508598798, 2201564843, 3780498726, 502348462,  1848187395, 373072947,
-            2110951867, 4229859899, 2990756678, 1874119655, 2642071060, 3985012403, 414396116,
-            3574924453, 3268808864, 3515076725, 1011804597, 2359929057, 2099435386, 241403154,
-            798796131,  155281910,  2423789371, 2268770140, 1943753069, 457652746,  709313685,
-            830108813,  3678200124, 299755829,  2134530058, 3385475525, 1798769234, 2850546339,
-            4069501924, 1156817426, 3068872547, 3991927475, 3551071966, 1573294897, 3961603292,
-            3537267493, 1014102937, 841408743,  893919735,  3064595785, 2441112165, 143317234,
-            2814140525, 1287556398, 3365649450, 3607541519, 229094668,  963498424,  551292104,
-            1479566766, 3017949230, 2081761072, 1593113014, 2353088960, 191280423,  401086278,
-            2106491789, 1360310308, 2919750744, 2258434421, 3313206711, 612895413,  2308289862,
-            3796319095, 3826197925, 3500005249, 936413110,  3609543244, 3479254392, 3789247263,
-            2653891245, 1779054078, 2192728944, 939720312,  4076464924, 750578235,  2449705210,
-            1222508514, 1946371610, 741875609,  2534525352, 946479691,  1606465589, 550759299,
-            2417483826, 3741767358, 3494489537, 1456698055, 3255383240, 794870092,  3865110199,
-            176245983,  53338593,   2140923817, 2082284391, 2150295337, 1388636364, 1867498143,
-            1332240282, 3339976059, 1364204331, 722977397,  2348061157, 2828727420, 159117439,
-            2659738179, 532099128,  1038132124, 2253231857, 3749399140, 3456077924, 794815387,
-            810245485,  1088569507, 2226954722, 1289378015, 1293209575, 2831936420, 2721723371,
-            367199190,  1087566699, 2644357444, 142984351,  123956591,  1243948750, 104992341,
-            3659516963, 2194223977, 639613655,  1951714163, 1817853016, 1262979510, 3138286477,
-            1022169593, 3876375405, 886052025,  3140674714, 3401979658, 2385400183, 4273445833,
-            2107507021, 4080399965, 2261324980, 1883649869, 1583297969, 559658983,  2900188615,
-            3545849576, 4264200609, 3742743442, 3736564641, 3413931114, 4089159459, 970326758,
-            3198598225, 2508598798, 2201564843, 4129903936, 502348462,  1848187395, 373072947,
-            2110951867, 473854555,  2990756678, 1874119655, 2642071060, 3985012403, 626237850,
-            3574924453, 3268808864, 3515076725, 1011804597, 3376971958, 2099435386, 241403154,
-            798796131,  155281910,  3150595743, 2268770140, 1943753069, 457652746,  709313685,
-            3714858446, 3678200124, 299755829,  2134530058, 3385475525, 3658811263, 2850546339,
-            4069501924, 1156817426, 3068872547, 1414889936, 3551071966, 1573294897, 3961603292,
-            3537267493, 2858630299, 841408743,  893919735,  3064595785, 2441112165, 2018675988,
-            2814140525, 1287556398, 3365649450, 3607541519, 2354636253, 963498424,  551292104,
-            1479566766, 3017949230, 263264737,  1593113014, 2353088960, 191280423,  401086278,
-            3177254872, 1360310308, 2919750744, 2258434421, 3313206711, 1214952782, 2308289862,
-            3796319095, 3826197925, 3500005249, 3270583806, 3609543244, 3479254392, 3789247263,
-            2653891245, 633300620,  2192728944, 939720312,  4076464924, 750578235,  2444325844,
-            1222508514, 1946371610, 741875609,  2534525352, 2295644270, 1606465589, 550759299,
-            2417483826, 3741767358, 2904411146, 1456698055, 3255383240, 794870092,  3865110199,
-            2506507708, 53338593,   2140923817, 2082284391, 2150295337, 781917922,  1867498143,
-            1332240282, 3339976059, 1364204331, 745913697,  2348061157, 2828727420, 159117439,
-            2659738179, 284539409,  1038132124, 2253231857, 3749399140, 3456077924, 2632015413,
-            810245485,  1088569507, 2226954722, 1289378015, 2508184260, 2831936420, 2721723371,
-            367199190,  1087566699, 3116006786, 142984351,  123956591,  1243948750, 104992341,
-            1294109922, 2194223977, 639613655,  1951714163, 1817853016, 2555244011, 3138286477,
-            1022169593, 3876375405, 886052025,  1034802261, 3401979658, 2385400183, 4273445833,
-            2107507021, 2685445482, 2261324980, 1883649869, 1583297969, 559658983,  2289465076,
-            3545849576, 4264200609, 3742743442, 3736564641, 933476777,  4089159459, 970326758,
-            3198598225, 2508598798, 108849269,  4129903936, 502348462,  1848187395, 373072947,
-            2976551857, 473854555,  2990756678, 1874119655, 2642071060, 2406687424, 626237850,
-            3574924453, 3268808864, 3515076725, 2438709974, 3376971958, 2099435386, 241403154,
-            798796131,  1707014126, 3150595743, 2268770140, 1943753069, 457652746,  4231818286,
-            3714858446, 3678200124, 299755829,  2134530058, 1991441651, 3658811263, 2850546339,
-            4069501924, 1156817426, 1159260140, 1414889936, 3551071966, 1573294897, 3961603292,
-            4194823663, 2858630299, 841408743,  893919735,  3064595785, 1746624681, 2018675988,
-            2814140525, 1287556398, 3365649450, 748045354,  2354636253, 963498424,  551292104,
-            1479566766, 3028533235, 263264737,  1593113014, 2353088960, 191280423,  511300109,
-            3177254872, 1360310308, 2919750744, 2258434421, 3920841359, 1214952782, 2308289862,
-            3796319095, 3826197925, 3888919911, 3270583806, 3609543244, 3479254392, 3789247263,
-            1083315483, 633300620,  2192728944, 939720312,  4076464924, 3971303603, 2444325844,
-            1222508514, 1946371610, 741875609,  936461189,  2295644270, 1606465589, 550759299,
-            2417483826, 3718043870, 2904411146, 1456698055, 3255383240, 794870092,  277069431,
-            2506507708, 53338593,   2140923817, 2082284391, 2185576576, 781917922,  1867498143,
-            1332240282, 3339976059, 3438986159, 745913697,  2348061157, 2828727420, 159117439,
-            2213185962, 284539409,  1038132124, 2253231857, 3749399140, 2877627382, 2632015413,
-            810245485,  1088569507, 2226954722, 3422512035, 2508184260, 2831936420, 2721723371,
-            367199190,  1209440907, 3116006786, 142984351,  123956591,  1243948750, 978649076,
-            1294109922, 2194223977, 639613655,  1951714163, 2124827237, 2555244011, 3138286477,
-            1022169593, 3876375405, 754133007,  1034802261, 3401979658, 2385400183, 4273445833,
-            2715525373, 2685445482, 2261324980, 1883649869, 1583297969, 2357870785, 2289465076,
-            3545849576, 4264200609, 3742743442, 872657852,  2069538760, 577962021,  2915861715,
-            3901759257, 2709888434, 4167274851, 3274102019, 18908532,   967651585,  3082369409,
-            2242969816, 1060659000, 323039472,  2469542208, 3209025947, 3943579840, 3336479946,
-            2404940410, 3779388807, 2029694429, 2861709518, 3060368912, 4227475355, 1468153451,
-            1603986596, 3446411552, 3757533913, 1453633142, 381860673,  2204281576, 2797022651,
-            2654616718, 4022846039, 10535479,   3677928347, 142820752,  2626935317, 2898956125,
-            1953527810, 1127438277, 3585293928, 816936689,  2719718626, 4243801133, 4148691562,
-            2840673638, 241789939,  868041818,  2951243917, 3655986045, 3856739579, 2864783333,
-            4273662293, 2448980876, 2768831224, 1308989690, 2579412971, 708140219,  904895925,
-            3549990465, 2975320393, 1090774221, 53365758,   3608510544, 2753483491, 224094734,
-            267571022,  2837253408, 394431113,  1410574127, 930266634,  4089943773, 603725815,
-            3886593548, 3348815400, 1541655244, 2330344168, 1057410502, 2450815028, 3595368699,
-            4293211237, 484005509,  1484423790, 1404913236, 3074190048, 3217599128, 4160451146,
-            278420465,  1772092168, 2329039786, 2363465113, 1504590956, 638816908,  1572705865,
-            2075468163, 334812634,  1657124194, 1651736714, 3659033273, 1765529989, 3330475116,
-            3323049883, 868563522,  3981296915, 3829500107, 3649219334, 2948519513, 218425059,
-            449986545,  836537782,  1571119515, 545068757,  1534979910, 3009793378, 3051170951,
-            3693915314, 1449477935, 2053299963, 554619129,  3208340382, 2515859019, 4143541304,
-            2702383352, 1029571195, 3213255501, 1487365053, 3455447589, 1488881288, 230833504,
-            2692951938, 1370343983, 4042549366, 1082316376, 2044450098, 3927640479, 2596032908,
-            300366408,  3709966579, 1718152478, 2169146915, 4293706822, 1738615213, 3702479392,
-            3762441177, 752771923,  2968412,    1031839497, 4148594691, 2036914548, 3107487526,
-            417587163,  3102964401, 1044016645, 1316772168, 1257482215, 3329877798, 1309643218,
-            2639712058, 1669088923,
-        },
-        {
-            1671155,    472949658,  148656515,  1640075411, 930771231,  1601854390, 471598090,
-            2013359012, 3708325970, 1688441844, 736452516,  100585026,  1154373750, 4029833741,
-            3409420465, 192349301,  3804215437, 909027311,  2896874106, 3567276364, 1319305666,
-            3858990362, 3155018279, 3756192170, 3567813642, 228734829,  577956164,  2078807284,
-            1005987081, 1464380935, 112604551,  3865074232, 3776350052, 1112767766, 2947509331,
-            910887552,  4127297396, 851240323,  3136588838, 1639013085, 1154068086, 639126620,
-            2501600773, 3174842042, 3456593672, 80596481,   126970446,  2184239961, 1448001095,
-            689252599,  1087028487, 2905348107, 2502009404, 2156595397, 2149975474, 2201723284,
-            3908202640, 754508313,  2321393187, 787043244,  2575809693, 4172462501, 2322897687,
-            1899992264, 1854136781, 3575249683, 2939319477, 901605762,  676398674,  2849283587,
-            2992300101, 1513271778, 2797164148, 1914019034, 1889341710, 2739211008, 1954453463,
-            3279391005, 2899313529, 1412533980, 1291505093, 2884603001, 564097935,  3552741248,
-            2809901827, 1263126330, 860214490,  2168366043, 2681035029, 3226888214, 2902522885,
-            554804421,  1571065517, 3322453053, 4144256215, 126415290,  980853251,  1531963815,
-            3237470129, 1465444883, 2031491001, 2205009469, 1046577915, 828927962,  2170245718,
-            1090142292, 1667375106, 2522840205, 4047872402, 3862734726, 91588630,   3122782857,
-            929883614,  694999008,  1472139068, 1246663706, 3500613893, 4200173807, 186199942,
-            3890621040, 229752655,  1011692880, 2791828564, 2677625011, 791005643,  1754509337,
-            2321492983, 3512328605, 1294405891, 2845189858, 434175992,  3155484007, 2306406482,
-            3197931140, 22971924,   1521633702, 2366802562, 399245037,  2833224222, 2507478835,
-            3231711673, 3784114896, 1927919696, 783802899,  3408133710, 2278711709, 3001078924,
-            1223320630, 3246830042, 943189685,  4062534962, 1039971013, 2342241593, 3551623946,
-            322017346,  3585779636, 81127429,   3549929990, 2886997195, 1746081951, 4169018554,
-            1671155,    472949658,  148656515,  1640075411, 3772042754, 1601854390, 471598090,
-            2013359012, 3708325970, 321630853,  736452516,  100585026,  1154373750, 4029833741,
-            1926754199, 192349301,  3804215437, 909027311,  2896874106, 1138131968, 1319305666,
-            3858990362, 3155018279, 3756192170, 2489094664, 228734829,  577956164,  2078807284,
-            1005987081, 2678967510, 112604551,  3865074232, 3776350052, 1112767766, 626049886,
-            910887552,  4127297396, 851240323,  3136588838, 2142891352, 1154068086, 639126620,
-            2501600773, 3174842042, 3342870442, 80596481,   126970446,  2184239961, 1448001095,
-            3399719246, 1087028487, 2905348107, 2502009404, 2156595397, 14860817,   2201723284,
-            3908202640, 754508313,  2321393187, 90540547,   2575809693, 4172462501, 2322897687,
-            1899992264, 56239065,   3575249683, 2939319477, 901605762,  676398674,  412461711,
-            2992300101, 1513271778, 2797164148, 1914019034, 3660190396, 2739211008, 1954453463,
-            3279391005, 2899313529, 4193503742, 1291505093, 2884603001, 564097935,  3552741248,
-            2124229268, 1263126330, 860214490,  2168366043, 2681035029, 4086980935, 2902522885,
-            554804421,  1571065517, 3322453053, 1821678887, 126415290,  980853251,  1531963815,
-            3237470129, 2099629264, 2031491001, 2205009469, 1046577915, 828927962,  3447807375,
-            1090142292, 1667375106, 2522840205, 4047872402, 2255362927, 91588630,   3122782857,
-            929883614,  694999008,  4135967848, 1246663706, 3500613893, 4200173807, 186199942,
-            4182379872, 229752655,  1011692880, 2791828564, 2677625011, 397062412,  1754509337,
-            2321492983, 3512328605, 1294405891, 1028843071, 434175992,  3155484007, 2306406482,
-            3197931140, 3217107401, 1521633702, 2366802562, 399245037,  2833224222, 76017436,
-            3231711673, 3784114896, 1927919696, 783802899,  2157090897, 2278711709, 3001078924,
-            1223320630, 3246830042, 1197195551, 4062534962, 1039971013, 2342241593, 3551623946,
-            63853850,   3585779636, 81127429,   3549929990, 2886997195, 1335910186, 4169018554,
-            1671155,    472949658,  148656515,  3600963048, 3772042754, 1601854390, 471598090,
-            2013359012, 1181513377, 321630853,  736452516,  100585026,  1154373750, 2323956092,
-            1926754199, 192349301,  3804215437, 909027311,  2993842723, 1138131968, 1319305666,
-            3858990362, 3155018279, 2288945270, 2489094664, 228734829,  577956164,  2078807284,
-            1924581773, 2678967510, 112604551,  3865074232, 3776350052, 2127459222, 626049886,
-            910887552,  4127297396, 851240323,  547797457,  2142891352, 1154068086, 639126620,
-            2501600773, 2391654498, 3342870442, 80596481,   126970446,  2184239961, 824575673,
-            3399719246, 1087028487, 2905348107, 2502009404, 740197255,  14860817,   2201723284,
-            3908202640, 754508313,  4133980283, 90540547,   2575809693, 4172462501, 2322897687,
-            831222037,  56239065,   3575249683, 2939319477, 901605762,  1998632674, 412461711,
-            2992300101, 1513271778, 2797164148, 969149327,  3660190396, 2739211008, 1954453463,
-            3279391005, 1267183547, 4193503742, 1291505093, 2884603001, 564097935,  3378471970,
-            2124229268, 1263126330, 860214490,  2168366043, 867190357,  4086980935, 2902522885,
-            554804421,  1571065517, 497580674,  1821678887, 126415290,  980853251,  1531963815,
-            2259090956, 2099629264, 2031491001, 2205009469, 1046577915, 30458798,   3447807375,
-            1090142292, 1667375106, 2522840205, 748518306,  2255362927, 91588630,   3122782857,
-            929883614,  1016302700, 4135967848, 1246663706, 3500613893, 4200173807, 4149573092,
-            4182379872, 229752655,  1011692880, 2791828564, 2890696349, 397062412,  1754509337,
-            2321492983, 3512328605, 3005148093, 1028843071, 434175992,  3155484007, 2306406482,
-            1417194283, 3217107401, 1521633702, 2366802562, 399245037,  665389310,  76017436,
-            3231711673, 3784114896, 1927919696, 37004463,   2157090897, 2278711709, 3001078924,
-            1223320630, 1281902891, 1197195551, 4062534962, 1039971013, 2342241593, 836721481,
-            63853850,   3585779636, 81127429,   3549929990, 2541553478, 1335910186, 4169018554,
-            1671155,    472949658,  2086411677, 3600963048, 3772042754, 1601854390, 471598090,
-            3297781744, 1181513377, 321630853,  736452516,  100585026,  2296508711, 2323956092,
-            1926754199, 192349301,  3804215437, 314399580,  2993842723, 1138131968, 1319305666,
-            3858990362, 584746730,  2288945270, 2489094664, 228734829,  577956164,  3868048239,
-            1924581773, 2678967510, 112604551,  3865074232, 2091950990, 2127459222, 626049886,
-            910887552,  4127297396, 2494071916, 547797457,  2142891352, 1154068086, 639126620,
-            1159991153, 2391654498, 3342870442, 80596481,   126970446,  2276453681, 824575673,
-            3399719246, 1087028487, 2905348107, 874278393,  740197255,  14860817,   2201723284,
-            3908202640, 1189317351, 4133980283, 90540547,   2575809693, 4172462501, 746169572,
-            831222037,  56239065,   3575249683, 2939319477, 4148988439, 1998632674, 412461711,
-            2992300101, 1513271778, 1078781767, 969149327,  3660190396, 2739211008, 1954453463,
-            369522045,  1267183547, 4193503742, 1291505093, 2884603001, 2820350438, 3378471970,
-            2124229268, 1263126330, 860214490,  793306335,  867190357,  4086980935, 2902522885,
-            554804421,  1472297125, 497580674,  1821678887, 126415290,  980853251,  1628231485,
-            2259090956, 2099629264, 2031491001, 2205009469, 2562996945, 30458798,   3447807375,
-            1090142292, 1667375106, 3513508401, 748518306,  2255362927, 91588630,   3122782857,
-            435869165,  1016302700, 4135967848, 1246663706, 3500613893, 4156110437, 4149573092,
-            4182379872, 229752655,  1011692880, 1150278253, 2890696349, 397062412,  1754509337,
-            2321492983, 1126835971, 3005148093, 1028843071, 434175992,  3155484007, 4169948411,
-            1417194283, 3217107401, 1521633702, 2366802562, 1629830655, 665389310,  76017436,
-            3231711673, 3784114896, 2523153991, 37004463,   2157090897, 2278711709, 3001078924,
-            3770048208, 1281902891, 1197195551, 4062534962, 1039971013, 2710590100, 836721481,
-            63853850,   3585779636, 81127429,   3850118466, 1883009417, 1027645619, 2766570701,
-            529436174,  4182542040, 2027954186, 1551970336, 2476537298, 1601343216, 3847258834,
-            14764974,   2173280370, 4148127270, 2818930089, 4238274314, 1291010651, 276452076,
-            192067464,  4086351393, 37573517,   48008720,   1641547972, 3144774960, 2159884108,
-            4260412239, 4072883650, 801704944,  2475958420, 2719220408, 555871884,  3338968445,
-            1704817873, 1960791083, 3785650808, 948722806,  3591229899, 1776225011, 4086658524,
-            2675451845, 308053697,  3514232055, 2575301108, 1970226110, 3926325352, 770275431,
-            1432667716, 671201644,  1008866625, 1151827040, 11061406,   3492749345, 2398090284,
-            2479688660, 2275263177, 2452696627, 3239880878, 3206200433, 1520851097, 1517432473,
-            1468198490, 1756343506, 2477348626, 3684701600, 3173720911, 1034531154, 4092116810,
-            3546516359, 2085136160, 643024588,  1462240654, 1877398196, 3615581878, 1419408410,
-            3581360976, 1731324772, 1377343320, 3848152825, 2213533588, 2484549569, 2043594863,
-            224490427,  1298974897, 4279011954, 3970331393, 3795364604, 285230552,  2893090686,
-            2399312639, 2638905215, 3481427245, 3477537504, 2609821731, 867675919,  3395750357,
-            1969593211, 2390932014, 3164333009, 3032345429, 3054196992, 1655295657, 193598641,
-            1267960637, 1599091894, 3377410805, 1529073346, 1949183620, 1575927573, 1493246650,
-            2285478895, 797817618,  1736047766, 1537439339, 1422940895, 2210817855, 2888194544,
-            800138109,  1689425315, 87966703,   3800446188, 137301285,  3334431104, 1776710491,
-            4010349050, 2577018472, 3083459223, 672158271,  3379478560, 2445459713, 918903140,
-            2577376693, 273150303,  2300393435, 3529750006, 3941920515, 2590879584, 2005940914,
-            2533952036, 2918638361, 1907638097, 959011520,  1477207871, 2141548481, 2065858781,
-            3145892196, 3679867589, 1295127682, 1325838381, 3482593404, 1212565985, 3404887017,
-            709111097,  1714185234, 561489165,  3545430079, 359778601,  3034684349, 2235482356,
-            2263913966, 1397371482,
-        },
-        {
-            3677143873, 183365950,  3192792892, 3246214046, 2240593762, 4005402320, 1776847338,
-            1336892909, 4005674910, 1304639337, 2342936737, 1561885545, 938329160,  3065069846,
-            2524850212, 1155818892, 1236888681, 3638556015, 3751756155, 1734911522, 2234326620,
-            2638364163, 1866318362, 984905706,  1216356420, 3791439828, 120978451,  1255750776,
-            1576485819, 3971220486, 64614952,   1736040505, 1031347328, 786858200,  1726077799,
-            3346784528, 1077922858, 2882327826, 3615157227, 742353584,  3145484067, 1204380303,
-            3038675676, 82927246,   3476763320, 2683472151, 2417198498, 3854429458, 1114622590,
-            2183664687, 2742887760, 102909368,  425331456,  3954041166, 3407802150, 1074063568,
-            3460380222, 2333651859, 1660128607, 1178276659, 1024398452, 796900705,  3144141929,
-            840913032,  2910457265, 2622485118, 2544717198, 3553217642, 697519457,  2853909874,
-            3637975673, 3369217605, 652726881,  2909554646, 3942598104, 2470518137, 387200113,
-            2897182306, 2001132540, 3527087359, 3535231508, 4068610779, 3737432062, 1165016283,
-            3276571425, 3479411518, 717940632,  111867960,  1589389683, 1438929056, 3307913242,
-            1639722607, 2383160137, 138487637,  1980094883, 3457971644, 479925905,  665847023,
-            3296240819, 4268494579, 919804652,  4240156093, 3895469268, 2697212512, 1218797961,
-            304981820,  2490949514, 2152575652, 1663612,    305631322,  4176391929, 1152444911,
-            4065144491, 267226957,  1780448920, 4099909891, 3468443032, 761542503,  2446650064,
-            317415985,  2649602709, 1966613357, 4158037582, 49663440,   3895882783, 1259883545,
-            3213259111, 2227969871, 3539950494, 178139168,  1196183739, 2518366977, 3098780015,
-            3908197172, 3267845219, 2880071055, 3351798551, 3417543878, 3687849256, 4129291398,
-            905281459,  15838966,   547977987,  4258209062, 2526596310, 1097430938, 125408848,
-            1324019311, 304759642,  644344853,  497634399,  852822814,  3518267062, 671683255,
-            3989293111, 2584536798, 2551922723, 2854082743, 3302166645, 1882573770, 1051785839,
-            3677143873, 183365950,  3192792892, 3246214046, 926512113,  4005402320, 1776847338,
-            1336892909, 4005674910, 4170335832, 2342936737, 1561885545, 938329160,  3065069846,
-            4281476652, 1155818892, 1236888681, 3638556015, 3751756155, 1595154231, 2234326620,
-            2638364163, 1866318362, 984905706,  779187811,  3791439828, 120978451,  1255750776,
-            1576485819, 2105262779, 64614952,   1736040505, 1031347328, 786858200,  2947813662,
-            3346784528, 1077922858, 2882327826, 3615157227, 1695066562, 3145484067, 1204380303,
-            3038675676, 82927246,   1309820633, 2683472151, 2417198498, 3854429458, 1114622590,
-            1836739893, 2742887760, 102909368,  425331456,  3954041166, 3418344336, 1074063568,
-            3460380222, 2333651859, 1660128607, 3143214572, 1024398452, 796900705,  3144141929,
-            840913032,  3347702443, 2622485118, 2544717198, 3553217642, 697519457,  1784405431,
-            3637975673, 3369217605, 652726881,  2909554646, 1499053995, 2470518137, 387200113,
-            2897182306, 2001132540, 2509171463, 3535231508, 4068610779, 3737432062, 1165016283,
-            2155119745, 3479411518, 717940632,  111867960,  1589389683, 1203948418, 3307913242,
-            1639722607, 2383160137, 138487637,  596759999,  3457971644, 479925905,  665847023,
-            3296240819, 1340594732, 919804652,  4240156093, 3895469268, 2697212512, 3240122920,
-            304981820,  2490949514, 2152575652, 1663612,    1837628419, 4176391929, 1152444911,
-            4065144491, 267226957,  1849743078, 4099909891, 3468443032, 761542503,  2446650064,
-            2584274180, 2649602709, 1966613357, 4158037582, 49663440,   2395171592, 1259883545,
-            3213259111, 2227969871, 3539950494, 2965401614, 1196183739, 2518366977, 3098780015,
-            3908197172, 2788682722, 2880071055, 3351798551, 3417543878, 3687849256, 1898447167,
-            905281459,  15838966,   547977987,  4258209062, 3269501393, 1097430938, 125408848,
-            1324019311, 304759642,  821523391,  497634399,  852822814,  3518267062, 671683255,
-            1190201809, 2584536798, 2551922723, 2854082743, 3302166645, 2701920487, 1051785839,
-            3677143873, 183365950,  3192792892, 950093099,  926512113,  4005402320, 1776847338,
-            1336892909, 1147548578, 4170335832, 2342936737, 1561885545, 938329160,  1643046832,
-            4281476652, 1155818892, 1236888681, 3638556015, 2980442175, 1595154231, 2234326620,
-            2638364163, 1866318362, 1958351617, 779187811,  3791439828, 120978451,  1255750776,
-            1449301599, 2105262779, 64614952,   1736040505, 1031347328, 2579030585, 2947813662,
-            3346784528, 1077922858, 2882327826, 1288628749, 1695066562, 3145484067, 1204380303,
-            3038675676, 2308738640, 1309820633, 2683472151, 2417198498, 3854429458, 686910818,
-            1836739893, 2742887760, 102909368,  425331456,  968044816,  3418344336, 1074063568,
-            3460380222, 2333651859, 3717894796, 3143214572, 1024398452, 796900705,  3144141929,
-            2607087073, 3347702443, 2622485118, 2544717198, 3553217642, 2210211662, 1784405431,
-            3637975673, 3369217605, 652726881,  3234135773, 1499053995, 2470518137, 387200113,
-            2897182306, 608470275,  2509171463, 3535231508, 4068610779, 3737432062, 347695969,
-            2155119745, 3479411518, 717940632,  111867960,  677540688,  1203948418, 3307913242,
-            1639722607, 2383160137, 1822406533, 596759999,  3457971644, 479925905,  665847023,
-            2666018959, 1340594732, 919804652,  4240156093, 3895469268, 1698133152, 3240122920,
-            304981820,  2490949514, 2152575652, 2480419901, 1837628419, 4176391929, 1152444911,
-            4065144491, 756316315,  1849743078, 4099909891, 3468443032, 761542503,  2901963127,
-            2584274180, 2649602709, 1966613357, 4158037582, 3351123276, 2395171592, 1259883545,
-            3213259111, 2227969871, 1586214430, 2965401614, 1196183739, 2518366977, 3098780015,
-            3023591112, 2788682722, 2880071055, 3351798551, 3417543878, 2540938435, 1898447167,
-            905281459,  15838966,   547977987,  3192403030, 3269501393, 1097430938, 125408848,
-            1324019311, 2178810444, 821523391,  497634399,  852822814,  3518267062, 1364786904,
-            1190201809, 2584536798, 2551922723, 2854082743, 185620199,  2701920487, 1051785839,
-            3677143873, 183365950,  1963209905, 950093099,  926512113,  4005402320, 1776847338,
-            1948776742, 1147548578, 4170335832, 2342936737, 1561885545, 130008168,  1643046832,
-            4281476652, 1155818892, 1236888681, 3620035795, 2980442175, 1595154231, 2234326620,
-            2638364163, 300678923,  1958351617, 779187811,  3791439828, 120978451,  476979833,
-            1449301599, 2105262779, 64614952,   1736040505, 2254583968, 2579030585, 2947813662,
-            3346784528, 1077922858, 2924858068, 1288628749, 1695066562, 3145484067, 1204380303,
-            3924921663, 2308738640, 1309820633, 2683472151, 2417198498, 600136309,  686910818,
-            1836739893, 2742887760, 102909368,  3016457571, 968044816,  3418344336, 1074063568,
-            3460380222, 733092853,  3717894796, 3143214572, 1024398452, 796900705,  3710279472,
-            2607087073, 3347702443, 2622485118, 2544717198, 737239002,  2210211662, 1784405431,
-            3637975673, 3369217605, 1391249748, 3234135773, 1499053995, 2470518137, 387200113,
-            52139324,   608470275,  2509171463, 3535231508, 4068610779, 2868583210, 347695969,
-            2155119745, 3479411518, 717940632,  1125418856, 677540688,  1203948418, 3307913242,
-            1639722607, 1106570679, 1822406533, 596759999,  3457971644, 479925905,  1569480211,
-            2666018959, 1340594732, 919804652,  4240156093, 1054840520, 1698133152, 3240122920,
-            304981820,  2490949514, 2299803941, 2480419901, 1837628419, 4176391929, 1152444911,
-            3399552443, 756316315,  1849743078, 4099909891, 3468443032, 1501219774, 2901963127,
-            2584274180, 2649602709, 1966613357, 2563828981, 3351123276, 2395171592, 1259883545,
-            3213259111, 926470792,  1586214430, 2965401614, 1196183739, 2518366977, 3941557427,
-            3023591112, 2788682722, 2880071055, 3351798551, 3513249084, 2540938435, 1898447167,
-            905281459,  15838966,   3713180654, 3192403030, 3269501393, 1097430938, 125408848,
-            2638256799, 2178810444, 821523391,  497634399,  852822814,  1913954789, 1364786904,
-            1190201809, 2584536798, 2551922723, 678735107,  531710439,  1312700864, 1470036482,
-            708463943,  580475965,  2717869787, 2403562078, 3524412768, 3243577526, 1265751511,
-            3998235446, 1635962304, 2681303561, 798115043,  478437248,  1744033858, 374261576,
-            2351162703, 3467754221, 1020639747, 4035145920, 655374765,  2793960452, 3488853899,
-            4133621335, 371020206,  1785218255, 4261069574, 49848284,   3506837447, 3417621844,
-            113375633,  1004885579, 1321915583, 2093499306, 273938618,  1700725803, 108411438,
-            2387417625, 462657040,  1714862418, 3733738142, 3965109715, 911850294,  4053049586,
-            147785312,  3118723498, 520002318,  1957926805, 115142890,  2602019482, 1079995745,
-            1995862236, 2753306003, 3942220720, 3971227304, 3432853275, 1329643815, 14719098,
-            3555779990, 4101243329, 1473396367, 1634941382, 97207635,   279587757,  951089562,
-            3910085757, 4122969484, 2369283488, 3188588549, 4089031321, 1540583560, 1905739807,
-            1314900472, 3045515387, 429523107,  1214391724, 262451597,  2961216634, 204930978,
-            2117905858, 2381882021, 1505192161, 1524534596, 4114353415, 1255909382, 3677965146,
-            3838317138, 2041246788, 1715926342, 735575391,  1075832096, 3877608350, 2679648713,
-            4277152140, 2436684754, 513747850,  744831118,  3056900990, 1896990556, 3615525476,
-            1103176003, 3521036209, 1311180357, 354205227,  2237368381, 3213221257, 1375829288,
-            3908088082, 243634033,  1135242031, 3770856764, 3180161613, 440855238,  775430121,
-            3812378589, 292275899,  1414387276, 1007076672, 4212986667, 145331112,  3757589726,
-            2838143768, 2838829680, 2929238238, 1609113876, 749009545,  2833017606, 731872329,
-            3292257659, 816900654,  818422642,  1596272242, 4155732088, 128275855,  3745774077,
-            728155665,  2618604047, 1611284909, 2865646397, 2074715649, 3973710530, 2649883645,
-            2819062862, 1772186943, 3035877073, 180091527,  3361430358, 2301766860, 3283346909,
-            1593016130, 3744300302, 4024045233, 4067640046, 839502017,  1075669284, 289773564,
-            1471454765, 3451418867,
-        },
-        {
-            170295791,  2753410803, 2200994594, 14686027,   3460333923, 1523230564, 393272614,
-            1632665034, 2139771608, 2436912103, 375335282,  667585308,  3651645415, 1403132103,
-            4146144245, 786890392,  1349234364, 1278024517, 84921263,   3758850381, 4213552796,
-            2355655048, 1636349912, 172797504,  2490691729, 1233059003, 2593048824, 942056581,
-            953415060,  4250104075, 787552244,  1995239637, 2482815609, 767530774,  773778243,
-            841396894,  2718419035, 3363828032, 737774143,  4128182656, 2335090807, 1421795969,
-            2322011430, 2808330380, 2207840656, 1646731611, 492284258,  2339383764, 3439685708,
-            2316859204, 4055048437, 1700143892, 2980557654, 1353917552, 548777318,  1077538998,
-            2650679367, 2853583947, 2721899692, 4253535213, 3375043688, 3489699354, 2401362855,
-            3391605246, 914273272,  3060460082, 1409014396, 3313834796, 461914731,  82334736,
-            3200344474, 2743316601, 842885927,  613943741,  96056919,   3116963503, 305659983,
-            132158360,  239064402,  849530381,  543215927,  4250983939, 2719881954, 1950301886,
-            2760008207, 853237881,  3875675156, 1753566841, 1446648300, 1663885236, 2155720472,
-            1902508987, 4246118829, 383661834,  2420221467, 156828838,  2919782856, 499968148,
-            2538550321, 65231340,   1589837081, 3654438263, 467304037,  1000159563, 622643461,
-            1410713407, 491953742,  1003597552, 1972701846, 1534343952, 1934888620, 4214562113,
-            4154375443, 3612899079, 2132948514, 2599819225, 2676649952, 3147375990, 533258319,
-            3323553423, 4203909276, 668602384,  3979162921, 2360530772, 162121513,  8968884,
-            3647746035, 2830313226, 1736955603, 78142012,   1643270604, 1571637938, 4065571991,
-            2071640825, 2715113082, 3826814783, 1067370024, 1810581550, 2354204343, 3798962263,
-            1664654967, 3740539785, 3746164996, 4280983219, 3313400832, 3305556349, 4226011346,
-            839676594,  1785445494, 1248107478, 904240268,  3484988721, 2290931247, 2109493967,
-            3895901626, 1494555863, 3251796061, 40877237,   2914051470, 2810210896, 1428826975,
-            170295791,  2753410803, 2200994594, 14686027,   3263438011, 1523230564, 393272614,
-            1632665034, 2139771608, 1847095655, 375335282,  667585308,  3651645415, 1403132103,
-            1888152231, 786890392,  1349234364, 1278024517, 84921263,   317409190,  4213552796,
-            2355655048, 1636349912, 172797504,  891435579,  1233059003, 2593048824, 942056581,
-            953415060,  1606837225, 787552244,  1995239637, 2482815609, 767530774,  723338833,
-            841396894,  2718419035, 3363828032, 737774143,  1043554448, 2335090807, 1421795969,
-            2322011430, 2808330380, 2754923978, 1646731611, 492284258,  2339383764, 3439685708,
-            3985616488, 4055048437, 1700143892, 2980557654, 1353917552, 588678041,  1077538998,
-            2650679367, 2853583947, 2721899692, 992549416,  3375043688, 3489699354, 2401362855,
-            3391605246, 2111206241, 3060460082, 1409014396, 3313834796, 461914731,  749987143,
-            3200344474, 2743316601, 842885927,  613943741,  1572013294, 3116963503, 305659983,
-            132158360,  239064402,  2802105766, 543215927,  4250983939, 2719881954, 1950301886,
-            1025784309, 853237881,  3875675156, 1753566841, 1446648300, 2265992307, 2155720472,
-            1902508987, 4246118829, 383661834,  1291267638, 156828838,  2919782856, 499968148,
-            2538550321, 2108151330, 1589837081, 3654438263, 467304037,  1000159563, 611554173,
-            1410713407, 491953742,  1003597552, 1972701846, 1548061756, 1934888620, 4214562113,
-            4154375443, 3612899079, 3599839935, 2599819225, 2676649952, 3147375990, 533258319,
-            4213499273, 4203909276, 668602384,  3979162921, 2360530772, 197252548,  8968884,
-            3647746035, 2830313226, 1736955603, 791687787,  1643270604, 1571637938, 4065571991,
-            2071640825, 2026290282, 3826814783, 1067370024, 1810581550, 2354204343, 2679791787,
-            1664654967, 3740539785, 3746164996, 4280983219, 1690075221, 3305556349, 4226011346,
-            839676594,  1785445494, 935893161,  904240268,  3484988721, 2290931247, 2109493967,
-            1497667362, 1494555863, 3251796061, 40877237,   2914051470, 1936503212, 1428826975,
-            170295791,  2753410803, 2200994594, 3416506072, 3263438011, 1523230564, 393272614,
-            1632665034, 3223475136, 1847095655, 375335282,  667585308,  3651645415, 1628711405,
-            1888152231, 786890392,  1349234364, 1278024517, 3955811679, 317409190,  4213552796,
-            2355655048, 1636349912, 2875036620, 891435579,  1233059003, 2593048824, 942056581,
-            2852399035, 1606837225, 787552244,  1995239637, 2482815609, 3849697041, 723338833,
-            841396894,  2718419035, 3363828032, 2914796626, 1043554448, 2335090807, 1421795969,
-            2322011430, 1088985845, 2754923978, 1646731611, 492284258,  2339383764, 2345741058,
-            3985616488, 4055048437, 1700143892, 2980557654, 3047950756, 588678041,  1077538998,
-            2650679367, 2853583947, 1902113580, 992549416,  3375043688, 3489699354, 2401362855,
-            2822431025, 2111206241, 3060460082, 1409014396, 3313834796, 3661696135, 749987143,
-            3200344474, 2743316601, 842885927,  3902266797, 1572013294, 3116963503, 305659983,
-            132158360,  2399116869, 2802105766, 543215927,  4250983939, 2719881954, 1909593430,
-            1025784309, 853237881,  3875675156, 1753566841, 315928539,  2265992307, 2155720472,
-            1902508987, 4246118829, 4054781820, 1291267638, 156828838,  2919782856, 499968148,
-            2746436642, 2108151330, 1589837081, 3654438263, 467304037,  2376244866, 611554173,
-            1410713407, 491953742,  1003597552, 961109680,  1548061756, 1934888620, 4214562113,
-            4154375443, 3318608531, 3599839935, 2599819225, 2676649952, 3147375990, 3197943734,
-            4213499273, 4203909276, 668602384,  3979162921, 4241359084, 197252548,  8968884,
-            3647746035, 2830313226, 2057817762, 791687787,  1643270604, 1571637938, 4065571991,
-            961587641,  2026290282, 3826814783, 1067370024, 1810581550, 1525669339, 2679791787,
-            1664654967, 3740539785, 3746164996, 3971185743, 1690075221, 3305556349, 4226011346,
-            839676594,  4017546432, 935893161,  904240268,  3484988721, 2290931247, 2887434676,
-            1497667362, 1494555863, 3251796061, 40877237,   675451622,  1936503212, 1428826975,
-            170295791,  2753410803, 13691728,   3416506072, 3263438011, 1523230564, 393272614,
-            2875584734, 3223475136, 1847095655, 375335282,  667585308,  192306502,  1628711405,
-            1888152231, 786890392,  1349234364, 511851370,  3955811679, 317409190,  4213552796,
-            2355655048, 131052067,  2875036620, 891435579,  1233059003, 2593048824, 2915307792,
-            2852399035, 1606837225, 787552244,  1995239637, 886016481,  3849697041, 723338833,
-            841396894,  2718419035, 1765948302, 2914796626, 1043554448, 2335090807, 1421795969,
-            4270899906, 1088985845, 2754923978, 1646731611, 492284258,  1723935335, 2345741058,
-            3985616488, 4055048437, 1700143892, 2254566160, 3047950756, 588678041,  1077538998,
-            2650679367, 1004539894, 1902113580, 992549416,  3375043688, 3489699354, 2030140735,
-            2822431025, 2111206241, 3060460082, 1409014396, 3053214877, 3661696135, 749987143,
-            3200344474, 2743316601, 398855857,  3902266797, 1572013294, 3116963503, 305659983,
-            1626072332, 2399116869, 2802105766, 543215927,  4250983939, 1149058742, 1909593430,
-            1025784309, 853237881,  3875675156, 2709854504, 315928539,  2265992307, 2155720472,
-            1902508987, 4065691077, 4054781820, 1291267638, 156828838,  2919782856, 1004764391,
-            2746436642, 2108151330, 1589837081, 3654438263, 2380382984, 2376244866, 611554173,
-            1410713407, 491953742,  3149407591, 961109680,  1548061756, 1934888620, 4214562113,
-            1555853416, 3318608531, 3599839935, 2599819225, 2676649952, 1902647993, 3197943734,
-            4213499273, 4203909276, 668602384,  2188341510, 4241359084, 197252548,  8968884,
-            3647746035, 629654524,  2057817762, 791687787,  1643270604, 1571637938, 3066487639,
-            961587641,  2026290282, 3826814783, 1067370024, 2223613942, 1525669339, 2679791787,
-            1664654967, 3740539785, 3902060288, 3971185743, 1690075221, 3305556349, 4226011346,
-            3135081672, 4017546432, 935893161,  904240268,  3484988721, 2448752416, 2887434676,
-            1497667362, 1494555863, 3251796061, 1037186927, 1608759110, 3873834254, 59242551,
-            487334743,  2580513180, 3704829028, 3859157573, 3452402004, 783668920,  2394905786,
-            3179497902, 2576105629, 1552362163, 2138613992, 224944469,  3876873579, 3402518289,
-            1709606949, 4255868112, 1249055439, 3395879908, 2957760102, 346905231,  590629983,
-            1171021480, 4051081465, 3913643946, 3115845768, 1021908139, 2556028362, 3828177651,
-            2870156105, 899722025,  661756192,  3775551864, 1288569751, 3751947667, 3064664685,
-            2559273148, 2660772417, 2448044253, 3054357327, 3434913868, 1444728572, 3010819186,
-            3010362527, 1709131033, 3425689752, 2849921358, 3518017065, 3845809665, 3245724553,
-            1008739837, 3274032925, 2567688974, 1981389077, 1108638127, 470206543,  1097339633,
-            1714430226, 2321268672, 1149373331, 294569671,  4264586290, 4270574127, 2522456947,
-            230975563,  131504269,  541738544,  1380704847, 2946408074, 282744860,  246858261,
-            2037373985, 1769191691, 2174871838, 2097427065, 492251656,  1252290304, 3616248100,
-            3213248383, 1847973756, 647347869,  3015847616, 299045987,  866593289,  2009367463,
-            2448831631, 337965200,  1210654808, 1694878225, 853507918,  3373825966, 4262812941,
-            4279525028, 338822858,  1038097567, 3996799911, 755960212,  149304151,  1599868486,
-            4021605447, 3040297322, 3891899828, 1711866076, 900840696,  3675688669, 3070862438,
-            2611308185, 2359948129, 1158552196, 2094484627, 3077606843, 2119537593, 427023787,
-            3632076073, 2670551310, 3396099733, 1066081183, 1817788918, 324769315,  656687887,
-            202117575,  3106428593, 3730407212, 1661316263, 1215084998, 2025391552, 664352483,
-            1914686594, 9439399,    2548190484, 3127972014, 4008228378, 2645735658, 2191361716,
-            2211450148, 1863406291, 1179298131, 241880428,  2330159770, 3490494273, 1337382890,
-            747522461,  1060348557, 3618051469, 991193538,  1604905367, 2595102954, 1460144089,
-            3990194961, 44265425,   896268152,  9333748,    2850675977, 941433385,  2483544989,
-            3443750079, 2488690792,
-        },
-        {
-            3732031456, 576306801,  2145981306, 209604625,  2422728040, 3663657370, 1858728561,
-            3387010542, 751349071,  1424921840, 3300108773, 3559432045, 4064909795, 2137969836,
-            2944258912, 598413329,  1218967576, 1444828980, 58299551,   3205898956, 3778144006,
-            3215877965, 1883733343, 2818194361, 125543642,  2045841246, 1344839429, 582287372,
-            4032226875, 2393334087, 280400854,  3202296153, 1819599175, 3800072032, 172553514,
-            2598001168, 2088457922, 1134288554, 3958678584, 1356330903, 3533903378, 3207799233,
-            1779703280, 1788285532, 1675935557, 3780568179, 4130611482, 595950484,  4204060692,
-            3913067124, 2708248723, 2039882984, 61728189,   3261703565, 2341349979, 579795310,
-            1434662218, 3456329295, 2133931503, 3908369478, 3655935522, 3908423368, 1812336725,
-            1410607478, 2916006733, 2392211415, 3031383171, 193820663,  893576096,  4035735571,
-            2188595704, 3317769796, 2325379935, 1171315627, 2477651445, 1731415627, 4106402129,
-            3276442529, 2436170163, 1248177811, 3028714841, 3654222257, 1654476140, 3783399199,
-            952335398,  3303040918, 2719099247, 3355278594, 2456568541, 135356469,  42936009,
-            657643862,  554939398,  937603740,  1875957660, 3073308855, 2414085672, 2184568501,
-            440766959,  4195019366, 249485516,  1892167107, 700748833,  74284439,   3019395853,
-            3871971638, 1250517191, 3577173754, 4057448718, 2326006664, 3721055404, 1230216230,
-            3390110175, 1353026250, 1052734716, 2109114231, 2844574416, 2210148982, 827933847,
-            1881017578, 1910250541, 3660440976, 3231185966, 949269542,  1971854421, 1605078992,
-            4220038710, 355750231,  170717869,  1228917996, 1469766433, 3567589766, 3215591895,
-            333416903,  2622801256, 3250663444, 885584118,  1751782721, 3874186186, 2447666078,
-            3495833983, 3806373953, 817449311,  1109709343, 1618423836, 1637309869, 3439527467,
-            4173298180, 3686876545, 1332000007, 148425903,  915393853,  763002582,  568254076,
-            3152320627, 409675713,  4261010737, 1873507512, 2399762951, 356214857,  4098172281,
-            3732031456, 576306801,  2145981306, 209604625,  3166056196, 3663657370, 1858728561,
-            3387010542, 751349071,  460835152,  3300108773, 3559432045, 4064909795, 2137969836,
-            1628945281, 598413329,  1218967576, 1444828980, 58299551,   2437763006, 3778144006,
-            3215877965, 1883733343, 2818194361, 557559888,  2045841246, 1344839429, 582287372,
-            4032226875, 1426334471, 280400854,  3202296153, 1819599175, 3800072032, 3486774062,
-            2598001168, 2088457922, 1134288554, 3958678584, 2147354169, 3533903378, 3207799233,
-            1779703280, 1788285532, 3092140671, 3780568179, 4130611482, 595950484,  4204060692,
-            780734120,  2708248723, 2039882984, 61728189,   3261703565, 3842903699, 579795310,
-            1434662218, 3456329295, 2133931503, 1966709342, 3655935522, 3908423368, 1812336725,
-            1410607478, 2800099137, 2392211415, 3031383171, 193820663,  893576096,  1634949858,
-            2188595704, 3317769796, 2325379935, 1171315627, 1395868479, 1731415627, 4106402129,
-            3276442529, 2436170163, 1437808723, 3028714841, 3654222257, 1654476140, 3783399199,
-            3135190816, 3303040918, 2719099247, 3355278594, 2456568541, 3623202730, 42936009,
-            657643862,  554939398,  937603740,  806244115,  3073308855, 2414085672, 2184568501,
-            440766959,  2352146567, 249485516,  1892167107, 700748833,  74284439,   3838349954,
-            3871971638, 1250517191, 3577173754, 4057448718, 699075901,  3721055404, 1230216230,
-            3390110175, 1353026250, 1016332489, 2109114231, 2844574416, 2210148982, 827933847,
-            1448850625, 1910250541, 3660440976, 3231185966, 949269542,  1281147737, 1605078992,
-            4220038710, 355750231,  170717869,  3191934097, 1469766433, 3567589766, 3215591895,
-            333416903,  169077210,  3250663444, 885584118,  1751782721, 3874186186, 545857,
-            3495833983, 3806373953, 817449311,  1109709343, 3544233277, 1637309869, 3439527467,
-            4173298180, 3686876545, 2828487761, 148425903,  915393853,  763002582,  568254076,
-            3789941538, 409675713,  4261010737, 1873507512, 2399762951, 2939272350, 4098172281,
-            3732031456, 576306801,  2145981306, 557910067,  3166056196, 3663657370, 1858728561,
-            3387010542, 2032333380, 460835152,  3300108773, 3559432045, 4064909795, 369224417,
-            1628945281, 598413329,  1218967576, 1444828980, 1486753175, 2437763006, 3778144006,
-            3215877965, 1883733343, 2316586532, 557559888,  2045841246, 1344839429, 582287372,
-            904738033,  1426334471, 280400854,  3202296153, 1819599175, 1782451416, 3486774062,
-            2598001168, 2088457922, 1134288554, 3014355664, 2147354169, 3533903378, 3207799233,
-            1779703280, 2164083968, 3092140671, 3780568179, 4130611482, 595950484,  2348074879,
-            780734120,  2708248723, 2039882984, 61728189,   4093434816, 3842903699, 579795310,
-            1434662218, 3456329295, 2324531646, 1966709342, 3655935522, 3908423368, 1812336725,
-            2819285326, 2800099137, 2392211415, 3031383171, 193820663,  675895909,  1634949858,
-            2188595704, 3317769796, 2325379935, 3835111015, 1395868479, 1731415627, 4106402129,
-            3276442529, 3030305259, 1437808723, 3028714841, 3654222257, 1654476140, 3533405115,
-            3135190816, 3303040918, 2719099247, 3355278594, 37027090,   3623202730, 42936009,
-            657643862,  554939398,  3100684295, 806244115,  3073308855, 2414085672, 2184568501,
-            1941130114, 2352146567, 249485516,  1892167107, 700748833,  610865935,  3838349954,
-            3871971638, 1250517191, 3577173754, 3739102761, 699075901,  3721055404, 1230216230,
-            3390110175, 2887453798, 1016332489, 2109114231, 2844574416, 2210148982, 2351125216,
-            1448850625, 1910250541, 3660440976, 3231185966, 912028152,  1281147737, 1605078992,
-            4220038710, 355750231,  4056151680, 3191934097, 1469766433, 3567589766, 3215591895,
-            3400739678, 169077210,  3250663444, 885584118,  1751782721, 3959860757, 545857,
-            3495833983, 3806373953, 817449311,  2046376873, 3544233277, 1637309869, 3439527467,
-            4173298180, 1588316423, 2828487761, 148425903,  915393853,  763002582,  3354459153,
-            3789941538, 409675713,  4261010737, 1873507512, 3973206689, 2939272350, 4098172281,
-            3732031456, 576306801,  4173183483, 557910067,  3166056196, 3663657370, 1858728561,
-            701723400,  2032333380, 460835152,  3300108773, 3559432045, 2768418693, 369224417,
-            1628945281, 598413329,  1218967576, 380535960,  1486753175, 2437763006, 3778144006,
-            3215877965, 3936713670, 2316586532, 557559888,  2045841246, 1344839429, 3718313672,
-            904738033,  1426334471, 280400854,  3202296153, 2325144928, 1782451416, 3486774062,
-            2598001168, 2088457922, 3622884684, 3014355664, 2147354169, 3533903378, 3207799233,
-            3172217885, 2164083968, 3092140671, 3780568179, 4130611482, 2171363900, 2348074879,
-            780734120,  2708248723, 2039882984, 1416782972, 4093434816, 3842903699, 579795310,
-            1434662218, 122214409,  2324531646, 1966709342, 3655935522, 3908423368, 2406089061,
-            2819285326, 2800099137, 2392211415, 3031383171, 3244351243, 675895909,  1634949858,
-            2188595704, 3317769796, 556499498,  3835111015, 1395868479, 1731415627, 4106402129,
-            3612174492, 3030305259, 1437808723, 3028714841, 3654222257, 4238103715, 3533405115,
-            3135190816, 3303040918, 2719099247, 631016127,  37027090,   3623202730, 42936009,
-            657643862,  1094666230, 3100684295, 806244115,  3073308855, 2414085672, 1013089191,
-            1941130114, 2352146567, 249485516,  1892167107, 3688895132, 610865935,  3838349954,
-            3871971638, 1250517191, 3263909574, 3739102761, 699075901,  3721055404, 1230216230,
-            1928307586, 2887453798, 1016332489, 2109114231, 2844574416, 1971126152, 2351125216,
-            1448850625, 1910250541, 3660440976, 1027777331, 912028152,  1281147737, 1605078992,
-            4220038710, 426641011,  4056151680, 3191934097, 1469766433, 3567589766, 214992804,
-            3400739678, 169077210,  3250663444, 885584118,  2309429858, 3959860757, 545857,
-            3495833983, 3806373953, 1330645102, 2046376873, 3544233277, 1637309869, 3439527467,
-            657830689,  1588316423, 2828487761, 148425903,  915393853,  4197913286, 3354459153,
-            3789941538, 409675713,  4261010737, 540012205,  1885156820, 191263305,  2287101258,
-            3457791564, 41308380,   263464622,  119022168,  406159394,  1647542156, 1824498349,
-            3327494976, 735088407,  1289426130, 1299147896, 2597225393, 1274347993, 1488980906,
-            1942037210, 2806285436, 3164637656, 3557489411, 2003907194, 2553910502, 3148801467,
-            4118794121, 703401157,  2744880510, 2690123316, 1254246284, 2201574117, 2494035475,
-            2088522389, 3305623887, 2590934759, 1949906413, 87351442,   1242993393, 4147033783,
-            4167621183, 2114254403, 4226139374, 2114316578, 3265697371, 2983837711, 909621386,
-            6475679,    586693402,  2473283302, 2758583160, 3393083966, 3711340663, 3967787229,
-            1340064894, 4230894541, 4221251615, 622624443,  1928058728, 2510042776, 1102019720,
-            1376905185, 910903068,  3277683008, 2715566150, 2194756,    2336310024, 2724706693,
-            165488515,  3595635181, 4231064930, 2523179125, 3133011925, 2368301579, 312282912,
-            2996915691, 2331323096, 2752213523, 41545571,   4139627390, 15923682,   1662154996,
-            2140911586, 397976408,  2014583584, 559724707,  2790063080, 61898568,   2037002543,
-            2767706968, 2366824189, 3988357291, 534628283,  4274470857, 575607603,  1003716172,
-            265673441,  1122351895, 2817990434, 2440824023, 53839811,   3418662794, 3703430481,
-            975142955,  3989710554, 1082106074, 1499516931, 2822845916, 1732435287, 3976553011,
-            3814689161, 3623407023, 3811444064, 192774992,  454249398,  3783072789, 202319360,
-            1573000242, 109401318,  627538851,  2833092339, 723253628,  2500925176, 1541623414,
-            2741984972, 2087498459, 717354819,  3949656964, 1854877158, 3901977228, 2922959954,
-            4133324297, 915253273,  969262555,  665099023,  2022268474, 589468080,  4150021298,
-            527839116,  4027347495, 893459808,  3413512204, 1120995950, 2933367931, 2933911610,
-            2122432837, 4243173364, 3015288730, 3393231923, 419440910,  2023191715, 3653118051,
-            4270562114, 2686472773, 146218516,  7328443,    3635305126, 580470880,  3848909937,
-            76308307,   484931730,
-        },
-        {
-            824297644,  239464654,  4133652405, 1611614045, 102133367,  1780659362, 114934718,
-            3793050817, 3286619856, 1323742990, 3487325492, 468742651,  271433491,  3474195023,
-            479173886,  3282693508, 978269731,  1826990521, 3664994445, 1943608646, 2356793330,
-            2228748670, 4238523810, 2467714013, 1732683390, 2345218001, 3371637369, 1073602848,
-            844797255,  3881048480, 509186599,  1399427071, 3815270778, 1505666412, 2616384981,
-            2990167853, 3716581225, 3063486812, 1568307898, 3262882991, 1455926070, 3011806226,
-            3803364927, 849372289,  2382885729, 3071102985, 3838244574, 3219174218, 847830757,
-            1414310383, 3679389549, 1558413907, 2211822428, 339810803,  1051648907, 76928699,
-            3174194320, 3920525151, 2010088097, 4111092791, 3537133983, 1701410561, 3036563175,
-            4010986440, 1749862952, 159833659,  3406940095, 1041601178, 4005001553, 1663515026,
-            1728511107, 1496728329, 2359970426, 530862749,  3797637507, 2550923758, 1450321218,
-            21682904,   936804838,  3832989199, 3063256293, 3991708711, 986539283,  3775232150,
-            2867283706, 747477232,  946349345,  1010022077, 188204104,  2526787171, 2816843760,
-            1776005940, 2819738500, 1155856699, 2191793692, 3802193350, 1163036922, 645032560,
-            3122679267, 3311719932, 3757073707, 2464258247, 1360425558, 387981241,  1714916540,
-            411019237,  2248466094, 2878213113, 2742600760, 2763650927, 2526526309, 1093836264,
-            3819986000, 3754388150, 1731831799, 1441137152, 1625850961, 1182084155, 1596226376,
-            2389499892, 3923360808, 2439159233, 1623373213, 2513747479, 3651587995, 1040867254,
-            4208484711, 3489019765, 2141904813, 3666280633, 970464748,  2970978888, 1376163015,
-            1218588624, 2721249823, 707915046,  4262557484, 3237019195, 744279211,  364567144,
-            1997174860, 3215512870, 2758022574, 2677818352, 4198422061, 3016017869, 2243997977,
-            1029293722, 1820056287, 1090825999, 4135403724, 299239527,  874620372,  2995368704,
-            3219627293, 2431393692, 3470601754, 1809177571, 37446335,   1619184385, 675901368,
-            824297644,  239464654,  4133652405, 1611614045, 1918718045, 1780659362, 114934718,
-            3793050817, 3286619856, 3566342809, 3487325492, 468742651,  271433491,  3474195023,
-            77797025,   3282693508, 978269731,  1826990521, 3664994445, 1455182612, 2356793330,
-            2228748670, 4238523810, 2467714013, 1081984526, 2345218001, 3371637369, 1073602848,
-            844797255,  4125413817, 509186599,  1399427071, 3815270778, 1505666412, 891823593,
-            2990167853, 3716581225, 3063486812, 1568307898, 1753181930, 1455926070, 3011806226,
-            3803364927, 849372289,  4211525266, 3071102985, 3838244574, 3219174218, 847830757,
-            774013898,  3679389549, 1558413907, 2211822428, 339810803,  2282783575, 76928699,
-            3174194320, 3920525151, 2010088097, 3894905215, 3537133983, 1701410561, 3036563175,
-            4010986440, 676262036,  159833659,  3406940095, 1041601178, 4005001553, 3470687799,
-            1728511107, 1496728329, 2359970426, 530862749,  3081565689, 2550923758, 1450321218,
-            21682904,   936804838,  951873872,  3063256293, 3991708711, 986539283,  3775232150,
-            487381835,  747477232,  946349345,  1010022077, 188204104,  2898848241, 2816843760,
-            1776005940, 2819738500, 1155856699, 2432683643, 3802193350, 1163036922, 645032560,
-            3122679267, 22749078,   3757073707, 2464258247, 1360425558, 387981241,  3652130062,
-            411019237,  2248466094, 2878213113, 2742600760, 811608089,  2526526309, 1093836264,
-            3819986000, 3754388150, 415809552,  1441137152, 1625850961, 1182084155, 1596226376,
-            202609936,  3923360808, 2439159233, 1623373213, 2513747479, 4149563237, 1040867254,
-            4208484711, 3489019765, 2141904813, 718806958,  970464748,  2970978888, 1376163015,
-            1218588624, 2307367700, 707915046,  4262557484, 3237019195, 744279211,  1876395939,
-            1997174860, 3215512870, 2758022574, 2677818352, 2276158677, 3016017869, 2243997977,
-            1029293722, 1820056287, 3605618012, 4135403724, 299239527,  874620372,  2995368704,
-            872126519,  2431393692, 3470601754, 1809177571, 37446335,   2365355125, 675901368,
-            824297644,  239464654,  4133652405, 8139161,    1918718045, 1780659362, 114934718,
-            3793050817, 2424418256, 3566342809, 3487325492, 468742651,  271433491,  542129690,
-            77797025,   3282693508, 978269731,  1826990521, 2963435579, 1455182612, 2356793330,
-            2228748670, 4238523810, 2373300657, 1081984526, 2345218001, 3371637369, 1073602848,
-            2948610237, 4125413817, 509186599,  1399427071, 3815270778, 2870251133, 891823593,
-            2990167853, 3716581225, 3063486812, 2347504584, 1753181930, 1455926070, 3011806226,
-            3803364927, 3956554065, 4211525266, 3071102985, 3838244574, 3219174218, 2018597841,
-            774013898,  3679389549, 1558413907, 2211822428, 56072605,   2282783575, 76928699,
-            3174194320, 3920525151, 268031035,  3894905215, 3537133983, 1701410561, 3036563175,
-            366935627,  676262036,  159833659,  3406940095, 1041601178, 4125224603, 3470687799,
-            1728511107, 1496728329, 2359970426, 3570997128, 3081565689, 2550923758, 1450321218,
-            21682904,   604517910,  951873872,  3063256293, 3991708711, 986539283,  2414780630,
-            487381835,  747477232,  946349345,  1010022077, 3820353604, 2898848241, 2816843760,
-            1776005940, 2819738500, 1192624235, 2432683643, 3802193350, 1163036922, 645032560,
-            4050277201, 22749078,   3757073707, 2464258247, 1360425558, 1933406988, 3652130062,
-            411019237,  2248466094, 2878213113, 37869698,   811608089,  2526526309, 1093836264,
-            3819986000, 3999750910, 415809552,  1441137152, 1625850961, 1182084155, 1186617400,
-            202609936,  3923360808, 2439159233, 1623373213, 4226729056, 4149563237, 1040867254,
-            4208484711, 3489019765, 3728140516, 718806958,  970464748,  2970978888, 1376163015,
-            1307011711, 2307367700, 707915046,  4262557484, 3237019195, 4014387080, 1876395939,
-            1997174860, 3215512870, 2758022574, 1696763772, 2276158677, 3016017869, 2243997977,
-            1029293722, 1444214949, 3605618012, 4135403724, 299239527,  874620372,  1524158085,
-            872126519,  2431393692, 3470601754, 1809177571, 163166369,  2365355125, 675901368,
-            824297644,  239464654,  1626558353, 8139161,    1918718045, 1780659362, 114934718,
-            1885224714, 2424418256, 3566342809, 3487325492, 468742651,  1101039917, 542129690,
-            77797025,   3282693508, 978269731,  3659653445, 2963435579, 1455182612, 2356793330,
-            2228748670, 539062188,  2373300657, 1081984526, 2345218001, 3371637369, 2825652803,
-            2948610237, 4125413817, 509186599,  1399427071, 3197034620, 2870251133, 891823593,
-            2990167853, 3716581225, 3773712182, 2347504584, 1753181930, 1455926070, 3011806226,
-            3260276773, 3956554065, 4211525266, 3071102985, 3838244574, 201639236,  2018597841,
-            774013898,  3679389549, 1558413907, 2830702673, 56072605,   2282783575, 76928699,
-            3174194320, 1677734845, 268031035,  3894905215, 3537133983, 1701410561, 4240866153,
-            366935627,  676262036,  159833659,  3406940095, 4245889153, 4125224603, 3470687799,
-            1728511107, 1496728329, 3650277906, 3570997128, 3081565689, 2550923758, 1450321218,
-            3392011930, 604517910,  951873872,  3063256293, 3991708711, 2876003834, 2414780630,
-            487381835,  747477232,  946349345,  982266944,  3820353604, 2898848241, 2816843760,
-            1776005940, 3677715064, 1192624235, 2432683643, 3802193350, 1163036922, 1226669337,
-            4050277201, 22749078,   3757073707, 2464258247, 4197532785, 1933406988, 3652130062,
-            411019237,  2248466094, 3209426720, 37869698,   811608089,  2526526309, 1093836264,
-            535856568,  3999750910, 415809552,  1441137152, 1625850961, 2181491119, 1186617400,
-            202609936,  3923360808, 2439159233, 1823827533, 4226729056, 4149563237, 1040867254,
-            4208484711, 1101917521, 3728140516, 718806958,  970464748,  2970978888, 1574663259,
-            1307011711, 2307367700, 707915046,  4262557484, 2164217930, 4014387080, 1876395939,
-            1997174860, 3215512870, 1335157953, 1696763772, 2276158677, 3016017869, 2243997977,
-            324788481,  1444214949, 3605618012, 4135403724, 299239527,  4190629945, 1524158085,
-            872126519,  2431393692, 3470601754, 3701018280, 671547257,  4029965023, 1026428282,
-            1584875796, 3537698406, 3731126476, 2419795330, 993551117,  2126319514, 3557113304,
-            1014047757, 1407120210, 1977537539, 1338958570, 3249585389, 3661503659, 4240815680,
-            1866933898, 3205442033, 4247144816, 1422846419, 3847421981, 1383632066, 3589322376,
-            1816906043, 1310944471, 3646822098, 799529013,  3350558751, 2552899295, 4281235599,
-            4069668296, 4123814877, 3289565353, 1512974699, 111908081,  2535556715, 333570815,
-            3638041929, 1942569446, 20945397,   3784826827, 200406456,  2640512138, 38390336,
-            436784052,  3062106345, 1675333627, 709613078,  3479720979, 2726065658, 4072312748,
-            797389139,  3492082903, 3792395750, 983473383,  2984788349, 2030282907, 2246686378,
-            2451087141, 1799640566, 2182694041, 3226819076, 3573153299, 3658670545, 1197013516,
-            777601408,  4271704548, 1192713934, 1628497069, 681025927,  4078910773, 619496169,
-            1534725146, 1881987408, 2283881479, 1090218673, 4169123978, 2352195985, 2640116078,
-            3869558100, 2859177954, 3329803656, 4048903941, 1636589748, 2095007175, 4169840880,
-            2953611537, 2413740464, 3029624235, 778662441,  422412779,  412103280,  1701569571,
-            564088645,  469973310,  254302146,  3963642101, 555781470,  2983576224, 1757897888,
-            1420763962, 2176323176, 916790568,  3057610889, 196828641,  1435167402, 325046353,
-            1337309066, 2691769282, 3572566918, 2910149226, 3659418019, 2511762503, 3869838339,
-            1413312151, 1939339596, 801124461,  760477862,  2416958233, 3439465675, 3561763524,
-            1760392811, 1582406751, 1203071257, 755811399,  2675585013, 1150664766, 3515765747,
-            3419135844, 2076543342, 1191918544, 3644819073, 2195875022, 2909071148, 3385707813,
-            1151273265, 1467337419, 3570589492, 3742049917, 1609858615, 2964509119, 3747960348,
-            2825858640, 101501715,  1234710482, 750428334,  2870070395, 416615350,  4054039387,
-            3807926874, 3035407103, 1644560291, 2490941295, 963796562,  3233132139, 2590859502,
-            2845243609, 964355909,
-        },
-        {
-            2544278169, 2939053568, 3085145973, 2712196815, 3188468019, 1813135367, 308819838,
-            51095205,   1387165216, 1749188462, 3439639661, 255613977,  288971261,  821625273,
-            2026897578, 3334524520, 1399926443, 2614376170, 1005336567, 4275359614, 667183303,
-            675366385,  3054794121, 2178833901, 192619638,  1646161141, 3267994378, 992528812,
-            1850039632, 714918544,  3430428015, 1327891834, 4128103289, 1462809036, 2143164321,
-            1119632265, 359122307,  1713908264, 2973658418, 3033508659, 99823102,   3261307852,
-            1503576023, 2381627458, 2348000845, 2542746193, 3638818787, 2048692630, 2261583022,
-            1761891949, 489667458,  3324657812, 995203012,  153892873,  827654808,  1320381330,
-            1907503912, 2320276888, 330023466,  1407630176, 2937759177, 319990886,  4256867495,
-            150520816,  2920435226, 3717779165, 3156159516, 674319039,  1831313939, 2334125115,
-            4240001324, 2041963917, 2263455488, 2502321269, 4196143513, 2383892579, 2566834047,
-            3396087783, 1640149677, 2990680594, 1863439927, 2909619059, 127344690,  4127783814,
-            1298026345, 1328514818, 2424593703, 4029195075, 3730371224, 1316326820, 3004231541,
-            3947113987, 3012954192, 3949101919, 3847505506, 3469200387, 4103476694, 3127722884,
-            372683632,  313666568,  3220353620, 3504887252, 1743095713, 1297334160, 436886052,
-            3113142353, 3055124102, 2097936265, 58921882,   525180709,  660019707,  3494794889,
-            3311953600, 3828431679, 2832230811, 1002914344, 2427488237, 1829431687, 3617732849,
-            2712836005, 442442522,  4050242238, 2353550583, 2008716867, 1797052528, 825823063,
-            69009449,   451425130,  2180903716, 2734871394, 2620620429, 1446399247, 2738833140,
-            4229372026, 3832404201, 2638960117, 711983593,  356188926,  2314924548, 4214455598,
-            2930016402, 631702159,  4115356192, 3916927247, 2741161210, 3709335688, 571014109,
-            1386102441, 2354781086, 4213633870, 3419204493, 723044076,  642450604,  909006332,
-            2709744343, 2869513557, 1636787991, 220915052,  679084472,  3824744389, 3475794938,
-            2544278169, 2939053568, 3085145973, 2712196815, 3221692061, 1813135367, 308819838,
-            51095205,   1387165216, 4260105044, 3439639661, 255613977,  288971261,  821625273,
-            3990802156, 3334524520, 1399926443, 2614376170, 1005336567, 2754825886, 667183303,
-            675366385,  3054794121, 2178833901, 3008377599, 1646161141, 3267994378, 992528812,
-            1850039632, 950608355,  3430428015, 1327891834, 4128103289, 1462809036, 241746918,
-            1119632265, 359122307,  1713908264, 2973658418, 2479609041, 99823102,   3261307852,
-            1503576023, 2381627458, 2884997931, 2542746193, 3638818787, 2048692630, 2261583022,
-            3031987404, 489667458,  3324657812, 995203012,  153892873,  567897554,  1320381330,
-            1907503912, 2320276888, 330023466,  521880018,  2937759177, 319990886,  4256867495,
-            150520816,  3667406496, 3717779165, 3156159516, 674319039,  1831313939, 3694837264,
-            4240001324, 2041963917, 2263455488, 2502321269, 2648778705, 2383892579, 2566834047,
-            3396087783, 1640149677, 1593154734, 1863439927, 2909619059, 127344690,  4127783814,
-            3911912976, 1328514818, 2424593703, 4029195075, 3730371224, 3113343433, 3004231541,
-            3947113987, 3012954192, 3949101919, 3829970293, 3469200387, 4103476694, 3127722884,
-            372683632,  1741997349, 3220353620, 3504887252, 1743095713, 1297334160, 451861102,
-            3113142353, 3055124102, 2097936265, 58921882,   71423397,   660019707,  3494794889,
-            3311953600, 3828431679, 3381493808, 1002914344, 2427488237, 1829431687, 3617732849,
-            684249771,  442442522,  4050242238, 2353550583, 2008716867, 282417154,  825823063,
-            69009449,   451425130,  2180903716, 1597256001, 2620620429, 1446399247, 2738833140,
-            4229372026, 1232940679, 2638960117, 711983593,  356188926,  2314924548, 1546635606,
-            2930016402, 631702159,  4115356192, 3916927247, 3191232832, 3709335688, 571014109,
-            1386102441, 2354781086, 1137344587, 3419204493, 723044076,  642450604,  909006332,
-            914239350,  2869513557, 1636787991, 220915052,  679084472,  753607815,  3475794938,
-            2544278169, 2939053568, 3085145973, 711908924,  3221692061, 1813135367, 308819838,
-            51095205,   3627833178, 4260105044, 3439639661, 255613977,  288971261,  158609116,
-            3990802156, 3334524520, 1399926443, 2614376170, 1026985103, 2754825886, 667183303,
-            675366385,  3054794121, 2183815866, 3008377599, 1646161141, 3267994378, 992528812,
-            2568603011, 950608355,  3430428015, 1327891834, 4128103289, 3161052871, 241746918,
-            1119632265, 359122307,  1713908264, 4194347900, 2479609041, 99823102,   3261307852,
-            1503576023, 4137706250, 2884997931, 2542746193, 3638818787, 2048692630, 1680458038,
-            3031987404, 489667458,  3324657812, 995203012,  3692900749, 567897554,  1320381330,
-            1907503912, 2320276888, 488629220,  521880018,  2937759177, 319990886,  4256867495,
-            1476285498, 3667406496, 3717779165, 3156159516, 674319039,  599969212,  3694837264,
-            4240001324, 2041963917, 2263455488, 3380248903, 2648778705, 2383892579, 2566834047,
-            3396087783, 2894448143, 1593154734, 1863439927, 2909619059, 127344690,  3494368993,
-            3911912976, 1328514818, 2424593703, 4029195075, 3871553531, 3113343433, 3004231541,
-            3947113987, 3012954192, 127781594,  3829970293, 3469200387, 4103476694, 3127722884,
-            4031263411, 1741997349, 3220353620, 3504887252, 1743095713, 3085476692, 451861102,
-            3113142353, 3055124102, 2097936265, 610110532,  71423397,   660019707,  3494794889,
-            3311953600, 3785033384, 3381493808, 1002914344, 2427488237, 1829431687, 3720215088,
-            684249771,  442442522,  4050242238, 2353550583, 381872200,  282417154,  825823063,
-            69009449,   451425130,  3815762487, 1597256001, 2620620429, 1446399247, 2738833140,
-            1366532717, 1232940679, 2638960117, 711983593,  356188926,  892712324,  1546635606,
-            2930016402, 631702159,  4115356192, 2394015921, 3191232832, 3709335688, 571014109,
-            1386102441, 3921933418, 1137344587, 3419204493, 723044076,  642450604,  1109579791,
-            914239350,  2869513557, 1636787991, 220915052,  2279685910, 753607815,  3475794938,
-            2544278169, 2939053568, 394244491,  711908924,  3221692061, 1813135367, 308819838,
-            2244778639, 3627833178, 4260105044, 3439639661, 255613977,  1148261516, 158609116,
-            3990802156, 3334524520, 1399926443, 184607306,  1026985103, 2754825886, 667183303,
-            675366385,  2525743101, 2183815866, 3008377599, 1646161141, 3267994378, 4177046654,
-            2568603011, 950608355,  3430428015, 1327891834, 443684702,  3161052871, 241746918,
-            1119632265, 359122307,  1996267614, 4194347900, 2479609041, 99823102,   3261307852,
-            479826691,  4137706250, 2884997931, 2542746193, 3638818787, 1861709418, 1680458038,
-            3031987404, 489667458,  3324657812, 2153541610, 3692900749, 567897554,  1320381330,
-            1907503912, 2436037452, 488629220,  521880018,  2937759177, 319990886,  1012707710,
-            1476285498, 3667406496, 3717779165, 3156159516, 697835100,  599969212,  3694837264,
-            4240001324, 2041963917, 2431518944, 3380248903, 2648778705, 2383892579, 2566834047,
-            590240396,  2894448143, 1593154734, 1863439927, 2909619059, 3762977445, 3494368993,
-            3911912976, 1328514818, 2424593703, 2235541547, 3871553531, 3113343433, 3004231541,
-            3947113987, 3469211864, 127781594,  3829970293, 3469200387, 4103476694, 1979317225,
-            4031263411, 1741997349, 3220353620, 3504887252, 2019931089, 3085476692, 451861102,
-            3113142353, 3055124102, 206846406,  610110532,  71423397,   660019707,  3494794889,
-            1121455288, 3785033384, 3381493808, 1002914344, 2427488237, 3777227052, 3720215088,
-            684249771,  442442522,  4050242238, 4146675860, 381872200,  282417154,  825823063,
-            69009449,   1747938718, 3815762487, 1597256001, 2620620429, 1446399247, 2687764785,
-            1366532717, 1232940679, 2638960117, 711983593,  1643528251, 892712324,  1546635606,
-            2930016402, 631702159,  1073068517, 2394015921, 3191232832, 3709335688, 571014109,
-            3136768511, 3921933418, 1137344587, 3419204493, 723044076,  3920065121, 1109579791,
-            914239350,  2869513557, 1636787991, 958588073,  3685502372, 2785430416, 3292093876,
-            295851341,  2517402281, 1817172689, 128884063,  2050323591, 2579344143, 2221192663,
-            1866759284, 1426123647, 309791721,  3974320779, 611749838,  3382620924, 3293658121,
-            3567985264, 2481066841, 1701811739, 1363223219, 2903735774, 1111331424, 3971339349,
-            3980192243, 1099930034, 3181180741, 2409275279, 1562534283, 1860981548, 3799564369,
-            3130780610, 865133839,  781180239,  2845387198, 79405097,   4247048341, 2173304641,
-            451768188,  1060001506, 3244610530, 1260232992, 2303471346, 1732285446, 976795580,
-            2117667917, 2169920053, 2963706609, 1786498859, 1953251075, 3254447632, 2980196142,
-            3513193775, 941758883,  3075514057, 1173792379, 1925573682, 3654855604, 1068537392,
-            2293638494, 1887033790, 1369070339, 3959396106, 3880033858, 1486366962, 164574578,
-            2584042479, 1297246091, 579120038,  3680616313, 342949896,  3564981965, 4100634382,
-            4287794145, 1929008984, 3945692100, 2328111700, 2832946710, 624335781,  1778190252,
-            1023172953, 2776534491, 2745281665, 2566372445, 1829481726, 3291757223, 231674564,
-            2991457008, 1201140014, 3867713837, 3821962105, 4230825939, 4148262339, 3059165812,
-            154805372,  2828062935, 3221117843, 66756048,   2035956413, 1982807161, 889662093,
-            1479196148, 1413990123, 3062910058, 1232465148, 431816322,  1453989412, 3136713948,
-            1931511684, 2155448959, 4179686225, 3002985433, 4060524738, 4014543593, 1869417587,
-            284377502,  1481405238, 3026676590, 2091403683, 919727389,  2640684490, 1807334970,
-            1562720469, 83986141,   682402223,  4177413106, 4138905750, 1884830473, 1768472195,
-            1963802856, 1870697676, 1153076926, 974699472,  3296149817, 1028014421, 2837722112,
-            631674984,  4077412581, 3354315884, 1251451387, 727835072,  508843076,  1115397394,
-            3974045056, 662414025,  411966252,  2520765341, 671714013,  4112413269, 1923267002,
-            3361075269, 563479599,  1650230372, 2844815337, 878083172,  3723562501, 2681460234,
-            2846751100, 44348457,
-        },
-        {
-            2882980002, 2211288683, 872766101,  3713771728, 1429983118, 2069599564, 827699420,
-            1288565883, 2985727214, 3873174741, 2138389854, 3915615927, 2759028650, 3120611541,
-            385953581,  189931252,  2044235060, 4214733958, 1899137741, 1973215178, 494148492,
-            1550568689, 3646957712, 3764784141, 1114556979, 1411407684, 1194906295, 1718808623,
-            1809627046, 1413570172, 180837718,  2588730975, 1481586714, 2836300053, 1967135375,
-            4010897189, 3392273121, 3466021198, 1182364160, 1364130321, 1795412556, 330320182,
-            1165093128, 2125767818, 904192995,  51833064,   232302906,  1834422179, 476731510,
-            3484170517, 2373156680, 2610500049, 1688364249, 463611489,  3759685710, 62038708,
-            2357334250, 1230002441, 520303451,  3009758047, 1882263827, 2524779298, 1736323157,
-            3883037541, 1103650182, 1137565179, 3112310886, 3524287283, 3064002681, 4106308847,
-            3180534967, 2463036338, 1859639515, 1319061987, 354419222,  4108171950, 601260554,
-            705389180,  4081137445, 3461353436, 399768111,  3963945521, 2094962544, 630762046,
-            369047181,  3495709267, 3525452874, 314919391,  2152657907, 881476500,  3565507827,
-            2594931381, 579458905,  1767988684, 2678728511, 3416503939, 4150612567, 1015748208,
-            2059142720, 2725183490, 2998421769, 1644667445, 4221112143, 456578131,  3881530201,
-            190710543,  1721255927, 2274887963, 187713135,  2209254952, 2185750138, 2992229399,
-            482133467,  2758198810, 15147949,   536333711,  2296185346, 1103433779, 1573407789,
-            1357843567, 2927153963, 4157295398, 533935893,  3567030810, 1900900411, 509578395,
-            3810017456, 2134110040, 3347323570, 3497032747, 201278263,  3933249682, 3849960474,
-            2509123202, 3445521167, 1355284593, 2444811561, 2751112324, 1116246614, 511213077,
-            3412599909, 1712118363, 54054007,   442729047,  3077267414, 1532701769, 181534938,
-            1278069867, 3847149992, 2305860479, 4146252420, 2047690303, 361856758,  452490341,
-            636885000,  1733216839, 3788548638, 1094285639, 1349356222, 2760444511, 976767752,
-            2882980002, 2211288683, 872766101,  3713771728, 895830110,  2069599564, 827699420,
-            1288565883, 2985727214, 3377496544, 2138389854, 3915615927, 2759028650, 3120611541,
-            3254971483, 189931252,  2044235060, 4214733958, 1899137741, 2095055586, 494148492,
-            1550568689, 3646957712, 3764784141, 2869825005, 1411407684, 1194906295, 1718808623,
-            1809627046, 907760376,  180837718,  2588730975, 1481586714, 2836300053, 639229964,
-            4010897189, 3392273121, 3466021198, 1182364160, 3006792787, 1795412556, 330320182,
-            1165093128, 2125767818, 253264555,  51833064,   232302906,  1834422179, 476731510,
-            4284481518, 2373156680, 2610500049, 1688364249, 463611489,  4133115610, 62038708,
-            2357334250, 1230002441, 520303451,  1497001150, 1882263827, 2524779298, 1736323157,
-            3883037541, 3541909847, 1137565179, 3112310886, 3524287283, 3064002681, 3193060438,
-            3180534967, 2463036338, 1859639515, 1319061987, 111871878,  4108171950, 601260554,
-            705389180,  4081137445, 742999102,  399768111,  3963945521, 2094962544, 630762046,
-            3219207950, 3495709267, 3525452874, 314919391,  2152657907, 720863934,  3565507827,
-            2594931381, 579458905,  1767988684, 3958525287, 3416503939, 4150612567, 1015748208,
-            2059142720, 4227838648, 2998421769, 1644667445, 4221112143, 456578131,  302729329,
-            190710543,  1721255927, 2274887963, 187713135,  1293706587, 2185750138, 2992229399,
-            482133467,  2758198810, 2514965671, 536333711,  2296185346, 1103433779, 1573407789,
-            2237639577, 2927153963, 4157295398, 533935893,  3567030810, 3793156627, 509578395,
-            3810017456, 2134110040, 3347323570, 1358364,    201278263,  3933249682, 3849960474,
-            2509123202, 628476542,  1355284593, 2444811561, 2751112324, 1116246614, 3421170828,
-            3412599909, 1712118363, 54054007,   442729047,  325825294,  1532701769, 181534938,
-            1278069867, 3847149992, 2785457372, 4146252420, 2047690303, 361856758,  452490341,
-            1099532083, 1733216839, 3788548638, 1094285639, 1349356222, 3047068265, 976767752,
-            2882980002, 2211288683, 872766101,  366378371,  895830110,  2069599564, 827699420,
-            1288565883, 962962884,  3377496544, 2138389854, 3915615927, 2759028650, 3742489931,
-            3254971483, 189931252,  2044235060, 4214733958, 3073407497, 2095055586, 494148492,
-            1550568689, 3646957712, 758370067,  2869825005, 1411407684, 1194906295, 1718808623,
-            636166267,  907760376,  180837718,  2588730975, 1481586714, 705382583,  639229964,
-            4010897189, 3392273121, 3466021198, 3815622040, 3006792787, 1795412556, 330320182,
-            1165093128, 2956382339, 253264555,  51833064,   232302906,  1834422179, 3665645898,
-            4284481518, 2373156680, 2610500049, 1688364249, 2565987890, 4133115610, 62038708,
-            2357334250, 1230002441, 2397198293, 1497001150, 1882263827, 2524779298, 1736323157,
-            817630445,  3541909847, 1137565179, 3112310886, 3524287283, 1356492703, 3193060438,
-            3180534967, 2463036338, 1859639515, 3963974342, 111871878,  4108171950, 601260554,
-            705389180,  1776439965, 742999102,  399768111,  3963945521, 2094962544, 2007137733,
-            3219207950, 3495709267, 3525452874, 314919391,  3877039785, 720863934,  3565507827,
-            2594931381, 579458905,  2919403199, 3958525287, 3416503939, 4150612567, 1015748208,
-            960765392,  4227838648, 2998421769, 1644667445, 4221112143, 2402062799, 302729329,
-            190710543,  1721255927, 2274887963, 3958481548, 1293706587, 2185750138, 2992229399,
-            482133467,  3838280,    2514965671, 536333711,  2296185346, 1103433779, 3675282065,
-            2237639577, 2927153963, 4157295398, 533935893,  4172021805, 3793156627, 509578395,
-            3810017456, 2134110040, 3608998517, 1358364,    201278263,  3933249682, 3849960474,
-            2445690023, 628476542,  1355284593, 2444811561, 2751112324, 507378026,  3421170828,
-            3412599909, 1712118363, 54054007,   770634305,  325825294,  1532701769, 181534938,
-            1278069867, 4055596097, 2785457372, 4146252420, 2047690303, 361856758,  3439427065,
-            1099532083, 1733216839, 3788548638, 1094285639, 1633234274, 3047068265, 976767752,
-            2882980002, 2211288683, 3763615153, 366378371,  895830110,  2069599564, 827699420,
-            2457443913, 962962884,  3377496544, 2138389854, 3915615927, 3290989016, 3742489931,
-            3254971483, 189931252,  2044235060, 4275822963, 3073407497, 2095055586, 494148492,
-            1550568689, 1043420085, 758370067,  2869825005, 1411407684, 1194906295, 676378812,
-            636166267,  907760376,  180837718,  2588730975, 2971715054, 705382583,  639229964,
-            4010897189, 3392273121, 795184546,  3815622040, 3006792787, 1795412556, 330320182,
-            1990804460, 2956382339, 253264555,  51833064,   232302906,  836875615,  3665645898,
-            4284481518, 2373156680, 2610500049, 98106795,   2565987890, 4133115610, 62038708,
-            2357334250, 2761212145, 2397198293, 1497001150, 1882263827, 2524779298, 2381031747,
-            817630445,  3541909847, 1137565179, 3112310886, 2501374726, 1356492703, 3193060438,
-            3180534967, 2463036338, 3671733096, 3963974342, 111871878,  4108171950, 601260554,
-            1017043724, 1776439965, 742999102,  399768111,  3963945521, 2177838102, 2007137733,
-            3219207950, 3495709267, 3525452874, 3254054416, 3877039785, 720863934,  3565507827,
-            2594931381, 1994293489, 2919403199, 3958525287, 3416503939, 4150612567, 1976960210,
-            960765392,  4227838648, 2998421769, 1644667445, 2896792687, 2402062799, 302729329,
-            190710543,  1721255927, 2914584080, 3958481548, 1293706587, 2185750138, 2992229399,
-            810756083,  3838280,    2514965671, 536333711,  2296185346, 1776509588, 3675282065,
-            2237639577, 2927153963, 4157295398, 2048779551, 4172021805, 3793156627, 509578395,
-            3810017456, 3042185034, 3608998517, 1358364,    201278263,  3933249682, 3551449718,
-            2445690023, 628476542,  1355284593, 2444811561, 3480611728, 507378026,  3421170828,
-            3412599909, 1712118363, 1268921331, 770634305,  325825294,  1532701769, 181534938,
-            2645357587, 4055596097, 2785457372, 4146252420, 2047690303, 1994855609, 3439427065,
-            1099532083, 1733216839, 3788548638, 3516588243, 4058132193, 3940172101, 4043964688,
-            3377150021, 1381463736, 3320280180, 931260821,  2754727582, 1286176949, 1661126244,
-            2301263887, 2255977851, 1122646603, 1767549201, 162324152,  425506096,  3777762686,
-            13687528,   710105607,  1092739920, 2930179533, 568855389,  2476208631, 964360978,
-            2011445117, 3887128674, 2799005525, 2479086439, 814368438,  2018629666, 909662384,
-            231589584,  1422241284, 4035938208, 3570985552, 660700421,  603857869,  567385627,
-            3232044670, 291307502,  947817625,  3466590280, 3080261993, 947835229,  2925888682,
-            1817591844, 2652420575, 4150903445, 4055627313, 1715025966, 505331227,  1863531052,
-            2928506098, 947547681,  1117344443, 781457023,  607542746,  241559360,  3797150797,
-            105381589,  361541961,  3393121650, 3840152184, 2873171161, 3030026082, 1115171192,
-            1718221281, 96787532,   2556617898, 1237726058, 2876298621, 1052881200, 461661595,
-            2632346030, 1775614319, 2454951319, 3691637824, 4018448825, 1610472965, 3076493165,
-            1364200430, 2011206580, 1066672050, 706141458,  2064189273, 346938484,  2964350202,
-            3731612957, 2506635528, 2007045393, 3312126930, 2602035453, 988876930,  2960173442,
-            559685520,  2719943441, 891699839,  1151651090, 1223301894, 3666960271, 1330825927,
-            1681770552, 38877327,   3803211467, 4000053051, 3552560459, 3510286057, 2606732870,
-            721190747,  1933504723, 3110735238, 2333178561, 1577381363, 595257962,  4120745072,
-            960219089,  2591080970, 3354222743, 47827627,   3759509914, 304815919,  2643673615,
-            1381570381, 2103367217, 2440936991, 2376721005, 1483630814, 3137202706, 3075255640,
-            1743649605, 3649754571, 2550788713, 4281983459, 904183710,  4243944530, 2742129811,
-            3363501626, 3670239155, 4233018118, 2615012385, 1420298161, 1251344091, 2172588631,
-            1243035186, 1724496237, 762022558,  8747231,    334416849,  1219880856, 187900356,
-            2527057367, 1730455958, 3240238410, 906024910,  2351575735, 4207748622, 936139767,
-            1984289988, 285939331,
-        },
-        {
-            2291819910, 656568507,  2440475466, 1675314204, 2113630687, 160882175,  1733798909,
-            1947964301, 2875144749, 2185638885, 2219788747, 3312784972, 4099974523, 2309882463,
-            3801791698, 323408412,  1910061239, 3192175262, 3144004927, 610587964,  4199188747,
-            3868849183, 2049974426, 2202318731, 1042247085, 899939912,  3374950347, 2781125033,
-            369178892,  328069949,  3932917702, 4089148364, 43303503,   2406783716, 3494593093,
-            1800256172, 412757495,  3254230097, 3488122537, 438384462,  3874798389, 3952988713,
-            456031261,  1743881205, 4101917599, 1914458625, 2917378580, 1058623149, 717301031,
-            1195776807, 4251197384, 2605164529, 2381647759, 3173832658, 996725280,  3376173267,
-            160866008,  1738822693, 518772667,  1656846590, 2390325308, 2657071105, 3738070961,
-            3903473232, 871422886,  2485447262, 472464751,  1327459217, 2675912059, 3305977251,
-            1145735335, 3851502665, 2879960635, 25081924,   1350216801, 1194455782, 407338501,
-            3988100865, 2375465993, 3921618927, 2180720160, 2785125433, 950411179,  3386568730,
-            3877702988, 3910202466, 3307600013, 1446256711, 1167026874, 344875389,  3802270050,
-            3166427346, 1508980463, 1396374457, 3781448097, 2177893087, 1072163606, 3965312370,
-            3891719888, 1984977454, 3715945426, 2815044826, 2396471109, 486581966,  4212018235,
-            3168925510, 3118304313, 3307210608, 4178430275, 4033045912, 1616681972, 969962225,
-            4194057033, 614029910,  1942183585, 637477377,  2011817182, 4212294533, 2920009678,
-            3505883221, 3317214975, 2499726299, 2818313691, 2146785216, 2356135411, 2783898142,
-            717054897,  1406872549, 853712170,  843938694,  2184552409, 121998852,  1614287344,
-            1255153232, 2430054506, 948667667,  2555514953, 3076028337, 3175248363, 1174624927,
-            814114941,  868415054,  3795142449, 2376818343, 4268895716, 2839801916, 2190577034,
-            1993159070, 1389207182, 1995747570, 3110309837, 1776862529, 1358937431, 4219566089,
-            811225338,  2622401646, 2267157302, 1005803342, 2797171693, 337157536,  413495297,
-            2291819910, 656568507,  2440475466, 1675314204, 1874113546, 160882175,  1733798909,
-            1947964301, 2875144749, 1083575260, 2219788747, 3312784972, 4099974523, 2309882463,
-            3553094590, 323408412,  1910061239, 3192175262, 3144004927, 2886513346, 4199188747,
-            3868849183, 2049974426, 2202318731, 3858172787, 899939912,  3374950347, 2781125033,
-            369178892,  3044130073, 3932917702, 4089148364, 43303503,   2406783716, 513346523,
-            1800256172, 412757495,  3254230097, 3488122537, 2235423725, 3874798389, 3952988713,
-            456031261,  1743881205, 1441850133, 1914458625, 2917378580, 1058623149, 717301031,
-            1017913432, 4251197384, 2605164529, 2381647759, 3173832658, 1801168150, 3376173267,
-            160866008,  1738822693, 518772667,  4089148695, 2390325308, 2657071105, 3738070961,
-            3903473232, 3066863029, 2485447262, 472464751,  1327459217, 2675912059, 835796950,
-            1145735335, 3851502665, 2879960635, 25081924,   1989687528, 1194455782, 407338501,
-            3988100865, 2375465993, 1918562237, 2180720160, 2785125433, 950411179,  3386568730,
-            115913499,  3910202466, 3307600013, 1446256711, 1167026874, 2854659786, 3802270050,
-            3166427346, 1508980463, 1396374457, 1213401634, 2177893087, 1072163606, 3965312370,
-            3891719888, 3677381827, 3715945426, 2815044826, 2396471109, 486581966,  2696836382,
-            3168925510, 3118304313, 3307210608, 4178430275, 139536910,  1616681972, 969962225,
-            4194057033, 614029910,  1851072884, 637477377,  2011817182, 4212294533, 2920009678,
-            84166676,   3317214975, 2499726299, 2818313691, 2146785216, 489787386,  2783898142,
-            717054897,  1406872549, 853712170,  604151480,  2184552409, 121998852,  1614287344,
-            1255153232, 498175845,  948667667,  2555514953, 3076028337, 3175248363, 2038089406,
-            814114941,  868415054,  3795142449, 2376818343, 103480634,  2839801916, 2190577034,
-            1993159070, 1389207182, 660818561,  3110309837, 1776862529, 1358937431, 4219566089,
-            2481478134, 2622401646, 2267157302, 1005803342, 2797171693, 2208846914, 413495297,
-            2291819910, 656568507,  2440475466, 1847825855, 1874113546, 160882175,  1733798909,
-            1947964301, 3741093029, 1083575260, 2219788747, 3312784972, 4099974523, 1278027827,
-            3553094590, 323408412,  1910061239, 3192175262, 941925081,  2886513346, 4199188747,
-            3868849183, 2049974426, 1219489091, 3858172787, 899939912,  3374950347, 2781125033,
-            2960820641, 3044130073, 3932917702, 4089148364, 43303503,   3236204831, 513346523,
-            1800256172, 412757495,  3254230097, 1368046368, 2235423725, 3874798389, 3952988713,
-            456031261,  2198156231, 1441850133, 1914458625, 2917378580, 1058623149, 1219238371,
-            1017913432, 4251197384, 2605164529, 2381647759, 22216546,   1801168150, 3376173267,
-            160866008,  1738822693, 1577173465, 4089148695, 2390325308, 2657071105, 3738070961,
-            423432466,  3066863029, 2485447262, 472464751,  1327459217, 3225045252, 835796950,
-            1145735335, 3851502665, 2879960635, 1948361055, 1989687528, 1194455782, 407338501,
-            3988100865, 559681331,  1918562237, 2180720160, 2785125433, 950411179,  3941349276,
-            115913499,  3910202466, 3307600013, 1446256711, 1762317437, 2854659786, 3802270050,
-            3166427346, 1508980463, 1368201933, 1213401634, 2177893087, 1072163606, 3965312370,
-            584468747,  3677381827, 3715945426, 2815044826, 2396471109, 779752427,  2696836382,
-            3168925510, 3118304313, 3307210608, 852993531,  139536910,  1616681972, 969962225,
-            4194057033, 2200342516, 1851072884, 637477377,  2011817182, 4212294533, 2110390814,
-            84166676,   3317214975, 2499726299, 2818313691, 4127667515, 489787386,  2783898142,
-            717054897,  1406872549, 522141568,  604151480,  2184552409, 121998852,  1614287344,
-            4005935698, 498175845,  948667667,  2555514953, 3076028337, 909435389,  2038089406,
-            814114941,  868415054,  3795142449, 890103872,  103480634,  2839801916, 2190577034,
-            1993159070, 2959447368, 660818561,  3110309837, 1776862529, 1358937431, 404904363,
-            2481478134, 2622401646, 2267157302, 1005803342, 2592983705, 2208846914, 413495297,
-            2291819910, 656568507,  672635776,  1847825855, 1874113546, 160882175,  1733798909,
-            3841759089, 3741093029, 1083575260, 2219788747, 3312784972, 2496136851, 1278027827,
-            3553094590, 323408412,  1910061239, 2401543612, 941925081,  2886513346, 4199188747,
-            3868849183, 2284073714, 1219489091, 3858172787, 899939912,  3374950347, 1388709291,
-            2960820641, 3044130073, 3932917702, 4089148364, 1068401815, 3236204831, 513346523,
-            1800256172, 412757495,  901225648,  1368046368, 2235423725, 3874798389, 3952988713,
-            909312953,  2198156231, 1441850133, 1914458625, 2917378580, 3002712648, 1219238371,
-            1017913432, 4251197384, 2605164529, 1113502070, 22216546,   1801168150, 3376173267,
-            160866008,  2967585919, 1577173465, 4089148695, 2390325308, 2657071105, 2799094984,
-            423432466,  3066863029, 2485447262, 472464751,  3262781362, 3225045252, 835796950,
-            1145735335, 3851502665, 651113893,  1948361055, 1989687528, 1194455782, 407338501,
-            2289495245, 559681331,  1918562237, 2180720160, 2785125433, 1437489554, 3941349276,
-            115913499,  3910202466, 3307600013, 3520844809, 1762317437, 2854659786, 3802270050,
-            3166427346, 3499752858, 1368201933, 1213401634, 2177893087, 1072163606, 4038828731,
-            584468747,  3677381827, 3715945426, 2815044826, 1276793708, 779752427,  2696836382,
-            3168925510, 3118304313, 981001397,  852993531,  139536910,  1616681972, 969962225,
-            1102107358, 2200342516, 1851072884, 637477377,  2011817182, 595268117,  2110390814,
-            84166676,   3317214975, 2499726299, 1483936816, 4127667515, 489787386,  2783898142,
-            717054897,  3243184421, 522141568,  604151480,  2184552409, 121998852,  3033681333,
-            4005935698, 498175845,  948667667,  2555514953, 2244361326, 909435389,  2038089406,
-            814114941,  868415054,  2432492837, 890103872,  103480634,  2839801916, 2190577034,
-            2973290498, 2959447368, 660818561,  3110309837, 1776862529, 2635428191, 404904363,
-            2481478134, 2622401646, 2267157302, 2352127604, 773973090,  3381414823, 711903073,
-            1315179624, 2870013647, 3210172200, 2857832379, 1469429438, 334325102,  3427222834,
-            3410805925, 17315222,   3587409243, 2849888091, 772809669,  2925187732, 3950867413,
-            1253197910, 3498074980, 949923983,  1678113671, 4215798983, 3968904847, 807468032,
-            1011884647, 2065943852, 2457210127, 1307446831, 3690758809, 3824621286, 347635094,
-            2488122129, 4165016523, 1498668926, 344127426,  151685490,  1913180221, 2306144558,
-            392393643,  3552571060, 2808522137, 3151749258, 653974404,  3210547691, 3478642105,
-            2717527392, 980355155,  2746315518, 590213465,  2777247451, 814698278,  3648855491,
-            1266240371, 194638285,  572979751,  3152463952, 3856999112, 4116328489, 1548470545,
-            1097783197, 1295515187, 404545763,  2136174938, 935130034,  1486812000, 412096244,
-            3425606072, 4068528550, 2595930365, 671081397,  2707311366, 2930276072, 3179586934,
-            3085296790, 3684598529, 1599149562, 2078586871, 1613605355, 3000746554, 3166236113,
-            187358985,  2499077294, 3331783380, 382676399,  3872926044, 3447955038, 2288178603,
-            4229888773, 1682891383, 1155251969, 3486282986, 587066440,  1311492423, 3922665665,
-            2717950814, 1351877458, 1834034932, 2512886071, 40909286,   1071963669, 3196204180,
-            540602823,  1369633115, 2118649126, 2130046608, 2936896617, 1922342325, 1900080400,
-            3766074080, 1523326946, 2218478815, 3337651141, 1162272996, 3732809089, 571301270,
-            1816674155, 2965747169, 375890446,  2271603181, 1910327354, 3161230424, 2863293535,
-            4069926831, 325862410,  2648883605, 4091802167, 2741634491, 769171638,  496999781,
-            3834623880, 1880910561, 2347190575, 4217659025, 179503823,  267759651,  1605043582,
-            3371644571, 3036506594, 2116379931, 4006270583, 1796008473, 1563954148, 608357722,
-            348431655,  913450898,  2794373815, 2474846967, 2510936013, 1021978609, 1440533580,
-            3840154702, 1417775366, 1944241031, 3397471306, 3834444008, 2040105399, 1639698460,
-            4065561066, 1847403908,
-        },
-        {
-            4246897171, 2217508286, 4117450683, 4110626546, 3753823387, 3977667932, 623718443,
-            2276396692, 3772091798, 2272323453, 710314822,  3733316262, 1497955597, 700242668,
-            3582720207, 1247731879, 336477088,  532374143,  1123157198, 123828173,  272472192,
-            2142741093, 2557920990, 4209595119, 2807266578, 1516814248, 4250883502, 1967663703,
-            215335417,  1252724071, 4267389372, 94668579,   1980152960, 968677393,  1237744359,
-            63833646,   2488747616, 700459471,  744977323,  40829823,   955400639,  37187948,
-            53133706,   2014551043, 1664982537, 3342787122, 1549278321, 1245110464, 3424539081,
-            2180485253, 2757636973, 3590044052, 2712703548, 1366894959, 1777449151, 1538653374,
-            168718075,  2435805251, 588815465,  3166271130, 3164200096, 417809976,  623036767,
-            340121872,  1792214783, 56330125,   3268029211, 1117100306, 345899179,  1547071836,
-            3657965225, 4109701299, 664937685,  2627187961, 149301108,  1764003230, 3177910586,
-            3081492846, 2295419724, 2553420882, 1506534805, 971284719,  3224921758, 3336906843,
-            1507395478, 1224379418, 4117299702, 1973783225, 3609783242, 4186900040, 3715175536,
-            3904547465, 459692505,  3546328518, 3071448159, 1300375875, 1805392236, 3072717072,
-            99113127,   4281059076, 1658649136, 1974081931, 3940966682, 2092428023, 4014384840,
-            1546542514, 1130620125, 4117533767, 3372991735, 3537429957, 2704347564, 2300583688,
-            915286167,  1553874575, 3466388216, 701000054,  349103195,  1554395274, 3140941933,
-            2874072684, 2630572105, 2794301280, 321399291,  1158058020, 3570908149, 122802750,
-            3012686842, 2588402967, 3420589812, 581016671,  193235885,  1558092297, 1233353728,
-            1080743465, 3292663441, 2188057155, 2715412992, 4274317234, 1657504087, 2554269340,
-            1079741964, 922252155,  569761460,  3215661310, 2450710288, 2491078689, 632504591,
-            2169581755, 2552457727, 2554414735, 3347573916, 681756629,  801451286,  3504956478,
-            1308297539, 3602650700, 3530372129, 4117441036, 1827438812, 2852602217, 570161747,
-            4246897171, 2217508286, 4117450683, 4110626546, 756072139,  3977667932, 623718443,
-            2276396692, 3772091798, 3829898369, 710314822,  3733316262, 1497955597, 700242668,
-            757539371,  1247731879, 336477088,  532374143,  1123157198, 2374238409, 272472192,
-            2142741093, 2557920990, 4209595119, 1632439709, 1516814248, 4250883502, 1967663703,
-            215335417,  1267642920, 4267389372, 94668579,   1980152960, 968677393,  2252616933,
-            63833646,   2488747616, 700459471,  744977323,  2711054317, 955400639,  37187948,
-            53133706,   2014551043, 1664498234, 3342787122, 1549278321, 1245110464, 3424539081,
-            496150741,  2757636973, 3590044052, 2712703548, 1366894959, 2066534443, 1538653374,
-            168718075,  2435805251, 588815465,  318307195,  3164200096, 417809976,  623036767,
-            340121872,  3426055217, 56330125,   3268029211, 1117100306, 345899179,  979486044,
-            3657965225, 4109701299, 664937685,  2627187961, 2747102301, 1764003230, 3177910586,
-            3081492846, 2295419724, 1088606857, 1506534805, 971284719,  3224921758, 3336906843,
-            984983218,  1224379418, 4117299702, 1973783225, 3609783242, 1044785427, 3715175536,
-            3904547465, 459692505,  3546328518, 2096978494, 1300375875, 1805392236, 3072717072,
-            99113127,   972796497,  1658649136, 1974081931, 3940966682, 2092428023, 2914458983,
-            1546542514, 1130620125, 4117533767, 3372991735, 947968718,  2704347564, 2300583688,
-            915286167,  1553874575, 2124709798, 701000054,  349103195,  1554395274, 3140941933,
-            2569019225, 2630572105, 2794301280, 321399291,  1158058020, 4051601694, 122802750,
-            3012686842, 2588402967, 3420589812, 1738150581, 193235885,  1558092297, 1233353728,
-            1080743465, 1527068788, 2188057155, 2715412992, 4274317234, 1657504087, 1543089352,
-            1079741964, 922252155,  569761460,  3215661310, 2869922986, 2491078689, 632504591,
-            2169581755, 2552457727, 2807462748, 3347573916, 681756629,  801451286,  3504956478,
-            3400676931, 3602650700, 3530372129, 4117441036, 1827438812, 4056234054, 570161747,
-            4246897171, 2217508286, 4117450683, 3321376103, 756072139,  3977667932, 623718443,
-            2276396692, 1340008665, 3829898369, 710314822,  3733316262, 1497955597, 2098292377,
-            757539371,  1247731879, 336477088,  532374143,  2210327641, 2374238409, 272472192,
-            2142741093, 2557920990, 3502520226, 1632439709, 1516814248, 4250883502, 1967663703,
-            499168780,  1267642920, 4267389372, 94668579,   1980152960, 2695928666, 2252616933,
-            63833646,   2488747616, 700459471,  4181471443, 2711054317, 955400639,  37187948,
-            53133706,   441944403,  1664498234, 3342787122, 1549278321, 1245110464, 2271611585,
-            496150741,  2757636973, 3590044052, 2712703548, 3009817799, 2066534443, 1538653374,
-            168718075,  2435805251, 734763537,  318307195,  3164200096, 417809976,  623036767,
-            4002728646, 3426055217, 56330125,   3268029211, 1117100306, 1435987728, 979486044,
-            3657965225, 4109701299, 664937685,  815527474,  2747102301, 1764003230, 3177910586,
-            3081492846, 63383766,   1088606857, 1506534805, 971284719,  3224921758, 2331024939,
-            984983218,  1224379418, 4117299702, 1973783225, 3998070267, 1044785427, 3715175536,
-            3904547465, 459692505,  2582830990, 2096978494, 1300375875, 1805392236, 3072717072,
-            321154403,  972796497,  1658649136, 1974081931, 3940966682, 3789726976, 2914458983,
-            1546542514, 1130620125, 4117533767, 3440681546, 947968718,  2704347564, 2300583688,
-            915286167,  474021937,  2124709798, 701000054,  349103195,  1554395274, 702752814,
-            2569019225, 2630572105, 2794301280, 321399291,  2406346046, 4051601694, 122802750,
-            3012686842, 2588402967, 1782259321, 1738150581, 193235885,  1558092297, 1233353728,
-            3935919190, 1527068788, 2188057155, 2715412992, 4274317234, 1722541048, 1543089352,
-            1079741964, 922252155,  569761460,  3384000986, 2869922986, 2491078689, 632504591,
-            2169581755, 3451609034, 2807462748, 3347573916, 681756629,  801451286,  2643408064,
-            3400676931, 3602650700, 3530372129, 4117441036, 3635077251, 4056234054, 570161747,
-            4246897171, 2217508286, 2364796923, 3321376103, 756072139,  3977667932, 623718443,
-            3792539489, 1340008665, 3829898369, 710314822,  3733316262, 876419217,  2098292377,
-            757539371,  1247731879, 336477088,  3307300788, 2210327641, 2374238409, 272472192,
-            2142741093, 4142392723, 3502520226, 1632439709, 1516814248, 4250883502, 3551852862,
-            499168780,  1267642920, 4267389372, 94668579,   1177286958, 2695928666, 2252616933,
-            63833646,   2488747616, 3571573975, 4181471443, 2711054317, 955400639,  37187948,
-            1485050393, 441944403,  1664498234, 3342787122, 1549278321, 518707274,  2271611585,
-            496150741,  2757636973, 3590044052, 305206687,  3009817799, 2066534443, 1538653374,
-            168718075,  1914032206, 734763537,  318307195,  3164200096, 417809976,  2062496275,
-            4002728646, 3426055217, 56330125,   3268029211, 1878869053, 1435987728, 979486044,
-            3657965225, 4109701299, 1558853775, 815527474,  2747102301, 1764003230, 3177910586,
-            681877401,  63383766,   1088606857, 1506534805, 971284719,  2546285777, 2331024939,
-            984983218,  1224379418, 4117299702, 539292757,  3998070267, 1044785427, 3715175536,
-            3904547465, 3854154565, 2582830990, 2096978494, 1300375875, 1805392236, 2586804198,
-            321154403,  972796497,  1658649136, 1974081931, 1718873863, 3789726976, 2914458983,
-            1546542514, 1130620125, 477866180,  3440681546, 947968718,  2704347564, 2300583688,
-            56071603,   474021937,  2124709798, 701000054,  349103195,  2431577249, 702752814,
-            2569019225, 2630572105, 2794301280, 211758134,  2406346046, 4051601694, 122802750,
-            3012686842, 2470642374, 1782259321, 1738150581, 193235885,  1558092297, 852353933,
-            3935919190, 1527068788, 2188057155, 2715412992, 543290606,  1722541048, 1543089352,
-            1079741964, 922252155,  1146820965, 3384000986, 2869922986, 2491078689, 632504591,
-            2936494996, 3451609034, 2807462748, 3347573916, 681756629,  3428474076, 2643408064,
-            3400676931, 3602650700, 3530372129, 3558016488, 304167301,  3073812276, 1253385329,
-            801639697,  1346336854, 3880416830, 1110804934, 2500585706, 1294233475, 1964132477,
-            1625651370, 2732590160, 310054807,  3350133555, 800839525,  3435579932, 2120216654,
-            407780291,  1228117799, 513334510,  1423091447, 3698882838, 2556406643, 1536483608,
-            998695315,  1619514015, 4197375975, 892985909,  993665758,  4160405430, 2379977763,
-            1423742790, 4286808034, 479280944,  3611297256, 3481820363, 1261889958, 455298115,
-            3955764756, 2406161837, 185873336,  3382956716, 3556168427, 3988426650, 2917586591,
-            1248672474, 2925146191, 1416331075, 290755159,  2845168299, 3301422441, 3771816588,
-            491352430,  2461746382, 1591975949, 604909111,  3595669760, 4079314041, 258321046,
-            1352583874, 999018951,  3150079914, 113122510,  743303046,  3205496412, 4267738054,
-            2567402806, 2181107494, 3266354249, 1941487496, 2742084900, 3758785335, 732694221,
-            2052988791, 1759288229, 1094292464, 1582835026, 2817864273, 666443657,  419482443,
-            2877435004, 2944696351, 2523539432, 301119182,  998264713,  2314419254, 3610447393,
-            1139414242, 1486351830, 3207929489, 384633091,  4056367270, 2348418835, 3773781885,
-            1963929818, 804929680,  1511023454, 3915948102, 1371942526, 2586212526, 130122933,
-            2030859646, 3730011315, 118408868,  632704878,  3559959612, 2926361713, 1401386286,
-            599210027,  2315051975, 157809758,  1148939942, 3060024350, 1464284678, 3209480975,
-            3961060416, 3481639206, 4113344379, 3475766200, 130581501,  1844026536, 2661594012,
-            3145812007, 3233175620, 2549419093, 2612966733, 1348260920, 740167863,  226231218,
-            2631972701, 2148020402, 3399479414, 1074946996, 30872114,   1342415612, 1071408471,
-            1141719547, 332346805,  1473336719, 4207932404, 3668838170, 3154502882, 3892070442,
-            2812790310, 13931822,   1150258251, 2369539473, 640926011,  2991135002, 2410382633,
-            548200125,  3977740663, 1245837867, 2378569399, 1561469990, 2437445882, 214387770,
-            3329587833, 281635893,
-        },
-        {
-            2304378727, 3128535035, 108925108,  2162761364, 441680245,  252515491,  300463457,
-            1342673919, 133896106,  699266199,  2941379597, 469766740,  510902464,  2161586218,
-            1302026779, 522869562,  3514972873, 690549365,  344988313,  2449894172, 3972046846,
-            708369721,  596552189,  11706341,   2310165560, 2004490448, 4005075035, 4282587249,
-            1459894110, 2491077832, 2816408681, 712136135,  3023344510, 1392750148, 1645718097,
-            2695500637, 1877280603, 2623815015, 381581429,  1525797814, 1678453626, 3807901907,
-            2240972801, 2565814681, 3371545498, 1252883128, 3179614260, 2657843491, 2265245725,
-            3675181009, 405021086,  3080210546, 2633628523, 1070969654, 802097311,  179367979,
-            1541357642, 104918972,  3032298728, 580476768,  4257624757, 57403538,   603600570,
-            179219194,  563324346,  3496225250, 2798719933, 1955310279, 1325996197, 3469668907,
-            1426813516, 3883868043, 1870449996, 2282835659, 3803542412, 680368099,  2862932662,
-            2356790618, 4178396673, 2488220635, 2605298353, 3890866868, 3093542945, 2122270289,
-            1641304938, 1108662440, 2743502289, 1162298756, 3597663421, 2993807150, 175348927,
-            447399678,  2096536655, 616548332,  3148428633, 1901997877, 1872351523, 3554881900,
-            3476676282, 363582817,  808920370,  4029240097, 279089651,  2593304658, 2134039345,
-            2434642700, 2444205155, 3980190688, 1015424354, 722247715,  2886521056, 2384733292,
-            1291287244, 1367660488, 30539955,   1775251359, 354249,     1562390687, 2828419308,
-            3836343560, 3995940952, 703924969,  2642387356, 124671052,  1835377190, 310555474,
-            814913694,  988774939,  1446469132, 324864906,  3096792014, 1222449412, 959387147,
-            2491592024, 4039528217, 3173398156, 1213072963, 2171061839, 3074243051, 1688160291,
-            3559266752, 1147790429, 3148470672, 455955070,  2445528263, 2432561344, 2787137494,
-            67920614,   502308479,  576485233,  3606646549, 500952241,  196615673,  362096253,
-            1319644319, 1567226517, 3461768813, 2912361862, 3095625290, 1012111505, 2773211980,
-            2304378727, 3128535035, 108925108,  2162761364, 1065219574, 252515491,  300463457,
-            1342673919, 133896106,  1430531238, 2941379597, 469766740,  510902464,  2161586218,
-            1363002985, 522869562,  3514972873, 690549365,  344988313,  2871793353, 3972046846,
-            708369721,  596552189,  11706341,   3199864386, 2004490448, 4005075035, 4282587249,
-            1459894110, 13751657,   2816408681, 712136135,  3023344510, 1392750148, 461798081,
-            2695500637, 1877280603, 2623815015, 381581429,  1562328769, 1678453626, 3807901907,
-            2240972801, 2565814681, 486322576,  1252883128, 3179614260, 2657843491, 2265245725,
-            1231473401, 405021086,  3080210546, 2633628523, 1070969654, 2425270474, 179367979,
-            1541357642, 104918972,  3032298728, 2856183338, 4257624757, 57403538,   603600570,
-            179219194,  647484680,  3496225250, 2798719933, 1955310279, 1325996197, 1267504603,
-            1426813516, 3883868043, 1870449996, 2282835659, 2302499922, 680368099,  2862932662,
-            2356790618, 4178396673, 1180549089, 2605298353, 3890866868, 3093542945, 2122270289,
-            30790401,   1108662440, 2743502289, 1162298756, 3597663421, 2519545411, 175348927,
-            447399678,  2096536655, 616548332,  523730910,  1901997877, 1872351523, 3554881900,
-            3476676282, 4207661483, 808920370,  4029240097, 279089651,  2593304658, 2434770713,
-            2434642700, 2444205155, 3980190688, 1015424354, 895406625,  2886521056, 2384733292,
-            1291287244, 1367660488, 2589908656, 1775251359, 354249,     1562390687, 2828419308,
-            3307022215, 3995940952, 703924969,  2642387356, 124671052,  456888066,  310555474,
-            814913694,  988774939,  1446469132, 484621772,  3096792014, 1222449412, 959387147,
-            2491592024, 3004551541, 3173398156, 1213072963, 2171061839, 3074243051, 3756911673,
-            3559266752, 1147790429, 3148470672, 455955070,  2155611272, 2432561344, 2787137494,
-            67920614,   502308479,  3447443672, 3606646549, 500952241,  196615673,  362096253,
-            3386323595, 1567226517, 3461768813, 2912361862, 3095625290, 2162688981, 2773211980,
-            2304378727, 3128535035, 108925108,  1039955068, 1065219574, 252515491,  300463457,
-            1342673919, 3966536146, 1430531238, 2941379597, 469766740,  510902464,  2078842351,
-            1363002985, 522869562,  3514972873, 690549365,  195343818,  2871793353, 3972046846,
-            708369721,  596552189,  982392814,  3199864386, 2004490448, 4005075035, 4282587249,
-            2095997383, 13751657,   2816408681, 712136135,  3023344510, 906628530,  461798081,
-            2695500637, 1877280603, 2623815015, 4243642677, 1562328769, 1678453626, 3807901907,
-            2240972801, 2291348066, 486322576,  1252883128, 3179614260, 2657843491, 797826332,
-            1231473401, 405021086,  3080210546, 2633628523, 2545857370, 2425270474, 179367979,
-            1541357642, 104918972,  237257258,  2856183338, 4257624757, 57403538,   603600570,
-            656410637,  647484680,  3496225250, 2798719933, 1955310279, 3229552283, 1267504603,
-            1426813516, 3883868043, 1870449996, 1927306100, 2302499922, 680368099,  2862932662,
-            2356790618, 858320853,  1180549089, 2605298353, 3890866868, 3093542945, 1460262329,
-            30790401,   1108662440, 2743502289, 1162298756, 1758804929, 2519545411, 175348927,
-            447399678,  2096536655, 407511234,  523730910,  1901997877, 1872351523, 3554881900,
-            1718358515, 4207661483, 808920370,  4029240097, 279089651,  29133517,   2434770713,
-            2434642700, 2444205155, 3980190688, 2496659301, 895406625,  2886521056, 2384733292,
-            1291287244, 3611549524, 2589908656, 1775251359, 354249,     1562390687, 920722624,
-            3307022215, 3995940952, 703924969,  2642387356, 1423249585, 456888066,  310555474,
-            814913694,  988774939,  3718475220, 484621772,  3096792014, 1222449412, 959387147,
-            428001039,  3004551541, 3173398156, 1213072963, 2171061839, 188307528,  3756911673,
-            3559266752, 1147790429, 3148470672, 960997305,  2155611272, 2432561344, 2787137494,
-            67920614,   2088428890, 3447443672, 3606646549, 500952241,  196615673,  1344872751,
-            3386323595, 1567226517, 3461768813, 2912361862, 194027451,  2162688981, 2773211980,
-            2304378727, 3128535035, 1003896930, 1039955068, 1065219574, 252515491,  300463457,
-            1424716047, 3966536146, 1430531238, 2941379597, 469766740,  1286351237, 2078842351,
-            1363002985, 522869562,  3514972873, 3034502927, 195343818,  2871793353, 3972046846,
-            708369721,  1205339026, 982392814,  3199864386, 2004490448, 4005075035, 332688646,
-            2095997383, 13751657,   2816408681, 712136135,  3373021008, 906628530,  461798081,
-            2695500637, 1877280603, 895361970,  4243642677, 1562328769, 1678453626, 3807901907,
-            2341003684, 2291348066, 486322576,  1252883128, 3179614260, 4075130860, 797826332,
-            1231473401, 405021086,  3080210546, 2150490472, 2545857370, 2425270474, 179367979,
-            1541357642, 242991712,  237257258,  2856183338, 4257624757, 57403538,   3150682232,
-            656410637,  647484680,  3496225250, 2798719933, 1145145307, 3229552283, 1267504603,
-            1426813516, 3883868043, 1666763258, 1927306100, 2302499922, 680368099,  2862932662,
-            3583385750, 858320853,  1180549089, 2605298353, 3890866868, 1563193091, 1460262329,
-            30790401,   1108662440, 2743502289, 2626476633, 1758804929, 2519545411, 175348927,
-            447399678,  4233030417, 407511234,  523730910,  1901997877, 1872351523, 2173819341,
-            1718358515, 4207661483, 808920370,  4029240097, 674046142,  29133517,   2434770713,
-            2434642700, 2444205155, 435418495,  2496659301, 895406625,  2886521056, 2384733292,
-            977357736,  3611549524, 2589908656, 1775251359, 354249,     519360380,  920722624,
-            3307022215, 3995940952, 703924969,  3450158723, 1423249585, 456888066,  310555474,
-            814913694,  1162737412, 3718475220, 484621772,  3096792014, 1222449412, 4197836101,
-            428001039,  3004551541, 3173398156, 1213072963, 1973586595, 188307528,  3756911673,
-            3559266752, 1147790429, 2575736768, 960997305,  2155611272, 2432561344, 2787137494,
-            1379562741, 2088428890, 3447443672, 3606646549, 500952241,  2826801374, 1344872751,
-            3386323595, 1567226517, 3461768813, 25513703,   3323115302, 3081974112, 822931967,
-            1455896160, 3153914140, 3228346258, 928657396,  727675018,  347679623,  2853461117,
-            2422944877, 815872094,  49447965,   2996397309, 208529874,  2288444441, 815732448,
-            1429888883, 3913754019, 3423037050, 4048127379, 603200467,  4002529528, 3559319065,
-            1078333164, 3402300442, 595110536,  820727726,  3850270972, 1855199519, 1285981665,
-            1729597669, 523896045,  3022356514, 3366397006, 3272699670, 882413562,  2740396522,
-            1416352787, 2307929318, 3642305418, 1716112866, 3598170399, 1767734405, 3444896100,
-            3543943548, 2905205604, 2733584258, 1235714146, 837218808,  1465873603, 2029797729,
-            214005926,  4151932431, 3267001352, 3246648670, 2353648849, 1469507236, 650867084,
-            1708604638, 1134575453, 3978381884, 3676434144, 2335996642, 2514508220, 4136013946,
-            322598262,  2716194136, 637485395,  2489060055, 3074238,    1029436222, 3818663735,
-            2259615240, 2199154750, 3665070805, 1263633087, 2079155971, 559250836,  671924707,
-            2695182155, 2621260534, 2916853431, 894128777,  3635237310, 3265064193, 2487776550,
-            1417592297, 680384248,  3493029298, 4245296411, 2504739282, 809083763,  1582163885,
-            976761617,  3821359902, 3112286702, 1916112244, 1535152037, 1564464702, 263232104,
-            2008767392, 64571023,   3578581129, 1193137084, 31280542,   3252886478, 1055372217,
-            416408610,  2981473008, 9725704,    861920482,  1678235745, 3526654284, 632523550,
-            1108265522, 3565374276, 1491807716, 2320198412, 3541996955, 510119995,  2393492612,
-            3869422388, 2054438754, 1861074588, 3246578845, 1847267182, 3073107095, 3890100150,
-            2832349319, 2802074767, 1644615330, 440365517,  185266296,  1576798852, 1104043554,
-            372684816,  3144706423, 3520228706, 3549268700, 2788098175, 2903922743, 1929098254,
-            2799545806, 1657429122, 4216111938, 3255526651, 1115119731, 3532296371, 1251707660,
-            413270009,  1692080803, 2845887099, 2136589678, 3859263971, 1316626749, 508755986,
-            3615765145, 2330839052,
-        },
-        {
-            1720103319, 2201367526, 1415072072, 2446588589, 2195586017, 3817930623, 653121934,
-            2766514657, 765921436,  630082485,  2990883045, 3304472999, 471385134,  4097977544,
-            3749829028, 3587534772, 1064359851, 800061060,  2844220510, 389838005,  3681318140,
-            1515923235, 1885079324, 713031018,  1962734763, 2288160004, 1983331336, 1247350521,
-            4208372034, 1444837930, 3549494305, 4169715512, 701313302,  1118275019, 3118975645,
-            4153969630, 3516491181, 3601057044, 2509222288, 223064937,  899123842,  2574531231,
-            1386928111, 3790651401, 1300768348, 2038833061, 3736517792, 3850203561, 1679542285,
-            3391273474, 3862995487, 3118056386, 47128429,   2977525950, 3236389548, 1937040839,
-            4223233198, 2105119262, 721111284,  331726226,  68419013,   2575393464, 3648293304,
-            1448878851, 4186783614, 3696899986, 1270877069, 3351263117, 3918639273, 1472902162,
-            2767482392, 3549853842, 2353191576, 3353325530, 3072485271, 2689121900, 2335686695,
-            246689858,  2946177636, 1677728066, 1455723263, 3447540996, 2143976172, 1779511280,
-            3667361203, 1575502035, 849872082,  3527265600, 1443266215, 1320668722, 458373857,
-            3862342513, 699597603,  685707268,  948502001,  2501058653, 2254562046, 2210683894,
-            29088679,   1456231200, 2764392560, 4138068372, 3094591474, 1093749152, 1668875176,
-            3133003149, 4128702884, 652852832,  2211671337, 2231125160, 131729558,  3845605816,
-            3769660625, 1696592453, 728353643,  2751201502, 3496971733, 3349166522, 1005919830,
-            3411089601, 3754493523, 1994945529, 1604309774, 2083609686, 833983349,  2600153513,
-            1677348112, 207321473,  1051990507, 2135039620, 4239461390, 1574144998, 1070761856,
-            1990807569, 112704720,  2506523299, 2827487353, 4130754901, 1943274185, 3913701053,
-            1014850621, 3662772872, 4115124063, 1760146762, 3254829227, 800302547,  3602066837,
-            975658158,  2880018391, 714134831,  2696483406, 2351365577, 2811011071, 3505407160,
-            54109504,   424967367,  3759525737, 1726627246, 1110539071, 2339755764, 3356877114,
-            1720103319, 2201367526, 1415072072, 2446588589, 2499136377, 3817930623, 653121934,
-            2766514657, 765921436,  3794433488, 2990883045, 3304472999, 471385134,  4097977544,
-            3618516788, 3587534772, 1064359851, 800061060,  2844220510, 2319780070, 3681318140,
-            1515923235, 1885079324, 713031018,  11705290,   2288160004, 1983331336, 1247350521,
-            4208372034, 2508892029, 3549494305, 4169715512, 701313302,  1118275019, 1430522809,
-            4153969630, 3516491181, 3601057044, 2509222288, 1917025539, 899123842,  2574531231,
-            1386928111, 3790651401, 1219040401, 2038833061, 3736517792, 3850203561, 1679542285,
-            671522957,  3862995487, 3118056386, 47128429,   2977525950, 2762831063, 1937040839,
-            4223233198, 2105119262, 721111284,  1386688457, 68419013,   2575393464, 3648293304,
-            1448878851, 466405406,  3696899986, 1270877069, 3351263117, 3918639273, 94103836,
-            2767482392, 3549853842, 2353191576, 3353325530, 349361794,  2689121900, 2335686695,
-            246689858,  2946177636, 3232050945, 1455723263, 3447540996, 2143976172, 1779511280,
-            542837628,  1575502035, 849872082,  3527265600, 1443266215, 1867394883, 458373857,
-            3862342513, 699597603,  685707268,  4210562190, 2501058653, 2254562046, 2210683894,
-            29088679,   3647972960, 2764392560, 4138068372, 3094591474, 1093749152, 312511475,
-            3133003149, 4128702884, 652852832,  2211671337, 145492343,  131729558,  3845605816,
-            3769660625, 1696592453, 4223421915, 2751201502, 3496971733, 3349166522, 1005919830,
-            1656802049, 3754493523, 1994945529, 1604309774, 2083609686, 3032348100, 2600153513,
-            1677348112, 207321473,  1051990507, 3349078950, 4239461390, 1574144998, 1070761856,
-            1990807569, 2970449178, 2506523299, 2827487353, 4130754901, 1943274185, 445467699,
-            1014850621, 3662772872, 4115124063, 1760146762, 3738518624, 800302547,  3602066837,
-            975658158,  2880018391, 1553758240, 2696483406, 2351365577, 2811011071, 3505407160,
-            1259180427, 424967367,  3759525737, 1726627246, 1110539071, 2863575420, 3356877114,
-            1720103319, 2201367526, 1415072072, 1463388387, 2499136377, 3817930623, 653121934,
-            2766514657, 526940162,  3794433488, 2990883045, 3304472999, 471385134,  594057325,
-            3618516788, 3587534772, 1064359851, 800061060,  1001523010, 2319780070, 3681318140,
-            1515923235, 1885079324, 255576756,  11705290,   2288160004, 1983331336, 1247350521,
-            1108575113, 2508892029, 3549494305, 4169715512, 701313302,  524281295,  1430522809,
-            4153969630, 3516491181, 3601057044, 1816283752, 1917025539, 899123842,  2574531231,
-            1386928111, 1530966640, 1219040401, 2038833061, 3736517792, 3850203561, 1855689726,
-            671522957,  3862995487, 3118056386, 47128429,   1718476461, 2762831063, 1937040839,
-            4223233198, 2105119262, 176166283,  1386688457, 68419013,   2575393464, 3648293304,
-            4069820559, 466405406,  3696899986, 1270877069, 3351263117, 1645545933, 94103836,
-            2767482392, 3549853842, 2353191576, 4163887784, 349361794,  2689121900, 2335686695,
-            246689858,  1246040634, 3232050945, 1455723263, 3447540996, 2143976172, 2111249329,
-            542837628,  1575502035, 849872082,  3527265600, 1836050084, 1867394883, 458373857,
-            3862342513, 699597603,  3139537113, 4210562190, 2501058653, 2254562046, 2210683894,
-            3997617191, 3647972960, 2764392560, 4138068372, 3094591474, 2664795910, 312511475,
-            3133003149, 4128702884, 652852832,  1658020144, 145492343,  131729558,  3845605816,
-            3769660625, 2822578949, 4223421915, 2751201502, 3496971733, 3349166522, 1582873482,
-            1656802049, 3754493523, 1994945529, 1604309774, 1113569720, 3032348100, 2600153513,
-            1677348112, 207321473,  3169983987, 3349078950, 4239461390, 1574144998, 1070761856,
-            1308776367, 2970449178, 2506523299, 2827487353, 4130754901, 1403493846, 445467699,
-            1014850621, 3662772872, 4115124063, 340210579,  3738518624, 800302547,  3602066837,
-            975658158,  3367770843, 1553758240, 2696483406, 2351365577, 2811011071, 4162875353,
-            1259180427, 424967367,  3759525737, 1726627246, 1341806135, 2863575420, 3356877114,
-            1720103319, 2201367526, 2232383995, 1463388387, 2499136377, 3817930623, 653121934,
-            1756183481, 526940162,  3794433488, 2990883045, 3304472999, 2185125572, 594057325,
-            3618516788, 3587534772, 1064359851, 2933544964, 1001523010, 2319780070, 3681318140,
-            1515923235, 4147783641, 255576756,  11705290,   2288160004, 1983331336, 956739400,
-            1108575113, 2508892029, 3549494305, 4169715512, 142273913,  524281295,  1430522809,
-            4153969630, 3516491181, 986032639,  1816283752, 1917025539, 899123842,  2574531231,
-            1508271110, 1530966640, 1219040401, 2038833061, 3736517792, 458417668,  1855689726,
-            671522957,  3862995487, 3118056386, 284266432,  1718476461, 2762831063, 1937040839,
-            4223233198, 1605514069, 176166283,  1386688457, 68419013,   2575393464, 3650747541,
-            4069820559, 466405406,  3696899986, 1270877069, 678590674,  1645545933, 94103836,
-            2767482392, 3549853842, 398179945,  4163887784, 349361794,  2689121900, 2335686695,
-            3853658293, 1246040634, 3232050945, 1455723263, 3447540996, 2657693810, 2111249329,
-            542837628,  1575502035, 849872082,  2061659800, 1836050084, 1867394883, 458373857,
-            3862342513, 730568629,  3139537113, 4210562190, 2501058653, 2254562046, 449510786,
-            3997617191, 3647972960, 2764392560, 4138068372, 1939679536, 2664795910, 312511475,
-            3133003149, 4128702884, 4057510355, 1658020144, 145492343,  131729558,  3845605816,
-            3235632110, 2822578949, 4223421915, 2751201502, 3496971733, 4258920219, 1582873482,
-            1656802049, 3754493523, 1994945529, 1073499993, 1113569720, 3032348100, 2600153513,
-            1677348112, 3152835240, 3169983987, 3349078950, 4239461390, 1574144998, 2548972357,
-            1308776367, 2970449178, 2506523299, 2827487353, 2908066033, 1403493846, 445467699,
-            1014850621, 3662772872, 1685925089, 340210579,  3738518624, 800302547,  3602066837,
-            2264692610, 3367770843, 1553758240, 2696483406, 2351365577, 1686022564, 4162875353,
-            1259180427, 424967367,  3759525737, 70326173,   3028074555, 2568586198, 2513473964,
-            2923109510, 2265392251, 3760490867, 147487099,  386755149,  2152759137, 2716532213,
-            1153507474, 627929575,  847454712,  2426916452, 3861548980, 209825268,  1090299778,
-            1876886461, 976019203,  4290216337, 2278290065, 3302814528, 1567440061, 1874857224,
-            3794588915, 3218569451, 2335365199, 1959651923, 3366000689, 2374428382, 2126784887,
-            4123272655, 274837369,  1413111935, 1754627204, 1863684635, 4170025739, 2150019850,
-            4250751856, 3601214212, 2024081043, 334808859,  3921757513, 3870643644, 2864810945,
-            1004431888, 4283279830, 873365350,  2479791433, 3393478881, 3373502257, 1882140107,
-            2546676519, 1208428915, 268043238,  2292710623, 770651064,  2330160036, 2476488258,
-            2496037992, 118721504,  2289499985, 987994743,  3610346256, 3371795927, 2681434550,
-            2213200417, 3729194378, 1657623395, 402983380,  3618058500, 3487743585, 965523531,
-            819256729,  2544660729, 3273986506, 60894411,   1779152929, 3598159279, 3429317853,
-            2246402362, 3761392367, 3921798306, 947928110,  2394097908, 4004330264, 1180759989,
-            1624349051, 1750929499, 3889184770, 2052097704, 4092981046, 2913733578, 4241980897,
-            1127407450, 950788009,  2105033320, 473205730,  981905310,  2888856914, 798112239,
-            3377889612, 2273659507, 1157471194, 4269212574, 3575306012, 116024754,  1432668659,
-            1079598649, 3882002482, 3838480186, 823643071,  1244220618, 1227720039, 1343395654,
-            4277277976, 2612321540, 3013674017, 3658064522, 2573775167, 142767236,  2545708383,
-            1740478937, 809036862,  1492188594, 1294286248, 1093543858, 2944418375, 2981996479,
-            4067464923, 3071157685, 1938984450, 81707323,   337713546,  1849381296, 3447450393,
-            3551106302, 3394545269, 3167744716, 1815294624, 3244728913, 2462138247, 2286711732,
-            3023116169, 707366723,  1314169762, 1511231537, 2227622993, 2876600706, 4271030726,
-            2020521540, 2966596767, 3964589247, 1291306737, 883851756,  1355819080, 2834319249,
-            3825063450, 4205423325,
-        },
-        {
-            3976274565, 2448396792, 968752640,  3470180681, 317418372,  3413117342, 1237153991,
-            433353267,  3822915236, 1875408576, 1233442549, 3075975602, 2746050447, 3009199286,
-            1576218584, 3601624212, 3382766896, 3794396674, 3357184859, 3771889254, 2024944898,
-            1641420125, 1779371044, 3350737953, 1025272171, 2709869134, 2825215546, 4223585211,
-            2331562313, 4221415366, 2674109705, 1855052803, 3274200420, 1670438102, 2319796514,
-            1867612594, 3806110719, 3553481300, 3605015115, 79984718,   1941168042, 3399066781,
-            3802959582, 708476642,  1014661979, 2241888226, 1143677384, 2278499746, 2797471775,
-            3004060118, 2014331440, 215569666,  1133648437, 4257239790, 1151079178, 144466626,
-            4172535331, 2931920884, 483291105,  4090300381, 1571896752, 298343424,  195633990,
-            1810683018, 1885913475, 1686771687, 2915510569, 562489473,  414581189,  1022353028,
-            501944965,  1956136859, 2519187274, 3668220292, 1700939742, 2518511591, 160763373,
-            1172666820, 2152495177, 2340458982, 559050643,  486154020,  3032503067, 766663625,
-            2421982705, 2529734653, 2510737288, 1481478895, 4171110179, 1682441330, 2655739635,
-            4245704787, 2065626682, 3007926534, 3411759289, 533508412,  3042382008, 981968356,
-            2682799253, 2726905684, 4125792373, 106846570,  1704971534, 1560415554, 1118830213,
-            313111104,  3926105325, 1637147805, 1164562135, 784546396,  3352123464, 1766592096,
-            1633362391, 1026100081, 1237499872, 1811922956, 2253386462, 2963395154, 3455203828,
-            3799059090, 1142949128, 3505080279, 3951858450, 1007490656, 361459474,  1934242405,
-            1787243636, 777363948,  58489380,   3916760561, 3935783645, 1169749593, 2004603534,
-            135117029,  3440926367, 1147451469, 1862526958, 1384747257, 2227484113, 1319884349,
-            2032411450, 901622061,  2000545141, 3461022503, 1016484567, 2928443675, 3310762650,
-            1923194476, 1076722996, 2449154472, 152147517,  3717282337, 1080031672, 2270485155,
-            944473267,  1207921658, 45646141,   1508160827, 3426539245, 2980461309, 3647607203,
-            3976274565, 2448396792, 968752640,  3470180681, 3211129520, 3413117342, 1237153991,
-            433353267,  3822915236, 2454701666, 1233442549, 3075975602, 2746050447, 3009199286,
-            2038393545, 3601624212, 3382766896, 3794396674, 3357184859, 2860355949, 2024944898,
-            1641420125, 1779371044, 3350737953, 2446532206, 2709869134, 2825215546, 4223585211,
-            2331562313, 2500498266, 2674109705, 1855052803, 3274200420, 1670438102, 3132218179,
-            1867612594, 3806110719, 3553481300, 3605015115, 1887595411, 1941168042, 3399066781,
-            3802959582, 708476642,  580192953,  2241888226, 1143677384, 2278499746, 2797471775,
-            3852526181, 2014331440, 215569666,  1133648437, 4257239790, 3561970479, 144466626,
-            4172535331, 2931920884, 483291105,  2083890054, 1571896752, 298343424,  195633990,
-            1810683018, 2079085580, 1686771687, 2915510569, 562489473,  414581189,  256992455,
-            501944965,  1956136859, 2519187274, 3668220292, 67574801,   2518511591, 160763373,
-            1172666820, 2152495177, 3835593184, 559050643,  486154020,  3032503067, 766663625,
-            254028364,  2529734653, 2510737288, 1481478895, 4171110179, 906127931,  2655739635,
-            4245704787, 2065626682, 3007926534, 2558774105, 533508412,  3042382008, 981968356,
-            2682799253, 1362538779, 4125792373, 106846570,  1704971534, 1560415554, 3692557790,
-            313111104,  3926105325, 1637147805, 1164562135, 2104754483, 3352123464, 1766592096,
-            1633362391, 1026100081, 2360560002, 1811922956, 2253386462, 2963395154, 3455203828,
-            2258058200, 1142949128, 3505080279, 3951858450, 1007490656, 2426210620, 1934242405,
-            1787243636, 777363948,  58489380,   815626631,  3935783645, 1169749593, 2004603534,
-            135117029,  1691776954, 1147451469, 1862526958, 1384747257, 2227484113, 3263541760,
-            2032411450, 901622061,  2000545141, 3461022503, 1489789498, 2928443675, 3310762650,
-            1923194476, 1076722996, 2656584490, 152147517,  3717282337, 1080031672, 2270485155,
-            3138309376, 1207921658, 45646141,   1508160827, 3426539245, 797942355,  3647607203,
-            3976274565, 2448396792, 968752640,  687540401,  3211129520, 3413117342, 1237153991,
-            433353267,  3534826412, 2454701666, 1233442549, 3075975602, 2746050447, 102502163,
-            2038393545, 3601624212, 3382766896, 3794396674, 94931715,   2860355949, 2024944898,
-            1641420125, 1779371044, 2652772711, 2446532206, 2709869134, 2825215546, 4223585211,
-            1797497383, 2500498266, 2674109705, 1855052803, 3274200420, 331326404,  3132218179,
-            1867612594, 3806110719, 3553481300, 1299083119, 1887595411, 1941168042, 3399066781,
-            3802959582, 4140678646, 580192953,  2241888226, 1143677384, 2278499746, 2834019425,
-            3852526181, 2014331440, 215569666,  1133648437, 993890665,  3561970479, 144466626,
-            4172535331, 2931920884, 2465268015, 2083890054, 1571896752, 298343424,  195633990,
-            3584196848, 2079085580, 1686771687, 2915510569, 562489473,  487811869,  256992455,
-            501944965,  1956136859, 2519187274, 1843214902, 67574801,   2518511591, 160763373,
-            1172666820, 1514304946, 3835593184, 559050643,  486154020,  3032503067, 3596738885,
-            254028364,  2529734653, 2510737288, 1481478895, 549048208,  906127931,  2655739635,
-            4245704787, 2065626682, 93773196,   2558774105, 533508412,  3042382008, 981968356,
-            3867197562, 1362538779, 4125792373, 106846570,  1704971534, 280920376,  3692557790,
-            313111104,  3926105325, 1637147805, 4177532776, 2104754483, 3352123464, 1766592096,
-            1633362391, 607628802,  2360560002, 1811922956, 2253386462, 2963395154, 3797107469,
-            2258058200, 1142949128, 3505080279, 3951858450, 2681772640, 2426210620, 1934242405,
-            1787243636, 777363948,  104084171,  815626631,  3935783645, 1169749593, 2004603534,
-            1150711925, 1691776954, 1147451469, 1862526958, 1384747257, 1389576397, 3263541760,
-            2032411450, 901622061,  2000545141, 3322884256, 1489789498, 2928443675, 3310762650,
-            1923194476, 2554545675, 2656584490, 152147517,  3717282337, 1080031672, 3415479677,
-            3138309376, 1207921658, 45646141,   1508160827, 3173892063, 797942355,  3647607203,
-            3976274565, 2448396792, 1376910640, 687540401,  3211129520, 3413117342, 1237153991,
-            704658441,  3534826412, 2454701666, 1233442549, 3075975602, 3210177752, 102502163,
-            2038393545, 3601624212, 3382766896, 236127532,  94931715,   2860355949, 2024944898,
-            1641420125, 1510271001, 2652772711, 2446532206, 2709869134, 2825215546, 4239406500,
-            1797497383, 2500498266, 2674109705, 1855052803, 164037876,  331326404,  3132218179,
-            1867612594, 3806110719, 1725005505, 1299083119, 1887595411, 1941168042, 3399066781,
-            2858105298, 4140678646, 580192953,  2241888226, 1143677384, 2876141220, 2834019425,
-            3852526181, 2014331440, 215569666,  1547116827, 993890665,  3561970479, 144466626,
-            4172535331, 48570967,   2465268015, 2083890054, 1571896752, 298343424,  4079422858,
-            3584196848, 2079085580, 1686771687, 2915510569, 3021078758, 487811869,  256992455,
-            501944965,  1956136859, 1518307257, 1843214902, 67574801,   2518511591, 160763373,
-            3832409668, 1514304946, 3835593184, 559050643,  486154020,  2758048846, 3596738885,
-            254028364,  2529734653, 2510737288, 1033819193, 549048208,  906127931,  2655739635,
-            4245704787, 2463493690, 93773196,   2558774105, 533508412,  3042382008, 45089231,
-            3867197562, 1362538779, 4125792373, 106846570,  517073023,  280920376,  3692557790,
-            313111104,  3926105325, 1873040270, 4177532776, 2104754483, 3352123464, 1766592096,
-            1047159760, 607628802,  2360560002, 1811922956, 2253386462, 384966467,  3797107469,
-            2258058200, 1142949128, 3505080279, 1239831285, 2681772640, 2426210620, 1934242405,
-            1787243636, 3774519652, 104084171,  815626631,  3935783645, 1169749593, 1354549796,
-            1150711925, 1691776954, 1147451469, 1862526958, 3331520415, 1389576397, 3263541760,
-            2032411450, 901622061,  1295829352, 3322884256, 1489789498, 2928443675, 3310762650,
-            811346438,  2554545675, 2656584490, 152147517,  3717282337, 641521512,  3415479677,
-            3138309376, 1207921658, 45646141,   688645335,  3285908317, 1846223838, 2720808526,
-            1344305979, 3101979951, 4201055581, 2698896023, 2965853642, 381556371,  4049145320,
-            3820189550, 1124133939, 3742311178, 2399473752, 3621860770, 2040786657, 1049268684,
-            2417452886, 2809432688, 1476173909, 2187229904, 357370931,  520972272,  4130538606,
-            278039874,  1916923771, 2944353773, 1829325511, 2570824027, 954877583,  1912778993,
-            239077723,  428795303,  269975428,  286635931,  1094021182, 3621952595, 3788472754,
-            2562966382, 3685867433, 2461793760, 2688416430, 2441893532, 3303197565, 953649696,
-            1126216689, 1403326788, 1438101970, 101038524,  3059270618, 392240013,  2193915814,
-            2532980522, 882335031,  1508361041, 2238205865, 2359084706, 375243630,  1360133016,
-            802905224,  2145937441, 1093912481, 652034635,  3008621448, 3517710339, 3863486275,
-            612870703,  3591534476, 2136343536, 173520627,  1028575306, 4053707497, 3665635373,
-            3925840646, 2159586787, 852039778,  1317953251, 1339054644, 957233964,  1389762302,
-            2888478383, 467347052,  3359609971, 1216379006, 3301118666, 393033116,  2306443695,
-            3452855195, 1995314732, 2198562399, 3519222206, 615704067,  778676654,  4062681642,
-            3893244472, 295337143,  89725126,   3770879743, 2026714240, 445732373,  3987996017,
-            930755583,  2716697502, 1582902535, 2009750296, 1215651190, 1267974264, 770234954,
-            3847477184, 1867949016, 3586668589, 1020863894, 1107651959, 993211051,  1799463093,
-            290830845,  2098847072, 2277673795, 1335008098, 4120029867, 1011420916, 3349217658,
-            173946604,  3348336042, 560918033,  324541494,  3127701484, 3658661834, 24622735,
-            3577399419, 269552339,  61360594,   3204122516, 1207581090, 1149139608, 1216072351,
-            1986535329, 2746208301, 3990101334, 3744054044, 431705219,  1265110094, 2314059342,
-            4039744884, 2077270226, 921463226,  4041431322, 2821667616, 111393339,  634477516,
-            361591242,  2379102145, 328627435,  445113046,  1555659299, 2055581003, 2970728502,
-            169833782,  1306533580,
-        },
-        {
-            525214560,  1972466543, 1542775297, 3030388145, 2623763324, 1445252054, 2315649878,
-            2940376435, 1322155857, 2007925719, 899111545,  3946601974, 720416639,  566341007,
-            3830971140, 2379218430, 946001131,  324551023,  3792134824, 2419222364, 2507004728,
-            4050415702, 2934667964, 3435655480, 3738151878, 340092998,  429296098,  3804978739,
-            1547120540, 976306993,  1134820236, 288696971,  292350374,  423348923,  4250561112,
-            1380146522, 646098313,  3081299572, 3633231429, 2348008746, 3250735726, 3495239618,
-            1083361876, 2660545988, 97607299,   741626628,  2451882102, 607936604,  1566190301,
-            3752644837, 1626575269, 2569947980, 120166892,  1936167922, 2964570009, 2601765059,
-            2550590348, 1491574373, 1916644920, 2955888714, 3900360190, 396836243,  2417234534,
-            4219822777, 3017031315, 3848370775, 4113753945, 1038708316, 1227041843, 1287656330,
-            594136009,  1679465955, 1127853612, 445673212,  2491164616, 4234959779, 3670094401,
-            2810998507, 2091885715, 4213376041, 3724691332, 1428205363, 2351471476, 1863345709,
-            3172242044, 1435176883, 925973933,  3166951436, 2056462416, 489417029,  4029854347,
-            3002516723, 1597712463, 1200457469, 3909654542, 1352519428, 13398705,   3919269221,
-            371331154,  332347636,  3726033518, 2407091731, 2926199215, 3054175446, 3208807730,
-            584793525,  2706493003, 561190823,  2412132195, 2488492462, 3149885896, 3512276852,
-            2843032269, 2485506176, 4025325347, 4152622551, 4022346903, 331746013,  197533993,
-            3658414685, 2670729696, 3290854172, 2251426444, 3569225076, 2466203243, 658184940,
-            518096293,  52156682,   2398958685, 745491615,  3723004242, 2847276077, 1857504125,
-            633035220,  4057593658, 2783467746, 3122875931, 446601186,  2786851490, 261950076,
-            2843506874, 745391893,  1404094021, 2234513997, 315083019,  645865358,  2862243948,
-            1204315994, 3701151065, 663411328,  1924727700, 1905843757, 1483930049, 449616818,
-            3793968150, 1840668755, 1671024110, 4079375869, 4171670660, 2585904968, 3886777251,
-            525214560,  1972466543, 1542775297, 3030388145, 2530126952, 1445252054, 2315649878,
-            2940376435, 1322155857, 1599103627, 899111545,  3946601974, 720416639,  566341007,
-            4070101360, 2379218430, 946001131,  324551023,  3792134824, 2445126690, 2507004728,
-            4050415702, 2934667964, 3435655480, 2968121571, 340092998,  429296098,  3804978739,
-            1547120540, 3901803457, 1134820236, 288696971,  292350374,  423348923,  1589814289,
-            1380146522, 646098313,  3081299572, 3633231429, 670777956,  3250735726, 3495239618,
-            1083361876, 2660545988, 4050232394, 741626628,  2451882102, 607936604,  1566190301,
-            1132827700, 1626575269, 2569947980, 120166892,  1936167922, 1280520333, 2601765059,
-            2550590348, 1491574373, 1916644920, 1073889810, 3900360190, 396836243,  2417234534,
-            4219822777, 1754651820, 3848370775, 4113753945, 1038708316, 1227041843, 464826842,
-            594136009,  1679465955, 1127853612, 445673212,  4198686893, 4234959779, 3670094401,
-            2810998507, 2091885715, 416103731,  3724691332, 1428205363, 2351471476, 1863345709,
-            2637470915, 1435176883, 925973933,  3166951436, 2056462416, 2546319147, 4029854347,
-            3002516723, 1597712463, 1200457469, 681365672,  1352519428, 13398705,   3919269221,
-            371331154,  742849231,  3726033518, 2407091731, 2926199215, 3054175446, 1323833820,
-            584793525,  2706493003, 561190823,  2412132195, 3747238187, 3149885896, 3512276852,
-            2843032269, 2485506176, 3817319503, 4152622551, 4022346903, 331746013,  197533993,
-            99009902,   2670729696, 3290854172, 2251426444, 3569225076, 4199909720, 658184940,
-            518096293,  52156682,   2398958685, 1648201186, 3723004242, 2847276077, 1857504125,
-            633035220,  1394668680, 2783467746, 3122875931, 446601186,  2786851490, 2590549096,
-            2843506874, 745391893,  1404094021, 2234513997, 347299411,  645865358,  2862243948,
-            1204315994, 3701151065, 4028305509, 1924727700, 1905843757, 1483930049, 449616818,
-            2251238906, 1840668755, 1671024110, 4079375869, 4171670660, 4080554282, 3886777251,
-            525214560,  1972466543, 1542775297, 3280177496, 2530126952, 1445252054, 2315649878,
-            2940376435, 2094983509, 1599103627, 899111545,  3946601974, 720416639,  1446566513,
-            4070101360, 2379218430, 946001131,  324551023,  2945613775, 2445126690, 2507004728,
-            4050415702, 2934667964, 2815036731, 2968121571, 340092998,  429296098,  3804978739,
-            3298867574, 3901803457, 1134820236, 288696971,  292350374,  3280367987, 1589814289,
-            1380146522, 646098313,  3081299572, 2536311658, 670777956,  3250735726, 3495239618,
-            1083361876, 3726225049, 4050232394, 741626628,  2451882102, 607936604,  3460165725,
-            1132827700, 1626575269, 2569947980, 120166892,  2961109404, 1280520333, 2601765059,
-            2550590348, 1491574373, 755823086,  1073889810, 3900360190, 396836243,  2417234534,
-            3036027780, 1754651820, 3848370775, 4113753945, 1038708316, 3784147349, 464826842,
-            594136009,  1679465955, 1127853612, 2128970592, 4198686893, 4234959779, 3670094401,
-            2810998507, 421961324,  416103731,  3724691332, 1428205363, 2351471476, 3407618159,
-            2637470915, 1435176883, 925973933,  3166951436, 1274860184, 2546319147, 4029854347,
-            3002516723, 1597712463, 671480036,  681365672,  1352519428, 13398705,   3919269221,
-            1150967289, 742849231,  3726033518, 2407091731, 2926199215, 3106945136, 1323833820,
-            584793525,  2706493003, 561190823,  2013357219, 3747238187, 3149885896, 3512276852,
-            2843032269, 3595347994, 3817319503, 4152622551, 4022346903, 331746013,  367216863,
-            99009902,   2670729696, 3290854172, 2251426444, 3130148315, 4199909720, 658184940,
-            518096293,  52156682,   3004378899, 1648201186, 3723004242, 2847276077, 1857504125,
-            253542783,  1394668680, 2783467746, 3122875931, 446601186,  1228837642, 2590549096,
-            2843506874, 745391893,  1404094021, 1324404436, 347299411,  645865358,  2862243948,
-            1204315994, 1455458347, 4028305509, 1924727700, 1905843757, 1483930049, 330348422,
-            2251238906, 1840668755, 1671024110, 4079375869, 606568968,  4080554282, 3886777251,
-            525214560,  1972466543, 1703103913, 3280177496, 2530126952, 1445252054, 2315649878,
-            3946153427, 2094983509, 1599103627, 899111545,  3946601974, 2053673584, 1446566513,
-            4070101360, 2379218430, 946001131,  4184236551, 2945613775, 2445126690, 2507004728,
-            4050415702, 3890831500, 2815036731, 2968121571, 340092998,  429296098,  228493148,
-            3298867574, 3901803457, 1134820236, 288696971,  2321943990, 3280367987, 1589814289,
-            1380146522, 646098313,  1765624343, 2536311658, 670777956,  3250735726, 3495239618,
-            1772431608, 3726225049, 4050232394, 741626628,  2451882102, 3386124330, 3460165725,
-            1132827700, 1626575269, 2569947980, 860947846,  2961109404, 1280520333, 2601765059,
-            2550590348, 2298495740, 755823086,  1073889810, 3900360190, 396836243,  2702634902,
-            3036027780, 1754651820, 3848370775, 4113753945, 3836550212, 3784147349, 464826842,
-            594136009,  1679465955, 1500399122, 2128970592, 4198686893, 4234959779, 3670094401,
-            1632934875, 421961324,  416103731,  3724691332, 1428205363, 2330377177, 3407618159,
-            2637470915, 1435176883, 925973933,  2558479866, 1274860184, 2546319147, 4029854347,
-            3002516723, 1331271216, 671480036,  681365672,  1352519428, 13398705,   1532459856,
-            1150967289, 742849231,  3726033518, 2407091731, 1766120506, 3106945136, 1323833820,
-            584793525,  2706493003, 3817434387, 2013357219, 3747238187, 3149885896, 3512276852,
-            203757,     3595347994, 3817319503, 4152622551, 4022346903, 3438004885, 367216863,
-            99009902,   2670729696, 3290854172, 1092092654, 3130148315, 4199909720, 658184940,
-            518096293,  982576981,  3004378899, 1648201186, 3723004242, 2847276077, 33113683,
-            253542783,  1394668680, 2783467746, 3122875931, 3109404671, 1228837642, 2590549096,
-            2843506874, 745391893,  809710525,  1324404436, 347299411,  645865358,  2862243948,
-            3652256751, 1455458347, 4028305509, 1924727700, 1905843757, 2035132481, 330348422,
-            2251238906, 1840668755, 1671024110, 3593348393, 4151905045, 3398483770, 611142788,
-            1798029112, 2747225670, 2894981396, 2117120651, 3087941624, 416876364,  700011792,
-            63929447,   822005210,  3483417647, 3513365134, 3071572873, 1925919001, 2778688996,
-            3079943255, 1252316311, 91270196,   3469862149, 156659741,  1342755036, 3821302858,
-            1790046971, 289329863,  1357914395, 4143182690, 2590503919, 3242437796, 1341085928,
-            2685277054, 727602392,  2581493226, 3216496864, 2171373196, 3767765187, 1895767358,
-            1029452326, 851913526,  1746266839, 3370323171, 648118190,  3244211645, 2623946928,
-            3859087079, 384443034,  2026989771, 802104797,  2201121552, 725742304,  1673563239,
-            4045658814, 2682764476, 3032306650, 2725871420, 3467522540, 534803010,  1135606913,
-            871336950,  937160030,  3384357161, 641566845,  2267407903, 331847343,  787968740,
-            2673012251, 2066357778, 2740382722, 1638377946, 2260504282, 3513172717, 238548903,
-            2203496688, 630532448,  3702112076, 2635952931, 3344713216, 139406056,  2369004628,
-            3547213209, 2944858950, 1231203228, 616949630,  2619739101, 89360251,   2364353701,
-            1025345607, 4177965685, 62274372,   3059207586, 3303376016, 2919795870, 3676526103,
-            2689781822, 1062293263, 2684605838, 863975243,  723728777,  1057919510, 1708017843,
-            4264127977, 3013938022, 3958746896, 328415103,  1117948849, 751056929,  2442147201,
-            1781170563, 765377308,  961452970,  4247303973, 2233034754, 86997820,   3495561473,
-            3075957349, 3152032365, 1220657606, 708134514,  26714613,   3749542051, 1640668224,
-            2252760600, 1635050662, 947216628,  3612773344, 4089189500, 3647048119, 979491227,
-            4149824933, 3160885292, 2808843788, 998859510,  3903167193, 1728999561, 3673946130,
-            279338980,  2507635299, 1614929524, 302060483,  2874453052, 3798613814, 2013436766,
-            3514754020, 2923162106, 2658720327, 3498579091, 3292220096, 3796129102, 1907288796,
-            2820663603, 4276052248, 247755133,  2088596201, 3154955976, 3309397641, 3606171919,
-            1356791029, 1030266022,
-        },
-        {
-            946213433,  4288173271, 1483111274, 1022489182, 2829455164, 1568500698, 2335069053,
-            3463780855, 1907369544, 1391920165, 2182165501, 1485198194, 1760151680, 3835466664,
-            370615946,  2991606700, 121417498,  1690499669, 2610517886, 997515298,  1320233926,
-            2044976963, 3962686933, 1740674234, 189405260,  2991438193, 851841063,  3785214035,
-            1653840138, 1207545092, 3296668848, 820275935,  2332095159, 2802140923, 3549947924,
-            136761986,  1595693187, 1290529109, 3241224821, 932172196,  982391848,  1677696263,
-            1824288108, 3622998132, 2671496575, 3091929582, 3965384477, 3332661248, 3913578832,
-            1445616796, 4236651046, 3313429255, 3849305633, 830455661,  377144673,  2410853402,
-            3019587482, 2607159382, 1682655653, 571927373,  2766986658, 2746104609, 4031691389,
-            3252848333, 3780542818, 2607220124, 3538267957, 2690691552, 3975958878, 2922009629,
-            4224579965, 2617001379, 2428240514, 973947250,  3535088667, 2334197798, 1721514733,
-            2333915362, 2433800524, 3122644356, 2911763912, 1877301175, 2370096662, 2327772197,
-            3484381052, 866393369,  3597473776, 3906333666, 75187189,   1871878532, 1988801295,
-            146018287,  2399180303, 1906399391, 729178547,  3317665909, 123969736,  1905994682,
-            661151190,  499224382,  1058987006, 184565698,  1928287371, 4206793183, 2667602308,
-            2264413642, 1856406551, 3793441978, 3529236321, 3682397529, 2254230721, 2119543302,
-            1933825520, 3350512067, 654506191,  1729617181, 3581235636, 4270168706, 1927699487,
-            2129103557, 2825947129, 3415032692, 3398313962, 3781859328, 2881380877, 358269910,
-            3180981191, 270450673,  3544885987, 2751543000, 4057155478, 3555019347, 2317525354,
-            344496176,  3235793163, 2733573790, 532374600,  2829993433, 1608419022, 2731370833,
-            1385905130, 944619028,  1473323752, 4216118168, 1630701354, 3885268817, 977196935,
-            100648892,  140727648,  1542006337, 2653312212, 3676956563, 1377631923, 2145130403,
-            3038392066, 2960892524, 200801417,  96510022,   3187404054, 2799068527, 4097116877,
-            946213433,  4288173271, 1483111274, 1022489182, 3754885859, 1568500698, 2335069053,
-            3463780855, 1907369544, 1949485234, 2182165501, 1485198194, 1760151680, 3835466664,
-            172372805,  2991606700, 121417498,  1690499669, 2610517886, 3228001341, 1320233926,
-            2044976963, 3962686933, 1740674234, 90932040,   2991438193, 851841063,  3785214035,
-            1653840138, 56924526,   3296668848, 820275935,  2332095159, 2802140923, 2206560153,
-            136761986,  1595693187, 1290529109, 3241224821, 394250187,  982391848,  1677696263,
-            1824288108, 3622998132, 515238650,  3091929582, 3965384477, 3332661248, 3913578832,
-            3655153210, 4236651046, 3313429255, 3849305633, 830455661,  3441369205, 2410853402,
-            3019587482, 2607159382, 1682655653, 3711600401, 2766986658, 2746104609, 4031691389,
-            3252848333, 1676831444, 2607220124, 3538267957, 2690691552, 3975958878, 897223430,
-            4224579965, 2617001379, 2428240514, 973947250,  313217845,  2334197798, 1721514733,
-            2333915362, 2433800524, 1212478457, 2911763912, 1877301175, 2370096662, 2327772197,
-            3493472588, 866393369,  3597473776, 3906333666, 75187189,   862424208,  1988801295,
-            146018287,  2399180303, 1906399391, 914009802,  3317665909, 123969736,  1905994682,
-            661151190,  2640872929, 1058987006, 184565698,  1928287371, 4206793183, 480366560,
-            2264413642, 1856406551, 3793441978, 3529236321, 1843297296, 2254230721, 2119543302,
-            1933825520, 3350512067, 405378861,  1729617181, 3581235636, 4270168706, 1927699487,
-            982086857,  2825947129, 3415032692, 3398313962, 3781859328, 4276534881, 358269910,
-            3180981191, 270450673,  3544885987, 2741933278, 4057155478, 3555019347, 2317525354,
-            344496176,  3431700718, 2733573790, 532374600,  2829993433, 1608419022, 3521884376,
-            1385905130, 944619028,  1473323752, 4216118168, 2531099622, 3885268817, 977196935,
-            100648892,  140727648,  3690834777, 2653312212, 3676956563, 1377631923, 2145130403,
-            1443733702, 2960892524, 200801417,  96510022,   3187404054, 2178517157, 4097116877,
-            946213433,  4288173271, 1483111274, 972062638,  3754885859, 1568500698, 2335069053,
-            3463780855, 3441388512, 1949485234, 2182165501, 1485198194, 1760151680, 1917007220,
-            172372805,  2991606700, 121417498,  1690499669, 891053380,  3228001341, 1320233926,
-            2044976963, 3962686933, 1829572563, 90932040,   2991438193, 851841063,  3785214035,
-            1878552250, 56924526,   3296668848, 820275935,  2332095159, 4270001728, 2206560153,
-            136761986,  1595693187, 1290529109, 3939152991, 394250187,  982391848,  1677696263,
-            1824288108, 816944064,  515238650,  3091929582, 3965384477, 3332661248, 2876801391,
-            3655153210, 4236651046, 3313429255, 3849305633, 900703550,  3441369205, 2410853402,
-            3019587482, 2607159382, 3663158912, 3711600401, 2766986658, 2746104609, 4031691389,
-            4167600247, 1676831444, 2607220124, 3538267957, 2690691552, 3017373845, 897223430,
-            4224579965, 2617001379, 2428240514, 3025632157, 313217845,  2334197798, 1721514733,
-            2333915362, 2490483051, 1212478457, 2911763912, 1877301175, 2370096662, 3874137307,
-            3493472588, 866393369,  3597473776, 3906333666, 3363431040, 862424208,  1988801295,
-            146018287,  2399180303, 922786896,  914009802,  3317665909, 123969736,  1905994682,
-            2984589029, 2640872929, 1058987006, 184565698,  1928287371, 205761163,  480366560,
-            2264413642, 1856406551, 3793441978, 2868392980, 1843297296, 2254230721, 2119543302,
-            1933825520, 696982819,  405378861,  1729617181, 3581235636, 4270168706, 2885484792,
-            982086857,  2825947129, 3415032692, 3398313962, 1421587661, 4276534881, 358269910,
-            3180981191, 270450673,  275151800,  2741933278, 4057155478, 3555019347, 2317525354,
-            597035108,  3431700718, 2733573790, 532374600,  2829993433, 2516296768, 3521884376,
-            1385905130, 944619028,  1473323752, 4068493935, 2531099622, 3885268817, 977196935,
-            100648892,  89216213,   3690834777, 2653312212, 3676956563, 1377631923, 1340756970,
-            1443733702, 2960892524, 200801417,  96510022,   4158554569, 2178517157, 4097116877,
-            946213433,  4288173271, 2396878482, 972062638,  3754885859, 1568500698, 2335069053,
-            1968361560, 3441388512, 1949485234, 2182165501, 1485198194, 215668270,  1917007220,
-            172372805,  2991606700, 121417498,  3417799976, 891053380,  3228001341, 1320233926,
-            2044976963, 1142093007, 1829572563, 90932040,   2991438193, 851841063,  3162402976,
-            1878552250, 56924526,   3296668848, 820275935,  1296140840, 4270001728, 2206560153,
-            136761986,  1595693187, 354517003,  3939152991, 394250187,  982391848,  1677696263,
-            1223930313, 816944064,  515238650,  3091929582, 3965384477, 3901260738, 2876801391,
-            3655153210, 4236651046, 3313429255, 246915717,  900703550,  3441369205, 2410853402,
-            3019587482, 3771567535, 3663158912, 3711600401, 2766986658, 2746104609, 989297155,
-            4167600247, 1676831444, 2607220124, 3538267957, 1885690892, 3017373845, 897223430,
-            4224579965, 2617001379, 2846614382, 3025632157, 313217845,  2334197798, 1721514733,
-            165341094,  2490483051, 1212478457, 2911763912, 1877301175, 968228519,  3874137307,
-            3493472588, 866393369,  3597473776, 3386540650, 3363431040, 862424208,  1988801295,
-            146018287,  5548173,    922786896,  914009802,  3317665909, 123969736,  1404440198,
-            2984589029, 2640872929, 1058987006, 184565698,  676990044,  205761163,  480366560,
-            2264413642, 1856406551, 1251774781, 2868392980, 1843297296, 2254230721, 2119543302,
-            4018382402, 696982819,  405378861,  1729617181, 3581235636, 3104740445, 2885484792,
-            982086857,  2825947129, 3415032692, 627014056,  1421587661, 4276534881, 358269910,
-            3180981191, 3832268806, 275151800,  2741933278, 4057155478, 3555019347, 4208208217,
-            597035108,  3431700718, 2733573790, 532374600,  2265073135, 2516296768, 3521884376,
-            1385905130, 944619028,  1877155787, 4068493935, 2531099622, 3885268817, 977196935,
-            3738324160, 89216213,   3690834777, 2653312212, 3676956563, 3204845508, 1340756970,
-            1443733702, 2960892524, 200801417,  63964275,   2825158049, 2381494896, 2335231515,
-            352703633,  4232597668, 4026664651, 2969782318, 597082407,  1833145268, 2003174361,
-            1047994172, 3232984678, 1902232834, 3466757813, 3497526396, 251178198,  417206160,
-            3486575796, 641601212,  1550514203, 2756661108, 4076306086, 2790459571, 2863207030,
-            2190942461, 2029072715, 1297779690, 329791817,  452568490,  1011076285, 869997242,
-            3319817174, 1037201482, 225361235,  3529145988, 1684379186, 3712536673, 1539221924,
-            1215712127, 865258055,  1671713942, 2495812136, 1112224003, 249704964,  3195331961,
-            1487320434, 1536766443, 3139184018, 2064348097, 3018237607, 2579699670, 4216752882,
-            4106477993, 3019571033, 4219363998, 1202604051, 91428444,   468594777,  4079864860,
-            1159143130, 497939169,  3254248672, 1982275375, 3427152957, 2921456066, 864950105,
-            4264623747, 2019315645, 4007112548, 3266130611, 3387759691, 3595066721, 3149870294,
-            1542459269, 2993129480, 2004024177, 3548513904, 1735477343, 3485855761, 3094831508,
-            101533825,  1793752286, 512620208,  2604274501, 2807598232, 903242157,  3852393450,
-            233628997,  2976248739, 2066051828, 2893822399, 1485693617, 461554222,  854998994,
-            1824428055, 279414428,  2790792474, 597012584,  968984035,  3080769203, 4170642740,
-            1008957847, 674895933,  1727769076, 2872775570, 916594332,  944248803,  2402094079,
-            1403116802, 511953185,  1015560590, 1885907983, 1610501875, 2313388052, 2085469702,
-            2180974550, 3015115704, 3756762622, 63480526,   478164225,  1968224838, 2305942603,
-            1910467127, 3395528611, 3049455954, 44671988,   2881803260, 1517609783, 3601149357,
-            1754751378, 3860373909, 1112055532, 1346443814, 3406358269, 305209234,  465770829,
-            1953837419, 3140803117, 1276907485, 3504216858, 1474060021, 3257399989, 332155501,
-            1096249735, 2453003022, 4258710725, 257330858,  2576026956, 2115990045, 1793329153,
-            3023455425, 2976321556, 1788525389, 4106022809, 4079366022, 1277173826, 63599528,
-            1439159150, 3854332162,
-        },
-        {
-            3868946146, 1938156793, 1877502872, 1408917625, 1549117911, 2465501566, 4218547770,
-            2942249332, 2731789075, 2366036899, 1312641799, 2243363271, 2238839307, 384814263,
-            1552361757, 3521369641, 431721717,  3089625732, 1023760034, 53847139,   2240881978,
-            3178046414, 145135653,  1580878781, 3500228040, 3360910006, 3285542950, 3330062556,
-            2870158227, 1481496810, 4222704363, 2973046526, 435155769,  3234730070, 3306545960,
-            2539776908, 3991420334, 125389349,  2397544348, 2504790975, 886432257,  1804136430,
-            1506551086, 219847214,  890282686,  1489840806, 2536942497, 87527661,   1822718904,
-            3984956867, 2334419518, 4065487054, 992104547,  1566792845, 1068226712, 2622731799,
-            921431708,  2833392639, 640267449,  324907409,  3911698049, 2108189994, 1623761598,
-            52771719,   467926435,  2811768106, 3760723083, 906402727,  3438479463, 2064004404,
-            988123982,  563076447,  2979641383, 1366086397, 2078608605, 3868491514, 1077957067,
-            615363273,  1388831706, 1586480552, 4216838311, 3587550780, 2057048927, 2814838921,
-            2454041809, 180612020,  930406098,  4286819113, 2756562967, 3404265234, 3844482428,
-            467484533,  4122644954, 3517116598, 1887163240, 4217569180, 4191149652, 2756931330,
-            3702787956, 152166773,  146763911,  536678737,  481385008,  3681433244, 1194909733,
-            3713568496, 3927837202, 846842608,  687314083,  1144793694, 1062075916, 3017627145,
-            1296695243, 981862419,  2363304726, 3242788356, 3359957762, 4249190787, 1697910336,
-            3286799886, 1063822293, 3246091430, 743808559,  2137668568, 2812072749, 2303791182,
-            3161789548, 2911126624, 4087873192, 1813622227, 1272618849, 1882292328, 3861455677,
-            2921641470, 3079812494, 2814569163, 1975646942, 2826176621, 1896904368, 831552834,
-            2935863403, 449217054,  3688067832, 1048877596, 1613227043, 553867520,  3682575786,
-            3058863948, 4200858129, 4131625,    2434123776, 2235627905, 2905358693, 3429312266,
-            3363231514, 1182242507, 2792234422, 1843330053, 4192875151, 1088813348, 357805687,
-            3868946146, 1938156793, 1877502872, 1408917625, 30638250,   2465501566, 4218547770,
-            2942249332, 2731789075, 448998968,  1312641799, 2243363271, 2238839307, 384814263,
-            2229663001, 3521369641, 431721717,  3089625732, 1023760034, 790771414,  2240881978,
-            3178046414, 145135653,  1580878781, 847577516,  3360910006, 3285542950, 3330062556,
-            2870158227, 112738978,  4222704363, 2973046526, 435155769,  3234730070, 1135073835,
-            2539776908, 3991420334, 125389349,  2397544348, 1243128255, 886432257,  1804136430,
-            1506551086, 219847214,  875051553,  1489840806, 2536942497, 87527661,   1822718904,
-            1883615145, 2334419518, 4065487054, 992104547,  1566792845, 1037132511, 2622731799,
-            921431708,  2833392639, 640267449,  504304037,  3911698049, 2108189994, 1623761598,
-            52771719,   3969520254, 2811768106, 3760723083, 906402727,  3438479463, 3707538496,
-            988123982,  563076447,  2979641383, 1366086397, 3577913613, 3868491514, 1077957067,
-            615363273,  1388831706, 903353909,  4216838311, 3587550780, 2057048927, 2814838921,
-            3532304828, 180612020,  930406098,  4286819113, 2756562967, 1950528802, 3844482428,
-            467484533,  4122644954, 3517116598, 139409766,  4217569180, 4191149652, 2756931330,
-            3702787956, 504815033,  146763911,  536678737,  481385008,  3681433244, 2166865052,
-            3713568496, 3927837202, 846842608,  687314083,  135403542,  1062075916, 3017627145,
-            1296695243, 981862419,  2405232584, 3242788356, 3359957762, 4249190787, 1697910336,
-            3517294012, 1063822293, 3246091430, 743808559,  2137668568, 2962825355, 2303791182,
-            3161789548, 2911126624, 4087873192, 2344237973, 1272618849, 1882292328, 3861455677,
-            2921641470, 1062672856, 2814569163, 1975646942, 2826176621, 1896904368, 3172875195,
-            2935863403, 449217054,  3688067832, 1048877596, 983648949,  553867520,  3682575786,
-            3058863948, 4200858129, 2552994282, 2434123776, 2235627905, 2905358693, 3429312266,
-            461707508,  1182242507, 2792234422, 1843330053, 4192875151, 2557078297, 357805687,
-            3868946146, 1938156793, 1877502872, 1178921294, 30638250,   2465501566, 4218547770,
-            2942249332, 2597087237, 448998968,  1312641799, 2243363271, 2238839307, 3465588695,
-            2229663001, 3521369641, 431721717,  3089625732, 2420359327, 790771414,  2240881978,
-            3178046414, 145135653,  3411014139, 847577516,  3360910006, 3285542950, 3330062556,
-            4257518865, 112738978,  4222704363, 2973046526, 435155769,  1154160505, 1135073835,
-            2539776908, 3991420334, 125389349,  1396475349, 1243128255, 886432257,  1804136430,
-            1506551086, 3727497731, 875051553,  1489840806, 2536942497, 87527661,   2521823325,
-            1883615145, 2334419518, 4065487054, 992104547,  3431387970, 1037132511, 2622731799,
-            921431708,  2833392639, 780276883,  504304037,  3911698049, 2108189994, 1623761598,
-            1832564202, 3969520254, 2811768106, 3760723083, 906402727,  2319993554, 3707538496,
-            988123982,  563076447,  2979641383, 3703509163, 3577913613, 3868491514, 1077957067,
-            615363273,  3925135746, 903353909,  4216838311, 3587550780, 2057048927, 2129250845,
-            3532304828, 180612020,  930406098,  4286819113, 571849466,  1950528802, 3844482428,
-            467484533,  4122644954, 3696836546, 139409766,  4217569180, 4191149652, 2756931330,
-            84389584,   504815033,  146763911,  536678737,  481385008,  281139563,  2166865052,
-            3713568496, 3927837202, 846842608,  2123715146, 135403542,  1062075916, 3017627145,
-            1296695243, 4206227732, 2405232584, 3242788356, 3359957762, 4249190787, 2766470555,
-            3517294012, 1063822293, 3246091430, 743808559,  2821229002, 2962825355, 2303791182,
-            3161789548, 2911126624, 503886017,  2344237973, 1272618849, 1882292328, 3861455677,
-            4158985014, 1062672856, 2814569163, 1975646942, 2826176621, 4118784229, 3172875195,
-            2935863403, 449217054,  3688067832, 3556237148, 983648949,  553867520,  3682575786,
-            3058863948, 3200838331, 2552994282, 2434123776, 2235627905, 2905358693, 4178312045,
-            461707508,  1182242507, 2792234422, 1843330053, 3597816691, 2557078297, 357805687,
-            3868946146, 1938156793, 2168462050, 1178921294, 30638250,   2465501566, 4218547770,
-            4101101381, 2597087237, 448998968,  1312641799, 2243363271, 313553894,  3465588695,
-            2229663001, 3521369641, 431721717,  737541534,  2420359327, 790771414,  2240881978,
-            3178046414, 326569272,  3411014139, 847577516,  3360910006, 3285542950, 3098408987,
-            4257518865, 112738978,  4222704363, 2973046526, 3668411828, 1154160505, 1135073835,
-            2539776908, 3991420334, 2902976896, 1396475349, 1243128255, 886432257,  1804136430,
-            2162242501, 3727497731, 875051553,  1489840806, 2536942497, 2238214198, 2521823325,
-            1883615145, 2334419518, 4065487054, 1081167745, 3431387970, 1037132511, 2622731799,
-            921431708,  2612105434, 780276883,  504304037,  3911698049, 2108189994, 2518535877,
-            1832564202, 3969520254, 2811768106, 3760723083, 2894544992, 2319993554, 3707538496,
-            988123982,  563076447,  719340658,  3703509163, 3577913613, 3868491514, 1077957067,
-            2371417985, 3925135746, 903353909,  4216838311, 3587550780, 3146473377, 2129250845,
-            3532304828, 180612020,  930406098,  1054512059, 571849466,  1950528802, 3844482428,
-            467484533,  1437844285, 3696836546, 139409766,  4217569180, 4191149652, 1161452915,
-            84389584,   504815033,  146763911,  536678737,  3965987378, 281139563,  2166865052,
-            3713568496, 3927837202, 2566873330, 2123715146, 135403542,  1062075916, 3017627145,
-            3204726297, 4206227732, 2405232584, 3242788356, 3359957762, 2338319494, 2766470555,
-            3517294012, 1063822293, 3246091430, 1531757306, 2821229002, 2962825355, 2303791182,
-            3161789548, 2778326467, 503886017,  2344237973, 1272618849, 1882292328, 1725075819,
-            4158985014, 1062672856, 2814569163, 1975646942, 3822868823, 4118784229, 3172875195,
-            2935863403, 449217054,  2465297154, 3556237148, 983648949,  553867520,  3682575786,
-            4023654874, 3200838331, 2552994282, 2434123776, 2235627905, 3063253867, 4178312045,
-            461707508,  1182242507, 2792234422, 3673318927, 1249828417, 2772427670, 1052324962,
-            3106530204, 2843183862, 630633945,  4140139503, 1659674037, 1096812757, 1376150732,
-            2328468653, 1410746620, 4025107990, 3335632421, 2754906610, 1615859006, 285467698,
-            4013475548, 1287384555, 1191111485, 1999165134, 2396354947, 1628158236, 3586708909,
-            228664781,  2501369720, 2516229872, 2977432606, 1745869751, 750661412,  1142144084,
-            2705268946, 1728488244, 589587862,  3604281130, 3217245915, 2061424631, 1918958878,
-            1162850007, 438550637,  1774088146, 3237803593, 827476363,  404982536,  2344744845,
-            3416436851, 369597250,  287618335,  1349740180, 3489688427, 417859991,  3229729092,
-            3214122057, 3955335849, 3014669381, 2178319957, 1259991234, 2689513541, 2628816894,
-            3734652479, 4202568782, 3149274749, 497295490,  3427602420, 3229774907, 59257138,
-            856364156,  429586733,  1800559699, 1300239050, 1311125646, 257421988,  3749074142,
-            1648939149, 1914174865, 105489877,  3599116888, 2695725484, 1543985792, 3210070699,
-            1867126432, 3088920410, 953084407,  2185095866, 1427606476, 1572442276, 3322674991,
-            3578824788, 1156246244, 2938200612, 3409545464, 215820858,  2279282461, 3861049095,
-            1589517366, 208707366,  2741570297, 440313302,  864288468,  1564945290, 1050929272,
-            3037450392, 1101323242, 1200278943, 3005564105, 3847988630, 3251750599, 2608433412,
-            3106720723, 1522694503, 3857782840, 4282681349, 2229263718, 4106780914, 125648941,
-            1933617693, 2971178569, 3537872030, 448962137,  652123777,  2393871920, 3938047691,
-            244410098,  3110791961, 3122318189, 877378106,  3683644255, 4279094311, 3638987055,
-            667681197,  1679868535, 1938378101, 1331340184, 734163051,  3409564713, 955108672,
-            3969637663, 156515523,  1871394552, 590275639,  3237133664, 898438533,  2291347006,
-            644781653,  3575493549, 1206698159, 2484805619, 2931447110, 2411269190, 3866437145,
-            161562563,  3077166456, 792874130,  3193406610, 2500233218, 596837225,  3667458052,
-            3239960816, 2271901243,
-        },
-        {
-            3295554901, 3971403287, 3595528073, 219189970,  4044926633, 2995420049, 2493622670,
-            3038263292, 336224765,  3106607315, 3039897667, 1219488603, 3179237655, 640150141,
-            202111895,  3561641296, 3483037280, 1622969371, 1092217292, 1144489063, 1935470344,
-            1064230248, 1266906050, 2182020951, 2246247274, 4091073338, 3117552596, 46197997,
-            2221457616, 3396330953, 1526929841, 2279350381, 2217580059, 2302060592, 2141664338,
-            3014686654, 4201679679, 2743637124, 1829157043, 3225219062, 139829538,  3686259983,
-            3212562499, 552828564,  257100511,  2521182179, 344809998,  4045786253, 3115075397,
-            4164944991, 3492650120, 421224958,  645337691,  762765878,  1140881274, 2488759907,
-            3050037518, 4024830794, 3089022790, 2970901892, 1678702244, 3919329899, 4274505193,
-            1647768284, 2639337088, 2222077475, 824916698,  4256443380, 2656125712, 2918632490,
-            221889538,  2913092472, 1231151119, 965461943,  3053789044, 2287783550, 4157587374,
-            524750755,  483160930,  1957697505, 3879286316, 1366828916, 2570866655, 4015330582,
-            4127235963, 1713472714, 3758549418, 131374386,  1524515358, 1238203579, 3510209792,
-            2737166090, 3809457816, 4194560299, 399565501,  137148507,  2422666678, 4179783899,
-            3295515800, 1408463424, 56920448,   2738832978, 3762502451, 1433666919, 124634051,
-            4076628359, 3131437922, 2591339255, 2879649337, 3293582368, 2258251940, 1515660567,
-            3883956901, 3161687764, 177970861,  1379077870, 3292335930, 867863132,  1085182729,
-            2635048646, 225335533,  3240256682, 113947705,  1684991600, 1519850828, 1933652380,
-            1129236811, 2245283502, 2237170524, 1760214738, 1351722265, 1275984882, 2701183545,
-            2451662680, 1707995402, 2031419778, 3063944107, 840927806,  376235355,  805385407,
-            147832099,  1782957345, 3174668632, 378084966,  296308865,  1207299206, 2109300356,
-            327338204,  3104840245, 1117104555, 549933260,  2728925227, 3663649648, 3419006071,
-            3333065131, 2085492440, 2060140621, 3923501456, 345975882,  4226392562, 469811444,
-            3295554901, 3971403287, 3595528073, 219189970,  1227979639, 2995420049, 2493622670,
-            3038263292, 336224765,  896221880,  3039897667, 1219488603, 3179237655, 640150141,
-            3275768033, 3561641296, 3483037280, 1622969371, 1092217292, 3610422326, 1935470344,
-            1064230248, 1266906050, 2182020951, 101133510,  4091073338, 3117552596, 46197997,
-            2221457616, 3856573005, 1526929841, 2279350381, 2217580059, 2302060592, 4010564841,
-            3014686654, 4201679679, 2743637124, 1829157043, 435239521,  139829538,  3686259983,
-            3212562499, 552828564,  1588937298, 2521182179, 344809998,  4045786253, 3115075397,
-            2012554448, 3492650120, 421224958,  645337691,  762765878,  1615597080, 2488759907,
-            3050037518, 4024830794, 3089022790, 1556805946, 1678702244, 3919329899, 4274505193,
-            1647768284, 1530995384, 2222077475, 824916698,  4256443380, 2656125712, 247339198,
-            221889538,  2913092472, 1231151119, 965461943,  2092495572, 2287783550, 4157587374,
-            524750755,  483160930,  2237020361, 3879286316, 1366828916, 2570866655, 4015330582,
-            3144768937, 1713472714, 3758549418, 131374386,  1524515358, 4197408552, 3510209792,
-            2737166090, 3809457816, 4194560299, 2510862090, 137148507,  2422666678, 4179783899,
-            3295515800, 63357018,   56920448,   2738832978, 3762502451, 1433666919, 1513488556,
-            4076628359, 3131437922, 2591339255, 2879649337, 653465273,  2258251940, 1515660567,
-            3883956901, 3161687764, 1540008302, 1379077870, 3292335930, 867863132,  1085182729,
-            3972165615, 225335533,  3240256682, 113947705,  1684991600, 3112908130, 1933652380,
-            1129236811, 2245283502, 2237170524, 1512166488, 1351722265, 1275984882, 2701183545,
-            2451662680, 860749040,  2031419778, 3063944107, 840927806,  376235355,  3793084516,
-            147832099,  1782957345, 3174668632, 378084966,  758123677,  1207299206, 2109300356,
-            327338204,  3104840245, 1941600378, 549933260,  2728925227, 3663649648, 3419006071,
-            2986146143, 2085492440, 2060140621, 3923501456, 345975882,  2001339851, 469811444,
-            3295554901, 3971403287, 3595528073, 2359735756, 1227979639, 2995420049, 2493622670,
-            3038263292, 4207981767, 896221880,  3039897667, 1219488603, 3179237655, 508111281,
-            3275768033, 3561641296, 3483037280, 1622969371, 3927103977, 3610422326, 1935470344,
-            1064230248, 1266906050, 2021464137, 101133510,  4091073338, 3117552596, 46197997,
-            4222290081, 3856573005, 1526929841, 2279350381, 2217580059, 1118365041, 4010564841,
-            3014686654, 4201679679, 2743637124, 3759592164, 435239521,  139829538,  3686259983,
-            3212562499, 945443850,  1588937298, 2521182179, 344809998,  4045786253, 802800547,
-            2012554448, 3492650120, 421224958,  645337691,  3052754223, 1615597080, 2488759907,
-            3050037518, 4024830794, 3939072297, 1556805946, 1678702244, 3919329899, 4274505193,
-            1965594447, 1530995384, 2222077475, 824916698,  4256443380, 1311067807, 247339198,
-            221889538,  2913092472, 1231151119, 1109471705, 2092495572, 2287783550, 4157587374,
-            524750755,  2206589971, 2237020361, 3879286316, 1366828916, 2570866655, 430701231,
-            3144768937, 1713472714, 3758549418, 131374386,  527516350,  4197408552, 3510209792,
-            2737166090, 3809457816, 2077456660, 2510862090, 137148507,  2422666678, 4179783899,
-            1945939738, 63357018,   56920448,   2738832978, 3762502451, 2762153693, 1513488556,
-            4076628359, 3131437922, 2591339255, 412074675,  653465273,  2258251940, 1515660567,
-            3883956901, 891503932,  1540008302, 1379077870, 3292335930, 867863132,  3355707961,
-            3972165615, 225335533,  3240256682, 113947705,  976572071,  3112908130, 1933652380,
-            1129236811, 2245283502, 3558605964, 1512166488, 1351722265, 1275984882, 2701183545,
-            3478271491, 860749040,  2031419778, 3063944107, 840927806,  3973313245, 3793084516,
-            147832099,  1782957345, 3174668632, 1799681836, 758123677,  1207299206, 2109300356,
-            327338204,  1881274779, 1941600378, 549933260,  2728925227, 3663649648, 3860972397,
-            2986146143, 2085492440, 2060140621, 3923501456, 2355716168, 2001339851, 469811444,
-            3295554901, 3971403287, 770126322,  2359735756, 1227979639, 2995420049, 2493622670,
-            4005034938, 4207981767, 896221880,  3039897667, 1219488603, 1026895905, 508111281,
-            3275768033, 3561641296, 3483037280, 2872251181, 3927103977, 3610422326, 1935470344,
-            1064230248, 3622546195, 2021464137, 101133510,  4091073338, 3117552596, 4000453928,
-            4222290081, 3856573005, 1526929841, 2279350381, 2285927070, 1118365041, 4010564841,
-            3014686654, 4201679679, 1575631376, 3759592164, 435239521,  139829538,  3686259983,
-            3062391425, 945443850,  1588937298, 2521182179, 344809998,  3080828502, 802800547,
-            2012554448, 3492650120, 421224958,  3457015322, 3052754223, 1615597080, 2488759907,
-            3050037518, 1657167655, 3939072297, 1556805946, 1678702244, 3919329899, 1565126557,
-            1965594447, 1530995384, 2222077475, 824916698,  3709572644, 1311067807, 247339198,
-            221889538,  2913092472, 2775732963, 1109471705, 2092495572, 2287783550, 4157587374,
-            1573809889, 2206589971, 2237020361, 3879286316, 1366828916, 1323074783, 430701231,
-            3144768937, 1713472714, 3758549418, 3944169255, 527516350,  4197408552, 3510209792,
-            2737166090, 3799552412, 2077456660, 2510862090, 137148507,  2422666678, 3939147827,
-            1945939738, 63357018,   56920448,   2738832978, 1643845443, 2762153693, 1513488556,
-            4076628359, 3131437922, 181841458,  412074675,  653465273,  2258251940, 1515660567,
-            1883094274, 891503932,  1540008302, 1379077870, 3292335930, 1513591486, 3355707961,
-            3972165615, 225335533,  3240256682, 2373030972, 976572071,  3112908130, 1933652380,
-            1129236811, 475554529,  3558605964, 1512166488, 1351722265, 1275984882, 2226867587,
-            3478271491, 860749040,  2031419778, 3063944107, 3957744262, 3973313245, 3793084516,
-            147832099,  1782957345, 1891097951, 1799681836, 758123677,  1207299206, 2109300356,
-            4069431582, 1881274779, 1941600378, 549933260,  2728925227, 287958428,  3860972397,
-            2986146143, 2085492440, 2060140621, 2210622177, 190604659,  2861160647, 2067710789,
-            2354205349, 1869980918, 3709010682, 2811841045, 2317774316, 1935604892, 4224978296,
-            1745564934, 3012766696, 856522047,  4206743264, 1607280692, 54199192,   2560906055,
-            3458082817, 1635943627, 83259354,   3600791679, 3451378550, 855817397,  3435607212,
-            2676070398, 4130143523, 1687051406, 1274211041, 1018639891, 2104017860, 558410281,
-            3052737647, 2088868764, 2886735665, 1640176525, 2245425518, 2516204455, 2077686170,
-            267388059,  2035991688, 4047157984, 696765429,  2358863633, 4248931292, 3192308174,
-            3940530660, 695966377,  2224885704, 3120784615, 2991750341, 1863759591, 749350334,
-            2341639452, 3767158306, 1817516157, 1384425400, 18915028,   3348531903, 2409932093,
-            3582608504, 950772721,  3169818245, 2039303663, 2797338161, 3792771755, 4227757895,
-            4082358067, 2832745676, 113426105,  1793424500, 1818581242, 3503135858, 3140833206,
-            3002345410, 4040974815, 3864095811, 2801408627, 3697629665, 3594604664, 2414327982,
-            1854753885, 2577932880, 3141027194, 2736432849, 1151763057, 2105882427, 13283655,
-            711511126,  851391817,  3684414122, 4069362199, 1699138426, 83405942,   302275299,
-            3019857791, 42616809,   103264582,  2188953575, 3337040598, 3164903954, 1956678174,
-            2814795747, 4280014215, 2498802155, 2013213077, 1692695763, 2446532792, 2130083285,
-            895801869,  3254847386, 2293892051, 2609985572, 3351608213, 3035077434, 1393395978,
-            2139000763, 301449643,  1286819178, 1595162934, 583970879,  2694478567, 1528515134,
-            1754263020, 1487052120, 1927305733, 1368670902, 3037945281, 3111046751, 1391023522,
-            1080928891, 195361092,  2057786632, 4122529803, 61692979,   1548663731, 1537870636,
-            109979055,  1100219058, 4247396738, 3630389350, 864369376,  3747006525, 1027811417,
-            898405754,  2919599247, 3736228304, 3052840700, 2563156577, 3744679655, 1469133278,
-            2770315456, 3577631067, 2793679137, 2252569069, 2204106012, 2457213056, 1951914989,
-            3316327090, 3118806122,
-        },
-        {
-            3975736867, 2402230281, 4092718962, 3100052505, 3277909563, 2827154828, 1067483357,
-            3495429909, 426635932,  2702495453, 725679489,  3705541400, 1308182381, 27549785,
-            3000675918, 2982141597, 1090931027, 755020243,  3986354189, 2529541113, 452574019,
-            2384876926, 2147764179, 1360907484, 2072364695, 3034185952, 2765119653, 3279755577,
-            3828140333, 582568392,  4228353628, 701214306,  2460043371, 3943376509, 2443090800,
-            2481277520, 859309333,  2928621220, 1933644685, 3803162893, 3310629548, 2361261213,
-            790233558,  2517540072, 2823327610, 2952921690, 3295251862, 1089451775, 2637751681,
-            1648031370, 1343061717, 2355026672, 67684812,   4019593497, 2636283634, 1051433451,
-            51111285,   15338687,   3779021741, 3987886044, 70037785,   2009147353, 4236701871,
-            928261128,  2185183571, 2793993680, 2975111058, 3730415022, 3316612678, 823585671,
-            4153354125, 509071385,  2056228251, 4034784810, 96820040,   169863045,  932848332,
-            2282651407, 747279843,  1387211022, 2410099142, 3394315084, 3191572807, 4073182500,
-            3768455462, 3712420663, 3000991259, 249137656,  2477445202, 3952155443, 392730170,
-            4208559971, 24751401,   661761054,  1574175475, 2715927647, 985309803,  2570053358,
-            619269634,  3890591314, 1129119636, 3133886450, 328788870,  3449809720, 1380118080,
-            2719792059, 691527418,  3487733607, 3819095050, 3367871088, 709089170,  1057897966,
-            1938975941, 4082466714, 251564920,  3083496965, 1040123365, 295024253,  2788334176,
-            3430095934, 3641758945, 2029993123, 3231254260, 150555625,  2270671577, 2032382533,
-            2088497043, 1392075576, 644811077,  2122632989, 3224165725, 1571908345, 2558692460,
-            1493305706, 4064652450, 448105905,  699188129,  2017324335, 4286307548, 2415725473,
-            3976741021, 3526784185, 2882973520, 3420335125, 2034028744, 1425242390, 982315917,
-            2614735561, 2439972944, 2518992720, 3792239985, 3260669732, 2586472751, 3432756715,
-            1318634102, 3722487277, 3037304631, 433233786,  3750002877, 2504731459, 1111327015,
-            3975736867, 2402230281, 4092718962, 3100052505, 3521430425, 2827154828, 1067483357,
-            3495429909, 426635932,  2034644068, 725679489,  3705541400, 1308182381, 27549785,
-            3001720496, 2982141597, 1090931027, 755020243,  3986354189, 307638580,  452574019,
-            2384876926, 2147764179, 1360907484, 1701580099, 3034185952, 2765119653, 3279755577,
-            3828140333, 2659043235, 4228353628, 701214306,  2460043371, 3943376509, 2084857792,
-            2481277520, 859309333,  2928621220, 1933644685, 4152646669, 3310629548, 2361261213,
-            790233558,  2517540072, 481283060,  2952921690, 3295251862, 1089451775, 2637751681,
-            2915212660, 1343061717, 2355026672, 67684812,   4019593497, 3290479436, 1051433451,
-            51111285,   15338687,   3779021741, 1430944862, 70037785,   2009147353, 4236701871,
-            928261128,  2063919641, 2793993680, 2975111058, 3730415022, 3316612678, 2373806232,
-            4153354125, 509071385,  2056228251, 4034784810, 1912268707, 169863045,  932848332,
-            2282651407, 747279843,  3712980941, 2410099142, 3394315084, 3191572807, 4073182500,
-            4262344652, 3712420663, 3000991259, 249137656,  2477445202, 3374467273, 392730170,
-            4208559971, 24751401,   661761054,  1670592959, 2715927647, 985309803,  2570053358,
-            619269634,  830547082,  1129119636, 3133886450, 328788870,  3449809720, 202644333,
-            2719792059, 691527418,  3487733607, 3819095050, 1400269159, 709089170,  1057897966,
-            1938975941, 4082466714, 3393893128, 3083496965, 1040123365, 295024253,  2788334176,
-            1219456,    3641758945, 2029993123, 3231254260, 150555625,  3713963210, 2032382533,
-            2088497043, 1392075576, 644811077,  3733090890, 3224165725, 1571908345, 2558692460,
-            1493305706, 1678929187, 448105905,  699188129,  2017324335, 4286307548, 3368868963,
-            3976741021, 3526784185, 2882973520, 3420335125, 3233347584, 1425242390, 982315917,
-            2614735561, 2439972944, 4172908214, 3792239985, 3260669732, 2586472751, 3432756715,
-            1926157640, 3722487277, 3037304631, 433233786,  3750002877, 625648993,  1111327015,
-            3975736867, 2402230281, 4092718962, 1349560774, 3521430425, 2827154828, 1067483357,
-            3495429909, 2808148912, 2034644068, 725679489,  3705541400, 1308182381, 212242504,
-            3001720496, 2982141597, 1090931027, 755020243,  2510536004, 307638580,  452574019,
-            2384876926, 2147764179, 3227931749, 1701580099, 3034185952, 2765119653, 3279755577,
-            1054678914, 2659043235, 4228353628, 701214306,  2460043371, 381309305,  2084857792,
-            2481277520, 859309333,  2928621220, 891630344,  4152646669, 3310629548, 2361261213,
-            790233558,  1490030690, 481283060,  2952921690, 3295251862, 1089451775, 2025962691,
-            2915212660, 1343061717, 2355026672, 67684812,   2217081575, 3290479436, 1051433451,
-            51111285,   15338687,   3455020635, 1430944862, 70037785,   2009147353, 4236701871,
-            1155691935, 2063919641, 2793993680, 2975111058, 3730415022, 403147571,  2373806232,
-            4153354125, 509071385,  2056228251, 444685935,  1912268707, 169863045,  932848332,
-            2282651407, 2077207745, 3712980941, 2410099142, 3394315084, 3191572807, 640536184,
-            4262344652, 3712420663, 3000991259, 249137656,  368243227,  3374467273, 392730170,
-            4208559971, 24751401,   495648080,  1670592959, 2715927647, 985309803,  2570053358,
-            2181488546, 830547082,  1129119636, 3133886450, 328788870,  2497762979, 202644333,
-            2719792059, 691527418,  3487733607, 1976943620, 1400269159, 709089170,  1057897966,
-            1938975941, 2071351862, 3393893128, 3083496965, 1040123365, 295024253,  1440317859,
-            1219456,    3641758945, 2029993123, 3231254260, 952956380,  3713963210, 2032382533,
-            2088497043, 1392075576, 4180475645, 3733090890, 3224165725, 1571908345, 2558692460,
-            3482549931, 1678929187, 448105905,  699188129,  2017324335, 2431113987, 3368868963,
-            3976741021, 3526784185, 2882973520, 1900625235, 3233347584, 1425242390, 982315917,
-            2614735561, 1128074864, 4172908214, 3792239985, 3260669732, 2586472751, 4095880420,
-            1926157640, 3722487277, 3037304631, 433233786,  2927295412, 625648993,  1111327015,
-            3975736867, 2402230281, 259216032,  1349560774, 3521430425, 2827154828, 1067483357,
-            989690947,  2808148912, 2034644068, 725679489,  3705541400, 588787520,  212242504,
-            3001720496, 2982141597, 1090931027, 1235811382, 2510536004, 307638580,  452574019,
-            2384876926, 3536994565, 3227931749, 1701580099, 3034185952, 2765119653, 463890041,
-            1054678914, 2659043235, 4228353628, 701214306,  3085494195, 381309305,  2084857792,
-            2481277520, 859309333,  3760199179, 891630344,  4152646669, 3310629548, 2361261213,
-            2550680915, 1490030690, 481283060,  2952921690, 3295251862, 4195487760, 2025962691,
-            2915212660, 1343061717, 2355026672, 339445869,  2217081575, 3290479436, 1051433451,
-            51111285,   1113202216, 3455020635, 1430944862, 70037785,   2009147353, 3982848623,
-            1155691935, 2063919641, 2793993680, 2975111058, 1725337613, 403147571,  2373806232,
-            4153354125, 509071385,  1474832043, 444685935,  1912268707, 169863045,  932848332,
-            1500855137, 2077207745, 3712980941, 2410099142, 3394315084, 2800379966, 640536184,
-            4262344652, 3712420663, 3000991259, 1028021485, 368243227,  3374467273, 392730170,
-            4208559971, 108468246,  495648080,  1670592959, 2715927647, 985309803,  61959589,
-            2181488546, 830547082,  1129119636, 3133886450, 3912020361, 2497762979, 202644333,
-            2719792059, 691527418,  1984193076, 1976943620, 1400269159, 709089170,  1057897966,
-            2381612490, 2071351862, 3393893128, 3083496965, 1040123365, 391784014,  1440317859,
-            1219456,    3641758945, 2029993123, 2260373342, 952956380,  3713963210, 2032382533,
-            2088497043, 135943164,  4180475645, 3733090890, 3224165725, 1571908345, 2660287325,
-            3482549931, 1678929187, 448105905,  699188129,  4104693318, 2431113987, 3368868963,
-            3976741021, 3526784185, 113762138,  1900625235, 3233347584, 1425242390, 982315917,
-            599246177,  1128074864, 4172908214, 3792239985, 3260669732, 2309689974, 4095880420,
-            1926157640, 3722487277, 3037304631, 3765223460, 866296319,  1169380319, 2919436659,
-            3370646420, 1866719277, 3226685069, 4252262342, 1835269960, 1170376930, 1357078768,
-            269175192,  3826888026, 3430363541, 1920758494, 51532769,   2919489927, 1568325914,
-            3184357856, 43519013,   2108988015, 1398495041, 2844640139, 2317092036, 1774750014,
-            2690907136, 1834465421, 1106469655, 2149810726, 4265420439, 2048218411, 1399986034,
-            1361619115, 2504769226, 913700780,  2382994726, 4292849877, 1381838410, 250258264,
-            1828569640, 1732718872, 1869949326, 835188347,  4180489913, 3049522050, 535168392,
-            3972173823, 2763844722, 3401884753, 3750694101, 851518496,  1015521371, 1511969218,
-            1597622074, 3810841601, 3326003776, 3141062630, 552856274,  4059179808, 175647012,
-            3893497501, 1805118717, 1064213711, 2310866839, 1397146463, 1798096676, 279868399,
-            1926726615, 2773068510, 347721208,  4099183723, 509136218,  2833615756, 3960499694,
-            4236258712, 1765641675, 535748563,  354515646,  3307314159, 3160079941, 3252681800,
-            2568363625, 3818514182, 3738662353, 899056999,  2531772068, 647726503,  2895823632,
-            393777910,  1759531813, 2363148604, 2931477989, 3381169914, 3877595131, 2375539210,
-            557544627,  273611522,  2717517554, 1935966767, 1738732887, 29153600,   20993454,
-            3758163226, 1692844400, 2176938194, 378940221,  2888599759, 1173120554, 2732575460,
-            3912766812, 522606644,  1925230852, 3887440328, 2111843275, 3549473366, 922916775,
-            2889744544, 2970467682, 3039277863, 990580154,  55435595,   1665634070, 3043418336,
-            2792050230, 2762503138, 1402344059, 2099263558, 3945248675, 3925566467, 2413979948,
-            463637252,  3768636616, 3374572388, 2217956879, 791988933,  382210765,  1715859444,
-            3462446413, 971427992,  3255404695, 2001750035, 2214129237, 320812374,  3688098101,
-            920365480,  2819401059, 2932570681, 3749857130, 523943786,  1271514748, 4078439472,
-            3501181265, 2475869985, 1797996951, 2300820710, 3994893924, 1739992082, 2475950326,
-            3780826558, 1018851411,
-        },
-        {
-            1219887726, 3862043216, 367129926,  2453522862, 2146675732, 2972661402, 3845231447,
-            97196594,   1340961174, 2829518343, 1063330936, 403257889,  915587118,  2381346843,
-            2431420401, 3306391783, 3324042241, 2314612159, 4044754459, 1000014215, 4071238294,
-            3655634380, 956965679,  1699932996, 101734734,  1216770709, 3405063009, 1559159408,
-            3417550338, 816805974,  2806528182, 2650565416, 809306876,  2154391267, 1558728913,
-            1433626387, 3029188464, 810809939,  297540863,  482219905,  2279793916, 3063447927,
-            4010687009, 2169687488, 1935310889, 1078162659, 1349095396, 239030847,  329469291,
-            1030250338, 2078499551, 3944927720, 2097700967, 2820924992, 356274459,  2535676164,
-            4122411747, 3538238380, 3960242034, 919499429,  2205012525, 3459321083, 3767658716,
-            798328787,  3927714671, 1141788184, 4104395816, 773542921,  1891547487, 3477117342,
-            3114039309, 2201750598, 1009468488, 3865618206, 3616044236, 2436433684, 2007386719,
-            3993792108, 328251153,  2486511242, 4046509502, 3787343066, 3774009359, 3215143088,
-            1857747700, 1867719010, 1818357818, 2017336474, 635476555,  3804447358, 1725794761,
-            1730849616, 901897956,  3611976264, 793511422,  1445982724, 3601735456, 2050417968,
-            2737732043, 22038380,   1852805812, 2958630773, 4068503081, 3917685966, 183240182,
-            749987375,  3750296466, 1102885973, 1838003824, 3627771567, 3963001280, 1340603885,
-            452264661,  2200342940, 3689868348, 2131786113, 1198665712, 179905783,  3867495863,
-            3760631124, 3169961613, 3648298407, 1314845838, 3835061776, 1123207709, 2495741675,
-            2820454995, 425969317,  4230555295, 332551491,  3666531192, 637906952,  1893655042,
-            1437945135, 374937546,  3875218170, 261598558,  3939942413, 1652345263, 2691874176,
-            1121115997, 619400041,  1351455976, 1028076458, 543989893,  3243066822, 2701710084,
-            3686897084, 2682384530, 1654474076, 911769458,  1573386461, 4231263283, 1387625476,
-            1168645550, 2736037627, 810025038,  2202962438, 3361490947, 2357671672, 2639807544,
-            1219887726, 3862043216, 367129926,  2453522862, 168393587,  2972661402, 3845231447,
-            97196594,   1340961174, 2550914413, 1063330936, 403257889,  915587118,  2381346843,
-            2452585263, 3306391783, 3324042241, 2314612159, 4044754459, 3676098130, 4071238294,
-            3655634380, 956965679,  1699932996, 858265562,  1216770709, 3405063009, 1559159408,
-            3417550338, 2460236184, 2806528182, 2650565416, 809306876,  2154391267, 238170210,
-            1433626387, 3029188464, 810809939,  297540863,  1320184364, 2279793916, 3063447927,
-            4010687009, 2169687488, 263956972,  1078162659, 1349095396, 239030847,  329469291,
-            290216180,  2078499551, 3944927720, 2097700967, 2820924992, 187730801,  2535676164,
-            4122411747, 3538238380, 3960242034, 3700801711, 2205012525, 3459321083, 3767658716,
-            798328787,  3166932774, 1141788184, 4104395816, 773542921,  1891547487, 4051205746,
-            3114039309, 2201750598, 1009468488, 3865618206, 2005172321, 2436433684, 2007386719,
-            3993792108, 328251153,  515152229,  4046509502, 3787343066, 3774009359, 3215143088,
-            2698152444, 1867719010, 1818357818, 2017336474, 635476555,  1665990333, 1725794761,
-            1730849616, 901897956,  3611976264, 2785679374, 1445982724, 3601735456, 2050417968,
-            2737732043, 560929887,  1852805812, 2958630773, 4068503081, 3917685966, 3822108100,
-            749987375,  3750296466, 1102885973, 1838003824, 757747669,  3963001280, 1340603885,
-            452264661,  2200342940, 3806912193, 2131786113, 1198665712, 179905783,  3867495863,
-            1221395868, 3169961613, 3648298407, 1314845838, 3835061776, 472648495,  2495741675,
-            2820454995, 425969317,  4230555295, 3323155260, 3666531192, 637906952,  1893655042,
-            1437945135, 2209053550, 3875218170, 261598558,  3939942413, 1652345263, 1405493073,
-            1121115997, 619400041,  1351455976, 1028076458, 3450998856, 3243066822, 2701710084,
-            3686897084, 2682384530, 3707273080, 911769458,  1573386461, 4231263283, 1387625476,
-            1435570635, 2736037627, 810025038,  2202962438, 3361490947, 1600593823, 2639807544,
-            1219887726, 3862043216, 367129926,  3267507504, 168393587,  2972661402, 3845231447,
-            97196594,   1480035177, 2550914413, 1063330936, 403257889,  915587118,  1322062607,
-            2452585263, 3306391783, 3324042241, 2314612159, 2626385057, 3676098130, 4071238294,
-            3655634380, 956965679,  958865037,  858265562,  1216770709, 3405063009, 1559159408,
-            1912825710, 2460236184, 2806528182, 2650565416, 809306876,  452133178,  238170210,
-            1433626387, 3029188464, 810809939,  2732434905, 1320184364, 2279793916, 3063447927,
-            4010687009, 1155587248, 263956972,  1078162659, 1349095396, 239030847,  3477680910,
-            290216180,  2078499551, 3944927720, 2097700967, 3228862472, 187730801,  2535676164,
-            4122411747, 3538238380, 2604158212, 3700801711, 2205012525, 3459321083, 3767658716,
-            3153283330, 3166932774, 1141788184, 4104395816, 773542921,  3324280258, 4051205746,
-            3114039309, 2201750598, 1009468488, 158155894,  2005172321, 2436433684, 2007386719,
-            3993792108, 4077931771, 515152229,  4046509502, 3787343066, 3774009359, 2441673689,
-            2698152444, 1867719010, 1818357818, 2017336474, 2006434256, 1665990333, 1725794761,
-            1730849616, 901897956,  3983657099, 2785679374, 1445982724, 3601735456, 2050417968,
-            3637463694, 560929887,  1852805812, 2958630773, 4068503081, 393543100,  3822108100,
-            749987375,  3750296466, 1102885973, 395885369,  757747669,  3963001280, 1340603885,
-            452264661,  825130304,  3806912193, 2131786113, 1198665712, 179905783,  925405832,
-            1221395868, 3169961613, 3648298407, 1314845838, 3957019271, 472648495,  2495741675,
-            2820454995, 425969317,  3545680073, 3323155260, 3666531192, 637906952,  1893655042,
-            3606926296, 2209053550, 3875218170, 261598558,  3939942413, 3851700786, 1405493073,
-            1121115997, 619400041,  1351455976, 1182107720, 3450998856, 3243066822, 2701710084,
-            3686897084, 793180366,  3707273080, 911769458,  1573386461, 4231263283, 572633731,
-            1435570635, 2736037627, 810025038,  2202962438, 2787625789, 1600593823, 2639807544,
-            1219887726, 3862043216, 1915455894, 3267507504, 168393587,  2972661402, 3845231447,
-            2067098820, 1480035177, 2550914413, 1063330936, 403257889,  475971400,  1322062607,
-            2452585263, 3306391783, 3324042241, 3994752212, 2626385057, 3676098130, 4071238294,
-            3655634380, 3741771980, 958865037,  858265562,  1216770709, 3405063009, 3945860517,
-            1912825710, 2460236184, 2806528182, 2650565416, 2630828417, 452133178,  238170210,
-            1433626387, 3029188464, 3650216744, 2732434905, 1320184364, 2279793916, 3063447927,
-            969414817,  1155587248, 263956972,  1078162659, 1349095396, 3596909563, 3477680910,
-            290216180,  2078499551, 3944927720, 590036411,  3228862472, 187730801,  2535676164,
-            4122411747, 2624794097, 2604158212, 3700801711, 2205012525, 3459321083, 2787298124,
-            3153283330, 3166932774, 1141788184, 4104395816, 2946786077, 3324280258, 4051205746,
-            3114039309, 2201750598, 1304979198, 158155894,  2005172321, 2436433684, 2007386719,
-            189461948,  4077931771, 515152229,  4046509502, 3787343066, 1479769087, 2441673689,
-            2698152444, 1867719010, 1818357818, 3580297103, 2006434256, 1665990333, 1725794761,
-            1730849616, 2601777557, 3983657099, 2785679374, 1445982724, 3601735456, 4255950853,
-            3637463694, 560929887,  1852805812, 2958630773, 678707940,  393543100,  3822108100,
-            749987375,  3750296466, 2028201696, 395885369,  757747669,  3963001280, 1340603885,
-            3727442737, 825130304,  3806912193, 2131786113, 1198665712, 3437707628, 925405832,
-            1221395868, 3169961613, 3648298407, 3655976701, 3957019271, 472648495,  2495741675,
-            2820454995, 3679808338, 3545680073, 3323155260, 3666531192, 637906952,  3309782548,
-            3606926296, 2209053550, 3875218170, 261598558,  317884070,  3851700786, 1405493073,
-            1121115997, 619400041,  761623007,  1182107720, 3450998856, 3243066822, 2701710084,
-            4015128797, 793180366,  3707273080, 911769458,  1573386461, 1899101002, 572633731,
-            1435570635, 2736037627, 810025038,  3764069570, 2014194973, 3758354958, 3787338296,
-            3821110296, 107560594,  1844435035, 1916681120, 2655886892, 2359586387, 3814239685,
-            1747239529, 1037257270, 921344043,  165545312,  493063604,  1264056065, 572455811,
-            3656758222, 2840895584, 1047708386, 3345662092, 2632287246, 1254732878, 3002887622,
-            430796639,  3709064907, 3866812159, 2747713253, 660792637,  4031316840, 230687542,
-            2469531504, 5617971,    3917146109, 1248511485, 662970253,  1774465890, 3048381257,
-            2099734890, 386078394,  3338940451, 221314578,  178254622,  2752563010, 465064280,
-            38672057,   1989414848, 3424801101, 2626759977, 381160955,  3975244584, 29593563,
-            1315399288, 1589628974, 4045511665, 1421028821, 3527710793, 2649134384, 2414589014,
-            160875953,  1760127976, 1226794784, 695062688,  3234889835, 540958528,  809158089,
-            3037591393, 284166279,  3196162662, 741154088,  578541565,  1592308055, 1799083145,
-            904249479,  2260306847, 1183006100, 1150453256, 2234415202, 1555447956, 4245455784,
-            3134079436, 3169285935, 1792049894, 3744241452, 3055964613, 1053064106, 423522496,
-            3934246137, 1693410296, 2717034952, 3132562280, 3299548076, 3879889923, 3020614288,
-            2381500661, 192741354,  3057155595, 1218527202, 1442478231, 1283995608, 4114184728,
-            3364056236, 1154269300, 1437062108, 3503378832, 3060986035, 1402154437, 3787691619,
-            2389148006, 3458420015, 160153876,  1084590354, 898961242,  3172337310, 496883338,
-            1345669482, 1486051815, 1265939825, 2056993544, 1142810053, 3849673786, 2904600711,
-            2131001628, 182086855,  1322771399, 4069859530, 1367344738, 1125642538, 350217198,
-            3209390811, 1589048127, 1478150557, 1689620484, 2558211745, 2474958033, 965242317,
-            4044304983, 1325398008, 3251534344, 1838151827, 2138930741, 2598974471, 3375311702,
-            2348676107, 1705706992, 1221489711, 247200871,  3272207407, 38054377,   984150710,
-            3589993067, 4206627493, 642020829,  270273199,  1867249416, 511315010,  1012645569,
-            1774890762, 3403559409,
-        },
-};
@@ -0,0 +1,96 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef SUBTENSOR_WORK_LENGTHS_H
+#define SUBTENSOR_WORK_LENGTHS_H
+
+// Split of the grid over the dimensions of the sub-tensor kernels. Work-item i of dimension d
+// handles the indices i, i + WORK_LENGTH_d, i + 2 * WORK_LENGTH_d, ... of that dimension.
+//
+// By default the split is computed on the host for one shape and baked in with -DWORK_LENGTH_d.
+// With SUBTENSOR_DYNAMIC_WORK the kernels compute it from their length arguments and the grid
+// size instead, so the same binary serves every shape of a given rank. The innermost dimensions
+// get their work-items first, and work-items left over by the split exit immediately.
+
+#ifndef SUBTENSOR_DYNAMIC_WORK
+#define SUBTENSOR_DYNAMIC_WORK 0
+#endif
+
+#if SUBTENSOR_DYNAMIC_WORK
+
+#define WORK_LENGTH_0 work_length[0]
+#define WORK_LENGTH_1 work_length[1]
+#define WORK_LENGTH_2 work_length[2]
+#define WORK_LENGTH_3 work_length[3]
+#define WORK_LENGTH_4 work_length[4]
+
+#define SUBTENSOR_WORK_LENGTHS(len0, len1, len2, len3, len4)                       \
+    uint work_length[5];                                                           \
+    {                                                                              \
+        const uint lens[5] = {                                                     \
+            (uint)(len0), (uint)(len1), (uint)(len2), (uint)(len3), (uint)(len4)}; \
+        uint remaining = (uint)get_global_size(0);                                 \
+        for(int d = 4; d >= 0; --d)                                                \
+        {                                                                          \
+            work_length[d] = max(min(lens[d], remaining), 1u);                     \
+            remaining /= work_length[d];                                           \
+        }                                                                          \
+    }                                                                              \
+    if(get_global_id(0) >= WORK_LENGTH_0 * WORK_STRIDE_0)                          \
+        return;
+
+#else
+
+#ifndef WORK_LENGTH_0
+#define WORK_LENGTH_0 1
+#endif
+
+#ifndef WORK_LENGTH_1
+#define WORK_LENGTH_1 1
+#endif
+
+#ifndef WORK_LENGTH_2
+#define WORK_LENGTH_2 1
+#endif
+
+#ifndef WORK_LENGTH_3
+#define WORK_LENGTH_3 1
+#endif
+
+#ifndef WORK_LENGTH_4
+#define WORK_LENGTH_4 1
+#endif
+
+#define SUBTENSOR_WORK_LENGTHS(len0, len1, len2, len3, len4)
+
+#endif
+
+#define WORK_STRIDE_4 1
+#define WORK_STRIDE_3 (WORK_LENGTH_4 * WORK_STRIDE_4)
+#define WORK_STRIDE_2 (WORK_LENGTH_3 * WORK_STRIDE_3)
+#define WORK_STRIDE_1 (WORK_LENGTH_2 * WORK_STRIDE_2)
+#define WORK_STRIDE_0 (WORK_LENGTH_1 * WORK_STRIDE_1)
+
+#endif // SUBTENSOR_WORK_LENGTHS_H
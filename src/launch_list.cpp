@@ -0,0 +1,89 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/launch_list.hpp>
+#include <miopen/handle.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <string>
+
+namespace miopen {
+
+std::size_t LaunchList::Rebind(const std::vector<LaunchBinding>& bindings)
+{
+    std::size_t moved = 0;
+    for(auto& launch : launches)
+    {
+        for(const auto offset : launch.pointer_offsets)
+        {
+            std::uintptr_t ptr;
+            std::memcpy(&ptr, launch.args.data() + offset, sizeof(ptr));
+
+            for(const auto& binding : bindings)
+            {
+                const auto from = reinterpret_cast<std::uintptr_t>(binding.from);
+                if(ptr < from || ptr - from >= binding.size)
+                    continue;
+
+                const auto to = reinterpret_cast<std::uintptr_t>(binding.to) + (ptr - from);
+                std::memcpy(launch.args.data() + offset, &to, sizeof(to));
+                moved++;
+                break;
+            }
+        }
+    }
+    return moved;
+}
+
+CapturedLaunch CaptureCopy(ConstData_t src, Data_t dest, std::size_t size)
+{
+    constexpr std::size_t ptr_size = sizeof(Data_t);
+    auto launch                    = CapturedLaunch{};
+    launch.args.resize(2 * ptr_size);
+    std::memcpy(launch.args.data(), &src, ptr_size);
+    std::memcpy(launch.args.data() + ptr_size, &dest, ptr_size);
+    launch.pointer_offsets = {0, ptr_size};
+    launch.call            = [size](const Handle& handle, const std::vector<char>& args) {
+        ConstData_t from;
+        Data_t to;
+        std::memcpy(&from, args.data(), ptr_size);
+        std::memcpy(&to, args.data() + ptr_size, ptr_size);
+        handle.Copy(from, to, size);
+    };
+    return launch;
+}
+
+std::ostream& operator<<(std::ostream& stream, const LaunchList& list)
+{
+    stream << list.launches.size() << " launches:";
+    for(const auto& launch : list.launches)
+        stream << ' ' << (launch.call ? std::string{"<call>"} : launch.invoke.GetName());
+    return stream;
+}
+
+} // namespace miopen
@@ -0,0 +1,175 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/layout_transform_plan.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/tensor.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <ostream>
+#include <tuple>
+
+namespace miopen {
+
+std::string ToString(LayoutTransformKind kind)
+{
+    switch(kind)
+    {
+    case LayoutTransformKind::View: return "View";
+    case LayoutTransformKind::BatchedTranspose: return "BatchedTranspose";
+    case LayoutTransformKind::Generic: return "Generic";
+    }
+    return "<Unknown>";
+}
+
+std::size_t LayoutTransformPlan::GetElementSize() const
+{
+    return std::accumulate(lens.begin(), lens.end(), std::size_t{1}, std::multiplies<>());
+}
+
+bool LayoutTransformPlan::IsContiguous() const
+{
+    return kind == LayoutTransformKind::View && lens.size() == 1 && x_strides[0] == 1;
+}
+
+static std::vector<std::size_t> GetPackedStrides(const std::vector<std::size_t>& lens)
+{
+    std::vector<std::size_t> strides(lens.size());
+    std::size_t stride = 1;
+    for(auto i = lens.size(); i-- > 0;)
+    {
+        strides[i] = stride;
+        stride *= lens[i];
+    }
+    return strides;
+}
+
+LayoutTransformPlan LayoutTransformPlan::Make(const TensorDims& lens,
+                                              const TensorDims& x_strides,
+                                              const TensorDims& y_strides)
+{
+    const auto ndims = lens.size();
+    if(x_strides.size() != ndims || y_strides.size() != ndims)
+        MIOPEN_THROW(miopenStatusBadParm, "Number of dims in x and y Tensors do not match");
+
+    LayoutTransformPlan plan;
+
+    // nothing to move
+    if(std::find(lens.begin(), lens.end(), 0) != lens.end())
+    {
+        plan.kind      = LayoutTransformKind::View;
+        plan.lens      = {0};
+        plan.x_strides = {1};
+        plan.y_strides = {1};
+        return plan;
+    }
+
+    using Dim = std::tuple<std::size_t, std::size_t, std::size_t>; // y stride, x stride, len
+    std::vector<Dim> dims;
+    for(std::size_t i = 0; i < ndims; i++)
+    {
+        if(lens[i] != 1)
+            dims.emplace_back(y_strides[i], x_strides[i], lens[i]);
+    }
+    std::stable_sort(dims.begin(), dims.end(), std::greater<>{});
+
+    for(const auto& dim : dims)
+    {
+        std::size_t y_stride, x_stride, len;
+        std::tie(y_stride, x_stride, len) = dim;
+
+        // the previous dimension steps over exactly one run of this one in both tensors
+        if(!plan.lens.empty() && plan.x_strides.back() == len * x_stride &&
+           plan.y_strides.back() == len * y_stride)
+        {
+            plan.lens.back() *= len;
+            plan.x_strides.back() = x_stride;
+            plan.y_strides.back() = y_stride;
+            continue;
+        }
+
+        plan.lens.push_back(len);
+        plan.x_strides.push_back(x_stride);
+        plan.y_strides.push_back(y_stride);
+    }
+
+    // every dimension has length 1
+    if(plan.lens.empty())
+    {
+        plan.lens      = {1};
+        plan.x_strides = {1};
+        plan.y_strides = {1};
+    }
+
+    if(plan.x_strides == plan.y_strides)
+    {
+        plan.kind = LayoutTransformKind::View;
+        return plan;
+    }
+
+    // y is packed and x walks its last two dimensions the other way around
+    const auto rank = plan.lens.size();
+    if((rank == 2 || rank == 3) && plan.y_strides == GetPackedStrides(plan.lens))
+    {
+        const auto rows    = plan.lens[rank - 2];
+        const auto columns = plan.lens[rank - 1];
+        const auto& xs     = plan.x_strides;
+        if(xs[rank - 1] == rows && xs[rank - 2] == 1 &&
+           (rank == 2 || xs[0] == rows * columns))
+        {
+            plan.kind   = LayoutTransformKind::BatchedTranspose;
+            plan.batch  = rank == 3 ? plan.lens[0] : 1;
+            plan.height = columns;
+            plan.width  = rows;
+        }
+    }
+
+    return plan;
+}
+
+LayoutTransformPlan LayoutTransformPlan::Make(const TensorDescriptor& xDesc,
+                                              const TensorDescriptor& yDesc)
+{
+    if(xDesc.GetLengths() != yDesc.GetLengths())
+        MIOPEN_THROW(miopenStatusBadParm, "Tensor x and y lengths do not match");
+
+    return Make(yDesc.GetLengths(), xDesc.GetStrides(), yDesc.GetStrides());
+}
+
+std::ostream& operator<<(std::ostream& stream, const LayoutTransformPlan& plan)
+{
+    stream << ToString(plan.kind) << " lens ";
+    LogRange(stream, plan.lens, "x") << " x ";
+    LogRange(stream, plan.x_strides, ",") << " y ";
+    LogRange(stream, plan.y_strides, ",");
+    if(plan.kind == LayoutTransformKind::BatchedTranspose)
+        stream << " batch " << plan.batch << " height " << plan.height << " width " << plan.width;
+    return stream;
+}
+
+} // namespace miopen
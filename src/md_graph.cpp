@@ -33,11 +33,58 @@
 #endif
 #include <miopen/db.hpp>
 
+#include <map>
+#include <mutex>
+
 MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_AMD_FUSED_WINOGRAD)
 MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_GCN_ASM_KERNELS)
 
 namespace miopen {
 
+/// Edges from one vertex to another, each given by the ids of its constraints
+struct MDGraph_transition
+{
+    MDGraph_vertex_ptr dst;
+    std::vector<std::vector<std::size_t>> edges;
+};
+
+/// Metadata graph of one first operator frozen into a transition table. The constraint
+/// strings are parsed once when the graph is built; advancing a plan only evaluates their
+/// compiled form over integer symbol ids.
+struct FusionMDGraph_Table
+{
+    static std::shared_ptr<const FusionMDGraph_Table> Get(miopenFusionOp_t op);
+
+    MDGExprSymbols symbols;
+    int weight_sym = -1;
+    int algo_sym   = -1;
+    std::vector<MDGExprConstraint> constraints;
+    std::vector<MDGraph_vertex_ptr> vertices; // indexed by graph_idx, vertices[0] is the root
+    std::vector<std::vector<MDGraph_transition>> transitions; // indexed by graph_idx of the src
+};
+
+namespace {
+
+// Collects the edges of a metadata graph before it is frozen
+struct FusionMDGraph_Builder
+{
+    struct Edge
+    {
+        MDGraph_vertex_ptr src;
+        MDGraph_vertex_ptr dst;
+        FusionMDGraph_Edge_Map map;
+    };
+
+    void AddEdge(MDGraph_vertex_ptr src, MDGraph_vertex_ptr dst, FusionMDGraph_Edge_Map& map)
+    {
+        edges.push_back({std::move(src), std::move(dst), map});
+    }
+
+    std::vector<Edge> edges;
+};
+
+} // namespace
+
 int MDGraph_vertex::running_id = 1; // NOLINT (cppcoreguidelines-avoid-non-const-global-variables)
 
 MDGraph_vertex::MDGraph_vertex(miopenFusionOp_t o,
@@ -84,9 +131,9 @@ MDGraph_vertex_ptr FusionMDGraph::GetCurVertex(const Handle& handle)
 
         auto xnack_sup = !(cur.first->supported_xnack && target.Xnack() &&
                            *cur.first->supported_xnack != *target.Xnack());
-        if((boost::any_cast<int>(cur.second["weight"]) > weight) && arch_sup && xnack_sup)
+        if((cur.second.weight > weight) && arch_sup && xnack_sup)
         {
-            weight = boost::any_cast<int>(cur.second["weight"]);
+            weight = cur.second.weight;
             ptr    = cur.first;
         }
     }
@@ -98,19 +145,18 @@ std::vector<solver::AnySolver> FusionMDGraph::GetSolvers()
     // sort according to the edge weight
     std::sort(cur_vertex.begin(),
               cur_vertex.end(),
-              [&](const std::pair<MDGraph_vertex_ptr, cur_vertex_map>& a,
-                  const std::pair<MDGraph_vertex_ptr, cur_vertex_map>& b) {
-                  return boost::any_cast<int>(a.second.at("weight")) >
-                         boost::any_cast<int>(b.second.at("weight"));
+              [&](const std::pair<MDGraph_vertex_ptr, MDGraph_path>& a,
+                  const std::pair<MDGraph_vertex_ptr, MDGraph_path>& b) {
+                  return a.second.weight > b.second.weight;
               });
 
     // return a vector of just the solvers
     std::vector<solver::AnySolver> res;
     for(auto& cur : cur_vertex)
     {
-        if(cur.second.find("solver") != cur.second.end())
+        if(!cur.second.solver.IsEmpty())
         {
-            res.push_back(boost::any_cast<solver::AnySolver>(cur.second.at("solver")));
+            res.push_back(cur.second.solver);
         }
     }
     return res;
@@ -122,7 +168,7 @@ std::string FusionMDGraph::GetProgramName(const Handle& handle)
 
     if(ptr != nullptr)
     {
-        return ptr->vertex_data["program"];
+        return ptr->vertex_data.at("program");
     }
     else
     {
@@ -136,7 +182,7 @@ std::string FusionMDGraph::GetKernelName(const Handle& handle)
     auto ptr = GetCurVertex(handle);
     if(ptr != nullptr)
     {
-        return ptr->vertex_data["kernel"];
+        return ptr->vertex_data.at("kernel");
     }
     else
     {
@@ -150,7 +196,7 @@ std::string FusionMDGraph::GetAlgoName(const Handle& handle)
     auto ptr = GetCurVertex(handle);
     if(ptr != nullptr)
     {
-        return ptr->vertex_data["algorithm"];
+        return ptr->vertex_data.at("algorithm");
     }
     else
     {
@@ -195,17 +241,16 @@ bool FusionMDGraph::SetConvAlgo(miopenConvFwdAlgorithm_t algo)
         MIOPEN_THROW(miopenStatusBadParm,
                      "The last convolution operator does not support the requested algorithm");
     }
-    std::vector<std::pair<MDGraph_vertex_ptr, cur_vertex_map>> new_list;
+    std::vector<std::pair<MDGraph_vertex_ptr, MDGraph_path>> new_list;
 
     for(auto& kinder : cur_vertex)
     {
-        auto& cur_map = kinder.second;
-        if(cur_map.find("algo") != cur_map.end())
+        const auto& path = kinder.second;
+        if(path.algo)
         {
-            miopenConvFwdAlgorithm_t a = boost::any_cast<miopenConvFwdAlgorithm_t>(cur_map["algo"]);
-            if(a == algo)
+            if(*path.algo == algo)
             {
-                new_list.emplace_back(kinder.first, cur_map);
+                new_list.emplace_back(kinder.first, path);
             }
         }
         else
@@ -215,7 +260,7 @@ bool FusionMDGraph::SetConvAlgo(miopenConvFwdAlgorithm_t algo)
         }
     }
 
-    cur_vertex = new_list;
+    cur_vertex = std::move(new_list);
 
     return (!new_list.empty());
 }
@@ -224,10 +269,10 @@ void FusionMDGraph::Init(FusionMDGraph& g, miopenFusionOp_t op)
 {
     switch(op)
     {
-    case miopenFusionOpConvForward: InitConv(g); break;
-    case miopenFusionOpBatchNormInference: InitBN(g); break;
-    case miopenFusionOpBatchNormFwdTrain: InitBNFwd(g); break;
-    case miopenFusionOpBatchNormBwdTrain: InitBNBwd(g); break;
+    case miopenFusionOpConvForward:
+    case miopenFusionOpBatchNormInference:
+    case miopenFusionOpBatchNormFwdTrain:
+    case miopenFusionOpBatchNormBwdTrain: break;
     case miopenFusionOpActivForward:
     case miopenFusionOpActivBackward:
     case miopenFusionOpBiasForward:
@@ -235,6 +280,8 @@ void FusionMDGraph::Init(FusionMDGraph& g, miopenFusionOp_t op)
             miopenStatusNotImplemented,
             "Operators Activ and Bias are not supported as first ops in a Fusion Plan (yet)");
     }
+    g.graph = FusionMDGraph_Table::Get(op);
+    g.Reset();
 }
 
 static std::vector<DefaultKernelArg> BNFwdArgs(miopenBatchNormMode_t mode)
@@ -282,7 +329,7 @@ static std::vector<DefaultKernelArg> BNFwdArgs(miopenBatchNormMode_t mode)
     }
 }
 
-void FusionMDGraph::InitBNFwd(FusionMDGraph& g)
+static void InitBNFwd(FusionMDGraph_Builder& g)
 {
     FusionMDGraph_Edge_Map empty_map;
     empty_map["constraints"] = {"weight === 0"};
@@ -372,7 +419,7 @@ static std::vector<DefaultKernelArg> BNBwdArgs(miopenBatchNormMode_t mode)
     }
 }
 
-void FusionMDGraph::InitBNBwd(FusionMDGraph& g)
+static void InitBNBwd(FusionMDGraph_Builder& g)
 {
     FusionMDGraph_Edge_Map empty_map;
     empty_map["constraints"] = {"weight === 0"};
@@ -413,7 +460,7 @@ void FusionMDGraph::InitBNBwd(FusionMDGraph& g)
     }
 }
 
-void FusionMDGraph::InitBN(FusionMDGraph& g)
+static void InitBN(FusionMDGraph_Builder& g)
 {
     FusionMDGraph_Edge_Map empty_map;
     empty_map["constraints"] = {"weight === 0"};
@@ -512,7 +559,7 @@ static std::vector<DefaultKernelArg> WinogradV21NodeArgs()
     return nodeArgs;
 }
 
-void FusionMDGraph::InitConv(FusionMDGraph& g)
+static void InitConv(FusionMDGraph_Builder& g)
 {
     FusionMDGraph_Edge_Map empty_map;
     empty_map["constraints"] = {"weight === 0"};
@@ -1012,61 +1059,107 @@ void FusionMDGraph::InitConv(FusionMDGraph& g)
     }
 }
 
-void FusionMDGraph::AddEdge(MDGraph_vertex_ptr src,
-                            MDGraph_vertex_ptr dst,
-                            FusionMDGraph_Edge_Map& map)
+static std::shared_ptr<const FusionMDGraph_Table> Freeze(const FusionMDGraph_Builder& b)
 {
-    if(edge_list[src][dst].empty())
+    auto t        = std::make_shared<FusionMDGraph_Table>();
+    t->weight_sym = t->symbols.Intern("weight");
+    t->algo_sym   = t->symbols.Intern("algo");
+    t->vertices.push_back(nullptr);
+    t->transitions.emplace_back();
+
+    const auto vertex_idx = [&](const MDGraph_vertex_ptr& v) {
+        if(v == nullptr)
+            return std::size_t{0};
+        if(v->graph_idx == 0)
+        {
+            v->graph_idx = t->vertices.size();
+            t->vertices.push_back(v);
+            t->transitions.emplace_back();
+        }
+        return v->graph_idx;
+    };
+
+    const MDGExprParser parser;
+    std::unordered_map<std::string, std::size_t> compiled;
+    for(const auto& e : b.edges)
     {
-        edge_list[src][dst] = {map};
+        const auto src = vertex_idx(e.src);
+        vertex_idx(e.dst);
+
+        std::vector<std::size_t> edge;
+        for(const auto& kv : e.map)
+        {
+            if(kv.first != "constraints")
+                MIOPEN_THROW(miopenStatusInternalError, "Unknown graph edge key: " + kv.first);
+            for(const auto& expr : kv.second)
+            {
+                auto it = compiled.find(expr);
+                if(it == compiled.end())
+                {
+                    it = compiled.emplace(expr, t->constraints.size()).first;
+                    t->constraints.push_back(MDGExprConstraint::Compile(parser, expr, t->symbols));
+                }
+                edge.push_back(it->second);
+            }
+        }
+
+        auto& from = t->transitions[src];
+        auto tr    = std::find_if(from.begin(), from.end(), [&](const MDGraph_transition& x) {
+            return x.dst == e.dst;
+        });
+        if(tr == from.end())
+            tr = from.insert(from.end(), MDGraph_transition{e.dst, {}});
+        tr->edges.push_back(std::move(edge));
     }
-    else
+    return t;
+}
+
+std::shared_ptr<const FusionMDGraph_Table> FusionMDGraph_Table::Get(miopenFusionOp_t op)
+{
+    // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+    static std::mutex mutex;
+    const std::lock_guard<std::mutex> lock{mutex};
+
+    // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+    static auto graphs = std::map<miopenFusionOp_t, std::shared_ptr<const FusionMDGraph_Table>>{};
+    auto& graph        = graphs[op];
+    if(graph != nullptr)
+        return graph;
+
+    FusionMDGraph_Builder b;
+    switch(op)
     {
-        edge_list[src][dst].emplace_back(map);
+    case miopenFusionOpConvForward: InitConv(b); break;
+    case miopenFusionOpBatchNormInference: InitBN(b); break;
+    case miopenFusionOpBatchNormFwdTrain: InitBNFwd(b); break;
+    case miopenFusionOpBatchNormBwdTrain: InitBNBwd(b); break;
+    case miopenFusionOpActivForward:
+    case miopenFusionOpActivBackward:
+    case miopenFusionOpBiasForward: break;
     }
+    graph = Freeze(b);
+    MIOPEN_LOG_I2("Metadata graph " << op << ": " << graph->vertices.size() << " vertices, "
+                                    << graph->constraints.size() << " constraints, "
+                                    << graph->symbols.size() << " symbols");
+    return graph;
 }
 
-bool FusionMDGraph::CmpOpKey(const FusionMDGraph_Edge_Map& edge_val,
-                             std::function<bool(const std::string& sym, int& val)> attr_fun,
-                             std::unordered_map<std::string, int>& syms) const
+static bool MatchEdge(const FusionMDGraph_Table& graph,
+                      const std::vector<std::size_t>& edge,
+                      MDGExprContext& ctx)
 {
-    for(auto& kv : edge_val)
+    ctx.ResetLocals();
+    for(const auto id : edge)
     {
-        if(kv.first == "constraints")
+        const auto& c = graph.constraints[id];
+        if(ctx.Eval(c))
         {
-            tree_visit v(attr_fun);
-            for(auto& edg_op : kv.second)
-            {
-                using It = std::string::const_iterator;
-                It f(edg_op.begin()), l(edg_op.end());
-                MDGExprParser p;
-                boost::spirit::utree e;
-                auto parse_success =
-                    boost::spirit::qi::phrase_parse(f, l, p, boost::spirit::ascii::space, e);
-                if(!parse_success)
-                {
-                    MIOPEN_LOG_I2(
-                        "Remaining unparsed: " << std::string(edg_op.begin(), edg_op.end()));
-                    MIOPEN_THROW(miopenStatusInternalError,
-                                 "Unable to parse graph constraint expression");
-                }
-                visit_res r = boost::spirit::utree::visit(e, v);
-                v.tabl.insert(r.tabl.begin(), r.tabl.end());
-                syms = v.tabl;
-                if(r.b_res)
-                {
-                    MIOPEN_LOG_I2("Constraint satisfied: " + edg_op);
-                }
-                else
-                {
-                    MIOPEN_LOG_I("Condition unsuccessful while matching graph: " + edg_op);
-                    return false;
-                }
-            }
+            MIOPEN_LOG_I2("Constraint satisfied: " + c.expr);
         }
         else
         {
-            assert(false);
+            MIOPEN_LOG_I("Condition unsuccessful while matching graph: " + c.expr);
+            return false;
         }
     }
     return true;
@@ -1076,12 +1169,20 @@ bool FusionMDGraph::Advance(std::shared_ptr<FusionOpDescriptor> op,
                             std::function<bool(const std::string& sym, int& val)> attr_fun)
 {
     MIOPEN_LOG_I("Adding Op: " << *op);
-    std::vector<std::pair<MDGraph_vertex_ptr, cur_vertex_map>> new_list;
+    std::vector<std::pair<MDGraph_vertex_ptr, MDGraph_path>> new_list;
     std::set<miopenConvFwdAlgorithm_t> new_set;
+    if(graph == nullptr)
+    {
+        cur_vertex.clear();
+        conv_algo_set.clear();
+        return false;
+    }
+    MDGExprContext ctx(graph->symbols, std::move(attr_fun));
+
     // iterate over the list of current vertices
     for(auto& kinder : cur_vertex)
     {
-        MDGraph_vertex_ptr& cur_vertex_ptr = kinder.first;
+        const MDGraph_vertex_ptr& cur_vertex_ptr = kinder.first;
         if(cur_vertex_ptr == nullptr)
         {
             MIOPEN_LOG_I2("Current vertex: nullptr");
@@ -1091,79 +1192,63 @@ bool FusionMDGraph::Advance(std::shared_ptr<FusionOpDescriptor> op,
             MIOPEN_LOG_I2("Current vertex: " << *cur_vertex_ptr);
         }
         // get the children of the cur_vertex
-        auto& ch = edge_list[cur_vertex_ptr];
+        const auto idx = cur_vertex_ptr == nullptr ? 0 : cur_vertex_ptr->graph_idx;
         // if op is in the children and the edge key satisfies update cur_vertex
-        for(auto& ch_it : ch)
+        for(const auto& ch : graph->transitions[idx])
         {
-            auto cur_map = kinder.second;
-            MIOPEN_LOG_I2("Current path weight: " << boost::any_cast<int>(cur_map["weight"]));
-            MIOPEN_LOG_I2("Child: " << *ch_it.first);
-            std::set<miopenConvFwdAlgorithm_t> cur_path_set;
-            if(ch_it.first->op == op->kind())
+            if(ch.dst->op != op->kind())
+                continue;
+            auto path = kinder.second;
+            MIOPEN_LOG_I2("Current path weight: " << path.weight);
+            MIOPEN_LOG_I2("Child: " << *ch.dst);
+            for(const auto& edge : ch.edges)
             {
-                for(auto& edg_map : ch_it.second)
+                int weight = path.weight;
+                if(!MatchEdge(*graph, edge, ctx))
                 {
-                    int weight = boost::any_cast<int>(cur_map["weight"]);
-                    std::unordered_map<std::string, int> syms;
-                    if(CmpOpKey(edg_map, attr_fun, syms))
-                    {
-                        MIOPEN_LOG_I2("Key Match Successfull");
-                        if(syms.count("weight") != 0)
-                        {
-                            weight += syms.at("weight");
-                        }
-                        else
-                        {
-                            MIOPEN_LOG_I2("Weight not found, assuming zero");
-                        }
-                        cur_map["weight"] = weight;
-
-                        // Update the algo set
-                        if(op->kind() == miopenFusionOpConvForward)
-                        {
-                            if(syms.count("algo") != 0)
-                            {
-                                auto algo = static_cast<miopenConvFwdAlgorithm_t>(syms.at("algo"));
-                                MIOPEN_LOG_I2("Operator Matched: Convolution: Algo: " +
-                                              std::to_string(algo));
-                                cur_path_set.insert(algo);
-
-                                new_set.insert(cur_path_set.begin(), cur_path_set.end());
-                                assert(cur_path_set.size() == 1);
-                                cur_map["algo"] =
-                                    *cur_path_set.begin(); // there should be only one algo
-                                cur_map.erase("solver");
-                                if(!ch_it.first->solver.IsEmpty())
-                                {
-                                    cur_map.insert(std::pair<std::string, solver::AnySolver>(
-                                        "solver", ch_it.first->solver));
-                                }
-                            }
-                            else
-                            {
-                                MIOPEN_THROW(miopenStatusInternalError,
-                                             "algo is not provided for "
-                                             "a convolution oeprator in "
-                                             "the metadata graph");
-                            }
-                        }
-                        else
-                        {
-                            MIOPEN_LOG_I2("Operator Matched: " + std::to_string(op->kind()));
-                            cur_map.erase("algo");
-                        }
-                        new_list.emplace_back(ch_it.first, cur_map);
-                    }
-                    else
+                    MIOPEN_LOG_I2("Key Map Match unsuccessful");
+                    continue;
+                }
+                MIOPEN_LOG_I2("Key Match Successfull");
+                int edge_weight = 0;
+                if(ctx.GetLocal(graph->weight_sym, edge_weight))
+                {
+                    weight += edge_weight;
+                }
+                else
+                {
+                    MIOPEN_LOG_I2("Weight not found, assuming zero");
+                }
+                path.weight = weight;
+
+                // Update the algo set
+                if(op->kind() == miopenFusionOpConvForward)
+                {
+                    int algo_val = 0;
+                    if(!ctx.GetLocal(graph->algo_sym, algo_val))
                     {
-                        MIOPEN_LOG_I2("Key Map Match unsuccessful");
+                        MIOPEN_THROW(miopenStatusInternalError,
+                                     "algo is not provided for "
+                                     "a convolution oeprator in "
+                                     "the metadata graph");
                     }
+                    auto algo = static_cast<miopenConvFwdAlgorithm_t>(algo_val);
+                    MIOPEN_LOG_I2("Operator Matched: Convolution: Algo: " + std::to_string(algo));
+                    new_set.insert(algo);
+                    path.algo   = algo;
+                    path.solver = ch.dst->solver;
                 }
+                else
+                {
+                    MIOPEN_LOG_I2("Operator Matched: " + std::to_string(op->kind()));
+                    path.algo = boost::none;
+                }
+                new_list.emplace_back(ch.dst, path);
             }
-            MIOPEN_LOG_I2("Current path final weight: " << boost::any_cast<int>(cur_map["weight"]));
+            MIOPEN_LOG_I2("Current path final weight: " << path.weight);
         }
     }
-    cur_vertex = new_list;
+    cur_vertex = std::move(new_list);
     if(op->kind() == miopenFusionOpConvForward) // TODO: Or any other convolution
     {
         conv_algo_set = new_set;
@@ -1175,10 +1260,9 @@ bool FusionMDGraph::Advance(std::shared_ptr<FusionOpDescriptor> op,
     // sort according to the edge weight
     std::sort(cur_vertex.begin(),
               cur_vertex.end(),
-              [&](const std::pair<MDGraph_vertex_ptr, cur_vertex_map>& a,
-                  const std::pair<MDGraph_vertex_ptr, cur_vertex_map>& b) {
-                  return boost::any_cast<int>(a.second.at("weight")) >
-                         boost::any_cast<int>(b.second.at("weight"));
+              [&](const std::pair<MDGraph_vertex_ptr, MDGraph_path>& a,
+                  const std::pair<MDGraph_vertex_ptr, MDGraph_path>& b) {
+                  return a.second.weight > b.second.weight;
               });
 
     return (!cur_vertex.empty());
@@ -1187,8 +1271,7 @@ bool FusionMDGraph::Advance(std::shared_ptr<FusionOpDescriptor> op,
 void FusionMDGraph::Reset()
 {
     cur_vertex.clear();
-    cur_vertex_map empty_map = {{"weight", 0}};
-    cur_vertex.emplace_back(nullptr, empty_map);
+    cur_vertex.emplace_back(nullptr, MDGraph_path{});
 }
 
 // guard for debug only
@@ -1228,7 +1311,7 @@ std::string any_string(const boost::any& a)
         return ""; // assert(false);
 }
 
-void FusionMDGraph::WriteToFile(std::string filename)
+void FusionMDGraph::WriteToFile(std::string filename) const
 {
     const auto op_enum = enum_map(MIOPEN_ENUM_ARR(miopenFusionOpConvForward,
                                                   miopenFusionOpActivForward,
@@ -1239,22 +1322,16 @@ void FusionMDGraph::WriteToFile(std::string filename)
     {
         filename = "/tmp/mdgraph.dot";
     }
-    std::set<MDGraph_vertex_ptr> nodes;
+    if(graph == nullptr)
+    {
+        MIOPEN_THROW(miopenStatusBadParm, "The metadata graph is not initialized");
+    }
     std::ofstream dot_file;
     std::stringstream dot_graph;
     dot_file.open(filename);
 
-    for(auto& edge : edge_list)
-    {
-        nodes.insert(edge.first);
-        for(auto& edge2 : edge.second)
-        {
-            nodes.insert(edge2.first);
-        }
-    }
-
     dot_graph << "digraph { " << std::endl;
-    for(auto& node : nodes)
+    for(auto& node : graph->vertices)
     {
         if(node == nullptr)
         {
@@ -1267,32 +1344,20 @@ void FusionMDGraph::WriteToFile(std::string filename)
         }
     }
 
-    int src_id, dst_id;
-
-    for(auto& edge : edge_list)
+    for(std::size_t src = 0; src < graph->transitions.size(); ++src)
     {
-        if(edge.first != nullptr)
-            src_id = edge.first->id;
-        else
-            src_id = 0;
-        for(auto& edge2 : edge.second)
+        const auto src_id = graph->vertices[src] != nullptr ? graph->vertices[src]->id : 0;
+        for(auto& tr : graph->transitions[src])
         {
-            if(edge2.first != nullptr)
-                dst_id = edge2.first->id;
-            else
-                dst_id = 0;
-            for(auto& edg_map : edge2.second)
+            for(auto& edg : tr.edges)
             {
                 std::stringstream edge_label;
-                for(auto& edg_ops : edg_map)
+                for(auto id : edg)
                 {
-                    for(auto& e : edg_ops.second)
-                    {
-                        edge_label << e << "\\n";
-                    }
+                    edge_label << graph->constraints[id].expr << "\\n";
                 }
-                dot_graph << src_id << "->" << dst_id << "[label=\"" << edge_label.str() << "\"];"
-                          << std::endl;
+                dot_graph << src_id << "->" << tr.dst->id << "[label=\"" << edge_label.str()
+                          << "\"];" << std::endl;
             }
         }
     }
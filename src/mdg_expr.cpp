@@ -1,5 +1,8 @@
 #include <miopen/mdg_expr.hpp>
 
+#include <algorithm>
+#include <cmath>
+
 namespace miopen {
 
 MDGExprParser::MDGExprParser() : MDGExprParser::base_type(expression)
@@ -50,4 +53,275 @@ MDGExprParser::MDGExprParser() : MDGExprParser::base_type(expression)
     BOOST_SPIRIT_DEBUG_NODE(variable);
 }
 
+MDGraph_op_t MDGExprOp(const std::string& sym)
+{
+    // The alternatives of the "ops" rule that fail half way leave their characters in the
+    // attribute, which is why "==" and ">" come out as "====" and ">>".
+    static const std::unordered_map<std::string, MDGraph_op_t> ops = {{"+", OpAdd},
+                                                                      {"-", OpSub},
+                                                                      {"*", OpMul},
+                                                                      {"/", OpDiv},
+                                                                      {"%", OpModulo},
+                                                                      {">=", OpGTE},
+                                                                      {"<=", OpLTE},
+                                                                      {"====", OpEqual},
+                                                                      {"!=", OpNotEqual},
+                                                                      {"^", OpPow},
+                                                                      {"&", OpAnd},
+                                                                      {"|", OpOr},
+                                                                      {"~", OpCeil},
+                                                                      {"===", OpAssign},
+                                                                      {">>", OpGT},
+                                                                      {"<<", OpLT}};
+    const auto it = ops.find(sym);
+    if(it == ops.end())
+        MIOPEN_THROW(miopenStatusInternalError, "Parsing error: Unknown operator: " + sym);
+    return it->second;
+}
+
+int MDGExprSymbols::Intern(const std::string& name)
+{
+    const auto it = ids.find(name);
+    if(it != ids.end())
+        return it->second;
+    const auto id = static_cast<int>(names.size());
+    ids.emplace(name, id);
+    names.push_back(name);
+    return id;
+}
+
+namespace {
+
+// Flattens the tree built by MDGExprParser into postfix instructions
+struct expr_compile
+{
+    struct node
+    {
+        bool emitted = false;
+        MDGExprConstraint::Instr instr{MDGExprConstraint::Instr::Const, OpAny, 0};
+    };
+    using result_type = node;
+
+    MDGExprSymbols& symbols;
+    MDGExprConstraint& c;
+    int depth = 0;
+
+    expr_compile(MDGExprSymbols& s, MDGExprConstraint& constraint) : symbols(s), c(constraint) {}
+
+    node operator()(double d) const { return Leaf(MDGExprConstraint::Instr::Const, d); }
+    node operator()(int i) const { return Leaf(MDGExprConstraint::Instr::Const, i); }
+
+    // Anything else the parser does not produce evaluates to zero like before
+    template <typename T>
+    node operator()(T /*val*/) const
+    {
+        return {};
+    }
+    node operator()(spirit::any_ptr const&) const { return {}; }
+    node operator()(spirit::function_base const&) const { return {}; }
+
+    node operator()(spirit::utf8_string_range_type const& str)
+    {
+        return Leaf(MDGExprConstraint::Instr::Symbol,
+                    symbols.Intern(std::string(str.begin(), str.end())));
+    }
+
+    node operator()(spirit::utf8_symbol_range_type const& str) const
+    {
+        node r;
+        r.instr = {
+            MDGExprConstraint::Instr::Apply, MDGExprOp(std::string(str.begin(), str.end())), 0};
+        return r;
+    }
+
+    template <typename Iterator>
+    node operator()(boost::iterator_range<Iterator> const& range)
+    {
+        std::vector<spirit::utree> v(range.begin(), range.end());
+        if(v.size() != 3)
+            MIOPEN_THROW(miopenStatusInternalError, "Malformed graph constraint: " + c.expr);
+        const auto op = boost::spirit::utree::visit(v[0], *this).instr;
+        if(op.kind != MDGExprConstraint::Instr::Apply)
+            MIOPEN_THROW(miopenStatusInternalError, "Malformed graph constraint: " + c.expr);
+
+        ++depth;
+        if(op.op == OpAssign)
+        {
+            const auto lhs = boost::spirit::utree::visit(v[1], *this);
+            if(depth != 1 || lhs.emitted || lhs.instr.kind != MDGExprConstraint::Instr::Symbol)
+                MIOPEN_THROW(miopenStatusInternalError, "Invalid graph assignment: " + c.expr);
+            c.assign_sym = lhs.instr.val;
+            Emit(v[2]);
+        }
+        else
+        {
+            Emit(v[1]);
+            Emit(v[2]);
+            c.code.push_back(op);
+        }
+        --depth;
+
+        node r;
+        r.emitted = true;
+        return r;
+    }
+
+    void Emit(const spirit::utree& t)
+    {
+        const auto r = boost::spirit::utree::visit(t, *this);
+        if(!r.emitted)
+            c.code.push_back(r.instr);
+    }
+
+    private:
+    template <class T>
+    static node Leaf(MDGExprConstraint::Instr::Kind kind, T val)
+    {
+        node r;
+        r.instr = {kind, OpAny, static_cast<int>(val)};
+        return r;
+    }
+};
+
+} // namespace
+
+MDGExprConstraint MDGExprConstraint::Compile(const MDGExprParser& parser,
+                                             const std::string& expr,
+                                             MDGExprSymbols& symbols)
+{
+    MDGExprConstraint c;
+    c.expr = expr;
+    Iterator f(expr.begin()), l(expr.end());
+    spirit::utree tree;
+    if(!qi::phrase_parse(f, l, parser, ascii::space, tree))
+    {
+        MIOPEN_LOG_I2("Remaining unparsed: " << std::string(f, l));
+        MIOPEN_THROW(miopenStatusInternalError, "Unable to parse graph constraint expression");
+    }
+    expr_compile(symbols, c).Emit(tree);
+    return c;
+}
+
+MDGExprContext::MDGExprContext(const MDGExprSymbols& s,
+                               std::function<bool(const std::string&, int&)> f)
+    : symbols(s),
+      attr_fun(std::move(f)),
+      attr_state(s.size(), Unknown),
+      attr_val(s.size(), 0),
+      local_set(s.size(), 0),
+      local_val(s.size(), 0)
+{
+}
+
+bool MDGExprContext::LookupAttr(int sym, int& val)
+{
+    if(attr_state[sym] == Unknown)
+        attr_state[sym] = attr_fun(symbols.Name(sym), attr_val[sym]) ? Found : Missing;
+    val = attr_val[sym];
+    return attr_state[sym] == Found;
+}
+
+void MDGExprContext::ResetLocals() { std::fill(local_set.begin(), local_set.end(), 0); }
+
+bool MDGExprContext::GetLocal(int sym, int& val) const
+{
+    if(local_set[sym] == 0)
+        return false;
+    val = local_val[sym];
+    return true;
+}
+
+MDGExprContext::Value
+MDGExprContext::Apply(MDGraph_op_t op, const Value& lhs, const Value& rhs) const
+{
+    if(lhs.unresolved >= 0)
+        MIOPEN_THROW("Invalid variable access: " + symbols.Name(lhs.unresolved));
+
+    const auto arith = [](int res) {
+        Value r;
+        r.res = res;
+        return r;
+    };
+    const auto logical = [](bool b) {
+        Value r;
+        r.b_res = b;
+        r.res   = static_cast<int>(b);
+        return r;
+    };
+    const int l = lhs.res;
+    const int m = rhs.res;
+
+    switch(op)
+    {
+    // Arith ops
+    case OpAdd: return arith(l + m);
+    case OpSub: return arith(l - m);
+    case OpMul: return arith(l * m);
+    case OpDiv: return arith(l / m);
+    case OpModulo: return arith(l % m);
+    case OpPow: return arith(static_cast<int>(std::pow(l, m)));
+    case OpCeil: return arith((l % m != 0) ? (l / m + 1) * m : l);
+    // Logical ops
+    case OpEqual: return logical(l == m);
+    case OpNotEqual: return logical(l != m);
+    case OpGTE: return logical(l >= m);
+    case OpLTE: return logical(l <= m);
+    case OpGT: return logical(l > m);
+    case OpLT: return logical(l < m);
+    case OpAnd: return logical(lhs.b_res && rhs.b_res);
+    case OpOr: return logical(lhs.b_res || rhs.b_res);
+    case OpAssign:
+    case OpAny:
+    case OpEval: break;
+    }
+    MIOPEN_THROW("Unsupported op");
+}
+
+bool MDGExprContext::Eval(const MDGExprConstraint& c)
+{
+    stack.clear();
+    for(const auto& instr : c.code)
+    {
+        switch(instr.kind)
+        {
+        case MDGExprConstraint::Instr::Const: {
+            Value v;
+            v.res = instr.val;
+            stack.push_back(v);
+            break;
+        }
+        case MDGExprConstraint::Instr::Symbol: {
+            // operator attributes shadow the values assigned by the constraints
+            Value v;
+            if(!LookupAttr(instr.val, v.res) && !GetLocal(instr.val, v.res))
+            {
+                v.res        = 0;
+                v.unresolved = instr.val;
+            }
+            stack.push_back(v);
+            break;
+        }
+        case MDGExprConstraint::Instr::Apply: {
+            assert(stack.size() >= 2);
+            const auto rhs = stack.back();
+            stack.pop_back();
+            stack.back() = Apply(instr.op, stack.back(), rhs);
+            break;
+        }
+        }
+    }
+    assert(stack.size() <= 1);
+
+    if(c.assign_sym < 0)
+        return !stack.empty() && stack.back().b_res;
+
+    int val = 0;
+    if(LookupAttr(c.assign_sym, val))
+        MIOPEN_THROW("Invalid variable assignment: " + symbols.Name(c.assign_sym));
+    MIOPEN_LOG_I2(" Adding variable: " + symbols.Name(c.assign_sym));
+    local_val[c.assign_sym] = stack.empty() ? 0 : stack.back().res;
+    local_set[c.assign_sym] = 1;
+    return true;
+}
+
 } // namespace miopen
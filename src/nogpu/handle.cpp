@@ -33,6 +33,7 @@
 #include <miopen/handle_lock.hpp>
 #include <miopen/invoker.hpp>
 #include <miopen/kernel_cache.hpp>
+#include <miopen/launch_list.hpp>
 #include <miopen/logger.hpp>
 #include <miopen/timer.hpp>
 #include <miopen/hipoc_program.hpp>
@@ -71,6 +72,12 @@ void Handle::SetStream(miopenAcceleratorQueue_t /* streamID */) const {}
 
 miopenAcceleratorQueue_t Handle::GetStream() const { return {}; }
 
+miopenAcceleratorQueue_t Handle::GetAuxStream(std::size_t /* index */) const { return {}; }
+
+void Handle::SwitchStream(miopenAcceleratorQueue_t /* streamID */) const {}
+
+void Handle::RestoreStream() const {}
+
 void Handle::SetAllocator(miopenAllocatorFunction /* allocator */,
                           miopenDeallocatorFunction /* deallocator */,
                           void* /* allocatorContext */) const
@@ -81,7 +88,12 @@ void Handle::EnableProfiling(bool enable) const { this->impl->enable_profiling =
 
 float Handle::GetKernelTime() const { return this->impl->profiling_result; }
 
-Allocator::ManageDataPtr Handle::Create(std::size_t sz) const { return this->impl->allocator(sz); }
+Allocator::ManageDataPtr Handle::Create(std::size_t sz) const
+{
+    if(this->impl->capture)
+        MIOPEN_THROW(miopenStatusBadParm, "Buffers cannot be allocated while capturing");
+    return this->impl->allocator(sz);
+}
 
 Allocator::ManageDataPtr&
 Handle::WriteTo(const void* /* data */, Allocator::ManageDataPtr& ddata, std::size_t /* sz */) const
@@ -95,7 +107,11 @@ void Handle::ReadTo(void* /* data */,
 {
 }
 
-void Handle::Copy(ConstData_t /* src */, Data_t /* dest */, std::size_t /* size */) const {}
+void Handle::Copy(ConstData_t src, Data_t dest, std::size_t size) const
+{
+    if(this->impl->capture)
+        this->impl->capture->Add(CaptureCopy(src, dest, size));
+}
 
 KernelInvoke Handle::AddKernel(const std::string& algorithm,
                                const std::string& network_config,
@@ -165,7 +181,46 @@ bool Handle::HasKernel(const std::string& algorithm, const std::string& network_
     return this->impl->cache.HasKernels(algorithm, network_config);
 }
 
-KernelInvoke Handle::Run(Kernel /* k */) const { return {}; }
+KernelInvoke Handle::Run(Kernel k) const
+{
+    // Nothing is launched without a GPU, but the launches can still be captured.
+    if(!this->impl->capture)
+        return {};
+    auto invoke    = k.Invoke(this->GetStream());
+    invoke.capture = this->impl->capture;
+    return invoke;
+}
+
+void Handle::BeginCapture() const
+{
+    if(this->impl->capture)
+        MIOPEN_THROW(miopenStatusBadParm, "The handle is already capturing");
+    this->impl->capture = std::make_shared<LaunchList>();
+}
+
+LaunchList Handle::EndCapture() const
+{
+    if(!this->impl->capture)
+        MIOPEN_THROW(miopenStatusBadParm, "The handle is not capturing");
+    auto list = std::move(*this->impl->capture);
+    this->impl->capture.reset();
+    return list;
+}
+
+bool Handle::IsCapturing() const { return this->impl->capture != nullptr; }
+
+void Handle::Capture(CapturedLaunch launch) const
+{
+    if(!this->impl->capture)
+        MIOPEN_THROW(miopenStatusBadParm, "The handle is not capturing");
+    this->impl->capture->Add(std::move(launch));
+}
+
+void Handle::Replay(LaunchList& /* list */) const
+{
+    if(this->impl->capture)
+        MIOPEN_THROW(miopenStatusBadParm, "Launch lists cannot be replayed while capturing");
+}
 
 Program Handle::LoadProgram(const std::string& program_name,
                             std::string params,
@@ -541,27 +541,35 @@ void ConvolutionDescriptor::FindConvFwdAlgorithm(Handle& handle,
                                          << ", " << perf_db[0].time);
 }
 
-void ValidateConvTensors(const ConvTensors& tensors)
+static bool ConvTensorDescriptorsInvalid(const TensorDescriptor& xDesc,
+                                         const TensorDescriptor& wDesc,
+                                         const TensorDescriptor& yDesc)
 {
-    const auto invalid_buffers =
-        tensors.x == nullptr || tensors.w == nullptr || tensors.y == nullptr;
-
-    const auto tensor_sizes_not_matched = tensors.xDesc.GetSize() != tensors.yDesc.GetSize() ||
-                                          tensors.xDesc.GetSize() != tensors.wDesc.GetSize();
+    const auto tensor_sizes_not_matched =
+        xDesc.GetSize() != yDesc.GetSize() || xDesc.GetSize() != wDesc.GetSize();
 
     const auto tensor_types_not_matched =
-        (tensors.xDesc.GetType() != tensors.yDesc.GetType() &&
-         tensors.xDesc.GetType() != miopenInt8 && tensors.xDesc.GetType() != miopenInt8x4) ||
-        tensors.xDesc.GetType() != tensors.wDesc.GetType();
+        (xDesc.GetType() != yDesc.GetType() && xDesc.GetType() != miopenInt8 &&
+         xDesc.GetType() != miopenInt8x4) ||
+        xDesc.GetType() != wDesc.GetType();
 
     // if(xDesc.GetLengths()[1] != wDesc.GetLengths()[1]) {
     //    MIOPEN_THROW(miopenStatusBadParm);
     //}
 
-    const auto x_tensor_invalid = tensors.xDesc.GetSize() < 3;
+    const auto x_tensor_invalid = xDesc.GetSize() < 3;
+
+    return tensor_sizes_not_matched || tensor_types_not_matched || x_tensor_invalid;
+}
+
+void ValidateConvTensors(const ConvTensors& tensors)
+{
+    const auto invalid_buffers =
+        tensors.x == nullptr || tensors.w == nullptr || tensors.y == nullptr;
 
     const auto bad_parameters =
-        invalid_buffers || tensor_sizes_not_matched || tensor_types_not_matched || x_tensor_invalid;
+        invalid_buffers ||
+        ConvTensorDescriptorsInvalid(tensors.xDesc, tensors.wDesc, tensors.yDesc);
 
     if(bad_parameters)
         MIOPEN_THROW(miopenStatusBadParm);
@@ -956,8 +964,11 @@ static Invoker PrepareInvoker(Handle& handle,
     const auto invoker =
         handle.PrepareInvoker(*solution.invoker_factory, solution.construction_params);
 
-    handle.RegisterInvoker(
-        invoker, config, solver_id.ToString(), AlgorithmName(solver_id.GetAlgo(dir)));
+    handle.RegisterInvoker(invoker,
+                           ctx.conv_problem.GetKey(),
+                           config,
+                           solver_id,
+                           AlgorithmName(solver_id.GetAlgo(dir)));
     return invoker; // NOLINT (performance-no-automatic-move)
 }
 
@@ -966,10 +977,18 @@ static Invoker LoadOrPrepareInvoker(Handle& handle,
                                     solver::Id solver_id,
                                     conv::Direction dir)
 {
+    // The binary key is prebuilt with the problem, so a hit costs no string formatting.
+    auto invoker = handle.GetInvoker(ctx.conv_problem.GetKey(), solver_id);
+    if(invoker)
+        return *invoker;
     const auto config = ctx.BuildConfKey();
-    auto invoker      = handle.GetInvoker(config, solver_id);
+    invoker           = handle.GetInvoker(config, solver_id);
     if(invoker)
+    {
+        // Registered by Find, which does not know the binary key.
+        handle.RegisterInvoker(*invoker, ctx.conv_problem.GetKey(), config, solver_id);
         return *invoker;
+    }
     return PrepareInvoker(handle, ctx, config, solver_id, dir);
 }
 
@@ -1775,6 +1794,36 @@ void ConvolutionDescriptor::ConvolutionWrwImmediate(Handle& handle,
     });
 }
 
+Invoker ConvolutionDescriptor::PrepareSolutionInvoker(Handle& handle,
+                                                      const TensorDescriptor& xDesc,
+                                                      const TensorDescriptor& wDesc,
+                                                      const TensorDescriptor& yDesc,
+                                                      conv::Direction direction,
+                                                      solver::Id solver_id) const
+{
+    MIOPEN_LOG_I("solver_id = " << solver_id.ToString());
+    if(!solver_id.IsValid())
+        MIOPEN_THROW(miopenStatusBadParm, "solver_id = " + solver_id.ToString());
+    if(ConvTensorDescriptorsInvalid(xDesc, wDesc, yDesc))
+        MIOPEN_THROW(miopenStatusBadParm);
+    if(direction != conv::Direction::Forward && wDesc.GetType() == miopenInt8)
+        MIOPEN_THROW(miopenStatusBadParm);
+    if(direction == conv::Direction::BackwardData && yDesc.GetLengths()[1] != wDesc.GetLengths()[0])
+        MIOPEN_THROW(miopenStatusBadParm);
+    if(direction != conv::Direction::Forward)
+        ValidateGroupCount(xDesc, wDesc, *this);
+
+    if(!CheckInvokerSupport(solver_id, direction))
+    {
+        MIOPEN_THROW(miopenStatusNotImplemented,
+                     "Solver " + solver_id.ToString() + " does not implement invokers.");
+    }
+
+    auto ctx = ConvolutionContext{xDesc, wDesc, yDesc, *this, direction};
+    ctx.SetStream(&handle);
+    return LoadOrPrepareInvoker(handle, ctx, solver_id, direction);
+}
+
 void ConvolutionBackwardBias(const Handle& handle,
                              const void* alpha,
                              const TensorDescriptor& dyDesc,
@@ -33,6 +33,8 @@
 #include <miopen/kernel_cache.hpp>
 #include <miopen/tensor.hpp>
 #include <miopen/datatype.hpp>
+#include <miopen/precalc_xorwow_skipahead_matrices.hpp>
+#include <miopen/precalc_xorwow_skipahead_sequence_matrices.hpp>
 #include <vector>
 #include <numeric>
 #include <algorithm>
@@ -42,11 +44,11 @@
 
 namespace miopen {
 
-template <typename T>
-inline void SquashPairedTensor(const std::vector<T> x_len,
-                               const std::vector<T> x_str,
-                               const std::vector<T> y_len,
-                               const std::vector<T> y_str,
+template <typename TDims, typename T>
+inline void SquashPairedTensor(const TDims& x_len,
+                               const TDims& x_str,
+                               const TDims& y_len,
+                               const TDims& y_str,
                                std::vector<T>& in_len,
                                std::vector<T>& in_str,
                                std::vector<T>& out_len,
@@ -116,6 +118,23 @@ inline void SquashPairedTensor(const std::vector<T> x_len,
     }
 }
 
+namespace {
+
+// The subsequence skip-ahead matrices followed by the offset ones, as InitKernelState expects.
+const std::vector<unsigned int>& GetXorwowSkipaheadMatrices()
+{
+    static const auto matrices = [] {
+        const std::size_t sz = XORWOW_PRECALC_MATRICES_NUM * XORWOW_PRECALC_MATRICES_SZ;
+        auto result          = std::vector<unsigned int>(2 * sz);
+        std::copy_n(&precalc_xorwow_skipahead_sequence_matrices[0][0], sz, result.begin());
+        std::copy_n(&precalc_xorwow_skipahead_matrices[0][0], sz, result.begin() + sz);
+        return result;
+    }();
+    return matrices;
+}
+
+} // namespace
+
 void DropoutDescriptor::InitPRNGState(Handle& handle,
                                       Data_t prng_states,
                                       size_t prng_stateSizeInBytes,
@@ -135,15 +154,20 @@ void DropoutDescriptor::InitPRNGState(Handle& handle,
     size_t states_num = prng_stateSizeInBytes / sizeof(prngStates);
     size_t wk_grp_num = std::min(size_t(MAX_PRNG_STATE / 256), (states_num + 255) / 256);
 
-    std::string network_config = "initprngs-" + std::to_string(states_num) + "x" +
-                                 std::to_string(sizeof(prngStates)) + "x" +
-                                 std::to_string(rng_mode) + "x" + std::to_string(prng_seed) + "x" +
-                                 std::to_string(wk_grp_num);
+    // The seed and the number of states are kernel arguments, so reseeding reuses the kernel.
+    std::string network_config = "initprngs-" + std::to_string(sizeof(prngStates)) + "x" +
+                                 std::to_string(rng_mode) + "x" + std::to_string(wk_grp_num);
+
+    // The skip-ahead matrices are uploaded once and shared by all the descriptors of the handle
+    if(!handle.xorwow_skipahead)
+        handle.xorwow_skipahead = handle.Write(GetXorwowSkipaheadMatrices());
+    const auto matrices = handle.xorwow_skipahead.get();
+    const auto states   = static_cast<unsigned long long>(states_num);
 
     auto&& kernels = handle.GetKernels(kernel_name, network_config);
     if(!kernels.empty())
     {
-        kernels.front()(prng_states);
+        kernels.front()(prng_states, matrices, prng_seed, states);
     }
     else
     {
@@ -152,14 +176,16 @@ void DropoutDescriptor::InitPRNGState(Handle& handle,
 
         std::string params;
         params += " -DRUN_INIT_PRNG=1";
-        params += " -DPRNG_SEED=" + std::to_string(prng_seed);
-        params += " -DSTATES_NUM=" + std::to_string(states_num);
+        params += " -DXORWOW_DIM=" + std::to_string(XORWOW_DIM);
+        params += " -DXORWOW_BITS=" + std::to_string(XORWOW_BITS);
+        params += " -DXORWOW_PRECALC_MATRICES_NUM=" + std::to_string(XORWOW_PRECALC_MATRICES_NUM);
+        params += " -DXORWOW_JUMP_LOG2=" + std::to_string(XORWOW_JUMP_LOG2);
 #if DROPOUT_DEBUG
         std::cout << "Threads allocated for PRNG states: " << vgd[0] << std::endl;
         std::cout << "Memory allocated for PRNG states: " << stateSizeInBytes << std::endl;
 #endif
         handle.AddKernel(kernel_name, network_config, program_name, kernel_name, vld, vgd, params)(
-            prng_states);
+            prng_states, matrices, prng_seed, states);
 #if DROPOUT_DEBUG
         std::cout << "Succeeded in launching InitPRNGState()." << stateSizeInBytes << std::endl;
 #endif
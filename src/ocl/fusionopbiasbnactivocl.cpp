@@ -42,6 +42,8 @@ std::vector<size_t> FusionOpDescriptor::GetGlobalWGSz(Handle& /*handle*/,
     MIOPEN_THROW("Op does not support global workgroup size");
 }
 
+void BiasFusionOpDescriptor::GetPlanKey(FusionPlanKey& key) const { key.Append(base_desc); }
+
 miopenStatus_t BiasFusionOpDescriptor::GetNetworkConfig(std::string& network_config,
                                                         Handle& /*handle*/)
 {
@@ -82,6 +84,8 @@ std::vector<size_t> BiasFusionOpDescriptor::GetGlobalWGSz(Handle& /*handle*/,
     MIOPEN_THROW("Op does not support global workgroup size");
 }
 
+void ActivFwdFusionOpDescriptor::GetPlanKey(FusionPlanKey& key) const { key.Append(activMode); }
+
 miopenStatus_t ActivFwdFusionOpDescriptor::GetNetworkConfig(std::string& network_config,
                                                             Handle& /*handle*/)
 {
@@ -125,6 +129,8 @@ std::vector<size_t> ActivFwdFusionOpDescriptor::GetGlobalWGSz(Handle& /*handle*/
 }
 
 // Activations backward prop ----------------------------
+void ActivBwdFusionOpDescriptor::GetPlanKey(FusionPlanKey& key) const { key.Append(activMode); }
+
 miopenStatus_t ActivBwdFusionOpDescriptor::GetNetworkConfig(std::string& network_config,
                                                             Handle& /*handle*/)
 {
@@ -171,6 +177,12 @@ std::vector<size_t> ActivBwdFusionOpDescriptor::GetGlobalWGSz(Handle& /*handle*/
 
 /// BATCH NORMALIZATION inference start ================
 
+void BatchNormInferenceFusionOpDescriptor::GetPlanKey(FusionPlanKey& key) const
+{
+    key.Append(mode);
+    key.Append(base_desc);
+}
+
 miopenStatus_t BatchNormInferenceFusionOpDescriptor::GetNetworkConfig(std::string& network_config,
                                                                       Handle& /*handle*/)
 {
@@ -310,6 +322,12 @@ void BatchNormBwdTrainFusionOpDescriptor::calcBNParams(Handle& handle,
         }
     }
 }
+void BatchNormBwdTrainFusionOpDescriptor::GetPlanKey(FusionPlanKey& key) const
+{
+    key.Append(mode);
+    key.Append(static_cast<std::uint64_t>(useBatchStats));
+}
+
 miopenStatus_t BatchNormBwdTrainFusionOpDescriptor::GetNetworkConfig(std::string& network_config,
                                                                      Handle& handle)
 {
@@ -507,6 +525,13 @@ void BatchNormFwdTrainFusionOpDescriptor::calcBNParams(Handle& handle,
     }
 }
 
+void BatchNormFwdTrainFusionOpDescriptor::GetPlanKey(FusionPlanKey& key) const
+{
+    key.Append(mode);
+    key.Append(static_cast<std::uint64_t>(runningMeanVar));
+    key.Append(base_desc);
+}
+
 miopenStatus_t BatchNormFwdTrainFusionOpDescriptor::GetNetworkConfig(std::string& network_config,
                                                                      Handle& handle)
 {
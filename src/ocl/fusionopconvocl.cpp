@@ -14,8 +14,22 @@ mlo_construct_direct2D_fusion ConvForwardOpDescriptor::ConstructParams(Handle& h
     mlo_construct_direct2D_fusion construct_params(
         input_desc, filter_desc, o_desc, base_desc, miopen::conv::Direction::Forward);
     construct_params.setStream(&handle);
+    construct_params.setDoSearch(exhaustive_search);
     return construct_params;
 }
+
+void ConvForwardOpDescriptor::GetPlanKey(FusionPlanKey& key) const
+{
+    key.Append(base_desc.mode);
+    key.Append(base_desc.paddingMode);
+    key.Append(base_desc.GetGroupCount());
+    key.AppendRange(base_desc.GetConvPads());
+    key.AppendRange(base_desc.GetConvStrides());
+    key.AppendRange(base_desc.GetConvDilations());
+    key.AppendRange(base_desc.GetTransposeConvPads());
+    key.Append(filter_desc);
+}
+
 miopenStatus_t ConvForwardOpDescriptor::GetNetworkConfig(std::string& network_config,
                                                          Handle& handle)
 {
@@ -33,6 +33,7 @@
 #include <miopen/handle_lock.hpp>
 #include <miopen/invoker.hpp>
 #include <miopen/kernel_cache.hpp>
+#include <miopen/launch_list.hpp>
 #include <miopen/load_file.hpp>
 #include <miopen/logger.hpp>
 #include <miopen/manage_ptr.hpp>
@@ -277,6 +278,18 @@ void Handle::SetStream(miopenAcceleratorQueue_t streamID) const
 
 miopenAcceleratorQueue_t Handle::GetStream() const { return impl->queue.get(); }
 
+miopenAcceleratorQueue_t Handle::GetAuxStream(std::size_t /* index */) const
+{
+    MIOPEN_THROW(miopenStatusNotImplemented, "Auxiliary streams are not supported by OpenCL");
+}
+
+void Handle::SwitchStream(miopenAcceleratorQueue_t /* streamID */) const
+{
+    MIOPEN_THROW(miopenStatusNotImplemented, "Auxiliary streams are not supported by OpenCL");
+}
+
+void Handle::RestoreStream() const {}
+
 void Handle::SetAllocator(miopenAllocatorFunction allocator,
                           miopenDeallocatorFunction deallocator,
                           void* allocatorContext) const
@@ -379,6 +392,28 @@ KernelInvoke Handle::Run(Kernel k) const
     }
 }
 
+void Handle::BeginCapture() const
+{
+    MIOPEN_THROW(miopenStatusNotImplemented, "Capturing launches requires the HIP backend");
+}
+
+LaunchList Handle::EndCapture() const
+{
+    MIOPEN_THROW(miopenStatusBadParm, "The handle is not capturing");
+}
+
+bool Handle::IsCapturing() const { return false; }
+
+void Handle::Capture(CapturedLaunch /* launch */) const
+{
+    MIOPEN_THROW(miopenStatusBadParm, "The handle is not capturing");
+}
+
+void Handle::Replay(LaunchList& /* list */) const
+{
+    MIOPEN_THROW(miopenStatusNotImplemented, "Replaying launches requires the HIP backend");
+}
+
 Program Handle::LoadProgram(const std::string& program_name,
                             std::string params,
                             bool is_kernel_str,
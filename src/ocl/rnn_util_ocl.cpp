@@ -299,4 +299,48 @@ void LSTMBackwardHiddenStateUpdate(const Handle& handle,
     (void)wei_len;
     (void)wei_stride;
 }
+
+void RNNGatherRows(const Handle& handle,
+                   miopenDataType_t rnn_data_type,
+                   ConstData_t src,
+                   Data_t dst,
+                   ConstData_t index,
+                   std::size_t index_offset,
+                   int rows,
+                   int row_size)
+{
+    std::string program_name = "MIOpenRNNPackedSequence.cl";
+    std::string kernel_name  = "RNNGatherRows";
+
+    size_t max_active_threads = handle.GetMaxComputeUnits() * handle.GetWavefrontWidth() * 32;
+
+    size_t total_work   = std::max(static_cast<size_t>(rows) * row_size, size_t(1));
+    size_t item_per_grp = total_work <= 64 ? 64 : total_work <= 128 ? 128 : 256;
+    size_t glb_sz       = total_work < max_active_threads ? total_work : max_active_threads;
+    size_t wg_sz        = (glb_sz + item_per_grp - 1) / item_per_grp;
+    glb_sz              = wg_sz * item_per_grp;
+
+    std::string network_config = "rnngather-" +
+                                 std::string(rnn_data_type == miopenHalf ? "fp16-" : "fp32-") +
+                                 std::to_string(item_per_grp) + "x" + std::to_string(wg_sz);
+
+    auto&& kernels = handle.GetKernels(kernel_name, network_config);
+
+    if(!kernels.empty())
+    {
+        auto kernel = kernels.front();
+        kernel(src, dst, index, static_cast<long long>(index_offset), rows, row_size);
+    }
+    else
+    {
+        std::string params =
+            rnn_data_type == miopenHalf ? " -DMIOPEN_USE_FP16=1" : " -DMIOPEN_USE_FP32=1";
+
+        const std::vector<size_t> vld{item_per_grp, 1, 1};
+        const std::vector<size_t> vgd{glb_sz, 1, 1};
+
+        handle.AddKernel(kernel_name, network_config, program_name, kernel_name, vld, vgd, params)(
+            src, dst, index, static_cast<long long>(index_offset), rows, row_size);
+    }
+}
 } // namespace miopen
@@ -26,6 +26,7 @@
 
 #include <miopen/rnn.hpp>
 #include <miopen/rnn_util.hpp>
+#include <miopen/rnn_wavefront.hpp>
 
 #include <miopen/activ.hpp>
 #include <miopen/env.hpp>
@@ -216,6 +217,10 @@ void RNNDescriptor::RNNForwardInference(Handle& handle,
         break;
     }
 
+    // Prepared weight blocks are stored transposed, see RNNDescriptor::PrepareWeights.
+    const bool prepared = weightLayout == miopenRNNWeightsPrepared;
+    const int hid_ldb   = prepared ? wei_len : uni_stride;
+
     ActivationDescriptor tanhDesc, sigDesc, activDesc;
     sigDesc  = {miopenActivationLOGISTIC, 1, 0, 1};
     tanhDesc = {miopenActivationTANH, 1, 1, 1};
@@ -228,10 +233,10 @@ void RNNDescriptor::RNNForwardInference(Handle& handle,
         activDesc = {miopenActivationTANH, 1, 1, 1};
     }
 
-    for(int li = 0; li < nLayers; li++)
-    {
+    // The input projection and biases of layer li over the whole sequence. Both schedules run
+    // it once per layer, so that they compute the same values.
+    auto project_layer = [&](int li) {
         int hid_shift           = li * batch_n * hy_stride;
-        int hx_shift            = li * hy_n * bi_stride;
         int wei_shift_bias_temp = static_cast<int>(wei_shift_bias) + li * 2 * wei_stride;
 
         // from input
@@ -259,12 +264,12 @@ void RNNDescriptor::RNNForwardInference(Handle& handle,
             {
                 miopen::GemmDescriptor gemm_desc = GemmDescriptor{false,
                                                                   false,
-                                                                  true,
+                                                                  !prepared,
                                                                   batch_n,
                                                                   wei_len * bi,
                                                                   in_h,
                                                                   in_stride,
-                                                                  in_stride,
+                                                                  prepared ? wei_stride : in_stride,
                                                                   hy_stride,
                                                                   1, // batch count
                                                                   0, // Stride A
@@ -307,12 +312,12 @@ void RNNDescriptor::RNNForwardInference(Handle& handle,
 
             miopen::GemmDescriptor gemm_desc = GemmDescriptor{false,
                                                               false,
-                                                              true,
+                                                              !prepared,
                                                               batch_n,
                                                               wei_len * bi,
                                                               hy_h * bi,
                                                               hy_stride,
-                                                              bi_stride,
+                                                              prepared ? wei_stride : bi_stride,
                                                               hy_stride,
                                                               1, // batch count
                                                               0, // Stride A
@@ -538,11 +543,19 @@ void RNNDescriptor::RNNForwardInference(Handle& handle,
                 }
             }
         }
+    };
+
+    // Runs the recurrence of the steps [ti_begin, ti_end) of layer li, whose projection is done,
+    // then the final hidden state once the last step of the layer is done.
+    auto run_steps = [&](int li, int ti_begin, int ti_end) {
+        const int row_begin = std::accumulate(in_n.begin(), in_n.begin() + ti_begin, 0);
+        int hid_shift       = li * batch_n * hy_stride;
+        int hx_shift        = li * hy_n * bi_stride;
 
         // from hidden state
-        int bacc   = 0;
-        int baccbi = batch_n;
-        for(int ti = 0; ti < seqLen; ti++)
+        int bacc   = row_begin;
+        int baccbi = batch_n - std::accumulate(in_n.end() - ti_begin, in_n.end(), 0);
+        for(int ti = ti_begin; ti < ti_end; ti++)
         {
             baccbi -= in_n.at(seqLen - 1 - ti);
             wei_shift         = in_h * wei_stride + li * (bi * hy_h + hy_h) * wei_stride;
@@ -570,12 +583,12 @@ void RNNDescriptor::RNNForwardInference(Handle& handle,
                         {
                             miopen::GemmDescriptor gemm_desc = GemmDescriptor{false,
                                                                               false,
-                                                                              true,
+                                                                              !prepared,
                                                                               in_n.at(cur_time),
                                                                               wei_len,
                                                                               hy_h,
                                                                               uni_stride,
-                                                                              uni_stride,
+                                                                              hid_ldb,
                                                                               hy_stride,
                                                                               1, // batch count
                                                                               0, // Stride A
@@ -619,12 +632,12 @@ void RNNDescriptor::RNNForwardInference(Handle& handle,
                             miopen::GemmDescriptor gemm_desc =
                                 GemmDescriptor{false,
                                                false,
-                                               true,
+                                               !prepared,
                                                (in_n.at(cur_time) - in_n.at(use_time)),
                                                wei_len,
                                                hy_h,
                                                uni_stride,
-                                               uni_stride,
+                                               hid_ldb,
                                                hy_stride,
                                                1, // batch count
                                                0, // Stride A
@@ -665,12 +678,12 @@ void RNNDescriptor::RNNForwardInference(Handle& handle,
                         {
                             miopen::GemmDescriptor gemm_desc = GemmDescriptor{false,
                                                                               false,
-                                                                              true,
+                                                                              !prepared,
                                                                               in_n.at(use_time),
                                                                               wei_len,
                                                                               hy_h,
                                                                               hy_stride,
-                                                                              uni_stride,
+                                                                              hid_ldb,
                                                                               hy_stride,
                                                                               1, // batch count
                                                                               0, // Stride A
@@ -1166,7 +1179,8 @@ void RNNDescriptor::RNNForwardInference(Handle& handle,
         }
 
         // update hy, cy
-        if(hy != nullptr || (rnnMode == miopenLSTM && cy != nullptr))
+        const bool last_steps = ti_end == seqLen || in_n.at(ti_end) == 0;
+        if(last_steps && (hy != nullptr || (rnnMode == miopenLSTM && cy != nullptr)))
         {
             hx_size[2] = hy_h;
             sp_size[2] = hy_h;
@@ -1232,6 +1246,28 @@ void RNNDescriptor::RNNForwardInference(Handle& handle,
                 baccbi += in_n.at(seqLen - 1 - ti);
             }
         }
+    };
+
+    if(wavefrontStreams != 0 && dirMode == miopenRNNunidirection)
+    {
+        // Trailing steps without any sequence left have no work
+        const int steps = static_cast<int>(
+            std::count_if(in_n.begin(), in_n.end(), [](int n) { return n > 0; }));
+        const RNNWavefrontSchedule schedule{static_cast<int>(nLayers), steps, wavefrontStreams};
+        MIOPEN_LOG_I2(schedule);
+        schedule.Execute(handle, [&](const RNNWavefrontTask& task) {
+            if(task.step == 0)
+                project_layer(task.layer);
+            run_steps(task.layer, task.step, task.step + 1);
+        });
+    }
+    else
+    {
+        for(int li = 0; li < nLayers; li++)
+        {
+            project_layer(li);
+            run_steps(li, 0, seqLen);
+        }
     }
 
     // output
@@ -1289,6 +1325,11 @@ void RNNDescriptor::RNNForwardTraining(Handle& handle,
     {
         MIOPEN_THROW(miopenStatusBadParm);
     }
+    if(weightLayout != miopenRNNWeightsCanonical)
+    {
+        MIOPEN_THROW(miopenStatusNotImplemented,
+                     "Only forward inference supports the prepared weight layout");
+    }
     if(hxDesc.GetSize() != cxDesc.GetSize() || hxDesc.GetSize() != hyDesc.GetSize() ||
        hxDesc.GetSize() != cyDesc.GetSize())
     {
@@ -2601,6 +2642,11 @@ void RNNDescriptor::RNNBackwardData(Handle& handle,
     {
         MIOPEN_THROW(miopenStatusBadParm);
     }
+    if(weightLayout != miopenRNNWeightsCanonical)
+    {
+        MIOPEN_THROW(miopenStatusNotImplemented,
+                     "Only forward inference supports the prepared weight layout");
+    }
     if(dhyDesc.GetSize() != dcyDesc.GetSize() || dhyDesc.GetSize() != hxDesc.GetSize() ||
        dhyDesc.GetSize() != cxDesc.GetSize() || dhyDesc.GetSize() != dhxDesc.GetSize() ||
        dhyDesc.GetSize() != dcxDesc.GetSize())
@@ -4083,6 +4129,11 @@ void RNNDescriptor::RNNBackwardWeights(Handle& handle,
     {
         MIOPEN_THROW(miopenStatusBadParm);
     }
+    if(weightLayout != miopenRNNWeightsCanonical)
+    {
+        MIOPEN_THROW(miopenStatusNotImplemented,
+                     "Only forward inference supports the prepared weight layout");
+    }
     if(workSpaceSize < GetWorkspaceSize(handle, seqLen, xDesc))
     {
         MIOPEN_THROW("Workspace is required");
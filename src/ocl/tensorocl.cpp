@@ -24,20 +24,29 @@
  *
  *******************************************************************************/
 #include <miopen/tensor.hpp>
+#include <miopen/activ.hpp>
 #include <miopen/errors.hpp>
 #include <miopen/float_equal.hpp>
 #include <miopen/handle.hpp>
 #include <miopen/tensor_ops.hpp>
+#include <miopen/tensor_op_plan.hpp>
+#include <miopen/layout_transform_plan.hpp>
+#include <miopen/batched_transpose_sol.hpp>
 #include <miopen/datatype.hpp>
+#include <miopen/env.hpp>
 #include <miopen/visit_float.hpp>
 #include <miopen/util.hpp>
 #include <algorithm>
 #include <cassert>
+#include <limits>
 #include <numeric>
 #include <boost/range/combine.hpp>
 
 #define MIO_TENSOROCL_DEBUG 0
 
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_SUBTENSOR_SPECIALIZED_KERNELS)
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_TENSOR_OP_LEGACY)
+
 namespace miopen {
 
 TensorDescriptor GetFlattenedTensorDescriptor(const TensorDescriptor& desc)
@@ -85,8 +94,8 @@ TensorDescriptor GetFlattenedTensorDescriptor(const TensorDescriptor& desc)
 
 // Free Tensor Functions
 static void CreateBitmapAndGrid(unsigned int& bitmap,
-                                const std::vector<std::size_t>& a_lens,
-                                const std::vector<std::size_t>& c_lens,
+                                const TensorDims& a_lens,
+                                const TensorDims& c_lens,
                                 int& num_wg,
                                 int& work,
                                 int d)
@@ -1288,6 +1297,31 @@ void OpTensor(const Handle& handle,
         }
     }
 
+    // The elementwise kernels cover every broadcast pattern of B; the shape specific kernels
+    // below are kept for the squash case, double and mismatched A/C lengths.
+    const auto type = cTensorDesc.GetType();
+    if(!is_squash && !IsEnabled(MIOPEN_DEBUG_TENSOR_OP_LEGACY{}) &&
+       aTensorDesc.GetType() == type && aTensorDesc.GetLengths() == clens &&
+       (type == miopenHalf || type == miopenFloat || type == miopenBFloat16))
+    {
+        OpTensorFused(handle,
+                      tensorOp,
+                      alpha0,
+                      aTensorDesc,
+                      ATensor,
+                      alpha1,
+                      bTensorDesc,
+                      BTensor,
+                      beta,
+                      cTensorDesc,
+                      CTensor,
+                      nullptr,
+                      Aoffset,
+                      Boffset,
+                      Coffset);
+        return;
+    }
+
     auto bsize = blens.size();
     if(bsize == 3)
     {
@@ -1361,7 +1395,192 @@ struct two_exp_ceiling_t
     }
 };
 
-static std::vector<std::size_t> get_worker_sizes(const std::vector<std::size_t>& data_sizes)
+void OpTensorFused(const Handle& handle,
+                   miopenTensorOp_t tensorOp,
+                   const void* alpha0,
+                   const TensorDescriptor& aTensorDesc,
+                   ConstData_t ATensor,
+                   const void* alpha1,
+                   const TensorDescriptor& bTensorDesc,
+                   ConstData_t BTensor,
+                   const void* beta,
+                   const TensorDescriptor& cTensorDesc,
+                   Data_t CTensor,
+                   const ActivationDescriptor* activDesc,
+                   const size_t Aoffset,
+                   const size_t Boffset,
+                   const size_t Coffset)
+{
+    if(ATensor == nullptr || BTensor == nullptr || CTensor == nullptr)
+    {
+        MIOPEN_THROW(miopenStatusBadParm);
+    }
+
+    const auto type = cTensorDesc.GetType();
+    if(aTensorDesc.GetType() != type || bTensorDesc.GetType() != type)
+    {
+        MIOPEN_THROW(miopenStatusBadParm, "Datatypes for A, B and C tensors do not match");
+    }
+
+    if(type != miopenHalf && type != miopenFloat && type != miopenBFloat16)
+    {
+        MIOPEN_THROW(miopenStatusBadParm,
+                     "Unsupported datatype for elementwise tensor ops: " + GetDataType(type));
+    }
+
+    if(cTensorDesc.GetLengths().size() > TensorOpPlan::max_dims)
+    {
+        MIOPEN_THROW("Tensor dimension larger than 5: " +
+                     std::to_string(cTensorDesc.GetLengths().size()));
+    }
+
+    const auto plan = TensorOpPlan::Make(aTensorDesc, bTensorDesc, cTensorDesc);
+    MIOPEN_LOG_I2("OpTensor plan: " << plan);
+
+    const auto activ_mode = activDesc != nullptr ? activDesc->GetMode() : miopenActivationPASTHRU;
+
+    const float activ_alpha = activDesc != nullptr ? activDesc->GetAlpha() : 0.0;
+    const float activ_beta  = activDesc != nullptr ? activDesc->GetBeta() : 0.0;
+    const float activ_gamma = activDesc != nullptr ? activDesc->GetGamma() : 0.0;
+
+    const float miopen_alpha0 = *(static_cast<const float*>(alpha0));
+    const float miopen_alpha1 = *(static_cast<const float*>(alpha1));
+    const float miopen_beta   = *(static_cast<const float*>(beta));
+    const bool read_c         = !float_equal(miopen_beta, 0.0f);
+
+    const std::size_t n = plan.GetElementSize();
+
+    int vec = 1;
+    std::string kernel_name;
+    switch(plan.kind)
+    {
+    case TensorOpKind::Contiguous:
+        kernel_name = "ElementwiseContiguous";
+        vec         = 4;
+        break;
+    case TensorOpKind::ScalarB:
+        kernel_name = "ElementwiseScalarB";
+        vec         = 4;
+        break;
+    case TensorOpKind::ChannelB:
+        kernel_name = "ElementwiseChannelB";
+        vec         = plan.inner % 4 == 0 ? 4 : 1;
+        break;
+    case TensorOpKind::Generic: kernel_name = "ElementwiseGeneric"; break;
+    }
+
+    // Only the grid size depends on the shape. It is rounded to a power of two, so that few
+    // kernel objects are created, and all of them share one program.
+    const std::size_t work = std::max<std::size_t>((n + vec - 1) / vec, 1);
+    const std::size_t wgd  = std::min(two_exp_ceiling_t{}(work), std::size_t{65536});
+    const std::size_t wld  = 256 < wgd ? 256 : wgd;
+
+    const auto ndims = plan.lens.size();
+
+    std::string network_config = "ew " + std::to_string(type) + " " + std::to_string(tensorOp) +
+                                 " " + ToString(plan.kind) + " " + std::to_string(vec) + " " +
+                                 std::to_string(read_c) + " " + std::to_string(activ_mode) + " " +
+                                 std::to_string(wgd);
+    if(plan.kind == TensorOpKind::Generic)
+        network_config += " " + std::to_string(ndims);
+
+    std::string parms = GetDataTypeKernelParams(type);
+    parms += " -DMIO_EW_OP=" + std::to_string(tensorOp);
+    parms += " -DMIO_EW_ACTIV=" + std::to_string(activ_mode);
+    parms += " -DMIO_EW_BETA=" + std::to_string(read_c ? 1 : 0);
+    parms += " -DMIO_EW_VEC=" + std::to_string(vec);
+    if(plan.kind == TensorOpKind::Generic)
+        parms += " -DMIO_EW_NDIMS=" + std::to_string(ndims);
+
+    auto&& kernels = handle.GetKernels(kernel_name, network_config);
+    auto kernel    = !kernels.empty() ? kernels.front()
+                                      : handle.AddKernel(kernel_name,
+                                                         network_config,
+                                                         "MIOpenTensorElementwise.cl",
+                                                         kernel_name,
+                                                         {wld, 1, 1},
+                                                         {wgd, 1, 1},
+                                                         parms);
+
+    switch(plan.kind)
+    {
+    case TensorOpKind::Contiguous:
+    case TensorOpKind::ScalarB:
+        kernel(ATensor,
+               BTensor,
+               CTensor,
+               miopen_alpha0,
+               miopen_alpha1,
+               miopen_beta,
+               activ_alpha,
+               activ_beta,
+               activ_gamma,
+               long(n),
+               long(Aoffset),
+               long(Boffset),
+               long(Coffset));
+        break;
+    case TensorOpKind::ChannelB:
+        kernel(ATensor,
+               BTensor,
+               CTensor,
+               miopen_alpha0,
+               miopen_alpha1,
+               miopen_beta,
+               activ_alpha,
+               activ_beta,
+               activ_gamma,
+               long(plan.outer),
+               int(plan.mid),
+               int(plan.inner),
+               long(Aoffset),
+               long(Boffset),
+               long(Coffset));
+        break;
+    case TensorOpKind::Generic: {
+        // unused trailing dimensions are never read by the kernel
+        auto dim = [&](const std::vector<std::size_t>& v, std::size_t i) {
+            return i < ndims ? int(v[i]) : 1;
+        };
+        kernel(ATensor,
+               BTensor,
+               CTensor,
+               miopen_alpha0,
+               miopen_alpha1,
+               miopen_beta,
+               activ_alpha,
+               activ_beta,
+               activ_gamma,
+               long(n),
+               long(Aoffset),
+               long(Boffset),
+               long(Coffset),
+               dim(plan.lens, 0),
+               dim(plan.lens, 1),
+               dim(plan.lens, 2),
+               dim(plan.lens, 3),
+               dim(plan.lens, 4),
+               dim(plan.a_strides, 0),
+               dim(plan.a_strides, 1),
+               dim(plan.a_strides, 2),
+               dim(plan.a_strides, 3),
+               dim(plan.a_strides, 4),
+               dim(plan.b_strides, 0),
+               dim(plan.b_strides, 1),
+               dim(plan.b_strides, 2),
+               dim(plan.b_strides, 3),
+               dim(plan.b_strides, 4),
+               dim(plan.c_strides, 0),
+               dim(plan.c_strides, 1),
+               dim(plan.c_strides, 2),
+               dim(plan.c_strides, 3),
+               dim(plan.c_strides, 4));
+        break;
+    }
+    }
+}
+
+static std::vector<std::size_t> get_worker_sizes(const TensorDims& data_sizes)
 {
     const std::size_t dim = data_sizes.size();
 
@@ -1389,6 +1608,77 @@ static std::vector<std::size_t> get_worker_sizes(const std::vector<std::size_t>&
     return worker_sizes;
 }
 
+// Sub-tensor kernels are built once per rank and compute their work split at run time, see
+// subtensor_work_lengths.h. A kernel built for the exact lengths is still used when one is
+// cached, and MIOPEN_DEBUG_SUBTENSOR_SPECIALIZED_KERNELS builds one for every new shape.
+static KernelInvoke GetSubTensorKernel(const Handle& handle,
+                                       const std::string& kernel_name,
+                                       const std::string& program_name,
+                                       const std::string& network_config,
+                                       const std::string& parms,
+                                       const TensorDims& lens)
+{
+    std::string specialized_config = network_config;
+    for(auto& len : lens)
+    {
+        specialized_config += " " + std::to_string(len);
+    }
+
+    auto&& specialized = handle.GetKernels(kernel_name, specialized_config);
+    if(!specialized.empty())
+        return specialized.front();
+
+    if(IsEnabled(MIOPEN_DEBUG_SUBTENSOR_SPECIALIZED_KERNELS{}))
+    {
+        std::vector<std::size_t> worker_sizes = get_worker_sizes(lens);
+
+        std::size_t wgd = std::accumulate(worker_sizes.begin(),
+                                          worker_sizes.end(),
+                                          std::size_t{1},
+                                          std::multiplies<std::size_t>());
+
+        std::size_t wld = 256 < wgd ? 256 : wgd;
+
+        std::string specialized_parms = parms;
+        for(std::size_t i = 0; i < lens.size(); ++i)
+        {
+            specialized_parms +=
+                " -DWORK_LENGTH_" + std::to_string(i) + "=" + std::to_string(worker_sizes[i]);
+        }
+
+        return handle.AddKernel(kernel_name,
+                                specialized_config,
+                                program_name,
+                                kernel_name,
+                                {wld, 1, 1},
+                                {wgd, 1, 1},
+                                specialized_parms);
+    }
+
+    // Only the grid size depends on the shape. It is rounded to a power of two, so that few
+    // kernel objects are created, and all of them share one program.
+    const std::size_t elements = std::accumulate(
+        lens.begin(), lens.end(), std::size_t{1}, std::multiplies<std::size_t>());
+
+    std::size_t wgd = std::min(two_exp_ceiling_t{}(std::max(elements, std::size_t{1})),
+                               std::size_t{65536});
+    std::size_t wld = 256 < wgd ? 256 : wgd;
+
+    const std::string dynamic_config = network_config + " dynamic " + std::to_string(wgd);
+
+    auto&& kernels = handle.GetKernels(kernel_name, dynamic_config);
+    if(!kernels.empty())
+        return kernels.front();
+
+    return handle.AddKernel(kernel_name,
+                            dynamic_config,
+                            program_name,
+                            kernel_name,
+                            {wld, 1, 1},
+                            {wgd, 1, 1},
+                            parms + " -DSUBTENSOR_DYNAMIC_WORK=1");
+}
+
 void SetTensor(const Handle& handle,
                const TensorDescriptor& yDesc,
                Data_t y,
@@ -1419,48 +1709,17 @@ void SetTensor(const Handle& handle,
 
     const miopenDataType_t dataType = yDesc_flat.GetType();
 
-    std::string network_config = "set " + std::to_string(dataType);
-    for(auto& len : yDesc_flat.GetLengths())
-    {
-        network_config += " " + std::to_string(len);
-    }
-
-    auto&& kernels = handle.GetKernels(kernel_name, network_config);
+    const std::string network_config = "set " + std::to_string(dataType);
 
-    KernelInvoke kernel;
-
-    if(!kernels.empty())
-    {
-        kernel = kernels.front();
-    }
-    else
-    {
-        std::string program_name = "MIOpenSubTensorOpWithScalarKernel.cl";
+    const std::string parms = "-DSUBTENSOR_OP_WITH_SCALAR=SUBTENSOR_OP_WITH_SCALAR_SET" +
+                              GetDataTypeKernelParams(dataType);
 
-        std::vector<std::size_t> worker_sizes = get_worker_sizes(yDesc_flat.GetLengths());
-
-        std::size_t wgd = std::accumulate(worker_sizes.begin(),
-                                          worker_sizes.end(),
-                                          std::size_t{1},
-                                          std::multiplies<std::size_t>());
-
-        std::size_t wld = 256 < wgd ? 256 : wgd;
-
-        std::string parms = "-DSUBTENSOR_OP_WITH_SCALAR=SUBTENSOR_OP_WITH_SCALAR_SET" +
-                            GetDataTypeKernelParams(dataType);
-        for(int i = 0; i < yDim_flat; ++i)
-        {
-            parms += " -DWORK_LENGTH_" + std::to_string(i) + "=" + std::to_string(worker_sizes[i]);
-        }
-
-        kernel = handle.AddKernel(kernel_name,
-                                  network_config,
-                                  program_name,
-                                  kernel_name,
-                                  {wld, 1, 1},
-                                  {wgd, 1, 1},
-                                  parms);
-    }
+    KernelInvoke kernel = GetSubTensorKernel(handle,
+                                             kernel_name,
+                                             "MIOpenSubTensorOpWithScalarKernel.cl",
+                                             network_config,
+                                             parms,
+                                             yDesc_flat.GetLengths());
 
     switch(yDim_flat)
     {
@@ -1578,50 +1837,19 @@ void ScaleTensor(const Handle& handle,
 
     std::string kernel_name = "SubTensorOpWithScalar" + std::to_string(yDim_flat) + "d";
 
-    const std::vector<std::size_t>& lens = yDesc_flat.GetLengths();
-
-    std::string network_config = "scale " + std::to_string(yDesc_flat.GetType());
-    for(auto& len : lens)
-    {
-        network_config += " " + std::to_string(len);
-    }
-
-    auto&& kernels = handle.GetKernels(kernel_name, network_config);
-
-    KernelInvoke kernel;
-
-    if(!kernels.empty())
-    {
-        kernel = kernels.front();
-    }
-    else
-    {
-        std::string program_name = "MIOpenSubTensorOpWithScalarKernel.cl";
-
-        std::vector<std::size_t> worker_sizes = get_worker_sizes(lens);
-
-        std::size_t wgd = std::accumulate(worker_sizes.begin(),
-                                          worker_sizes.end(),
-                                          std::size_t{1},
-                                          std::multiplies<std::size_t>());
+    const auto& lens = yDesc_flat.GetLengths();
 
-        std::size_t wld = 256 < wgd ? 256 : wgd;
+    const std::string network_config = "scale " + std::to_string(yDesc_flat.GetType());
 
-        std::string parms = "-DSUBTENSOR_OP_WITH_SCALAR=SUBTENSOR_OP_WITH_SCALAR_MULTIPLY" +
-                            GetDataTypeKernelParams(dataType);
-        for(int i = 0; i < yDim_flat; ++i)
-        {
-            parms += " -DWORK_LENGTH_" + std::to_string(i) + "=" + std::to_string(worker_sizes[i]);
-        }
+    const std::string parms = "-DSUBTENSOR_OP_WITH_SCALAR=SUBTENSOR_OP_WITH_SCALAR_MULTIPLY" +
+                              GetDataTypeKernelParams(dataType);
 
-        kernel = handle.AddKernel(kernel_name,
-                                  network_config,
-                                  program_name,
-                                  kernel_name,
-                                  {wld, 1, 1},
-                                  {wgd, 1, 1},
-                                  parms);
-    }
+    KernelInvoke kernel = GetSubTensorKernel(handle,
+                                             kernel_name,
+                                             "MIOpenSubTensorOpWithScalarKernel.cl",
+                                             network_config,
+                                             parms,
+                                             lens);
 
     switch(yDim_flat)
     {
@@ -1753,51 +1981,20 @@ void CopyTensor(const Handle& handle,
     {
         std::string kernel_name = "SubTensorOpWithSubTensor" + std::to_string(srcDim_flat) + "d";
 
-        const std::vector<std::size_t>& lens = srcDesc_flat.GetLengths();
+        const auto& lens = srcDesc_flat.GetLengths();
 
-        std::string network_config = "copy " + std::to_string(srcDesc_flat.GetType());
-        for(auto& len : lens)
-        {
-            network_config += " " + std::to_string(len);
-        }
+        const std::string network_config = "copy " + std::to_string(srcDesc_flat.GetType());
 
-        auto&& kernels = handle.GetKernels(kernel_name, network_config);
+        const std::string parms =
+            "-DSUBTENSOR_OP_WITH_SUBTENSOR=SUBTENSOR_OP_WITH_SUBTENSOR_COPY" +
+            GetDataTypeKernelParams(srcDesc_flat.GetType());
 
-        KernelInvoke kernel;
-
-        if(!kernels.empty())
-        {
-            kernel = kernels.front();
-        }
-        else
-        {
-            std::string program_name = "MIOpenSubTensorOpWithSubTensorKernel.cl";
-
-            std::vector<std::size_t> worker_sizes = get_worker_sizes(lens);
-
-            std::size_t wgd = std::accumulate(worker_sizes.begin(),
-                                              worker_sizes.end(),
-                                              std::size_t{1},
-                                              std::multiplies<std::size_t>());
-
-            std::size_t wld = 256 < wgd ? 256 : wgd;
-
-            std::string parms = "-DSUBTENSOR_OP_WITH_SUBTENSOR=SUBTENSOR_OP_WITH_SUBTENSOR_COPY" +
-                                GetDataTypeKernelParams(srcDesc_flat.GetType());
-            for(unsigned long i = 0; i < srcDim_flat; ++i)
-            {
-                parms +=
-                    " -DWORK_LENGTH_" + std::to_string(i) + "=" + std::to_string(worker_sizes[i]);
-            }
-
-            kernel = handle.AddKernel(kernel_name,
-                                      network_config,
-                                      program_name,
-                                      kernel_name,
-                                      {wld, 1, 1},
-                                      {wgd, 1, 1},
-                                      parms);
-        }
+        KernelInvoke kernel = GetSubTensorKernel(handle,
+                                                 kernel_name,
+                                                 "MIOpenSubTensorOpWithSubTensorKernel.cl",
+                                                 network_config,
+                                                 parms,
+                                                 lens);
 
         switch(srcDim_flat)
         {
@@ -1969,59 +2166,28 @@ void CastTensor(const Handle& handle,
     {
         std::string kernel_name = "SubTensorOpWithCastTensor" + std::to_string(srcDim_flat) + "d";
 
-        const std::vector<std::size_t>& lens = srcDesc_flat.GetLengths();
+        const auto& lens = srcDesc_flat.GetLengths();
 
-        std::string network_config = "cast " + std::to_string(dstDesc_flat.GetType());
-        for(auto& len : lens)
-        {
-            network_config += " " + std::to_string(len);
-        }
+        const std::string network_config = "cast " + std::to_string(srcDesc_flat.GetType()) +
+                                           " " + std::to_string(dstDesc_flat.GetType());
 
-        auto&& kernels = handle.GetKernels(kernel_name, network_config);
-        KernelInvoke kernel;
-
-        auto miopen_alpha = *(static_cast<const float*>(alpha));
+        std::string parms =
+            GetCastTensorBuildOptionFromType(" -DMIOPEN_SRC_TYPE=", srcDesc_flat.GetType()) +
+            GetCastTensorBuildOptionFromType(" -DMIOPEN_DST_TYPE=", dstDesc_flat.GetType());
 
-        if(!kernels.empty())
+        if(dstDesc_flat.GetType() == miopenBFloat16)
         {
-            kernel = kernels.front();
+            parms += " -DMIOPEN_USE_RNE_BFLOAT16=1";
         }
-        else
-        {
-            std::string program_name = "MIOpenSubTensorOpWithCastTensorKernel.cl";
-
-            std::vector<std::size_t> worker_sizes = get_worker_sizes(lens);
-
-            std::size_t wgd = std::accumulate(worker_sizes.begin(),
-                                              worker_sizes.end(),
-                                              std::size_t{1},
-                                              std::multiplies<std::size_t>());
-
-            std::size_t wld = 256 < wgd ? 256 : wgd;
 
-            std::string parms =
-                GetCastTensorBuildOptionFromType(" -DMIOPEN_SRC_TYPE=", srcDesc_flat.GetType()) +
-                GetCastTensorBuildOptionFromType(" -DMIOPEN_DST_TYPE=", dstDesc_flat.GetType());
+        KernelInvoke kernel = GetSubTensorKernel(handle,
+                                                 kernel_name,
+                                                 "MIOpenSubTensorOpWithCastTensorKernel.cl",
+                                                 network_config,
+                                                 parms,
+                                                 lens);
 
-            for(unsigned long i = 0; i < srcDim_flat; ++i)
-            {
-                parms +=
-                    " -DWORK_LENGTH_" + std::to_string(i) + "=" + std::to_string(worker_sizes[i]);
-            }
-
-            if(dstDesc_flat.GetType() == miopenBFloat16)
-            {
-                parms += " -DMIOPEN_USE_RNE_BFLOAT16=1";
-            }
-
-            kernel = handle.AddKernel(kernel_name,
-                                      network_config,
-                                      program_name,
-                                      kernel_name,
-                                      {wld, 1, 1},
-                                      {wgd, 1, 1},
-                                      parms);
-        }
+        auto miopen_alpha = *(static_cast<const float*>(alpha));
 
         switch(srcDim_flat)
         {
@@ -2120,6 +2286,56 @@ void CastTensor(const Handle& handle,
     }
 }
 
+#if MIOPEN_BACKEND_HIP
+// Runs the tiled kernel of BatchedTransposeSolution for a plan of the BatchedTranspose kind.
+static void BatchedTransposeTensor(const Handle& handle,
+                                   const LayoutTransformPlan& plan,
+                                   miopenDataType_t type,
+                                   ConstData_t x,
+                                   Data_t y,
+                                   size_t Xoffset,
+                                   size_t Yoffset)
+{
+    const BatchedTransposeSolution solution(static_cast<int>(handle.GetMaxComputeUnits()),
+                                            type,
+                                            static_cast<uint32_t>(plan.batch),
+                                            static_cast<uint32_t>(plan.height),
+                                            static_cast<uint32_t>(plan.width));
+    const auto kernel_info = solution.GetKernel();
+
+    const auto network_config =
+        "transpose " + kernel_info.kernel_name + " g" + std::to_string(kernel_info.g_wk[0]);
+
+    auto&& kernels = handle.GetKernels(kernel_info.kernel_name, network_config);
+
+    KernelInvoke kernel;
+
+    if(!kernels.empty())
+    {
+        kernel = kernels.front();
+    }
+    else
+    {
+        kernel = handle.AddKernel(kernel_info.kernel_name,
+                                  network_config,
+                                  kernel_info.kernel_file,
+                                  kernel_info.kernel_name,
+                                  kernel_info.l_wk,
+                                  kernel_info.g_wk,
+                                  kernel_info.comp_options);
+    }
+
+    const auto type_size = GetTypeSize(type);
+    const auto x_data    = static_cast<const char*>(x) + Xoffset * type_size;
+    const auto y_data    = static_cast<char*>(y) + Yoffset * type_size;
+
+    auto args = solution.GetKernelArg();
+    args[0]   = OpKernelArg(y_data);
+    args[1]   = OpKernelArg(const_cast<char*>(x_data));
+    kernel(args);
+}
+#endif
+
 void TransformTensor(const Handle& handle,
                      const void* alpha,
                      const TensorDescriptor& xDesc,
@@ -2276,9 +2492,42 @@ void TransformTensor(const Handle& handle,
             MIOPEN_THROW("Tensor x and y have different data types");
         }
 
+        const auto plan = LayoutTransformPlan::Make(xDesc, yDesc);
+        MIOPEN_LOG_I2("TransformTensor " << plan);
+
+        bool plain_copy = false;
+        visit_float(dataTypey, [&](auto as_float) {
+            plain_copy = float_equal(static_cast<double>(*as_float(alpha)), 1.0) &&
+                         float_equal(static_cast<double>(*as_float(beta)), 0.0);
+        });
+
+        if(plain_copy && plan.kind == LayoutTransformKind::View && x == y && Xoffset == Yoffset)
+        {
+            return;
+        }
+
+#if MIOPEN_BACKEND_HIP
+        if(plain_copy && plan.IsContiguous())
+        {
+            const auto type_size = GetTypeSize(dataTypey);
+            handle.Copy(static_cast<const char*>(x) + Xoffset * type_size,
+                        static_cast<char*>(y) + Yoffset * type_size,
+                        plan.GetElementSize() * type_size);
+            return;
+        }
+
+        if(plain_copy && plan.kind == LayoutTransformKind::BatchedTranspose &&
+           dataTypey != miopenDouble &&
+           plan.GetElementSize() <= std::numeric_limits<uint32_t>::max())
+        {
+            BatchedTransposeTensor(handle, plan, dataTypey, x, y, Xoffset, Yoffset);
+            return;
+        }
+#endif
+
         std::string kernel_name = "SubTensorOpWithTransform" + std::to_string(yDim_flat) + "d";
 
-        const std::vector<std::size_t>& lens = yDesc_flat.GetLengths();
+        const auto& lens = yDesc_flat.GetLengths();
 
         std::string network_config = "transform " + std::to_string(yDesc_flat.GetType());
         for(auto& len : lens)
@@ -23,6 +23,7 @@
  * SOFTWARE.
  *
  *******************************************************************************/
+#include <algorithm>
 #include <cassert>
 #include <miopen/fusion.hpp>
 #include <miopen/logger.hpp>
@@ -34,9 +35,25 @@ OperatorArgs::OperatorArgs() {}
 
 void OperatorArgs::ins_arg(std::string name, OpKernelArg v)
 {
-    args_map.emplace(std::make_pair(name, v));
-    //    args_map[name] = std::move(v);
-    args_vec.push_back(v);
+    for(auto& binding : bindings)
+    {
+        if(binding.layout == nullptr)
+            continue;
+        const auto it = binding.layout->op_slots.find(name);
+        if(it == binding.layout->op_slots.end())
+            continue;
+        const auto& slot = binding.layout->slots[it->second];
+        if(slot.size == v.size())
+            std::copy(v.buffer.begin(), v.buffer.end(), binding.block.begin() + slot.offset);
+        else
+            binding.layout = nullptr; // Packed again by the next Execute()
+    }
+
+    const auto it = args_map.find(name);
+    if(it != args_map.end())
+        it->second = std::move(v);
+    else
+        args_map.emplace(std::move(name), std::move(v));
 }
 
 std::ostream& operator<<(std::ostream& stream, const OperatorArgs&) // x )
@@ -34,8 +34,8 @@ namespace miopen {
 
 namespace pooling {
 
-template <typename T>
-std::string get_vect_config(const std::vector<T>& v)
+template <typename TRange>
+std::string get_vect_config(const TRange& v)
 {
     std::string str;
     for(auto itr = v.begin(); itr < v.end(); itr++)
@@ -0,0 +1,104 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/reduce/problem_description.hpp>
+#include <miopen/db_path.hpp>
+#include <miopen/names.hpp>
+
+#include <boost/filesystem.hpp>
+
+#include <sstream>
+
+namespace miopen {
+
+namespace reduce {
+
+std::size_t ProblemDescription::GetNumToReduceDims() const
+{
+    const auto& inLengths  = aDesc.GetLengths();
+    const auto& outLengths = cDesc.GetLengths();
+
+    std::size_t num = 0;
+    for(std::size_t i = 0; i < inLengths.size() && i < outLengths.size(); i++)
+    {
+        if(outLengths[i] != inLengths[i])
+            num++;
+    }
+    return num;
+}
+
+bool ProblemDescription::NeedIndices() const
+{
+    const auto reduceOp = reduceDesc.reduceTensorOp_;
+
+    return (reduceDesc.reduceTensorIndices_ == MIOPEN_REDUCE_TENSOR_FLATTENED_INDICES) &&
+           (reduceOp == MIOPEN_REDUCE_TENSOR_MIN || reduceOp == MIOPEN_REDUCE_TENSOR_MAX ||
+            reduceOp == MIOPEN_REDUCE_TENSOR_AMAX);
+}
+
+void ProblemDescription::Serialize(std::ostream& stream) const
+{
+    // The kernels read lengths and strides at run time, so only the shape of the 2D reduction
+    // they see and the number of dimensions on each side are part of the key.
+    stream << GetInvariantLength() << 'x' << GetToReduceLength();
+    stream << '-' << aDesc.GetLengths().size() << 'd' << GetNumToReduceDims();
+    stream << '-' << aDesc.GetType() << reduceDesc.reduceTensorCompType_ << cDesc.GetType();
+    stream << '-' << reduceDesc.reduceTensorOp_;
+    stream << '-' << ((reduceDesc.reduceTensorNanOpt_ == MIOPEN_PROPAGATE_NAN) ? 1 : 0)
+           << (NeedIndices() ? 1 : 0);
+}
+
+NetworkConfig ProblemDescription::MakeNetworkConfig() const
+{
+    std::ostringstream ss;
+
+    ss << "reduce-";
+    Serialize(ss);
+
+    return NetworkConfig{ss.str()};
+}
+
+PerformanceDb GetDb(const ReductionContext& ctx)
+{
+    const auto basename = ctx.GetStream().GetDbBasename();
+    const auto system_db =
+        (boost::filesystem::path(GetSystemDbPath()) / (basename + ".reduce.pdb.txt")).string();
+
+    // an empty user-db path indicates user intent to disable the database
+    const auto& udb = GetUserDbPath();
+    const auto user_db =
+        udb.empty()
+            ? std::string{}
+            : (boost::filesystem::path(udb) /
+               (basename + "." + GetUserDbSuffix() + ".reduce.updb.txt"))
+                  .string();
+
+    return {system_db, user_db};
+}
+
+} // namespace reduce
+
+} // namespace miopen
@@ -221,3 +221,86 @@ extern "C" miopenStatus_t miopenReduceTensor(miopenHandle_t handle,
                           DataCast(C));
     });
 };
+
+static std::vector<const miopen::ReduceTensorDescriptor*>
+GetReduceTensorDescs(int reduceTensorDescCount,
+                     const miopenReduceTensorDescriptor_t* reduceTensorDescs)
+{
+    if(reduceTensorDescCount < 1 || reduceTensorDescs == nullptr)
+        MIOPEN_THROW(miopenStatusBadParm, "At least one ReduceTensor descriptor is required.");
+
+    std::vector<const miopen::ReduceTensorDescriptor*> descs;
+    for(int i = 0; i < reduceTensorDescCount; i++)
+        descs.push_back(&miopen::deref(reduceTensorDescs[i]));
+    return descs;
+}
+
+extern "C" miopenStatus_t
+miopenGetReductionMultiWorkspaceSize(miopenHandle_t handle,
+                                     int reduceTensorDescCount,
+                                     const miopenReduceTensorDescriptor_t* reduceTensorDescs,
+                                     const miopenTensorDescriptor_t aDesc,
+                                     const miopenTensorDescriptor_t cDesc,
+                                     size_t* sizeInBytes)
+{
+    MIOPEN_LOG_FUNCTION(
+        handle, reduceTensorDescCount, reduceTensorDescs, aDesc, cDesc, sizeInBytes);
+
+    return miopen::try_([&] {
+        miopen::deref(sizeInBytes) = miopen::GetReduceTensorMultiWorkspaceSize(
+            miopen::deref(handle),
+            GetReduceTensorDescs(reduceTensorDescCount, reduceTensorDescs),
+            miopen::deref(aDesc),
+            miopen::deref(cDesc));
+    });
+};
+
+extern "C" miopenStatus_t
+miopenReduceTensorMulti(miopenHandle_t handle,
+                        int reduceTensorDescCount,
+                        const miopenReduceTensorDescriptor_t* reduceTensorDescs,
+                        void* workspace,
+                        size_t workspaceSizeInBytes,
+                        const void* alpha,
+                        const miopenTensorDescriptor_t aDesc,
+                        const void* A,
+                        const void* beta,
+                        const miopenTensorDescriptor_t cDesc,
+                        void* const* C)
+{
+    MIOPEN_LOG_FUNCTION(handle,
+                        reduceTensorDescCount,
+                        reduceTensorDescs,
+                        workspace,
+                        workspaceSizeInBytes,
+                        alpha,
+                        aDesc,
+                        A,
+                        beta,
+                        cDesc,
+                        C);
+
+    return miopen::try_([&] {
+        const auto descs = GetReduceTensorDescs(reduceTensorDescCount, reduceTensorDescs);
+        for(const auto* desc : descs)
+            LogCmdRedux(*desc, miopen::deref(aDesc), miopen::deref(cDesc), alpha, beta);
+
+        if(C == nullptr)
+            MIOPEN_THROW(miopenStatusBadParm, "Output tensors are required.");
+
+        std::vector<Data_t> outputs;
+        for(int i = 0; i < reduceTensorDescCount; i++)
+            outputs.push_back(DataCast(C[i]));
+
+        miopen::ReduceTensorMulti(miopen::deref(handle),
+                                  descs,
+                                  DataCast(workspace),
+                                  workspaceSizeInBytes,
+                                  alpha,
+                                  miopen::deref(aDesc),
+                                  DataCast(A),
+                                  beta,
+                                  miopen::deref(cDesc),
+                                  outputs);
+    });
+};
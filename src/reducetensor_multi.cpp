@@ -0,0 +1,416 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/reducetensor.hpp>
+#include <miopen/datatype.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/stringutils.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace miopen {
+
+namespace {
+
+constexpr int MaxMultiReductions = 4;
+constexpr int MaxReduceDims      = 6;
+constexpr int MultiBlockSize     = 256;
+
+// Lengths and strides of a multi-reduction with the invariant dimensions first and the reduced
+// ones last. Dimensions of length 1 are dropped and neighbours that can be walked with a single
+// stride are merged, so a reduction over H and W of a packed NCHW tensor becomes a 2-d problem.
+struct MultiReductionDims
+{
+    std::array<int, MaxReduceDims> lens{};
+    std::array<int, MaxReduceDims> in_strides{};
+    std::array<int, MaxReduceDims> out_strides{};
+    int num_inv_dims    = 0;
+    int num_red_dims    = 0;
+    std::size_t inv_len = 1;
+    std::size_t red_len = 1;
+};
+
+bool NeedsIndices(const ReduceTensorDescriptor& desc)
+{
+    const auto op = desc.reduceTensorOp_;
+    return desc.reduceTensorIndices_ == MIOPEN_REDUCE_TENSOR_FLATTENED_INDICES &&
+           (op == MIOPEN_REDUCE_TENSOR_MIN || op == MIOPEN_REDUCE_TENSOR_MAX ||
+            op == MIOPEN_REDUCE_TENSOR_AMAX);
+}
+
+void CheckMultiReduction(const std::vector<const ReduceTensorDescriptor*>& descs,
+                         const TensorDescriptor& aDesc,
+                         const TensorDescriptor& cDesc)
+{
+    if(descs.empty() || descs.size() > MaxMultiReductions)
+        MIOPEN_THROW(miopenStatusBadParm,
+                     "The number of fused reductions should be from 1 to " +
+                         std::to_string(MaxMultiReductions) + ".");
+
+    for(const auto* desc : descs)
+    {
+        if(NeedsIndices(*desc))
+            MIOPEN_THROW(miopenStatusBadParm, "Fused reductions do not produce indices.");
+    }
+
+    const auto& inLens  = aDesc.GetLengths();
+    const auto& outLens = cDesc.GetLengths();
+
+    if(inLens.size() != outLens.size())
+        MIOPEN_THROW("The number of dimensions of the input and output tensor should match.");
+
+    if(inLens.size() > MaxReduceDims)
+        MIOPEN_THROW("Invalid TensorDescriptor, at most number of dimensions of 6 is supported.");
+
+    bool reduced = false;
+    for(std::size_t i = 0; i < inLens.size(); i++)
+    {
+        if(outLens[i] != 1 && outLens[i] != inLens[i])
+            MIOPEN_THROW("The length of the output tensor dimension should either be 1 or be equal "
+                         "to the length of the corresponding dimension of the input tensor.");
+        reduced = reduced || outLens[i] != inLens[i];
+    }
+
+    if(!reduced)
+        MIOPEN_THROW("Invalid TensorDescriptor, at least one dimension of the input tensor should "
+                     "be reduced.");
+}
+
+// The fused kernels accumulate in float and write the output in the input type.
+bool IsFusedMultiReduction(const std::vector<const ReduceTensorDescriptor*>& descs,
+                           const TensorDescriptor& aDesc,
+                           const TensorDescriptor& cDesc)
+{
+    const auto type = aDesc.GetType();
+    if(type != cDesc.GetType())
+        return false;
+    if(type != miopenHalf && type != miopenFloat && type != miopenBFloat16)
+        return false;
+    return std::none_of(descs.begin(), descs.end(), [](const ReduceTensorDescriptor* desc) {
+        return desc->reduceTensorCompType_ == miopenDouble;
+    });
+}
+
+MultiReductionDims GetMultiReductionDims(const TensorDescriptor& aDesc,
+                                         const TensorDescriptor& cDesc)
+{
+    const auto& inLens     = aDesc.GetLengths();
+    const auto& inStrides  = aDesc.GetStrides();
+    const auto& outLens    = cDesc.GetLengths();
+    const auto& outStrides = cDesc.GetStrides();
+
+    MultiReductionDims dims;
+    int n = 0;
+
+    auto add_dims = [&](bool invariant) {
+        const int first = n;
+        for(std::size_t i = 0; i < inLens.size(); i++)
+        {
+            if(inLens[i] == 1 || (outLens[i] == inLens[i]) != invariant)
+                continue;
+
+            const auto len = static_cast<int>(inLens[i]);
+            const auto in  = static_cast<int>(inStrides[i]);
+            const auto out = invariant ? static_cast<int>(outStrides[i]) : 0;
+
+            // the previous dimension of the group steps over exactly one run of this one
+            if(n > first && dims.in_strides[n - 1] == len * in &&
+               dims.out_strides[n - 1] == len * out)
+            {
+                dims.lens[n - 1] *= len;
+                dims.in_strides[n - 1]  = in;
+                dims.out_strides[n - 1] = out;
+                continue;
+            }
+
+            dims.lens[n]        = len;
+            dims.in_strides[n]  = in;
+            dims.out_strides[n] = out;
+            n++;
+        }
+        return n - first;
+    };
+
+    dims.num_inv_dims = add_dims(true);
+    dims.num_red_dims = add_dims(false);
+
+    // every reduced dimension has length 1, this is a copy of A scaled by alpha
+    if(dims.num_red_dims == 0)
+    {
+        dims.lens[n]       = 1;
+        dims.in_strides[n] = 1;
+        dims.num_red_dims  = 1;
+    }
+
+    for(int i = 0; i < dims.num_inv_dims; i++)
+        dims.inv_len *= dims.lens[i];
+    for(int i = dims.num_inv_dims; i < dims.num_inv_dims + dims.num_red_dims; i++)
+        dims.red_len *= dims.lens[i];
+
+    return dims;
+}
+
+// Number of work-groups that reduce one invariant index. Long rows are split until the device
+// has a few groups per compute unit, with at least 8 elements per work-item in every group.
+int GetMultiReductionBlkGroupSize(const Handle& handle, const MultiReductionDims& dims)
+{
+    if(dims.red_len <= handle.GetWavefrontWidth() && dims.inv_len > 1)
+        return 0; // threadwise
+
+    const std::size_t by_len    = dims.red_len / (MultiBlockSize * 8);
+    const std::size_t by_device = (4 * handle.GetMaxComputeUnits() + dims.inv_len - 1) /
+                                  dims.inv_len;
+    const std::size_t blk       = std::min({by_len, by_device, std::size_t{64}});
+    return static_cast<int>(std::max(blk, std::size_t{1}));
+}
+
+std::string GetMultiReductionParams(const std::vector<const ReduceTensorDescriptor*>& descs,
+                                    const TensorDescriptor& aDesc,
+                                    const MultiReductionDims& dims)
+{
+    std::string params = GetDataTypeKernelParams(aDesc.GetType());
+
+    params += " -DMIO_RED_NUM_OPS=" + std::to_string(descs.size());
+    for(std::size_t k = 0; k < descs.size(); k++)
+    {
+        params += " -DMIO_RED_OP_" + std::to_string(k) + "=" +
+                  std::to_string(static_cast<int>(descs[k]->reduceTensorOp_));
+        params += " -DMIO_RED_NAN_" + std::to_string(k) + "=" +
+                  std::to_string(static_cast<int>(descs[k]->reduceTensorNanOpt_));
+    }
+    params += " -DMIO_RED_GROUP_SIZE=" + std::to_string(MultiBlockSize);
+    params += " -DMIO_RED_NUM_INV_DIMS=" + std::to_string(dims.num_inv_dims);
+    params += " -DMIO_RED_NUM_RED_DIMS=" + std::to_string(dims.num_red_dims);
+
+    return params;
+}
+
+} // namespace
+
+std::size_t
+GetReduceTensorMultiWorkspaceSize(Handle& handle,
+                                  const std::vector<const ReduceTensorDescriptor*>& descs,
+                                  const TensorDescriptor& aDesc,
+                                  const TensorDescriptor& cDesc)
+{
+    CheckMultiReduction(descs, aDesc, cDesc);
+
+    if(!IsFusedMultiReduction(descs, aDesc, cDesc))
+    {
+        std::size_t size = 0;
+        for(const auto* desc : descs)
+            size = std::max(size, desc->GetWorkspaceSize(handle, aDesc, cDesc));
+        return size;
+    }
+
+    const auto dims        = GetMultiReductionDims(aDesc, cDesc);
+    const int blkGroupSize = GetMultiReductionBlkGroupSize(handle, dims);
+
+    return blkGroupSize > 1 ? dims.inv_len * blkGroupSize * descs.size() * sizeof(float) : 0;
+}
+
+void ReduceTensorMulti(Handle& handle,
+                       const std::vector<const ReduceTensorDescriptor*>& descs,
+                       Data_t workspace,
+                       size_t workspaceSizeInBytes,
+                       const void* alpha,
+                       const TensorDescriptor& aDesc,
+                       ConstData_t A,
+                       const void* beta,
+                       const TensorDescriptor& cDesc,
+                       const std::vector<Data_t>& C)
+{
+    CheckMultiReduction(descs, aDesc, cDesc);
+
+    if(C.size() != descs.size())
+        MIOPEN_THROW(miopenStatusBadParm, "Every fused reduction needs its own output tensor.");
+
+    // Types the fused kernels do not handle are reduced one operation at a time.
+    if(!IsFusedMultiReduction(descs, aDesc, cDesc))
+    {
+        float time = 0;
+        for(std::size_t k = 0; k < descs.size(); k++)
+        {
+            descs[k]->ReduceTensor(handle,
+                                   nullptr,
+                                   0,
+                                   workspace,
+                                   workspaceSizeInBytes,
+                                   alpha,
+                                   aDesc,
+                                   A,
+                                   beta,
+                                   cDesc,
+                                   C[k]);
+            if(handle.IsProfilingEnabled())
+                time += handle.GetKernelTime();
+        }
+        if(handle.IsProfilingEnabled())
+        {
+            handle.ResetKernelTime();
+            handle.AccumKernelTime(time);
+        }
+        return;
+    }
+
+    const auto dims        = GetMultiReductionDims(aDesc, cDesc);
+    const int blkGroupSize = GetMultiReductionBlkGroupSize(handle, dims);
+
+    const std::size_t wsSizeInBytes =
+        blkGroupSize > 1 ? dims.inv_len * blkGroupSize * descs.size() * sizeof(float) : 0;
+    if(wsSizeInBytes > 0 && (workspace == nullptr || workspaceSizeInBytes < wsSizeInBytes))
+        MIOPEN_THROW(miopenStatusBadParm, "Workspace is not large enough for the reductions.");
+
+    const float alphaVal = *reinterpret_cast<const float*>(alpha);
+    const float betaVal  = *reinterpret_cast<const float*>(beta);
+
+    const auto invLen = static_cast<int>(dims.inv_len);
+    const auto redLen = static_cast<int>(dims.red_len);
+
+    // unused outputs are never written, the first one stands in for them
+    std::array<Data_t, MaxMultiReductions> out;
+    for(std::size_t k = 0; k < out.size(); k++)
+        out[k] = C[k < C.size() ? k : 0];
+
+    const std::string program_name = "MIOpenReduceMulti.cl";
+    const std::string params       = GetMultiReductionParams(descs, aDesc, dims);
+
+    std::string network_config = "reduce_multi " + std::to_string(aDesc.GetType());
+    for(const auto* desc : descs)
+    {
+        network_config += " " + std::to_string(static_cast<int>(desc->reduceTensorOp_)) +
+                          std::to_string(static_cast<int>(desc->reduceTensorNanOpt_));
+    }
+    network_config += " " + std::to_string(dims.num_inv_dims) + "x" +
+                      std::to_string(dims.num_red_dims);
+
+    // The kernels loop over their work, so the grid only depends on the device.
+    const std::size_t numGroups = 8 * handle.GetMaxComputeUnits();
+    const std::vector<size_t> vld{MultiBlockSize, 1, 1};
+    const std::vector<size_t> vgd{numGroups * MultiBlockSize, 1, 1};
+
+    // all three kernels take the leading arguments followed by the lengths and strides
+    auto run = [&](const std::string& kernel_name, auto... args) {
+        const auto config = network_config + " " + kernel_name;
+        auto&& kernels    = handle.GetKernels("ReduceTensorMulti", config);
+        auto kernel       = !kernels.empty() ? kernels.front()
+                                             : handle.AddKernel("ReduceTensorMulti",
+                                                                config,
+                                                                program_name,
+                                                                kernel_name,
+                                                                vld,
+                                                                vgd,
+                                                                params);
+        const auto& l = dims.lens;
+        const auto& s = dims.in_strides;
+        const auto& o = dims.out_strides;
+        kernel(args...,
+               l[0],
+               l[1],
+               l[2],
+               l[3],
+               l[4],
+               l[5],
+               s[0],
+               s[1],
+               s[2],
+               s[3],
+               s[4],
+               s[5],
+               o[0],
+               o[1],
+               o[2],
+               o[3],
+               o[4],
+               o[5]);
+    };
+
+    if(blkGroupSize == 0)
+    {
+        run("ReduceMultiThreadwise",
+            A,
+            out[0],
+            out[1],
+            out[2],
+            out[3],
+            alphaVal,
+            betaVal,
+            invLen,
+            redLen);
+        return;
+    }
+
+    // rounded up to whole work-groups so that every group has the same trip count
+    const int redPerBlk = static_cast<int>(
+        ((dims.red_len + blkGroupSize - 1) / blkGroupSize + MultiBlockSize - 1) /
+        MultiBlockSize * MultiBlockSize);
+
+    run("ReduceMultiBlockwise",
+        A,
+        out[0],
+        out[1],
+        out[2],
+        out[3],
+        workspace,
+        alphaVal,
+        betaVal,
+        invLen,
+        redLen,
+        blkGroupSize,
+        redPerBlk);
+
+    if(blkGroupSize == 1)
+        return;
+
+    float time = 0;
+    if(handle.IsProfilingEnabled())
+        time = handle.GetKernelTime();
+
+    run("ReduceMultiFinal",
+        out[0],
+        out[1],
+        out[2],
+        out[3],
+        workspace,
+        alphaVal,
+        betaVal,
+        invLen,
+        redLen,
+        blkGroupSize);
+
+    if(handle.IsProfilingEnabled())
+    {
+        time += handle.GetKernelTime();
+        handle.ResetKernelTime();
+        handle.AccumKernelTime(time);
+    }
+}
+
+} // namespace miopen
@@ -279,6 +279,56 @@ std::vector<int> RNNDescriptor::pTensorLengthsCalculation(const TensorDescriptor
     return tdim;
 }
 
+size_t RNNDescriptor::paramsViewCalculation(const TensorDescriptor& xDesc,
+                                            const int layer,
+                                            const int paramID,
+                                            TensorDescriptor& viewDesc) const
+{
+    auto pDims = pTensorLengthsCalculation(xDesc, layer, paramID);
+    if(weightLayout == miopenRNNWeightsCanonical)
+    {
+        viewDesc = miopen::TensorDescriptor(dataType, pDims.data(), 2);
+        return paramsOffsetCalculation(xDesc, layer, paramID);
+    }
+
+    // In the prepared layout every weight block of a layer is stored transposed: the input block
+    // of a layer is [inputs x gates of both directions] and the hidden state block of each
+    // direction is [hsize x gates], so a parameter matrix is a column slice of its block.
+    auto inputVectorLen = xDesc.GetLengths()[1];
+    if(inputMode == miopenRNNskip)
+    {
+        inputVectorLen = 0;
+    }
+    const size_t bi         = dirMode != 0u ? 2 : 1;
+    const size_t layerID    = layer / bi;
+    const size_t dirID      = layer % bi;
+    const size_t gateLen    = nHiddenTensorsPerLayer * hsize;
+    const size_t wei_stride = gateLen * bi;
+
+    size_t offset = 0;
+    size_t ld     = 0;
+    if(paramID < nHiddenTensorsPerLayer)
+    {
+        if(layerID > 0)
+        {
+            offset = (inputVectorLen + hsize) * wei_stride +
+                     (layerID - 1) * (bi * hsize + hsize) * wei_stride;
+        }
+        offset += dirID * gateLen + paramID * hsize;
+        ld = wei_stride;
+    }
+    else
+    {
+        offset = inputVectorLen * wei_stride + layerID * (bi * hsize + hsize) * wei_stride;
+        offset += dirID * gateLen * hsize + (paramID - nHiddenTensorsPerLayer) * hsize;
+        ld = gateLen;
+    }
+
+    std::vector<int> pStrides = {1, static_cast<int>(ld)};
+    viewDesc = miopen::TensorDescriptor(dataType, pDims.data(), pStrides.data(), 2);
+    return offset;
+}
+
 RNNDescriptor::RNNDescriptor()
 {
     nLayers                     = 1;
@@ -638,7 +688,8 @@ void RNNDescriptor::GetLayerParam(const Handle& handle,
     }
 
     // Calculate the location of the matrix via paramID, bidirection setting, and params
-    auto poffset = paramsOffsetCalculation(xDesc, layer, paramID);
+    TensorDescriptor paramSrc;
+    auto poffset = paramsViewCalculation(xDesc, layer, paramID, paramSrc);
 
 #if(MIO_RNN_DEBUG == 1)
     fprintf(stderr,
@@ -650,7 +701,7 @@ void RNNDescriptor::GetLayerParam(const Handle& handle,
 #endif
 
     // Copy over data to previously allocated param tensor
-    miopen::CopyTensor(handle, paramDesc, w, paramDesc, param, poffset, 0);
+    miopen::CopyTensor(handle, paramSrc, w, paramDesc, param, poffset, 0);
 }
 
 void RNNDescriptor::GetLayerBias(const Handle& handle,
@@ -717,17 +768,9 @@ void RNNDescriptor::SetLayerParam(const Handle& handle,
     }
 
     // 1. Calculate the location of the matrix via paramID, bidirection setting, and params
-    auto poffset = paramsOffsetCalculation(xDesc, layer, paramID);
-
-    // 2. Calculate the strides for the matrix
-    std::vector<int> pstride(2, 1);
-
-    pstride[1] = paramDesc.GetLengths()[0];
-
-    std::vector<int> intLens(paramDesc.GetLengths().begin(), paramDesc.GetLengths().end());
-
-    // 3. Construct descriptor to access into w
-    auto paramSrc = miopen::TensorDescriptor(dataType, intLens.data(), pstride.data(), 2);
+    // 2. Construct descriptor to access into w
+    TensorDescriptor paramSrc;
+    auto poffset = paramsViewCalculation(xDesc, layer, paramID, paramSrc);
 
     if(paramSrc.GetLengths() != paramDesc.GetLengths())
     {
@@ -743,7 +786,7 @@ void RNNDescriptor::SetLayerParam(const Handle& handle,
             paramDesc.GetElementSize());
 #endif
 
-    // 4. Copy over data to previously allocated param tensor
+    // 3. Copy over data to previously allocated param tensor
     miopen::CopyTensor(handle, paramDesc, param, paramSrc, w, 0, poffset);
 }
 
@@ -800,6 +843,75 @@ void RNNDescriptor::SetLayerBias(const Handle& handle,
     miopen::CopyTensor(handle, biasSrc, bias, biasDesc, w, 0, boffset);
 }
 
+void RNNDescriptor::PrepareWeights(Handle& handle,
+                                   const TensorDescriptor& xDesc,
+                                   const TensorDescriptor& wDesc,
+                                   ConstData_t w,
+                                   const TensorDescriptor& preparedDesc,
+                                   Data_t prepared) const
+{
+    if(w == nullptr || prepared == nullptr)
+    {
+        MIOPEN_THROW(miopenStatusBadParm, "weight data cannot be null");
+    }
+    if(preparedDesc.GetType() != dataType)
+    {
+        MIOPEN_THROW(miopenStatusBadParm, "Prepared weights must have the data type of the RNN");
+    }
+    const auto wei_sz = GetParamsSize(handle, xDesc, dataType) / typeSize;
+    if(wDesc.GetElementSize() != wei_sz || preparedDesc.GetElementSize() != wei_sz)
+    {
+        MIOPEN_THROW(miopenStatusBadParm,
+                     "Weights must hold " + std::to_string(wei_sz) + " elements");
+    }
+
+    auto inputVectorLen = xDesc.GetLengths()[1];
+    if(inputMode == miopenRNNskip)
+    {
+        inputVectorLen = 0;
+    }
+    const int bi         = dirMode != 0u ? 2 : 1;
+    const int hy_h       = static_cast<int>(hsize);
+    const int gateLen    = static_cast<int>(nHiddenTensorsPerLayer) * hy_h;
+    const int wei_stride = gateLen * bi;
+    const float alpha    = 1;
+
+    // Stores the row-major [rows x cols] block at offset transposed at the same offset.
+    auto transpose = [&](int offset, int rows, int cols) {
+        if(rows == 0 || cols == 0)
+            return;
+        std::vector<int> lens       = {cols, rows};
+        std::vector<int> srcStrides = {1, cols};
+        std::vector<int> dstStrides = {rows, 1};
+        const auto srcDesc =
+            miopen::TensorDescriptor(wDesc.GetType(), lens.data(), srcStrides.data(), 2);
+        const auto dstDesc = miopen::TensorDescriptor(dataType, lens.data(), dstStrides.data(), 2);
+        miopen::CastTensor(handle, &alpha, srcDesc, w, dstDesc, prepared, offset, offset);
+    };
+
+    int offset = 0;
+    for(int li = 0; li < static_cast<int>(nLayers); li++)
+    {
+        const int inputs = li == 0 ? static_cast<int>(inputVectorLen) : bi * hy_h;
+        transpose(offset, wei_stride, inputs);
+        offset += inputs * wei_stride;
+        for(int ri = 0; ri < bi; ri++)
+        {
+            transpose(offset, gateLen, hy_h);
+            offset += gateLen * hy_h;
+        }
+    }
+
+    // The biases keep their layout
+    const int biases = static_cast<int>(wei_sz) - offset;
+    if(biases > 0)
+    {
+        const auto biasDesc         = miopen::TensorDescriptor(wDesc.GetType(), &biases, 1);
+        const auto preparedBiasDesc = miopen::TensorDescriptor(dataType, &biases, 1);
+        miopen::CastTensor(handle, &alpha, biasDesc, w, preparedBiasDesc, prepared, offset, offset);
+    }
+}
+
 void RNNDescriptor::GetLayerParamOffset(const int layer,
                                         const TensorDescriptor& xDesc,
                                         const int paramID,
@@ -819,6 +931,11 @@ void RNNDescriptor::GetLayerParamOffset(const int layer,
     {
         return;
     }
+    if(weightLayout != miopenRNNWeightsCanonical)
+    {
+        MIOPEN_THROW(miopenStatusNotImplemented,
+                     "Parameter matrices are not contiguous in the prepared weight layout");
+    }
 
     // Calculate the location of the matrix via paramID, bidirection setting, and params
     *paramOffset = paramsOffsetCalculation(xDesc, layer, paramID);
@@ -880,6 +997,8 @@ std::ostream& operator<<(std::ostream& stream, const RNNDescriptor& r)
     stream << r.inputMode << ", ";
     stream << r.biasMode << ", ";
     stream << r.dropoutDesc << ", ";
+    stream << r.wavefrontStreams << ", ";
+    stream << r.weightLayout << ", ";
     return stream;
 }
 
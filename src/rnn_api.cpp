@@ -25,6 +25,8 @@
  *******************************************************************************/
 
 #include <miopen/rnn.hpp>
+#include <miopen/rnn_packed.hpp>
+#include <miopen/rnn_plan.hpp>
 #include <miopen/handle.hpp>
 #include <miopen/logger.hpp>
 #include <vector>
@@ -192,6 +194,41 @@ extern "C" miopenStatus_t miopenSetRNNDescriptor_V2(miopenRNNDescriptor_t rnnDes
     });
 }
 
+extern "C" miopenStatus_t miopenSetRNNWavefrontStreams(miopenRNNDescriptor_t rnnDesc,
+                                                       size_t streams)
+{
+    MIOPEN_LOG_FUNCTION(rnnDesc, streams);
+    return miopen::try_([&] { miopen::deref(rnnDesc).wavefrontStreams = streams; });
+}
+
+extern "C" miopenStatus_t miopenGetRNNWavefrontStreams(miopenRNNDescriptor_t rnnDesc,
+                                                       size_t* streams)
+{
+    MIOPEN_LOG_FUNCTION(rnnDesc, streams);
+    return miopen::try_(
+        [&] { miopen::deref(streams) = miopen::deref(rnnDesc).wavefrontStreams; });
+}
+
+extern "C" miopenStatus_t miopenSetRNNWeightLayout(miopenRNNDescriptor_t rnnDesc,
+                                                   miopenRNNWeightLayout_t layout)
+{
+    MIOPEN_LOG_FUNCTION(rnnDesc, layout);
+    return miopen::try_([&] {
+        if(layout != miopenRNNWeightsCanonical && layout != miopenRNNWeightsPrepared)
+        {
+            MIOPEN_THROW(miopenStatusBadParm, "Unknown RNN weight layout");
+        }
+        miopen::deref(rnnDesc).weightLayout = layout;
+    });
+}
+
+extern "C" miopenStatus_t miopenGetRNNWeightLayout(miopenRNNDescriptor_t rnnDesc,
+                                                   miopenRNNWeightLayout_t* layout)
+{
+    MIOPEN_LOG_FUNCTION(rnnDesc, layout);
+    return miopen::try_([&] { miopen::deref(layout) = miopen::deref(rnnDesc).weightLayout; });
+}
+
 extern "C" miopenStatus_t miopenGetRNNWorkspaceSize(miopenHandle_t handle,
                                                     const miopenRNNDescriptor_t rnnDesc,
                                                     const int sequenceLen,
@@ -421,6 +458,25 @@ extern "C" miopenStatus_t miopenSetRNNLayerBias(miopenHandle_t handle,
     });
 }
 
+extern "C" miopenStatus_t miopenRNNPrepareWeights(miopenHandle_t handle,
+                                                  miopenRNNDescriptor_t rnnDesc,
+                                                  miopenTensorDescriptor_t xDesc,
+                                                  miopenTensorDescriptor_t wDesc,
+                                                  const void* w,
+                                                  miopenTensorDescriptor_t preparedDesc,
+                                                  void* prepared)
+{
+    MIOPEN_LOG_FUNCTION(handle, rnnDesc, xDesc, wDesc, w, preparedDesc, prepared);
+    return miopen::try_([&] {
+        miopen::deref(rnnDesc).PrepareWeights(miopen::deref(handle),
+                                              miopen::deref(xDesc),
+                                              miopen::deref(wDesc),
+                                              DataCast(w),
+                                              miopen::deref(preparedDesc),
+                                              DataCast(prepared));
+    });
+}
+
 static void LogCmdRNN(const miopenTensorDescriptor_t* xDesc,
                       const miopenRNNDescriptor_t rnnDesc,
                       const int seqLength,
@@ -788,3 +844,281 @@ extern "C" miopenStatus_t miopenRNNForwardInference(miopenHandle_t handle,
                                                    workSpaceNumBytes);
     });
 }
+
+extern "C" miopenStatus_t miopenCreateRNNPlan(miopenHandle_t handle,
+                                              miopenRNNPlan_t* plan,
+                                              const miopenRNNDescriptor_t rnnDesc,
+                                              const int sequenceLen,
+                                              const miopenTensorDescriptor_t* xDesc,
+                                              const miopenTensorDescriptor_t hxDesc,
+                                              const miopenTensorDescriptor_t wDesc,
+                                              const miopenTensorDescriptor_t* yDesc)
+{
+    MIOPEN_LOG_FUNCTION(handle, plan, rnnDesc, sequenceLen, xDesc, hxDesc, wDesc, yDesc);
+
+    // bfloat16 not supported for rnn operation
+    if(miopen::deref(hxDesc).GetType() == miopenBFloat16 ||
+       miopen::deref(wDesc).GetType() == miopenBFloat16)
+    {
+        return miopenStatusNotImplemented;
+    }
+
+    return miopen::try_([&] {
+        miopen::c_array_view<const miopenTensorDescriptor_t> xDescArray{xDesc, size_t(sequenceLen)};
+        miopen::c_array_view<const miopenTensorDescriptor_t> yDescArray{yDesc, size_t(sequenceLen)};
+        miopen::deref(plan) = new miopen::RNNPlan(miopen::deref(handle),
+                                                  miopen::deref(rnnDesc),
+                                                  sequenceLen,
+                                                  xDescArray,
+                                                  miopen::deref(hxDesc),
+                                                  miopen::deref(wDesc),
+                                                  yDescArray);
+    });
+}
+
+extern "C" miopenStatus_t miopenRNNPlanGetWorkSpaceSize(miopenRNNPlan_t plan, size_t* numBytes)
+{
+    MIOPEN_LOG_FUNCTION(plan, numBytes);
+    return miopen::try_([&] { miopen::deref(numBytes) = miopen::deref(plan).GetWorkspaceSize(); });
+}
+
+extern "C" miopenStatus_t miopenRNNPlanGetReserveSpaceSize(miopenRNNPlan_t plan, size_t* numBytes)
+{
+    MIOPEN_LOG_FUNCTION(plan, numBytes);
+    return miopen::try_([&] { miopen::deref(numBytes) = miopen::deref(plan).GetReserveSize(); });
+}
+
+extern "C" miopenStatus_t miopenRNNPlanForwardInference(miopenHandle_t handle,
+                                                        miopenRNNPlan_t plan,
+                                                        const void* x,
+                                                        const void* hx,
+                                                        const void* cx,
+                                                        const void* w,
+                                                        void* y,
+                                                        void* hy,
+                                                        void* cy,
+                                                        void* workSpace,
+                                                        size_t workSpaceNumBytes)
+{
+    MIOPEN_LOG_FUNCTION(handle, plan, x, hx, cx, w, y, hy, cy, workSpace, workSpaceNumBytes);
+    return miopen::try_([&] {
+        miopen::deref(plan).ForwardInference(miopen::deref(handle),
+                                             DataCast(x),
+                                             DataCast(hx),
+                                             DataCast(cx),
+                                             DataCast(w),
+                                             DataCast(y),
+                                             DataCast(hy),
+                                             DataCast(cy),
+                                             DataCast(workSpace),
+                                             workSpaceNumBytes);
+    });
+}
+
+extern "C" miopenStatus_t miopenRNNPlanForwardTraining(miopenHandle_t handle,
+                                                       miopenRNNPlan_t plan,
+                                                       const void* x,
+                                                       const void* hx,
+                                                       const void* cx,
+                                                       const void* w,
+                                                       void* y,
+                                                       void* hy,
+                                                       void* cy,
+                                                       void* workSpace,
+                                                       size_t workSpaceNumBytes,
+                                                       void* reserveSpace,
+                                                       size_t reserveSpaceNumBytes)
+{
+    MIOPEN_LOG_FUNCTION(handle,
+                        plan,
+                        x,
+                        hx,
+                        cx,
+                        w,
+                        y,
+                        hy,
+                        cy,
+                        workSpace,
+                        workSpaceNumBytes,
+                        reserveSpace,
+                        reserveSpaceNumBytes);
+    return miopen::try_([&] {
+        miopen::deref(plan).ForwardTraining(miopen::deref(handle),
+                                            DataCast(x),
+                                            DataCast(hx),
+                                            DataCast(cx),
+                                            DataCast(w),
+                                            DataCast(y),
+                                            DataCast(hy),
+                                            DataCast(cy),
+                                            DataCast(workSpace),
+                                            workSpaceNumBytes,
+                                            DataCast(reserveSpace),
+                                            reserveSpaceNumBytes);
+    });
+}
+
+extern "C" miopenStatus_t miopenRNNPlanBackwardData(miopenHandle_t handle,
+                                                    miopenRNNPlan_t plan,
+                                                    const void* y,
+                                                    const void* dy,
+                                                    const void* dhy,
+                                                    const void* dcy,
+                                                    const void* w,
+                                                    const void* hx,
+                                                    const void* cx,
+                                                    void* dx,
+                                                    void* dhx,
+                                                    void* dcx,
+                                                    void* workSpace,
+                                                    size_t workSpaceNumBytes,
+                                                    void* reserveSpace,
+                                                    size_t reserveSpaceNumBytes)
+{
+    MIOPEN_LOG_FUNCTION(handle,
+                        plan,
+                        y,
+                        dy,
+                        dhy,
+                        dcy,
+                        w,
+                        hx,
+                        cx,
+                        dx,
+                        dhx,
+                        dcx,
+                        workSpace,
+                        workSpaceNumBytes,
+                        reserveSpace,
+                        reserveSpaceNumBytes);
+    return miopen::try_([&] {
+        miopen::deref(plan).BackwardData(miopen::deref(handle),
+                                         DataCast(y),
+                                         DataCast(dy),
+                                         DataCast(dhy),
+                                         DataCast(dcy),
+                                         DataCast(w),
+                                         DataCast(hx),
+                                         DataCast(cx),
+                                         DataCast(dx),
+                                         DataCast(dhx),
+                                         DataCast(dcx),
+                                         DataCast(workSpace),
+                                         workSpaceNumBytes,
+                                         DataCast(reserveSpace),
+                                         reserveSpaceNumBytes);
+    });
+}
+
+extern "C" miopenStatus_t miopenRNNPlanBackwardWeights(miopenHandle_t handle,
+                                                       miopenRNNPlan_t plan,
+                                                       const void* x,
+                                                       const void* hx,
+                                                       const void* y,
+                                                       void* dw,
+                                                       void* workSpace,
+                                                       size_t workSpaceNumBytes,
+                                                       const void* reserveSpace,
+                                                       size_t reserveSpaceNumBytes)
+{
+    MIOPEN_LOG_FUNCTION(handle,
+                        plan,
+                        x,
+                        hx,
+                        y,
+                        dw,
+                        workSpace,
+                        workSpaceNumBytes,
+                        reserveSpace,
+                        reserveSpaceNumBytes);
+    return miopen::try_([&] {
+        miopen::deref(plan).BackwardWeights(miopen::deref(handle),
+                                            DataCast(x),
+                                            DataCast(hx),
+                                            DataCast(y),
+                                            DataCast(dw),
+                                            DataCast(workSpace),
+                                            workSpaceNumBytes,
+                                            DataCast(reserveSpace),
+                                            reserveSpaceNumBytes);
+    });
+}
+
+extern "C" miopenStatus_t miopenDestroyRNNPlan(miopenRNNPlan_t plan)
+{
+    MIOPEN_LOG_FUNCTION(plan);
+    return miopen::try_([&] { miopen_destroy_object(plan); });
+}
+
+extern "C" miopenStatus_t miopenCreateRNNPackedPlan(miopenHandle_t handle,
+                                                    miopenRNNPackedPlan_t* plan,
+                                                    const miopenRNNDescriptor_t rnnDesc,
+                                                    const int batchSize,
+                                                    const int* lengths,
+                                                    const miopenTensorDescriptor_t xDesc,
+                                                    const miopenTensorDescriptor_t hxDesc,
+                                                    const miopenTensorDescriptor_t wDesc,
+                                                    const miopenTensorDescriptor_t yDesc)
+{
+    MIOPEN_LOG_FUNCTION(handle, plan, rnnDesc, batchSize, lengths, xDesc, hxDesc, wDesc, yDesc);
+
+    // bfloat16 not supported for rnn operation
+    if(miopen::deref(hxDesc).GetType() == miopenBFloat16 ||
+       miopen::deref(wDesc).GetType() == miopenBFloat16)
+    {
+        return miopenStatusNotImplemented;
+    }
+
+    return miopen::try_([&] {
+        if(batchSize <= 0 || lengths == nullptr)
+            MIOPEN_THROW(miopenStatusBadParm, "At least one sequence length is required");
+        miopen::deref(plan) =
+            new miopen::RNNPackedPlan(miopen::deref(handle),
+                                      miopen::deref(rnnDesc),
+                                      std::vector<int>(lengths, lengths + batchSize),
+                                      miopen::deref(xDesc),
+                                      miopen::deref(hxDesc),
+                                      miopen::deref(wDesc),
+                                      miopen::deref(yDesc));
+    });
+}
+
+extern "C" miopenStatus_t miopenRNNPackedPlanGetWorkSpaceSize(miopenRNNPackedPlan_t plan,
+                                                              size_t* numBytes)
+{
+    MIOPEN_LOG_FUNCTION(plan, numBytes);
+    return miopen::try_([&] { miopen::deref(numBytes) = miopen::deref(plan).GetWorkspaceSize(); });
+}
+
+extern "C" miopenStatus_t miopenRNNPackedPlanForwardInference(miopenHandle_t handle,
+                                                              miopenRNNPackedPlan_t plan,
+                                                              const void* x,
+                                                              const void* hx,
+                                                              const void* cx,
+                                                              const void* w,
+                                                              void* y,
+                                                              void* hy,
+                                                              void* cy,
+                                                              void* workSpace,
+                                                              size_t workSpaceNumBytes)
+{
+    MIOPEN_LOG_FUNCTION(handle, plan, x, hx, cx, w, y, hy, cy, workSpace, workSpaceNumBytes);
+    return miopen::try_([&] {
+        miopen::deref(plan).ForwardInference(miopen::deref(handle),
+                                             DataCast(x),
+                                             DataCast(hx),
+                                             DataCast(cx),
+                                             DataCast(w),
+                                             DataCast(y),
+                                             DataCast(hy),
+                                             DataCast(cy),
+                                             DataCast(workSpace),
+                                             workSpaceNumBytes);
+    });
+}
+
+extern "C" miopenStatus_t miopenDestroyRNNPackedPlan(miopenRNNPackedPlan_t plan)
+{
+    MIOPEN_LOG_FUNCTION(plan);
+    return miopen::try_([&] { miopen_destroy_object(plan); });
+}
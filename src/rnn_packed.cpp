@@ -0,0 +1,303 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/rnn_packed.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/rnn_util.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <ostream>
+#include <string>
+
+namespace miopen {
+
+namespace {
+
+// Sub-buffers must start at an address aligned for every device.
+constexpr std::size_t staging_align = 4096;
+
+std::size_t AlignUp(std::size_t size)
+{
+    return (size + staging_align - 1) / staging_align * staging_align;
+}
+
+// One descriptor per time step, with the batch of the step and the vector length of desc.
+std::vector<TensorDescriptor> GetStepDescriptors(const RNNSequencePacking& packing,
+                                                 const TensorDescriptor& desc)
+{
+    const auto& lens = desc.GetLengths();
+    if(lens.size() != 2 || !desc.IsPacked())
+        MIOPEN_THROW(miopenStatusBadParm, "Packed sequences must be a packed 2-D tensor");
+    if(lens[0] != packing.GetTotalLength())
+    {
+        MIOPEN_THROW(miopenStatusBadParm,
+                     "The packed sequences have " + std::to_string(lens[0]) +
+                         " rows, the lengths add up to " +
+                         std::to_string(packing.GetTotalLength()));
+    }
+
+    auto descs = std::vector<TensorDescriptor>{};
+    for(const auto batch : packing.GetBatchSizes())
+        descs.emplace_back(desc.GetType(), std::vector<int>{batch, static_cast<int>(lens[1])});
+    return descs;
+}
+
+std::vector<miopenTensorDescriptor_t> GetHandles(std::vector<TensorDescriptor>& descs)
+{
+    auto handles = std::vector<miopenTensorDescriptor_t>{};
+    handles.reserve(descs.size());
+    for(auto& desc : descs)
+        handles.push_back(&desc);
+    return handles;
+}
+
+const TensorDescriptor& CheckStateDescriptor(const TensorDescriptor& desc, int sequences)
+{
+    const auto& lens = desc.GetLengths();
+    if(lens.size() != 3 || !desc.IsPacked() || lens[1] != sequences)
+    {
+        MIOPEN_THROW(miopenStatusBadParm,
+                     "The hidden states must be a packed 3-D tensor with one row per sequence");
+    }
+    return desc;
+}
+
+} // namespace
+
+RNNSequencePacking::RNNSequencePacking(std::vector<int> lengths_) : lengths(std::move(lengths_))
+{
+    if(lengths.empty())
+        MIOPEN_THROW(miopenStatusBadParm, "At least one sequence is required");
+    if(std::any_of(lengths.begin(), lengths.end(), [](int length) { return length < 0; }))
+        MIOPEN_THROW(miopenStatusBadParm, "Sequence lengths cannot be negative");
+
+    const auto count      = lengths.size();
+    const auto max_length = *std::max_element(lengths.begin(), lengths.end());
+    if(max_length == 0)
+        MIOPEN_THROW(miopenStatusBadParm, "All the sequences are empty");
+
+    order.resize(count);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+        return lengths[a] > lengths[b];
+    });
+    rank.resize(count);
+    for(std::size_t r = 0; r < count; ++r)
+        rank[order[r]] = static_cast<int>(r);
+
+    offsets.resize(count);
+    std::partial_sum(lengths.begin(), lengths.end() - 1, offsets.begin() + 1);
+
+    batch_sizes.assign(max_length, 0);
+    for(const auto length : lengths)
+    {
+        for(int t = 0; t < length; ++t)
+            ++batch_sizes[t];
+    }
+    step_offsets.resize(max_length);
+    std::partial_sum(batch_sizes.begin(), batch_sizes.end() - 1, step_offsets.begin() + 1);
+
+    const auto total = std::accumulate(lengths.begin(), lengths.end(), 0);
+    sort_rows.resize(total);
+    unsort_rows.resize(total);
+    for(std::size_t r = 0; r < count; ++r)
+    {
+        const auto sequence = order[r];
+        for(int t = 0; t < lengths[sequence]; ++t)
+        {
+            const auto row                     = step_offsets[t] + static_cast<int>(r);
+            sort_rows[row]                     = offsets[sequence] + t;
+            unsort_rows[offsets[sequence] + t] = row;
+        }
+    }
+}
+
+std::vector<int> RNNSequencePacking::GetSortStateRows(int slices) const
+{
+    const auto count = GetSequenceCount();
+    auto rows        = std::vector<int>(static_cast<std::size_t>(slices) * count);
+    for(int s = 0; s < slices; ++s)
+    {
+        for(int r = 0; r < count; ++r)
+            rows[s * count + r] = s * count + order[r];
+    }
+    return rows;
+}
+
+std::vector<int> RNNSequencePacking::GetUnsortStateRows(int slices) const
+{
+    const auto count = GetSequenceCount();
+    auto rows        = std::vector<int>(static_cast<std::size_t>(slices) * count);
+    for(int s = 0; s < slices; ++s)
+    {
+        for(int b = 0; b < count; ++b)
+            rows[s * count + b] = s * count + rank[b];
+    }
+    return rows;
+}
+
+std::ostream& operator<<(std::ostream& stream, const RNNSequencePacking& packing)
+{
+    stream << "sequences: " << packing.GetSequenceCount()
+           << ", rows: " << packing.GetTotalLength() << ", batch sizes:";
+    for(const auto batch : packing.batch_sizes)
+        stream << " " << batch;
+    return stream;
+}
+
+RNNPackedPlan::RNNPackedPlan(Handle& handle,
+                             const RNNDescriptor& rnn,
+                             std::vector<int> lengths,
+                             const TensorDescriptor& xDesc,
+                             const TensorDescriptor& hxDesc,
+                             const TensorDescriptor& wDesc,
+                             const TensorDescriptor& yDesc)
+    : packing(std::move(lengths)),
+      x_descs(GetStepDescriptors(packing, xDesc)),
+      y_descs(GetStepDescriptors(packing, yDesc)),
+      x_desc_handles(GetHandles(x_descs)),
+      y_desc_handles(GetHandles(y_descs)),
+      plan(handle,
+           rnn,
+           packing.GetMaxLength(),
+           {x_desc_handles.data(), x_desc_handles.size()},
+           CheckStateDescriptor(hxDesc, packing.GetSequenceCount()),
+           wDesc,
+           {y_desc_handles.data(), y_desc_handles.size()}),
+      data_type(xDesc.GetType()),
+      input_size(static_cast<int>(xDesc.GetLengths()[1])),
+      output_size(static_cast<int>(yDesc.GetLengths()[1])),
+      state_rows(static_cast<int>(hxDesc.GetLengths()[0] * hxDesc.GetLengths()[1])),
+      hidden_size(static_cast<int>(hxDesc.GetLengths()[2]))
+{
+    const auto type_size    = GetTypeSize(data_type);
+    const auto total        = static_cast<std::size_t>(packing.GetTotalLength());
+    staging_sizes[SortedX]  = total * input_size * type_size;
+    staging_sizes[SortedY]  = total * output_size * type_size;
+    staging_sizes[SortedHx] = static_cast<std::size_t>(state_rows) * hidden_size * type_size;
+    staging_sizes[SortedCx] = staging_sizes[SortedHx];
+    staging_sizes[SortedHy] = staging_sizes[SortedHx];
+    staging_sizes[SortedCy] = staging_sizes[SortedHx];
+
+    workspace_size = AlignUp(plan.GetWorkspaceSize());
+    for(std::size_t i = 0; i < StagingCount; ++i)
+    {
+        staging_offsets[i] = workspace_size;
+        workspace_size += AlignUp(staging_sizes[i]);
+    }
+
+    const auto slices = static_cast<int>(hxDesc.GetLengths()[0]);
+    const auto tables = std::array<std::vector<int>, IndexCount>{
+        packing.GetSortRows(),
+        packing.GetUnsortRows(),
+        packing.GetSortStateRows(slices),
+        packing.GetUnsortStateRows(slices),
+    };
+    auto all = std::vector<int>{};
+    for(std::size_t i = 0; i < IndexCount; ++i)
+    {
+        index_offsets[i] = all.size();
+        all.insert(all.end(), tables[i].begin(), tables[i].end());
+    }
+    indices = handle.Write(all);
+    MIOPEN_LOG_I2(*this);
+}
+
+void RNNPackedPlan::Gather(const Handle& handle,
+                           ConstData_t src,
+                           Data_t dst,
+                           Index index,
+                           int rows,
+                           int row_size) const
+{
+    RNNGatherRows(handle, data_type, src, dst, indices.get(), index_offsets[index], rows, row_size);
+}
+
+void RNNPackedPlan::ForwardInference(Handle& handle,
+                                     ConstData_t x,
+                                     ConstData_t hx,
+                                     ConstData_t cx,
+                                     ConstData_t w,
+                                     Data_t y,
+                                     Data_t hy,
+                                     Data_t cy,
+                                     Data_t workSpace,
+                                     std::size_t workSpaceSize)
+{
+    if(x == nullptr || w == nullptr || y == nullptr)
+        MIOPEN_THROW(miopenStatusBadParm);
+    if(workSpace == nullptr || workSpaceSize < workspace_size)
+        MIOPEN_THROW("Workspace is required");
+
+    const auto staging = [&](Staging buffer) {
+        return handle.CreateSubBuffer(workSpace, staging_offsets[buffer], staging_sizes[buffer]);
+    };
+    // Null stays null: the optional states are simply not gathered
+    const auto optional = [&](const void* user, Staging buffer) {
+        return user == nullptr ? shared<Data_t>{} : staging(buffer);
+    };
+
+    const auto rows      = packing.GetTotalLength();
+    const auto sorted_x  = staging(SortedX);
+    const auto sorted_y  = staging(SortedY);
+    const auto sorted_hx = optional(hx, SortedHx);
+    const auto sorted_cx = optional(cx, SortedCx);
+    const auto sorted_hy = optional(hy, SortedHy);
+    const auto sorted_cy = optional(cy, SortedCy);
+
+    Gather(handle, x, sorted_x.get(), SortRows, rows, input_size);
+    if(hx != nullptr)
+        Gather(handle, hx, sorted_hx.get(), SortStateRows, state_rows, hidden_size);
+    if(cx != nullptr)
+        Gather(handle, cx, sorted_cx.get(), SortStateRows, state_rows, hidden_size);
+
+    plan.ForwardInference(handle,
+                          sorted_x.get(),
+                          sorted_hx.get(),
+                          sorted_cx.get(),
+                          w,
+                          sorted_y.get(),
+                          sorted_hy.get(),
+                          sorted_cy.get(),
+                          workSpace,
+                          plan.GetWorkspaceSize());
+
+    Gather(handle, sorted_y.get(), y, UnsortRows, rows, output_size);
+    if(hy != nullptr)
+        Gather(handle, sorted_hy.get(), hy, UnsortStateRows, state_rows, hidden_size);
+    if(cy != nullptr)
+        Gather(handle, sorted_cy.get(), cy, UnsortStateRows, state_rows, hidden_size);
+}
+
+std::ostream& operator<<(std::ostream& stream, const RNNPackedPlan& plan)
+{
+    return stream << "RNN packed plan, " << plan.packing
+                  << ", workspace: " << plan.workspace_size << ", " << plan.plan;
+}
+
+} // namespace miopen
@@ -0,0 +1,439 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/rnn_plan.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/logger.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <ostream>
+
+namespace miopen {
+
+namespace {
+
+std::size_t ByteSize(const TensorDescriptor& desc)
+{
+    return desc.GetElementSpace() * GetTypeSize(desc.GetType());
+}
+
+std::size_t ByteSize(const std::vector<TensorDescriptor>& descs)
+{
+    return std::accumulate(
+        descs.begin(), descs.end(), std::size_t{0}, [](std::size_t sum, const auto& desc) {
+            return sum + ByteSize(desc);
+        });
+}
+
+// The buffers of a pass are kept in one array, including the ones the pass only reads.
+Data_t Mutable(ConstData_t p)
+{
+    return const_cast<Data_t>(p); // NOLINT (cppcoreguidelines-pro-type-const-cast)
+}
+
+std::vector<miopenTensorDescriptor_t> GetHandles(std::vector<TensorDescriptor>& descs)
+{
+    auto handles = std::vector<miopenTensorDescriptor_t>{};
+    handles.reserve(descs.size());
+    for(auto& desc : descs)
+        handles.push_back(&desc);
+    return handles;
+}
+
+} // namespace
+
+RNNPlan::RNNPlan(Handle& handle,
+                 const RNNDescriptor& rnn_,
+                 int seqLen,
+                 c_array_view<const miopenTensorDescriptor_t> xDesc,
+                 const TensorDescriptor& hxDesc,
+                 const TensorDescriptor& wDesc,
+                 c_array_view<const miopenTensorDescriptor_t> yDesc)
+    : rnn(rnn_), seq_len(seqLen), hx_desc(hxDesc), w_desc(wDesc)
+{
+    if(seqLen <= 0)
+        MIOPEN_THROW(miopenStatusBadParm, "The sequence length must be positive");
+    if(xDesc.data == nullptr || yDesc.data == nullptr)
+        MIOPEN_THROW(miopenStatusBadParm, "The tensor descriptor arrays cannot be NULL");
+
+    for(int i = 0; i < seqLen; ++i)
+    {
+        x_descs.push_back(xDesc[i]);
+        y_descs.push_back(yDesc[i]);
+    }
+    x_desc_handles = GetHandles(x_descs);
+    y_desc_handles = GetHandles(y_descs);
+
+    const auto x_view =
+        c_array_view<const miopenTensorDescriptor_t>{x_desc_handles.data(), x_descs.size()};
+    workspace_size = rnn.GetWorkspaceSize(handle, seq_len, x_view);
+    reserve_size   = rnn.GetReserveSize(handle, seq_len, x_view);
+
+    const auto hidden_size = ByteSize(hx_desc);
+    for(const auto b : {Hx, Cx, Hy, Cy, Dhx, Dcx, Dhy, Dcy})
+        buffer_sizes[b] = hidden_size;
+    buffer_sizes[X]            = ByteSize(x_descs);
+    buffer_sizes[Dx]           = buffer_sizes[X];
+    buffer_sizes[Y]            = ByteSize(y_descs);
+    buffer_sizes[Dy]           = buffer_sizes[Y];
+    buffer_sizes[W]            = ByteSize(w_desc);
+    buffer_sizes[Dw]           = buffer_sizes[W];
+    buffer_sizes[WorkSpace]    = workspace_size;
+    buffer_sizes[ReserveSpace] = reserve_size;
+}
+
+void RNNPlan::ForwardInference(Handle& handle,
+                               ConstData_t x,
+                               ConstData_t hx,
+                               ConstData_t cx,
+                               ConstData_t w,
+                               Data_t y,
+                               Data_t hy,
+                               Data_t cy,
+                               Data_t workSpace,
+                               std::size_t workSpaceSize)
+{
+    if(workSpaceSize < workspace_size)
+        MIOPEN_THROW("Workspace is required");
+
+    auto buffers       = Buffers{};
+    buffers[X]         = Mutable(x);
+    buffers[Hx]        = Mutable(hx);
+    buffers[Cx]        = Mutable(cx);
+    buffers[W]         = Mutable(w);
+    buffers[Y]         = y;
+    buffers[Hy]        = hy;
+    buffers[Cy]        = cy;
+    buffers[WorkSpace] = workSpace;
+    Execute(handle, Pass::ForwardInference, buffers);
+}
+
+void RNNPlan::ForwardTraining(Handle& handle,
+                              ConstData_t x,
+                              ConstData_t hx,
+                              ConstData_t cx,
+                              ConstData_t w,
+                              Data_t y,
+                              Data_t hy,
+                              Data_t cy,
+                              Data_t workSpace,
+                              std::size_t workSpaceSize,
+                              Data_t reserveSpace,
+                              std::size_t reserveSpaceSize)
+{
+    if(workSpaceSize < workspace_size)
+        MIOPEN_THROW("Workspace is required");
+    if(reserveSpaceSize < reserve_size)
+        MIOPEN_THROW("Reservespace is required");
+
+    auto buffers          = Buffers{};
+    buffers[X]            = Mutable(x);
+    buffers[Hx]           = Mutable(hx);
+    buffers[Cx]           = Mutable(cx);
+    buffers[W]            = Mutable(w);
+    buffers[Y]            = y;
+    buffers[Hy]           = hy;
+    buffers[Cy]           = cy;
+    buffers[WorkSpace]    = workSpace;
+    buffers[ReserveSpace] = reserveSpace;
+    Execute(handle, Pass::ForwardTraining, buffers);
+}
+
+void RNNPlan::BackwardData(Handle& handle,
+                           ConstData_t y,
+                           ConstData_t dy,
+                           ConstData_t dhy,
+                           ConstData_t dcy,
+                           ConstData_t w,
+                           ConstData_t hx,
+                           ConstData_t cx,
+                           Data_t dx,
+                           Data_t dhx,
+                           Data_t dcx,
+                           Data_t workSpace,
+                           std::size_t workSpaceSize,
+                           Data_t reserveSpace,
+                           std::size_t reserveSpaceSize)
+{
+    if(workSpaceSize < workspace_size)
+        MIOPEN_THROW("Workspace is required");
+    if(reserveSpaceSize < reserve_size)
+        MIOPEN_THROW("Reservespace is required");
+
+    auto buffers          = Buffers{};
+    buffers[Y]            = Mutable(y);
+    buffers[Dy]           = Mutable(dy);
+    buffers[Dhy]          = Mutable(dhy);
+    buffers[Dcy]          = Mutable(dcy);
+    buffers[W]            = Mutable(w);
+    buffers[Hx]           = Mutable(hx);
+    buffers[Cx]           = Mutable(cx);
+    buffers[Dx]           = dx;
+    buffers[Dhx]          = dhx;
+    buffers[Dcx]          = dcx;
+    buffers[WorkSpace]    = workSpace;
+    buffers[ReserveSpace] = reserveSpace;
+    Execute(handle, Pass::BackwardData, buffers);
+}
+
+void RNNPlan::BackwardWeights(Handle& handle,
+                              ConstData_t x,
+                              ConstData_t hx,
+                              ConstData_t y,
+                              Data_t dw,
+                              Data_t workSpace,
+                              std::size_t workSpaceSize,
+                              ConstData_t reserveSpace,
+                              std::size_t reserveSpaceSize)
+{
+    if(workSpaceSize < workspace_size)
+        MIOPEN_THROW("Workspace is required");
+    if(reserveSpaceSize < reserve_size)
+        MIOPEN_THROW("Reservespace is required");
+
+    auto buffers          = Buffers{};
+    buffers[X]            = Mutable(x);
+    buffers[Hx]           = Mutable(hx);
+    buffers[Y]            = Mutable(y);
+    buffers[Dw]           = dw;
+    buffers[WorkSpace]    = workSpace;
+    buffers[ReserveSpace] = Mutable(reserveSpace);
+    Execute(handle, Pass::BackwardWeights, buffers);
+}
+
+std::size_t RNNPlan::GetRecordedLaunchCount() const
+{
+    std::size_t count = 0;
+    for(const auto& recording : recordings)
+        count += recording.second.launches.GetLaunches().size();
+    return count;
+}
+
+void RNNPlan::Run(Handle& handle, Pass pass, const Buffers& b) const
+{
+    const auto x_view =
+        c_array_view<const miopenTensorDescriptor_t>{x_desc_handles.data(), x_descs.size()};
+    const auto y_view =
+        c_array_view<const miopenTensorDescriptor_t>{y_desc_handles.data(), y_descs.size()};
+
+    switch(pass)
+    {
+    case Pass::ForwardInference:
+        rnn.RNNForwardInference(handle,
+                                seq_len,
+                                x_view,
+                                b[X],
+                                hx_desc,
+                                b[Hx],
+                                hx_desc,
+                                b[Cx],
+                                w_desc,
+                                b[W],
+                                y_view,
+                                b[Y],
+                                hx_desc,
+                                b[Hy],
+                                hx_desc,
+                                b[Cy],
+                                b[WorkSpace],
+                                workspace_size);
+        break;
+    case Pass::ForwardTraining:
+        rnn.RNNForwardTraining(handle,
+                               seq_len,
+                               x_view,
+                               b[X],
+                               hx_desc,
+                               b[Hx],
+                               hx_desc,
+                               b[Cx],
+                               w_desc,
+                               b[W],
+                               y_view,
+                               b[Y],
+                               hx_desc,
+                               b[Hy],
+                               hx_desc,
+                               b[Cy],
+                               b[WorkSpace],
+                               workspace_size,
+                               b[ReserveSpace],
+                               reserve_size);
+        break;
+    case Pass::BackwardData:
+        rnn.RNNBackwardData(handle,
+                            seq_len,
+                            y_view,
+                            b[Y],
+                            y_view,
+                            b[Dy],
+                            hx_desc,
+                            b[Dhy],
+                            hx_desc,
+                            b[Dcy],
+                            w_desc,
+                            b[W],
+                            hx_desc,
+                            b[Hx],
+                            hx_desc,
+                            b[Cx],
+                            x_view,
+                            b[Dx],
+                            hx_desc,
+                            b[Dhx],
+                            hx_desc,
+                            b[Dcx],
+                            b[WorkSpace],
+                            workspace_size,
+                            b[ReserveSpace],
+                            reserve_size);
+        break;
+    case Pass::BackwardWeights:
+        rnn.RNNBackwardWeights(handle,
+                               seq_len,
+                               x_view,
+                               b[X],
+                               hx_desc,
+                               b[Hx],
+                               y_view,
+                               b[Y],
+                               w_desc,
+                               b[Dw],
+                               b[WorkSpace],
+                               workspace_size,
+                               b[ReserveSpace],
+                               reserve_size);
+        break;
+    }
+}
+
+bool RNNPlan::Overlap(const Buffers& buffers) const
+{
+    for(std::size_t i = 0; i < BufferCount; ++i)
+    {
+        for(std::size_t j = i + 1; j < BufferCount; ++j)
+        {
+            if(buffers[i] == nullptr || buffers[j] == nullptr)
+                continue;
+            const auto a = reinterpret_cast<std::uintptr_t>(buffers[i]);
+            const auto b = reinterpret_cast<std::uintptr_t>(buffers[j]);
+            if(a < b + std::max<std::size_t>(buffer_sizes[j], 1) &&
+               b < a + std::max<std::size_t>(buffer_sizes[i], 1))
+                return true;
+        }
+    }
+    return false;
+}
+
+// The pass is captured with the buffers of its first execution, so that no host code sees an
+// address that is not backed by device memory. Every recorded pointer into one of them is
+// traced back to its buffer; the others (e.g. the dropout states) are kept as they were.
+RNNPlan::Recording RNNPlan::Record(Handle& handle, Pass pass, const Buffers& buffers) const
+{
+    auto recording = Recording{};
+    handle.BeginCapture();
+    try
+    {
+        Run(handle, pass, buffers);
+    }
+    catch(...)
+    {
+        handle.EndCapture();
+        throw;
+    }
+    recording.launches = handle.EndCapture();
+
+    const auto& launches = recording.launches.GetLaunches();
+    for(std::size_t l = 0; l < launches.size(); ++l)
+    {
+        for(const auto offset : launches[l].pointer_offsets)
+        {
+            std::uintptr_t ptr;
+            std::memcpy(&ptr, launches[l].args.data() + offset, sizeof(ptr));
+            for(std::size_t i = 0; i < BufferCount; ++i)
+            {
+                const auto base = reinterpret_cast<std::uintptr_t>(buffers[i]);
+                if(buffers[i] == nullptr || ptr < base ||
+                   ptr - base >= std::max<std::size_t>(buffer_sizes[i], 1))
+                    continue;
+                recording.patches.push_back({l, offset, static_cast<Buffer>(i), ptr - base});
+                break;
+            }
+        }
+    }
+
+    MIOPEN_LOG_I2("Recorded " << launches.size() << " launches with "
+                              << recording.patches.size() << " buffer pointers");
+    return recording;
+}
+
+void RNNPlan::Execute(Handle& handle, Pass pass, const Buffers& buffers)
+{
+#if MIOPEN_BACKEND_HIP
+    auto mask = 0u;
+    for(std::size_t i = 0; i < BufferCount; ++i)
+    {
+        if(buffers[i] != nullptr)
+            mask |= 1u << i;
+    }
+
+    const auto key = std::make_pair(pass, mask);
+    auto found     = recordings.find(key);
+    if(found == recordings.end())
+    {
+        // A pointer into overlapping buffers cannot be traced back to one of them.
+        if(Overlap(buffers))
+        {
+            Run(handle, pass, buffers);
+            return;
+        }
+        found = recordings.emplace(key, Record(handle, pass, buffers)).first;
+    }
+
+    auto& recording = found->second;
+    auto& launches  = recording.launches.GetLaunches();
+    for(const auto& patch : recording.patches)
+    {
+        const auto ptr = reinterpret_cast<std::uintptr_t>(buffers[patch.buffer]) + patch.delta;
+        std::memcpy(launches[patch.launch].args.data() + patch.offset, &ptr, sizeof(ptr));
+    }
+    handle.Replay(recording.launches);
+#else
+    Run(handle, pass, buffers);
+#endif
+}
+
+std::ostream& operator<<(std::ostream& stream, const RNNPlan& plan)
+{
+    return stream << "RNN plan, sequence length: " << plan.seq_len
+                  << ", workspace: " << plan.workspace_size << ", reserve: " << plan.reserve_size
+                  << ", recorded passes: " << plan.recordings.size();
+}
+
+} // namespace miopen
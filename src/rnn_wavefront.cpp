@@ -0,0 +1,187 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/rnn_wavefront.hpp>
+
+#include <miopen/config.h>
+#include <miopen/errors.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/logger.hpp>
+
+#if MIOPEN_BACKEND_HIP
+#include <miopen/hipoc_kernel.hpp>
+#endif
+
+#include <algorithm>
+#include <ostream>
+
+namespace miopen {
+
+RNNWavefrontSchedule::RNNWavefrontSchedule(int layers, int seq_len, std::size_t streams)
+{
+    if(layers <= 0 || seq_len <= 0 || streams == 0)
+        MIOPEN_THROW(miopenStatusBadParm, "Invalid RNN wavefront schedule sizes");
+
+    stream_count          = std::min(streams, static_cast<std::size_t>(layers));
+    const auto stream_of  = [&](int layer) { return layer % stream_count; };
+    const auto task_count = static_cast<std::size_t>(layers) * seq_len;
+
+    std::vector<std::size_t> index(task_count);
+    const auto index_of = [&](int layer, int step) -> std::size_t& {
+        return index[static_cast<std::size_t>(layer) * seq_len + step];
+    };
+
+    tasks.reserve(task_count);
+    for(int layer = 0; layer < layers; ++layer)
+    {
+        for(int step = 0; step < seq_len; ++step)
+        {
+            index_of(layer, step) = tasks.size();
+            tasks.push_back({layer, step, stream_of(layer)});
+        }
+    }
+
+    // Number of waits not yet issued on each event since its last record.
+    std::vector<std::size_t> pending;
+    std::vector<std::size_t> event_of(task_count);
+
+    for(std::size_t s = 0; s < stream_count; ++s)
+        program.push_back({RNNWavefrontOp::Fork, s, 0, 0});
+
+    for(std::size_t i = 0; i < tasks.size(); ++i)
+    {
+        const auto& task = tasks[i];
+        if(task.step > 0)
+            edges.push_back({index_of(task.layer, task.step - 1), i});
+        if(task.layer > 0 && task.step == 0)
+        {
+            const auto from = index_of(task.layer - 1, seq_len - 1);
+            edges.push_back({from, i});
+            if(tasks[from].stream != task.stream)
+            {
+                program.push_back({RNNWavefrontOp::Wait, task.stream, from, event_of[from]});
+                --pending[event_of[from]];
+            }
+        }
+
+        program.push_back({RNNWavefrontOp::Run, task.stream, i, 0});
+
+        if(task.step + 1 == seq_len && task.layer + 1 < layers &&
+           stream_of(task.layer + 1) != task.stream)
+        {
+            const auto free  = std::find(pending.begin(), pending.end(), 0);
+            const auto event = static_cast<std::size_t>(free - pending.begin());
+            if(free == pending.end())
+                pending.push_back(0);
+            pending[event] = 1;
+            event_of[i]    = event;
+            program.push_back({RNNWavefrontOp::Record, task.stream, i, event});
+        }
+    }
+
+    for(std::size_t s = 0; s < stream_count; ++s)
+        program.push_back({RNNWavefrontOp::Join, s, 0, 0});
+
+    event_count = pending.size();
+}
+
+void RNNWavefrontSchedule::Execute(const Handle& handle,
+                                   const std::function<void(const RNNWavefrontTask&)>& run) const
+{
+#if MIOPEN_BACKEND_HIP && !MIOPEN_MODE_NOGPU
+    if(!handle.IsCapturing())
+    {
+        const auto make_event = [] {
+            hipEvent_t result = nullptr;
+            auto status       = hipEventCreateWithFlags(&result, hipEventDisableTiming);
+            if(status != hipSuccess)
+                MIOPEN_THROW_HIP_STATUS(status, "Failed to create event");
+            return HipEventPtr{result};
+        };
+
+        const auto origin = handle.GetStream();
+        std::vector<hipStream_t> streams(stream_count);
+        for(std::size_t s = 0; s < stream_count; ++s)
+            streams[s] = handle.GetAuxStream(s);
+
+        std::vector<HipEventPtr> events;
+        for(std::size_t e = 0; e < event_count; ++e)
+            events.push_back(make_event());
+        std::vector<HipEventPtr> joins;
+        for(std::size_t s = 0; s < stream_count; ++s)
+            joins.push_back(make_event());
+        const auto fork = make_event();
+        hipEventRecord(fork.get(), origin);
+
+        for(const auto& op : program)
+        {
+            const auto stream = streams[op.stream];
+            switch(op.kind)
+            {
+            case RNNWavefrontOp::Fork: hipStreamWaitEvent(stream, fork.get(), 0); break;
+            case RNNWavefrontOp::Wait: hipStreamWaitEvent(stream, events[op.event].get(), 0); break;
+            case RNNWavefrontOp::Run: {
+                const AutoSwitchStream on_stream{handle, stream};
+                run(tasks[op.task]);
+                break;
+            }
+            case RNNWavefrontOp::Record: hipEventRecord(events[op.event].get(), stream); break;
+            case RNNWavefrontOp::Join:
+                hipEventRecord(joins[op.stream].get(), stream);
+                hipStreamWaitEvent(origin, joins[op.stream].get(), 0);
+                break;
+            }
+        }
+        return;
+    }
+#else
+    (void)handle;
+#endif
+    for(const auto& task : tasks)
+        run(task);
+}
+
+std::ostream& operator<<(std::ostream& stream, const RNNWavefrontSchedule& schedule)
+{
+    stream << "RNNWavefrontSchedule(streams: " << schedule.stream_count
+           << ", events: " << schedule.event_count << ")";
+    for(const auto& op : schedule.program)
+    {
+        const auto& task = schedule.tasks[op.task];
+        stream << std::endl << "  stream " << op.stream << ": ";
+        switch(op.kind)
+        {
+        case RNNWavefrontOp::Fork: stream << "fork"; continue;
+        case RNNWavefrontOp::Join: stream << "join"; continue;
+        case RNNWavefrontOp::Wait: stream << "wait event " << op.event; break;
+        case RNNWavefrontOp::Run: stream << "run"; break;
+        case RNNWavefrontOp::Record: stream << "record event " << op.event; break;
+        }
+        stream << " (" << task.layer << ", " << task.step << ")";
+    }
+    return stream;
+}
+
+} // namespace miopen
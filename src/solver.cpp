@@ -29,6 +29,7 @@
 #include <miopen/activ/solvers.hpp>
 #include <miopen/batchnorm/solvers.hpp>
 #include <miopen/pooling/solvers.hpp>
+#include <miopen/reduce/solvers.hpp>
 #include <miopen/conv_algo_name.hpp>
 #include <miopen/db.hpp>
 #include <miopen/solver_id.hpp>
@@ -498,6 +499,8 @@ inline SolverRegistrar::SolverRegistrar(IdRegistryData& registry)
     Register(registry, ++id, Primitive::Pooling, SolverDbId(pooling::PoolingForward2d{}));
     Register(registry, ++id, Primitive::Pooling, SolverDbId(pooling::PoolingForwardNd{}));
 
+    Register(registry, ++id, Primitive::Reduce, SolverDbId(reduce::GenericReduction{}));
+
     // IMPORTANT: New solvers should be added to the end of the function!
 }
 
@@ -103,10 +103,8 @@ ConvBiasActivAsm1x1U::Search(const ConvolutionContext& context, const AnyInvokeP
     tensors.outDesc = context.conv_problem.GetOut();
     tensors.bias    = bias_buf.get();
 
-    PerformanceConfigConvBiasActivAsm1x1U pp;
-    pp.HeuristicInit(context);
-    return pp;
-    // return GenericSearch(*this, cba_context, fused_invoke_ctx);
+    const auto fused_invoke_ctx = conv::FusedDataInvokeParams(tensors, nullptr, 0, false);
+    return GenericSearch(*this, cba_context, fused_invoke_ctx);
 }
 
 ConvSolution ConvBiasActivAsm1x1U::GetSolution(const ConvolutionContext& params,
@@ -0,0 +1,736 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/reduce/solvers.hpp>
+
+#include <miopen/env.hpp>
+#include <miopen/generic_search.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/reduce/invoke_params.hpp>
+#include <miopen/reduce/kernel_configurator.hpp>
+#include <miopen/solver/ck_utility_common.hpp>
+#include <miopen/solver/implicitgemm_util.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <utility>
+
+// headers from composable kernel, to get consistent ID mapping
+#include <../composable_kernel/composable_kernel/include/utility/data_type_enum.hpp>
+#include <../composable_kernel/composable_kernel/include/utility/reduction_enums.hpp>
+
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_REDUCE_GENERIC_PERF_VALS)
+
+namespace miopen {
+
+namespace solver {
+
+namespace reduce {
+
+namespace {
+
+// The configuration ReduceTensor used for every problem before it became tunable. Tunables
+// that the selected reduction method(s) do not read are kept at these values.
+constexpr int DefaultBlockSize                    = 256;
+constexpr int DefaultThreadBufferLength           = 8;
+constexpr int DefaultAccessesPerThreadInBlock     = 2;
+constexpr int DefaultAccessesPerThreadInWarp      = 2;
+constexpr std::size_t DescriptorsWorkspaceSize    = 4096;
+
+ck::DataTypeEnum_t mapDataTypeId(miopenDataType_t t)
+{
+    using ck::DataTypeEnum_t;
+
+    switch(t)
+    {
+    case miopenHalf: return DataTypeEnum_t::Half;
+    case miopenFloat: return DataTypeEnum_t::Float;
+    case miopenBFloat16: return DataTypeEnum_t::BFloat16;
+    case miopenDouble: return DataTypeEnum_t::Double;
+    case miopenInt8: return DataTypeEnum_t::Int8;
+    case miopenInt8x4: return DataTypeEnum_t::Int8x4;
+    case miopenInt32: return DataTypeEnum_t::Int32;
+    default: MIOPEN_THROW("Only float, half, double data type is supported.");
+    };
+};
+
+ck::ReduceTensorOp_t mapReduceOpId(miopenReduceTensorOp_t t)
+{
+    using ck::ReduceTensorOp_t;
+
+    switch(t)
+    {
+    case MIOPEN_REDUCE_TENSOR_ADD: return ReduceTensorOp_t::ADD;
+    case MIOPEN_REDUCE_TENSOR_MUL: return ReduceTensorOp_t::MUL;
+    case MIOPEN_REDUCE_TENSOR_MIN: return ReduceTensorOp_t::MIN;
+    case MIOPEN_REDUCE_TENSOR_MAX: return ReduceTensorOp_t::MAX;
+    case MIOPEN_REDUCE_TENSOR_AMAX: return ReduceTensorOp_t::AMAX;
+    case MIOPEN_REDUCE_TENSOR_AVG: return ReduceTensorOp_t::AVG;
+    case MIOPEN_REDUCE_TENSOR_NORM1: return ReduceTensorOp_t::NORM1;
+    case MIOPEN_REDUCE_TENSOR_NORM2: return ReduceTensorOp_t::NORM2;
+
+    default: MIOPEN_THROW("Operation is not supported");
+    };
+};
+
+std::string get_definition_string_from_type_enums(miopenDataType_t TSrc,
+                                                  miopenDataType_t TComp,
+                                                  miopenDataType_t TDst)
+{
+    std::ostringstream outs;
+
+    outs << " -DCK_PARAM_SRC_DATATYPE=" << mapDataTypeId(TSrc);
+    outs << " -DCK_PARAM_DST_DATATYPE=" << mapDataTypeId(TDst);
+    outs << " -DCK_PARAM_REDUCE_COMPTYPE=" << mapDataTypeId(TComp);
+
+    return (outs.str());
+};
+
+std::string get_definition_string_from_tunable(const PerformanceConfigGenericReduction& config)
+{
+    std::ostringstream outs;
+
+    outs << " -DCK_PARAM_BLOCKSIZE=" << config.BlockSize;
+    outs << " -DCK_PARAM_THREAD_BUFFER_LENGTH=" << config.GredThreadBufferLength;
+    outs << " -DCK_PARAM_ACCESSES_PER_THREAD_INBLOCK=" << config.GredAccessesPerThreadInBlock;
+    outs << " -DCK_PARAM_ACCESSES_PER_THREAD_INWARP=" << config.GredAccessesPerThreadInWarp;
+
+    return (outs.str());
+};
+
+std::string get_definition_string_from_options(miopenNanPropagation_t nanPropaOpt,
+                                               miopenReduceTensorIndices_t reduceIndicesOpt)
+{
+    std::ostringstream outs;
+
+    outs << " -DCK_PARAM_NAN_PROPAGATE=" << ((nanPropaOpt == MIOPEN_PROPAGATE_NAN) ? 1 : 0);
+    outs << " -DCK_PARAM_REDUCE_INDICES="
+         << ((reduceIndicesOpt == MIOPEN_REDUCE_TENSOR_FLATTENED_INDICES) ? 1 : 0);
+
+    return (outs.str());
+};
+
+std::string getReductionMethodStr(ReductionMethod_t reduceImpl)
+{
+    switch(reduceImpl)
+    {
+    case Reduce_DirectThreadWise: return {"threadwise"};
+    case Reduce_DirectWarpWise: return {"warpwise"};
+    case Reduce_BlockWise: return {"blockwise"};
+    case Reduce_MultiBlock: return {"multiblock"};
+    default: MIOPEN_THROW("Invalid reduction method ID!"); break;
+    };
+};
+
+std::pair<bool, bool> get_padding_need(ReductionMethod_t reduceImpl,
+                                       size_t invariantLen,
+                                       size_t toReduceLen,
+                                       int GridSize,
+                                       int BlockSize,
+                                       int warpSize,
+                                       int BlkGroupSize,
+                                       const PerformanceConfigGenericReduction& config)
+{
+    bool src_need_padding = false;
+    bool dst_need_padding = false;
+    int copySliceLen;
+    int reduceSizePerBlock;
+
+    switch(reduceImpl)
+    {
+    case Reduce_DirectThreadWise:
+        copySliceLen     = config.GredThreadBufferLength;
+        src_need_padding = (invariantLen < GridSize * BlockSize || toReduceLen % copySliceLen > 0);
+        dst_need_padding = (invariantLen < GridSize * BlockSize);
+        break;
+    case Reduce_DirectWarpWise:
+        copySliceLen = warpSize * config.GredAccessesPerThreadInWarp;
+        src_need_padding =
+            (invariantLen < GridSize * BlockSize / warpSize || toReduceLen % copySliceLen > 0);
+        dst_need_padding = (invariantLen < GridSize * BlockSize / warpSize);
+        break;
+    case Reduce_BlockWise:
+        copySliceLen     = BlockSize * config.GredAccessesPerThreadInBlock;
+        src_need_padding = (toReduceLen % copySliceLen > 0);
+        break;
+    case Reduce_MultiBlock:
+        copySliceLen = BlockSize * config.GredAccessesPerThreadInBlock;
+        reduceSizePerBlock =
+            (((toReduceLen + BlkGroupSize - 1) / BlkGroupSize + copySliceLen - 1) / copySliceLen) *
+            copySliceLen;
+        src_need_padding = (toReduceLen < reduceSizePerBlock * BlkGroupSize);
+        break;
+    default: MIOPEN_THROW("Invalid reduction method ID!"); break;
+    };
+
+    return (std::make_pair(src_need_padding, dst_need_padding));
+};
+
+std::string get_kernel_file_name(const bool isFirstCall,
+                                 const ReductionMethod_t reduceImpl,
+                                 const bool allDimsReduced)
+{
+    std::ostringstream outs;
+
+    if(isFirstCall)
+        outs << "gridwise_generic_reduction_first_call_" << getReductionMethodStr(reduceImpl);
+    else
+        outs << "gridwise_generic_reduction_second_call_" << getReductionMethodStr(reduceImpl);
+
+    if(allDimsReduced)
+        outs << "_reduce_all_dims.cpp";
+    else
+        outs << "_reduce_partial_dims.cpp";
+
+    return (outs.str());
+};
+
+std::string get_padding_definition_string(const std::pair<bool, bool>& use_padding)
+{
+    return " -DCK_PARAM_SRC2D_PADDING=" + std::to_string(static_cast<int>(use_padding.first)) +
+           " -DCK_PARAM_DST1D_PADDING=" + std::to_string(static_cast<int>(use_padding.second));
+}
+
+} // namespace
+
+PerformanceConfigGenericReduction::PerformanceConfigGenericReduction(
+    int block_size,
+    int thread_buffer_length,
+    int accesses_per_thread_in_block,
+    int accesses_per_thread_in_warp)
+    : BlockSize(block_size),
+      GredThreadBufferLength(thread_buffer_length),
+      GredAccessesPerThreadInBlock(accesses_per_thread_in_block),
+      GredAccessesPerThreadInWarp(accesses_per_thread_in_warp)
+{
+}
+
+bool PerformanceConfigGenericReduction::operator==(
+    const PerformanceConfigGenericReduction& other) const
+{
+    // clang-format off
+    return BlockSize == other.BlockSize
+        && GredThreadBufferLength == other.GredThreadBufferLength
+        && GredAccessesPerThreadInBlock == other.GredAccessesPerThreadInBlock
+        && GredAccessesPerThreadInWarp == other.GredAccessesPerThreadInWarp;
+    // clang-format on
+}
+
+bool PerformanceConfigGenericReduction::IsValidValue() const
+{
+    // clang-format off
+    return IsTwoPower<64, 1024>(BlockSize)
+        && IsTwoPower<1, 16>(GredThreadBufferLength)
+        && IsTwoPower<1, 4>(GredAccessesPerThreadInBlock)
+        && IsTwoPower<1, 4>(GredAccessesPerThreadInWarp);
+    // clang-format on
+}
+
+bool PerformanceConfigGenericReduction::SetNextValue(const ReductionContext& /*ctx*/)
+{
+    // Increment with wrap-around:
+    do
+    {
+        if(!NextTwoPower<64, 1024>(BlockSize))
+            break;
+        if(!NextTwoPower<1, 16>(GredThreadBufferLength))
+            break;
+        if(!NextTwoPower<1, 4>(GredAccessesPerThreadInBlock))
+            break;
+        if(!NextTwoPower<1, 4>(GredAccessesPerThreadInWarp))
+            break;
+        return false;
+    } while(false);
+
+    return true;
+}
+
+bool PerformanceConfigGenericReduction::IsValid(const ReductionContext& ctx) const
+{
+    if(!IsValidValue())
+        return false;
+
+    const auto warpSize = static_cast<int>(ctx.GetStream().GetWavefrontWidth());
+
+    if(BlockSize % warpSize != 0)
+        return false;
+
+    const auto invariantLength = ctx.GetInvariantLength();
+    const auto toReduceLength  = ctx.GetToReduceLength();
+
+    const miopen::detail::ReductionKernelConfigurator configurator(BlockSize, warpSize);
+    const auto reduceImpl = configurator.getReductionMethod(invariantLength, toReduceLength);
+
+    bool use_thread_buffer  = reduceImpl == Reduce_DirectThreadWise;
+    bool use_warp_accesses  = reduceImpl == Reduce_DirectWarpWise;
+    bool use_block_accesses = reduceImpl == Reduce_BlockWise || reduceImpl == Reduce_MultiBlock;
+
+    if(reduceImpl == Reduce_MultiBlock)
+    {
+        const auto blkGroupSize =
+            configurator.getGridSize(invariantLength, toReduceLength) / invariantLength;
+
+        switch(configurator.GetReductionMethod_2(blkGroupSize))
+        {
+        case Reduce_DirectThreadWise: use_thread_buffer = true; break;
+        case Reduce_DirectWarpWise: use_warp_accesses = true; break;
+        default: break;
+        }
+    }
+
+    // Values the kernels do not read would only repeat the same measurement during the search.
+    // clang-format off
+    return (use_thread_buffer || GredThreadBufferLength == DefaultThreadBufferLength)
+        && (use_block_accesses || GredAccessesPerThreadInBlock == DefaultAccessesPerThreadInBlock)
+        && (use_warp_accesses || GredAccessesPerThreadInWarp == DefaultAccessesPerThreadInWarp);
+    // clang-format on
+}
+
+void PerformanceConfigGenericReduction::HeuristicInit(const ReductionContext& ctx)
+{
+    BlockSize                    = DefaultBlockSize;
+    GredThreadBufferLength       = DefaultThreadBufferLength;
+    GredAccessesPerThreadInBlock = DefaultAccessesPerThreadInBlock;
+    GredAccessesPerThreadInWarp  = DefaultAccessesPerThreadInWarp;
+
+    const auto warpSize        = ctx.GetStream().GetWavefrontWidth();
+    const auto invariantLength = ctx.GetInvariantLength();
+    const auto toReduceLength  = ctx.GetToReduceLength();
+
+    if(invariantLength > 1 && toReduceLength <= warpSize)
+    {
+        // Skinny reductions give each thread a whole row. A buffer no longer than the row keeps
+        // short rows from being mostly padding.
+        GredThreadBufferLength = toReduceLength <= 2 ? 2 : toReduceLength <= 4 ? 4 : 8;
+    }
+    else if(toReduceLength > std::size_t{32} * 4 * DefaultBlockSize)
+    {
+        // Very long rows are split between many blocks. Larger blocks with more loads in flight
+        // per thread need fewer iterations per block and, when everything is reduced, leave a
+        // shorter second pass.
+        BlockSize                    = 512;
+        GredAccessesPerThreadInBlock = 4;
+    }
+
+    if(!IsValid(ctx))
+    {
+        MIOPEN_LOG_I2("Heuristic config is not valid, falling back to the default one");
+        BlockSize                    = DefaultBlockSize;
+        GredThreadBufferLength       = DefaultThreadBufferLength;
+        GredAccessesPerThreadInBlock = DefaultAccessesPerThreadInBlock;
+        GredAccessesPerThreadInWarp  = DefaultAccessesPerThreadInWarp;
+    }
+
+    MIOPEN_LOG_I(ToString());
+}
+
+std::string PerformanceConfigGenericReduction::ToString() const
+{
+    std::ostringstream ss;
+    Serialize(ss);
+    return ss.str();
+}
+
+bool GenericReduction::IsApplicable(const ReductionContext& ctx) const
+{
+    const auto& inLengths  = ctx.GetADesc().GetLengths();
+    const auto& outLengths = ctx.GetCDesc().GetLengths();
+
+    if(inLengths.size() > 6 || inLengths.size() != outLengths.size())
+        return false;
+
+    for(std::size_t i = 0; i < inLengths.size(); i++)
+    {
+        if(outLengths[i] != 1 && outLengths[i] != inLengths[i])
+            return false;
+    }
+
+    if(ctx.NeedIndices() && ctx.GetReduceDesc().reduceTensorIndicesType_ != MIOPEN_32BIT_INDICES)
+        return false;
+
+    return ctx.GetNumToReduceDims() > 0;
+}
+
+std::size_t GenericReduction::GetWorkspaceSize(const ReductionContext& ctx) const
+{
+    const auto warpSize        = static_cast<int>(ctx.GetStream().GetWavefrontWidth());
+    const auto invariantLength = ctx.GetInvariantLength();
+    const auto toReduceLength  = ctx.GetToReduceLength();
+
+    std::size_t workspace_size = 0;
+
+    for(int blockSize = 64; blockSize <= 1024; blockSize *= 2)
+    {
+        if(blockSize % warpSize != 0)
+            continue;
+
+        const miopen::detail::ReductionKernelConfigurator configurator(blockSize, warpSize);
+        workspace_size = std::max(workspace_size,
+                                  configurator.getWorkspaceSize(invariantLength, toReduceLength));
+    }
+
+    const std::size_t aTypeSize = miopen::detail::GetDataTypeSize(ctx.GetADesc().GetType());
+
+    const std::size_t wsSizeInBytes =
+        !ctx.NeedIndices() ? workspace_size * aTypeSize
+                           : workspace_size * (aTypeSize + sizeof(int)) + 64 + sizeof(int);
+
+    // dynamic reduction use one additional page for storing tensor descriptors
+    return wsSizeInBytes + DescriptorsWorkspaceSize;
+}
+
+PerformanceConfigGenericReduction
+GenericReduction::GetPerformanceConfig(const ReductionContext& ctx) const
+{
+    PerformanceConfigGenericReduction config;
+    config.HeuristicInit(ctx);
+    return config;
+}
+
+bool GenericReduction::IsValidPerformanceConfig(
+    const ReductionContext& ctx, const PerformanceConfigGenericReduction& config) const
+{
+    return config.IsValidValue() && config.IsValid(ctx);
+}
+
+PerformanceConfigGenericReduction GenericReduction::Search(const ReductionContext& ctx,
+                                                           const AnyInvokeParams& invoke_ctx) const
+{
+    // The search runs the reduction many times. The results go to scratch buffers so that the
+    // user's output, which is blended with beta, is only written by the final call.
+    const auto& params = invoke_ctx.CastTo<miopen::reduce::InvokeParams>();
+    auto& handle       = ctx.GetStream();
+
+    const auto output_size = params.cDesc.GetElementSpace() * GetTypeSize(params.cDesc.GetType());
+    const auto output      = handle.Create(output_size);
+    const auto indices     = params.indices != nullptr
+                                 ? handle.Create(params.cDesc.GetElementSize() * sizeof(int))
+                                 : Allocator::ManageDataPtr{};
+
+    const auto search_params = [&]() {
+        auto tmp    = params;
+        tmp.C       = output.get();
+        tmp.indices = indices.get();
+        return tmp;
+    }();
+
+    return GenericSearch(*this, ctx, search_params);
+}
+
+ConvSolution GenericReduction::GetSolution(const ReductionContext& ctx,
+                                           const PerformanceConfigGenericReduction& config,
+                                           const bool disableConfigOverrideFromEnv) const
+{
+    const PerformanceConfigGenericReduction* pcfg = &config;
+    PerformanceConfigGenericReduction fromEnv;
+
+    if(!disableConfigOverrideFromEnv)
+    {
+        const auto p_asciz = miopen::GetStringEnv(MIOPEN_DEBUG_REDUCE_GENERIC_PERF_VALS{});
+        if(p_asciz != nullptr && std::strlen(p_asciz) > 0)
+        {
+            if(!fromEnv.Deserialize(p_asciz) || !fromEnv.IsValid(ctx))
+            {
+                MIOPEN_LOG_E("MIOPEN_DEBUG_REDUCE_GENERIC_PERF_VALS: "
+                             "Bad format or invalid for the problem config: "
+                             << p_asciz);
+            }
+            else
+            {
+                MIOPEN_LOG_I("Overridden from env: " << fromEnv.ToString());
+                pcfg = &fromEnv;
+            }
+        }
+    }
+
+    auto result = ConvSolution{miopenStatusSuccess};
+
+    const auto& handle         = ctx.GetStream();
+    const auto& reduceDesc     = ctx.GetReduceDesc();
+    const auto srcDataType     = ctx.GetADesc().GetType();
+    const auto dstDataType     = ctx.GetCDesc().GetType();
+    const auto compType        = reduceDesc.reduceTensorCompType_;
+    const auto warpSize        = static_cast<int>(handle.GetWavefrontWidth());
+    const auto invariantLength = ctx.GetInvariantLength();
+    const auto toReduceLength  = ctx.GetToReduceLength();
+    const auto inDims          = ctx.GetADesc().GetLengths().size();
+    const bool reduceAllDims   = ctx.IsAllDimsReduced();
+    const auto blockSize       = pcfg->BlockSize;
+
+    const miopen::detail::ReductionKernelConfigurator configurator(blockSize, warpSize);
+
+    const ReductionMethod_t reduceImpl =
+        configurator.getReductionMethod(invariantLength, toReduceLength);
+    const int gridSize = configurator.getGridSize(invariantLength, toReduceLength);
+    const int blkGroupSize =
+        (reduceImpl == Reduce_MultiBlock) ? static_cast<int>(gridSize / invariantLength) : 0;
+
+    const bool useTwoCalls = (reduceImpl == Reduce_MultiBlock);
+
+    long ws_buf2_bytes_offset = 0;
+
+    if(ctx.NeedIndices())
+    {
+        const auto aTypeSize      = miopen::detail::GetDataTypeSize(srcDataType);
+        const auto workspace_size = configurator.getWorkspaceSize(invariantLength, toReduceLength);
+
+        ws_buf2_bytes_offset = ((workspace_size * aTypeSize + 63) / 64) * 64;
+    };
+
+    std::string param = solver::ck_utility::get_ck_common_compiler_flag(handle);
+
+    param += get_definition_string_from_type_enums(srcDataType, compType, dstDataType) + " " +
+             get_definition_string_from_tunable(*pcfg);
+
+    if(!reduceAllDims)
+        param += " -DCK_PARAM_NUM_TOREDUCE_DIMS=" + std::to_string(ctx.GetNumToReduceDims());
+
+    param += " -DCK_PARAM_REDUCE_OP=" +
+             std::to_string(static_cast<int>(mapReduceOpId(reduceDesc.reduceTensorOp_)));
+
+    param += get_definition_string_from_options(reduceDesc.reduceTensorNanOpt_,
+                                                reduceDesc.reduceTensorIndices_);
+
+    param += " -DCK_PARAM_IN_DIMS=" + std::to_string(inDims);
+    param += " -DCK_PARAM_OUT_DIMS=";
+    param += reduceAllDims ? "1" : std::to_string(inDims - ctx.GetNumToReduceDims());
+
+    const std::vector<size_t> vld  = {static_cast<size_t>(blockSize), 1, 1};
+    const std::vector<size_t> vgd1 = {static_cast<size_t>(blockSize), 1, 1};
+
+    const auto add_kernels = [&](const std::string& kernel_file,
+                                 const std::string& kernel_name,
+                                 const std::string& comp_options,
+                                 std::size_t grid_size) {
+        auto prepare         = KernelInfo{};
+        prepare.kernel_file  = kernel_file;
+        prepare.kernel_name  = kernel_name + "_prepare";
+        prepare.comp_options = comp_options;
+        prepare.l_wk         = vld;
+        prepare.g_wk         = vgd1;
+        result.construction_params.push_back(prepare);
+
+        auto reduce   = prepare;
+        reduce.kernel_name = kernel_name;
+        reduce.g_wk        = {grid_size * blockSize, 1, 1};
+        result.construction_params.push_back(reduce);
+    };
+
+    const auto use_padding = get_padding_need(reduceImpl,
+                                              invariantLength,
+                                              toReduceLength,
+                                              gridSize,
+                                              blockSize,
+                                              warpSize,
+                                              blkGroupSize,
+                                              *pcfg);
+
+    add_kernels(get_kernel_file_name(true, reduceImpl, reduceAllDims),
+                "gridwise_generic_reduce_1",
+                param + get_padding_definition_string(use_padding),
+                gridSize);
+
+    int gridSize_2 = 0;
+
+    if(useTwoCalls)
+    {
+        const auto toReduceLength_2 = blkGroupSize;
+        gridSize_2 =
+            static_cast<int>(configurator.getGridSize_2(invariantLength, toReduceLength_2));
+        const auto reduceImpl2  = configurator.GetReductionMethod_2(toReduceLength_2);
+        const auto use_padding2 = get_padding_need(reduceImpl2,
+                                                   invariantLength,
+                                                   toReduceLength_2,
+                                                   gridSize_2,
+                                                   blockSize,
+                                                   warpSize,
+                                                   1,
+                                                   *pcfg);
+
+        add_kernels(get_kernel_file_name(false, reduceImpl2, reduceAllDims),
+                    "gridwise_generic_reduce_2",
+                    param + get_padding_definition_string(use_padding2),
+                    gridSize_2);
+    }
+
+    result.workspce_sz = GetWorkspaceSize(ctx);
+
+    result.invoker_factory = [=](const std::vector<Kernel>& kernels) {
+        return [=](const Handle& handle_, const AnyInvokeParams& raw_params) {
+            decltype(auto) params = raw_params.CastTo<miopen::reduce::InvokeParams>();
+
+            const auto& inDescLengths  = params.aDesc.GetLengths();
+            const auto& inDescStrides  = params.aDesc.GetStrides();
+            const auto& outDescLengths = params.cDesc.GetLengths();
+            const auto& outDescStrides = params.cDesc.GetStrides();
+
+            const int origReduceLen = params.aDesc.GetElementSize() / params.cDesc.GetElementSize();
+            const long ws_buf2_offset = params.workspace != nullptr ? ws_buf2_bytes_offset : 0;
+
+            int p_inLengths[6]  = {0};
+            int p_inStrides[6]  = {0};
+            int p_outLengths[6] = {0};
+            int p_outStrides[6] = {0};
+
+            int pos = 0;
+            for(int i = 0; i < outDescLengths.size(); i++)
+            {
+                // invariant dimensions
+                if(outDescLengths[i] > 1)
+                {
+                    p_outLengths[pos] = static_cast<int>(outDescLengths[i]);
+                    p_outStrides[pos] = static_cast<int>(outDescStrides[i]);
+                    p_inLengths[pos]  = static_cast<int>(inDescLengths[i]);
+                    p_inStrides[pos]  = static_cast<int>(inDescStrides[i]);
+                    pos++;
+                };
+            };
+
+            for(int i = 0; i < outDescLengths.size(); i++)
+            {
+                // toReduce dimensions
+                if(outDescLengths[i] == 1)
+                {
+                    p_inLengths[pos] = static_cast<int>(inDescLengths[i]);
+                    p_inStrides[pos] = static_cast<int>(inDescStrides[i]);
+                    pos++;
+                };
+            };
+
+            if(reduceAllDims)
+            {
+                p_outLengths[0] = 1;
+                p_outStrides[0] = 1;
+            };
+
+            float time_reduce = 0.0f;
+
+            const auto accum_time = [&]() {
+                if(handle_.IsProfilingEnabled())
+                    time_reduce += handle_.GetKernelTime();
+            };
+
+            if(!reduceAllDims)
+                handle_.Run(kernels[0])(gridSize,
+                                        blkGroupSize,
+                                        p_inLengths[0],
+                                        p_inLengths[1],
+                                        p_inLengths[2],
+                                        p_inLengths[3],
+                                        p_inLengths[4],
+                                        p_inLengths[5],
+                                        p_inStrides[0],
+                                        p_inStrides[1],
+                                        p_inStrides[2],
+                                        p_inStrides[3],
+                                        p_inStrides[4],
+                                        p_inStrides[5],
+                                        p_outStrides[0],
+                                        p_outStrides[1],
+                                        p_outStrides[2],
+                                        p_outStrides[3],
+                                        p_outStrides[4],
+                                        p_outStrides[5],
+                                        params.workspace);
+            else
+                handle_.Run(kernels[0])(gridSize,
+                                        blkGroupSize,
+                                        p_inLengths[0],
+                                        p_inLengths[1],
+                                        p_inLengths[2],
+                                        p_inLengths[3],
+                                        p_inLengths[4],
+                                        p_inLengths[5],
+                                        p_inStrides[0],
+                                        p_inStrides[1],
+                                        p_inStrides[2],
+                                        p_inStrides[3],
+                                        p_inStrides[4],
+                                        p_inStrides[5],
+                                        params.workspace);
+            accum_time();
+
+            handle_.Run(kernels[1])(origReduceLen,
+                                    blkGroupSize,
+                                    params.alpha,
+                                    params.A,
+                                    params.beta,
+                                    params.C,
+                                    params.workspace,
+                                    ws_buf2_offset,
+                                    params.indices);
+            accum_time();
+
+            if(useTwoCalls)
+            {
+                if(!reduceAllDims)
+                    handle_.Run(kernels[2])(gridSize_2,
+                                            blkGroupSize,
+                                            p_outLengths[0],
+                                            p_outLengths[1],
+                                            p_outLengths[2],
+                                            p_outLengths[3],
+                                            p_outLengths[4],
+                                            p_outLengths[5],
+                                            p_outStrides[0],
+                                            p_outStrides[1],
+                                            p_outStrides[2],
+                                            p_outStrides[3],
+                                            p_outStrides[4],
+                                            p_outStrides[5],
+                                            params.workspace);
+                else
+                    handle_.Run(kernels[2])(gridSize_2, blkGroupSize, params.workspace);
+                accum_time();
+
+                handle_.Run(kernels[3])(origReduceLen,
+                                        params.alpha,
+                                        params.A,
+                                        params.beta,
+                                        params.C,
+                                        params.workspace,
+                                        ws_buf2_offset,
+                                        params.indices);
+                accum_time();
+            };
+
+            if(handle_.IsProfilingEnabled())
+            {
+                handle_.ResetKernelTime();
+                handle_.AccumKernelTime(time_reduce);
+            };
+        };
+    };
+
+    return result;
+}
+
+} // namespace reduce
+
+} // namespace solver
+
+} // namespace miopen
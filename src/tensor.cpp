@@ -25,16 +25,18 @@
  *******************************************************************************/
 #include <algorithm>
 #include <cassert>
+#include <functional>
 #include <miopen/errors.hpp>
 #include <miopen/logger.hpp>
 #include <miopen/tensor.hpp>
 #include <miopen/tensor_layout.hpp>
 #include <numeric>
 #include <string>
+#include <tuple>
 
 namespace miopen {
 
-TensorDescriptor::TensorDescriptor() : packed(true) {}
+TensorDescriptor::TensorDescriptor() : packed(true) { this->UpdateCache(); }
 
 TensorDescriptor::TensorDescriptor(miopenDataType_t t, std::initializer_list<std::size_t> plens)
     : lens(plens), packed(true), type(t)
@@ -48,6 +50,7 @@ TensorDescriptor::TensorDescriptor(miopenDataType_t t,
     : lens(plens), strides(pstrides), type(t)
 {
     packed = (this->GetElementSize() == this->GetElementSpace());
+    this->UpdateCache();
 }
 
 TensorDescriptor::TensorDescriptor(miopenDataType_t t, const int* plens, int size)
@@ -68,29 +71,61 @@ TensorDescriptor::TensorDescriptor(miopenDataType_t t,
     if(!std::all_of(pstrides, pstrides + size, [](int x) { return x >= 0; }))
         MIOPEN_THROW("Invalid strides. Strides must be greater than 0.");
     packed = (this->GetElementSize() == this->GetElementSpace());
+    this->UpdateCache();
 }
 
 TensorDescriptor::TensorDescriptor(miopenDataType_t t,
                                    std::vector<std::size_t> lens_in,
                                    std::vector<std::size_t> strides_in)
-    : lens(std::move(lens_in)), strides(std::move(strides_in)), type(t)
+    : lens(lens_in), strides(strides_in), type(t)
 {
     packed = (this->GetElementSize() == this->GetElementSpace());
+    this->UpdateCache();
 }
 
 void TensorDescriptor::CalculateStrides()
 {
     strides.clear();
     strides.resize(lens.size(), 0);
-    if(strides.empty())
+    if(!strides.empty())
+    {
+        strides.back() = 1;
+        std::partial_sum(
+            lens.rbegin(), lens.rend() - 1, strides.rbegin() + 1, std::multiplies<std::size_t>());
+    }
+    this->UpdateCache();
+}
+
+void TensorDescriptor::UpdateCache()
+{
+    std::size_t h  = std::hash<int>{}(type);
+    const auto mix = [&](std::size_t v) { h ^= v + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2); };
+    mix(lens.size());
+    for(const auto l : lens)
+        mix(l);
+    for(const auto s : strides)
+        mix(s);
+    hash = h;
+
+    if(lens.size() > stride_order.size() || lens.size() != strides.size())
         return;
-    strides.back() = 1;
-    std::partial_sum(
-        lens.rbegin(), lens.rend() - 1, strides.rbegin() + 1, std::multiplies<std::size_t>());
+    // Same order as find_permutation(): descending by (stride, length), stable. Insertion sort
+    // does not allocate and is the fastest option for this few elements.
+    const auto rank    = lens.size();
+    const auto outside = [&](auto a, auto b) {
+        return std::make_tuple(strides[a], lens[a]) > std::make_tuple(strides[b], lens[b]);
+    };
+    for(std::size_t i = 0; i < rank; ++i)
+    {
+        auto j = i;
+        for(; j > 0 && outside(i, stride_order[j - 1]); --j)
+            stride_order[j] = stride_order[j - 1];
+        stride_order[j] = static_cast<std::uint8_t>(i);
+    }
 }
 
-const std::vector<std::size_t>& TensorDescriptor::GetLengths() const { return lens; }
-const std::vector<std::size_t>& TensorDescriptor::GetStrides() const { return strides; }
+const TensorDims& TensorDescriptor::GetLengths() const { return lens; }
+const TensorDims& TensorDescriptor::GetStrides() const { return strides; }
 int TensorDescriptor::GetSize() const
 {
     assert(lens.size() == strides.size());
@@ -112,22 +147,34 @@ std::size_t TensorDescriptor::GetIndex(std::initializer_list<int> l) const
 
 std::size_t TensorDescriptor::GetElementSpace() const
 {
-    std::vector<std::size_t> maxIndices(lens.size());
-    std::transform(lens.begin(),
-                   lens.end(),
-                   std::vector<std::size_t>(lens.size(), 1).begin(),
-                   maxIndices.begin(),
-                   std::minus<std::size_t>());
-    return std::inner_product(
-               maxIndices.begin(), maxIndices.end(), strides.begin(), std::size_t{0}) +
-           1;
+    std::size_t space = 1;
+    for(std::size_t i = 0; i < lens.size(); ++i)
+        space += (lens[i] - 1) * strides[i];
+    return space;
 }
 
 bool TensorDescriptor::IsPossibleLayout(const std::string& labels, const std::string& layout) const
 {
-    std::vector<size_t> derived_strides;
-    tensor_layout_to_strides(lens, labels, layout, derived_strides);
-    return derived_strides == strides;
+    // Same as comparing against the strides from tensor_layout_to_strides(), without building
+    // them: this is called for every candidate layout of every convolution problem.
+    if(labels.size() != strides.size())
+        return false;
+    for(std::size_t i = 0; i < labels.size(); ++i)
+    {
+        const auto pos = layout.find(labels[i]);
+        if(pos == std::string::npos)
+            MIOPEN_THROW(std::string("mismatched layout string, unexpect char: ")
+                             .append(1, labels[i]));
+        std::size_t stride = 1;
+        for(auto l = pos + 1; l < layout.size(); ++l)
+        {
+            const auto dim = labels.find(layout[l]);
+            stride *= dim == std::string::npos ? 0 : lens[dim];
+        }
+        if(stride != strides[i])
+            return false;
+    }
+    return true;
 }
 
 std::size_t TensorDescriptor::GetNumBytes() const
@@ -151,7 +198,8 @@ bool TensorDescriptor::IsPacked() const { return this->packed; }
 bool TensorDescriptor::operator==(const TensorDescriptor& rhs) const
 {
     assert(this->lens.size() == rhs.strides.size());
-    return this->type == rhs.type && this->lens == rhs.lens && this->strides == rhs.strides;
+    return this->hash == rhs.hash && this->type == rhs.type && this->lens == rhs.lens &&
+           this->strides == rhs.strides;
 }
 
 bool TensorDescriptor::operator!=(const TensorDescriptor& rhs) const { return !(*this == rhs); }
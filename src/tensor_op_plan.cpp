@@ -0,0 +1,176 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/tensor_op_plan.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/tensor.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <ostream>
+
+namespace miopen {
+
+std::string ToString(TensorOpKind kind)
+{
+    switch(kind)
+    {
+    case TensorOpKind::Contiguous: return "Contiguous";
+    case TensorOpKind::ScalarB: return "ScalarB";
+    case TensorOpKind::ChannelB: return "ChannelB";
+    case TensorOpKind::Generic: return "Generic";
+    }
+    return "<Unknown>";
+}
+
+std::size_t TensorOpPlan::GetElementSize() const
+{
+    return std::accumulate(lens.begin(), lens.end(), std::size_t{1}, std::multiplies<>());
+}
+
+static bool IsPacked(const std::vector<std::size_t>& lens, const std::vector<std::size_t>& strides)
+{
+    std::size_t stride = 1;
+    for(auto i = lens.size(); i-- > 0;)
+    {
+        if(strides[i] != stride)
+            return false;
+        stride *= lens[i];
+    }
+    return true;
+}
+
+TensorOpPlan TensorOpPlan::Make(const TensorDims& c_lens,
+                                const TensorDims& a_strides,
+                                const TensorDims& b_lens,
+                                const TensorDims& b_strides,
+                                const TensorDims& c_strides)
+{
+    const auto ndims = c_lens.size();
+    if(a_strides.size() != ndims || b_lens.size() != ndims || b_strides.size() != ndims ||
+       c_strides.size() != ndims)
+        MIOPEN_THROW(miopenStatusBadParm, "Number of dims in A, B and C Tensors do not match");
+
+    TensorOpPlan plan;
+
+    for(std::size_t i = 0; i < ndims; i++)
+    {
+        if(b_lens[i] != 1 && b_lens[i] != c_lens[i])
+            MIOPEN_THROW(miopenStatusBadParm,
+                         "BTensor dim != 1 && BTensor dim != CTensor dim: " + std::to_string(i));
+
+        if(c_lens[i] == 1)
+            continue;
+
+        const auto len      = c_lens[i];
+        const auto b_stride = b_lens[i] == 1 ? 0 : b_strides[i];
+
+        // the previous dimension steps over exactly one run of this one in every tensor
+        if(!plan.lens.empty() && plan.a_strides.back() == len * a_strides[i] &&
+           plan.b_strides.back() == len * b_stride && plan.c_strides.back() == len * c_strides[i])
+        {
+            plan.lens.back() *= len;
+            plan.a_strides.back() = a_strides[i];
+            plan.b_strides.back() = b_stride;
+            plan.c_strides.back() = c_strides[i];
+            continue;
+        }
+
+        plan.lens.push_back(len);
+        plan.a_strides.push_back(a_strides[i]);
+        plan.b_strides.push_back(b_stride);
+        plan.c_strides.push_back(c_strides[i]);
+    }
+
+    // every dimension has length 1
+    if(plan.lens.empty())
+    {
+        plan.lens      = {1};
+        plan.a_strides = {1};
+        plan.b_strides = {1};
+        plan.c_strides = {1};
+    }
+
+    const auto& bs = plan.b_strides;
+    const bool ac_packed =
+        IsPacked(plan.lens, plan.a_strides) && IsPacked(plan.lens, plan.c_strides);
+
+    if(ac_packed && plan.lens.size() == 1)
+    {
+        if(bs[0] == 1 || plan.lens[0] == 1)
+            plan.kind = TensorOpKind::Contiguous;
+        else if(bs[0] == 0)
+            plan.kind = TensorOpKind::ScalarB;
+    }
+    else if(ac_packed && plan.lens.size() == 2 && bs[0] == 0 && bs[1] == 1)
+    {
+        plan.kind  = TensorOpKind::ChannelB;
+        plan.outer = plan.lens[0];
+        plan.mid   = plan.lens[1];
+    }
+    else if(ac_packed && plan.lens.size() == 2 && bs[0] == 1 && bs[1] == 0)
+    {
+        plan.kind  = TensorOpKind::ChannelB;
+        plan.mid   = plan.lens[0];
+        plan.inner = plan.lens[1];
+    }
+    else if(ac_packed && plan.lens.size() == 3 && bs[0] == 0 && bs[1] == 1 && bs[2] == 0)
+    {
+        plan.kind  = TensorOpKind::ChannelB;
+        plan.outer = plan.lens[0];
+        plan.mid   = plan.lens[1];
+        plan.inner = plan.lens[2];
+    }
+
+    return plan;
+}
+
+TensorOpPlan TensorOpPlan::Make(const TensorDescriptor& aDesc,
+                                const TensorDescriptor& bDesc,
+                                const TensorDescriptor& cDesc)
+{
+    if(aDesc.GetLengths() != cDesc.GetLengths())
+        MIOPEN_THROW(miopenStatusBadParm, "A and C Tensors do not match");
+
+    return Make(cDesc.GetLengths(),
+                aDesc.GetStrides(),
+                bDesc.GetLengths(),
+                bDesc.GetStrides(),
+                cDesc.GetStrides());
+}
+
+std::ostream& operator<<(std::ostream& stream, const TensorOpPlan& plan)
+{
+    stream << ToString(plan.kind) << " lens ";
+    LogRange(stream, plan.lens, "x") << " a ";
+    LogRange(stream, plan.a_strides, ",") << " b ";
+    LogRange(stream, plan.b_strides, ",") << " c ";
+    LogRange(stream, plan.c_strides, ",");
+    return stream;
+}
+
+} // namespace miopen
@@ -106,7 +106,18 @@ struct verify_forward_conv_bias
         EXPECT(miopenError == miopenStatusSuccess);
         miopenError = miopenFusionPlanGetOp(fusionplan, 1, &biasOp);
         EXPECT(miopenError == miopenStatusSuccess);
+        // Execute with a zero bias first, then reset the bias on the same arguments: the second
+        // execution has to pick up the new pointer.
+        auto zero_dev = handle.Write(std::vector<T>(bias.data.size(), T(0)));
         miopenSetOpArgsConvForward(ptr_fusionargs.get(), convoOp, &alpha, &beta, wei_dev.get());
+        miopenSetOpArgsBiasForward(ptr_fusionargs.get(), biasOp, &alpha, &beta, zero_dev.get());
+        miopenExecuteFusionPlan(&handle,
+                                fusionplan,
+                                inputDesc,
+                                in_dev.get(),
+                                &rout.desc,
+                                out_dev.get(),
+                                ptr_fusionargs.get());
         miopenSetOpArgsBiasForward(ptr_fusionargs.get(), biasOp, &alpha, &beta, b_dev.get());
         miopenExecuteFusionPlan(&handle,
                                 fusionplan,
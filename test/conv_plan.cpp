@@ -0,0 +1,236 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "driver.hpp"
+#include "get_handle.hpp"
+#include "tensor_holder.hpp"
+#include "test.hpp"
+#include "verify.hpp"
+
+#include <miopen/convolution.hpp>
+#include <miopen/convolution_plan.hpp>
+#include <miopen/miopen.h>
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+// Every direction of a small convolution is run through the Immediate API and through a plan
+// made for the same solution, and both results have to agree.
+struct conv_plan_test
+{
+    using get_solution_fn = std::function<void(miopen::Handle&, miopenConvSolution_t*)>;
+    using immediate_fn    = std::function<void(
+        miopen::Handle&, Data_t, Data_t, Data_t, Data_t, std::size_t, miopen::solver::Id)>;
+
+    miopen::ConvolutionDescriptor conv{{1, 1}, {1, 1}, {1, 1}};
+    tensor<float> x = tensor<float>{2, 8, 14, 14}.generate(tensor_elem_gen_integer{17});
+    tensor<float> w = tensor<float>{16, 8, 3, 3}.generate(tensor_elem_gen_integer{17});
+    tensor<float> y = tensor<float>{conv.GetForwardOutputTensor(x.desc, w.desc)}.generate(
+        tensor_elem_gen_integer{17});
+
+    void check(miopen::conv::Direction direction,
+               const get_solution_fn& get_solution,
+               const immediate_fn& immediate) const
+    {
+        auto&& handle = get_handle();
+
+        miopenConvSolution_t solution;
+        get_solution(handle, &solution);
+        const auto id = miopen::solver::Id{solution.solution_id};
+
+        miopen::ConvolutionPlan plan{handle, conv, direction, x.desc, w.desc, y.desc, id};
+        const auto ws_size = std::max(solution.workspace_size, plan.GetWorkspaceSize());
+
+        auto x_dev  = handle.Write(x.data);
+        auto w_dev  = handle.Write(w.data);
+        auto y_dev  = handle.Write(y.data);
+        auto ws_dev = handle.Write(std::vector<char>(std::max<std::size_t>(ws_size, 1)));
+
+        const auto& out = direction == miopen::conv::Direction::Forward        ? y
+                          : direction == miopen::conv::Direction::BackwardData ? x
+                                                                               : w;
+        auto& out_dev = direction == miopen::conv::Direction::Forward        ? y_dev
+                        : direction == miopen::conv::Direction::BackwardData ? x_dev
+                                                                             : w_dev;
+        const auto reset = [&] {
+            handle.WriteTo(out.data.data(), out_dev, out.data.size() * sizeof(float));
+        };
+
+        immediate(handle, x_dev.get(), w_dev.get(), y_dev.get(), ws_dev.get(), ws_size, id);
+        const auto expected = handle.Read<float>(out_dev, out.data.size());
+
+        // The second run checks that the prepared parameters can be reused.
+        for(int run = 0; run < 2; ++run)
+        {
+            reset();
+            plan.Execute(handle, x_dev.get(), w_dev.get(), y_dev.get(), ws_dev.get(), ws_size);
+            const auto actual = handle.Read<float>(out_dev, out.data.size());
+            EXPECT(miopen::rms_range(expected, actual) < 1e-6);
+        }
+
+        EXPECT(throws([&] {
+            plan.Execute(handle, nullptr, w_dev.get(), y_dev.get(), ws_dev.get(), ws_size);
+        }));
+        // The kernels of the plan were built for the context of the first handle.
+        const miopen::Handle other{};
+        EXPECT(throws([&] {
+            plan.Execute(other, x_dev.get(), w_dev.get(), y_dev.get(), ws_dev.get(), ws_size);
+        }));
+        if(plan.GetWorkspaceSize() > 0)
+        {
+            EXPECT(throws([&] {
+                plan.Execute(handle,
+                             x_dev.get(),
+                             w_dev.get(),
+                             y_dev.get(),
+                             ws_dev.get(),
+                             plan.GetWorkspaceSize() - 1);
+            }));
+        }
+    }
+
+    // Launches through ExecuteConvolutionPlans have to give the same results as executing the
+    // plan once per launch. The buffers of the launches are parts of one allocation per tensor,
+    // so the first three launches (shared weights) and the last three (weights of their own)
+    // can each be merged, as a problem of two launches and a single one, where the backend and
+    // the solver allow it.
+    void check_many() const
+    {
+        auto&& handle               = get_handle();
+        constexpr std::size_t count = 6;
+        const auto x1               = tensor<float>{1, 8, 14, 14};
+        const auto y1               = tensor<float>{conv.GetForwardOutputTensor(x1.desc, w.desc)};
+        const auto xs    = tensor<float>{count, 8, 14, 14}.generate(tensor_elem_gen_integer{17});
+        const auto ws    = tensor<float>{64, 8, 3, 3}.generate(tensor_elem_gen_integer{17});
+        const auto zeros = std::vector<float>(count * y1.data.size());
+
+        miopenConvSolution_t solution;
+        std::size_t solution_count = 0;
+        bool fallback              = false;
+        conv.GetForwardSolutions(
+            handle, w.desc, x1.desc, y1.desc, 1, &solution_count, &solution, &fallback);
+        EXPECT(solution_count > 0);
+        miopen::ConvolutionPlan plan{handle,
+                                     conv,
+                                     miopen::conv::Direction::Forward,
+                                     x1.desc,
+                                     w.desc,
+                                     y1.desc,
+                                     miopen::solver::Id{solution.solution_id}};
+        const auto ws_size = std::max(solution.workspace_size, plan.GetWorkspaceSize());
+
+        auto x_dev   = handle.Write(xs.data);
+        auto w_dev   = handle.Write(ws.data);
+        auto y_dev   = handle.Write(zeros);
+        auto work    = handle.Write(std::vector<char>(std::max<std::size_t>(ws_size, 1)));
+        auto part_of = [&](auto& dev, const tensor<float>& t, std::size_t i) {
+            const auto bytes = t.data.size() * sizeof(float);
+            return handle.CreateSubBuffer(dev.get(), i * bytes, bytes);
+        };
+
+        std::vector<decltype(part_of(x_dev, x1, 0))> parts;
+        std::vector<miopen::ConvolutionPlanLaunch> launches;
+        for(std::size_t i = 0; i < count; ++i)
+        {
+            parts.push_back(part_of(x_dev, x1, i));
+            parts.push_back(part_of(w_dev, w, i < 3 ? 0 : i - 2));
+            parts.push_back(part_of(y_dev, y1, i));
+            const auto n = parts.size();
+            launches.push_back({&plan,
+                                parts[n - 3].get(),
+                                parts[n - 2].get(),
+                                parts[n - 1].get(),
+                                work.get(),
+                                ws_size});
+        }
+
+        for(const auto& launch : launches)
+            plan.Execute(handle, launch.x, launch.w, launch.y, launch.workSpace, ws_size);
+        const auto expected = handle.Read<float>(y_dev, zeros.size());
+
+        // Twice, for the merged plans made by the first call and for their reuse.
+        for(int run = 0; run < 2; ++run)
+        {
+            handle.WriteTo(zeros.data(), y_dev, zeros.size() * sizeof(float));
+            miopen::ExecuteConvolutionPlans(handle, launches);
+            const auto actual = handle.Read<float>(y_dev, zeros.size());
+            EXPECT(miopen::rms_range(expected, actual) < 1e-6);
+        }
+
+        launches.back().workSpace     = nullptr;
+        launches.back().workSpaceSize = 0;
+        if(plan.GetWorkspaceSize() > 0)
+            EXPECT(throws([&] { miopen::ExecuteConvolutionPlans(handle, launches); }));
+    }
+
+    void run() const
+    {
+        using miopen::conv::Direction;
+        std::size_t count = 0;
+        bool fallback     = false;
+
+        check(
+            Direction::Forward,
+            [&](auto& handle, auto solution) {
+                conv.GetForwardSolutions(
+                    handle, w.desc, x.desc, y.desc, 1, &count, solution, &fallback);
+                EXPECT(count > 0);
+            },
+            [&](auto& handle, auto px, auto pw, auto py, auto ws, auto ws_size, auto id) {
+                conv.ConvolutionForwardImmediate(
+                    handle, w.desc, pw, x.desc, px, y.desc, py, ws, ws_size, id);
+            });
+
+        check(
+            Direction::BackwardData,
+            [&](auto& handle, auto solution) {
+                conv.GetBackwardSolutions(
+                    handle, y.desc, w.desc, x.desc, 1, &count, solution, &fallback);
+                EXPECT(count > 0);
+            },
+            [&](auto& handle, auto px, auto pw, auto py, auto ws, auto ws_size, auto id) {
+                conv.ConvolutionBackwardImmediate(
+                    handle, y.desc, py, w.desc, pw, x.desc, px, ws, ws_size, id);
+            });
+
+        check(
+            Direction::BackwardWeights,
+            [&](auto& handle, auto solution) {
+                conv.GetWrwSolutions(
+                    handle, y.desc, x.desc, w.desc, 1, &count, solution, &fallback);
+                EXPECT(count > 0);
+            },
+            [&](auto& handle, auto px, auto pw, auto py, auto ws, auto ws_size, auto id) {
+                conv.ConvolutionWrwImmediate(
+                    handle, y.desc, py, x.desc, px, w.desc, pw, ws, ws_size, id);
+            });
+
+        check_many();
+    }
+};
+
+int main() { run_test<conv_plan_test>(); }
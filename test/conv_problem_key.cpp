@@ -0,0 +1,218 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include "test.hpp"
+
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/invoker_cache.hpp>
+
+#include <string>
+#include <vector>
+
+using miopen::TensorDescriptor;
+using miopen::conv::Direction;
+using miopen::conv::ProblemDescription;
+
+namespace {
+
+struct ConvCase
+{
+    miopenDataType_t type            = miopenFloat;
+    std::vector<std::size_t> in      = {8, 16, 32, 32};
+    std::vector<std::size_t> weights = {64, 16, 3, 3};
+    std::vector<int> pads            = {1, 1};
+    std::vector<int> strides         = {1, 1};
+    std::vector<int> dilations       = {1, 1};
+    int group_count                  = 1;
+    Direction direction              = Direction::Forward;
+    bool nhwc                        = false;
+    bool padded_in                   = false;
+    int bias                         = 0;
+
+    ProblemDescription Make() const
+    {
+        const auto spatial_dims = in.size() - 2;
+        const auto conv         = miopen::ConvolutionDescriptor{spatial_dims,
+                                                        miopenConvolution,
+                                                        miopenPaddingDefault,
+                                                        pads,
+                                                        strides,
+                                                        dilations,
+                                                        std::vector<int>(spatial_dims, 0),
+                                                        group_count};
+
+        const auto x = Tensor(in, padded_in);
+        const auto w = Tensor(weights, false);
+        const auto y = Tensor(conv.GetForwardOutputTensor(x, w).GetLengths(), false);
+        return direction == Direction::Forward ? ProblemDescription{x, w, y, conv, direction, bias}
+                                               : ProblemDescription{y, w, x, conv, direction, bias};
+    }
+
+    TensorDescriptor Tensor(const std::vector<std::size_t>& lens, bool padded) const
+    {
+        // Packed NCHW or NHWC strides, optionally with a gap between the images.
+        const auto rank = lens.size();
+        std::vector<std::size_t> order(rank);
+        order[0] = 0;
+        if(nhwc)
+        {
+            for(std::size_t i = 1; i + 1 < rank; ++i)
+                order[i] = i + 1;
+            order[rank - 1] = 1;
+        }
+        else
+        {
+            for(std::size_t i = 1; i < rank; ++i)
+                order[i] = i;
+        }
+
+        std::vector<std::size_t> strides(rank);
+        std::size_t stride = 1;
+        for(auto i = rank; i-- > 0;)
+        {
+            strides[order[i]] = stride;
+            stride *= lens[order[i]];
+        }
+        if(padded)
+            strides[0] += 7;
+        return {type, lens, strides};
+    }
+};
+
+std::vector<ProblemDescription> MakeProblems()
+{
+    std::vector<ConvCase> cases(1);
+    const auto vary = [&](auto f) {
+        auto c = cases.front();
+        f(c);
+        cases.push_back(c);
+    };
+
+    vary([](auto& c) { c.in[0] = 4; });
+    vary([](auto& c) { c.in[1] = c.weights[1] = 8; });
+    vary([](auto& c) { c.in[2] = 30; });
+    vary([](auto& c) { c.in[3] = 30; });
+    vary([](auto& c) { c.weights[0] = 32; });
+    vary([](auto& c) { c.weights[2] = 5; });
+    vary([](auto& c) { c.weights[3] = 1; });
+    vary([](auto& c) { c.pads = {0, 1}; });
+    vary([](auto& c) { c.strides = {2, 2}; });
+    vary([](auto& c) { c.dilations = {1, 2}; });
+    vary([](auto& c) {
+        c.group_count = 2;
+        c.weights[1]  = 8;
+    });
+    vary([](auto& c) { c.type = miopenHalf; });
+    vary([](auto& c) { c.direction = Direction::BackwardData; });
+    vary([](auto& c) { c.direction = Direction::BackwardWeights; });
+    vary([](auto& c) { c.nhwc = true; });
+    vary([](auto& c) {
+        c.in        = {2, 4, 8, 16, 16};
+        c.weights   = {8, 4, 3, 3, 3};
+        c.pads      = {1, 1, 1};
+        c.strides   = {1, 1, 1};
+        c.dilations = {1, 1, 1};
+    });
+    // Neither is a part of the network config, so the keys have to ignore them as well.
+    vary([](auto& c) { c.padded_in = true; });
+    vary([](auto& c) { c.bias = 1; });
+
+    std::vector<ProblemDescription> problems;
+    for(const auto& c : cases)
+        problems.push_back(c.Make());
+    return problems;
+}
+
+void check_conf_key_format()
+{
+    const auto problem = ConvCase{}.Make();
+    EXPECT_EQUAL(problem.BuildConfKey().ToString(),
+                 std::string{"16x32x32x3x3x64x32x32x8xNCHWxFP32x1x1x1x1x1x1x1xF"});
+    EXPECT(problem.IsLayoutDefault());
+
+    auto nhwc = ConvCase{};
+    nhwc.nhwc = true;
+    EXPECT(!nhwc.Make().IsLayoutDefault());
+    EXPECT_EQUAL(nhwc.Make().BuildConfKey().ToString(),
+                 std::string{"16x32x32x3x3x64x32x32x8xNHWCxNHWCxNHWCxFP32x1x1x1x1x1x1x1xF"});
+}
+
+void check_key_matches_conf_key()
+{
+    const auto problems = MakeProblems();
+    for(const auto& a : problems)
+    {
+        for(const auto& b : problems)
+        {
+            const auto same_text = a.BuildConfKey().ToString() == b.BuildConfKey().ToString();
+            EXPECT_EQUAL(a.GetKey() == b.GetKey(), same_text);
+            if(same_text)
+                EXPECT_EQUAL(a.GetKey().hash, b.GetKey().hash);
+        }
+    }
+
+    // Keys are built once and survive copies.
+    const auto copy = problems.front();
+    EXPECT(copy.GetKey() == problems.front().GetKey());
+    EXPECT(problems.front().GetKey().hash != 0);
+}
+
+void check_invoker_cache_binary_index()
+{
+    const auto problems = MakeProblems();
+    const auto key0     = problems[0].GetKey();
+    const auto key1     = problems[1].GetKey();
+    const auto config0  = problems[0].BuildConfKey().ToString();
+
+    const miopen::Invoker first  = [](const miopen::Handle&, const miopen::AnyInvokeParams&) {};
+    const miopen::Invoker second = [](const miopen::Handle&, const miopen::AnyInvokeParams&) {};
+
+    miopen::InvokerCache cache;
+    EXPECT(!cache[std::make_pair(key0, std::uint64_t{1})]);
+
+    // Registered by the network config only, as Find does.
+    cache.Register({config0, "Solver1"}, first);
+    EXPECT(!cache[std::make_pair(key0, std::uint64_t{1})]);
+
+    // Indexing it later refers to the invoker that is already stored.
+    cache.Register({key0, 1}, {config0, "Solver1"}, second);
+    const auto by_key  = cache[std::make_pair(key0, std::uint64_t{1})];
+    const auto by_text = cache[std::make_pair(config0, std::string{"Solver1"})];
+    EXPECT(by_key);
+    EXPECT(by_text);
+    EXPECT(&*by_key == &*by_text);
+
+    EXPECT(!cache[std::make_pair(key0, std::uint64_t{2})]);
+    EXPECT(!cache[std::make_pair(key1, std::uint64_t{1})]);
+}
+
+} // namespace
+
+int main()
+{
+    check_conf_key_format();
+    check_key_matches_conf_key();
+    check_invoker_cache_binary_index();
+}
@@ -0,0 +1,323 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_CPU_BATCHNORM_HPP
+#define GUARD_CPU_BATCHNORM_HPP
+
+#include <miopen/errors.hpp>
+#include <miopen/par_for.hpp>
+#include <miopen/tensor.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+
+// Host reference for batch normalization shared by the tests and MIOpenDriver.
+//
+// Every kernel works on one channel at a time and channels are processed in parallel.
+// Statistics are gathered in a single pass over the input: contiguous blocks are reduced to
+// (count, mean, M2) while they are still in cache and then merged with Chan's parallel
+// variant of Welford's algorithm, which is both stable and vectorizable. All accumulation is
+// done in double, so the input (Tgpu), reference (Tref) and scale/bias (Tmix) types may differ.
+//
+// Spatial mode normalizes over N and all spatial dims of a channel. Per-activation mode is the
+// same computation on a layout where every (C, D, H, W) position is its own channel, see
+// bn_cpu_layout::per_activation().
+
+struct bn_cpu_layout
+{
+    std::size_t n       = 0;
+    std::size_t c       = 0;
+    std::size_t spatial = 0; // D*H*W
+    std::size_t n_stride = 0;
+    std::size_t c_stride = 0;
+    std::size_t s_stride = 0;
+
+    std::size_t index(std::size_t in, std::size_t ic, std::size_t is) const
+    {
+        return in * n_stride + ic * c_stride + is * s_stride;
+    }
+
+    // Number of elements reduced per channel.
+    std::size_t count() const { return n * spatial; }
+
+    static bn_cpu_layout nchw(std::size_t n, std::size_t c, std::size_t spatial)
+    {
+        return {n, c, spatial, c * spatial, spatial, 1};
+    }
+
+    static bn_cpu_layout nhwc(std::size_t n, std::size_t c, std::size_t spatial)
+    {
+        return {n, c, spatial, c * spatial, 1, c};
+    }
+
+    // Handles any N, C, spatial... descriptor whose spatial dims are packed among themselves,
+    // which covers NCHW, NHWC, NCDHW and NDHWC.
+    static bn_cpu_layout from_desc(const miopen::TensorDescriptor& desc)
+    {
+        const auto& lens    = desc.GetLengths();
+        const auto& strides = desc.GetStrides();
+        if(lens.size() < 3)
+            MIOPEN_THROW(miopenStatusBadParm, "Batch norm reference needs at least 3 dims");
+
+        bn_cpu_layout result;
+        result.n        = lens[0];
+        result.c        = lens[1];
+        result.spatial  = 1;
+        result.n_stride = strides[0];
+        result.c_stride = strides[1];
+        result.s_stride = strides.back();
+        for(std::size_t i = 2; i < lens.size(); ++i)
+        {
+            result.spatial *= lens[i];
+            if(i + 1 < lens.size() && strides[i] != strides[i + 1] * lens[i + 1])
+                MIOPEN_THROW(miopenStatusBadParm, "Batch norm reference needs packed spatial dims");
+        }
+        return result;
+    }
+
+    // Every position within one batch item becomes a channel of its own. The channel index is
+    // the offset inside the batch item, so per-activation parameters are expected in the same
+    // order as the input (CxDxHxW for NCHW-like inputs, DxHxWxC for NHWC-like ones).
+    bn_cpu_layout per_activation() const
+    {
+        assert(n_stride == c * spatial);
+        return {n, c * spatial, 1, n_stride, 1, 1};
+    }
+};
+
+struct bn_cpu_moments
+{
+    double mean     = 0.0;
+    double variance = 0.0; // population (biased) variance
+};
+
+namespace bn_cpu_detail {
+
+constexpr std::size_t block_size = 256;
+
+// Calls f(n, s, len) for every run of up to block_size consecutive spatial positions of one
+// batch item, which is the unit reduced while it is still in cache.
+template <class F>
+void for_each_block(const bn_cpu_layout& l, F f)
+{
+    for(std::size_t in = 0; in < l.n; ++in)
+        for(std::size_t s = 0; s < l.spatial; s += block_size)
+            f(in, s, std::min(block_size, l.spatial - s));
+}
+
+} // namespace bn_cpu_detail
+
+template <class Tx>
+bn_cpu_moments bn_cpu_channel_moments(const bn_cpu_layout& l, const Tx* x, std::size_t c)
+{
+    double count = 0.0;
+    double mean  = 0.0;
+    double m2    = 0.0;
+
+    std::array<double, bn_cpu_detail::block_size> buf;
+    bn_cpu_detail::for_each_block(l, [&](std::size_t in, std::size_t s, std::size_t len) {
+        const auto base = l.index(in, c, s);
+        double sum      = 0.0;
+        for(std::size_t i = 0; i < len; ++i)
+        {
+            buf[i] = static_cast<double>(x[base + i * l.s_stride]);
+            sum += buf[i];
+        }
+        const double block_mean = sum / len;
+        double block_m2         = 0.0;
+        for(std::size_t i = 0; i < len; ++i)
+        {
+            const double d = buf[i] - block_mean;
+            block_m2 += d * d;
+        }
+
+        const double total = count + len;
+        const double delta = block_mean - mean;
+        mean += delta * len / total;
+        m2 += block_m2 + delta * delta * count * len / total;
+        count = total;
+    });
+
+    bn_cpu_moments result;
+    result.mean     = mean;
+    result.variance = count > 0.0 ? m2 / count : 0.0;
+    return result;
+}
+
+template <class Tx, class Ty>
+void bn_cpu_normalize_channel(const bn_cpu_layout& l,
+                              const Tx* x,
+                              Ty* y,
+                              std::size_t c,
+                              double mean,
+                              double inv_var,
+                              double scale,
+                              double bias)
+{
+    bn_cpu_detail::for_each_block(l, [&](std::size_t in, std::size_t s, std::size_t len) {
+        const auto base = l.index(in, c, s);
+        for(std::size_t i = 0; i < len; ++i)
+        {
+            const auto idx = base + i * l.s_stride;
+            y[idx] = static_cast<Ty>(scale * ((static_cast<double>(x[idx]) - mean) * inv_var) +
+                                     bias);
+        }
+    });
+}
+
+/// Forward training. save_mean/save_inv_var and run_mean/run_var may be null, in which case
+/// the corresponding outputs are skipped.
+template <class Tx, class Ty, class Tscale, class Tstat>
+void bn_cpu_fwd_train(const bn_cpu_layout& l,
+                      const Tx* x,
+                      Ty* y,
+                      const Tscale* scale,
+                      const Tscale* bias,
+                      double epsilon,
+                      double exp_avg_factor,
+                      Tstat* save_mean,
+                      Tstat* save_inv_var,
+                      Tstat* run_mean,
+                      Tstat* run_var)
+{
+    miopen::par_for(l.c, 1, [&](std::size_t c) {
+        const auto m         = bn_cpu_channel_moments(l, x, c);
+        const double inv_var = 1.0 / std::sqrt(m.variance + epsilon);
+
+        bn_cpu_normalize_channel(
+            l, x, y, c, m.mean, inv_var, static_cast<double>(scale[c]), static_cast<double>(bias[c]));
+
+        if(save_mean != nullptr && save_inv_var != nullptr)
+        {
+            save_mean[c]    = static_cast<Tstat>(m.mean);
+            save_inv_var[c] = static_cast<Tstat>(inv_var);
+        }
+        if(run_mean != nullptr && run_var != nullptr)
+        {
+            // var(n+1) = p * var(n-1) + (1 - p)*(b/b-1)*var(n)
+            const double count  = l.count();
+            const double adjust = count == 1 ? m.variance : count / (count - 1) * m.variance;
+            run_mean[c]         = static_cast<Tstat>(
+                m.mean * exp_avg_factor + static_cast<double>(run_mean[c]) * (1 - exp_avg_factor));
+            run_var[c] = static_cast<Tstat>((1 - exp_avg_factor) * static_cast<double>(run_var[c]) +
+                                            exp_avg_factor * adjust);
+        }
+    });
+}
+
+/// Forward inference. When est_mean/est_var are null the statistics are recomputed from x.
+template <class Tx, class Ty, class Tscale, class Tstat>
+void bn_cpu_fwd_infer(const bn_cpu_layout& l,
+                      const Tx* x,
+                      Ty* y,
+                      const Tscale* scale,
+                      const Tscale* bias,
+                      double epsilon,
+                      const Tstat* est_mean,
+                      const Tstat* est_var)
+{
+    miopen::par_for(l.c, 1, [&](std::size_t c) {
+        bn_cpu_moments m;
+        if(est_mean != nullptr && est_var != nullptr)
+        {
+            m.mean     = static_cast<double>(est_mean[c]);
+            m.variance = static_cast<double>(est_var[c]);
+        }
+        else
+        {
+            m = bn_cpu_channel_moments(l, x, c);
+        }
+        const double inv_var = 1.0 / std::sqrt(m.variance + epsilon);
+        bn_cpu_normalize_channel(
+            l, x, y, c, m.mean, inv_var, static_cast<double>(scale[c]), static_cast<double>(bias[c]));
+    });
+}
+
+/// Backward. When saved_mean/saved_inv_var are null the statistics are recomputed from x.
+/// dscale and dbias are overwritten, not accumulated.
+template <class Tx, class Tdy, class Tdx, class Tscale, class Tdscale, class Tstat>
+void bn_cpu_bwd(const bn_cpu_layout& l,
+                const Tx* x,
+                const Tdy* dy,
+                Tdx* dx,
+                const Tscale* scale,
+                Tdscale* dscale,
+                Tdscale* dbias,
+                double epsilon,
+                const Tstat* saved_mean,
+                const Tstat* saved_inv_var)
+{
+    miopen::par_for(l.c, 1, [&](std::size_t c) {
+        double mean    = 0.0;
+        double inv_var = 0.0;
+        if(saved_mean != nullptr && saved_inv_var != nullptr)
+        {
+            mean    = static_cast<double>(saved_mean[c]);
+            inv_var = static_cast<double>(saved_inv_var[c]);
+        }
+        else
+        {
+            const auto m = bn_cpu_channel_moments(l, x, c);
+            mean         = m.mean;
+            inv_var      = 1.0 / std::sqrt(m.variance + epsilon);
+        }
+
+        double dbias_accum  = 0.0;
+        double dscale_accum = 0.0;
+        bn_cpu_detail::for_each_block(l, [&](std::size_t in, std::size_t s, std::size_t len) {
+            const auto base = l.index(in, c, s);
+            for(std::size_t i = 0; i < len; ++i)
+            {
+                const auto idx     = base + i * l.s_stride;
+                const double dyv   = static_cast<double>(dy[idx]);
+                const double x_hat = (static_cast<double>(x[idx]) - mean) * inv_var;
+                dbias_accum += dyv;
+                dscale_accum += x_hat * dyv;
+            }
+        });
+        dbias[c]  = static_cast<Tdscale>(dbias_accum);
+        dscale[c] = static_cast<Tdscale>(dscale_accum);
+
+        // dx = scale * invVar / M * (M * dy - dbias - x_hat * dscale)
+        const double count  = l.count();
+        const double factor = static_cast<double>(scale[c]) * inv_var / count;
+        bn_cpu_detail::for_each_block(l, [&](std::size_t in, std::size_t s, std::size_t len) {
+            const auto base = l.index(in, c, s);
+            for(std::size_t i = 0; i < len; ++i)
+            {
+                const auto idx     = base + i * l.s_stride;
+                const double x_hat = (static_cast<double>(x[idx]) - mean) * inv_var;
+                dx[idx]            = static_cast<Tdx>(
+                    factor * (count * static_cast<double>(dy[idx]) - dbias_accum -
+                              x_hat * dscale_accum));
+            }
+        });
+    });
+}
+
+#endif // GUARD_CPU_BATCHNORM_HPP
@@ -0,0 +1,290 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_CPU_CTC_HPP
+#define GUARD_CPU_CTC_HPP
+
+#include <miopen/par_for.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+// Host reference for the CTC loss shared by the tests and MIOpenDriver.
+//
+// All sequences of the batch are independent and are processed in parallel. Every recurrence
+// step of alpha and beta updates a whole row of the extended label sequence from the previous
+// row with straight-line loops, and all scratch memory lives in a ctc_cpu_workspace that is
+// sized once for the batch, so no allocations happen inside the recursions. Log-probabilities
+// are clamped to ctc_cpu_cutoff like the device code does.
+
+constexpr double ctc_cpu_cutoff = -1e20;
+
+struct ctc_cpu_problem
+{
+    int max_time_step;
+    int batch_size;
+    int class_sz; // including the blank label
+    // Strides of the time, batch and class dimensions.
+    std::array<std::size_t, 3> probs_strides;
+    std::array<std::size_t, 3> grads_strides;
+    // Labels of all sequences, concatenated.
+    const int* labels;
+    const int* label_lengths;
+    const int* input_lengths;
+    int blank_lb;
+    bool apply_softmax;
+};
+
+/// Returns a description of the first inconsistency of the problem, or nullptr if it can be
+/// computed.
+inline const char* ctc_cpu_check(const ctc_cpu_problem& p)
+{
+    int offset = 0;
+    for(int b = 0; b < p.batch_size; ++b)
+    {
+        if(p.input_lengths[b] > p.max_time_step)
+            return "Wrong input time step";
+        int repeat = 0;
+        for(int i = 0; i < p.label_lengths[b]; ++i)
+        {
+            if(p.labels[offset + i] >= p.class_sz)
+                return "Wrong label id";
+            if(i > 0 && p.labels[offset + i] == p.labels[offset + i - 1])
+                ++repeat;
+        }
+        if(p.label_lengths[b] + repeat > p.input_lengths[b])
+            return "Error: label length exceeds input time step";
+        offset += p.label_lengths[b];
+    }
+    return nullptr;
+}
+
+/// Scratch memory of ctc_cpu_loss. A workspace may be reused for any number of calls; it only
+/// grows when a larger problem comes along.
+struct ctc_cpu_workspace
+{
+    std::vector<double> log_probs; // [time][batch][class]
+    std::vector<double> alpha;     // [batch][time][label_prime]
+    std::vector<double> beta;      // [batch][time][label_prime]
+    std::vector<double> grad_sums; // [batch][class]
+    std::vector<int> label_prime;  // [batch][label_prime]
+    std::vector<int> label_offsets;
+    std::size_t max_prime_len = 0;
+
+    void reserve(const ctc_cpu_problem& p)
+    {
+        // An empty batch has no labels, max_element would return the end of the range.
+        const int max_label_len =
+            p.batch_size > 0 ? *std::max_element(p.label_lengths, p.label_lengths + p.batch_size)
+                             : 0;
+        max_prime_len        = 2 * max_label_len + 1;
+        const auto rows      = std::size_t(p.max_time_step) * p.batch_size;
+        const auto seq_elems = rows * max_prime_len;
+        log_probs.resize(std::max(log_probs.size(), rows * p.class_sz));
+        alpha.resize(std::max(alpha.size(), seq_elems));
+        beta.resize(std::max(beta.size(), seq_elems));
+        grad_sums.resize(std::max(grad_sums.size(), std::size_t(p.batch_size) * p.class_sz));
+        label_prime.resize(std::max(label_prime.size(), p.batch_size * max_prime_len));
+        label_offsets.resize(p.batch_size);
+        for(int b = 0; b < p.batch_size; ++b)
+            label_offsets[b] = b == 0 ? 0 : label_offsets[b - 1] + p.label_lengths[b - 1];
+    }
+};
+
+namespace ctc_cpu_detail {
+
+inline double logaddexp(double x, double y)
+{
+    const double a = std::max(x, y);
+    const double d = std::min(x, y) - a;
+    return d <= ctc_cpu_cutoff ? std::max(a, ctc_cpu_cutoff)
+                               : std::max(a + std::log1p(std::exp(d)), ctc_cpu_cutoff);
+}
+
+// out = max(in - logsumexp(in), cutoff) for one row of classes. The maximum and the sum of
+// exponentials are computed in two separate passes without data-dependent branches.
+template <class T>
+void log_softmax(const T* in, std::size_t stride, std::size_t n, double* out)
+{
+    double max_v = static_cast<double>(in[0]);
+    for(std::size_t i = 1; i < n; ++i)
+        max_v = std::max(max_v, static_cast<double>(in[i * stride]));
+    for(std::size_t i = 0; i < n; ++i)
+        out[i] = static_cast<double>(in[i * stride]) - max_v;
+    double sum = 0.0;
+    for(std::size_t i = 0; i < n; ++i)
+        sum += std::exp(out[i]);
+    const double log_sum = std::log(sum);
+    for(std::size_t i = 0; i < n; ++i)
+        out[i] = std::max(out[i] - log_sum, ctc_cpu_cutoff);
+}
+
+} // namespace ctc_cpu_detail
+
+/// Computes the loss of every sequence and the gradients with respect to the probabilities
+/// (or to the activations of the softmax layer if the problem applies it). Gradients past
+/// the input length of a sequence are zero.
+template <class Tin, class Tout>
+void ctc_cpu_loss(const ctc_cpu_problem& p,
+                  const Tin* probs,
+                  Tout* losses,
+                  Tout* gradients,
+                  ctc_cpu_workspace& ws)
+{
+    using ctc_cpu_detail::logaddexp;
+    ws.reserve(p);
+
+    const std::size_t class_sz = p.class_sz;
+    const std::size_t batch_sz = p.batch_size;
+    const std::size_t rows     = std::size_t(p.max_time_step) * batch_sz;
+    const int blank = p.blank_lb < 0 ? 0 : (p.blank_lb >= p.class_sz ? p.class_sz - 1 : p.blank_lb);
+
+    // log_probs holds the inputs in the log domain, packed.
+    miopen::par_for(rows, std::max<std::size_t>(1, 4096 / class_sz), [&](std::size_t row) {
+        const std::size_t t = row / batch_sz;
+        const std::size_t b = row % batch_sz;
+        const Tin* in       = probs + t * p.probs_strides[0] + b * p.probs_strides[1];
+        double* out         = ws.log_probs.data() + row * class_sz;
+        if(p.apply_softmax)
+        {
+            ctc_cpu_detail::log_softmax(in, p.probs_strides[2], class_sz, out);
+        }
+        else
+        {
+            for(std::size_t c = 0; c < class_sz; ++c)
+                out[c] = static_cast<double>(in[c * p.probs_strides[2]]);
+        }
+    });
+
+    miopen::par_for(batch_sz, 1, [&](std::size_t b) {
+        const int input_len = p.input_lengths[b];
+        const int S         = 2 * p.label_lengths[b] + 1;
+        const auto S_max    = ws.max_prime_len;
+        int* lp             = ws.label_prime.data() + b * S_max;
+        double* alpha       = ws.alpha.data() + b * p.max_time_step * S_max;
+        double* beta        = ws.beta.data() + b * p.max_time_step * S_max;
+        double* grad_sums   = ws.grad_sums.data() + b * class_sz;
+        auto log_prob       = [&](int t, int c) {
+            return ws.log_probs[(t * batch_sz + b) * class_sz + c];
+        };
+        auto grad = [&](int t, std::size_t c) -> Tout& {
+            return gradients[t * p.grads_strides[0] + b * p.grads_strides[1] +
+                             c * p.grads_strides[2]];
+        };
+
+        for(int s = 0; s < S; ++s)
+            lp[s] = s % 2 == 0 ? blank : p.labels[ws.label_offsets[b] + s / 2];
+        // A label may follow the label two positions before it only when they differ.
+        auto can_skip = [&](int s, int other) { return lp[s] != blank && lp[s] != lp[other]; };
+
+        if(input_len == 0)
+        {
+            losses[b] = Tout(0);
+            for(int t = 0; t < p.max_time_step; ++t)
+                for(std::size_t c = 0; c < class_sz; ++c)
+                    grad(t, c) = Tout(0);
+            return;
+        }
+
+        // alpha[t][s]: log-probability of the prefixes that end at s at time t.
+        std::fill(alpha, alpha + S, ctc_cpu_cutoff);
+        for(int s = 0; s < std::min(S, 2); ++s)
+            alpha[s] = log_prob(0, lp[s]);
+        for(int t = 1; t < input_len; ++t)
+        {
+            const double* prev = alpha + (t - 1) * S;
+            double* cur        = alpha + t * S;
+            for(int s = 0; s < S; ++s)
+            {
+                double a = prev[s];
+                if(s >= 1)
+                    a = logaddexp(a, prev[s - 1]);
+                if(s >= 2 && can_skip(s, s - 2))
+                    a = logaddexp(a, prev[s - 2]);
+                cur[s] = std::max(a + log_prob(t, lp[s]), ctc_cpu_cutoff);
+            }
+        }
+
+        // beta[t][s]: log-probability of the suffixes that start at s at time t.
+        double* last = beta + (input_len - 1) * S;
+        std::fill(last, last + S, ctc_cpu_cutoff);
+        for(int s = std::max(S - 2, 0); s < S; ++s)
+            last[s] = log_prob(input_len - 1, lp[s]);
+        for(int t = input_len - 2; t >= 0; --t)
+        {
+            const double* next = beta + (t + 1) * S;
+            double* cur        = beta + t * S;
+            for(int s = 0; s < S; ++s)
+            {
+                double v = next[s];
+                if(s + 1 < S)
+                    v = logaddexp(v, next[s + 1]);
+                if(s + 2 < S && can_skip(s, s + 2))
+                    v = logaddexp(v, next[s + 2]);
+                cur[s] = std::max(v + log_prob(t, lp[s]), ctc_cpu_cutoff);
+            }
+        }
+
+        const double* alpha_last = alpha + (input_len - 1) * S;
+        const double prob_lx_log =
+            S > 1 ? logaddexp(alpha_last[S - 1], alpha_last[S - 2]) : alpha_last[0];
+        losses[b] = static_cast<Tout>(-prob_lx_log);
+
+        for(int t = 0; t < input_len; ++t)
+        {
+            std::fill(grad_sums, grad_sums + class_sz, ctc_cpu_cutoff);
+            const double* a = alpha + t * S;
+            const double* e = beta + t * S;
+            for(int s = 0; s < S; ++s)
+                grad_sums[lp[s]] = logaddexp(grad_sums[lp[s]], a[s] + e[s]);
+
+            // alpha and beta both include the probability at time t, so it is removed once
+            // more than usual.
+            for(std::size_t c = 0; c < class_sz; ++c)
+            {
+                const double lpc = log_prob(t, c);
+                if(p.apply_softmax)
+                {
+                    const double g = std::max(grad_sums[c] - lpc - prob_lx_log, ctc_cpu_cutoff);
+                    grad(t, c)     = static_cast<Tout>(std::exp(lpc) - std::exp(g));
+                }
+                else
+                {
+                    const double g =
+                        std::max(grad_sums[c] - 2 * lpc - prob_lx_log, ctc_cpu_cutoff);
+                    grad(t, c) = static_cast<Tout>(-std::exp(g));
+                }
+            }
+        }
+        for(int t = input_len; t < p.max_time_step; ++t)
+            for(std::size_t c = 0; c < class_sz; ++c)
+                grad(t, c) = Tout(0);
+    });
+}
+
+#endif // GUARD_CPU_CTC_HPP
@@ -0,0 +1,281 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_CPU_GRU_HPP
+#define GUARD_CPU_GRU_HPP
+
+#include "cpu_rnn.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+// Host reference of the GRU: forward (training and inference), backward data and backward
+// weights. Each row of the reserve space holds the three gates of every direction followed by
+// the hidden state of every direction.
+
+/// Cell policy of the GRU for the step loops in cpu_rnn.hpp. The gates of a direction are, in
+/// order, update, reset and the candidate state. The hidden-state product of the candidate is
+/// scaled by the reset gate, so the step loop accumulates it in the hidden state slot, and the
+/// activation half of the reserve space keeps it there for the backward passes. The backward
+/// data pass replaces it with the gradient of the candidate scaled by the reset gate, which is
+/// what the backward weights pass pairs with the hidden state.
+template <typename T>
+struct rnn_cpu_gru_cell
+{
+    static constexpr bool cell_state = false;
+
+    explicit rnn_cpu_gru_cell(const rnn_cpu_shape& shape_)
+        : shape(shape_), h_offset(3 * shape_.bi * shape_.hy_h), dh_offset(h_offset)
+    {
+    }
+
+    const rnn_cpu_shape& shape;
+    std::size_t h_offset;
+    std::size_t c_offset = 0;
+    std::size_t dh_offset;
+    std::size_t dc_offset = 0;
+
+    std::size_t hidden_slot(int dir, int gi) const
+    {
+        return gi == 2 ? h_offset + std::size_t(dir) * shape.hy_h
+                       : std::size_t(dir * 3 + gi) * shape.hy_h;
+    }
+
+    void forward(std::vector<T>& rsv, const rnn_cpu_row& r, const T* h0, const T*) const
+    {
+        const int hy_h      = shape.hy_h;
+        const std::size_t g = r.at + r.dir * 3 * hy_h;
+        const std::size_t h = r.at + h_offset + r.dir * hy_h;
+        const std::size_t a = shape.activations();
+
+        for(int k = 0; k < hy_h; k++)
+        {
+            const std::size_t z = g + k, rr = g + hy_h + k, c = g + 2 * hy_h + k;
+
+            rsv[h + k + a] = rsv[h + k];
+            rsv[c] += activfunc(rsv[rr], 2) * rsv[h + k];
+
+            const T zt = activfunc(rsv[z], 2);
+            rsv[h + k] = h0 != nullptr ? (1 - zt) * activfunc(rsv[c], 1) + zt * h0[k]
+                                       : (1 - zt) * activfunc(rsv[c], 1);
+
+            rsv[z + a]  = zt;
+            rsv[rr + a] = activfunc(rsv[rr], 2);
+            rsv[c + a]  = activfunc(rsv[c], 1);
+        }
+    }
+
+    void backward(std::vector<T>& wk,
+                  std::vector<T>& rsv,
+                  const rnn_cpu_row& r,
+                  const T* h0,
+                  const T*) const
+    {
+        const int hy_h      = shape.hy_h;
+        const std::size_t g = r.at + r.dir * 3 * hy_h;
+        const std::size_t h = r.at + h_offset + r.dir * hy_h;
+        const std::size_t a = shape.activations();
+
+        for(int k = 0; k < hy_h; k++)
+        {
+            const std::size_t z = g + k, rr = g + hy_h + k, c = g + 2 * hy_h + k;
+
+            wk[c] += wk[h + k] * (1 - activfunc(rsv[z], 2)) * dervactivfunc(rsv[c], 1);
+            wk[rr] = rsv[h + k + a] * wk[c] * dervactivfunc(rsv[rr], 2);
+            wk[z] += wk[h + k] * ((h0 != nullptr ? h0[k] : 0) - activfunc(rsv[c], 1)) *
+                     dervactivfunc(rsv[z], 2);
+
+            rsv[h + k + a] = wk[c] * rsv[rr + a];
+        }
+    }
+
+    void carry(const std::vector<T>& wk,
+               const std::vector<T>& rsv,
+               const std::vector<T>& wei,
+               std::size_t from,
+               int li,
+               int dir,
+               T* dh,
+               T*) const
+    {
+        const int hy_h      = shape.hy_h;
+        const std::size_t g = from + dir * 3 * hy_h;
+        const T* w          = &wei[shape.hidden_weights(li, dir)];
+
+        rnn_cpu_row_backprop(hy_h, 2 * hy_h, &wk[g], w, dh);
+
+        std::vector<T> dc(hy_h);
+        for(int k = 0; k < hy_h; k++)
+        {
+            dh[k] += wk[from + h_offset + dir * hy_h + k] * activfunc(rsv[g + k], 2);
+            dc[k] = wk[g + 2 * hy_h + k] * activfunc(rsv[g + hy_h + k], 2);
+        }
+        rnn_cpu_row_backprop(hy_h, hy_h, dc.data(), w + 2 * hy_h * hy_h, dh);
+    }
+
+    T weight_grad(const std::vector<T>& wk,
+                  const std::vector<T>& rsv,
+                  std::size_t at,
+                  int dir,
+                  int unit) const
+    {
+        const std::size_t g = at + dir * 3 * shape.hy_h;
+        return unit < 2 * shape.hy_h
+                   ? wk[g + unit]
+                   : static_cast<T>(wk[g + unit] * activfunc(rsv[g + unit - shape.hy_h], 2));
+    }
+};
+
+template <typename T, typename Dropout>
+void GRUFwdCPUVerify(bool use_dropout,
+                     Dropout&& dropout,
+                     std::vector<T>& in,
+                     std::vector<T>& wei, // [ input_state_weight_trans
+                                          // hidden_state_weight0_trans input1_trans
+                                          // hidden1_trans ... output_weight;
+                                          // bidirectional reversed weights ]
+                     std::vector<T>& hy,  // current/final hidden state
+                     std::vector<T>& hx,  // initial hidden state
+                     std::vector<T>& out,
+                     const std::vector<int>& in_n, // input batch size
+                     int in_h,                     // input data length
+                     int seqLength,                // Number of iterations to unroll over
+                     bool bidirection,             // whether using bidirectional net
+                     bool biased,                  // whether using bias
+                     int hy_d,  // 1 by numlayer (number of stacks of hidden layers) for
+                                // unidirection, 2 by numlayer for bidirection
+                     int hy_n,  // equal to input batch size in_n[0]
+                     int hy_h,  // hidden state number
+                     int out_h, // 1 by hy_h related function for unidirection, 2 by hy_h
+                                // related function for bidirection
+                     int inputMode,
+                     std::vector<T>& rsvspace,
+                     bool hx_is_null = false)
+{
+    (void)out_h;
+
+    const rnn_cpu_shape shape{
+        in_n, seqLength, in_h, hy_d, hy_n, hy_h, bidirection, inputMode == 1, 3, 4};
+    const rnn_cpu_gru_cell<T> cell{shape};
+    rnn_cpu_forward<T>(cell,
+                       biased,
+                       use_dropout,
+                       dropout,
+                       in,
+                       wei,
+                       hx_is_null ? nullptr : hx.data(),
+                       nullptr,
+                       hy,
+                       nullptr,
+                       out,
+                       rsvspace);
+}
+
+template <typename T, typename Dropout>
+void GRUBwdDataCPUVerify(bool use_dropout,
+                         Dropout&& dropout,
+                         std::vector<T>& din,
+                         std::vector<T>& wei, // [ input_state_weight_trans
+                                              // hidden_state_weight0_trans input1_trans
+                                              // hidden1_trans ... output_weight;
+                                              // bidirectional reversed weights ]
+                         std::vector<T>& dhy, // current/final hidden state
+                         std::vector<T>& dhx,
+                         std::vector<T>& hx, // initial hidden state
+                         std::vector<T>& out,
+                         std::vector<T>& dout,
+                         const std::vector<int>& in_n, // input batch size
+                         int in_h,                     // input data length
+                         int seqLength,                // Number of iterations to unroll over
+                         bool bidirection,             // whether using bidirectional net
+                         bool,                         // whether using bias
+                         int hy_d,  // 1 by numlayer (number of stacks of hidden layers)
+                                    // for unidirection, 2 by numlayer for bidirection
+                         int hy_n,  // equal to input batch size in_n[0]
+                         int hy_h,  // hidden state number
+                         int out_h, // 1 by hy_h related function for unidirection, 2 by
+                                    // hy_h related function for bidirection
+                         int inputMode,
+                         std::vector<T>& rsvspace,
+                         std::vector<T>& wkspace,
+                         bool hx_is_null  = false,
+                         bool dhy_is_null = false)
+{
+    (void)out;
+    (void)out_h;
+
+    const rnn_cpu_shape shape{
+        in_n, seqLength, in_h, hy_d, hy_n, hy_h, bidirection, inputMode == 1, 3, 4};
+    const rnn_cpu_gru_cell<T> cell{shape};
+    rnn_cpu_backward_data<T>(cell,
+                             use_dropout,
+                             dropout,
+                             wei,
+                             dout,
+                             hx_is_null ? nullptr : hx.data(),
+                             nullptr,
+                             dhy_is_null ? nullptr : dhy.data(),
+                             nullptr,
+                             dhx,
+                             nullptr,
+                             din,
+                             rsvspace,
+                             wkspace);
+}
+
+template <typename T>
+void GRUBwdWeightCPUVerify(bool use_dropout,
+                           std::vector<T>& in,
+                           std::vector<T>& dwei,         // [ input_state_weight_trans
+                                                         // hidden_state_weight0_trans
+                                                         // input1_trans hidden1_trans ...
+                                                         // output_weight; bidirectional
+                                                         // reversed weights ]
+                           std::vector<T>& hx,           // initial hidden state
+                           const std::vector<int>& in_n, // input batch size
+                           int in_h,                     // input data length
+                           int seqLength,                // Number of iterations to unroll over
+                           bool bidirection,             // whether using bidirectional net
+                           bool biased,                  // whether using bias
+                           int hy_d, // 1 by numlayer (number of stacks of hidden
+                                     // layers) for unidirection, 2 by numlayer for
+                                     // bidirection
+                           int hy_n, // equal to input batch size in_n[0]
+                           int hy_h, // hidden state number
+                                     // by hy_h related function for bidirection
+                           int inputMode,
+                           std::vector<T>& rsvspace,
+                           std::vector<T>& wkspace,
+                           bool hx_is_null = false)
+{
+    const rnn_cpu_shape shape{
+        in_n, seqLength, in_h, hy_d, hy_n, hy_h, bidirection, inputMode == 1, 3, 4};
+    const rnn_cpu_gru_cell<T> cell{shape};
+    rnn_cpu_backward_weights<T>(
+        cell, biased, use_dropout, in, dwei, hx_is_null ? nullptr : hx.data(), rsvspace, wkspace);
+}
+
+#endif // GUARD_CPU_GRU_HPP
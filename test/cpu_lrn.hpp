@@ -0,0 +1,211 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_CPU_LRN_HPP
+#define GUARD_CPU_LRN_HPP
+
+#include <miopen/miopen.h>
+#include <miopen/par_for.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+// Host reference for local response normalization shared by the tests and MIOpenDriver.
+//
+// Both directions reduce a window around every element. Instead of summing each window from
+// scratch, the reduced values are turned into prefix sums once, so every window costs O(1)
+// regardless of its size: cross-channel mode keeps one prefix sum per W position of an (n, h)
+// row, within-channel mode builds a summed-area table per (n, c) plane. Rows and planes are
+// processed in parallel.
+
+using lrn_cpu_dims = std::array<std::size_t, 4>;
+
+struct lrn_cpu_problem
+{
+    miopenLRNMode_t mode;
+    lrn_cpu_dims lens; // n, c, h, w
+    // The forward window of element i is [i - lower, i + upper], along C for
+    // miopenLRNCrossChannel and along both H and W for miopenLRNWithinChannel, clipped to the
+    // tensor. The backward pass uses the mirrored window [i - upper, i + lower].
+    std::size_t lower;
+    std::size_t upper;
+    double k;
+    double beta;
+};
+
+namespace lrn_cpu_detail {
+
+inline std::size_t
+offset(const lrn_cpu_dims& s, std::size_t n, std::size_t c, std::size_t h, std::size_t w)
+{
+    return n * s[0] + c * s[1] + h * s[2] + w * s[3];
+}
+
+inline std::size_t window_begin(std::size_t i, std::size_t before)
+{
+    return i < before ? 0 : i - before;
+}
+
+inline std::size_t window_end(std::size_t i, std::size_t after, std::size_t len)
+{
+    return std::min(i + after + 1, len);
+}
+
+// Calls out(n, c, h, w, sum) with the sum of value(n, c, h, w) over the window
+// [i - before, i + after] of every element.
+template <class Value, class Out>
+void window_sums(
+    const lrn_cpu_problem& p, std::size_t before, std::size_t after, Value value, Out out)
+{
+    const auto n_len = p.lens[0], c_len = p.lens[1], h_len = p.lens[2], w_len = p.lens[3];
+    if(p.mode == miopenLRNCrossChannel)
+    {
+        miopen::par_for(n_len * h_len, 1, [&](std::size_t row) {
+            const auto n = row / h_len;
+            const auto h = row % h_len;
+            // prefix[c * W + w] is the sum over channels [0, c) at position w.
+            std::vector<double> prefix((c_len + 1) * w_len, 0.0);
+            for(std::size_t c = 0; c < c_len; ++c)
+                for(std::size_t w = 0; w < w_len; ++w)
+                    prefix[(c + 1) * w_len + w] = prefix[c * w_len + w] + value(n, c, h, w);
+
+            for(std::size_t c = 0; c < c_len; ++c)
+            {
+                const double* first = prefix.data() + window_begin(c, before) * w_len;
+                const double* last  = prefix.data() + window_end(c, after, c_len) * w_len;
+                for(std::size_t w = 0; w < w_len; ++w)
+                    out(n, c, h, w, last[w] - first[w]);
+            }
+        });
+    }
+    else
+    {
+        miopen::par_for(n_len * c_len, 1, [&](std::size_t plane) {
+            const auto n      = plane / c_len;
+            const auto c      = plane % c_len;
+            const auto stride = w_len + 1;
+            // table[(h + 1) * (W + 1) + (w + 1)] is the sum over [0, h] x [0, w].
+            std::vector<double> table((h_len + 1) * stride, 0.0);
+            for(std::size_t h = 0; h < h_len; ++h)
+            {
+                double row_sum = 0.0;
+                for(std::size_t w = 0; w < w_len; ++w)
+                {
+                    row_sum += value(n, c, h, w);
+                    table[(h + 1) * stride + w + 1] = table[h * stride + w + 1] + row_sum;
+                }
+            }
+
+            for(std::size_t h = 0; h < h_len; ++h)
+            {
+                const auto h0 = window_begin(h, before);
+                const auto h1 = window_end(h, after, h_len);
+                for(std::size_t w = 0; w < w_len; ++w)
+                {
+                    const auto w0 = window_begin(w, before);
+                    const auto w1 = window_end(w, after, w_len);
+                    out(n,
+                        c,
+                        h,
+                        w,
+                        table[h1 * stride + w1] - table[h0 * stride + w1] -
+                            table[h1 * stride + w0] + table[h0 * stride + w0]);
+                }
+            }
+        });
+    }
+}
+
+} // namespace lrn_cpu_detail
+
+/// y = x * (k + alpha_over_area(h, w) * sum(x^2))^-beta over the forward window. The
+/// normalization term in parentheses is stored to scale unless it is null.
+template <class Tx, class Ty, class Tscale, class AlphaOverArea>
+void lrn_cpu_forward(const lrn_cpu_problem& p,
+                     const Tx* x,
+                     const lrn_cpu_dims& x_strides,
+                     Ty* y,
+                     const lrn_cpu_dims& y_strides,
+                     Tscale* scale,
+                     const lrn_cpu_dims& scale_strides,
+                     AlphaOverArea alpha_over_area)
+{
+    using lrn_cpu_detail::offset;
+    lrn_cpu_detail::window_sums(
+        p,
+        p.lower,
+        p.upper,
+        [&](std::size_t n, std::size_t c, std::size_t h, std::size_t w) {
+            const auto v = static_cast<double>(x[offset(x_strides, n, c, h, w)]);
+            return v * v;
+        },
+        [&](std::size_t n, std::size_t c, std::size_t h, std::size_t w, double sum) {
+            const double s = p.k + sum * alpha_over_area(h, w);
+            if(scale != nullptr)
+                scale[offset(scale_strides, n, c, h, w)] = static_cast<Tscale>(s);
+            y[offset(y_strides, n, c, h, w)] = static_cast<Ty>(
+                static_cast<double>(x[offset(x_strides, n, c, h, w)]) * std::pow(s, -p.beta));
+        });
+}
+
+/// dx = dy * scale^-beta - ratio(h, w) * x * sum(y * dy / scale) over the backward window,
+/// where ratio is 2 * alpha * beta divided by the window area.
+template <class T, class Tdx, class Ratio>
+void lrn_cpu_backward(const lrn_cpu_problem& p,
+                      const T* x,
+                      const lrn_cpu_dims& x_strides,
+                      const T* y,
+                      const lrn_cpu_dims& y_strides,
+                      const T* dy,
+                      const lrn_cpu_dims& dy_strides,
+                      const T* scale,
+                      const lrn_cpu_dims& scale_strides,
+                      Tdx* dx,
+                      const lrn_cpu_dims& dx_strides,
+                      Ratio ratio)
+{
+    using lrn_cpu_detail::offset;
+    lrn_cpu_detail::window_sums(
+        p,
+        p.upper,
+        p.lower,
+        [&](std::size_t n, std::size_t c, std::size_t h, std::size_t w) {
+            return static_cast<double>(y[offset(y_strides, n, c, h, w)]) *
+                   static_cast<double>(dy[offset(dy_strides, n, c, h, w)]) /
+                   static_cast<double>(scale[offset(scale_strides, n, c, h, w)]);
+        },
+        [&](std::size_t n, std::size_t c, std::size_t h, std::size_t w, double sum) {
+            const double s  = static_cast<double>(scale[offset(scale_strides, n, c, h, w)]);
+            const double g  = static_cast<double>(dy[offset(dy_strides, n, c, h, w)]);
+            const double xv = static_cast<double>(x[offset(x_strides, n, c, h, w)]);
+            dx[offset(dx_strides, n, c, h, w)] =
+                static_cast<Tdx>(g * std::pow(s, -p.beta) - ratio(h, w) * xv * sum);
+        });
+}
+
+#endif // GUARD_CPU_LRN_HPP
@@ -0,0 +1,290 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_CPU_LSTM_HPP
+#define GUARD_CPU_LSTM_HPP
+
+#include "cpu_rnn.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+// Host reference of the LSTM: forward (training and inference), backward data and backward
+// weights. Each row of the reserve space holds the four gates of every direction followed by
+// the cell state and the hidden state of every direction.
+
+/// Cell policy of the LSTM for the step loops in cpu_rnn.hpp. The gates of a direction are, in
+/// order, input, forget, output and the candidate cell state.
+template <typename T>
+struct rnn_cpu_lstm_cell
+{
+    static constexpr bool cell_state = true;
+
+    explicit rnn_cpu_lstm_cell(const rnn_cpu_shape& shape_)
+        : shape(shape_),
+          h_offset(5 * shape_.bi * shape_.hy_h),
+          c_offset(4 * shape_.bi * shape_.hy_h),
+          dh_offset(h_offset),
+          dc_offset(c_offset)
+    {
+    }
+
+    const rnn_cpu_shape& shape;
+    std::size_t h_offset;
+    std::size_t c_offset;
+    std::size_t dh_offset;
+    std::size_t dc_offset;
+
+    std::size_t hidden_slot(int dir, int gi) const
+    {
+        return std::size_t(dir * 4 + gi) * shape.hy_h;
+    }
+
+    void forward(std::vector<T>& rsv, const rnn_cpu_row& r, const T*, const T* c0) const
+    {
+        const int hy_h      = shape.hy_h;
+        const std::size_t g = r.at + r.dir * 4 * hy_h;
+        const std::size_t c = r.at + c_offset + r.dir * hy_h;
+        const std::size_t h = r.at + h_offset + r.dir * hy_h;
+        const std::size_t a = shape.activations();
+
+        for(int k = 0; k < hy_h; k++)
+        {
+            const std::size_t i = g + k, f = g + hy_h + k, o = g + 2 * hy_h + k,
+                              cc = g + 3 * hy_h + k;
+
+            rsv[c + k] += activfunc(rsv[i], 2) * activfunc(rsv[cc], 1);
+            if(c0 != nullptr)
+                rsv[c + k] += activfunc(rsv[f], 2) * c0[k];
+            rsv[h + k] += activfunc(rsv[o], 2) * activfunc(rsv[c + k], 1);
+
+            rsv[i + a]     = activfunc(rsv[i], 2);
+            rsv[f + a]     = activfunc(rsv[f], 2);
+            rsv[o + a]     = activfunc(rsv[o], 2);
+            rsv[cc + a]    = activfunc(rsv[cc], 1);
+            rsv[c + k + a] = activfunc(rsv[c + k], 1);
+        }
+    }
+
+    void backward(std::vector<T>& wk,
+                  std::vector<T>& rsv,
+                  const rnn_cpu_row& r,
+                  const T*,
+                  const T* c0) const
+    {
+        const int hy_h      = shape.hy_h;
+        const std::size_t g = r.at + r.dir * 4 * hy_h;
+        const std::size_t c = r.at + c_offset + r.dir * hy_h;
+        const std::size_t h = r.at + h_offset + r.dir * hy_h;
+
+        for(int k = 0; k < hy_h; k++)
+        {
+            const std::size_t i = g + k, f = g + hy_h + k, o = g + 2 * hy_h + k,
+                              cc = g + 3 * hy_h + k;
+
+            wk[c + k] += wk[h + k] * dervactivfunc(rsv[c + k], 1) * activfunc(rsv[o], 2);
+            if(c0 != nullptr)
+                wk[f] += wk[c + k] * c0[k] * dervactivfunc(rsv[f], 2);
+            wk[i] += wk[c + k] * activfunc(rsv[cc], 1) * dervactivfunc(rsv[i], 2);
+            wk[o] += wk[h + k] * activfunc(rsv[c + k], 1) * dervactivfunc(rsv[o], 2);
+            wk[cc] += wk[c + k] * activfunc(rsv[i], 2) * dervactivfunc(rsv[cc], 1);
+        }
+    }
+
+    void carry(const std::vector<T>& wk,
+               const std::vector<T>& rsv,
+               const std::vector<T>& wei,
+               std::size_t from,
+               int li,
+               int dir,
+               T* dh,
+               T* dc) const
+    {
+        const int hy_h      = shape.hy_h;
+        const std::size_t g = from + dir * 4 * hy_h;
+        rnn_cpu_row_backprop(hy_h, 4 * hy_h, &wk[g], &wei[shape.hidden_weights(li, dir)], dh);
+        for(int k = 0; k < hy_h; k++)
+            dc[k] += wk[from + c_offset + dir * hy_h + k] * activfunc(rsv[g + hy_h + k], 2);
+    }
+
+    T weight_grad(
+        const std::vector<T>& wk, const std::vector<T>&, std::size_t at, int dir, int unit) const
+    {
+        return wk[at + dir * 4 * shape.hy_h + unit];
+    }
+};
+
+template <typename T, typename Dropout>
+void LSTMFwdCPUVerify(bool use_dropout,
+                      Dropout&& dropout,
+                      const std::vector<T>& in,
+                      const std::vector<T>& wei, // [ input_state_weight_trans
+                                                 // hidden_state_weight0_trans input1_trans
+                                                 // hidden1_trans ... output_weight;
+                                                 // bidirectional reversed weights ]
+                      std::vector<T>& hy_host,   // current/final hidden state
+                      const std::vector<T>& hx,  // initial hidden state
+                      std::vector<T>& cy_host,   // current/final cell state
+                      const std::vector<T>& cx,  // initial cell state
+                      std::vector<T>& out_host,
+                      const std::vector<int>& in_n, // input batch size
+                      int in_h,                     // input data length
+                      int seqLength_cpu,            // Number of iterations to unroll over
+                      int bidirection,              // whether using bidirectional net
+                      int biased,                   // whether using bias
+                      int hy_d,  // 1 by numlayer (number of stacks of hidden layers) for
+                                 // unidirection, 2 by numlayer for bidirection
+                      int hy_n,  // equal to input batch size in_n[0]
+                      int hy_h,  // hidden state number
+                      int out_h, // 1 by hy_h related function for unidirection, 2 by hy_h
+                                 // related function for bidirection
+                      int inputMode_cpu,
+                      std::vector<T>& rsvspace,
+                      bool hx_is_null = false,
+                      bool cx_is_null = false)
+{
+    (void)out_h;
+
+    const rnn_cpu_shape shape{
+        in_n, seqLength_cpu, in_h, hy_d, hy_n, hy_h, bidirection == 1, inputMode_cpu == 1, 4, 6};
+    const rnn_cpu_lstm_cell<T> cell{shape};
+    std::fill(cy_host.begin(), cy_host.end(), static_cast<T>(0));
+    rnn_cpu_forward<T>(cell,
+                       biased == 1,
+                       use_dropout,
+                       dropout,
+                       in,
+                       wei,
+                       hx_is_null ? nullptr : hx.data(),
+                       cx_is_null ? nullptr : cx.data(),
+                       hy_host,
+                       cy_host.data(),
+                       out_host,
+                       rsvspace);
+}
+
+template <typename T, typename Dropout>
+void LSTMBwdDataCPUVerify(bool use_dropout_cpu,
+                          Dropout&& dropout,
+                          std::vector<T>& din_host,
+                          const std::vector<T>& wei,     // [ input_state_weight_trans
+                                                         // hidden_state_weight0_trans input1_trans
+                                                         // hidden1_trans ... output_weight;
+                                                         // bidirectional reversed weights ]
+                          const std::vector<T>& dhy_cpu, // current/final hidden state
+                          std::vector<T>& dhx_host,
+                          const std::vector<T>& hx,      // initial hidden state
+                          const std::vector<T>& dcy_cpu, // current/final cell state
+                          std::vector<T>& dcx_host,
+                          const std::vector<T>& cx,
+                          const std::vector<T>& out,
+                          const std::vector<T>& dout,
+                          const std::vector<int>& in_n, // input batch size
+                          int in_h,                     // input data length
+                          int seqLength_cpu,            // Number of iterations to unroll over
+                          int bidirection,              // whether using bidirectional net
+                          int,                          // whether using bias
+                          int hy_d,  // 1 by numlayer (number of stacks of hidden layers)
+                                     // for unidirection, 2 by numlayer for bidirection
+                          int hy_n,  // equal to input batch size in_n[0]
+                          int hy_h,  // hidden state number
+                          int out_h, // 1 by hy_h related function for unidirection, 2 by
+                                     // hy_h related function for bidirection
+                          int inputMode_cpu,
+                          std::vector<T>& rsvspace,
+                          std::vector<T>& wkspace,
+                          bool cx_is_null  = false,
+                          bool dhy_is_null = false,
+                          bool dcy_is_null = false)
+{
+    (void)out;
+    (void)hx;
+    (void)out_h;
+
+    const rnn_cpu_shape shape{
+        in_n, seqLength_cpu, in_h, hy_d, hy_n, hy_h, bidirection == 1, inputMode_cpu == 1, 4, 6};
+    const rnn_cpu_lstm_cell<T> cell{shape};
+    std::fill(dcx_host.begin(), dcx_host.end(), static_cast<T>(0));
+    rnn_cpu_backward_data<T>(cell,
+                             use_dropout_cpu,
+                             dropout,
+                             wei,
+                             dout,
+                             nullptr,
+                             cx_is_null ? nullptr : cx.data(),
+                             dhy_is_null ? nullptr : dhy_cpu.data(),
+                             dcy_is_null ? nullptr : dcy_cpu.data(),
+                             dhx_host,
+                             dcx_host.data(),
+                             din_host,
+                             rsvspace,
+                             wkspace);
+}
+
+template <typename T>
+void LSTMBwdWeightCPUVerify(bool use_dropout_cpu,
+                            const std::vector<T>& in,
+                            std::vector<T>& dwei_host, // [ input_state_weight_trans
+                                                       // hidden_state_weight0_trans
+                                                       // input1_trans hidden1_trans ...
+                                                       // output_weight; bidirectional
+                                                       // reversed weights ]
+                            const std::vector<T>& hx,  // initial hidden state
+                            const std::vector<T>& dout,
+                            const std::vector<int>& in_n, // input batch size
+                            int in_h,                     // input data length
+                            int seqLength_cpu,            // Number of iterations to unroll over
+                            int bidirection,              // whether using bidirectional net
+                            int biased,                   // whether using bias
+                            int hy_d,  // 1 by numlayer (number of stacks of hidden
+                                       // layers) for unidirection, 2 by numlayer for
+                                       // bidirection
+                            int hy_n,  // equal to input batch size in_n[0]
+                            int hy_h,  // hidden state number
+                            int out_h, // 1 by hy_h related function for unidirection, 2
+                                       // by hy_h related function for bidirection
+                            int inputMode_cpu,
+                            const std::vector<T>& rsvspace,
+                            const std::vector<T>& wkspace,
+                            bool hx_is_null = false)
+{
+    (void)dout;
+    (void)out_h;
+
+    const rnn_cpu_shape shape{
+        in_n, seqLength_cpu, in_h, hy_d, hy_n, hy_h, bidirection == 1, inputMode_cpu == 1, 4, 6};
+    const rnn_cpu_lstm_cell<T> cell{shape};
+    rnn_cpu_backward_weights<T>(cell,
+                                biased == 1,
+                                use_dropout_cpu,
+                                in,
+                                dwei_host,
+                                hx_is_null ? nullptr : hx.data(),
+                                rsvspace,
+                                wkspace);
+}
+
+#endif // GUARD_CPU_LSTM_HPP
@@ -0,0 +1,265 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_CPU_POOLING_HPP
+#define GUARD_CPU_POOLING_HPP
+
+#include <miopen/miopen.h>
+#include <miopen/par_for.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+// Host reference for 2-D and 3-D pooling shared by the tests and MIOpenDriver.
+//
+// The clipped window of every output position is computed once per axis up front instead of
+// once per output element. Each (n, c) plane is then processed by a single thread with the
+// innermost loop running along W, and the planes are distributed over the available cores.
+// The backward pass accumulates each plane in a private buffer, so there are no races and the
+// result does not depend on the number of threads.
+
+struct pooling_cpu_problem
+{
+    miopenPoolingMode_t mode;
+    std::size_t n;
+    std::size_t c;
+    // Spatial dimensions are ordered d, h, w. 2-D problems use a depth of 1.
+    std::array<std::size_t, 3> in_lens;
+    std::array<std::size_t, 3> out_lens;
+    std::array<std::size_t, 3> kernel;
+    std::array<std::size_t, 3> stride;
+    std::array<std::size_t, 3> pad;
+    // Strides are ordered n, c, d, h, w.
+    std::array<std::size_t, 5> x_strides;
+    std::array<std::size_t, 5> y_strides;
+
+    std::size_t in_plane_size() const { return in_lens[0] * in_lens[1] * in_lens[2]; }
+    std::size_t out_plane_size() const { return out_lens[0] * out_lens[1] * out_lens[2]; }
+};
+
+/// Marks max-pooling outputs whose window does not overlap the input.
+constexpr std::size_t pooling_cpu_no_index = std::numeric_limits<std::size_t>::max();
+
+namespace pooling_cpu_detail {
+
+struct range
+{
+    std::size_t begin;
+    std::size_t end;
+    std::size_t size() const { return end - begin; }
+};
+
+struct windows
+{
+    std::array<std::vector<range>, 3> axes;
+
+    explicit windows(const pooling_cpu_problem& p)
+    {
+        for(std::size_t a = 0; a < 3; ++a)
+        {
+            axes[a].resize(p.out_lens[a]);
+            for(std::size_t o = 0; o < p.out_lens[a]; ++o)
+            {
+                const auto start = static_cast<std::ptrdiff_t>(o * p.stride[a]) -
+                                   static_cast<std::ptrdiff_t>(p.pad[a]);
+                const auto end = std::min(start + static_cast<std::ptrdiff_t>(p.kernel[a]),
+                                          static_cast<std::ptrdiff_t>(p.in_lens[a]));
+                const auto begin = std::max<std::ptrdiff_t>(start, 0);
+                axes[a][o] = {static_cast<std::size_t>(begin),
+                              static_cast<std::size_t>(std::max(begin, end))};
+            }
+        }
+    }
+};
+
+// Divisor of the average modes: the clipped window for miopenPoolingAverage and the whole
+// kernel for miopenPoolingAverageInclusive. Empty windows divide by one.
+inline double
+pool_size(const pooling_cpu_problem& p, const range& d, const range& h, const range& w)
+{
+    const auto size = p.mode == miopenPoolingAverageInclusive
+                          ? p.kernel[0] * p.kernel[1] * p.kernel[2]
+                          : d.size() * h.size() * w.size();
+    return size == 0 ? 1.0 : static_cast<double>(size);
+}
+
+inline std::size_t offset(const std::array<std::size_t, 5>& s,
+                          std::size_t n,
+                          std::size_t c,
+                          std::size_t d,
+                          std::size_t h,
+                          std::size_t w)
+{
+    return n * s[0] + c * s[1] + d * s[2] + h * s[3] + w * s[4];
+}
+
+// Runs f(n, c) for every plane, in parallel unless the whole problem is too small to be worth
+// the threads.
+template <class F>
+void for_each_plane(const pooling_cpu_problem& p, F f)
+{
+    const std::size_t work =
+        std::max<std::size_t>(p.out_plane_size() * p.kernel[0] * p.kernel[1] * p.kernel[2], 1);
+    const std::size_t grain = std::max<std::size_t>((std::size_t{1} << 14) / work, 1);
+    miopen::par_for(p.n * p.c, grain, [&](std::size_t plane) { f(plane / p.c, plane % p.c); });
+}
+
+} // namespace pooling_cpu_detail
+
+/// Computes y = pool(x). For max pooling the optional argmax buffer, indexed like y, receives
+/// the position of the maximum within its (n, c) plane as (d * H + h) * W + w, or
+/// pooling_cpu_no_index together with the lowest representable value of Ty for windows that
+/// lie entirely in the padding. Ties resolve to the first element in d, h, w order.
+template <class Tx, class Ty>
+void pooling_cpu_forward(const pooling_cpu_problem& p,
+                         const Tx* x,
+                         Ty* y,
+                         std::size_t* argmax = nullptr)
+{
+    using namespace pooling_cpu_detail;
+    const windows win(p);
+    const auto in_h = p.in_lens[1];
+    const auto in_w = p.in_lens[2];
+
+    for_each_plane(p, [&](std::size_t n, std::size_t c) {
+        const Tx* x_plane = x + offset(p.x_strides, n, c, 0, 0, 0);
+        for(std::size_t od = 0; od < p.out_lens[0]; ++od)
+        {
+            const auto& wd = win.axes[0][od];
+            for(std::size_t oh = 0; oh < p.out_lens[1]; ++oh)
+            {
+                const auto& wh = win.axes[1][oh];
+                for(std::size_t ow = 0; ow < p.out_lens[2]; ++ow)
+                {
+                    const auto& ww    = win.axes[2][ow];
+                    const auto y_off  = offset(p.y_strides, n, c, od, oh, ow);
+                    double acc        = p.mode == miopenPoolingMax
+                                            ? std::numeric_limits<double>::lowest()
+                                            : 0.0;
+                    std::size_t index = pooling_cpu_no_index;
+
+                    for(std::size_t d = wd.begin; d < wd.end; ++d)
+                    {
+                        for(std::size_t h = wh.begin; h < wh.end; ++h)
+                        {
+                            const Tx* row = x_plane + d * p.x_strides[2] + h * p.x_strides[3];
+                            if(p.mode == miopenPoolingMax)
+                            {
+                                for(std::size_t w = ww.begin; w < ww.end; ++w)
+                                {
+                                    const auto v = static_cast<double>(row[w * p.x_strides[4]]);
+                                    if(v > acc)
+                                    {
+                                        acc   = v;
+                                        index = (d * in_h + h) * in_w + w;
+                                    }
+                                }
+                            }
+                            else
+                            {
+                                for(std::size_t w = ww.begin; w < ww.end; ++w)
+                                    acc += static_cast<double>(row[w * p.x_strides[4]]);
+                            }
+                        }
+                    }
+
+                    if(p.mode == miopenPoolingMax)
+                    {
+                        y[y_off] = index == pooling_cpu_no_index
+                                       ? std::numeric_limits<Ty>::lowest()
+                                       : static_cast<Ty>(acc);
+                        if(argmax != nullptr)
+                            argmax[y_off] = index;
+                    }
+                    else
+                    {
+                        y[y_off] = static_cast<Ty>(acc / pool_size(p, wd, wh, ww));
+                    }
+                }
+            }
+        }
+    });
+}
+
+/// Computes dx from dy, both laid out like x and y of the problem. Every element of dx is
+/// written. Max pooling routes the gradients through argmax as produced by
+/// pooling_cpu_forward.
+template <class Tdy, class Tdx>
+void pooling_cpu_backward(const pooling_cpu_problem& p,
+                          const Tdy* dy,
+                          Tdx* dx,
+                          const std::size_t* argmax = nullptr)
+{
+    using namespace pooling_cpu_detail;
+    const windows win(p);
+    const auto in_h = p.in_lens[1];
+    const auto in_w = p.in_lens[2];
+
+    for_each_plane(p, [&](std::size_t n, std::size_t c) {
+        std::vector<double> acc(p.in_plane_size(), 0.0);
+        for(std::size_t od = 0; od < p.out_lens[0]; ++od)
+        {
+            const auto& wd = win.axes[0][od];
+            for(std::size_t oh = 0; oh < p.out_lens[1]; ++oh)
+            {
+                const auto& wh = win.axes[1][oh];
+                for(std::size_t ow = 0; ow < p.out_lens[2]; ++ow)
+                {
+                    const auto y_off = offset(p.y_strides, n, c, od, oh, ow);
+                    const auto g     = static_cast<double>(dy[y_off]);
+                    if(p.mode == miopenPoolingMax)
+                    {
+                        if(argmax[y_off] != pooling_cpu_no_index)
+                            acc[argmax[y_off]] += g;
+                        continue;
+                    }
+
+                    const auto& ww     = win.axes[2][ow];
+                    const double share = g / pool_size(p, wd, wh, ww);
+                    for(std::size_t d = wd.begin; d < wd.end; ++d)
+                    {
+                        for(std::size_t h = wh.begin; h < wh.end; ++h)
+                        {
+                            double* row = acc.data() + (d * in_h + h) * in_w;
+                            for(std::size_t w = ww.begin; w < ww.end; ++w)
+                                row[w] += share;
+                        }
+                    }
+                }
+            }
+        }
+
+        for(std::size_t d = 0; d < p.in_lens[0]; ++d)
+            for(std::size_t h = 0; h < in_h; ++h)
+                for(std::size_t w = 0; w < in_w; ++w)
+                    dx[offset(p.x_strides, n, c, d, h, w)] =
+                        static_cast<Tdx>(acc[(d * in_h + h) * in_w + w]);
+    });
+}
+
+#endif // GUARD_CPU_POOLING_HPP
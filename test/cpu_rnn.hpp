@@ -0,0 +1,893 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_CPU_RNN_HPP
+#define GUARD_CPU_RNN_HPP
+
+#include <miopen/errors.hpp>
+#include <miopen/par_for.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <numeric>
+#include <string>
+#include <vector>
+
+// Building blocks of the vanilla RNN, LSTM and GRU host references in cpu_rnn_vanilla.hpp,
+// cpu_lstm.hpp and cpu_gru.hpp. The references are shared by the tests (through
+// *_common.hpp) and by MIOpenDriver (through *_verify_gemm.hpp).
+//
+// The three references share the step loops rnn_cpu_forward, rnn_cpu_backward_data and
+// rnn_cpu_backward_weights below and differ only in the cell they pass in, which holds the
+// gate math of one row. The loops project the input of all time steps of a layer with a
+// single GEMM and then run the recurrence one time step at a time, handing the rows of both
+// directions at a step to separate threads. Each reference clears its output buffers before
+// accumulating into them, so callers may pass them with stale contents.
+//
+// Dropout between stacked layers is emulated by the caller, since the tests and the driver
+// reach the dropout descriptor through different APIs. The forward and backward-data
+// references take a `Dropout` object providing
+//
+//   void forward(int rows, int cols,
+//                std::vector<T>& x, std::size_t x_offset, int x_stride,
+//                std::vector<T>& y, std::size_t y_offset, int y_stride,
+//                std::vector<unsigned char>& mask, std::size_t mask_offset);
+//   void backward(int rows, int cols,
+//                 std::vector<T>& dy, std::size_t dy_offset, int dy_stride,
+//                 std::vector<T>& dx, std::size_t dx_offset, int dx_stride,
+//                 std::vector<unsigned char>& mask, std::size_t mask_offset);
+//
+// Both work on a rows x cols block with the given row strides, and the mask holds one byte per
+// element of the block. forward() draws every block from the initial generator state, like
+// the GPU implementation does for each layer.
+
+#define RNN_MM_TRANSPOSE 1
+
+inline int sumvc(const std::vector<int>& x) { return std::accumulate(x.begin(), x.end(), 0); }
+
+template <typename T>
+inline T activfunc(T x, int actvf)
+{
+    T alpha = static_cast<T>(1), beta0 = static_cast<T>(0), beta1 = static_cast<T>(1);
+    if(actvf == 0)
+    {
+        return (x > 0) ? x : x * beta0;
+    }
+    else if(actvf == 2)
+    {
+        return static_cast<T>(1 / (1 + std::exp(-x)));
+    }
+    return static_cast<T>(alpha * std::tanh(beta1 * x));
+}
+
+template <typename T>
+inline T dervactivfunc(T x, int actvf)
+{
+    if(actvf == 0)
+    {
+        return static_cast<T>(x > 0 ? 1 : 0);
+    }
+    else if(actvf == 2)
+    {
+        return static_cast<T>(std::exp(-x) / (1 + std::exp(-x)) / (1 + std::exp(-x)));
+    }
+
+    return static_cast<T>(1 / std::cosh(x) / std::cosh(x));
+}
+
+namespace rnn_cpu_detail {
+
+constexpr std::size_t tile_rows = 8;
+constexpr std::size_t tile_cols = 64;
+// Below this many multiply-adds the cost of spawning threads outweighs the GEMM itself,
+// which is the case for most recurrent steps of the small test networks.
+constexpr std::size_t parallel_threshold = std::size_t{1} << 18;
+
+template <class T>
+void gemm_tile(bool trans_a,
+               bool trans_b,
+               std::size_t i0,
+               std::size_t i1,
+               std::size_t j0,
+               std::size_t j1,
+               std::size_t k,
+               double alpha,
+               const T* a,
+               std::size_t lda,
+               const T* b,
+               std::size_t ldb,
+               double beta,
+               T* c,
+               std::size_t ldc)
+{
+    auto a_at = [&](std::size_t i, std::size_t p) {
+        return static_cast<double>(trans_a ? a[p * lda + i] : a[i * lda + p]);
+    };
+
+    std::array<double, tile_cols> acc;
+    for(std::size_t i = i0; i < i1; ++i)
+    {
+        std::fill(acc.begin(), acc.end(), 0.0);
+        if(trans_b)
+        {
+            // Rows of B are contiguous along k: plain dot products.
+            for(std::size_t j = j0; j < j1; ++j)
+            {
+                const T* b_row = b + j * ldb;
+                double sum     = 0.0;
+                if(trans_a)
+                {
+                    for(std::size_t p = 0; p < k; ++p)
+                        sum += a_at(i, p) * static_cast<double>(b_row[p]);
+                }
+                else
+                {
+                    const T* a_row = a + i * lda;
+                    for(std::size_t p = 0; p < k; ++p)
+                        sum += static_cast<double>(a_row[p]) * static_cast<double>(b_row[p]);
+                }
+                acc[j - j0] = sum;
+            }
+        }
+        else
+        {
+            // Rows of B are contiguous along n: accumulate a whole row of the tile at once.
+            for(std::size_t p = 0; p < k; ++p)
+            {
+                const double a_ip = a_at(i, p);
+                const T* b_row    = b + p * ldb;
+                for(std::size_t j = j0; j < j1; ++j)
+                    acc[j - j0] += a_ip * static_cast<double>(b_row[j]);
+            }
+        }
+
+        T* c_row = c + i * ldc;
+        for(std::size_t j = j0; j < j1; ++j)
+        {
+            const double prev = beta == 0.0 ? 0.0 : beta * static_cast<double>(c_row[j]);
+            c_row[j]          = static_cast<T>(prev + alpha * acc[j - j0]);
+        }
+    }
+}
+
+} // namespace rnn_cpu_detail
+
+/// Row-major C[m x n] = alpha * op(A)[m x k] * op(B)[k x n] + beta * C, accumulated in double.
+/// op(X) is X or its transpose as selected by trans_a/trans_b; lda/ldb/ldc are row strides of
+/// the stored matrices. C is not read when beta is zero. Large products are split into tiles
+/// that are computed in parallel unless `parallel` is false.
+template <class T>
+void rnn_cpu_gemm(bool trans_a,
+                  bool trans_b,
+                  std::size_t m,
+                  std::size_t n,
+                  std::size_t k,
+                  double alpha,
+                  const T* a,
+                  std::size_t lda,
+                  const T* b,
+                  std::size_t ldb,
+                  double beta,
+                  T* c,
+                  std::size_t ldc,
+                  bool parallel = true)
+{
+    using namespace rnn_cpu_detail;
+    if(m == 0 || n == 0)
+        return;
+
+    const std::size_t row_tiles = (m + tile_rows - 1) / tile_rows;
+    const std::size_t col_tiles = (n + tile_cols - 1) / tile_cols;
+    auto run_tile               = [&](std::size_t t) {
+        const std::size_t i0 = (t / col_tiles) * tile_rows;
+        const std::size_t j0 = (t % col_tiles) * tile_cols;
+        gemm_tile(trans_a,
+                  trans_b,
+                  i0,
+                  std::min(m, i0 + tile_rows),
+                  j0,
+                  std::min(n, j0 + tile_cols),
+                  k,
+                  alpha,
+                  a,
+                  lda,
+                  b,
+                  ldb,
+                  beta,
+                  c,
+                  ldc);
+    };
+
+    const std::size_t tiles = row_tiles * col_tiles;
+    if(!parallel || m * n * k < parallel_threshold || tiles == 1)
+    {
+        for(std::size_t t = 0; t < tiles; ++t)
+            run_tile(t);
+    }
+    else
+    {
+        miopen::par_for(tiles, 1, run_tile);
+    }
+}
+
+/// GEMM with the argument convention of the original host references: every matrix is given
+/// as (cols, rows, stride, flags) of its stored form and RNN_MM_TRANSPOSE in the flags selects
+/// the transposed operand.
+template <typename Dtype>
+void RNN_mm_cpu(const Dtype* a_ptr,
+                size_t a_cols,
+                size_t a_rows,
+                size_t a_stride,
+                int a_flags,
+                const Dtype* b_ptr,
+                size_t b_cols,
+                size_t b_rows,
+                size_t b_stride,
+                int b_flags,
+                Dtype* c_ptr,
+                size_t c_cols,
+                size_t c_rows,
+                size_t c_stride,
+                int /*c_flags*/,
+                double d_alpha,
+                double d_beta)
+{
+    const bool trans_a = (a_flags & RNN_MM_TRANSPOSE) != 0;
+    const bool trans_b = (b_flags & RNN_MM_TRANSPOSE) != 0;
+
+    const size_t op_a_rows = trans_a ? a_cols : a_rows;
+    const size_t op_a_cols = trans_a ? a_rows : a_cols;
+    const size_t op_b_rows = trans_b ? b_cols : b_rows;
+    const size_t op_b_cols = trans_b ? b_rows : b_cols;
+    if(op_a_cols != op_b_rows || op_a_rows != c_rows || op_b_cols != c_cols)
+    {
+        // A reference that silently skips a product would leave C stale and could still pass
+        // verification.
+        MIOPEN_THROW("RNN_mm_cpu: mismatched shapes A " + std::to_string(a_cols) + "x" +
+                     std::to_string(a_rows) + ", B " + std::to_string(b_cols) + "x" +
+                     std::to_string(b_rows) + ", C " + std::to_string(c_cols) + "x" +
+                     std::to_string(c_rows));
+    }
+
+    rnn_cpu_gemm(trans_a,
+                 trans_b,
+                 c_rows,
+                 c_cols,
+                 op_a_cols,
+                 d_alpha,
+                 a_ptr,
+                 a_stride,
+                 b_ptr,
+                 b_stride,
+                 d_beta,
+                 c_ptr,
+                 c_stride);
+}
+
+/// Dimensions of a network run by the host references, and the offsets of its weights and of
+/// the rows of its reserve space and workspace. `gates` is the number of gates of the cell and
+/// `row_states` the number of hy_h wide blocks a cell keeps per direction in a row of the
+/// reserve space. Time steps hold non-increasing numbers of rows.
+struct rnn_cpu_shape
+{
+    rnn_cpu_shape(const std::vector<int>& batches_,
+                  int seq_len_,
+                  int in_h_,
+                  int hy_d,
+                  int hy_n_,
+                  int hy_h_,
+                  bool bidirection,
+                  bool skip_input,
+                  int gates_,
+                  int row_states)
+        : batches(batches_.begin(), batches_.begin() + seq_len_),
+          offsets(seq_len_),
+          seq_len(seq_len_),
+          batch_n(sumvc(batches)),
+          bi(bidirection ? 2 : 1),
+          numlayer(hy_d / bi),
+          in_h(skip_input ? 0 : in_h_),
+          in_stride(in_h_),
+          hy_n(hy_n_),
+          hy_h(hy_h_),
+          gates(gates_),
+          stride(row_states * bi * hy_h_),
+          skip(skip_input)
+    {
+        if(skip_input && in_h_ != hy_h_)
+        {
+            MIOPEN_THROW("The input tensor size must equal to the hidden state size of the "
+                         "network in SKIP_INPUT mode");
+        }
+        std::partial_sum(batches.begin(), batches.end() - 1, offsets.begin() + 1);
+    }
+
+    std::vector<int> batches;
+    std::vector<int> offsets; // first row of every time step
+    int seq_len;
+    int batch_n;
+    int bi;
+    int numlayer;
+    int in_h; // width of the input weights, zero in SKIP_INPUT mode
+    int in_stride;
+    int hy_n;
+    int hy_h;
+    int gates;
+    int stride; // row stride of the reserve space and the workspace
+    bool skip;
+
+    int rows(int t) const { return t < 0 || t >= seq_len ? 0 : batches[t]; }
+    int gate_cols() const { return bi * gates * hy_h; }
+
+    std::size_t layer(int li) const { return std::size_t(li) * batch_n * stride; }
+    /// Start of the activated copy of the reserve space, and of the dropout states after it.
+    std::size_t activations() const { return layer(numlayer); }
+    std::size_t dropout_states() const { return 2 * activations(); }
+    std::size_t dropout_size() const { return std::size_t(numlayer - 1) * batch_n * hy_h * bi; }
+
+    std::size_t input_weights(int li) const
+    {
+        return li == 0 ? 0 : std::size_t(gate_cols()) * (in_h + hy_h + (li - 1) * (bi + 1) * hy_h);
+    }
+    /// gates blocks of hy_h x hy_h weights, one row per gate unit.
+    std::size_t hidden_weights(int li, int dir) const
+    {
+        return std::size_t(gate_cols()) * (in_h + li * (bi + 1) * hy_h) +
+               std::size_t(dir) * gates * hy_h * hy_h;
+    }
+    std::size_t bias(int li, bool hidden, int dir = 0) const
+    {
+        return std::size_t(gate_cols()) *
+                   (in_h + hy_h + (numlayer - 1) * (bi + 1) * hy_h + 2 * li + (hidden ? 1 : 0)) +
+               std::size_t(dir) * gates * hy_h;
+    }
+};
+
+/// Row `bs` of time step `t` of one direction of a layer, with the same row at the neighbouring
+/// steps of that direction (the reverse direction runs from the last time step to the first).
+/// Offsets index the reserve space and the workspace, except `state` that indexes the hidden
+/// and cell state tensors.
+struct rnn_cpu_row
+{
+    rnn_cpu_row(const rnn_cpu_shape& s, int li, int dir_, int t, int bs)
+        : dir(dir_),
+          at(s.layer(li) + std::size_t(s.offsets[t] + bs) * s.stride),
+          state((std::size_t(li * s.bi + dir_) * s.hy_n + bs) * s.hy_h)
+    {
+        const int t_prev = dir == 0 ? t - 1 : t + 1;
+        const int t_next = dir == 0 ? t + 1 : t - 1;
+        has_prev         = bs < s.rows(t_prev);
+        has_next         = bs < s.rows(t_next);
+        if(has_prev)
+            prev = s.layer(li) + std::size_t(s.offsets[t_prev] + bs) * s.stride;
+        if(has_next)
+            next = s.layer(li) + std::size_t(s.offsets[t_next] + bs) * s.stride;
+    }
+
+    int dir;
+    std::size_t at;
+    std::size_t state;
+    std::size_t prev = 0;
+    std::size_t next = 0;
+    bool has_prev    = false;
+    bool has_next    = false;
+};
+
+namespace rnn_cpu_detail {
+
+// Multiply-adds a thread has to get out of one time step before it is worth starting.
+constexpr std::size_t step_grain = std::size_t{1} << 14;
+
+// Calls f(row) for the rows of both directions at one step of the recurrence, spreading them
+// over threads. The rows of a step only read rows of earlier steps and write disjoint
+// elements, so the results do not depend on the split.
+template <class F>
+void for_step(const rnn_cpu_shape& s, int li, int step, bool backward, std::size_t row_cost, F f)
+{
+    const int t0 = backward ? s.seq_len - 1 - step : step;
+    const int t1 = s.seq_len - 1 - t0;
+    const int n0 = s.rows(t0);
+    const int n  = n0 + (s.bi == 2 ? s.rows(t1) : 0);
+    const std::size_t grain =
+        std::max<std::size_t>(1, step_grain / std::max<std::size_t>(1, row_cost));
+    miopen::par_for(n, grain, [&](std::size_t i) {
+        const int r = static_cast<int>(i);
+        if(r < n0)
+            f(rnn_cpu_row{s, li, 0, t0, r});
+        else
+            f(rnn_cpu_row{s, li, 1, t1, r - n0});
+    });
+}
+
+} // namespace rnn_cpu_detail
+
+/// dst[0, hy_h) += h[0, hy_h) * w^T for one gate block w of hidden weights: the contribution of
+/// a hidden state to one gate. Runs on the calling thread.
+template <class T>
+void rnn_cpu_row_project(int hy_h, const T* h, const T* w, T* dst)
+{
+    rnn_cpu_gemm(false, true, 1, hy_h, hy_h, 1.0, h, hy_h, w, hy_h, 1.0, dst, hy_h, false);
+}
+
+/// dst[0, hy_h) += g[0, k) * w for k rows of hidden weights: the gradient a row of gate
+/// gradients sends back to the hidden state. Runs on the calling thread.
+template <class T>
+void rnn_cpu_row_backprop(int hy_h, int k, const T* g, const T* w, T* dst)
+{
+    rnn_cpu_gemm(false, false, 1, hy_h, k, 1.0, g, k, w, hy_h, 1.0, dst, hy_h, false);
+}
+
+// The step loops below are shared by the three references; a cell policy supplies the
+// pointwise part. A Cell provides
+//
+//   const rnn_cpu_shape& shape;
+//   static constexpr bool cell_state;   // whether it carries a cell state next to the hidden
+//   std::size_t h_offset, c_offset;     // hidden and cell state of a reserve row (direction 0)
+//   std::size_t dh_offset, dc_offset;   // their gradients in a workspace row
+//   std::size_t hidden_slot(int dir, int gate) const;
+//       where the hidden-state product of a gate is accumulated in a reserve row
+//   void forward(std::vector<T>& rsv, const rnn_cpu_row& r, const T* h0, const T* c0) const;
+//       turns the gate inputs of a row into its states and stores the activations
+//   void backward(std::vector<T>& wk, std::vector<T>& rsv, const rnn_cpu_row& r,
+//                 const T* h0, const T* c0) const;
+//       turns the state gradients of a row into gate gradients
+//   void carry(const std::vector<T>& wk, const std::vector<T>& rsv, const std::vector<T>& wei,
+//              std::size_t from, int li, int dir, T* dh, T* dc) const;
+//       adds the gradient the step at `from` sends to the states it started from
+//   T weight_grad(const std::vector<T>& wk, const std::vector<T>& rsv, std::size_t at, int dir,
+//                 int unit) const;
+//       the gradient of a row paired with the hidden state in the hidden weight gradient
+//
+// h0 and c0 are the states a row starts from (the previous step, the initial states, or
+// nullptr when there are none); offsets are relative to the start of a row.
+
+template <class T, class Cell, class Dropout>
+void rnn_cpu_forward(const Cell& cell,
+                     bool biased,
+                     bool use_dropout,
+                     Dropout& dropout,
+                     const std::vector<T>& in,
+                     const std::vector<T>& wei,
+                     const T* hx,
+                     const T* cx,
+                     std::vector<T>& hy,
+                     T* cy,
+                     std::vector<T>& out,
+                     std::vector<T>& rsv)
+{
+    const rnn_cpu_shape& s = cell.shape;
+    const int hy_h         = s.hy_h;
+    const int cols         = s.gate_cols();
+
+    std::fill(rsv.begin(), rsv.end(), static_cast<T>(0));
+    std::fill(hy.begin(), hy.end(), static_cast<T>(0));
+
+    std::vector<unsigned char> dropout_mask;
+    std::vector<T> dropout_hid_state;
+    if(use_dropout)
+    {
+        dropout_mask.assign(s.dropout_size(), static_cast<unsigned char>(1));
+        dropout_hid_state.assign(s.dropout_size(), static_cast<T>(0));
+    }
+
+    for(int li = 0; li < s.numlayer; li++)
+    {
+        const std::size_t layer = s.layer(li);
+
+        // input of all time steps
+        if(li == 0 && s.skip)
+        {
+            for(int bs = 0; bs < s.batch_n; bs++)
+            {
+                for(int h = 0; h < hy_h; h++)
+                {
+                    for(int gi = 0; gi < s.gates * s.bi; gi++)
+                        rsv[layer + bs * s.stride + gi * hy_h + h] += in[bs * s.in_stride + h];
+                }
+            }
+        }
+        else if(li == 0)
+        {
+            rnn_cpu_gemm(
+                false, true, s.batch_n, cols, s.in_h, 1.0, in.data(), s.in_h, wei.data(), s.in_h,
+                1.0, &rsv[layer], s.stride);
+        }
+        else
+        {
+            const T* x     = &rsv[s.layer(li - 1) + cell.h_offset];
+            std::size_t ldx = s.stride;
+            if(use_dropout)
+            {
+                const std::size_t offset = std::size_t(li - 1) * s.batch_n * hy_h * s.bi;
+                dropout.forward(s.batch_n,
+                                hy_h * s.bi,
+                                rsv,
+                                s.layer(li - 1) + cell.h_offset,
+                                s.stride,
+                                dropout_hid_state,
+                                offset,
+                                hy_h * s.bi,
+                                dropout_mask,
+                                offset);
+                x   = &dropout_hid_state[offset];
+                ldx = hy_h * s.bi;
+            }
+            rnn_cpu_gemm(false,
+                         true,
+                         s.batch_n,
+                         cols,
+                         hy_h * s.bi,
+                         1.0,
+                         x,
+                         ldx,
+                         &wei[s.input_weights(li)],
+                         hy_h * s.bi,
+                         1.0,
+                         &rsv[layer],
+                         s.stride);
+        }
+
+        if(biased)
+        {
+            for(int bs = 0; bs < s.batch_n; bs++)
+            {
+                for(int h = 0; h < cols; h++)
+                    rsv[layer + bs * s.stride + h] += wei[s.bias(li, false) + h];
+            }
+        }
+
+        // recurrence
+        for(int step = 0; step < s.seq_len; step++)
+        {
+            const std::size_t row_cost = std::size_t(s.gates) * hy_h * hy_h;
+            rnn_cpu_detail::for_step(s, li, step, false, row_cost, [&](const rnn_cpu_row& r) {
+                const std::size_t h_at = cell.h_offset + r.dir * hy_h;
+                const std::size_t c_at = cell.c_offset + r.dir * hy_h;
+
+                const T* h0 = r.has_prev ? &rsv[r.prev + h_at] : hx ? hx + r.state : nullptr;
+                const T* c0 = !Cell::cell_state ? nullptr
+                              : r.has_prev      ? &rsv[r.prev + c_at]
+                              : cx              ? cx + r.state
+                                                : nullptr;
+
+                // Rows that start without a hidden state get neither the product nor its bias.
+                if(h0 != nullptr)
+                {
+                    for(int gi = 0; gi < s.gates; gi++)
+                    {
+                        T* dst = &rsv[r.at + cell.hidden_slot(r.dir, gi)];
+                        rnn_cpu_row_project(
+                            hy_h, h0, &wei[s.hidden_weights(li, r.dir) + gi * hy_h * hy_h], dst);
+                        if(biased)
+                        {
+                            const T* b = &wei[s.bias(li, true, r.dir) + gi * hy_h];
+                            for(int h = 0; h < hy_h; h++)
+                                dst[h] += b[h];
+                        }
+                    }
+                }
+
+                cell.forward(rsv, r, h0, c0);
+
+                std::copy_n(&rsv[r.at + h_at], hy_h, &hy[r.state]);
+                if(Cell::cell_state)
+                    std::copy_n(&rsv[r.at + c_at], hy_h, cy + r.state);
+            });
+        }
+    }
+
+    // output
+    const std::size_t last = s.layer(s.numlayer - 1) + cell.h_offset;
+    for(int bs = 0; bs < s.batch_n; bs++)
+        std::copy_n(&rsv[last + bs * s.stride], hy_h * s.bi, &out[bs * hy_h * s.bi]);
+
+    if(use_dropout)
+    {
+        std::copy(dropout_hid_state.begin(),
+                  dropout_hid_state.end(),
+                  rsv.begin() + s.dropout_states());
+        auto p_drop_rsv =
+            reinterpret_cast<unsigned char*>(&rsv.at(s.dropout_states() + s.dropout_size()));
+        std::copy(dropout_mask.begin(), dropout_mask.end(), p_drop_rsv);
+    }
+}
+
+template <class T, class Cell, class Dropout>
+void rnn_cpu_backward_data(const Cell& cell,
+                           bool use_dropout,
+                           Dropout& dropout,
+                           const std::vector<T>& wei,
+                           const std::vector<T>& dout,
+                           const T* hx,
+                           const T* cx,
+                           const T* dhy,
+                           const T* dcy,
+                           std::vector<T>& dhx,
+                           T* dcx,
+                           std::vector<T>& din,
+                           std::vector<T>& rsv,
+                           std::vector<T>& wk)
+{
+    const rnn_cpu_shape& s = cell.shape;
+    const int hy_h         = s.hy_h;
+    const int cols         = s.gate_cols();
+
+    std::fill(din.begin(), din.end(), static_cast<T>(0));
+    std::fill(dhx.begin(), dhx.end(), static_cast<T>(0));
+    std::fill(wk.begin(), wk.end(), static_cast<T>(0));
+
+    std::vector<unsigned char> dropout_mask;
+    if(use_dropout)
+    {
+        auto p_drop_rsv =
+            reinterpret_cast<unsigned char*>(&rsv.at(s.dropout_states() + s.dropout_size()));
+        dropout_mask.assign(p_drop_rsv, p_drop_rsv + s.dropout_size());
+    }
+
+    for(int li = s.numlayer - 1; li >= 0; li--)
+    {
+        const std::size_t layer = s.layer(li);
+
+        // gradient of the hidden states from the output or the layer above
+        if(li == s.numlayer - 1)
+        {
+            for(int bs = 0; bs < s.batch_n; bs++)
+            {
+                for(int h = 0; h < hy_h * s.bi; h++)
+                    wk[layer + cell.dh_offset + bs * s.stride + h] += dout[bs * hy_h * s.bi + h];
+            }
+        }
+        else
+        {
+            rnn_cpu_gemm(false,
+                         false,
+                         s.batch_n,
+                         hy_h * s.bi,
+                         cols,
+                         1.0,
+                         &wk[s.layer(li + 1)],
+                         s.stride,
+                         &wei[s.input_weights(li + 1)],
+                         hy_h * s.bi,
+                         1.0,
+                         &wk[layer + cell.dh_offset],
+                         s.stride);
+
+            if(use_dropout)
+            {
+                dropout.backward(s.batch_n,
+                                 hy_h * s.bi,
+                                 wk,
+                                 layer + cell.dh_offset,
+                                 s.stride,
+                                 wk,
+                                 layer + cell.dh_offset,
+                                 s.stride,
+                                 dropout_mask,
+                                 std::size_t(li) * s.batch_n * hy_h * s.bi);
+            }
+        }
+
+        // recurrence, from the last step of each direction to its first
+        for(int step = 0; step < s.seq_len; step++)
+        {
+            const std::size_t row_cost = std::size_t(2) * s.gates * hy_h * hy_h;
+            rnn_cpu_detail::for_step(s, li, step, true, row_cost, [&](const rnn_cpu_row& r) {
+                const std::size_t h_at = cell.h_offset + r.dir * hy_h;
+                const std::size_t c_at = cell.c_offset + r.dir * hy_h;
+
+                T* dh = &wk[r.at + cell.dh_offset + r.dir * hy_h];
+                T* dc = Cell::cell_state ? &wk[r.at + cell.dc_offset + r.dir * hy_h] : nullptr;
+                if(r.has_next)
+                {
+                    cell.carry(wk, rsv, wei, r.next, li, r.dir, dh, dc);
+                }
+                else
+                {
+                    if(dhy != nullptr)
+                    {
+                        for(int h = 0; h < hy_h; h++)
+                            dh[h] += dhy[r.state + h];
+                    }
+                    if(dc != nullptr && dcy != nullptr)
+                    {
+                        for(int h = 0; h < hy_h; h++)
+                            dc[h] += dcy[r.state + h];
+                    }
+                }
+
+                const T* h0 = r.has_prev ? &rsv[r.prev + h_at] : hx ? hx + r.state : nullptr;
+                const T* c0 = !Cell::cell_state ? nullptr
+                              : r.has_prev      ? &rsv[r.prev + c_at]
+                              : cx              ? cx + r.state
+                                                : nullptr;
+                cell.backward(wk, rsv, r, h0, c0);
+
+                if(!r.has_prev)
+                {
+                    cell.carry(wk,
+                               rsv,
+                               wei,
+                               r.at,
+                               li,
+                               r.dir,
+                               &dhx[r.state],
+                               Cell::cell_state ? dcx + r.state : nullptr);
+                }
+            });
+        }
+    }
+
+    // dinput
+    if(s.skip)
+    {
+        for(int bs = 0; bs < s.batch_n; bs++)
+        {
+            for(int h = 0; h < hy_h; h++)
+            {
+                for(int gi = 0; gi < s.gates; gi++)
+                {
+                    for(int dir = 0; dir < s.bi; dir++)
+                        din[bs * s.in_stride + h] +=
+                            wk[bs * s.stride + (dir * s.gates + gi) * hy_h + h];
+                }
+            }
+        }
+    }
+    else
+    {
+        rnn_cpu_gemm(false,
+                     false,
+                     s.batch_n,
+                     s.in_h,
+                     cols,
+                     1.0,
+                     wk.data(),
+                     s.stride,
+                     wei.data(),
+                     s.in_h,
+                     1.0,
+                     din.data(),
+                     s.in_h);
+    }
+}
+
+template <class T, class Cell>
+void rnn_cpu_backward_weights(const Cell& cell,
+                              bool biased,
+                              bool use_dropout,
+                              const std::vector<T>& in,
+                              std::vector<T>& dwei,
+                              const T* hx,
+                              const std::vector<T>& rsv,
+                              const std::vector<T>& wk)
+{
+    const rnn_cpu_shape& s = cell.shape;
+    const int hy_h         = s.hy_h;
+    const int cols         = s.gate_cols();
+
+    std::fill(dwei.begin(), dwei.end(), static_cast<T>(0));
+
+    for(int li = 0; li < s.numlayer; li++)
+    {
+        const std::size_t layer = s.layer(li);
+
+        // input weights, over all time steps at once
+        if(li == 0 && !s.skip)
+        {
+            rnn_cpu_gemm(true,
+                         false,
+                         cols,
+                         s.in_h,
+                         s.batch_n,
+                         1.0,
+                         wk.data(),
+                         s.stride,
+                         in.data(),
+                         s.in_h,
+                         1.0,
+                         dwei.data(),
+                         s.in_h);
+        }
+        else if(li > 0)
+        {
+            rnn_cpu_gemm(true,
+                         false,
+                         cols,
+                         hy_h * s.bi,
+                         s.batch_n,
+                         1.0,
+                         &wk[layer],
+                         s.stride,
+                         use_dropout ? &rsv[s.dropout_states() + std::size_t(li - 1) *
+                                                                      s.batch_n * hy_h * s.bi]
+                                     : &rsv[s.layer(li - 1) + cell.h_offset],
+                         use_dropout ? hy_h * s.bi : s.stride,
+                         1.0,
+                         &dwei[s.input_weights(li)],
+                         hy_h * s.bi);
+        }
+
+        if(biased)
+        {
+            for(int h = 0; h < cols; h++)
+            {
+                for(int w = 0; w < s.batch_n; w++)
+                    dwei[s.bias(li, false) + h] += wk[layer + w * s.stride + h];
+            }
+        }
+
+        // Hidden weights: every gate unit owns a row of the gradient and sums over the time
+        // steps in order, first the rows starting from the initial state and then the rows
+        // continuing from the previous step, so units run in parallel without changing the
+        // order of the sums.
+        const int units = s.gates * hy_h;
+        miopen::par_for(s.bi * units, 1, [&](std::size_t i) {
+            const int dir  = static_cast<int>(i) / units;
+            const int unit = static_cast<int>(i) % units;
+            T* dw          = &dwei[s.hidden_weights(li, dir) + std::size_t(unit) * hy_h];
+            T* db          = &dwei[s.bias(li, true, dir) + unit];
+            std::vector<double> acc(hy_h);
+
+            for(int t = 0; t < s.seq_len; t++)
+            {
+                for(int from_prev = 0; from_prev < 2; from_prev++)
+                {
+                    std::fill(acc.begin(), acc.end(), 0.0);
+                    bool any = false;
+                    for(int bs = 0; bs < s.rows(t); bs++)
+                    {
+                        const rnn_cpu_row r{s, li, dir, t, bs};
+                        if(r.has_prev != (from_prev == 1) || (!r.has_prev && hx == nullptr))
+                            continue;
+                        const T* h0 = r.has_prev ? &rsv[r.prev + cell.h_offset + dir * hy_h]
+                                                 : hx + r.state;
+                        const T g   = cell.weight_grad(wk, rsv, r.at, dir, unit);
+                        for(int p = 0; p < hy_h; p++)
+                            acc[p] += static_cast<double>(g) * static_cast<double>(h0[p]);
+                        any = true;
+                    }
+                    if(!any)
+                        continue;
+                    for(int p = 0; p < hy_h; p++)
+                        dw[p] = static_cast<T>(static_cast<double>(dw[p]) + acc[p]);
+                    if(biased)
+                    {
+                        for(int bs = 0; bs < s.rows(t); bs++)
+                        {
+                            const rnn_cpu_row r{s, li, dir, t, bs};
+                            if(r.has_prev == (from_prev == 1) && (r.has_prev || hx != nullptr))
+                                *db += cell.weight_grad(wk, rsv, r.at, dir, unit);
+                        }
+                    }
+                }
+            }
+        });
+    }
+}
+
+#endif // GUARD_CPU_RNN_HPP
@@ -0,0 +1,243 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_CPU_RNN_VANILLA_HPP
+#define GUARD_CPU_RNN_VANILLA_HPP
+
+#include "cpu_rnn.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+// Host reference of the vanilla RNN: forward (training and inference), backward data and
+// backward weights. The squash argument selects the activation as in activfunc().
+
+/// Cell policy of the vanilla RNN for the step loops in cpu_rnn.hpp. A direction has a single
+/// gate holding the input of the activation; the hidden state is its activated copy.
+template <typename T>
+struct rnn_cpu_vanilla_cell
+{
+    static constexpr bool cell_state = false;
+
+    rnn_cpu_vanilla_cell(const rnn_cpu_shape& shape_, int squash_)
+        : shape(shape_), squash(squash_), h_offset(shape_.activations())
+    {
+    }
+
+    const rnn_cpu_shape& shape;
+    int squash;
+    std::size_t h_offset;
+    std::size_t c_offset  = 0;
+    std::size_t dh_offset = 0;
+    std::size_t dc_offset = 0;
+
+    std::size_t hidden_slot(int dir, int) const { return std::size_t(dir) * shape.hy_h; }
+
+    void forward(std::vector<T>& rsv, const rnn_cpu_row& r, const T*, const T*) const
+    {
+        const std::size_t x = r.at + r.dir * shape.hy_h;
+        for(int h = 0; h < shape.hy_h; h++)
+            rsv[x + shape.activations() + h] = activfunc(rsv[x + h], squash);
+    }
+
+    void backward(std::vector<T>& wk,
+                  std::vector<T>& rsv,
+                  const rnn_cpu_row& r,
+                  const T*,
+                  const T*) const
+    {
+        const std::size_t x = r.at + r.dir * shape.hy_h;
+        for(int h = 0; h < shape.hy_h; h++)
+            wk[x + h] *= dervactivfunc(rsv[x + h], squash);
+    }
+
+    void carry(const std::vector<T>& wk,
+               const std::vector<T>&,
+               const std::vector<T>& wei,
+               std::size_t from,
+               int li,
+               int dir,
+               T* dh,
+               T*) const
+    {
+        rnn_cpu_row_backprop(shape.hy_h,
+                             shape.hy_h,
+                             &wk[from + dir * shape.hy_h],
+                             &wei[shape.hidden_weights(li, dir)],
+                             dh);
+    }
+
+    T weight_grad(
+        const std::vector<T>& wk, const std::vector<T>&, std::size_t at, int dir, int unit) const
+    {
+        return wk[at + dir * shape.hy_h + unit];
+    }
+};
+
+template <typename T, typename Dropout>
+void RNNFwdTrainCPUVerify(bool use_dropout,
+                          Dropout&& dropout,
+                          std::vector<T>& in,
+                          std::vector<T>& wei,     // [ input_state_weight_trans
+                                                   // hidden_state_weight0_trans input1_trans
+                                                   // hidden1_trans ... output_weight;
+                                                   // bidirectional reversed weights ]
+                          std::vector<T>& hy_host, // current/final hidden state
+                          std::vector<T>& hx,      // initial hidden state
+                          std::vector<T>& out_host,
+                          std::vector<int>& in_n, // input batch size
+                          int in_h,               // input data length
+                          int seqLength,          // Number of iterations to unroll over
+                          int bidirection,        // whether using bidirectional net
+                          int biased,             // whether using bias
+                          int hy_d,  // 1 by numlayer (number of stacks of hidden layers) for
+                                     // unidirection, 2 by numlayer for bidirection
+                          int hy_n,  // equal to input batch size in_n[0]
+                          int hy_h,  // hidden state number
+                          int out_h, // 1 by hy_h related function for unidirection, 2 by hy_h
+                                     // related function for bidirection
+                          int squash,
+                          int inputMode,
+                          std::vector<T>& rsvspace,
+                          bool hx_is_null = false)
+{
+    (void)out_h;
+
+    const rnn_cpu_shape shape{
+        in_n, seqLength, in_h, hy_d, hy_n, hy_h, bidirection != 0, inputMode == 1, 1, 1};
+    const rnn_cpu_vanilla_cell<T> cell{shape, squash};
+    rnn_cpu_forward<T>(cell,
+                       biased != 0,
+                       use_dropout,
+                       dropout,
+                       in,
+                       wei,
+                       hx_is_null ? nullptr : hx.data(),
+                       nullptr,
+                       hy_host,
+                       nullptr,
+                       out_host,
+                       rsvspace);
+}
+
+template <typename T, typename Dropout>
+void RNNBwdDataCPUVerify(bool use_dropout,
+                         Dropout&& dropout,
+                         std::vector<T>& din_host,
+                         std::vector<T>& wei, // [ input_state_weight_trans
+                                              // hidden_state_weight0_trans input1_trans
+                                              // hidden1_trans ... output_weight;
+                                              // bidirectional reversed weights ]
+                         std::vector<T>& dhy, // current/final hidden state
+                         std::vector<T>& dhx_host,
+                         std::vector<T>& hx, // initial hidden state
+                         std::vector<T>& out,
+                         std::vector<T>& dout,
+                         std::vector<int>& in_n, // input batch size
+                         int in_h,               // input data length
+                         int seqLength,          // Number of iterations to unroll over
+                         int bidirection,        // whether using bidirectional net
+                         int,                    // whether using bias
+                         int hy_d,  // 1 by numlayer (number of stacks of hidden layers)
+                                    // for unidirection, 2 by numlayer for bidirection
+                         int hy_n,  // equal to input batch size in_n[0]
+                         int hy_h,  // hidden state number
+                         int out_h, // 1 by hy_h related function for unidirection, 2 by
+                                    // hy_h related function for bidirection
+                         int squash,
+                         int inputMode,
+                         std::vector<T>& rsvspace,
+                         std::vector<T>& wkspace,
+                         bool dhy_is_null = false)
+{
+    (void)hx;
+    (void)out;
+    (void)out_h;
+
+    const rnn_cpu_shape shape{
+        in_n, seqLength, in_h, hy_d, hy_n, hy_h, bidirection != 0, inputMode == 1, 1, 1};
+    const rnn_cpu_vanilla_cell<T> cell{shape, squash};
+    rnn_cpu_backward_data<T>(cell,
+                             use_dropout,
+                             dropout,
+                             wei,
+                             dout,
+                             nullptr,
+                             nullptr,
+                             dhy_is_null ? nullptr : dhy.data(),
+                             nullptr,
+                             dhx_host,
+                             nullptr,
+                             din_host,
+                             rsvspace,
+                             wkspace);
+}
+
+template <typename T>
+void RNNBwdWeightCPUVerify(bool use_dropout,
+                           std::vector<T>& in,
+                           std::vector<T>& dwei_host, // [ input_state_weight_trans
+                                                      // hidden_state_weight0_trans
+                                                      // input1_trans hidden1_trans ...
+                                                      // output_weight; bidirectional
+                                                      // reversed weights ]
+                           std::vector<T>& hx,        // initial hidden state
+                           std::vector<T>& dout,
+                           std::vector<int>& in_n, // input batch size
+                           int in_h,               // input data length
+                           int seqLength,          // Number of iterations to unroll over
+                           bool bidirection,       // whether using bidirectional net
+                           bool biased,            // whether using bias
+                           int hy_d,               // 1 by numlayer (number of stacks of hidden
+                                                   // layers) for unidirection, 2 by numlayer for
+                                                   // bidirection
+                           int hy_n,               // equal to input batch size in_n[0]
+                           int hy_h,               // hidden state number
+                           int out_h,              // 1 by hy_h related function for unidirection, 2
+                                                   // by hy_h related function for bidirection
+                           int squash,
+                           int inputMode,
+                           std::vector<T>& rsvspace,
+                           std::vector<T>& wkspace,
+                           bool hx_is_null = false)
+{
+    (void)out_h;
+    (void)dout;
+
+    const rnn_cpu_shape shape{
+        in_n, seqLength, in_h, hy_d, hy_n, hy_h, bidirection, inputMode == 1, 1, 1};
+    const rnn_cpu_vanilla_cell<T> cell{shape, squash};
+    rnn_cpu_backward_weights<T>(cell,
+                                biased,
+                                use_dropout,
+                                in,
+                                dwei_host,
+                                hx_is_null ? nullptr : hx.data(),
+                                rsvspace,
+                                wkspace);
+}
+
+#endif // GUARD_CPU_RNN_VANILLA_HPP
@@ -0,0 +1,172 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_CPU_SOFTMAX_HPP
+#define GUARD_CPU_SOFTMAX_HPP
+
+#include <miopen/miopen.h>
+#include <miopen/par_for.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+// Host reference for softmax shared by the tests and MIOpenDriver.
+//
+// Tensors are NCHW-indexed with arbitrary strides. Channel mode is computed one (n, h) row at
+// a time with all W positions of the row reduced side by side, so the inner loops run along
+// the contiguous dimension instead of striding over channels. Instance mode reduces each
+// image separately. Both are parallel over the outer dimension and accumulate in double.
+
+using softmax_cpu_dims = std::array<std::size_t, 4>;
+
+namespace softmax_cpu_detail {
+
+inline std::size_t offset(const softmax_cpu_dims& strides,
+                          std::size_t n,
+                          std::size_t c,
+                          std::size_t h,
+                          std::size_t w)
+{
+    return n * strides[0] + c * strides[1] + h * strides[2] + w * strides[3];
+}
+
+// Calls f(lanes, for_each) for every independent reduction block: in channel mode a block is
+// one (n, h) row whose W lanes are each reduced over C; in instance mode it is one image
+// reduced as a single lane. for_each(g) calls g(lane, n, c, h, w) for each element of the block.
+template <class F>
+void for_each_block(const softmax_cpu_dims& lens, miopenSoftmaxMode_t mode, F f)
+{
+    const auto n = lens[0], c = lens[1], h = lens[2], w = lens[3];
+    if(mode == MIOPEN_SOFTMAX_MODE_CHANNEL)
+    {
+        miopen::par_for(n * h, 1, [&](std::size_t row) {
+            const auto in = row / h;
+            const auto ih = row % h;
+            f(w, [&](auto g) {
+                for(std::size_t ic = 0; ic < c; ++ic)
+                    for(std::size_t iw = 0; iw < w; ++iw)
+                        g(iw, in, ic, ih, iw);
+            });
+        });
+    }
+    else
+    {
+        miopen::par_for(n, 1, [&](std::size_t in) {
+            f(1, [&](auto g) {
+                for(std::size_t ic = 0; ic < c; ++ic)
+                    for(std::size_t ih = 0; ih < h; ++ih)
+                        for(std::size_t iw = 0; iw < w; ++iw)
+                            g(0, in, ic, ih, iw);
+            });
+        });
+    }
+}
+
+} // namespace softmax_cpu_detail
+
+/// y = alpha * softmax(x) + beta * y. y is not read when beta is zero.
+template <class Tx, class Ty>
+void softmax_cpu_forward(const softmax_cpu_dims& lens,
+                         const Tx* x,
+                         const softmax_cpu_dims& x_strides,
+                         Ty* y,
+                         const softmax_cpu_dims& y_strides,
+                         double alpha,
+                         double beta,
+                         miopenSoftmaxAlgorithm_t algo,
+                         miopenSoftmaxMode_t mode)
+{
+    using softmax_cpu_detail::offset;
+    softmax_cpu_detail::for_each_block(lens, mode, [&](std::size_t lanes, auto for_each) {
+        std::vector<double> max_v(lanes, algo == MIOPEN_SOFTMAX_FAST
+                                             ? 0.0
+                                             : std::numeric_limits<double>::lowest());
+        std::vector<double> sum(lanes, 0.0);
+
+        if(algo != MIOPEN_SOFTMAX_FAST)
+        {
+            for_each([&](std::size_t l, auto n, auto c, auto h, auto w) {
+                max_v[l] =
+                    std::max(max_v[l], static_cast<double>(x[offset(x_strides, n, c, h, w)]));
+            });
+        }
+        for_each([&](std::size_t l, auto n, auto c, auto h, auto w) {
+            sum[l] += std::exp(static_cast<double>(x[offset(x_strides, n, c, h, w)]) - max_v[l]);
+        });
+        if(algo == MIOPEN_SOFTMAX_LOG)
+        {
+            for(auto& s : sum)
+                s = std::log(s);
+        }
+
+        for_each([&](std::size_t l, auto n, auto c, auto h, auto w) {
+            const double v    = static_cast<double>(x[offset(x_strides, n, c, h, w)]) - max_v[l];
+            const double r    = algo == MIOPEN_SOFTMAX_LOG ? v - sum[l] : std::exp(v) / sum[l];
+            auto& out         = y[offset(y_strides, n, c, h, w)];
+            const double prev = beta == 0.0 ? 0.0 : beta * static_cast<double>(out);
+            out               = static_cast<Ty>(alpha * r + prev);
+        });
+    });
+}
+
+/// dx = alpha * dsoftmax(y, dy) + beta * dx. dx is not read when beta is zero.
+template <class Ty, class Tdx>
+void softmax_cpu_backward(const softmax_cpu_dims& lens,
+                          const Ty* y,
+                          const softmax_cpu_dims& y_strides,
+                          const Ty* dy,
+                          const softmax_cpu_dims& dy_strides,
+                          Tdx* dx,
+                          const softmax_cpu_dims& dx_strides,
+                          double alpha,
+                          double beta,
+                          miopenSoftmaxAlgorithm_t algo,
+                          miopenSoftmaxMode_t mode)
+{
+    using softmax_cpu_detail::offset;
+    const bool log = algo == MIOPEN_SOFTMAX_LOG;
+    softmax_cpu_detail::for_each_block(lens, mode, [&](std::size_t lanes, auto for_each) {
+        std::vector<double> dot(lanes, 0.0);
+        for_each([&](std::size_t l, auto n, auto c, auto h, auto w) {
+            const double dyv = static_cast<double>(dy[offset(dy_strides, n, c, h, w)]);
+            dot[l] += log ? dyv : dyv * static_cast<double>(y[offset(y_strides, n, c, h, w)]);
+        });
+
+        for_each([&](std::size_t l, auto n, auto c, auto h, auto w) {
+            const double yv   = static_cast<double>(y[offset(y_strides, n, c, h, w)]);
+            const double dyv  = static_cast<double>(dy[offset(dy_strides, n, c, h, w)]);
+            const double r    = log ? dyv - dot[l] * std::exp(yv) : yv * (dyv - dot[l]);
+            auto& out         = dx[offset(dx_strides, n, c, h, w)];
+            const double prev = beta == 0.0 ? 0.0 : beta * static_cast<double>(out);
+            out               = static_cast<Tdx>(alpha * r + prev);
+        });
+    });
+}
+
+#endif // GUARD_CPU_SOFTMAX_HPP
@@ -0,0 +1,86 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "dropout_util.hpp"
+#include "get_handle.hpp"
+#include "test.hpp"
+
+#include <miopen/dropout.hpp>
+#include <miopen/handle.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+// The PRNG states are initialized by one kernel whose seed and state count are arguments.
+// Every combination must produce exactly the states of the host emulator, including state
+// counts beyond one grid, which the kernel covers by striding.
+
+std::vector<prngStates> init_states_gpu(const miopen::DropoutDescriptor& desc)
+{
+    auto&& handle    = get_handle();
+    const auto count = desc.stateSizeInBytes / sizeof(prngStates);
+    auto states_dev  = handle.Create<prngStates>(count);
+    desc.InitPRNGState(handle, states_dev.get(), desc.stateSizeInBytes, desc.seed);
+    return handle.Read<prngStates>(states_dev, count);
+}
+
+std::vector<prngStates> init_states_cpu(const miopen::DropoutDescriptor& desc)
+{
+    const auto count   = desc.stateSizeInBytes / sizeof(prngStates);
+    const auto grid_sz = std::min<std::size_t>(MAX_PRNG_STATE, (count + 255) / 256 * 256);
+    // The emulator fills whole grids
+    std::vector<prngStates> states((count + grid_sz - 1) / grid_sz * grid_sz);
+    InitKernelStateEmulator(states, desc);
+    states.resize(count);
+    return states;
+}
+
+bool same_states(const std::vector<prngStates>& a, const std::vector<prngStates>& b)
+{
+    return a.size() == b.size() &&
+           std::memcmp(a.data(), b.data(), a.size() * sizeof(prngStates)) == 0;
+}
+
+int main()
+{
+    for(std::size_t count : {1, 300, MAX_PRNG_STATE + 37})
+    {
+        std::vector<prngStates> previous;
+        for(unsigned long long seed : {0ULL, 42ULL, 0xfedcba9876543210ULL})
+        {
+            miopen::DropoutDescriptor desc;
+            desc.seed             = seed;
+            desc.stateSizeInBytes = count * sizeof(prngStates);
+
+            const auto gpu = init_states_gpu(desc);
+            EXPECT(same_states(gpu, init_states_cpu(desc)));
+            EXPECT(!same_states(gpu, previous));
+            previous = gpu;
+        }
+    }
+}
@@ -36,7 +36,10 @@
 #include <memory>
 #include <utility>
 
+#include "ford.hpp"
+
 #include <miopen/dropout.hpp>
+#include <miopen/float_equal.hpp>
 #include <miopen/miopen.h>
 #include <miopen/tensor.hpp>
 #include <miopen/precalc_xorwow_skipahead_matrices.hpp>
@@ -231,11 +234,11 @@ inline void InitKernelStateEmulator(std::vector<prngStates>& states,
     }
 }
 
-template <typename T>
-inline void ExpandTensorDim(std::vector<T> x_len,
-                            std::vector<T> x_str,
-                            std::vector<T> y_len,
-                            std::vector<T> y_str,
+template <typename TDims, typename T>
+inline void ExpandTensorDim(const TDims& x_len,
+                            const TDims& x_str,
+                            const TDims& y_len,
+                            const TDims& y_str,
                             std::vector<T>& in_len,
                             std::vector<T>& in_str,
                             std::vector<T>& out_len,
@@ -377,4 +380,72 @@ void DropoutBackwardVerify(const miopen::DropoutDescriptor& DropoutDesc,
         });
 }
 
+/// Dropout between stacked layers for the RNN host references (see cpu_rnn.hpp).
+struct rnn_dropout_verify
+{
+    miopen::Handle& handle;
+    const miopen::DropoutDescriptor& dropoutDesc;
+    std::vector<prngStates> states{};
+
+    template <typename T>
+    void forward(int rows,
+                 int cols,
+                 std::vector<T>& x,
+                 size_t x_offset,
+                 int x_stride,
+                 std::vector<T>& y,
+                 size_t y_offset,
+                 int y_stride,
+                 std::vector<unsigned char>& mask,
+                 size_t mask_offset)
+    {
+        if(states.empty())
+        {
+            states = std::vector<prngStates>(dropoutDesc.stateSizeInBytes / sizeof(prngStates));
+            InitKernelStateEmulator(states, dropoutDesc);
+        }
+
+        std::array<int, 2> lens      = {{rows, cols}};
+        std::array<int, 2> x_strides = {{x_stride, 1}};
+        std::array<int, 2> y_strides = {{y_stride, 1}};
+        const miopen::TensorDescriptor xDesc(miopenFloat, lens.data(), x_strides.data(), 2);
+        const miopen::TensorDescriptor yDesc(miopenFloat, lens.data(), y_strides.data(), 2);
+
+        auto layer_states = states;
+        DropoutForwardVerify<T>(handle,
+                                dropoutDesc,
+                                xDesc,
+                                x,
+                                yDesc,
+                                y,
+                                mask,
+                                layer_states,
+                                x_offset,
+                                y_offset,
+                                mask_offset);
+    }
+
+    template <typename T>
+    void backward(int rows,
+                  int cols,
+                  std::vector<T>& dy,
+                  size_t dy_offset,
+                  int dy_stride,
+                  std::vector<T>& dx,
+                  size_t dx_offset,
+                  int dx_stride,
+                  std::vector<unsigned char>& mask,
+                  size_t mask_offset)
+    {
+        std::array<int, 2> lens       = {{rows, cols}};
+        std::array<int, 2> dy_strides = {{dy_stride, 1}};
+        std::array<int, 2> dx_strides = {{dx_stride, 1}};
+        const miopen::TensorDescriptor dyDesc(miopenFloat, lens.data(), dy_strides.data(), 2);
+        const miopen::TensorDescriptor dxDesc(miopenFloat, lens.data(), dx_strides.data(), 2);
+
+        DropoutBackwardVerify<T>(
+            dropoutDesc, dyDesc, dy, dxDesc, dx, mask, dx_offset, dy_offset, mask_offset);
+    }
+};
+
 #endif
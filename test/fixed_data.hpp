@@ -0,0 +1,45 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+
+#ifndef GUARD_MIOPEN_TEST_FIXED_DATA_HPP
+#define GUARD_MIOPEN_TEST_FIXED_DATA_HPP
+
+#include <cstddef>
+#include <vector>
+
+// Deterministic values in [-0.5, 0.5) that differ with the seed, for the tests that run two code
+// paths on the same inputs and compare their outputs.
+template <class T = float>
+std::vector<T> fixed_data(std::size_t n, std::size_t seed)
+{
+    std::vector<T> v(n);
+    for(std::size_t i = 0; i < n; ++i)
+        v[i] = static_cast<T>(static_cast<float>((i * 37 + seed * 11) % 101) / 101.0f - 0.5f);
+    return v;
+}
+
+#endif // GUARD_MIOPEN_TEST_FIXED_DATA_HPP
@@ -72,6 +72,28 @@ void chk_getop_bounds()
     EXPECT(miopenError != miopenStatusSuccess);
 }
 
+void chk_exhaustive_search()
+{
+    miopen::TensorDescriptor inputTensor;
+    miopen::TensorDescriptor convFilter;
+    miopenConvolutionDescriptor_t convDesc{};
+    miopenFusionOpDescriptor_t convoOp;
+    STATUS(miopenSet4dTensorDescriptor(&inputTensor, miopenFloat, 100, 32, 8, 8));
+    STATUS(miopenSet4dTensorDescriptor(&convFilter, miopenFloat, 64, 32, 1, 1));
+    STATUS(miopenCreateConvolutionDescriptor(&convDesc));
+    STATUS(miopenInitConvolutionDescriptor(convDesc, miopenConvolution, 0, 0, 1, 1, 1, 1));
+
+    miopen::FusionPlanDescriptor fp(miopenVerticalFusion, inputTensor);
+    // Tuning applies to the convolution, so it has to be added first
+    EXPECT(miopenFusionPlanConvolutionSetExhaustiveSearch(&fp, true) != miopenStatusSuccess);
+    STATUS(miopenCreateOpConvForward(&fp, &convoOp, convDesc, &convFilter));
+    STATUS(miopenFusionPlanConvolutionSetExhaustiveSearch(&fp, true));
+    EXPECT(static_cast<miopen::ConvForwardOpDescriptor*>(convoOp)->exhaustive_search);
+    STATUS(miopenFusionPlanConvolutionSetExhaustiveSearch(&fp, false));
+    EXPECT(!static_cast<miopen::ConvForwardOpDescriptor*>(convoOp)->exhaustive_search);
+    STATUS(miopenDestroyConvolutionDescriptor(convDesc));
+}
+
 int main()
 {
     /*
@@ -79,4 +101,5 @@ int main()
      * bound checking on the incoming index
      */
     chk_getop_bounds();
+    chk_exhaustive_search();
 }
@@ -0,0 +1,67 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/miopen.h>
+#include <miopen/fusion_plan.hpp>
+#include <miopen/handle.hpp>
+
+#include "get_handle.hpp"
+#include "test.hpp"
+
+#include <memory>
+
+// Plans with the same operators and descriptors share their key, and the second one is compiled
+// from the state the first one cached on the handle.
+void chk_plan_cache()
+{
+    auto&& handle = get_handle();
+    miopen::TensorDescriptor bnScale;
+    STATUS(miopenSet4dTensorDescriptor(&bnScale, miopenFloat, 1, 32, 1, 1));
+    auto make_plan = [&](int n, miopenActivationMode_t activ_mode) {
+        miopen::TensorDescriptor inputTensor;
+        STATUS(miopenSet4dTensorDescriptor(&inputTensor, miopenFloat, n, 32, 8, 8));
+        auto fp =
+            std::make_unique<miopen::FusionPlanDescriptor>(miopenVerticalFusion, inputTensor);
+        miopenFusionOpDescriptor_t bNormOp;
+        miopenFusionOpDescriptor_t activOp;
+        STATUS(miopenCreateOpBatchNormInference(fp.get(), &bNormOp, miopenBNSpatial, &bnScale));
+        STATUS(miopenCreateOpActivationForward(fp.get(), &activOp, activ_mode));
+        return fp;
+    };
+
+    auto plan = make_plan(16, miopenActivationRELU);
+    auto same = make_plan(16, miopenActivationRELU);
+    EXPECT(plan->GetPlanKey() == same->GetPlanKey());
+    EXPECT(plan->GetPlanKey() != make_plan(8, miopenActivationRELU)->GetPlanKey());
+    EXPECT(plan->GetPlanKey() != make_plan(16, miopenActivationLEAKYRELU)->GetPlanKey());
+
+    STATUS(miopenCompileFusionPlan(&handle, plan.get()));
+    EXPECT(handle.fusion_plans.Find(same->GetPlanKey()) != nullptr);
+    STATUS(miopenCompileFusionPlan(&handle, same.get()));
+    EXPECT(same->GetProgramName(handle) == plan->GetProgramName(handle));
+}
+
+int main() { chk_plan_cache(); }
@@ -0,0 +1,193 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include "fusionHost.hpp"
+#include "random.hpp"
+
+// A bias can not start a fused kernel, so the plan below is only supported by splitting it
+// into a standalone bias followed by the fused batch norm and activation (or three kernels).
+
+using ptr_FusionPlanDesc = MIOPEN_MANAGE_PTR(miopenFusionPlanDescriptor_t, miopenDestroyFusionPlan);
+using ptr_FusionPlanArgs = MIOPEN_MANAGE_PTR(miopenOperatorArgs_t, miopenDestroyOperatorArgs);
+
+template <class T>
+struct verify_partitioned_bias_bn_activ
+{
+    tensor<T> input;
+    tensor<T> bias;
+    tensor<T> bnscale;
+    tensor<T> bnbias;
+    tensor<T> estMean;
+    tensor<T> estVariance;
+    miopenActivationMode_t activ_mode;
+    double activ_alpha;
+    double activ_beta;
+    double activ_gamma;
+    miopenFusionPlanDescriptor_t fusionplan;
+    miopenFusionOpDescriptor_t biasOp;
+    miopenFusionOpDescriptor_t bNormOp;
+    miopenFusionOpDescriptor_t activOp;
+    double epsilon = 1.0e-5;
+
+    tensor<T> cpu() const
+    {
+        auto bout = input;
+        par_ford(input.desc.GetLengths()[0],
+                 input.desc.GetLengths()[1],
+                 input.desc.GetLengths()[2],
+                 input.desc.GetLengths()[3])([&](int n, int c, int h, int w) {
+            bout(n, c, h, w) = input(n, c, h, w) + bias(0, c, 0, 0);
+        });
+        auto nout = input;
+        batchNormSpatialHostInference(bout, nout, bnscale, bnbias, epsilon, estMean, estVariance);
+        auto aout = input;
+        activationHostInfer(
+            activ_mode, activ_gamma, activ_beta, activ_alpha, nout.data, aout.data);
+        return aout;
+    }
+
+    tensor<T> gpu() const
+    {
+        auto&& handle = get_handle();
+        auto out      = input;
+        std::fill(out.begin(), out.end(), 0);
+        auto in_dev          = handle.Write(input.data);
+        auto out_dev         = handle.Write(out.data);
+        auto bias_dev        = handle.Write(bias.data);
+        auto bnscale_dev     = handle.Write(bnscale.data);
+        auto bnbias_dev      = handle.Write(bnbias.data);
+        auto estMean_dev     = handle.Write(estMean.data);
+        auto estVariance_dev = handle.Write(estVariance.data);
+
+        float alpha = 1, beta = 0;
+        miopenOperatorArgs_t fusionArgs;
+        miopenCreateOperatorArgs(&fusionArgs);
+        ptr_FusionPlanArgs ptr_fusionargs{fusionArgs};
+        miopenSetOpArgsBiasForward(ptr_fusionargs.get(), biasOp, &alpha, &beta, bias_dev.get());
+        miopenSetOpArgsBatchNormInference(ptr_fusionargs.get(),
+                                          bNormOp,
+                                          &alpha,
+                                          &beta,
+                                          bnscale_dev.get(),
+                                          bnbias_dev.get(),
+                                          estMean_dev.get(),
+                                          estVariance_dev.get(),
+                                          epsilon);
+        miopenSetOpArgsActivForward(
+            ptr_fusionargs.get(), activOp, &alpha, &beta, activ_alpha, activ_beta, activ_gamma);
+        auto desc   = input.desc;
+        auto status = miopenExecuteFusionPlan(&handle,
+                                              fusionplan,
+                                              &desc,
+                                              in_dev.get(),
+                                              &desc,
+                                              out_dev.get(),
+                                              ptr_fusionargs.get());
+        EXPECT(status == miopenStatusSuccess);
+        out.data = handle.Read<T>(out_dev, out.data.size());
+        return out;
+    }
+
+    void fail(float = 0) const
+    {
+        std::cerr << "Partitioned Bias+BatchNorm+Activation:" << std::endl;
+    }
+};
+
+template <class T>
+struct fusion_planner_driver : test_driver
+{
+    tensor<T> input;
+    double alpha = 0.5, beta = 0.5, gamma = 0.5;
+
+    fusion_planner_driver() { add(input, "input", get_input_tensor()); }
+
+    void run()
+    {
+        std::size_t ssn, ssc, ssh, ssw;
+        auto derivedBnDesc = miopen::TensorDescriptor{};
+        miopen::DeriveBNTensorDescriptor(derivedBnDesc, input.desc, miopenBNSpatial);
+        std::tie(ssn, ssc, ssh, ssw) = miopen::tien<4>(derivedBnDesc.GetLengths());
+
+        auto bias        = tensor<T>{ssn, ssc, ssh, ssw};
+        auto scale       = tensor<T>{ssn, ssc, ssh, ssw};
+        auto shift       = tensor<T>{ssn, ssc, ssh, ssw};
+        auto estMean     = tensor<T>{ssn, ssc, ssh, ssw};
+        auto estVariance = tensor<T>{ssn, ssc, ssh, ssw};
+
+        srand(0);
+        for(std::size_t i = 0; i < scale.desc.GetElementSize(); i++)
+        {
+            bias[i]        = (((GET_RAND() % 2) == 1) ? -1 : 1) * 1e-2 * T(GET_RAND() % 100);
+            scale[i]       = (((GET_RAND() % 2) == 1) ? -1 : 1) * 1e-2 * T(GET_RAND() % 100);
+            shift[i]       = (((GET_RAND() % 2) == 1) ? -1 : 1) * 1e-2 * T(GET_RAND() % 100);
+            estMean[i]     = (((GET_RAND() % 2) == 1) ? -1 : 1) * 1e-2 * T(GET_RAND() % 100);
+            estVariance[i] = (1e-2 * (T(GET_RAND() % 100) + 1));
+        }
+        for(std::size_t i = 0; i < input.desc.GetElementSize(); i++)
+        {
+            input[i] = 1e-2 * (((GET_RAND() % 2) == 1) ? -1 : 1) * T(GET_RAND() % 100);
+        }
+
+        auto&& handle = get_handle();
+
+        miopenFusionPlanDescriptor_t fusePlanDesc;
+        miopenCreateFusionPlan(&fusePlanDesc, miopenVerticalFusion, &input.desc);
+        ptr_FusionPlanDesc ptr_fusionplan{fusePlanDesc};
+
+        miopenFusionOpDescriptor_t biasOp  = nullptr;
+        miopenFusionOpDescriptor_t bNormOp = nullptr;
+        miopenFusionOpDescriptor_t activOp = nullptr;
+        STATUS(miopenCreateOpBiasForward(ptr_fusionplan.get(), &biasOp, &bias.desc));
+        STATUS(miopenCreateOpBatchNormInference(
+            ptr_fusionplan.get(), &bNormOp, miopenBNSpatial, &scale.desc));
+        STATUS(
+            miopenCreateOpActivationForward(ptr_fusionplan.get(), &activOp, miopenActivationRELU));
+
+        // Every operator of the plan can run standalone, so partitioning always succeeds.
+        EXPECT(miopenCompileFusionPlan(&handle, ptr_fusionplan.get()) == miopenStatusSuccess);
+        const auto& segments = miopen::deref(ptr_fusionplan.get()).GetSegments();
+        EXPECT(segments.size() >= 2 && segments.size() <= 3);
+        EXPECT(segments.front().fused == nullptr);
+        EXPECT(segments.front().op_count == 1);
+
+        verify(verify_partitioned_bias_bn_activ<T>{input,
+                                                   bias,
+                                                   scale,
+                                                   shift,
+                                                   estMean,
+                                                   estVariance,
+                                                   miopenActivationRELU,
+                                                   alpha,
+                                                   beta,
+                                                   gamma,
+                                                   ptr_fusionplan.get(),
+                                                   biasOp,
+                                                   bNormOp,
+                                                   activOp});
+    }
+};
+
+int main(int argc, const char* argv[]) { test_drive<fusion_planner_driver>(argc, argv); }
@@ -0,0 +1,159 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "driver.hpp"
+#include "get_handle.hpp"
+#include "tensor_holder.hpp"
+#include "test.hpp"
+#include "verify.hpp"
+
+#include <miopen/activ.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/launch_list.hpp>
+#include <miopen/softmax.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// A relu followed by a softmax is captured on buffers that are never accessed and the recorded
+// launches are checked from their arguments alone, which also works with the HIP_NOGPU backend.
+// When a GPU is available the list is then rebound to real buffers and replayed.
+struct launch_capture_test
+{
+    tensor<float> x = tensor<float>{2, 4, 8, 8}.generate(tensor_elem_gen_integer{17});
+
+#if MIOPEN_BACKEND_HIP
+    // Start of a buffer of the size of x that is never accessed.
+    static float* placeholder(std::uintptr_t i) { return reinterpret_cast<float*>(i << 20); }
+
+    std::size_t bytes() const { return x.data.size() * sizeof(float); }
+
+    void forward(miopen::Handle& handle, ConstData_t in, Data_t tmp, Data_t out) const
+    {
+        const float alpha = 1.0f;
+        const float beta  = 0.0f;
+        auto relu         = miopen::ActivationDescriptor{miopenActivationRELU, 1.0, 0.0, 1.0};
+        relu.Forward(handle, &alpha, x.desc, in, &beta, x.desc, tmp);
+        miopen::SoftmaxForward(handle,
+                               &alpha,
+                               &beta,
+                               x.desc,
+                               tmp,
+                               x.desc,
+                               out,
+                               MIOPEN_SOFTMAX_ACCURATE,
+                               MIOPEN_SOFTMAX_MODE_CHANNEL);
+    }
+
+    static std::vector<std::uintptr_t> pointers(const miopen::CapturedLaunch& launch)
+    {
+        std::vector<std::uintptr_t> result;
+        for(const auto offset : launch.pointer_offsets)
+        {
+            std::uintptr_t ptr;
+            std::memcpy(&ptr, launch.args.data() + offset, sizeof(ptr));
+            result.push_back(ptr);
+        }
+        return result;
+    }
+
+    bool points_into(const std::vector<std::uintptr_t>& ptrs, const void* buffer) const
+    {
+        const auto start = reinterpret_cast<std::uintptr_t>(buffer);
+        return std::any_of(ptrs.begin(), ptrs.end(), [&](auto ptr) {
+            return ptr >= start && ptr - start < bytes();
+        });
+    }
+
+    miopen::LaunchList capture(miopen::Handle& handle) const
+    {
+        handle.BeginCapture();
+        EXPECT(handle.IsCapturing());
+        EXPECT(throws([&] { handle.BeginCapture(); }));
+        // A temporary buffer would be freed before the launches using it are replayed.
+        EXPECT(throws([&] { handle.Create(bytes()); }));
+        EXPECT(throws([&] { handle.Write(x.data); }));
+        forward(handle, placeholder(1), placeholder(2), placeholder(3));
+        auto list = handle.EndCapture();
+        EXPECT(!handle.IsCapturing());
+        EXPECT(throws([&] { handle.EndCapture(); }));
+
+        // The relu reads x and writes tmp, then the softmax kernels go from tmp to out.
+        const auto& launches = list.GetLaunches();
+        EXPECT(launches.size() >= 2);
+        const auto first = pointers(launches.front());
+        EXPECT(points_into(first, placeholder(1)));
+        EXPECT(points_into(first, placeholder(2)));
+        const auto last = pointers(launches.back());
+        EXPECT(points_into(last, placeholder(3)));
+        EXPECT(!points_into(last, placeholder(1)));
+
+        // Rebinding moves only the pointers into the given buffers and keeps their offsets.
+        const auto moved = list.Rebind({{placeholder(3), bytes(), placeholder(4)}});
+        EXPECT(moved >= 1);
+        EXPECT(points_into(pointers(list.GetLaunches().back()), placeholder(4)));
+        EXPECT(!points_into(pointers(list.GetLaunches().back()), placeholder(3)));
+        EXPECT(list.Rebind({{placeholder(3), bytes(), placeholder(5)}}) == 0);
+        return list;
+    }
+
+    void replay(miopen::Handle& handle, miopen::LaunchList& list) const
+    {
+        auto in_dev  = handle.Write(x.data);
+        auto tmp_dev = handle.Write(std::vector<float>(x.data.size()));
+        auto ref_dev = handle.Write(std::vector<float>(x.data.size()));
+        auto out_dev = handle.Write(std::vector<float>(x.data.size()));
+
+        forward(handle, in_dev.get(), tmp_dev.get(), ref_dev.get());
+        const auto ref = handle.Read<float>(ref_dev, x.data.size());
+
+        list.Rebind({{placeholder(1), bytes(), in_dev.get()},
+                     {placeholder(2), bytes(), tmp_dev.get()},
+                     {placeholder(4), bytes(), out_dev.get()}});
+        handle.Replay(list);
+        const auto out = handle.Read<float>(out_dev, x.data.size());
+        EXPECT(miopen::rms_range(ref, out) == 0);
+    }
+#endif
+
+    void run() const
+    {
+        auto&& handle = get_handle();
+#if MIOPEN_BACKEND_HIP
+        auto list = capture(handle);
+#if !MIOPEN_MODE_NOGPU
+        replay(handle, list);
+#endif
+#else
+        EXPECT(throws([&] { handle.BeginCapture(); }));
+        EXPECT(!handle.IsCapturing());
+#endif
+    }
+};
+
+int main() { launch_capture_test{}.run(); }
@@ -0,0 +1,142 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include "test.hpp"
+
+#include <miopen/batched_transpose_sol.hpp>
+#include <miopen/layout_transform_plan.hpp>
+#include <miopen/tensor.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Checks how LayoutTransformPlan classifies layout conversions and which batched transpose
+// kernel the cost model picks, without running anything on a device.
+struct layout_transform_plan_test
+{
+    using lens_t = std::vector<std::size_t>;
+
+    static miopen::TensorDescriptor nchw(const lens_t& lens)
+    {
+        return miopen::TensorDescriptor{miopenFloat, lens};
+    }
+
+    static miopen::TensorDescriptor nhwc(const lens_t& lens)
+    {
+        const auto c = lens[1], h = lens[2], w = lens[3];
+        return miopen::TensorDescriptor{miopenFloat, lens, {h * w * c, 1, w * c, c}};
+    }
+
+    static void check_plans()
+    {
+        using miopen::LayoutTransformKind;
+        using miopen::LayoutTransformPlan;
+
+        // NCHW -> NHWC is a batch of [C, HW] -> [HW, C] transposes.
+        const auto to_nhwc = LayoutTransformPlan::Make(nchw({8, 16, 7, 5}), nhwc({8, 16, 7, 5}));
+        EXPECT(to_nhwc.kind == LayoutTransformKind::BatchedTranspose);
+        EXPECT(to_nhwc.batch == 8 && to_nhwc.height == 16 && to_nhwc.width == 35);
+
+        // NHWC -> NCHW is the opposite one.
+        const auto to_nchw = LayoutTransformPlan::Make(nhwc({8, 16, 7, 5}), nchw({8, 16, 7, 5}));
+        EXPECT(to_nchw.kind == LayoutTransformKind::BatchedTranspose);
+        EXPECT(to_nchw.batch == 8 && to_nchw.height == 35 && to_nchw.width == 16);
+
+        // A single image is a plain 2-d transpose.
+        const auto single = LayoutTransformPlan::Make(nchw({1, 3, 4, 4}), nhwc({1, 3, 4, 4}));
+        EXPECT(single.kind == LayoutTransformKind::BatchedTranspose);
+        EXPECT(single.lens == (lens_t{16, 3}));
+        EXPECT(single.batch == 1 && single.height == 3 && single.width == 16);
+
+        // With one channel or a 1x1 image both layouts put the elements in the same order.
+        const auto one_channel = LayoutTransformPlan::Make(nchw({8, 1, 7, 5}), nhwc({8, 1, 7, 5}));
+        EXPECT(one_channel.kind == LayoutTransformKind::View);
+        EXPECT(one_channel.IsContiguous());
+        EXPECT(one_channel.lens == lens_t{280});
+
+        const auto one_pixel = LayoutTransformPlan::Make(nchw({8, 16, 1, 1}), nhwc({8, 16, 1, 1}));
+        EXPECT(one_pixel.IsContiguous());
+
+        // Copying into a padded tensor keeps the layout but is not one contiguous run.
+        const auto padded_desc = miopen::TensorDescriptor{miopenFloat, {4, 3, 8}, {48, 16, 1}};
+        const auto padded      = LayoutTransformPlan::Make(nchw({4, 3, 8}), padded_desc);
+        EXPECT(padded.kind == LayoutTransformKind::Generic);
+        EXPECT(padded.lens == (lens_t{12, 8}));
+        EXPECT(padded.x_strides == (lens_t{8, 1}));
+        EXPECT(padded.y_strides == (lens_t{16, 1}));
+
+        // All dimensions of length 1, and empty tensors.
+        EXPECT(LayoutTransformPlan::Make(nchw({1, 1, 1}), nchw({1, 1, 1})).IsContiguous());
+        EXPECT(LayoutTransformPlan::Make({4, 0}, {1, 4}, {0, 1}).kind == LayoutTransformKind::View);
+
+        EXPECT(throws([] { LayoutTransformPlan::Make(nchw({2, 3}), nchw({3, 2})); }));
+    }
+
+    static void check_param(std::size_t data_size, uint32_t batch, uint32_t height, uint32_t width)
+    {
+        const int num_cu = 64;
+        const auto param =
+            miopen::GetBatchedTransposeParam(data_size, batch, height, width, num_cu);
+        EXPECT(param.tile_x > 0 && param.tile_y > 0);
+        EXPECT(width % param.ediv_x == 0 && height % param.ediv_y == 0);
+
+        // The plain 16x16 kernel is applicable to any problem.
+        const auto cost = miopen::GetBatchedTransposeCost(
+            param, data_size, batch, height, width, num_cu);
+        const auto base = miopen::GetBatchedTransposeCost(
+            {16, 16, 1, 1, 1, 1}, data_size, batch, height, width, num_cu);
+        EXPECT(cost <= base);
+    }
+
+    static void check_cost_model()
+    {
+        check_param(4, 32, 64, 3136);
+        check_param(2, 32, 64, 3136);
+        check_param(2, 1, 3, 50176);
+        check_param(1, 8, 33, 17);
+        check_param(4, 1, 1000, 10);
+
+        // Big vectorized tiles pay off once there are enough of them to fill the device.
+        const auto large = miopen::GetBatchedTransposeParam(2, 64, 1024, 1024, 64);
+        EXPECT(large.ediv_x > 1 && large.ediv_y > 1);
+
+        // Odd sizes rule out the vectorized kernels.
+        const auto odd = miopen::GetBatchedTransposeParam(2, 64, 1023, 1023, 64);
+        EXPECT(odd.ediv_x == 1 && odd.ediv_y == 1);
+
+        // A tall, narrow source is read in tiles that span whole rows.
+        const auto narrow = miopen::GetBatchedTransposeParam(4, 1, 100000, 4, 64);
+        EXPECT(narrow.tile_x >= 4 && narrow.tile_x < narrow.tile_y);
+    }
+
+    void run() const
+    {
+        check_plans();
+        check_cost_model();
+    }
+};
+
+int main() { layout_transform_plan_test{}.run(); }
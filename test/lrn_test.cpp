@@ -28,6 +28,7 @@
 #include "verify.hpp"
 #include "get_handle.hpp"
 #include "tensor_holder.hpp"
+#include "cpu_lrn.hpp"
 #include <miopen/miopen.h>
 #include <miopen/tensor.hpp>
 #include <miopen/stringutils.hpp>
@@ -38,6 +39,24 @@
 #include <limits>
 #include <iostream>
 
+static lrn_cpu_dims lrn_dims(const std::vector<std::size_t>& v)
+{
+    return {{v[0], v[1], v[2], v[3]}};
+}
+
+static lrn_cpu_problem make_lrn_cpu_problem(const miopen::LRNDescriptor& lrn,
+                                            const miopen::TensorDescriptor& desc)
+{
+    lrn_cpu_problem problem;
+    problem.mode  = lrn.GetMode();
+    problem.lens  = lrn_dims(desc.GetLengths());
+    problem.lower = (lrn.GetN() - 1) / 2;
+    problem.upper = lrn.GetN() / 2;
+    problem.k     = lrn.GetK();
+    problem.beta  = lrn.GetBeta();
+    return problem;
+}
+
 template <class T>
 struct verify_lrn_foward
 {
@@ -52,62 +71,22 @@ struct verify_lrn_foward
 
     tensor<T> cpu() const
     {
-        auto output = tensor<T>{input.desc.GetLengths()};
-        int n_batch, channels, height, width;
-        std::tie(n_batch, channels, height, width) = miopen::tien<4>(input.desc.GetLengths());
-
-        auto alpha       = lrn.GetAlpha();
-        auto beta        = lrn.GetBeta();
-        auto K           = lrn.GetK();
-        auto lrn_n       = lrn.GetN();
-        int radius_lower = static_cast<int>((lrn_n - 1) / 2);
-        int radius_upper = static_cast<int>(lrn_n / 2);
-        auto mode        = lrn.GetMode();
-
-        if(mode == miopenLRNCrossChannel)
-        {
-            auto alphaoverarea = alpha / lrn_n;
-            par_ford(n_batch, channels, height, width)([&](int b, int c, int h, int w) {
-                int start = c < radius_lower ? 0 : (c - radius_lower);
-                int end   = (c + radius_upper + 1) > channels ? channels : (c + radius_upper + 1);
-
-                double scale = 0;
-                for(int k = start; k < end; k++)
-                {
-                    scale += std::pow(input(b, k, h, w), 2);
-                }
-
-                scale *= alphaoverarea;
-                scale += K;
-                scale = std::pow(scale, -beta);
-
-                output(b, c, h, w) = static_cast<T>(scale * input(b, c, h, w));
-            });
-        }
-        else
-        {
-            double alphaoverarea = radius_upper == 0 ? 1 : alpha / (lrn_n * lrn_n);
-            par_ford(n_batch, channels, height, width)([&](int b, int c, int h, int w) {
-                double scale = 0;
-                int left     = (w - radius_lower) < 0 ? 0 : (w - radius_lower);
-                int right    = (w + radius_upper + 1) > width ? width : (w + radius_upper + 1);
-                int top      = (h - radius_lower) < 0 ? 0 : (h - radius_lower);
-                int bottom   = (h + radius_upper + 1) > height ? height : (h + radius_upper + 1);
-
-                for(int i = left; i < right; i++)
-                {
-                    for(int j = top; j < bottom; j++)
-                    {
-                        scale += std::pow(input(b, c, j, i), 2);
-                    }
-                }
-                scale *= alphaoverarea;
-                scale += K;
-                scale              = std::pow(scale, -beta);
-                output(b, c, h, w) = static_cast<T>(scale * input(b, c, h, w));
-            });
-        }
-
+        auto output        = tensor<T>{input.desc.GetLengths()};
+        const auto problem = make_lrn_cpu_problem(lrn, input.desc);
+        const auto lrn_n   = lrn.GetN();
+        const double alphaoverarea =
+            problem.mode == miopenLRNCrossChannel
+                ? lrn.GetAlpha() / lrn_n
+                : (problem.upper == 0 ? 1 : lrn.GetAlpha() / (lrn_n * lrn_n));
+
+        lrn_cpu_forward(problem,
+                        input.data.data(),
+                        lrn_dims(input.desc.GetStrides()),
+                        output.data.data(),
+                        lrn_dims(output.desc.GetStrides()),
+                        static_cast<T*>(nullptr),
+                        lrn_dims(output.desc.GetStrides()),
+                        [&](std::size_t, std::size_t) { return alphaoverarea; });
         return output;
     }
 
@@ -168,64 +147,25 @@ struct verify_lrn_bwd
 
     tensor<T> cpu() const
     {
-        auto routputDX = tensor<T>{inputX.desc.GetLengths()};
-        int n_batch, channels, height, width;
-        std::tie(n_batch, channels, height, width) = miopen::tien<4>(inputY.desc.GetLengths());
-
-        auto alpha       = lrn.GetAlpha();
-        auto beta        = lrn.GetBeta();
-        auto lrn_n       = lrn.GetN();
-        auto mode        = lrn.GetMode();
-        int radius_lower = static_cast<int>((lrn_n - 1) / 2);
-        int radius_upper = static_cast<int>(lrn_n / 2);
-
-        if(mode == miopenLRNWithinChannel)
-        {
-            auto adjust_area       = lrn_n * lrn_n;
-            auto cache_ratio_value = 2 * alpha * beta / adjust_area;
-
-            par_ford(n_batch, channels, height, width)([&](int b, int c, int h, int w) {
-                int left   = w < radius_upper ? 0 : (w - radius_upper);
-                int right  = (w + radius_lower + 1) > width ? width : (w + radius_lower + 1);
-                int top    = h < radius_upper ? 0 : (h - radius_upper);
-                int bottom = (h + radius_lower + 1) > height ? height : (h + radius_lower + 1);
-
-                double ydy = 0;
-                for(int i = left; i < right; i++)
-                {
-                    for(int j = top; j < bottom; j++)
-                    {
-                        ydy += (double(inputY(b, c, j, i) * inputDY(b, c, j, i)) /
-                                double(scale(b, c, j, i)));
-                    }
-                }
-
-                routputDX(b, c, h, w) = static_cast<T>(
-                    std::pow(static_cast<double>(scale(b, c, h, w)), -beta) * inputDY(b, c, h, w) -
-                    cache_ratio_value * inputX(b, c, h, w) * ydy);
-            });
-        }
-        else
-        {
-            auto cache_ratio_value = 2 * alpha * beta / lrn_n;
-
-            par_ford(n_batch, channels, height, width)([&](int b, int c, int h, int w) {
-                int start = c < radius_upper ? 0 : (c - radius_upper);
-                int end   = (c + radius_lower + 1) > channels ? channels : (c + radius_lower + 1);
-
-                double ydy = 0;
-                for(auto k = start; k < end; k++)
-                {
-                    ydy += (double(inputY(b, k, h, w) * inputDY(b, k, h, w)) /
-                            double(scale(b, k, h, w)));
-                }
-
-                routputDX(b, c, h, w) = static_cast<T>(
-                    std::pow(static_cast<double>(scale(b, c, h, w)), -beta) * inputDY(b, c, h, w) -
-                    cache_ratio_value * inputX(b, c, h, w) * ydy);
-            });
-        }
-
+        auto routputDX     = tensor<T>{inputX.desc.GetLengths()};
+        const auto problem = make_lrn_cpu_problem(lrn, inputY.desc);
+        const auto lrn_n   = lrn.GetN();
+        const double cache_ratio_value =
+            2 * lrn.GetAlpha() * lrn.GetBeta() /
+            (problem.mode == miopenLRNWithinChannel ? lrn_n * lrn_n : lrn_n);
+
+        lrn_cpu_backward(problem,
+                         inputX.data.data(),
+                         lrn_dims(inputX.desc.GetStrides()),
+                         inputY.data.data(),
+                         lrn_dims(inputY.desc.GetStrides()),
+                         inputDY.data.data(),
+                         lrn_dims(inputDY.desc.GetStrides()),
+                         scale.data.data(),
+                         lrn_dims(scale.desc.GetStrides()),
+                         routputDX.data.data(),
+                         lrn_dims(routputDX.desc.GetStrides()),
+                         [&](std::size_t, std::size_t) { return cache_ratio_value; });
         return routputDX;
     }
 
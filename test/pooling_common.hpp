@@ -46,6 +46,7 @@
 #include "tensor_holder.hpp"
 #include "verify.hpp"
 #include "cpu_conv.hpp"
+#include "cpu_pooling.hpp"
 
 #define TEST_PADDING_MODE 0
 // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
@@ -65,41 +66,41 @@ tensor<T> get_output_tensor(const miopen::PoolingDescriptor& filter, const tenso
     return tensor<T>{filter.GetForwardOutputTensor(input.desc)};
 }
 
-template <class T>
-struct pooling_operators
+template <int SptDim>
+pooling_cpu_problem make_pooling_cpu_problem(const miopen::PoolingDescriptor& filter,
+                                             const miopen::TensorDescriptor& in_desc,
+                                             const miopen::TensorDescriptor& out_desc)
 {
-    miopen::PoolingDescriptor filter;
-    pooling_operators(miopen::PoolingDescriptor f) : filter(f) {}
-
-    double start() const
+    // 2-D problems are run as 3-D ones with a single depth slice.
+    constexpr int skip = 3 - SptDim;
+    pooling_cpu_problem problem{};
+    problem.mode = filter.GetMode();
+    problem.n    = in_desc.GetLengths()[0];
+    problem.c    = in_desc.GetLengths()[1];
+    problem.in_lens.fill(1);
+    problem.out_lens.fill(1);
+    problem.kernel.fill(1);
+    problem.stride.fill(1);
+    problem.pad.fill(0);
+    problem.x_strides.fill(0);
+    problem.y_strides.fill(0);
+    for(int i = 0; i < 2; ++i)
     {
-        if(filter.GetMode() == miopenPoolingMax)
-            return std::numeric_limits<T>::lowest();
-        else
-            return 0.0;
-    }
-
-    double operator()(double x, double y) const
-    {
-        if(filter.GetMode() == miopenPoolingMax)
-        {
-            double m = std::max(x, y);
-            return (m);
-        }
-        else
-            return x + y;
+        problem.x_strides[i] = in_desc.GetStrides()[i];
+        problem.y_strides[i] = out_desc.GetStrides()[i];
     }
-
-    double final(double x, double y)
+    for(int i = 0; i < SptDim; ++i)
     {
-        if(filter.GetMode() == miopenPoolingMax)
-        {
-            return (x);
-        }
-        else
-            return x / y;
+        problem.in_lens[skip + i]       = in_desc.GetLengths()[2 + i];
+        problem.out_lens[skip + i]      = out_desc.GetLengths()[2 + i];
+        problem.kernel[skip + i]        = filter.GetLengths()[i];
+        problem.stride[skip + i]        = filter.GetStrides()[i];
+        problem.pad[skip + i]           = filter.GetPads()[i];
+        problem.x_strides[2 + skip + i] = in_desc.GetStrides()[2 + i];
+        problem.y_strides[2 + skip + i] = out_desc.GetStrides()[2 + i];
     }
-};
+    return problem;
+}
 
 template <int SptDim>
 struct verify_forward_pooling
@@ -109,66 +110,9 @@ struct verify_forward_pooling
     cpu(const tensor<T>& input, const miopen::PoolingDescriptor& filter, std::vector<Index>&) const
     {
         auto out = get_output_tensor(filter, input);
-
-        std::array<int, SptDim> in_dim{};
-        std::copy_n(input.desc.GetLengths().begin() + 2, SptDim, in_dim.begin());
-        std::array<int, SptDim> strides{};
-        std::copy_n(filter.GetStrides().begin(), SptDim, strides.begin());
-        std::array<int, SptDim> pads{};
-        std::copy_n(filter.GetPads().begin(), SptDim, pads.begin());
-        std::array<int, SptDim> kers{};
-        std::copy_n(filter.GetLengths().begin(), SptDim, kers.begin());
-        auto op = pooling_operators<T>{filter};
-
-        int b_n = out.desc.GetLengths()[0];
-        int k_n = out.desc.GetLengths()[1];
-        std::array<int, SptDim> out_spatial_len{};
-        std::copy_n(out.desc.GetLengths().begin() + 2, SptDim, out_spatial_len.begin());
-
-        auto par_ford_out =
-            miopen::unpacker(miopen::prepender(par_ford, b_n, k_n))(out_spatial_len);
-
-        par_ford_out([&](int o, int w, auto... out_spatial_id_pack) {
-            auto out_spatial_id = make_array(out_spatial_id_pack...);
-
-            std::array<int, SptDim> start_idx{};
-            std::array<int, SptDim> win_sz{};
-            for(int i = 0; i < SptDim; ++i)
-            {
-                start_idx[i] = out_spatial_id[i] * strides[i] - pads[i];
-                int end_idx  = start_idx[i] + kers[i];
-                end_idx      = std::min(end_idx, in_dim[i]);
-                start_idx[i] = std::max(start_idx[i], 0);
-                win_sz[i]    = end_idx - start_idx[i];
-                win_sz[i]    = std::max(win_sz[i], 1);
-            }
-
-            int pool_size =
-                filter.GetMode() == miopenPoolingAverageInclusive
-                    ? std::accumulate(kers.begin(), kers.end(), 1, std::multiplies<int>())
-                    : std::accumulate(win_sz.begin(), win_sz.end(), 1, std::multiplies<int>());
-
-            double acc = op.start();
-            miopen::unpacker(ford)(win_sz)([&](auto... in_spatial_id_pack) {
-                auto in_spatial_id = make_array(in_spatial_id_pack...);
-                std::array<std::size_t, SptDim + 2> idx{};
-                idx[0] = o;
-                idx[1] = w;
-
-                bool in_cmp_idx = true;
-                for(int i = 0; i < SptDim; ++i)
-                {
-                    idx[i + 2] = start_idx[i] + in_spatial_id[i];
-                    in_cmp_idx &= (in_dim[i] > idx[i + 2]);
-                }
-
-                if(in_cmp_idx)
-                {
-                    acc = op(acc, input(idx));
-                }
-            });
-            out(o, w, out_spatial_id_pack...) = T(op.final(acc, pool_size));
-        });
+        pooling_cpu_forward(make_pooling_cpu_problem<SptDim>(filter, input.desc, out.desc),
+                            input.data.data(),
+                            out.data.data());
         return out;
     }
 
@@ -241,8 +185,17 @@ struct verify_backward_pooling
                   bool verify_index) const
     {
         auto dinput = input;
-        std::vector<T> din_vec(input.desc.GetElementSpace(), T(0));
         CHECK(dout.desc == out.desc);
+        if(filter.GetMode() != miopenPoolingMax)
+        {
+            pooling_cpu_backward(make_pooling_cpu_problem<SptDim>(filter, input.desc, out.desc),
+                                 dout.data.data(),
+                                 dinput.data.data());
+            return dinput;
+        }
+
+        // Max pooling decodes and checks the indices returned by the GPU.
+        std::vector<T> din_vec(input.desc.GetElementSpace(), T(0));
         std::array<int, SptDim + 2> in_dim{};
         std::copy_n(input.desc.GetLengths().begin(), SptDim + 2, in_dim.begin());
         std::array<int, SptDim + 2> in_str{};
@@ -253,7 +206,6 @@ struct verify_backward_pooling
         std::copy_n(filter.GetPads().begin(), SptDim, pads.begin());
         std::array<int, SptDim> kers{};
         std::copy_n(filter.GetLengths().begin(), SptDim, kers.begin());
-        auto ford_ker = miopen::unpacker(ford)(kers);
 
         int out_n = out.desc.GetLengths()[0];
         int out_c = out.desc.GetLengths()[1];
@@ -262,109 +214,57 @@ struct verify_backward_pooling
         auto ford_out = miopen::unpacker(ford)(out_spatial_len);
 
         par_ford(out_n, out_c)([&](int o, int w) {
-            if(filter.GetMode() == miopenPoolingMax)
-            {
-                ford_out([&](auto... out_spatial_id_pack) {
-                    auto mx_idx = indices.at(dout.desc.GetIndex(o, w, out_spatial_id_pack...));
-                    std::array<std::size_t, SptDim + 2> idx{};
-                    bool in_cmp_idx = true;
-                    if(use_global_index)
+            ford_out([&](auto... out_spatial_id_pack) {
+                auto mx_idx = indices.at(dout.desc.GetIndex(o, w, out_spatial_id_pack...));
+                std::array<std::size_t, SptDim + 2> idx{};
+                bool in_cmp_idx = true;
+                if(use_global_index)
+                {
+                    for(int i = 0; i < SptDim; i++)
                     {
-                        for(int i = 0; i < SptDim; i++)
-                        {
-                            std::size_t mx_idx_dim = mx_idx;
-                            mx_idx_dim /= std::accumulate(in_dim.begin() + i + 3,
-                                                          in_dim.end(),
-                                                          1,
-                                                          std::multiplies<std::size_t>());
-                            mx_idx_dim %= in_dim[i + 2];
-                            idx[i + 2] = mx_idx_dim;
-                        }
+                        std::size_t mx_idx_dim = mx_idx;
+                        mx_idx_dim /= std::accumulate(in_dim.begin() + i + 3,
+                                                      in_dim.end(),
+                                                      1,
+                                                      std::multiplies<std::size_t>());
+                        mx_idx_dim %= in_dim[i + 2];
+                        idx[i + 2] = mx_idx_dim;
                     }
-                    else
-                    {
-                        auto out_spatial_id = make_array(out_spatial_id_pack...);
+                }
+                else
+                {
+                    auto out_spatial_id = make_array(out_spatial_id_pack...);
 
-                        for(int i = 0; i < SptDim; i++)
-                        {
-                            int mx_idx_dim = mx_idx;
-                            mx_idx_dim /= std::accumulate(
-                                kers.begin() + i + 1, kers.end(), 1, std::multiplies<int>());
-                            mx_idx_dim %= kers[i];
+                    for(int i = 0; i < SptDim; i++)
+                    {
+                        int mx_idx_dim = mx_idx;
+                        mx_idx_dim /= std::accumulate(
+                            kers.begin() + i + 1, kers.end(), 1, std::multiplies<int>());
+                        mx_idx_dim %= kers[i];
 
-                            mx_idx_dim += (out_spatial_id[i] * strides[i] - pads[i]);
-                            in_cmp_idx &= (in_dim[i + 2] > mx_idx_dim && mx_idx_dim >= 0);
+                        mx_idx_dim += (out_spatial_id[i] * strides[i] - pads[i]);
+                        in_cmp_idx &= (in_dim[i + 2] > mx_idx_dim && mx_idx_dim >= 0);
 
-                            idx[i + 2] = std::size_t(mx_idx_dim);
-                        }
+                        idx[i + 2] = std::size_t(mx_idx_dim);
                     }
+                }
 
-                    if(in_cmp_idx)
+                if(in_cmp_idx)
+                {
+                    idx[0] = o;
+                    idx[1] = w;
+                    if(verify_index)
                     {
-                        idx[0] = o;
-                        idx[1] = w;
-                        if(verify_index)
-                        {
-                            CHECK(
-                                miopen::float_equal(input(idx), out(o, w, out_spatial_id_pack...)));
-                        }
-                        std::size_t din_idx = 0;
-                        for(int i = 0; i < SptDim + 2; i++)
-                        {
-                            din_idx += idx[i] * in_str[i];
-                        }
-                        din_vec.at(din_idx) += dout(o, w, out_spatial_id_pack...);
+                        CHECK(miopen::float_equal(input(idx), out(o, w, out_spatial_id_pack...)));
                     }
-                });
-            }
-            else
-            {
-                ford_out([&](auto... out_spatial_id_pack) {
-                    auto out_spatial_id = make_array(out_spatial_id_pack...);
-
-                    std::array<int, SptDim> start_idx{};
-                    std::array<int, SptDim> win_sz{};
-                    for(int i = 0; i < SptDim; ++i)
+                    std::size_t din_idx = 0;
+                    for(int i = 0; i < SptDim + 2; i++)
                     {
-                        start_idx[i] = out_spatial_id[i] * strides[i] - pads[i];
-                        int end_idx  = start_idx[i] + kers[i];
-                        end_idx      = std::min(end_idx, in_dim[i + 2]);
-                        win_sz[i]    = end_idx - std::max(start_idx[i], 0);
-                        win_sz[i]    = std::max(win_sz[i], 1);
+                        din_idx += idx[i] * in_str[i];
                     }
-
-                    int pool_size =
-                        filter.GetMode() == miopenPoolingAverageInclusive
-                            ? std::accumulate(kers.begin(), kers.end(), 1, std::multiplies<int>())
-                            : std::accumulate(
-                                  win_sz.begin(), win_sz.end(), 1, std::multiplies<int>());
-
-                    ford_ker([&](auto... ker_id_pack) {
-                        auto ker_id = make_array(ker_id_pack...);
-
-                        bool in_cmp_idx = true;
-                        std::array<int, SptDim + 2> in_idx{};
-                        in_idx[0] = o;
-                        in_idx[1] = w;
-                        for(int i = 0; i < SptDim; ++i)
-                        {
-                            in_idx[i + 2] = start_idx[i] + ker_id[i];
-                            in_cmp_idx &= (in_dim[i + 2] > in_idx[i + 2] && in_idx[i + 2] >= 0);
-                        }
-
-                        if(in_cmp_idx)
-                        {
-                            std::size_t din_idx = 0;
-                            for(int i = 0; i < SptDim + 2; i++)
-                            {
-                                din_idx += in_idx[i] * in_str[i];
-                            }
-
-                            din_vec.at(din_idx) += dout(o, w, out_spatial_id_pack...) / pool_size;
-                        }
-                    });
-                });
-            }
+                    din_vec.at(din_idx) += dout(o, w, out_spatial_id_pack...);
+                }
+            });
         });
 
         miopen::unpacker(ford)(in_dim)([&](auto... in_id_pack) {
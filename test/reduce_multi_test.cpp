@@ -0,0 +1,223 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include "driver.hpp"
+#include "test.hpp"
+#include "verify.hpp"
+#include "get_handle.hpp"
+#include "tensor_holder.hpp"
+#include <miopen/miopen.h>
+#include <miopen/tensor.hpp>
+#include <miopen/reducetensor.hpp>
+#include <algorithm>
+#include <iostream>
+#include <type_traits>
+#include <vector>
+
+#include "cpu_reduce_util.hpp"
+
+template <class T>
+struct verify_reduce_multi
+{
+    std::vector<miopen::ReduceTensorDescriptor> reduces;
+    tensor<T> input;
+    tensor<T> output;
+    float alpha;
+    float beta;
+
+    // The outputs of all the reductions, one after the other.
+    tensor<float> cpu() const
+    {
+        using reduce::binop_with_nan_check;
+        using reduce::PosUnaryOpFn;
+        using reduce::PreUnaryOpFn;
+        using reduce::ReduceOpFn;
+        using reduce::ReduceOpZeroVal;
+
+        const auto& outLengths = output.desc.GetLengths();
+        const std::size_t divider = input.desc.GetElementSize() / output.desc.GetElementSize();
+
+        std::vector<float> result;
+        for(const auto& reduce : reduces)
+        {
+            const auto op  = reduce.reduceTensorOp_;
+            const auto nan = reduce.reduceTensorNanOpt_;
+
+            auto opReduce   = ReduceOpFn<double>(op);
+            auto PreUnaryOp = PreUnaryOpFn<double>(op, divider);
+            auto PosUnaryOp = PosUnaryOpFn<double>(op, divider);
+
+            std::vector<double> acc(output.data.size(), ReduceOpZeroVal<double>(op));
+
+            input.for_each([&](int n, int c, int h, int w) {
+                const auto dst = output.desc.GetIndex(outLengths[0] == 1 ? 0 : n,
+                                                      outLengths[1] == 1 ? 0 : c,
+                                                      outLengths[2] == 1 ? 0 : h,
+                                                      outLengths[3] == 1 ? 0 : w);
+                auto value     = static_cast<double>(input(n, c, h, w));
+                PreUnaryOp(value);
+                binop_with_nan_check(nan, opReduce, acc[dst], value);
+            });
+
+            for(std::size_t i = 0; i < acc.size(); i++)
+            {
+                PosUnaryOp(acc[i]);
+                result.push_back(static_cast<float>(
+                    alpha * acc[i] + beta * static_cast<double>(output.data[i])));
+            }
+        }
+
+        auto res = tensor<float>{std::vector<std::size_t>{result.size()}};
+        res.data = result;
+        return res;
+    }
+
+    tensor<float> gpu() const
+    {
+        auto&& handle = get_handle();
+
+        std::vector<const miopen::ReduceTensorDescriptor*> descs;
+        for(const auto& reduce : reduces)
+            descs.push_back(&reduce);
+
+        auto input_dev = handle.Write(input.data);
+        std::vector<miopen::Allocator::ManageDataPtr> output_devs;
+        std::vector<Data_t> outputs;
+        for(std::size_t i = 0; i < reduces.size(); i++)
+        {
+            output_devs.push_back(handle.Write(output.data));
+            outputs.push_back(output_devs.back().get());
+        }
+
+        const auto ws_sizeInBytes =
+            miopen::GetReduceTensorMultiWorkspaceSize(handle, descs, input.desc, output.desc);
+        auto ws_dev = handle.Create(std::max<std::size_t>(ws_sizeInBytes, 1));
+
+        miopen::ReduceTensorMulti(handle,
+                                  descs,
+                                  ws_dev.get(),
+                                  ws_sizeInBytes,
+                                  &alpha,
+                                  input.desc,
+                                  input_dev.get(),
+                                  &beta,
+                                  output.desc,
+                                  outputs);
+
+        std::vector<float> result;
+        for(auto& output_dev : output_devs)
+        {
+            const auto values = handle.Read<T>(output_dev, output.data.size());
+            for(const auto& value : values)
+                result.push_back(static_cast<float>(value));
+        }
+
+        auto res = tensor<float>{std::vector<std::size_t>{result.size()}};
+        res.data = result;
+        return res;
+    }
+
+    void fail(int) const
+    {
+        std::cout << "verify_reduce_multi failed" << std::endl;
+        std::cout << "Input Tensor"
+                  << " " << input.desc.ToString() << std::endl;
+        std::cout << "Output Tensor"
+                  << " " << output.desc.ToString() << std::endl;
+    }
+};
+
+template <class T>
+struct reduce_multi_driver : test_driver
+{
+    std::vector<std::size_t> inLengths;
+    std::vector<int> toReduceDims;
+    std::vector<int> reduceOps;
+    int nanOpt = 0;
+    std::vector<float> scales;
+
+    std::vector<std::vector<std::size_t>> get_tensor_lengths()
+    {
+        if(std::is_same<T, half_float::half>::value)
+            return {{4, 3, 60, 50}, {2, 2, 1024, 33}};
+        else
+            return {{64, 3, 28, 81}, {2, 2, 1024, 33}};
+    }
+
+    reduce_multi_driver()
+    {
+        add(inLengths, "D", generate_data(get_tensor_lengths()));
+        add(toReduceDims, "R", generate_data({{0}, {1}, {3}, {2, 3}, {0, 2, 3}, {0, 1, 2, 3}}));
+        // sum, root of the sum of squares and maximum, the statistics fused by normalizations
+        add(reduceOps, "ReduceOps", generate_data({{0, 7, 3}, {5, 6, 4, 2}, {0}}));
+        add(nanOpt, "N", generate_data({0, 1}));
+        add(scales, "scales", generate_data({{1.0f, 0.0f}, {0.5f, 0.5f}}));
+    }
+
+    void run()
+    {
+        std::vector<miopen::ReduceTensorDescriptor> reduces;
+        for(const auto op : reduceOps)
+        {
+            reduces.emplace_back(static_cast<miopenReduceTensorOp_t>(op),
+                                 miopenFloat,
+                                 static_cast<miopenNanPropagation_t>(nanOpt),
+                                 MIOPEN_REDUCE_TENSOR_NO_INDICES,
+                                 MIOPEN_32BIT_INDICES);
+        }
+
+        auto outLengths = inLengths;
+        for(const int dim : toReduceDims)
+            outLengths[dim] = 1;
+
+        // integers around 1.0 keep the sums away from zero
+        auto gen_value = [](auto... is) {
+            return tensor_elem_gen_integer{13}(is...) * tensor_elem_gen_checkboard_sign{}(is...) +
+                   1.0;
+        };
+
+        auto input  = tensor<T>{inLengths}.generate(gen_value);
+        auto output = tensor<T>{outLengths}.generate(tensor_elem_gen_integer{5});
+
+        this->tolerance = 80 * 10;
+        if(std::is_same<T, half_float::half>::value)
+            this->tolerance *= 100;
+
+        verify(verify_reduce_multi<T>{reduces, input, output, scales[0], scales[1]});
+    }
+};
+
+int main(int argc, const char* argv[])
+{
+    std::vector<std::string> as(argv + 1, argv + argc);
+
+    const bool test_half = std::any_of(
+        as.begin(), as.end(), [](const std::string& elem) { return (elem == "--half"); });
+
+    if(test_half)
+        test_drive<reduce_multi_driver<half_float::half>>(argc, argv);
+    else
+        test_drive<reduce_multi_driver<float>>(argc, argv);
+}
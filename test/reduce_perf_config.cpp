@@ -0,0 +1,118 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include "get_handle.hpp"
+#include "test.hpp"
+
+#include <miopen/reduce/problem_description.hpp>
+#include <miopen/reduce/solvers.hpp>
+#include <miopen/reducetensor.hpp>
+#include <miopen/tensor.hpp>
+
+#include <cstddef>
+#include <vector>
+
+// Checks the tuning space of the generic reduction without running it: every valid config must
+// produce kernels for the problem and keep the workspace reported to the user, so that values
+// from the perf-db never need a larger buffer than miopenGetReductionWorkspaceSize() returned.
+struct reduce_perf_config_test
+{
+    miopen::ReduceTensorDescriptor reduce{MIOPEN_REDUCE_TENSOR_MAX,
+                                          miopenFloat,
+                                          MIOPEN_PROPAGATE_NAN,
+                                          MIOPEN_REDUCE_TENSOR_FLATTENED_INDICES,
+                                          MIOPEN_32BIT_INDICES};
+
+    miopen::reduce::ReductionContext context(const std::vector<int>& in_lens,
+                                             const std::vector<int>& out_lens) const
+    {
+        auto ctx = miopen::reduce::ReductionContext{
+            miopen::reduce::ProblemDescription{reduce,
+                                               miopen::TensorDescriptor{miopenFloat, in_lens},
+                                               miopen::TensorDescriptor{miopenFloat, out_lens}}};
+        ctx.SetStream(&get_handle());
+        return ctx;
+    }
+
+    void check(const std::vector<int>& in_lens, const std::vector<int>& out_lens) const
+    {
+        using miopen::solver::reduce::PerformanceConfigGenericReduction;
+
+        const auto ctx    = context(in_lens, out_lens);
+        const auto solver = miopen::solver::reduce::GenericReduction{};
+        EXPECT(solver.IsApplicable(ctx));
+
+        const auto workspace_size = solver.GetWorkspaceSize(ctx);
+        EXPECT(workspace_size ==
+               reduce.GetWorkspaceSize(ctx.GetStream(), ctx.GetADesc(), ctx.GetCDesc()));
+
+        const auto heuristic = solver.GetPerformanceConfig(ctx);
+        EXPECT(solver.IsValidPerformanceConfig(ctx, heuristic));
+
+        auto restored = PerformanceConfigGenericReduction{};
+        EXPECT(restored.Deserialize(heuristic.ToString()));
+        EXPECT(restored == heuristic);
+
+        auto config   = PerformanceConfigGenericReduction{true};
+        int n_valid   = 0;
+        bool finished = false;
+        while(!finished)
+        {
+            if(config.IsValid(ctx))
+            {
+                const auto solution  = solver.GetSolution(ctx, config, true);
+                const auto n_kernels = solution.construction_params.size();
+                EXPECT(n_kernels == 2 || n_kernels == 4);
+                EXPECT(solution.workspce_sz == workspace_size);
+                for(const auto& kernel : solution.construction_params)
+                    EXPECT(kernel.l_wk[0] == static_cast<std::size_t>(config.BlockSize));
+                ++n_valid;
+            }
+            finished = !config.SetNextValue(ctx);
+        }
+        EXPECT(n_valid > 1);
+    }
+
+    void run() const
+    {
+        const auto solver = miopen::solver::reduce::GenericReduction{};
+        const auto wave   = static_cast<int>(get_handle().GetWavefrontWidth());
+
+        // Skinny: each thread reduces a short row, the heuristic shortens its buffer to match.
+        check({256, 3}, {256, 1});
+        EXPECT(solver.GetPerformanceConfig(context({256, 3}, {256, 1})).GredThreadBufferLength ==
+               4);
+
+        // Very long rows are split between blocks, the heuristic picks larger blocks.
+        check({2, 1 << 20}, {2, 1});
+        EXPECT(solver.GetPerformanceConfig(context({2, 1 << 20}, {2, 1})).BlockSize == 512);
+
+        check({8, 16, 32, 32}, {1, 16, 1, 1});
+        check({4, 8, 16}, {1, 1, 1});
+        check({64, 2 * wave}, {64, 1});
+    }
+};
+
+int main() { reduce_perf_config_test{}.run(); }
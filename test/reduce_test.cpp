@@ -190,10 +190,10 @@ struct verify_reduce_with_indices
         using reduce::ReduceOpFn2;
         using reduce::ReduceOpZeroVal;
 
-        auto inLengths  = input.desc.GetLengths();
-        auto outLengths = output.desc.GetLengths();
-        auto inStrides  = input.desc.GetStrides();
-        auto outStrides = output.desc.GetStrides();
+        std::vector<std::size_t> inLengths  = input.desc.GetLengths();
+        std::vector<std::size_t> outLengths = output.desc.GetLengths();
+        std::vector<std::size_t> inStrides  = input.desc.GetStrides();
+        std::vector<std::size_t> outStrides = output.desc.GetStrides();
 
         // replicate
         auto res         = output;
@@ -484,10 +484,10 @@ struct verify_reduce_no_indices
         using reduce::ReduceOpFn;
         using reduce::ReduceOpZeroVal;
 
-        auto inLengths  = input.desc.GetLengths();
-        auto outLengths = output.desc.GetLengths();
-        auto inStrides  = input.desc.GetStrides();
-        auto outStrides = output.desc.GetStrides();
+        std::vector<std::size_t> inLengths  = input.desc.GetLengths();
+        std::vector<std::size_t> outLengths = output.desc.GetLengths();
+        std::vector<std::size_t> inStrides  = input.desc.GetStrides();
+        std::vector<std::size_t> outStrides = output.desc.GetStrides();
 
         // replicate
         auto res = output;
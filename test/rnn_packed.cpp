@@ -0,0 +1,243 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "get_handle.hpp"
+#include "rnn_seq_common.hpp"
+#include "test.hpp"
+#include "verify.hpp"
+
+#include <miopen/handle.hpp>
+#include <miopen/rnn.hpp>
+#include <miopen/rnn_packed.hpp>
+#include <miopen/tensor.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+// The packing only depends on the lengths, so it is checked on the host against the reference
+// gather. With a GPU the packed plan is compared with the RNN run on the same sequences sorted
+// and padded on the host.
+void check_packing()
+{
+    const auto lengths = std::vector<int>{3, 0, 5, 2, 5, 1};
+    const auto packing = miopen::RNNSequencePacking{lengths};
+
+    EXPECT(packing.GetSequenceCount() == 6);
+    EXPECT(packing.GetMaxLength() == 5);
+    EXPECT(packing.GetTotalLength() == 16);
+    EXPECT(packing.GetBatchSizes() == std::vector<int>({5, 4, 3, 2, 2}));
+    EXPECT(packing.GetOrder() == std::vector<int>({2, 4, 0, 3, 5, 1}));
+
+    // Each row holds (sequence, step) so that the sorted rows can be identified.
+    auto packed = std::vector<int>{};
+    for(int b = 0; b < packing.GetSequenceCount(); ++b)
+    {
+        EXPECT(packing.GetOffset(b) == static_cast<int>(packed.size()) / 2);
+        for(int t = 0; t < lengths[b]; ++t)
+        {
+            packed.push_back(b);
+            packed.push_back(t);
+        }
+    }
+
+    auto sorted = std::vector<int>(packed.size());
+    miopen::GatherRows(packed.data(), sorted.data(), packing.GetSortRows(), 2);
+    for(int t = 0; t < packing.GetMaxLength(); ++t)
+    {
+        for(int r = 0; r < packing.GetBatchSizes()[t]; ++r)
+        {
+            const auto row = packing.GetStepOffset(t) + r;
+            EXPECT(sorted[2 * row] == packing.GetOrder()[r]);
+            EXPECT(sorted[2 * row + 1] == t);
+        }
+    }
+
+    auto unsorted = std::vector<int>(packed.size());
+    miopen::GatherRows(sorted.data(), unsorted.data(), packing.GetUnsortRows(), 2);
+    EXPECT(unsorted == packed);
+
+    const int slices = 3;
+    auto states      = std::vector<int>(slices * packing.GetSequenceCount());
+    std::iota(states.begin(), states.end(), 0);
+    auto sorted_states = std::vector<int>(states.size());
+    miopen::GatherRows(states.data(), sorted_states.data(), packing.GetSortStateRows(slices), 1);
+    EXPECT(sorted_states[packing.GetSequenceCount() + 1] ==
+           packing.GetSequenceCount() + packing.GetOrder()[1]);
+    auto unsorted_states = std::vector<int>(states.size());
+    miopen::GatherRows(sorted_states.data(),
+                       unsorted_states.data(),
+                       packing.GetUnsortStateRows(slices),
+                       1);
+    EXPECT(unsorted_states == states);
+
+    // Equal lengths keep their order
+    EXPECT(miopen::RNNSequencePacking{{2, 2, 2}}.GetOrder() == std::vector<int>({0, 1, 2}));
+
+    EXPECT(throws([] { miopen::RNNSequencePacking{{}}; }));
+    EXPECT(throws([] { miopen::RNNSequencePacking{{2, -1}}; }));
+    EXPECT(throws([] { miopen::RNNSequencePacking{{0, 0}}; }));
+}
+
+#if !MIOPEN_MODE_NOGPU
+struct rnn_packed_test
+{
+    static constexpr int in_size = 8;
+    static constexpr int hidden  = 8;
+    static constexpr int layers  = 2;
+
+    std::vector<int> lengths = {3, 5, 2, 5, 1};
+    miopen::RNNSequencePacking packing{lengths};
+    miopen::RNNDescriptor rnn{hidden,
+                              layers,
+                              miopenLSTM,
+                              miopenRNNlinear,
+                              miopenRNNunidirection,
+                              miopenRNNwithBias,
+                              miopenRNNdefault,
+                              miopenFloat};
+    std::size_t sequences = lengths.size();
+    std::size_t rows      = packing.GetTotalLength();
+    miopen::TensorDescriptor x_desc{miopenFloat, {rows, in_size}};
+    miopen::TensorDescriptor y_desc{miopenFloat, {rows, hidden}};
+    miopen::TensorDescriptor hx_desc{miopenFloat, {layers, sequences, hidden}};
+    miopen::TensorDescriptor w_desc;
+
+    static std::vector<float>
+    gather(const std::vector<float>& src, const std::vector<int>& index, std::size_t row_size)
+    {
+        auto dst = std::vector<float>(index.size() * row_size);
+        miopen::GatherRows(src.data(), dst.data(), index, row_size);
+        return dst;
+    }
+
+    void run()
+    {
+        auto&& handle = get_handle();
+        const auto in_desc = miopen::TensorDescriptor{miopenFloat, {1, in_size}};
+        rnn.GetParamsDescriptor(handle, in_desc, w_desc, miopenFloat);
+
+        const auto states = hx_desc.GetElementSpace();
+        const auto x      = fixed_data(x_desc.GetElementSpace(), 1);
+        const auto hx     = fixed_data(states, 2);
+        const auto cx     = fixed_data(states, 3);
+        const auto w_dev  = handle.Write(fixed_data(w_desc.GetElementSpace(), 4));
+
+        // Reference: the RNN on the sequences sorted on the host
+        const rnn_seq_descs steps{packing.GetBatchSizes(), in_size, hidden};
+        const auto x_view = steps.x_view();
+        const auto y_view = steps.y_view();
+
+        const auto seq_len    = packing.GetMaxLength();
+        const auto ref_ws     = rnn.GetWorkspaceSize(handle, seq_len, x_view);
+        const auto sort_state = packing.GetSortStateRows(layers);
+        auto ref_x            = handle.Write(gather(x, packing.GetSortRows(), in_size));
+        auto ref_hx           = handle.Write(gather(hx, sort_state, hidden));
+        auto ref_cx           = handle.Write(gather(cx, sort_state, hidden));
+        auto ref_y            = handle.Write(std::vector<float>(y_desc.GetElementSpace()));
+        auto ref_hy           = handle.Write(std::vector<float>(states));
+        auto ref_cy           = handle.Write(std::vector<float>(states));
+        auto ref_workspace    = handle.Write(std::vector<char>(ref_ws));
+        rnn.RNNForwardInference(handle,
+                                seq_len,
+                                x_view,
+                                ref_x.get(),
+                                hx_desc,
+                                ref_hx.get(),
+                                hx_desc,
+                                ref_cx.get(),
+                                w_desc,
+                                w_dev.get(),
+                                y_view,
+                                ref_y.get(),
+                                hx_desc,
+                                ref_hy.get(),
+                                hx_desc,
+                                ref_cy.get(),
+                                ref_workspace.get(),
+                                ref_ws);
+        const auto unsort_state = packing.GetUnsortStateRows(layers);
+        const auto expected_y =
+            gather(handle.Read<float>(ref_y, rows * hidden), packing.GetUnsortRows(), hidden);
+        const auto expected_hy = gather(handle.Read<float>(ref_hy, states), unsort_state, hidden);
+        const auto expected_cy = gather(handle.Read<float>(ref_cy, states), unsort_state, hidden);
+
+        auto plan = miopen::RNNPackedPlan{handle, rnn, lengths, x_desc, hx_desc, w_desc, y_desc};
+        const auto ws = plan.GetWorkspaceSize();
+        EXPECT(ws >= ref_ws);
+
+        const auto x_dev  = handle.Write(x);
+        const auto hx_dev = handle.Write(hx);
+        const auto cx_dev = handle.Write(cx);
+        // The second execution replays the recorded launches of the RNN plan
+        for(int i = 0; i < 2; ++i)
+        {
+            auto y_dev     = handle.Write(std::vector<float>(y_desc.GetElementSpace()));
+            auto hy_dev    = handle.Write(std::vector<float>(states));
+            auto cy_dev    = handle.Write(std::vector<float>(states));
+            auto workspace = handle.Write(std::vector<char>(ws));
+            plan.ForwardInference(handle,
+                                  x_dev.get(),
+                                  hx_dev.get(),
+                                  cx_dev.get(),
+                                  w_dev.get(),
+                                  y_dev.get(),
+                                  hy_dev.get(),
+                                  cy_dev.get(),
+                                  workspace.get(),
+                                  ws);
+            EXPECT(miopen::rms_range(expected_y, handle.Read<float>(y_dev, rows * hidden)) < 1e-6);
+            EXPECT(miopen::rms_range(expected_hy, handle.Read<float>(hy_dev, states)) < 1e-6);
+            EXPECT(miopen::rms_range(expected_cy, handle.Read<float>(cy_dev, states)) < 1e-6);
+        }
+
+        EXPECT(throws([&] {
+            plan.ForwardInference(handle,
+                                  x_dev.get(),
+                                  nullptr,
+                                  nullptr,
+                                  w_dev.get(),
+                                  nullptr,
+                                  nullptr,
+                                  nullptr,
+                                  nullptr,
+                                  0);
+        }));
+        EXPECT(throws([&] {
+            miopen::RNNPackedPlan{handle, rnn, {3, 3}, x_desc, hx_desc, w_desc, y_desc};
+        }));
+    }
+};
+#endif
+
+int main()
+{
+    check_packing();
+#if !MIOPEN_MODE_NOGPU
+    rnn_packed_test{}.run();
+#endif
+}
@@ -0,0 +1,284 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "get_handle.hpp"
+#include "rnn_seq_common.hpp"
+#include "test.hpp"
+#include "verify.hpp"
+
+#include <miopen/handle.hpp>
+#include <miopen/rnn.hpp>
+#include <miopen/rnn_plan.hpp>
+#include <miopen/tensor.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// A bidirectional two-layer LSTM with decreasing batch sizes. With a GPU every pass of the plan
+// is compared with the matching RNNDescriptor call, twice and on different buffers so that the
+// second execution goes through the recorded launches. Without a GPU only the recording is
+// checked.
+struct rnn_plan_test : rnn_seq_descs
+{
+    static constexpr int seq_len = 4;
+    static constexpr int in_size = 8;
+    static constexpr int hidden  = 8;
+    static constexpr int layers  = 2;
+
+    miopen::RNNDescriptor rnn{hidden,
+                              layers,
+                              miopenLSTM,
+                              miopenRNNlinear,
+                              miopenRNNbidirection,
+                              miopenRNNwithBias,
+                              miopenRNNdefault,
+                              miopenFloat};
+    miopen::TensorDescriptor hx_desc{miopenFloat, {2 * layers, 4, hidden}};
+    miopen::TensorDescriptor w_desc;
+
+    rnn_plan_test() : rnn_seq_descs({4, 3, 3, 2}, in_size, 2 * hidden) {}
+
+    static std::size_t elements(const miopen::TensorDescriptor& desc)
+    {
+        return desc.GetElementSpace();
+    }
+
+#if !MIOPEN_MODE_NOGPU
+    // The buffers of all the passes, with the inputs set to fixed values.
+    struct Buffers
+    {
+        Buffers(miopen::Handle& handle, const rnn_plan_test& t, std::size_t ws, std::size_t rs)
+            : x(handle.Write(fixed_data(t.x_elements(), 1))),
+              hx(handle.Write(fixed_data(elements(t.hx_desc), 2))),
+              cx(handle.Write(fixed_data(elements(t.hx_desc), 3))),
+              w(handle.Write(fixed_data(elements(t.w_desc), 4))),
+              dy(handle.Write(fixed_data(t.y_elements(), 5))),
+              dhy(handle.Write(fixed_data(elements(t.hx_desc), 6))),
+              dcy(handle.Write(fixed_data(elements(t.hx_desc), 7))),
+              y(handle.Write(std::vector<float>(t.y_elements()))),
+              hy(handle.Write(std::vector<float>(elements(t.hx_desc)))),
+              cy(handle.Write(std::vector<float>(elements(t.hx_desc)))),
+              dx(handle.Write(std::vector<float>(t.x_elements()))),
+              dhx(handle.Write(std::vector<float>(elements(t.hx_desc)))),
+              dcx(handle.Write(std::vector<float>(elements(t.hx_desc)))),
+              dw(handle.Write(std::vector<float>(elements(t.w_desc)))),
+              workspace(handle.Write(std::vector<char>(ws))),
+              reserve(handle.Write(std::vector<char>(rs)))
+        {
+        }
+
+        miopen::Allocator::ManageDataPtr x, hx, cx, w, dy, dhy, dcy;
+        miopen::Allocator::ManageDataPtr y, hy, cy, dx, dhx, dcx, dw;
+        miopen::Allocator::ManageDataPtr workspace, reserve;
+    };
+
+    void direct(miopen::Handle& handle, Buffers& b, std::size_t ws, std::size_t rs) const
+    {
+        rnn.RNNForwardTraining(handle,
+                               seq_len,
+                               x_view(),
+                               b.x.get(),
+                               hx_desc,
+                               b.hx.get(),
+                               hx_desc,
+                               b.cx.get(),
+                               w_desc,
+                               b.w.get(),
+                               y_view(),
+                               b.y.get(),
+                               hx_desc,
+                               b.hy.get(),
+                               hx_desc,
+                               b.cy.get(),
+                               b.workspace.get(),
+                               ws,
+                               b.reserve.get(),
+                               rs);
+        rnn.RNNBackwardData(handle,
+                            seq_len,
+                            y_view(),
+                            b.y.get(),
+                            y_view(),
+                            b.dy.get(),
+                            hx_desc,
+                            b.dhy.get(),
+                            hx_desc,
+                            b.dcy.get(),
+                            w_desc,
+                            b.w.get(),
+                            hx_desc,
+                            b.hx.get(),
+                            hx_desc,
+                            b.cx.get(),
+                            x_view(),
+                            b.dx.get(),
+                            hx_desc,
+                            b.dhx.get(),
+                            hx_desc,
+                            b.dcx.get(),
+                            b.workspace.get(),
+                            ws,
+                            b.reserve.get(),
+                            rs);
+        rnn.RNNBackwardWeights(handle,
+                               seq_len,
+                               x_view(),
+                               b.x.get(),
+                               hx_desc,
+                               b.hx.get(),
+                               y_view(),
+                               b.y.get(),
+                               w_desc,
+                               b.dw.get(),
+                               b.workspace.get(),
+                               ws,
+                               b.reserve.get(),
+                               rs);
+    }
+
+    static void planned(miopen::Handle& handle,
+                        miopen::RNNPlan& plan,
+                        Buffers& b,
+                        std::size_t ws,
+                        std::size_t rs)
+    {
+        plan.ForwardTraining(handle,
+                             b.x.get(),
+                             b.hx.get(),
+                             b.cx.get(),
+                             b.w.get(),
+                             b.y.get(),
+                             b.hy.get(),
+                             b.cy.get(),
+                             b.workspace.get(),
+                             ws,
+                             b.reserve.get(),
+                             rs);
+        plan.BackwardData(handle,
+                          b.y.get(),
+                          b.dy.get(),
+                          b.dhy.get(),
+                          b.dcy.get(),
+                          b.w.get(),
+                          b.hx.get(),
+                          b.cx.get(),
+                          b.dx.get(),
+                          b.dhx.get(),
+                          b.dcx.get(),
+                          b.workspace.get(),
+                          ws,
+                          b.reserve.get(),
+                          rs);
+        plan.BackwardWeights(handle,
+                             b.x.get(),
+                             b.hx.get(),
+                             b.y.get(),
+                             b.dw.get(),
+                             b.workspace.get(),
+                             ws,
+                             b.reserve.get(),
+                             rs);
+    }
+
+    void compare(miopen::Handle& handle, const Buffers& ref, const Buffers& out) const
+    {
+        auto check = [&](const miopen::Allocator::ManageDataPtr& r,
+                         const miopen::Allocator::ManageDataPtr& o,
+                         std::size_t n) {
+            const auto rv = handle.Read<float>(r, n);
+            const auto ov = handle.Read<float>(o, n);
+            EXPECT(miopen::rms_range(rv, ov) < 1e-6);
+        };
+        check(ref.y, out.y, y_elements());
+        check(ref.hy, out.hy, elements(hx_desc));
+        check(ref.cy, out.cy, elements(hx_desc));
+        check(ref.dx, out.dx, x_elements());
+        check(ref.dhx, out.dhx, elements(hx_desc));
+        check(ref.dcx, out.dcx, elements(hx_desc));
+        check(ref.dw, out.dw, elements(w_desc));
+    }
+#endif
+
+    void run()
+    {
+        auto&& handle = get_handle();
+        rnn.GetParamsDescriptor(handle, x_descs.front(), w_desc, miopenFloat);
+
+        auto plan = miopen::RNNPlan{handle, rnn, seq_len, x_view(), hx_desc, w_desc, y_view()};
+        const auto ws = plan.GetWorkspaceSize();
+        const auto rs = plan.GetReserveSize();
+        EXPECT(ws == rnn.GetWorkspaceSize(handle, seq_len, x_view()));
+        EXPECT(rs == rnn.GetReserveSize(handle, seq_len, x_view()));
+        EXPECT(throws([&] {
+            plan.ForwardInference(
+                handle, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0);
+        }));
+
+#if MIOPEN_MODE_NOGPU
+        // Nothing runs without a GPU: the buffers are never accessed.
+        auto placeholder = [](std::uintptr_t i) { return reinterpret_cast<void*>(i << 24); };
+        for(int i = 0; i < 2; ++i)
+        {
+            plan.ForwardInference(handle,
+                                  placeholder(1),
+                                  placeholder(2),
+                                  placeholder(3),
+                                  placeholder(4),
+                                  placeholder(5),
+                                  placeholder(6),
+                                  placeholder(7),
+                                  placeholder(8),
+                                  ws);
+        }
+        const auto recorded = plan.GetRecordedLaunchCount();
+        EXPECT(recorded > 0);
+        // A different set of NULL buffers is a separate recording.
+        plan.ForwardInference(handle,
+                              placeholder(1),
+                              nullptr,
+                              nullptr,
+                              placeholder(4),
+                              placeholder(5),
+                              nullptr,
+                              nullptr,
+                              placeholder(8),
+                              ws);
+        EXPECT(plan.GetRecordedLaunchCount() > recorded);
+#else
+        auto ref = Buffers{handle, *this, ws, rs};
+        direct(handle, ref, ws, rs);
+        for(int i = 0; i < 2; ++i)
+        {
+            auto out = Buffers{handle, *this, ws, rs};
+            planned(handle, plan, out, ws, rs);
+            compare(handle, ref, out);
+        }
+#endif
+    }
+};
+
+int main() { rnn_plan_test{}.run(); }
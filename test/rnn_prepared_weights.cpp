@@ -0,0 +1,279 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "get_handle.hpp"
+#include "rnn_seq_common.hpp"
+#include "test.hpp"
+#include "verify.hpp"
+
+#include <miopen/handle.hpp>
+#include <miopen/rnn.hpp>
+#include <miopen/tensor.hpp>
+
+#include <half.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+// The weight matrices of every layer must cover exactly the same elements in both layouts, the
+// prepared layout only reorders them. With a GPU, forward inference with prepared weights is
+// compared with the canonical weights, and the layer parameters are read and written through
+// the prepared layout.
+
+std::vector<std::size_t> param_elements(const miopen::RNNDescriptor& rnn,
+                                        const miopen::TensorDescriptor& x_desc)
+{
+    const int bi     = rnn.dirMode == miopenRNNbidirection ? 2 : 1;
+    const int params = 2 * static_cast<int>(rnn.nHiddenTensorsPerLayer);
+    std::vector<std::size_t> elements;
+    for(int layer = 0; layer < bi * static_cast<int>(rnn.nLayers); ++layer)
+    {
+        for(int id = 0; id < params; ++id)
+        {
+            if(rnn.inputMode == miopenRNNskip && layer < bi && id < params / 2)
+                continue;
+            miopen::TensorDescriptor view;
+            const auto offset = rnn.paramsViewCalculation(x_desc, layer, id, view);
+            EXPECT(view.GetLengths()[0] == rnn.hsize);
+            for(std::size_t r = 0; r < view.GetLengths()[0]; ++r)
+            {
+                for(std::size_t c = 0; c < view.GetLengths()[1]; ++c)
+                    elements.push_back(offset + view.GetIndex(r, c));
+            }
+        }
+    }
+    std::sort(elements.begin(), elements.end());
+    return elements;
+}
+
+void check_layout(miopenRNNMode_t mode, miopenRNNDirectionMode_t dir, miopenRNNInputMode_t input)
+{
+    const int hidden          = 4;
+    const std::size_t in_size = input == miopenRNNskip ? hidden : 3;
+    miopen::RNNDescriptor rnn{
+        hidden, 3, mode, input, dir, miopenRNNwithBias, miopenRNNdefault, miopenFloat};
+    const auto x_desc = miopen::TensorDescriptor{miopenFloat, {2, in_size}};
+
+    const auto canonical = param_elements(rnn, x_desc);
+    auto expected        = std::vector<std::size_t>(canonical.size());
+    std::iota(expected.begin(), expected.end(), 0);
+    EXPECT(canonical == expected);
+
+    for(int layer = 0; layer < 2; ++layer)
+    {
+        const int id = static_cast<int>(rnn.nHiddenTensorsPerLayer);
+        miopen::TensorDescriptor view;
+        const auto offset = rnn.paramsViewCalculation(x_desc, layer, id, view);
+        EXPECT(view.IsPacked());
+        EXPECT(offset == rnn.paramsOffsetCalculation(x_desc, layer, id));
+    }
+
+    rnn.weightLayout = miopenRNNWeightsPrepared;
+    EXPECT(param_elements(rnn, x_desc) == canonical);
+
+    // The matrices of a prepared hidden state block are interleaved along its rows
+    miopen::TensorDescriptor view;
+    rnn.paramsViewCalculation(x_desc, 0, static_cast<int>(rnn.nHiddenTensorsPerLayer), view);
+    EXPECT(view.GetStrides()[0] == 1);
+    EXPECT(view.GetStrides()[1] == rnn.nHiddenTensorsPerLayer * hidden);
+
+    miopen::TensorDescriptor param_desc;
+    std::size_t param_offset = 0;
+    rnn.GetLayerParamOffset(2, x_desc, 1, param_desc, nullptr);
+    EXPECT(param_desc.IsPacked());
+    EXPECT(throws([&] { rnn.GetLayerParamOffset(2, x_desc, 1, param_desc, &param_offset); }));
+}
+
+#if !MIOPEN_MODE_NOGPU
+struct rnn_prepared_test : rnn_seq_descs
+{
+    static constexpr int in_size = 6;
+    static constexpr int hidden  = 8;
+    static constexpr int layers  = 2;
+    static constexpr int batch   = 3;
+    static constexpr int seq_len = 4;
+
+    miopen::RNNDescriptor rnn;
+    const miopen::TensorDescriptor& x_step = x_descs.front();
+    miopen::TensorDescriptor hx_desc;
+    miopen::TensorDescriptor w_desc;
+
+    rnn_prepared_test(miopenRNNMode_t mode, miopenRNNDirectionMode_t dir)
+        : rnn_seq_descs(std::vector<int>(seq_len, batch),
+                        in_size,
+                        (dir == miopenRNNbidirection ? 2 : 1) * hidden),
+          rnn{hidden,
+              layers,
+              mode,
+              miopenRNNlinear,
+              dir,
+              miopenRNNwithBias,
+              miopenRNNdefault,
+              miopenFloat}
+    {
+        const std::size_t bi = dir == miopenRNNbidirection ? 2 : 1;
+        hx_desc = miopen::TensorDescriptor{miopenFloat, {bi * layers, batch, hidden}};
+    }
+
+    std::vector<float> forward(miopen::Handle& handle, ConstData_t w)
+    {
+        const auto ws     = rnn.GetWorkspaceSize(handle, seq_len, x_view());
+        const auto states = hx_desc.GetElementSize();
+
+        auto x         = handle.Write(fixed_data(x_elements(), 1));
+        auto hx        = handle.Write(fixed_data(states, 2));
+        auto cx        = handle.Write(fixed_data(states, 3));
+        auto y         = handle.Write(std::vector<float>(y_elements()));
+        auto hy        = handle.Write(std::vector<float>(states));
+        auto cy        = handle.Write(std::vector<float>(states));
+        auto workspace = handle.Write(std::vector<char>(ws));
+        rnn.RNNForwardInference(handle,
+                                seq_len,
+                                x_view(),
+                                x.get(),
+                                hx_desc,
+                                hx.get(),
+                                hx_desc,
+                                cx.get(),
+                                w_desc,
+                                w,
+                                y_view(),
+                                y.get(),
+                                hx_desc,
+                                hy.get(),
+                                hx_desc,
+                                cy.get(),
+                                workspace.get(),
+                                ws);
+
+        auto result = handle.Read<float>(y, y_elements());
+        auto hy_out = handle.Read<float>(hy, states);
+        result.insert(result.end(), hy_out.begin(), hy_out.end());
+        return result;
+    }
+
+    void run()
+    {
+        auto&& handle = get_handle();
+        rnn.GetParamsDescriptor(handle, x_step, w_desc, miopenFloat);
+        const auto w_size = w_desc.GetElementSize();
+        const auto w_host = fixed_data(w_size, 4);
+        auto w            = handle.Write(w_host);
+        auto prepared     = handle.Write(std::vector<float>(w_size));
+        rnn.PrepareWeights(handle, x_step, w_desc, w.get(), w_desc, prepared.get());
+
+        const auto expected = forward(handle, w.get());
+        rnn.weightLayout    = miopenRNNWeightsPrepared;
+        EXPECT(miopen::rms_range(expected, forward(handle, prepared.get())) < 1e-6);
+
+        // Parameters read from the prepared weights match the canonical ones, and a parameter
+        // written through the prepared layout lands where forward inference reads it.
+        const int layer = 1;
+        const int id    = static_cast<int>(rnn.nHiddenTensorsPerLayer) + 1;
+        miopen::TensorDescriptor param_desc;
+        rnn.GetLayerParam(handle, layer, x_step, w_desc, prepared.get(), id, param_desc, nullptr);
+        const auto param_size = param_desc.GetElementSize();
+        auto param            = handle.Write(std::vector<float>(param_size));
+        rnn.GetLayerParam(
+            handle, layer, x_step, w_desc, prepared.get(), id, param_desc, param.get());
+        const auto offset = rnn.paramsOffsetCalculation(x_step, layer, id);
+        const auto canonical_param =
+            std::vector<float>(w_host.begin() + offset, w_host.begin() + offset + param_size);
+        EXPECT(miopen::rms_range(canonical_param, handle.Read<float>(param, param_size)) == 0);
+
+        const auto new_param = fixed_data(param_size, 5);
+        param                = handle.Write(new_param);
+        rnn.SetLayerParam(
+            handle, layer, x_step, w_desc, prepared.get(), id, param_desc, param.get());
+        auto w_updated = w_host;
+        std::copy(new_param.begin(), new_param.end(), w_updated.begin() + offset);
+        w = handle.Write(w_updated);
+
+        rnn.weightLayout   = miopenRNNWeightsCanonical;
+        const auto updated = forward(handle, w.get());
+        rnn.weightLayout   = miopenRNNWeightsPrepared;
+        EXPECT(miopen::rms_range(updated, forward(handle, prepared.get())) < 1e-6);
+    }
+};
+
+// Half precision weights prepared from single precision ones
+void check_half_prepare()
+{
+    auto&& handle = get_handle();
+    miopen::RNNDescriptor rnn{4,
+                              1,
+                              miopenLSTM,
+                              miopenRNNlinear,
+                              miopenRNNunidirection,
+                              miopenRNNwithBias,
+                              miopenRNNdefault,
+                              miopenHalf};
+    const auto x_desc = miopen::TensorDescriptor{miopenHalf, {2, 3}};
+    miopen::TensorDescriptor w_desc;
+    rnn.GetParamsDescriptor(handle, x_desc, w_desc, miopenHalf);
+    const auto w_size  = w_desc.GetElementSize();
+    const auto w_host  = fixed_data(w_size, 6);
+    const auto w_float = miopen::TensorDescriptor{miopenFloat, {w_size}};
+    auto w             = handle.Write(w_host);
+    auto prepared      = handle.Write(std::vector<half_float::half>(w_size));
+    rnn.PrepareWeights(handle, x_desc, w_float, w.get(), w_desc, prepared.get());
+    EXPECT(throws([&] {
+        rnn.PrepareWeights(handle, x_desc, w_float, w.get(), w_float, prepared.get());
+    }));
+
+    rnn.weightLayout = miopenRNNWeightsPrepared;
+    miopen::TensorDescriptor param_desc;
+    rnn.GetLayerParam(handle, 0, x_desc, w_desc, prepared.get(), 2, param_desc, nullptr);
+    const auto param_size = param_desc.GetElementSize();
+    auto param            = handle.Write(std::vector<half_float::half>(param_size));
+    rnn.GetLayerParam(handle, 0, x_desc, w_desc, prepared.get(), 2, param_desc, param.get());
+    const auto offset = rnn.paramsOffsetCalculation(x_desc, 0, 2);
+    const auto actual = handle.Read<half_float::half>(param, param_size);
+    for(std::size_t i = 0; i < param_size; ++i)
+        EXPECT(std::abs(static_cast<float>(actual[i]) - w_host[offset + i]) < 1e-3);
+}
+#endif
+
+int main()
+{
+    for(auto mode : {miopenRNNTANH, miopenLSTM, miopenGRU})
+    {
+        for(auto dir : {miopenRNNunidirection, miopenRNNbidirection})
+        {
+            check_layout(mode, dir, miopenRNNlinear);
+            check_layout(mode, dir, miopenRNNskip);
+#if !MIOPEN_MODE_NOGPU
+            rnn_prepared_test{mode, dir}.run();
+#endif
+        }
+    }
+#if !MIOPEN_MODE_NOGPU
+    check_half_prepare();
+#endif
+}
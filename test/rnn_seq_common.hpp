@@ -0,0 +1,86 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+
+#ifndef GUARD_MIOPEN_TEST_RNN_SEQ_COMMON_HPP
+#define GUARD_MIOPEN_TEST_RNN_SEQ_COMMON_HPP
+
+#include "fixed_data.hpp"
+
+#include <miopen/rnn.hpp>
+#include <miopen/tensor.hpp>
+
+#include <cstddef>
+#include <vector>
+
+// The input and output descriptors of the steps of a sequence, with the arrays of handles the
+// RNN calls take. The handles point into the descriptors, so the fixture is not copyable.
+struct rnn_seq_descs
+{
+    std::vector<miopen::TensorDescriptor> x_descs;
+    std::vector<miopen::TensorDescriptor> y_descs;
+    std::vector<miopenTensorDescriptor_t> x_handles;
+    std::vector<miopenTensorDescriptor_t> y_handles;
+
+    rnn_seq_descs(const std::vector<int>& batches, int in_size, int out_size)
+    {
+        for(const auto batch : batches)
+        {
+            x_descs.emplace_back(miopenFloat, std::vector<int>{batch, in_size});
+            y_descs.emplace_back(miopenFloat, std::vector<int>{batch, out_size});
+        }
+        for(auto& desc : x_descs)
+            x_handles.push_back(&desc);
+        for(auto& desc : y_descs)
+            y_handles.push_back(&desc);
+    }
+
+    rnn_seq_descs(const rnn_seq_descs&) = delete;
+    rnn_seq_descs& operator=(const rnn_seq_descs&) = delete;
+
+    miopen::c_array_view<const miopenTensorDescriptor_t> x_view() const
+    {
+        return {x_handles.data(), x_handles.size()};
+    }
+
+    miopen::c_array_view<const miopenTensorDescriptor_t> y_view() const
+    {
+        return {y_handles.data(), y_handles.size()};
+    }
+
+    std::size_t x_elements() const { return element_space(x_descs); }
+    std::size_t y_elements() const { return element_space(y_descs); }
+
+    static std::size_t element_space(const std::vector<miopen::TensorDescriptor>& descs)
+    {
+        std::size_t n = 0;
+        for(const auto& desc : descs)
+            n += desc.GetElementSpace();
+        return n;
+    }
+};
+
+#endif // GUARD_MIOPEN_TEST_RNN_SEQ_COMMON_HPP
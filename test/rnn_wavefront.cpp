@@ -0,0 +1,266 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "get_handle.hpp"
+#include "rnn_seq_common.hpp"
+#include "test.hpp"
+
+#include <miopen/handle.hpp>
+#include <miopen/launch_list.hpp>
+#include <miopen/rnn.hpp>
+#include <miopen/rnn_wavefront.hpp>
+#include <miopen/tensor.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Replays the program of a schedule and checks that every task only runs after all its
+// dependencies are visible on its stream, either because they ran earlier on the same stream or
+// through an event recorded after them.
+void check_schedule(int layers, int seq_len, std::size_t streams)
+{
+    const miopen::RNNWavefrontSchedule schedule{layers, seq_len, streams};
+    const auto& tasks = schedule.GetTasks();
+    const auto& edges = schedule.GetEdges();
+
+    EXPECT(schedule.GetStreamCount() == std::min<std::size_t>(streams, layers));
+    EXPECT(tasks.size() == static_cast<std::size_t>(layers * seq_len));
+    const auto edge_count = layers * (seq_len - 1) + (layers - 1);
+    EXPECT(edges.size() == static_cast<std::size_t>(edge_count));
+
+    std::vector<std::set<std::size_t>> visible(schedule.GetStreamCount());
+    std::vector<std::set<std::size_t>> events(schedule.GetEventCount());
+    std::vector<int> runs(tasks.size(), 0);
+    for(const auto& op : schedule.GetProgram())
+    {
+        EXPECT(op.stream < schedule.GetStreamCount());
+        auto& seen = visible[op.stream];
+        switch(op.kind)
+        {
+        case miopen::RNNWavefrontOp::Fork:
+        case miopen::RNNWavefrontOp::Join: break;
+        case miopen::RNNWavefrontOp::Wait:
+            seen.insert(events.at(op.event).begin(), events.at(op.event).end());
+            break;
+        case miopen::RNNWavefrontOp::Record: events.at(op.event) = seen; break;
+        case miopen::RNNWavefrontOp::Run:
+            EXPECT(tasks[op.task].stream == op.stream);
+            for(const auto& edge : edges)
+            {
+                if(edge.to == op.task)
+                    EXPECT(seen.count(edge.from) == 1);
+            }
+            seen.insert(op.task);
+            ++runs[op.task];
+            break;
+        }
+    }
+    for(const auto count : runs)
+        EXPECT(count == 1);
+
+    // A layer starts from the whole output of the layer below
+    for(const auto& edge : edges)
+    {
+        const auto& from = tasks[edge.from];
+        const auto& to   = tasks[edge.to];
+        if(from.layer == to.layer)
+            EXPECT(from.step + 1 == to.step);
+        else
+            EXPECT(from.layer + 1 == to.layer && from.step + 1 == seq_len && to.step == 0);
+    }
+
+    std::ostringstream first, second;
+    first << schedule;
+    second << miopen::RNNWavefrontSchedule{layers, seq_len, streams};
+    EXPECT(first.str() == second.str());
+}
+
+// A unidirectional three-layer LSTM with decreasing batch sizes run with and without the
+// wavefront. Without a GPU the launches are captured instead.
+struct rnn_wavefront_test : rnn_seq_descs
+{
+    static constexpr int seq_len = 5;
+    static constexpr int in_size = 8;
+    static constexpr int hidden  = 8;
+    static constexpr int layers  = 3;
+
+    miopen::RNNDescriptor rnn{hidden,
+                              layers,
+                              miopenLSTM,
+                              miopenRNNlinear,
+                              miopenRNNunidirection,
+                              miopenRNNwithBias,
+                              miopenRNNdefault,
+                              miopenFloat};
+    miopen::TensorDescriptor hx_desc{miopenFloat, {layers, 4, hidden}};
+    miopen::TensorDescriptor w_desc;
+
+    rnn_wavefront_test() : rnn_seq_descs({4, 4, 3, 2, 2}, in_size, hidden) {}
+
+    void forward(miopen::Handle& handle,
+                 std::size_t streams,
+                 ConstData_t x,
+                 ConstData_t hx,
+                 ConstData_t cx,
+                 ConstData_t w,
+                 Data_t y,
+                 Data_t hy,
+                 Data_t cy,
+                 Data_t workspace,
+                 std::size_t ws)
+    {
+        rnn.wavefrontStreams = streams;
+        rnn.RNNForwardInference(handle,
+                                seq_len,
+                                x_view(),
+                                x,
+                                hx_desc,
+                                hx,
+                                hx_desc,
+                                cx,
+                                w_desc,
+                                w,
+                                y_view(),
+                                y,
+                                hx_desc,
+                                hy,
+                                hx_desc,
+                                cy,
+                                workspace,
+                                ws);
+    }
+
+#if MIOPEN_MODE_NOGPU
+    // Nothing runs without a GPU: the buffers are never accessed.
+    std::string captured(miopen::Handle& handle, std::size_t streams, std::size_t ws)
+    {
+        auto placeholder = [](std::uintptr_t i) { return reinterpret_cast<void*>(i << 24); };
+        handle.BeginCapture();
+        forward(handle,
+                streams,
+                placeholder(1),
+                placeholder(2),
+                placeholder(3),
+                placeholder(4),
+                placeholder(5),
+                placeholder(6),
+                placeholder(7),
+                placeholder(8),
+                ws);
+        std::ostringstream ss;
+        ss << handle.EndCapture();
+        return ss.str();
+    }
+#else
+    // Returns y, hy and cy back to back.
+    std::vector<float> computed(miopen::Handle& handle, std::size_t streams, bool with_hx)
+    {
+        const auto ws     = rnn.GetWorkspaceSize(handle, seq_len, x_view());
+        const auto states = hx_desc.GetElementSpace();
+        auto x            = handle.Write(fixed_data(x_elements(), 1));
+        auto hx           = handle.Write(fixed_data(states, 2));
+        auto cx           = handle.Write(fixed_data(states, 3));
+        auto w            = handle.Write(fixed_data(w_desc.GetElementSpace(), 4));
+        auto y            = handle.Write(std::vector<float>(y_elements()));
+        auto hy           = handle.Write(std::vector<float>(states));
+        auto cy           = handle.Write(std::vector<float>(states));
+        auto workspace    = handle.Write(std::vector<char>(ws));
+        forward(handle,
+                streams,
+                x.get(),
+                with_hx ? hx.get() : nullptr,
+                with_hx ? cx.get() : nullptr,
+                w.get(),
+                y.get(),
+                hy.get(),
+                cy.get(),
+                workspace.get(),
+                ws);
+
+        auto result       = handle.Read<float>(y, y_elements());
+        const auto hy_out = handle.Read<float>(hy, states);
+        const auto cy_out = handle.Read<float>(cy, states);
+        result.insert(result.end(), hy_out.begin(), hy_out.end());
+        result.insert(result.end(), cy_out.begin(), cy_out.end());
+        return result;
+    }
+#endif
+
+    void run()
+    {
+        auto&& handle = get_handle();
+        rnn.GetParamsDescriptor(handle, x_descs.front(), w_desc, miopenFloat);
+
+#if MIOPEN_MODE_NOGPU
+        const auto ws     = rnn.GetWorkspaceSize(handle, seq_len, x_view());
+        const auto serial = captured(handle, 1, ws);
+        EXPECT(serial == captured(handle, 2, ws));
+        EXPECT(serial == captured(handle, 3, ws));
+        EXPECT(serial == captured(handle, 0, ws));
+#else
+        for(const bool with_hx : {true, false})
+        {
+            const auto serial = computed(handle, 0, with_hx);
+            // The same kernels on the same data for every number of streams
+            for(const std::size_t streams : {1, 2, 3})
+            {
+                const auto wavefront = computed(handle, streams, with_hx);
+                EXPECT(std::equal(serial.begin(), serial.end(), wavefront.begin()));
+            }
+        }
+
+        // The handle gets its own stream back after each wavefront, so that the work issued
+        // after two of them in a row still runs on it.
+        const auto stream = handle.GetStream();
+        const auto first  = computed(handle, 3, true);
+        EXPECT(computed(handle, 3, true) == first);
+        EXPECT(handle.GetStream() == stream);
+        EXPECT(computed(handle, 1, true) == first);
+#endif
+    }
+};
+
+int main()
+{
+    for(const int layers : {1, 2, 3, 5})
+    {
+        for(const int seq_len : {1, 2, 7})
+        {
+            for(const std::size_t streams : {1, 2, 3, 8})
+                check_schedule(layers, seq_len, streams);
+        }
+    }
+    EXPECT(throws([] { miopen::RNNWavefrontSchedule(0, 1, 1); }));
+    EXPECT(throws([] { miopen::RNNWavefrontSchedule(1, 0, 1); }));
+    EXPECT(throws([] { miopen::RNNWavefrontSchedule(1, 1, 0); }));
+
+    rnn_wavefront_test{}.run();
+}
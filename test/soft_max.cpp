@@ -40,19 +40,12 @@
 #include "driver.hpp"
 #include "get_handle.hpp"
 #include "tensor_holder.hpp"
+#include "cpu_softmax.hpp"
 #include "verify.hpp"
 
-#define NEGATIVE_CUTOFF_VAL_FP32 (-1e20)
-#define NEGATIVE_CUTOFF_VAL_FP16 (-1e4)
-
-template <typename T>
-T logaddexp(T x, T y, T neg_inf)
+static softmax_cpu_dims dims(const std::vector<std::size_t>& v)
 {
-    T a = std::max(x, y);
-    T b = std::min(x, y);
-    T c = b - a;
-
-    return c <= neg_inf ? std::max(a, neg_inf) : std::max(T(a + log(T(1) + exp(b - a))), neg_inf);
+    return {{v[0], v[1], v[2], v[3]}};
 }
 
 template <class T>
@@ -84,139 +77,15 @@ struct verify_forward_sofmax
     tensor<T> cpu() const
     {
         auto out = output;
-
-        int in_n, in_c, in_h, in_w;
-        std::tie(in_n, in_c, in_h, in_w) = miopen::tien<4>(input.desc.GetLengths());
-
-        int in_nstr, in_cstr, in_hstr;
-        std::tie(in_nstr, in_cstr, in_hstr, std::ignore) = miopen::tien<4>(input.desc.GetStrides());
-
-        int out_nstr, out_cstr, out_hstr;
-        std::tie(out_nstr, out_cstr, out_hstr, std::ignore) =
-            miopen::tien<4>(out.desc.GetStrides());
-
-        if(mode == MIOPEN_SOFTMAX_MODE_INSTANCE)
-            par_ford(in_n)([&](int o) {
-                if(algo == MIOPEN_SOFTMAX_FAST)
-                {
-                    double sum = 0;
-                    ford(in_c, in_h, in_w)([&](int w, int i, int j) {
-                        sum += std::exp(input[o * in_nstr + w * in_cstr + i * in_hstr + j]);
-                    });
-                    ford(in_c, in_h, in_w)([&](int w, int i, int j) {
-                        out[o * out_nstr + w * out_cstr + i * out_hstr + j] =
-                            alpha * (std::exp(input[o * in_nstr + w * in_cstr + i * in_hstr + j]) /
-                                     sum) +
-                            beta * out[o * out_nstr + w * out_cstr + i * out_hstr + j];
-                    });
-                }
-                else
-                {
-                    T max_c = std::numeric_limits<T>::lowest();
-                    ford(in_c, in_h, in_w)([&](int w, int i, int j) {
-                        max_c = std::max(max_c, input[o * in_nstr + w * in_cstr + i * in_hstr + j]);
-                    });
-
-                    if(algo == MIOPEN_SOFTMAX_LOG)
-                    {
-                        double neg_inf = input.desc.GetType() == miopenHalf
-                                             ? NEGATIVE_CUTOFF_VAL_FP16
-                                             : NEGATIVE_CUTOFF_VAL_FP32;
-                        double sum = neg_inf;
-                        ford(in_c, in_h, in_w)([&](int w, int i, int j) {
-                            sum = logaddexp(
-                                double(input[o * in_nstr + w * in_cstr + i * in_hstr + j] - max_c),
-                                sum,
-                                neg_inf);
-                        });
-
-                        ford(in_c, in_h, in_w)([&](int w, int i, int j) {
-                            out[o * out_nstr + w * out_cstr + i * out_hstr + j] =
-                                alpha * (input[o * in_nstr + w * in_cstr + i * in_hstr + j] -
-                                         max_c - sum) +
-                                beta * out[o * out_nstr + w * out_cstr + i * out_hstr + j];
-                        });
-                    }
-                    else
-                    {
-                        double sum = 0;
-                        ford(in_c, in_h, in_w)([&](int w, int i, int j) {
-                            sum += std::exp(input[o * in_nstr + w * in_cstr + i * in_hstr + j] -
-                                            max_c);
-                        });
-
-                        ford(in_c, in_h, in_w)([&](int w, int i, int j) {
-                            out[o * out_nstr + w * out_cstr + i * out_hstr + j] =
-                                alpha *
-                                    (std::exp(input[o * in_nstr + w * in_cstr + i * in_hstr + j] -
-                                              max_c) /
-                                     sum) +
-                                beta * out[o * out_nstr + w * out_cstr + i * out_hstr + j];
-                        });
-                    }
-                }
-            });
-        else
-            par_ford(in_n, in_h, in_w)([&](int o, int i, int j) {
-                if(algo == MIOPEN_SOFTMAX_FAST)
-                {
-                    double sum = 0;
-                    ford(in_c)([&](int w) {
-                        sum += std::exp(input[o * in_nstr + w * in_cstr + i * in_hstr + j]);
-                    });
-                    ford(in_c)([&](int w) {
-                        out[o * out_nstr + w * out_cstr + i * out_hstr + j] =
-                            alpha * (std::exp(input[o * in_nstr + w * in_cstr + i * in_hstr + j]) /
-                                     sum) +
-                            beta * out[o * out_nstr + w * out_cstr + i * out_hstr + j];
-                    });
-                }
-                else
-                {
-                    T max_c = std::numeric_limits<T>::lowest();
-                    ford(in_c)([&](int w) {
-                        max_c = std::max(max_c, input[o * in_nstr + w * in_cstr + i * in_hstr + j]);
-                    });
-
-                    if(algo == MIOPEN_SOFTMAX_LOG)
-                    {
-                        double neg_inf = input.desc.GetType() == miopenHalf
-                                             ? NEGATIVE_CUTOFF_VAL_FP16
-                                             : NEGATIVE_CUTOFF_VAL_FP32;
-                        double sum = neg_inf;
-                        ford(in_c)([&](int w) {
-                            sum = logaddexp(
-                                double(input[o * in_nstr + w * in_cstr + i * in_hstr + j] - max_c),
-                                sum,
-                                neg_inf);
-                        });
-
-                        ford(in_c)([&](int w) {
-                            out[o * out_nstr + w * out_cstr + i * out_hstr + j] =
-                                alpha * (input[o * in_nstr + w * in_cstr + i * in_hstr + j] -
-                                         max_c - sum) +
-                                beta * out[o * out_nstr + w * out_cstr + i * out_hstr + j];
-                        });
-                    }
-                    else
-                    {
-                        double sum = 0;
-                        ford(in_c)([&](int w) {
-                            sum += std::exp(input[o * in_nstr + w * in_cstr + i * in_hstr + j] -
-                                            max_c);
-                        });
-
-                        ford(in_c)([&](int w) {
-                            out[o * out_nstr + w * out_cstr + i * out_hstr + j] =
-                                alpha *
-                                    (std::exp(input[o * in_nstr + w * in_cstr + i * in_hstr + j] -
-                                              max_c) /
-                                     sum) +
-                                beta * out[o * out_nstr + w * out_cstr + i * out_hstr + j];
-                        });
-                    }
-                }
-            });
+        softmax_cpu_forward(dims(input.desc.GetLengths()),
+                            input.data.data(),
+                            dims(input.desc.GetStrides()),
+                            out.data.data(),
+                            dims(out.desc.GetStrides()),
+                            alpha,
+                            beta,
+                            algo,
+                            mode);
         return out;
     }
 
@@ -274,69 +143,17 @@ struct verify_backward_sofmax
     tensor<T> cpu() const
     {
         auto din = dinput;
-
-        int in_n, in_c, in_h, in_w;
-        std::tie(in_n, in_c, in_h, in_w) = miopen::tien<4>(din.desc.GetLengths());
-
-        int in_nstr, in_cstr, in_hstr;
-        std::tie(in_nstr, in_cstr, in_hstr, std::ignore) = miopen::tien<4>(din.desc.GetStrides());
-
-        int out_nstr, out_cstr, out_hstr;
-        std::tie(out_nstr, out_cstr, out_hstr, std::ignore) =
-            miopen::tien<4>(dout.desc.GetStrides());
-
-        if(mode == MIOPEN_SOFTMAX_MODE_INSTANCE)
-            par_ford(in_n)([&](int o) {
-                double sum = 0;
-                ford(in_c, in_h, in_w)([&](int c, int i, int j) {
-                    if(algo == MIOPEN_SOFTMAX_LOG)
-                        sum += dout[o * out_nstr + c * out_cstr + i * out_hstr + j];
-                    else
-                        sum += out[o * out_nstr + c * out_cstr + i * out_hstr + j] *
-                               dout[o * out_nstr + c * out_cstr + i * out_hstr + j];
-                });
-
-                ford(in_c, in_h, in_w)([&](int c, int i, int j) {
-                    if(algo == MIOPEN_SOFTMAX_LOG)
-                        din[o * in_nstr + c * in_cstr + i * in_hstr + j] =
-                            T(alpha *
-                                  (dout[o * out_nstr + c * out_cstr + i * out_hstr + j] -
-                                   sum * std::exp(
-                                             out[o * out_nstr + c * out_cstr + i * out_hstr + j])) +
-                              beta * din[o * in_nstr + c * in_cstr + i * in_hstr + j]);
-                    else
-                        din[o * in_nstr + c * in_cstr + i * in_hstr + j] =
-                            alpha * (out[o * out_nstr + c * out_cstr + i * out_hstr + j] *
-                                     (dout[o * out_nstr + c * out_cstr + i * out_hstr + j] - sum)) +
-                            beta * din[o * in_nstr + c * in_cstr + i * in_hstr + j];
-                });
-            });
-        else
-            par_ford(in_n, in_h, in_w)([&](int o, int i, int j) {
-                double sum = 0;
-                ford(in_c)([&](int c) {
-                    if(algo == MIOPEN_SOFTMAX_LOG)
-                        sum += dout[o * out_nstr + c * out_cstr + i * out_hstr + j];
-                    else
-                        sum += out[o * out_nstr + c * out_cstr + i * out_hstr + j] *
-                               dout[o * out_nstr + c * out_cstr + i * out_hstr + j];
-                });
-
-                ford(in_c)([&](int c) {
-                    if(algo == MIOPEN_SOFTMAX_LOG)
-                        din[o * in_nstr + c * in_cstr + i * in_hstr + j] =
-                            alpha *
-                                (dout[o * out_nstr + c * out_cstr + i * out_hstr + j] -
-                                 sum * std::exp(
-                                           out[o * out_nstr + c * out_cstr + i * out_hstr + j])) +
-                            beta * din[o * in_nstr + c * in_cstr + i * in_hstr + j];
-                    else
-                        din[o * in_nstr + c * in_cstr + i * in_hstr + j] =
-                            alpha * (out[o * out_nstr + c * out_cstr + i * out_hstr + j] *
-                                     (dout[o * out_nstr + c * out_cstr + i * out_hstr + j] - sum)) +
-                            beta * din[o * in_nstr + c * in_cstr + i * in_hstr + j];
-                });
-            });
+        softmax_cpu_backward(dims(din.desc.GetLengths()),
+                             out.data.data(),
+                             dims(dout.desc.GetStrides()),
+                             dout.data.data(),
+                             dims(dout.desc.GetStrides()),
+                             din.data.data(),
+                             dims(din.desc.GetStrides()),
+                             alpha,
+                             beta,
+                             algo,
+                             mode);
         return din;
     }
 
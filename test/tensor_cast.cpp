@@ -40,6 +40,7 @@
 #include "get_handle.hpp"
 #include "tensor_holder.hpp"
 #include "verify.hpp"
+#include <miopen/float_convert.hpp>
 
 template <class T>
 struct verify_tensor_cast
@@ -71,11 +72,60 @@ struct verify_tensor_cast
         max_val   = pmax_val;
     }
 
+    // The innermost dimension is computed in float and converted to T in one bulk pass.
+    void tensor_cast_last_dim(tensor<T>& dstSuperCpu,
+                              int src_offset_index,
+                              int dst_offset_index,
+                              int dim) const
+    {
+        auto len        = srcDesc.GetLengths()[dim];
+        auto src_stride = srcDesc.GetStrides()[dim];
+        auto dst_stride = dstDesc.GetStrides()[dim];
+
+        std::size_t src_base = ((dim == 0) ? srcOffset : 0) + src_offset_index;
+        std::size_t dst_base = ((dim == 0) ? dstOffset : 0) + dst_offset_index;
+
+        // Indices grow with idx, so the in-bounds elements always form a prefix of the row.
+        std::vector<float> row;
+        row.reserve(len);
+        for(int idx = 0; idx < len; idx++)
+        {
+            std::size_t src_super_index = src_base + src_stride * idx;
+            std::size_t dst_super_index = dst_base + dst_stride * idx;
+            if(dst_super_index >= dstSuperCpu.desc.GetElementSpace() ||
+               src_super_index >= srcSuper.desc.GetElementSpace())
+                break;
+            float temp_val = float(srcSuper[src_super_index]) * alpha;
+            row.push_back(temp_val >= max_val ? max_val : temp_val);
+        }
+
+        if(row.empty())
+            return;
+        if(dst_stride == 1)
+        {
+            miopen::convert_n(row.data(), row.size(), &dstSuperCpu.data[dst_base]);
+        }
+        else
+        {
+            // Convert the row as one contiguous run and scatter the result.
+            std::vector<T> converted(row.size());
+            miopen::convert_n(row.data(), row.size(), converted.data());
+            for(std::size_t idx = 0; idx < converted.size(); idx++)
+                dstSuperCpu.data[dst_base + dst_stride * idx] = converted[idx];
+        }
+    }
+
     void tensor_cast_for_loop(tensor<T>& dstSuperCpu,
                               int src_offset_index,
                               int dst_offset_index,
                               int dim) const
     {
+        if(dim == srcDesc.GetLengths().size() - 1)
+        {
+            tensor_cast_last_dim(dstSuperCpu, src_offset_index, dst_offset_index, dim);
+            return;
+        }
+
         auto src_stride = srcDesc.GetStrides()[dim];
         auto dst_stride = dstDesc.GetStrides()[dim];
 
@@ -86,15 +136,13 @@ struct verify_tensor_cast
             std::size_t dst_super_index =
                 ((dim == 0) ? dstOffset : 0) + dst_offset_index + dst_stride * idx;
 
-            if(dim < (srcDesc.GetLengths().size() - 1))
-            {
-                tensor_cast_for_loop(dstSuperCpu, src_super_index, dst_super_index, dim + 1);
-            }
+            tensor_cast_for_loop(dstSuperCpu, src_super_index, dst_super_index, dim + 1);
             if(dst_super_index < dstSuperCpu.desc.GetElementSpace() &&
                src_super_index < srcSuper.desc.GetElementSpace())
             {
-                float temp_val               = float(srcSuper[src_super_index]) * alpha;
-                dstSuperCpu[dst_super_index] = T(temp_val >= max_val ? max_val : temp_val);
+                float temp_val = float(srcSuper[src_super_index]) * alpha;
+                float result   = temp_val >= max_val ? max_val : temp_val;
+                miopen::convert_n(&result, 1, &dstSuperCpu.data[dst_super_index]);
             }
         }
     }
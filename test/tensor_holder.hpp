@@ -33,6 +33,7 @@
 #include <miopen/type_name.hpp>
 #include <miopen/each_args.hpp>
 #include <miopen/bfloat16.hpp>
+#include <miopen/float_convert.hpp>
 
 #include <half.hpp>
 #include <iomanip>
@@ -123,6 +124,17 @@ struct tensor
         assert(dims.size() == strides.size());
     }
 
+    tensor(const miopen::TensorDims& dims)
+        : desc(miopen_type<T>{}, dims), data(desc.GetElementSpace())
+    {
+    }
+
+    tensor(const miopen::TensorDims& dims, const miopen::TensorDims& strides)
+        : desc(miopen_type<T>{}, dims, strides), data(desc.GetElementSpace())
+    {
+        assert(dims.size() == strides.size());
+    }
+
     tensor(std::size_t n, std::size_t c, std::size_t h, std::size_t w)
         : desc(miopen_type<T>{}, {n, c, h, w}), data(n * c * h * w)
     {
@@ -170,6 +182,12 @@ struct tensor
         seed ^= data.size();
         seed ^= desc.GetLengths().size();
         std::srand(seed);
+        this->generate_values(std::move(g), miopen::is_reduced_float<T>{});
+    }
+
+    template <class G>
+    void generate_values(G g, std::false_type)
+    {
         auto iterator = data.begin();
         auto assign   = [&](T x) {
             assert(iterator < data.end());
@@ -180,6 +198,19 @@ struct tensor
             miopen::compose(miopen::compose(assign, miopen::cast_to<T>()), std::move(g)));
     }
 
+    // half and bfloat16 values are generated as float and converted in one pass.
+    template <class G>
+    void generate_values(G g, std::true_type)
+    {
+        std::vector<float> values;
+        values.reserve(data.size());
+        auto assign = [&](float x) { values.push_back(x); };
+        this->for_each(
+            miopen::compose(miopen::compose(assign, miopen::cast_to<float>()), std::move(g)));
+        assert(values.size() <= data.size());
+        miopen::convert_n(values.data(), values.size(), data.data());
+    }
+
     template <class Loop, class F>
     struct for_each_unpacked
     {
@@ -0,0 +1,195 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include "fixed_data.hpp"
+#include "get_handle.hpp"
+#include "test.hpp"
+#include "verify.hpp"
+
+#include <miopen/activ.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/tensor.hpp>
+#include <miopen/tensor_op_plan.hpp>
+#include <miopen/tensor_ops.hpp>
+
+#include <cstddef>
+#include <vector>
+
+// Checks how TensorOpPlan collapses the dimensions of OpTensor problems and which kernel kind
+// it picks, without running anything on a device. With a GPU, OpTensorFused with an activation
+// is compared with OpTensor followed by the activation on each kernel kind.
+struct tensor_op_plan_test
+{
+    using lens_t = std::vector<std::size_t>;
+
+    static miopen::TensorOpPlan plan(const lens_t& c_lens, const lens_t& b_lens)
+    {
+        const auto c = miopen::TensorDescriptor{miopenFloat, c_lens};
+        const auto b = miopen::TensorDescriptor{miopenFloat, b_lens};
+        return miopen::TensorOpPlan::Make(c, b, c);
+    }
+
+    void run() const
+    {
+        using miopen::TensorOpKind;
+
+        // Same shape: one contiguous run whatever the rank.
+        const auto same = plan({2, 3, 4, 5, 6}, {2, 3, 4, 5, 6});
+        EXPECT(same.kind == TensorOpKind::Contiguous);
+        EXPECT(same.lens == lens_t{720});
+
+        // A single value of B.
+        const auto scalar = plan({8, 16, 7, 7}, {1, 1, 1, 1});
+        EXPECT(scalar.kind == TensorOpKind::ScalarB);
+        EXPECT(scalar.lens == lens_t{8 * 16 * 7 * 7});
+        EXPECT(scalar.b_strides == lens_t{0});
+
+        // Per-channel bias of NCHW and NCDHW collapses to [N, C, spatial].
+        const auto bias = plan({8, 16, 7, 7}, {1, 16, 1, 1});
+        EXPECT(bias.kind == TensorOpKind::ChannelB);
+        EXPECT(bias.lens == (lens_t{8, 16, 49}));
+        EXPECT(bias.b_strides == (lens_t{0, 1, 0}));
+        EXPECT(bias.outer == 8 && bias.mid == 16 && bias.inner == 49);
+
+        const auto bias3d = plan({2, 4, 3, 5, 6}, {1, 4, 1, 1, 1});
+        EXPECT(bias3d.kind == TensorOpKind::ChannelB);
+        EXPECT(bias3d.outer == 2 && bias3d.mid == 4 && bias3d.inner == 90);
+
+        // Unit dimensions do not split a pattern: a batch of one is a [C, spatial] problem.
+        const auto single = plan({1, 16, 7, 7}, {1, 16, 1, 1});
+        EXPECT(single.kind == TensorOpKind::ChannelB);
+        EXPECT(single.outer == 1 && single.mid == 16 && single.inner == 49);
+
+        // B repeated over the rows of a matrix.
+        const auto rows = plan({32, 1, 64}, {1, 1, 64});
+        EXPECT(rows.kind == TensorOpKind::ChannelB);
+        EXPECT(rows.outer == 32 && rows.mid == 64 && rows.inner == 1);
+
+        // Broadcast over an inner and an outer block of dimensions: B varies along N and W.
+        const auto generic = plan({4, 3, 5, 6}, {4, 1, 1, 6});
+        EXPECT(generic.kind == TensorOpKind::Generic);
+        EXPECT(generic.lens == (lens_t{4, 15, 6}));
+        EXPECT(generic.b_strides == (lens_t{6, 0, 1}));
+        EXPECT(generic.c_strides == (lens_t{90, 6, 1}));
+
+        // A strided view of C stays generic but still merges what it can.
+        const auto c_view = miopen::TensorDescriptor{miopenFloat, {4, 3, 8}, {48, 16, 1}};
+        const auto b_full = miopen::TensorDescriptor{miopenFloat, {4, 3, 8}};
+        const auto view   = miopen::TensorOpPlan::Make(b_full, b_full, c_view);
+        EXPECT(view.kind == TensorOpKind::Generic);
+        EXPECT(view.lens == (lens_t{12, 8}));
+        EXPECT(view.a_strides == (lens_t{8, 1}));
+        EXPECT(view.c_strides == (lens_t{16, 1}));
+
+        // All dimensions of length 1.
+        const auto one = plan({1, 1, 1}, {1, 1, 1});
+        EXPECT(one.kind == TensorOpKind::Contiguous);
+        EXPECT(one.GetElementSize() == 1);
+
+        // Lengths of B must be 1 or match C.
+        EXPECT(throws([] { plan({4, 3}, {2, 3}); }));
+    }
+};
+
+#if !MIOPEN_MODE_NOGPU
+struct tensor_op_fused_activ_test
+{
+    using lens_t = std::vector<std::size_t>;
+
+    static void check(const lens_t& c_lens, const lens_t& b_lens, miopenActivationMode_t mode)
+    {
+        auto&& handle     = get_handle();
+        const auto c_desc = miopen::TensorDescriptor{miopenFloat, c_lens};
+        const auto b_desc = miopen::TensorDescriptor{miopenFloat, b_lens};
+        const auto n      = c_desc.GetElementSize();
+        auto activ        = miopen::ActivationDescriptor{mode, 0.5, 0.3, 1.0};
+
+        const float alpha0 = 1.5f;
+        const float alpha1 = -0.5f;
+        const float beta   = 0.25f;
+        const float one    = 1.0f;
+        const float zero   = 0.0f;
+
+        const auto c = fixed_data(n, 3);
+        auto a_dev   = handle.Write(fixed_data(n, 1));
+        auto b_dev   = handle.Write(fixed_data(b_desc.GetElementSize(), 2));
+        auto fused   = handle.Write(c);
+        auto unfused = handle.Write(c);
+        auto activ_y = handle.Write(std::vector<float>(n));
+
+        miopen::OpTensorFused(handle,
+                              miopenTensorOpAdd,
+                              &alpha0,
+                              c_desc,
+                              a_dev.get(),
+                              &alpha1,
+                              b_desc,
+                              b_dev.get(),
+                              &beta,
+                              c_desc,
+                              fused.get(),
+                              &activ);
+
+        miopen::OpTensor(handle,
+                         miopenTensorOpAdd,
+                         &alpha0,
+                         c_desc,
+                         a_dev.get(),
+                         &alpha1,
+                         b_desc,
+                         b_dev.get(),
+                         &beta,
+                         c_desc,
+                         unfused.get());
+        activ.Forward(handle, &one, c_desc, unfused.get(), &zero, c_desc, activ_y.get());
+
+        const auto expected = handle.Read<float>(activ_y, n);
+        const auto actual   = handle.Read<float>(fused, n);
+        EXPECT(miopen::rms_range(expected, actual) < 1e-5);
+    }
+
+    void run() const
+    {
+        for(auto mode : {miopenActivationRELU,
+                         miopenActivationLOGISTIC,
+                         miopenActivationTANH,
+                         miopenActivationLEAKYRELU})
+        {
+            check({4, 3, 5, 6}, {4, 3, 5, 6}, mode); // Contiguous
+            check({4, 3, 5, 6}, {1, 1, 1, 1}, mode); // ScalarB
+            check({4, 8, 5, 6}, {1, 8, 1, 1}, mode); // ChannelB
+            check({4, 3, 5, 6}, {4, 1, 1, 6}, mode); // Generic
+        }
+    }
+};
+#endif
+
+int main()
+{
+    tensor_op_plan_test{}.run();
+#if !MIOPEN_MODE_NOGPU
+    tensor_op_fused_activ_test{}.run();
+#endif
+}
@@ -25,6 +25,8 @@
  *******************************************************************************/
 #include "test.hpp"
 #include <array>
+#include <string>
+#include <vector>
 #include <iostream>
 #include <algorithm>
 #include <numeric>
@@ -826,6 +828,59 @@ void check_null_tensor()
     EXPECT(miopenSet4dTensorDescriptor(nullptr, miopenFloat, 100, 32, 8, 8) != miopenStatusSuccess);
 }
 
+void check_descriptor_cache()
+{
+    const auto reference_layout = [](const miopen::TensorDescriptor& desc, std::string labels) {
+        const auto& lens    = desc.GetLengths();
+        const auto& strides = desc.GetStrides();
+        auto result         = labels;
+        const auto p        = miopen::TensorDescriptor::find_permutation(
+            std::vector<std::size_t>(lens.begin(), lens.end()),
+            std::vector<std::size_t>(strides.begin(), strides.end()));
+        std::transform(p.begin(), p.end(), result.begin(), [&](auto i) { return labels[i]; });
+        return result;
+    };
+
+    const std::vector<miopen::TensorDescriptor> descs = {
+        {miopenFloat, {2, 3, 4, 5}},
+        {miopenFloat, {2, 3, 4, 5}, {60, 1, 15, 3}},
+        {miopenFloat, {2, 3, 4, 5}, {70, 20, 5, 1}},
+        {miopenFloat, {2, 1, 1, 5}, {5, 5, 5, 1}},
+        {miopenFloat, {1, 1, 1, 1}, {1, 1, 1, 1}},
+        {miopenHalf, {2, 3, 4, 5}},
+        {miopenFloat, {2, 3, 4, 5, 6}, {360, 1, 90, 18, 3}},
+        {miopenFloat, {1, 2, 1, 2, 1, 2, 1, 2}},
+        {miopenFloat, {2, 1, 2, 1, 2, 1, 2, 1, 2}},
+        {miopenFloat, {3, 1, 2, 1, 2, 1, 2, 1, 2}},
+    };
+
+    for(const auto& desc : descs)
+    {
+        const auto labels = std::string("ABCDEFGHI").substr(0, desc.GetSize());
+        EXPECT_EQUAL(desc.GetLayout(labels), reference_layout(desc, labels));
+
+        const auto copy = desc;
+        EXPECT(copy == desc);
+        EXPECT_EQUAL(copy.GetHash(), desc.GetHash());
+        EXPECT_EQUAL(copy.GetLayout(labels), desc.GetLayout(labels));
+        EXPECT(copy.GetLengths() == std::vector<std::size_t>(desc.GetLengths()));
+
+        for(const auto& other : descs)
+        {
+            if(&other != &desc && other.GetSize() == desc.GetSize())
+                EXPECT(other != desc);
+        }
+    }
+
+    const miopen::TensorDescriptor nchw{miopenFloat, {2, 3, 4, 5}};
+    const miopen::TensorDescriptor nhwc{miopenFloat, {2, 3, 4, 5}, {60, 1, 15, 3}};
+    EXPECT(nchw.IsPossibleLayout("NCHW", "NCHW"));
+    EXPECT(!nchw.IsPossibleLayout("NCHW", "NHWC"));
+    EXPECT(nhwc.IsPossibleLayout("NCHW", "NHWC"));
+    EXPECT(!nhwc.IsPossibleLayout("NCHW", "NCHW"));
+    EXPECT(!nchw.IsPossibleLayout("NCDHW", "NCDHW"));
+}
+
 int main()
 {
     // printf("Running 1-D.\n");
@@ -860,4 +915,5 @@ int main()
 
     run_test<check_tensor_support>();
     check_null_tensor();
+    check_descriptor_cache();
 }
@@ -30,9 +30,12 @@
 #include <cmath>
 #include <functional>
 #include <iostream>
+#include <miopen/float_convert.hpp>
 #include <miopen/float_equal.hpp>
 #include <miopen/returns.hpp>
 #include <numeric>
+#include <type_traits>
+#include <vector>
 
 namespace miopen {
 
@@ -110,6 +113,37 @@ struct square_diff_fn
 };
 static constexpr square_diff_fn square_diff{};
 
+template <class R>
+using range_iterator = typename std::decay<decltype(std::declval<R>().begin())>::type;
+
+// Ranges of half/bfloat16 stored contiguously (std::vector, tensor) can be converted to float in
+// bulk once, instead of converting every element each time it is visited.
+template <class R, class T = range_value<R>>
+using is_bulk_convertible_range = std::integral_constant<
+    bool,
+    is_reduced_float<T>{} &&
+        (std::is_same<range_iterator<R>, typename std::vector<T>::iterator>{} ||
+         std::is_same<range_iterator<R>, typename std::vector<T>::const_iterator>{})>;
+
+template <class R>
+std::vector<float> as_float_range(R&& r, std::true_type)
+{
+    std::vector<float> result(std::distance(r.begin(), r.end()));
+    if(!result.empty())
+        convert_n(&*r.begin(), result.size(), result.data());
+    return result;
+}
+
+template <class R>
+R&& as_float_range(R&& r, std::false_type)
+{
+    return std::forward<R>(r);
+}
+
+template <class R>
+auto as_float_range(R&& r)
+    MIOPEN_RETURNS(as_float_range(std::forward<R>(r), is_bulk_convertible_range<R>{}));
+
 template <class R1>
 bool range_empty(R1&& r1)
 {
@@ -170,9 +204,11 @@ double rms_range(R1&& r1, R2&& r2)
     std::size_t n = range_distance(r1);
     if(n == range_distance(r2))
     {
-        double square_difference = range_product(r1, r2, 0.0, sum_fn{}, square_diff);
-        double mag1              = *std::max_element(r1.begin(), r1.end(), compare_mag);
-        double mag2              = *std::max_element(r2.begin(), r2.end(), compare_mag);
+        auto&& f1                = as_float_range(r1);
+        auto&& f2                = as_float_range(r2);
+        double square_difference = range_product(f1, f2, 0.0, sum_fn{}, square_diff);
+        double mag1              = *std::max_element(f1.begin(), f1.end(), compare_mag);
+        double mag2              = *std::max_element(f2.begin(), f2.end(), compare_mag);
         double mag =
             std::max({std::fabs(mag1), std::fabs(mag2), std::numeric_limits<double>::min()});
         return std::sqrt(square_difference) / (std::sqrt(n) * mag);